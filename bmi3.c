@@ -112,6 +112,270 @@ static uint8_t bmi3_config_version[] = {
     0xad, 0x00, 0x01, 0x00, 0x08, 0x08
 };
 
+/*! Array to store the headerless FIFO frame layouts, indexed by the FIFO sensor enable bits
+ * {sensor enable, frame length, accel offset, gyro offset, temperature offset, sensor time offset}
+ */
+static const struct bmi3_fifo_frame_layout bmi3_fifo_frame_layouts[BMI3_FIFO_MAX_LAYOUTS] = {
+    { UINT16_C(0x0000), 0, BMI3_FIFO_NO_DATA, BMI3_FIFO_NO_DATA, BMI3_FIFO_NO_DATA, BMI3_FIFO_NO_DATA },
+    { UINT16_C(0x0100), 2, BMI3_FIFO_NO_DATA, BMI3_FIFO_NO_DATA, BMI3_FIFO_NO_DATA, 0 },
+    { UINT16_C(0x0200), 6, 0, BMI3_FIFO_NO_DATA, BMI3_FIFO_NO_DATA, BMI3_FIFO_NO_DATA },
+    { UINT16_C(0x0300), 8, 0, BMI3_FIFO_NO_DATA, BMI3_FIFO_NO_DATA, 6 },
+    { UINT16_C(0x0400), 6, BMI3_FIFO_NO_DATA, 0, BMI3_FIFO_NO_DATA, BMI3_FIFO_NO_DATA },
+    { UINT16_C(0x0500), 8, BMI3_FIFO_NO_DATA, 0, BMI3_FIFO_NO_DATA, 6 },
+    { UINT16_C(0x0600), 12, 0, 6, BMI3_FIFO_NO_DATA, BMI3_FIFO_NO_DATA },
+    { UINT16_C(0x0700), 14, 0, 6, BMI3_FIFO_NO_DATA, 12 },
+    { UINT16_C(0x0800), 2, BMI3_FIFO_NO_DATA, BMI3_FIFO_NO_DATA, 0, BMI3_FIFO_NO_DATA },
+    { UINT16_C(0x0900), 4, BMI3_FIFO_NO_DATA, BMI3_FIFO_NO_DATA, 0, 2 },
+    { UINT16_C(0x0A00), 8, 0, BMI3_FIFO_NO_DATA, 6, BMI3_FIFO_NO_DATA },
+    { UINT16_C(0x0B00), 10, 0, BMI3_FIFO_NO_DATA, 6, 8 },
+    { UINT16_C(0x0C00), 8, BMI3_FIFO_NO_DATA, 0, 6, BMI3_FIFO_NO_DATA },
+    { UINT16_C(0x0D00), 10, BMI3_FIFO_NO_DATA, 0, 6, 8 },
+    { UINT16_C(0x0E00), 14, 0, 6, 12, BMI3_FIFO_NO_DATA },
+    { UINT16_C(0x0F00), 16, 0, 6, 12, 14 }
+};
+
+/*! Array to store the averaging settings valid in low-power mode, indexed by the ODR setting of accel or gyro.
+ * Bit n is set if averaging of 2^n samples leaves samples skipped at the ODR, i.e. 2^n < 6400Hz / ODR.
+ * ODRs above 400Hz are not supported in low-power mode
+ */
+static const uint8_t bmi3_odr_avg_valid[BMI3_ODR_AVG_VALID_COUNT] = {
+    0x00, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x3F, 0x1F, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00
+};
+
+#ifdef BMI330
+
+/*! Gyro self-calibration/self-test coefficients as written to the feature engine, in little-endian words */
+static const uint8_t bmi3_sc_st_coeff[BMI3_SC_ST_COEFF_LEN] = {
+    BMI3_SC_ST_VALUE_0 & BMI3_SET_LOW_BYTE, (BMI3_SC_ST_VALUE_0 & BMI3_SET_HIGH_BYTE) >> 8,
+    BMI3_SC_ST_VALUE_1 & BMI3_SET_LOW_BYTE, (BMI3_SC_ST_VALUE_1 & BMI3_SET_HIGH_BYTE) >> 8,
+    BMI3_SC_ST_VALUE_2 & BMI3_SET_LOW_BYTE, (BMI3_SC_ST_VALUE_2 & BMI3_SET_HIGH_BYTE) >> 8,
+    BMI3_SC_ST_VALUE_3 & BMI3_SET_LOW_BYTE, (BMI3_SC_ST_VALUE_3 & BMI3_SET_HIGH_BYTE) >> 8,
+    BMI3_SC_ST_VALUE_4 & BMI3_SET_LOW_BYTE, (BMI3_SC_ST_VALUE_4 & BMI3_SET_HIGH_BYTE) >> 8,
+    BMI3_SC_ST_VALUE_5 & BMI3_SET_LOW_BYTE, (BMI3_SC_ST_VALUE_5 & BMI3_SET_HIGH_BYTE) >> 8,
+    BMI3_SC_ST_VALUE_6 & BMI3_SET_LOW_BYTE, (BMI3_SC_ST_VALUE_6 & BMI3_SET_HIGH_BYTE) >> 8,
+    BMI3_SC_ST_VALUE_7 & BMI3_SET_LOW_BYTE, (BMI3_SC_ST_VALUE_7 & BMI3_SET_HIGH_BYTE) >> 8,
+    BMI3_SC_ST_VALUE_8 & BMI3_SET_LOW_BYTE, (BMI3_SC_ST_VALUE_8 & BMI3_SET_HIGH_BYTE) >> 8
+};
+#endif
+
+#if BMI3_ENABLE_FEATURE_ANY_MOTION
+/*! Array to store the fields of the any-motion configuration in the feature engine words */
+static const struct bmi3_feature_field bmi3_any_motion_fields[] = {
+    BMI3_FEATURE_FIELD(bmi3_any_motion_config, slope_thres, 0, BMI3_ANY_NO_SLOPE_THRESHOLD_MASK, 0),
+    BMI3_FEATURE_FIELD(bmi3_any_motion_config, acc_ref_up, 0, BMI3_ANY_NO_ACC_REF_UP_MASK, BMI3_ANY_NO_ACC_REF_UP_POS),
+    BMI3_FEATURE_FIELD(bmi3_any_motion_config, hysteresis, 1, BMI3_ANY_NO_HYSTERESIS_MASK, 0),
+    BMI3_FEATURE_FIELD(bmi3_any_motion_config, duration, 2, BMI3_ANY_NO_DURATION_MASK, 0),
+    BMI3_FEATURE_FIELD(bmi3_any_motion_config, wait_time, 2, BMI3_ANY_NO_WAIT_TIME_MASK, BMI3_ANY_NO_WAIT_TIME_POS)
+};
+#endif
+
+#if BMI3_ENABLE_FEATURE_NO_MOTION
+/*! Array to store the fields of the no-motion configuration in the feature engine words */
+static const struct bmi3_feature_field bmi3_no_motion_fields[] = {
+    BMI3_FEATURE_FIELD(bmi3_no_motion_config, slope_thres, 0, BMI3_ANY_NO_SLOPE_THRESHOLD_MASK, 0),
+    BMI3_FEATURE_FIELD(bmi3_no_motion_config, acc_ref_up, 0, BMI3_ANY_NO_ACC_REF_UP_MASK, BMI3_ANY_NO_ACC_REF_UP_POS),
+    BMI3_FEATURE_FIELD(bmi3_no_motion_config, hysteresis, 1, BMI3_ANY_NO_HYSTERESIS_MASK, 0),
+    BMI3_FEATURE_FIELD(bmi3_no_motion_config, duration, 2, BMI3_ANY_NO_DURATION_MASK, 0),
+    BMI3_FEATURE_FIELD(bmi3_no_motion_config, wait_time, 2, BMI3_ANY_NO_WAIT_TIME_MASK, BMI3_ANY_NO_WAIT_TIME_POS)
+};
+#endif
+
+#if BMI3_ENABLE_FEATURE_FLAT
+/*! Array to store the fields of the flat configuration in the feature engine words */
+static const struct bmi3_feature_field bmi3_flat_fields[] = {
+    BMI3_FEATURE_FIELD(bmi3_flat_config, theta, 0, BMI3_FLAT_THETA_MASK, 0),
+    BMI3_FEATURE_FIELD(bmi3_flat_config, blocking, 0, BMI3_FLAT_BLOCKING_MASK, BMI3_FLAT_BLOCKING_POS),
+    BMI3_FEATURE_FIELD(bmi3_flat_config, hold_time, 0, BMI3_FLAT_HOLD_TIME_MASK, BMI3_FLAT_HOLD_TIME_POS),
+    BMI3_FEATURE_FIELD(bmi3_flat_config, slope_thres, 1, BMI3_FLAT_SLOPE_THRES_MASK, 0),
+    BMI3_FEATURE_FIELD(bmi3_flat_config, hysteresis, 1, BMI3_FLAT_HYST_MASK, BMI3_FLAT_HYST_POS)
+};
+#endif
+
+#if BMI3_ENABLE_FEATURE_SIG_MOTION
+/*! Array to store the fields of the significant motion configuration in the feature engine words */
+static const struct bmi3_feature_field bmi3_sig_motion_fields[] = {
+    BMI3_FEATURE_FIELD(bmi3_sig_motion_config, block_size, 0, BMI3_SIG_BLOCK_SIZE_MASK, 0),
+    BMI3_FEATURE_FIELD(bmi3_sig_motion_config, peak_2_peak_min, 1, BMI3_SIG_P2P_MIN_MASK, 0),
+    BMI3_FEATURE_FIELD(bmi3_sig_motion_config, mcr_min, 1, BMI3_SIG_MCR_MIN_MASK, BMI3_SIG_MCR_MIN_POS),
+    BMI3_FEATURE_FIELD(bmi3_sig_motion_config, peak_2_peak_max, 2, BMI3_SIG_P2P_MAX_MASK, 0),
+    BMI3_FEATURE_FIELD(bmi3_sig_motion_config, mcr_max, 2, BMI3_MCR_MAX_MASK, BMI3_MCR_MAX_POS)
+};
+#endif
+
+#if BMI3_ENABLE_FEATURE_TILT
+/*! Array to store the fields of the tilt configuration in the feature engine words */
+static const struct bmi3_feature_field bmi3_tilt_fields[] = {
+    BMI3_FEATURE_FIELD(bmi3_tilt_config, segment_size, 0, BMI3_TILT_SEGMENT_SIZE_MASK, 0),
+    BMI3_FEATURE_FIELD(bmi3_tilt_config,
+                       min_tilt_angle,
+                       0,
+                       BMI3_TILT_MIN_TILT_ANGLE_MASK,
+                       BMI3_TILT_MIN_TILT_ANGLE_POS),
+    BMI3_FEATURE_FIELD(bmi3_tilt_config, beta_acc_mean, 1, BMI3_TILT_BETA_ACC_MEAN_MASK, 0)
+};
+#endif
+
+#if BMI3_ENABLE_FEATURE_ORIENTATION
+/*! Array to store the fields of the orientation configuration in the feature engine words */
+static const struct bmi3_feature_field bmi3_orientation_fields[] = {
+    BMI3_FEATURE_FIELD(bmi3_orientation_config, ud_en, 0, BMI3_ORIENT_UD_EN_MASK, 0),
+    BMI3_FEATURE_FIELD(bmi3_orientation_config, mode, 0, BMI3_ORIENT_MODE_MASK, BMI3_ORIENT_MODE_POS),
+    BMI3_FEATURE_FIELD(bmi3_orientation_config, blocking, 0, BMI3_ORIENT_BLOCKING_MASK, BMI3_ORIENT_BLOCKING_POS),
+    BMI3_FEATURE_FIELD(bmi3_orientation_config, theta, 0, BMI3_ORIENT_THETA_MASK, BMI3_ORIENT_THETA_POS),
+    BMI3_FEATURE_FIELD(bmi3_orientation_config, hold_time, 0, BMI3_ORIENT_HOLD_TIME_MASK, BMI3_ORIENT_HOLD_TIME_POS),
+    BMI3_FEATURE_FIELD(bmi3_orientation_config, slope_thres, 1, BMI3_ORIENT_SLOPE_THRES_MASK, 0),
+    BMI3_FEATURE_FIELD(bmi3_orientation_config, hysteresis, 1, BMI3_ORIENT_HYST_MASK, BMI3_ORIENT_HYST_POS)
+};
+#endif
+
+#if BMI3_ENABLE_FEATURE_STEP_COUNTER
+/*! Array to store the fields of the step counter configuration in the feature engine words */
+static const struct bmi3_feature_field bmi3_step_counter_fields[] = {
+    BMI3_FEATURE_FIELD(bmi3_step_counter_config, watermark_level, 0, BMI3_STEP_WATERMARK_MASK, 0),
+    BMI3_FEATURE_FIELD(bmi3_step_counter_config,
+                       reset_counter,
+                       0,
+                       BMI3_STEP_RESET_COUNTER_MASK,
+                       BMI3_STEP_RESET_COUNTER_POS),
+    BMI3_FEATURE_FIELD(bmi3_step_counter_config, env_min_dist_up, 1, BMI3_STEP_ENV_MIN_DIST_UP_MASK, 0),
+    BMI3_FEATURE_FIELD(bmi3_step_counter_config, env_coef_up, 2, BMI3_STEP_ENV_COEF_UP_MASK, 0),
+    BMI3_FEATURE_FIELD(bmi3_step_counter_config, env_min_dist_down, 3, BMI3_STEP_ENV_MIN_DIST_DOWN_MASK, 0),
+    BMI3_FEATURE_FIELD(bmi3_step_counter_config, env_coef_down, 4, BMI3_STEP_ENV_COEF_DOWN_MASK, 0),
+    BMI3_FEATURE_FIELD(bmi3_step_counter_config, mean_val_decay, 5, BMI3_STEP_MEAN_VAL_DECAY_MASK, 0),
+    BMI3_FEATURE_FIELD(bmi3_step_counter_config, mean_step_dur, 6, BMI3_STEP_MEAN_STEP_DUR_MASK, 0),
+    BMI3_FEATURE_FIELD(bmi3_step_counter_config, step_buffer_size, 7, BMI3_STEP_BUFFER_SIZE_MASK, 0),
+    BMI3_FEATURE_FIELD(bmi3_step_counter_config,
+                       filter_cascade_enabled,
+                       7,
+                       BMI3_STEP_FILTER_CASCADE_ENABLED_MASK,
+                       BMI3_STEP_FILTER_CASCADE_ENABLED_POS),
+    BMI3_FEATURE_FIELD(bmi3_step_counter_config,
+                       step_counter_increment,
+                       7,
+                       BMI3_STEP_COUNTER_INCREMENT_MASK,
+                       BMI3_STEP_COUNTER_INCREMENT_POS),
+    BMI3_FEATURE_FIELD(bmi3_step_counter_config,
+                       peak_duration_min_walking,
+                       8,
+                       BMI3_STEP_PEAK_DURATION_MIN_WALKING_MASK,
+                       0),
+    BMI3_FEATURE_FIELD(bmi3_step_counter_config,
+                       peak_duration_min_running,
+                       8,
+                       BMI3_STEP_PEAK_DURATION_MIN_RUNNING_MASK,
+                       BMI3_STEP_PEAK_DURATION_MIN_RUNNING_POS),
+    BMI3_FEATURE_FIELD(bmi3_step_counter_config,
+                       activity_detection_factor,
+                       9,
+                       BMI3_STEP_ACTIVITY_DETECTION_FACTOR_MASK,
+                       0),
+    BMI3_FEATURE_FIELD(bmi3_step_counter_config,
+                       activity_detection_thres,
+                       9,
+                       BMI3_STEP_ACTIVITY_DETECTION_THRESHOLD_MASK,
+                       BMI3_STEP_ACTIVITY_DETECTION_THRESHOLD_POS),
+    BMI3_FEATURE_FIELD(bmi3_step_counter_config, step_duration_max, 10, BMI3_STEP_DURATION_MAX_MASK, 0),
+    BMI3_FEATURE_FIELD(bmi3_step_counter_config,
+                       step_duration_window,
+                       10,
+                       BMI3_STEP_DURATION_WINDOW_MASK,
+                       BMI3_STEP_DURATION_WINDOW_POS),
+    BMI3_FEATURE_FIELD(bmi3_step_counter_config, step_duration_pp_enabled, 11, BMI3_STEP_DURATION_PP_ENABLED_MASK, 0),
+    BMI3_FEATURE_FIELD(bmi3_step_counter_config,
+                       step_duration_thres,
+                       11,
+                       BMI3_STEP_DURATION_THRESHOLD_MASK,
+                       BMI3_STEP_DURATION_THRESHOLD_POS),
+    BMI3_FEATURE_FIELD(bmi3_step_counter_config,
+                       mean_crossing_pp_enabled,
+                       11,
+                       BMI3_STEP_MEAN_CROSSING_PP_ENABLED_MASK,
+                       BMI3_STEP_MEAN_CROSSING_PP_ENABLED_POS),
+    BMI3_FEATURE_FIELD(bmi3_step_counter_config,
+                       mcr_threshold,
+                       11,
+                       BMI3_STEP_MCR_THRESHOLD_MASK,
+                       BMI3_STEP_MCR_THRESHOLD_POS)
+};
+#endif
+
+#if BMI3_ENABLE_FEATURE_TAP
+/*! Array to store the fields of the tap configuration in the feature engine words */
+static const struct bmi3_feature_field bmi3_tap_fields[] = {
+    BMI3_FEATURE_FIELD(bmi3_tap_detector_config, axis_sel, 0, BMI3_TAP_AXIS_SEL_MASK, 0),
+    BMI3_FEATURE_FIELD(bmi3_tap_detector_config,
+                       wait_for_timeout,
+                       0,
+                       BMI3_TAP_WAIT_FR_TIME_OUT_MASK,
+                       BMI3_TAP_WAIT_FR_TIME_OUT_POS),
+    BMI3_FEATURE_FIELD(bmi3_tap_detector_config, max_peaks_for_tap, 0, BMI3_TAP_MAX_PEAKS_MASK, BMI3_TAP_MAX_PEAKS_POS),
+    BMI3_FEATURE_FIELD(bmi3_tap_detector_config, mode, 0, BMI3_TAP_MODE_MASK, BMI3_TAP_MODE_POS),
+    BMI3_FEATURE_FIELD(bmi3_tap_detector_config, tap_peak_thres, 1, BMI3_TAP_PEAK_THRES_MASK, 0),
+    BMI3_FEATURE_FIELD(bmi3_tap_detector_config,
+                       max_gest_dur,
+                       1,
+                       BMI3_TAP_MAX_GEST_DUR_MASK,
+                       BMI3_TAP_MAX_GEST_DUR_POS),
+    BMI3_FEATURE_FIELD(bmi3_tap_detector_config, max_dur_between_peaks, 2, BMI3_TAP_MAX_DUR_BW_PEAKS_MASK, 0),
+    BMI3_FEATURE_FIELD(bmi3_tap_detector_config,
+                       tap_shock_settling_dur,
+                       2,
+                       BMI3_TAP_SHOCK_SETT_DUR_MASK,
+                       BMI3_TAP_SHOCK_SETT_DUR_POS),
+    BMI3_FEATURE_FIELD(bmi3_tap_detector_config,
+                       min_quite_dur_between_taps,
+                       2,
+                       BMI3_TAP_MIN_QUITE_DUR_BW_TAPS_MASK,
+                       BMI3_TAP_MIN_QUITE_DUR_BW_TAPS_POS),
+    BMI3_FEATURE_FIELD(bmi3_tap_detector_config,
+                       quite_time_after_gest,
+                       2,
+                       BMI3_TAP_QUITE_TIME_AFTR_GEST_MASK,
+                       BMI3_TAP_QUITE_TIME_AFTR_GEST_POS)
+};
+#endif
+
+/*! Array to store the fields of the alternate auto-config change configuration in the feature engine words */
+static const struct bmi3_feature_field bmi3_alternate_auto_fields[] = {
+    BMI3_FEATURE_FIELD(bmi3_auto_config_change, alt_conf_alt_switch_src_select, 0, BMI3_ALT_CONF_ALT_SWITCH_MASK, 0),
+    BMI3_FEATURE_FIELD(bmi3_auto_config_change,
+                       alt_conf_user_switch_src_select,
+                       0,
+                       BMI3_ALT_CONF_USER_SWITCH_MASK,
+                       BMI3_ALT_CONF_USER_SWITCH_POS)
+};
+
+/*! Array to store the codecs of the feature engine configurations
+ * {type, base address, number of words, minimum low-power accel ODR, fields}, an ODR of 0 is not checked
+ */
+static const struct bmi3_feature_codec bmi3_feature_codecs[] = {
+#if BMI3_ENABLE_FEATURE_ANY_MOTION
+    BMI3_FEATURE_CODEC(BMI3_ANY_MOTION, BMI3_BASE_ADDR_ANY_MOTION, 3, 0, bmi3_any_motion_fields),
+#endif
+#if BMI3_ENABLE_FEATURE_NO_MOTION
+    BMI3_FEATURE_CODEC(BMI3_NO_MOTION, BMI3_BASE_ADDR_NO_MOTION, 3, 0, bmi3_no_motion_fields),
+#endif
+#if BMI3_ENABLE_FEATURE_FLAT
+    BMI3_FEATURE_CODEC(BMI3_FLAT, BMI3_BASE_ADDR_FLAT, 2, 0, bmi3_flat_fields),
+#endif
+#if BMI3_ENABLE_FEATURE_SIG_MOTION
+    BMI3_FEATURE_CODEC(BMI3_SIG_MOTION, BMI3_BASE_ADDR_SIG_MOTION, 3, BMI3_ACC_ODR_50HZ, bmi3_sig_motion_fields),
+#endif
+#if BMI3_ENABLE_FEATURE_TILT
+    BMI3_FEATURE_CODEC(BMI3_TILT, BMI3_BASE_ADDR_TILT, 2, 0, bmi3_tilt_fields),
+#endif
+#if BMI3_ENABLE_FEATURE_ORIENTATION
+    BMI3_FEATURE_CODEC(BMI3_ORIENTATION, BMI3_BASE_ADDR_ORIENT, 2, 0, bmi3_orientation_fields),
+#endif
+#if BMI3_ENABLE_FEATURE_STEP_COUNTER
+    BMI3_FEATURE_CODEC(BMI3_STEP_COUNTER, BMI3_BASE_ADDR_STEP_CNT, 12, BMI3_ACC_ODR_50HZ, bmi3_step_counter_fields),
+#endif
+#if BMI3_ENABLE_FEATURE_TAP
+    BMI3_FEATURE_CODEC(BMI3_TAP, BMI3_BASE_ADDR_TAP, 3, BMI3_ACC_ODR_200HZ, bmi3_tap_fields),
+#endif
+    BMI3_FEATURE_CODEC(BMI3_ALT_AUTO_CONFIG, BMI3_BASE_ADDR_ALT_AUTO_CONFIG, 1, 0, bmi3_alternate_auto_fields)
+};
+
 /******************************************************************************/
 
 /*!         Local Function Prototypes
@@ -314,6 +578,16 @@ static int8_t get_temp_sensortime_data(struct bmi3_sens_axes_data *data, const u
  */
 static int8_t get_step_counter_sensor_data(uint32_t *step_count, uint8_t reg_addr, struct bmi3_dev *dev);
 
+/*!
+ * @brief This internal API gets the step counter output from the register data.
+ *
+ * @param[in] reg_data      : Register data of step counter output.
+ *
+ * @return Step counter output
+ *
+ */
+static uint32_t get_step_counter(const uint8_t *reg_data);
+
 /*!
  * @brief This internal API gets the orientation output data from the register.
  *
@@ -388,352 +662,61 @@ static int8_t set_feature_enable(const struct bmi3_feature_enable *enable, struc
 static int8_t get_feature_enable(struct bmi3_feature_enable *enable, struct bmi3_dev *dev);
 
 /*!
- * @brief This internal API gets any-motion configurations like slope_thres,
- * duration, hysteresis, accel ref up and wait time.
- *
- * @param[out]      config     : Structure instance of bmi3_any_motion_config.
- * @param[in, out] dev         : Structure instance of bmi3_dev.
- *
- * @verbatim
- *----------------------------------------------------------------------------
- *  bmi3_any_motion_config  |
- *  Structure parameters    |                   Description
- *--------------------------|--------------------------------------------------
- *                          | Minimum slope of acceleration signal for
- *                          | motion detection.
- *   slope_thres            | Default value = 10, Range = 0 to 4095, Unit = 1.953mg.
- *                          |
- * -------------------------|---------------------------------------------------
- *   accel reference up     |  Mode of the acceleration reference update
- * -------------------------|---------------------------------------------------
- *                          | Hysteresis for the slope of the acceleration
- *   hysteresis             | signal. Default value = 2, Range = 0 to 1023,
- *                          | Unit = 1.953mg.
- * -------------------------|---------------------------------------------------
- *                          | Defines the number of  consecutive data points for
- *                          | which the threshold condition must be respected,
- *                          | for interrupt assertion.
- *   duration               | unit is 20ms, range
- *                          | Default value is 10 = 2000ms.
- * -------------------------|---------------------------------------------------
- *                          |
- *   wait time              | Wait time for clearing the event after slope
- *                          | is below threshold. Default value = 3, Range = 0 to 7, Unit =
- *                          | 20ms.
- * -----------------------------------------------------------------------------
- *
- * @endverbatim
- *
- * @return Result of API execution status
+ * @brief This internal API gets the codec of a feature engine configuration.
  *
- * @return 0 -> Success
- * @return < 0 -> Fail
- *
- */
-static int8_t get_any_motion_config(struct bmi3_any_motion_config *config, struct bmi3_dev *dev);
-
-/*!
- * @brief This internal API sets any-motion configurations like slope threshold,
- * duration, hysteresis, accel ref up and wait time.
- *
- * @param[in]      config      : Structure instance of bmi3_any_motion_config.
- * @param[in, out] dev         : Structure instance of bmi3_dev.
- *
- * @verbatim
- *----------------------------------------------------------------------------
- *  bmi3_any_motion_config  |
- *  Structure parameters    |                   Description
- *--------------------------|--------------------------------------------------
- *                          | Minimum slope of acceleration signal for
- *                          | motion detection.
- *   slope_thres            | Default value = 10, Range = 0 to 4095, Unit = 1.953mg.
- *                          |
- * -------------------------|---------------------------------------------------
- *   accel reference up     |  Mode of the acceleration reference update
- * -------------------------|---------------------------------------------------
- *                          | Hysteresis for the slope of the acceleration
- *   hysteresis             | signal. Default value = 2, Range = 0 to 1023,
- *                          | Unit = 1.953mg.
- * -------------------------|---------------------------------------------------
- *                          | Defines the number of  consecutive data points for
- *                          | which the threshold condition must be respected,
- *                          | for interrupt assertion.
- *   duration               | unit is 20ms, range
- *                          | Default value is 10 = 2000ms.
- * -------------------------|---------------------------------------------------
- *                          |
- *   wait time              | Wait time for clearing the event after slope
- *                          | is below threshold. Default value = 3, Range = 0 to 7, Unit =
- *                          | 20ms.
- * -----------------------------------------------------------------------------
- *
- * @endverbatim
- *
- * @return Result of API execution status
- *
- * @return 0 -> Success
- * @return < 0 -> Fail
+ * @param[in] type        : Type of the feature.
  *
+ * @return Codec of the feature, NULL if the feature is not handled
  */
-static int8_t set_any_motion_config(const struct bmi3_any_motion_config *config, struct bmi3_dev *dev);
-
-/*!
- * @brief This internal API gets no-motion configurations like slope threshold,
- * duration, hysteresis, accel ref up and wait time.
- *
- * @param[out]      config     : Structure instance of bmi3_no_motion_config.
- * @param[in, out] dev         : Structure instance of bmi3_dev.
- *
- * @verbatim
- *----------------------------------------------------------------------------
- *  bmi3_no_motion_config   |
- *  Structure parameters    |                   Description
- *--------------------------|--------------------------------------------------
- *                          | Minimum slope of acceleration signal for
- *                          | motion detection.
- *   slope_thres            | Default value = 10, Range = 0 to 4095, Unit = 1.953mg.
- *                          |
- * -------------------------|---------------------------------------------------
- *   accel reference up     |  Mode of the acceleration reference update
- * -------------------------|---------------------------------------------------
- *                          | Hysteresis for the slope of the acceleration
- *   hysteresis             | signal. Default value = 2, Range = 0 to 1023,
- *                          | Unit = 1.953mg.
- * -------------------------|---------------------------------------------------
- *                          | Defines the number of  consecutive data points for
- *                          | which the threshold condition must be respected,
- *                          | for interrupt assertion.
- *   duration               | unit is 20ms, range
- *                          | Default value is 10 = 2000ms.
- * -------------------------|---------------------------------------------------
- *                          |
- *   wait time              | Wait time for clearing the event after slope
- *                          | is below threshold. Default value = 3, Range = 0 to 7, Unit =
- *                          | 20ms.
- * -----------------------------------------------------------------------------
- *
- * @endverbatim
- *
- * @return Result of API execution status
- *
- * @return 0 -> Success
- * @return < 0 -> Fail
+static const struct bmi3_feature_codec *get_feature_codec(uint8_t type);
+
+/*!
+ * @brief This internal API decodes the fields of a feature configuration from
+ * the words of the feature engine.
  *
+ * @param[in]  data        : Words of the feature, LSB first.
+ * @param[in]  codec       : Codec of the feature.
+ * @param[out] config      : Configuration structure of the feature.
  */
-static int8_t get_no_motion_config(struct bmi3_no_motion_config *config, struct bmi3_dev *dev);
-
-/*!
- * @brief This internal API sets no-motion configurations like slope threshold,
- * duration, hysteresis, accel ref up and wait time.
- *
- * @param[in]      config      : Structure instance of bmi3_no_motion_config.
- * @param[in, out] dev         : Structure instance of bmi3_dev.
- *
- * @verbatim
- *----------------------------------------------------------------------------
- *  bmi3_no_motion_config   |
- *  Structure parameters    |                   Description
- *--------------------------|--------------------------------------------------
- *                          | Minimum slope of acceleration signal for
- *                          | motion detection.
- *   slope_thres            | Default value = 10, Range = 0 to 4095, Unit = 1.953mg.
- *                          |
- * -------------------------|---------------------------------------------------
- *   accel reference up     |  Mode of the acceleration reference update
- * -------------------------|---------------------------------------------------
- *                          | Hysteresis for the slope of the acceleration
- *   hysteresis             | signal. Default value = 2, Range = 0 to 1023,
- *                          | Unit = 1.953mg.
- * -------------------------|---------------------------------------------------
- *                          | Defines the number of  consecutive data points for
- *                          | which the threshold condition must be respected,
- *                          | for interrupt assertion.
- *   duration               | unit is 20ms, range
- *                          | Default value is 10 = 2000ms.
- * -------------------------|---------------------------------------------------
- *                          |
- *   wait time              | Wait time for clearing the event after slope
- *                          | is below threshold. Default value = 3, Range = 0 to 7, Unit =
- *                          | 20ms.
- * -----------------------------------------------------------------------------
- *
- * @endverbatim
- *
- * @return Result of API execution status
- *
- * @return 0 -> Success
- * @return < 0 -> Fail
+static void unpack_feature_fields(const uint8_t *data, const struct bmi3_feature_codec *codec, void *config);
+
+/*!
+ * @brief This internal API encodes the fields of a feature configuration into
+ * the words of the feature engine. Bits outside of the fields are set to 0.
  *
+ * @param[in]  config      : Configuration structure of the feature.
+ * @param[in]  codec       : Codec of the feature.
+ * @param[out] data        : Words of the feature, LSB first.
  */
-static int8_t set_no_motion_config(const struct bmi3_no_motion_config *config, struct bmi3_dev *dev);
-
-/*!
- * @brief This internal API gets flat configurations like theta, blocking,
- * hold-time, hysteresis, and slope threshold.
- *
- * @param[out]     config           : Structure instance of bmi3_flat_config.
- * @param[in, out] dev              : Structure instance of bmi3_dev.
- *
- * @verbatim
- *----------------------------------------------------------------------------
- *      bmi3_flat_config    |
- *      Structure parameters|               Description
- *--------------------------|--------------------------------------------------
- *                          | Theta angle, used for detecting flat
- *                          | position.
- *      theta               | Theta = 64 * (tan(angle)^2);
- *                          | Default value is 8, equivalent to 20 degrees angle
- * -------------------------|---------------------------------------------------
- *                          | Hysteresis for Theta Flat detection.
- *      hysteresis          | Default value is 9 = 2.5 degrees, corresponding
- *                          | to the default Theta angle of 20 degrees.
- * -------------------------|---------------------------------------------------
- *                          | Sets the blocking mode. If blocking is set, no
- *                          | Flat interrupt will be triggered.
- *      blocking            | Default value is 2, the most restrictive blocking
- *                          | mode.
- * -------------------------|---------------------------------------------------
- *                          | Holds the duration in 50Hz samples for which the
- *                          | condition has to be respected.
- *      hold-time           | Default value is 32 = 640 m-sec.
- *                          | Range is 0 to 5.1 sec.
- * -------------------------|---------------------------------------------------
- *                          | Minimum slope between consecutive acceleration
- *      slope_thres         | samples to prevent the change of flat status during
- *                          | large movement. Default value is 0xcd = 400.365mg,
- *                          | Range = 498.015mg, Unit = 1.953mg.
- * -------------------------|---------------------------------------------------
- * @endverbatim
- *
- * @return Result of API execution status
- *
- * @return 0 -> Success
- * @return < 0 -> Fail
+static void pack_feature_fields(const void *config, const struct bmi3_feature_codec *codec, uint8_t *data);
+
+/*!
+ * @brief This internal API checks the accel configuration against the minimum
+ * low-power ODR needed by a feature.
  *
- */
-static int8_t get_flat_config(struct bmi3_flat_config *config, struct bmi3_dev *dev);
-
-/*!
- * @brief This internal API sets flat configurations like theta, blocking,
- * hold-time, hysteresis, and slope threshold.
- *
- * @param[in]     config           : Structure instance of bmi3_flat_config.
- * @param[in, out] dev             : Structure instance of bmi3_dev.
- *
- * @verbatim
- *----------------------------------------------------------------------------
- *      bmi3_flat_config    |
- *      Structure parameters|               Description
- *--------------------------|--------------------------------------------------
- *                          | Theta angle, used for detecting flat
- *                          | position.
- *      theta               | Theta = 64 * (tan(angle)^2);
- *                          | Default value is 8, equivalent to 20 degrees angle
- * -------------------------|---------------------------------------------------
- *                          | Hysteresis for Theta Flat detection.
- *      hysteresis          | Default value is 9 = 2.5 degrees, corresponding
- *                          | to the default Theta angle of 20 degrees.
- * -------------------------|---------------------------------------------------
- *                          | Sets the blocking mode. If blocking is set, no
- *                          | Flat interrupt will be triggered.
- *      blocking            | Default value is 2, the most restrictive blocking
- *                          | mode.
- * -------------------------|---------------------------------------------------
- *                          | Holds the duration in 50Hz samples for which the
- *                          | condition has to be respected.
- *      hold-time           | Default value is 32 = 640 m-sec.
- *                          | Range is 0 to 5.1 sec.
- * -------------------------|---------------------------------------------------
- *                          | Minimum slope between consecutive acceleration
- *      slope_threshold     | samples to prevent the change of flat status during
- *                          | large movement. Default value is 0xcd = 400.365mg,
- *                          | Range = 498.015mg, Unit = 1.953mg.
- * -------------------------|---------------------------------------------------
- * @endverbatim
+ * @param[in] codec       : Codec of the feature.
+ * @param[in] dev         : Structure instance of bmi3_dev.
  *
  * @return Result of API execution status
  *
  * @return 0 -> Success
  * @return < 0 -> Fail
- *
  */
-static int8_t set_flat_config(const struct bmi3_flat_config *config, struct bmi3_dev *dev);
+static int8_t check_feature_accel_config(const struct bmi3_feature_codec *codec, struct bmi3_dev *dev);
 
 /*!
- * @brief This internal API gets sig-motion configurations like block-size,
- * peak_2_peak_min, mcr_min, peak_2_peak_max and mcr_max parameters.
- *
- * @param[out]      config    : Structure instance of bmi3_sig_motion_config.
- * @param[in, out]  dev       : Structure instance of bmi3_dev.
- *
- *----------------------------------------------------------------------------
- *  bmi3_sig_motion_config  |
- *  Structure parameters    |                   Description
- * -------------------------|---------------------------------------------------
- *                          | Defines the duration after which the significant
- *  block_size              | motion interrupt is triggered. It is expressed in
- *                          | 50 Hz samples (20 ms). Default value is 0xFA=5sec.
- *--------------------------|---------------------------------------------------
- *                          | Minimum value of the peak to peak acceleration
- *  peak_2_peak_min         | magnitude. Default value 0x26 = 74.214mg, Range = 0 to 1023,
- *                          | Unit = 1.953mg
- *--------------------------|---------------------------------------------------
- *                          | Minimum number of mean crossing per second in accel
- *  mcr_min                 | magnitude. Default value = 17, Range = 0 to 63.
- *--------------------------|---------------------------------------------------
- *                          | Maximum value of the peak to peak acceleration
- *  peak_2_peak_max         | magnitude. Default value 0x253 = 1162.035mg, Range = 0 to 1023,
- *                          | Unit = 1.953mg
- *--------------------------|---------------------------------------------------
- *                          | Maximum number of mean crossing per second in accel
- *  mcr_max                 | magnitude. Default value = 17, Range = 0 to 63.
- *--------------------------|---------------------------------------------------
- *
- * @return Result of API execution status
- *
- * @return 0 -> Success
- * @return < 0 -> Fail
+ * @brief This internal API gets the configuration of a feature from the
+ * feature engine.
  *
- */
-static int8_t get_sig_motion_config(struct bmi3_sig_motion_config *config, struct bmi3_dev *dev);
-
-/*!
- * @brief This internal API sets sig-motion configurations like block-size,
- * peak_2_peak_min, mcr_min, peak_2_peak_max and mcr_max parameters.
- *
- * @param[in]      config    : Structure instance of bmi3_sig_motion_config.
- * @param[in, out]  dev      : Structure instance of bmi3_dev.
- *
- *----------------------------------------------------------------------------
- *  bmi3_sig_motion_config  |
- *  Structure parameters    |                   Description
- * -------------------------|---------------------------------------------------
- *                          | Defines the duration after which the significant
- *  block_size              | motion interrupt is triggered. It is expressed in
- *                          | 50 Hz samples (20 ms). Default value is 0xFA=5sec.
- *--------------------------|---------------------------------------------------
- *                          | Minimum value of the peak to peak acceleration
- *  peak_2_peak_min         | magnitude. Default value 0x26 = 74.214mg, Range = 0 to 1023,
- *                          | Unit = 1.953mg
- *--------------------------|---------------------------------------------------
- *                          | Minimum number of mean crossing per second in accel
- *  mcr_min                 | magnitude. Default value = 17, Range = 0 to 63.
- *--------------------------|---------------------------------------------------
- *                          | Maximum value of the peak to peak acceleration
- *  peak_2_peak_max         | magnitude. Default value 0x253 = 1162.035mg, Range = 0 to 1023,
- *                          | Unit = 1.953mg
- *--------------------------|---------------------------------------------------
- *                          | Maximum number of mean crossing per second in accel
- *  mcr_max                 | magnitude. Default value = 17, Range = 0 to 63.
- *--------------------------|---------------------------------------------------
+ * @param[in,out] sens_cfg    : Structure instance of bmi3_sens_config.
+ * @param[in,out] dev         : Structure instance of bmi3_dev.
  *
  * @return Result of API execution status
  *
  * @return 0 -> Success
  * @return < 0 -> Fail
- *
  */
-static int8_t set_sig_motion_config(const struct bmi3_sig_motion_config *config, struct bmi3_dev *dev);
+static int8_t get_feature_config(struct bmi3_sens_config *sens_cfg, struct bmi3_dev *dev);
 
 /*!
  * @brief This internal API gets the latch mode from register address
@@ -766,460 +749,245 @@ static int8_t get_latch_mode(struct bmi3_int_pin_config *int_cfg, struct bmi3_de
 static int8_t set_latch_mode(const struct bmi3_int_pin_config *int_cfg, struct bmi3_dev *dev);
 
 /*!
- * @brief This internal API gets tilt configurations like segment size, minimum tilt angle
- * and beta accel mean.
- *
- * @param[out]      config        : Structure instance of bmi3_tilt_config.
- * @param[in, out] dev            : Structure instance of bmi3_dev.
- *
- * @verbatim
- *----------------------------------------------------------------------------
- *  bmi3_tilt_config        |
- *  Structure parameters    |                   Description
- *------------------------- |--------------------------------------------------
- *                          | Duration for which the acceleration vector is
- *                          | averaged to be reference vector. Default value = 100, Range = 0
- *   segment size           | to 255, Unit = 20ms.
- * ------------------------ |---------------------------------------------------
- *                          | Minimum angle by which the device shall be
- *                          | tilted for event detection.
- *  minimum tilt angle      | Angle is computed as 256 * cos(angle).
- *                          | Default value = 210, Range = 0 to 255.
- * ------------------------ |---------------------------------------------------
- *                          | Exponential smoothing coefficient for
- *  beta accel mean         | computing low-pass mean of acceleration vector.
- *                          | Coefficient is computed as beta * 65536.
- *                          | Default value = 61545, Range = 0 to 65535.
- * ------------------------ |---------------------------------------------------
- * @endverbatim
- *
- * @return Result of API execution status
- *
- * @return 0 -> Success
- * @return < 0 -> Fail
+ * @brief This internal API gets the layout of a headerless FIFO frame for the
+ * sensors enabled in FIFO.
  *
- */
-static int8_t get_tilt_config(struct bmi3_tilt_config *config, struct bmi3_dev *dev);
-
-/*!
- * @brief This internal API sets tilt configurations like segment size, minimum tilt angle
- * and beta accel mean.
- *
- * @param[in]      config         : Structure instance of bmi3_tilt_config.
- * @param[in, out] dev            : Structure instance of bmi3_dev.
- *
- * @verbatim
- *----------------------------------------------------------------------------
- *  bmi3_tilt_config        |
- *  Structure parameters    |                   Description
- *------------------------- |--------------------------------------------------
- *                          | Duration for which the acceleration vector is
- *                          | averaged to be reference vector. Default value = 100, Range = 0
- *   segment size           | to 255, Unit = 20ms.
- * ------------------------ |---------------------------------------------------
- *                          | Minimum angle by which the device shall be
- *                          | tilted for event detection.
- *  minimum tilt angle      | Angle is computed as 256 * cos(angle).
- *                          | Default value = 210, Range = 0 to 255.
- * ------------------------ |---------------------------------------------------
- *                          | Exponential smoothing coefficient for
- *  beta accel mean         | computing low-pass mean of acceleration vector.
- *                          | Coefficient is computed as beta * 65536.
- *                          | Default value = 61545, Range = 0 to 65535.
- * ------------------------ |---------------------------------------------------
- * @endverbatim
- *
- * @return Result of API execution status
- *
- * @return 0 -> Success
- * @return < 0 -> Fail
+ * @param[in] available_fifo_sens : Sensor enable status of FIFO.
  *
+ * @return Pointer to the frame layout
  */
-static int8_t set_tilt_config(const struct bmi3_tilt_config *config, struct bmi3_dev *dev);
-
-/*!
- * @brief This internal API gets orientation configurations like upside/down
- * enable, symmetrical modes, blocking mode, theta, hysteresis, slope threshold and
- * hold time configuration.
- *
- * @param[out]      config        : Structure instance of bmi3_orientation_config.
- * @param[in, out] dev            : Structure instance of bmi3_dev.
- *
- * @verbatim
- *-----------------------------------------------------------------------------
- *   bmi3_orientation_config|
- *   Structure parameters   |               Description
- *--------------------------|--------------------------------------------------
- *  upside/down             |  Enables upside/down detection, if set to 1.
- *  detection               |
- * -------------------------|---------------------------------------------------
- *                          | Sets the mode:
- *  mode                    | Values 0 or 3 - symmetrical.
- *                          | Value 1       - high asymmetrical
- *                          | Value 2       - low asymmetrical
- * -------------------------|---------------------------------------------------
- *                          | Enable - no orientation interrupt will be set.
- *  blocking                | Default value: 3, the most restrictive blocking.
- * -------------------------|---------------------------------------------------
- *                          | Threshold angle used in blocking mode.
- *  theta                   | Theta = 64 * (tan(angle)^2)
- *                          | Default value: 39, range 0 to 63.
- * -------------------------|---------------------------------------------------
- *                          | Hysteresis of acceleration in orientation change
- *  hysteresis              | change detection.
- *                          | Default value = 32, range 0 to 255, unit = 1.93mg.
- * -------------------------|---------------------------------------------------
- *                          | Minimum duration the device shall be in new orientation
- *  hold_time               | for change detection. default value = 5, range 0 to 255,
- *                          | unit = 20ms.
- * -------------------------|---------------------------------------------------
- *                          | Minimum slope between consecutive acceleration samples to
- *  slope_thres             | prevent the change of orientation during large movement.
- *                          | Default value = 205, range = 0 t0 255, uint = 1.953mg.
- * -------------------------|---------------------------------------------------
- *
- * @endverbatim
- *
- * @return Result of API execution status
+static const struct bmi3_fifo_frame_layout *get_fifo_frame_layout(uint16_t available_fifo_sens);
+
+/*!
+ * @brief This internal API selects the frame layout to parse the FIFO data. The layout
+ * selected by "bmi3_read_fifo_data" is used unless the FIFO configuration was changed.
  *
- * @return 0 -> Success
- * @return < 0 -> Fail
+ * @param[in] fifo : Structure instance of bmi3_fifo_frame.
  *
+ * @return Pointer to the frame layout
  */
-static int8_t get_orientation_config(struct bmi3_orientation_config *config, struct bmi3_dev *dev);
-
-/*!
- * @brief This internal API sets orientation configurations like upside/down
- * enable, symmetrical modes, blocking mode, theta, hysteresis, slope threshold and
- * hold time configuration.
- *
- * @param[in]      config         : Structure instance of bmi3_orientation_config.
- * @param[in, out] dev            : Structure instance of bmi3_dev.
- *
- * @verbatim
- *-----------------------------------------------------------------------------
- *   bmi3_orientation_config|
- *   Structure parameters   |               Description
- *--------------------------|--------------------------------------------------
- *  upside/down             |  Enables upside/down detection, if set to 1.
- *  detection               |
- * -------------------------|---------------------------------------------------
- *                          | Sets the mode:
- *  mode                    | Values 0 or 3 - symmetrical.
- *                          | Value 1       - high asymmetrical
- *                          | Value 2       - low asymmetrical
- * -------------------------|---------------------------------------------------
- *                          | Enable - no orientation interrupt will be set.
- *  blocking                | Default value: 3, the most restrictive blocking.
- * -------------------------|---------------------------------------------------
- *                          | Threshold angle used in blocking mode.
- *  theta                   | Theta = 64 * (tan(angle)^2)
- *                          | Default value: 39, range 0 to 63.
- * -------------------------|---------------------------------------------------
- *                          | Hysteresis of acceleration in orientation change
- *  hysteresis              | change detection.
- *                          | Default value = 32, range 0 to 255, unit = 1.93mg.
- * -------------------------|---------------------------------------------------
- *                          | Minimum duration the device shall be in new orientation
- *  hold_time               | for change detection. default value = 5, range 0 to 255,
- *                          | unit = 20ms.
- * -------------------------|---------------------------------------------------
- *                          | Minimum slope between consecutive acceleration samples to
- *  slope_thres             | prevent the change of orientation during large movement.
- *                          | Default value = 205, range = 0 t0 255, uint = 1.953mg.
- * -------------------------|---------------------------------------------------
- *
- * @endverbatim
- *
- * @return Result of API execution status
+static const struct bmi3_fifo_frame_layout *select_fifo_frame_layout(const struct bmi3_fifo_frame *fifo);
+
+/*!
+ * @brief This internal API gets the index of the end of valid FIFO data, which
+ * is the dummy bytes plus available FIFO length limited by the bytes read.
  *
- * @return 0 -> Success
- * @return < 0 -> Fail
+ * @param[in] fifo : Structure instance of bmi3_fifo_frame.
+ * @param[in] dev  : Structure instance of bmi3_dev.
  *
+ * @return Index of the end of valid FIFO data
  */
-static int8_t set_orientation_config(const struct bmi3_orientation_config *config, struct bmi3_dev *dev);
+static uint16_t get_fifo_data_end(const struct bmi3_fifo_frame *fifo, const struct bmi3_dev *dev);
 
 /*!
- * @brief This internal API gets step counter/detector/activity configurations.
- *
- * @param[out] config     : Structure instance of bmi3_step_counter_config.
- * @param[in] dev         : Structure instance of bmi3_dev.
+ * @brief This internal API parses the accelerometer or gyro frames from the FIFO
+ * data into separate x, y, z and sensor time arrays.
  *
- *---------------------------------------------------------------------------
- *  bmi3_step_counter_config|
- *  Structure parameters    |                 Description
- *--------------------------|--------------------------------------------------
- *                          | The Step-counter will trigger output every time
- *                          | the number of steps are counted. Holds implicitly
- *  water-mark level        | a 20x factor, so the range is 0 to 20460,
- *                          | with resolution of 20 steps. If 0 output disabled.
- * -------------------------|---------------------------------------------------
- *  reset counter           | Flag to reset the counted steps.
- * -------------------------|---------------------------------------------------
- *  step_counter_params     | 1 - 19 step_counter parameters for different settings.
- * -------------------------|---------------------------------------------------
- * @endverbatim
+ * @param[out] planes      : Structure instance of bmi3_fifo_sens_axes_planes
+ *                           where the parsed data is stored.
+ * @param[in]  sens_sel    : Sensor to be parsed, BMI3_FIFO_HEAD_LESS_ACC_FRM or
+ *                           BMI3_FIFO_HEAD_LESS_GYR_FRM.
+ * @param[out] frame_count : Number of frames parsed.
+ * @param[in]  fifo        : Structure instance of bmi3_fifo_frame.
+ * @param[in]  dev         : Structure instance of bmi3_dev.
  *
  * @return Result of API execution status
  *
  * @return 0 -> Success
  * @return < 0 -> Fail
- *
  */
-static int8_t get_step_config(struct bmi3_step_counter_config *config, struct bmi3_dev *dev);
+static int8_t parse_fifo_axes_planes(const struct bmi3_fifo_sens_axes_planes *planes,
+                                     uint16_t sens_sel,
+                                     uint16_t *frame_count,
+                                     const struct bmi3_fifo_frame *fifo,
+                                     const struct bmi3_dev *dev);
 
 /*!
- * @brief This internal API sets step counter/detector/activity configurations.
- *
- * @param[in] config      : Structure instance of bmi3_step_counter_config.
- * @param[in] dev         : Structure instance of bmi3_dev.
- *
- *---------------------------------------------------------------------------
- *  bmi3_step_counter_config|
- *  Structure parameters    |                 Description
- *--------------------------|--------------------------------------------------
- *                          | The Step-counter will trigger output every time
- *                          | the number of steps are counted. Holds implicitly
- *  water-mark level        | a 20x factor, so the range is 0 to 20460,
- *                          | with resolution of 20 steps. If 0 output disabled.
- * -------------------------|---------------------------------------------------
- *  reset counter           | Flag to reset the counted steps.
- * -------------------------|---------------------------------------------------
- *  step_counter_params     | 1 - 19 step_counter parameters for different settings.
- * -------------------------|---------------------------------------------------
- * @endverbatim
- *
- * @return Result of API execution status
- *
- * @return 0 -> Success
- * @return < 0 -> Fail
- *
+ * @brief This internal API is the portable implementation to unpack accelerometer or
+ * gyro data of complete FIFO frames into separate arrays. It is used when no platform
+ * specific function is set in "fifo_unpack_axes" of bmi3_dev.
+ *
+ * @param[in]  frames           : Pointer to the first byte of the first frame.
+ * @param[in]  frame_count      : Number of complete frames.
+ * @param[in]  frame_len        : Length of a frame in bytes.
+ * @param[in]  axes_offset      : Byte offset of the sensor data in the frame.
+ * @param[in]  sens_time_offset : Byte offset of the sensor time in the frame,
+ *                                BMI3_FIFO_NO_DATA if not available.
+ * @param[in]  dummy_frame      : Value of x-axis which denotes a dummy frame.
+ * @param[out] planes           : Structure instance of bmi3_fifo_sens_axes_planes.
+ *
+ * @return Number of frames stored in the arrays
  */
-static int8_t set_step_config(const struct bmi3_step_counter_config *config, struct bmi3_dev *dev);
+static uint16_t unpack_axes_planes(const uint8_t *frames,
+                                   uint16_t frame_count,
+                                   uint8_t frame_len,
+                                   uint8_t axes_offset,
+                                   uint8_t sens_time_offset,
+                                   uint16_t dummy_frame,
+                                   const struct bmi3_fifo_sens_axes_planes *planes);
 
 /*!
- * @brief This internal API gets wake-up configurations like axis sel, wait for time out,
- * max peaks for tap, mode, tap peaks threshold, max gesture duration, max dur between peaks,
- * tap_shock_settling_dur, min_quite_dur_between_taps, quite_time_after_gesture.
- *
- * @param[out]      config    : Structure instance of bmi3_tap_detector_config.
- * @param[in, out]  dev       : Structure instance of bmi3_dev.
- *
- * @verbatim
- *-----------------------------|------------------------------------------------
- *  bmi3_tap_detector_config   |
- *  Structure parameters       |               Description
- *-----------------------------|--------------------------------------------------
- *                             | Accelerometer sensing axis selection for tap
- *                             | detection. Default value = 2 (z-axis)
- *  axis_sel                   | Value  Name    Description
- *                             | 00    axis_x   Use x-axis for tap detection
- *                             | 01    axis_y   Use y-axis for tap detection
- *                             | 10    axis_z   Use z-axis for tap detection
- * ----------------------------|---------------------------------------------------
- *                             | Perform gesture confirmation with wait time
- *  wait_for_time_out          | set by max_gesture_dur. Default value = 1 (Enabled)
- * ----------------------------|---------------------------------------------------
- *                             | Maximum number of zero crossing expected
- *  max_peaks_for_tap          | around a tap. Default value = 6, Range = 0 to 7
- *                             |
- * ----------------------------|---------------------------------------------------
- *                             | Mode for detection of tap gesture. Default value = Normal.
- *  mode                       | In stable position of device, to improve detection accuracy,
- *                             | sensitive mode can be used.
- *                             | Under noisy scenarios, the false detection can be suppressed with Robust mode.
- *                             | Value    Name        Description
- *                             |  00     sensitive  Sensitive detection mode
- *                             |  01     normal     Normal detection mode
- *                             |  10     robust     Robust detection mode
- * ----------------------------|---------------------------------------------------
- *                             | Minimum threshold for peak resulting from the tap.
- *  tap_peak_threshold         | Default value 2d = 87.885mg, Range = 1997.919mg, Resolution = 1.953mg
- * ----------------------------|---------------------------------------------------
- *                             | Maximum duration from first tap within the
- *  max_gest_duration          | second and/or third tap is expected to happen.
- *                             | Default value = 16(640ms), Range = 2.520s Resolution = 40ms
- * ----------------------------|---------------------------------------------------
- *                             | Maximum duration between positive and negative peaks to tap.
- *  max_dur_between_peaks      |  Default value = 4(20ms), Range = 75ms, Resolution = 5ms
- * ----------------------------|---------------------------------------------------
- *                             | Maximum duration for which tap impact is observed.
- *  tap_shock_settling_dur     | Default value = 6(30ms), Range = 75ms, Resolution = 5ms
- * ----------------------------|---------------------------------------------------
- *                             | Minimum duration between two tap impact.
- *  min_quite_dur_between_taps | Default value = 8(40ms), Range = 1.2s, Resolution = 5ms.
- * ----------------------------|---------------------------------------------------
- *                             | Minimum quite duration between two gestures.
- *  quite_time_after_gesture   | Default value = 6(240ms), Range = 600ms , Resolution = 40ms.
- * ----------------------------|---------------------------------------------------
- *
- * @endverbatim
+ * @brief This internal API unpacks accelerometer or gyro data of complete FIFO
+ * frames into the structure array with the platform specific function set in
+ * "fifo_unpack_frames" of bmi3_dev and applies the axes correction.
+ *
+ * @param[out] data        : Structure instance of bmi3_fifo_sens_axes_data
+ *                           where the unpacked frames are stored.
+ * @param[in]  data_index  : Index value of the first byte of the first frame.
+ * @param[in]  frame_count : Number of complete frames.
+ * @param[in]  sens_sel    : BMI3_FIFO_HEAD_LESS_ACC_FRM or BMI3_FIFO_HEAD_LESS_GYR_FRM.
+ * @param[in]  layout      : Structure instance of bmi3_fifo_frame_layout.
+ * @param[in]  fifo        : Structure instance of bmi3_fifo_frame.
+ * @param[in]  dev         : Structure instance of bmi3_dev.
+ *
+ * @return Number of frames stored in the array
+ */
+static uint16_t unpack_axes_frames(struct bmi3_fifo_sens_axes_data *data,
+                                   uint16_t data_index,
+                                   uint16_t frame_count,
+                                   uint16_t sens_sel,
+                                   const struct bmi3_fifo_frame_layout *layout,
+                                   const struct bmi3_fifo_frame *fifo,
+                                   const struct bmi3_dev *dev);
+
+/*!
+ * @brief This internal API parses the accelerometer, gyro and temperature frames
+ * from the FIFO data in a single pass, using the fixed frame layout selected for
+ * the FIFO configuration. Sensors whose output structure is NULL are skipped.
+ *
+ * @param[out]    accel_data : Structure instance of bmi3_fifo_sens_axes_data
+ *                             where the parsed accelerometer frames are stored.
+ * @param[out]    gyro_data  : Structure instance of bmi3_fifo_sens_axes_data
+ *                             where the parsed gyro frames are stored.
+ * @param[out]    temp_data  : Structure instance of bmi3_fifo_temperature_data
+ *                             where the parsed temperature frames are stored.
+ * @param[in,out] fifo       : Structure instance of bmi3_fifo_frame.
+ * @param[in]     dev        : Structure instance of bmi3_dev.
  *
  * @return Result of API execution status
  *
  * @return 0 -> Success
  * @return < 0 -> Fail
- *
  */
-static int8_t get_tap_config(struct bmi3_tap_detector_config *config, struct bmi3_dev *dev);
-
-/*!
- * @brief This internal API sets wake-up configurations like axis sel, wait for time out,
- * max peaks for tap, mode, tap peaks threshold, max gesture duration, max dur between peaks,
- * tap_shock_settling_dur, min_quite_dur_between_taps, quite_time_after_gesture.
- *
- * @param[in]      config    : Structure instance of bmi3_tap_detector_config.
- * @param[in, out]  dev      : Structure instance of bmi3_dev.
- *
- * @verbatim
- *-----------------------------|------------------------------------------------
- *  bmi3_tap_detector_config   |
- *  Structure parameters       |               Description
- *-----------------------------|--------------------------------------------------
- *                             | Accelerometer sensing axis selection for tap
- *                             | detection. Default value = 2 (z-axis)
- *  axis_sel                   | Value  Name    Description
- *                             | 00    axis_x   Use x-axis for tap detection
- *                             | 01    axis_y   Use y-axis for tap detection
- *                             | 10    axis_z   Use z-axis for tap detection
- * ----------------------------|---------------------------------------------------
- *                             | Perform gesture confirmation with wait time
- *  wait_for_time_out          | set by max_gesture_dur. Default value = 1 (Enabled)
- * ----------------------------|---------------------------------------------------
- *                             | Maximum number of zero crossing expected
- *  max_peaks_for_tap          | around a tap. Default value = 6, Range = 0 to 7
- *                             |
- * ----------------------------|---------------------------------------------------
- *                             | Mode for detection of tap gesture. Default value = Normal.
- *  mode                       | In stable position of device, to improve detection accuracy,
- *                             | sensitive mode can be used.
- *                             | Under noisy scenarios, the false detection can be suppressed with Robust mode.
- *                             | Value    Name        Description
- *                             |  00     sensitive  Sensitive detection mode
- *                             |  01     normal     Normal detection mode
- *                             |  10     robust     Robust detection mode
- * ----------------------------|---------------------------------------------------
- *                             | Minimum threshold for peak resulting from the tap.
- *  tap_peak_threshold         | Default value 2d = 87.885mg, Range = 1997.919mg, Resolution = 1.953mg
- * ----------------------------|---------------------------------------------------
- *                             | Maximum duration from first tap within the
- *  max_gest_duration          | second and/or third tap is expected to happen.
- *                             | Default value = 16(640ms), Range = 2.520s Resolution = 40ms
- * ----------------------------|---------------------------------------------------
- *                             | Maximum duration between positive and negative peaks to tap.
- *  max_dur_between_peaks      |  Default value = 4(20ms), Range = 75ms, Resolution = 5ms
- * ----------------------------|---------------------------------------------------
- *                             | Maximum duration for which tap impact is observed.
- *  tap_shock_settling_dur     | Default value = 6(30ms), Range = 75ms, Resolution = 5ms
- * ----------------------------|---------------------------------------------------
- *                             | Minimum duration between two tap impact.
- *  min_quite_dur_between_taps | Default value = 8(40ms), Range = 1.2s, Resolution = 5ms.
- * ----------------------------|---------------------------------------------------
- *                             | Minimum quite duration between two gestures.
- *  quite_time_after_gesture   | Default value = 6(240ms), Range = 600ms , Resolution = 40ms.
- * ----------------------------|---------------------------------------------------
- *
- * @endverbatim
+static int8_t parse_fifo_frames(struct bmi3_fifo_sens_axes_data *accel_data,
+                                struct bmi3_fifo_sens_axes_data *gyro_data,
+                                struct bmi3_fifo_temperature_data *temp_data,
+                                struct bmi3_fifo_frame *fifo,
+                                const struct bmi3_dev *dev);
+
+/*!
+ * @brief This internal API parses the accelerometer, gyro and temperature frames
+ * of a range of the FIFO data. It does not modify the FIFO frame, so it can run
+ * on several ranges of the same FIFO data at once.
+ *
+ * @param[out] accel_data : Structure instance of bmi3_fifo_sens_axes_data
+ *                          where the parsed accelerometer frames are stored.
+ * @param[out] gyro_data  : Structure instance of bmi3_fifo_sens_axes_data
+ *                          where the parsed gyro frames are stored.
+ * @param[out] temp_data  : Structure instance of bmi3_fifo_temperature_data
+ *                          where the parsed temperature frames are stored.
+ * @param[in]  data_index : Index value of the first byte of the range.
+ * @param[in]  data_end   : Index value of the end of the range.
+ * @param[out] count      : Number of accelerometer, gyro and temperature frames parsed.
+ * @param[in]  fifo       : Structure instance of bmi3_fifo_frame.
+ * @param[in]  dev        : Structure instance of bmi3_dev.
  *
  * @return Result of API execution status
  *
  * @return 0 -> Success
  * @return < 0 -> Fail
- *
  */
-static int8_t set_tap_config(const struct bmi3_tap_detector_config *config, struct bmi3_dev *dev);
+static int8_t parse_fifo_frame_range(struct bmi3_fifo_sens_axes_data *accel_data,
+                                     struct bmi3_fifo_sens_axes_data *gyro_data,
+                                     struct bmi3_fifo_temperature_data *temp_data,
+                                     uint16_t data_index,
+                                     uint16_t data_end,
+                                     struct bmi3_fifo_census *count,
+                                     const struct bmi3_fifo_frame *fifo,
+                                     const struct bmi3_dev *dev);
 
 /*!
  * @brief This internal API is used to parse accelerometer data from the FIFO
  * data.
  *
- * @param[out] acc              : Structure instance of bmi3_fifo_sens_axes_data
- *                                where the parsed data bytes are stored.
- * @param[in]  data_start_index : Index value of the accelerometer data bytes
- *                                which is to be parsed from the FIFO data.
- * @param[in]  fifo             : Structure instance of bmi3_fifo_frame.
+ * @param[out] acc         : Structure instance of bmi3_fifo_sens_axes_data
+ *                           where the parsed data bytes are stored.
+ * @param[in]  frame_index : Index value of the first byte of the frame
+ *                           which is to be parsed from the FIFO data.
+ * @param[in]  data_end    : Index value of the end of valid FIFO data.
+ * @param[in]  layout      : Structure instance of bmi3_fifo_frame_layout.
+ * @param[in]  fifo        : Structure instance of bmi3_fifo_frame.
  *
  * @return 0 -> Success
  * @return < 0 -> Fail
  */
 static int8_t unpack_accel_data(struct bmi3_fifo_sens_axes_data *acc,
-                                uint16_t data_start_index,
+                                uint16_t frame_index,
+                                uint16_t data_end,
+                                const struct bmi3_fifo_frame_layout *layout,
                                 const struct bmi3_fifo_frame *fifo);
 
 /*!
  * @brief This internal API is used to parse temperature data from the FIFO
  * data.
  *
- * @param[out] temp              : Structure instance of bmi3_fifo_temperature_data
- *                                 where the parsed data bytes are stored.
- * @param[in]  data_start_index  : Index value of the temperature data bytes
- *                                 which is to be parsed from the FIFO data.
- * @param[in]  fifo              : Structure instance of bmi3_fifo_frame.
+ * @param[out] temp        : Structure instance of bmi3_fifo_temperature_data
+ *                           where the parsed data bytes are stored.
+ * @param[in]  frame_index : Index value of the first byte of the frame
+ *                           which is to be parsed from the FIFO data.
+ * @param[in]  data_end    : Index value of the end of valid FIFO data.
+ * @param[in]  layout      : Structure instance of bmi3_fifo_frame_layout.
+ * @param[in]  fifo        : Structure instance of bmi3_fifo_frame.
  *
  * @return 0 -> Success
  * @return < 0 -> Fail
  */
 static int8_t unpack_temperature_data(struct bmi3_fifo_temperature_data *temp,
-                                      uint16_t data_start_index,
+                                      uint16_t frame_index,
+                                      uint16_t data_end,
+                                      const struct bmi3_fifo_frame_layout *layout,
                                       const struct bmi3_fifo_frame *fifo);
 
 /*!
  * @brief This internal API is used to parse gyroscope data from the FIFO
  * data.
  *
- * @param[out] gyro              : Structure instance of bmi3_fifo_sens_axes_data
- *                                 where the parsed data bytes are stored.
- * @param[in]  data_start_index  : Index value of the gyro data bytes
- *                                 which is to be parsed from the FIFO data.
- * @param[in]  fifo              : Structure instance of bmi3_fifo_frame.
+ * @param[out] gyro        : Structure instance of bmi3_fifo_sens_axes_data
+ *                           where the parsed data bytes are stored.
+ * @param[in]  frame_index : Index value of the first byte of the frame
+ *                           which is to be parsed from the FIFO data.
+ * @param[in]  data_end    : Index value of the end of valid FIFO data.
+ * @param[in]  layout      : Structure instance of bmi3_fifo_frame_layout.
+ * @param[in]  fifo        : Structure instance of bmi3_fifo_frame.
  *
  * @return 0 -> Success
  * @return < 0 -> Fail
  */
 static int8_t unpack_gyro_data(struct bmi3_fifo_sens_axes_data *gyro,
-                               uint16_t data_start_index,
+                               uint16_t frame_index,
+                               uint16_t data_end,
+                               const struct bmi3_fifo_frame_layout *layout,
                                const struct bmi3_fifo_frame *fifo);
 
 /*!
- * @brief This internal API is used to parse the accel, gyro, temperature and sensortime data from the
- * FIFO data in header-less mode. It updates the current data byte to be parsed.
- *
- * @param[in,out] fifo_data       : Void pointer where accel, gyro and temperature parsed data
- *                                  data bytes are stored.
- * @param[in,out] idx             : Index value of number of bytes parsed.
- * @param[in,out] updated_frm_idx : Index value of accel, gyro, temperature data (x,y,z axes)
- *                                  frame to be parsed.
- * @param[in]     frame           : Data is enabled by user.
- *
- * @param[in]     fifo            : Structure instance of bmi3_fifo_frame.
+ * @brief This internal API is used to parse the sensor time of a frame from the
+ * FIFO data.
  *
- * @return Result of API execution status
+ * @param[out] sensor_time : Variable to store the sensor time.
+ * @param[in]  frame_index : Index value of the first byte of the frame
+ *                           which is to be parsed from the FIFO data.
+ * @param[in]  data_end    : Index value of the end of valid FIFO data.
+ * @param[in]  layout      : Structure instance of bmi3_fifo_frame_layout.
+ * @param[in]  fifo        : Structure instance of bmi3_fifo_frame.
  *
  * @return 0 -> Success
- * @return < 0 -> Fail
- *
- */
-static int8_t unpack_fifo_data_frame(void *fifo_data,
-                                     uint16_t *idx,
-                                     uint16_t *updated_frm_idx,
-                                     uint16_t frame,
-                                     const struct bmi3_fifo_frame *fifo);
-
-/*!
- * @brief This internal API is used to update data index based on the frame length
- *
- * @param[in,out] idx             : Index value of number of bytes parsed.
- * @param[in,out] updated_frm_idx : Index value of accel, gyro, temperature data (x,y,z axes)
- *                                  frame to be parsed.
- * @param[in]     len             : Length of the frame
- *
- * @param[in]     rslt            : Result value after unpacking frames
- *
- * @return Result of API execution status
- *
- * @return  None
+ * @return > 0 -> Warning
  */
-static void update_data_index(uint16_t *idx, uint16_t *updated_frm_idx, uint8_t len, int8_t rslt);
+static int8_t unpack_sensor_time(uint16_t *sensor_time,
+                                 uint16_t frame_index,
+                                 uint16_t data_end,
+                                 const struct bmi3_fifo_frame_layout *layout,
+                                 const struct bmi3_fifo_frame *fifo);
 
 /*!
  * @brief This internal API sets the precondition settings such as alternate accelerometer and
@@ -1281,12 +1049,12 @@ static int8_t self_test_conditions(uint8_t st_selection, struct bmi3_dev *dev);
 static int8_t disable_alt_conf_acc_gyr_mode(struct bmi3_dev *dev);
 
 /*!
- * @brief This internal API gets status of self-test and the result of self-test along with
+ * @brief This internal API gets the result of a completed self-test along with
  * the feature engine error status.
  *
- * @param[in] st_selection     : Variable denoting the self-test mode.
- * @param[in] st_result_status : Structure instance of bmi3_st_result.
- * @param[out] dev             : Structure instance of bmi3_dev.
+ * @param[in] st_ctx            : Structure instance of bmi3_st_ctx.
+ * @param[out] st_result_status : Structure instance of bmi3_st_result.
+ * @param[in] dev               : Structure instance of bmi3_dev.
  *
  * @return Result of API execution status
  *
@@ -1294,14 +1062,16 @@ static int8_t disable_alt_conf_acc_gyr_mode(struct bmi3_dev *dev);
  * @return < 0 -> Fail
  *
  */
-static int8_t get_st_status_rslt(uint8_t st_selection, struct bmi3_st_result *st_result_status, struct bmi3_dev *dev);
+static int8_t get_st_result(const struct bmi3_st_ctx *st_ctx, struct bmi3_st_result *st_result_status,
+                            struct bmi3_dev *dev);
 
 /*!
- * @brief This internal API gets status of self-calibration and the result of self-calibration along with the feature
- * engine error status.
+ * @brief This internal API gets the result of self-calibration, or the feature engine
+ * error status if the self-calibration did not complete.
  *
- * @param[in] sc_rslt : Structure instance of bmi3_self_calib_rslt.
- * @param[out] dev    : Structure instance of bmi3_dev.
+ * @param[in] sc_ctx   : Structure instance of bmi3_sc_ctx.
+ * @param[out] sc_rslt : Structure instance of bmi3_self_calib_rslt.
+ * @param[in] dev      : Structure instance of bmi3_dev.
  *
  * @return Result of API execution status
  *
@@ -1309,7 +1079,9 @@ static int8_t get_st_status_rslt(uint8_t st_selection, struct bmi3_st_result *st
  * @return < 0 -> Fail
  *
  */
-static int8_t get_sc_gyro_rslt(struct bmi3_self_calib_rslt *sc_rslt, struct bmi3_dev *dev);
+static int8_t get_sc_gyro_rslt(const struct bmi3_sc_ctx *sc_ctx,
+                               struct bmi3_self_calib_rslt *sc_rslt,
+                               struct bmi3_dev *dev);
 
 /*!
  * @brief This internal API gets and sets the self-calibration mode given
@@ -1328,10 +1100,12 @@ static int8_t get_sc_gyro_rslt(struct bmi3_self_calib_rslt *sc_rslt, struct bmi3
 static int8_t get_set_sc_dma(uint8_t sc_selection, uint8_t apply_corr, struct bmi3_dev *dev);
 
 /*!
- * @brief This internal API gets the i3c sync accelerometer data from the register.
+ * @brief This internal API reads the i3c sync data from the given base address
+ * up to the i3c sync time in one burst.
  *
- * @param[out] data         : Structure instance of bmi3_i3c_sync_data.
- * @param[out]  dev         : Structure instance of bmi3_dev.
+ * @param[out] sync_data    : Array to store the i3c sync data.
+ * @param[in]  sync_base    : Feature engine base address from which the data is read.
+ * @param[in]  dev          : Structure instance of bmi3_dev.
  *
  * @return Result of API execution status
  *
@@ -1339,38 +1113,37 @@ static int8_t get_set_sc_dma(uint8_t sc_selection, uint8_t apply_corr, struct bm
  * @return < 0 -> Fail
  *
  */
-
-static int8_t get_i3c_sync_accel_sensor_data(struct bmi3_i3c_sync_data *data, struct bmi3_dev *dev);
+static int8_t get_i3c_sync_data(uint8_t *sync_data, uint8_t sync_base, struct bmi3_dev *dev);
 
 /*!
- * @brief This internal API gets the i3c sync gyroscope data from the register.
+ * @brief This internal API gets the i3c sync accelerometer or gyroscope data
+ * from the i3c sync data read.
  *
  * @param[out] data         : Structure instance of bmi3_i3c_sync_data.
- * @param[out]  dev         : Structure instance of bmi3_dev.
- *
- * @return Result of API execution status
+ * @param[in]  sync_data    : I3C sync data read by get_i3c_sync_data.
+ * @param[in]  base_addr    : Feature engine base address of the sensor data.
+ * @param[in]  sync_base    : Feature engine base address from which the data is read.
  *
- * @return 0 -> Success
- * @return < 0 -> Fail
+ * @return None
  *
  */
-
-static int8_t get_i3c_sync_gyro_sensor_data(struct bmi3_i3c_sync_data *data, struct bmi3_dev *dev);
+static void get_i3c_sync_sensor_data(struct bmi3_i3c_sync_data *data,
+                                     const uint8_t *sync_data,
+                                     uint8_t base_addr,
+                                     uint8_t sync_base);
 
 /*!
- * @brief This internal API gets the i3c sync temperature data from the register and can be
+ * @brief This internal API gets the i3c sync temperature data from the i3c sync data read and can be
  * converted into degree celsius using the below formula.
  * Formula: temperature_value = (float)(((float)((int16_t)temperature_data)) / 512.0) + 23.0
  * @param[out] data         : Structure instance of bmi3_i3c_sync_data.
- * @param[in]  dev          : Structure instance of bmi3_dev.
- *
- * @return Result of API execution status
+ * @param[in]  sync_data    : I3C sync data read by get_i3c_sync_data.
+ * @param[in]  sync_base    : Feature engine base address from which the data is read.
  *
- * @return 0 -> Success
- * @return < 0 -> Fail
+ * @return None
  *
  */
-static int8_t get_i3c_sync_temp_data(struct bmi3_i3c_sync_data *data, struct bmi3_dev *dev);
+static void get_i3c_sync_temp_data(struct bmi3_i3c_sync_data *data, const uint8_t *sync_data, uint8_t sync_base);
 
 /*!
  * @brief This internal API sets alternate accelerometer configurations like ODR,
@@ -1433,10 +1206,10 @@ static int8_t set_alternate_gyro_config(const struct bmi3_alt_gyro_config *confi
 static int8_t get_alternate_gyro_config(struct bmi3_alt_gyro_config *config, struct bmi3_dev *dev);
 
 /*!
- * @brief This internal API gets alternate auto configurations for feature interrupts
+ * @brief This internal API is used to monitor the accel power mode during the axis remap.
  *
- * @param[out] config    : Structure instance of bmi3_auto_config_change.
- * @param[out]  dev      : Structure instance of bmi3_dev.
+ * @param[in] config       : Structure instance of bmi3_sens_config.
+ * @param[in] dev          : Structure instance of bmi3_dev.
  *
  * @return Result of API execution status
  *
@@ -1444,41 +1217,47 @@ static int8_t get_alternate_gyro_config(struct bmi3_alt_gyro_config *config, str
  * @return < 0 -> Fail
  *
  */
-static int8_t get_alternate_auto_config(struct bmi3_auto_config_change *config, struct bmi3_dev *dev);
+static int8_t axes_remap_acc_power_mode_status(struct bmi3_sens_config config, struct bmi3_dev *dev);
 
 /*!
- * @brief This internal API sets alternate auto configurations for feature interrupts.
+ * @brief This internal API is used to verify the right position of the sensor before doing accel FOC
  *
- * @param[out] config    : Structure instance of bmi3_auto_config_change.
- * @param[in]  dev       : Structure instance of bmi3_dev.
+ * @param[in] sens_list     : Sensor type
+ * @param[in] accel_g_axis  : Accel Foc axis and sign input
+ * @param[in] dev           : Structure instance of bmi3_dev
  *
  * @return Result of API execution status
  *
  * @return 0 -> Success
  * @return < 0 -> Fail
- *
  */
-static int8_t set_alternate_auto_config(const struct bmi3_auto_config_change *config, struct bmi3_dev *dev);
+static int8_t verify_foc_position(uint8_t sens_list,
+                                  const struct bmi3_accel_foc_g_value *accel_g_axis,
+                                  struct bmi3_dev *dev);
 
 /*!
- * @brief This internal API is used to monitor the accel power mode during the axis remap.
+ * @brief This internal API reads and provides average for 128 samples of sensor data for accel FOC.
  *
- * @param[in] config       : Structure instance of bmi3_sens_config.
- * @param[in] dev          : Structure instance of bmi3_dev.
+ * @param[in] sens_list     : Sensor type.
+ * @param[in] temp_foc_data : To store data samples
+ * @param[in] dev           : Structure instance of bmi3_dev.
  *
  * @return Result of API execution status
  *
  * @return 0 -> Success
  * @return < 0 -> Fail
- *
  */
-static int8_t axes_remap_acc_power_mode_status(struct bmi3_sens_config config, struct bmi3_dev *dev);
+static int8_t get_average_of_sensor_data(uint8_t sens_list,
+                                         struct bmi3_foc_temp_value *temp_foc_data,
+                                         struct bmi3_dev *dev);
 
 /*!
- * @brief This internal API is used to verify the right position of the sensor before doing accel FOC
+ * @brief This internal API checks the position for FOC from the average of
+ * the sensor data.
  *
  * @param[in] sens_list     : Sensor type
  * @param[in] accel_g_axis  : Accel Foc axis and sign input
+ * @param[in] temp_foc_data : Average of the sensor data
  * @param[in] dev           : Structure instance of bmi3_dev
  *
  * @return Result of API execution status
@@ -1486,25 +1265,41 @@ static int8_t axes_remap_acc_power_mode_status(struct bmi3_sens_config config, s
  * @return 0 -> Success
  * @return < 0 -> Fail
  */
-static int8_t verify_foc_position(uint8_t sens_list,
-                                  const struct bmi3_accel_foc_g_value *accel_g_axis,
-                                  struct bmi3_dev *dev);
+static int8_t check_foc_position(uint8_t sens_list,
+                                 const struct bmi3_accel_foc_g_value *accel_g_axis,
+                                 struct bmi3_foc_temp_value temp_foc_data,
+                                 struct bmi3_dev *dev);
 
 /*!
- * @brief This internal API reads and provides average for 128 samples of sensor data for accel FOC.
+ * @brief This internal API waits until the FIFO holds the given number of
+ * accel-only frames, reads them in bursts and provides their average for accel FOC.
  *
- * @param[in] sens_list     : Sensor type.
- * @param[in] temp_foc_data : To store data samples
- * @param[in] dev           : Structure instance of bmi3_dev.
+ * @param[in] sample_count   : Number of samples to be averaged.
+ * @param[in] odr            : Accel output data rate.
+ * @param[out] temp_foc_data : Average of the samples.
+ * @param[in] dev            : Structure instance of bmi3_dev.
  *
  * @return Result of API execution status
  *
  * @return 0 -> Success
  * @return < 0 -> Fail
  */
-static int8_t get_average_of_sensor_data(uint8_t sens_list,
-                                         struct bmi3_foc_temp_value *temp_foc_data,
-                                         struct bmi3_dev *dev);
+static int8_t get_fifo_average_of_accel_data(uint16_t sample_count,
+                                             uint8_t odr,
+                                             struct bmi3_foc_temp_value *temp_foc_data,
+                                             struct bmi3_dev *dev);
+
+/*!
+ * @brief This internal API flushes the FIFO.
+ *
+ * @param[in] dev : Structure instance of bmi3_dev.
+ *
+ * @return Result of API execution status
+ *
+ * @return 0 -> Success
+ * @return < 0 -> Fail
+ */
+static int8_t flush_fifo(struct bmi3_dev *dev);
 
 /*!
  * @brief This internal API validates accel FOC position as per the range
@@ -1560,6 +1355,25 @@ static int8_t perform_accel_foc(const struct bmi3_accel_foc_g_value *accel_g_val
                                 struct bmi3_accel_config *acc_cfg,
                                 struct bmi3_dev *dev);
 
+/*!
+ * @brief This internal API computes the accelerometer offset from the average
+ * of the accelerometer data and writes it to the offset registers.
+ *
+ * @param[in] accel_g_value : Accel FOC axis and sign input.
+ * @param[in] accel_avg     : Average of the accelerometer data.
+ * @param[out] acc_cfg      : Accelerometer configuration value.
+ * @param[in] dev           : Structure instance of bmi3_dev.
+ *
+ * @return Result of API execution status
+ *
+ * @return 0 -> Success
+ * @return < 0 -> Fail
+ */
+static int8_t set_accel_foc_offset(const struct bmi3_accel_foc_g_value *accel_g_value,
+                                   struct bmi3_sens_axes_data *accel_avg,
+                                   struct bmi3_accel_config *acc_cfg,
+                                   struct bmi3_dev *dev);
+
 /*!
  * @brief This internal API converts the range value into accelerometer
  * corresponding integer value.
@@ -1646,22 +1460,18 @@ static int32_t power(int16_t base, uint8_t resolution);
  */
 static int8_t set_gyro_filter_coefficients(struct bmi3_dev *dev);
 
-#endif
-
 /*!
- * @brief This internal API check the data index for the fifo
- * data processing.
- *
- * @param[in] data_index   : Variable for data index
- * @param[in] fifo         : Structure instance of fifo frame
- *
- * @return Result of API execution status
+ * @brief This internal API checks whether the gyro self-calibration/self-test
+ * coefficients read back from the feature engine have to be rewritten, which
+ * is the case if word 3 and any other word differ from the expected set.
  *
- * @return 0 -> Success
- * @return < 0 -> Fail
+ * @param[in] data : Coefficients read back, BMI3_SC_ST_COEFF_LEN bytes.
  *
+ * @return BMI3_ENABLE if the coefficients have to be rewritten, else BMI3_DISABLE
  */
-static int8_t check_data_index(uint16_t data_index, const struct bmi3_fifo_frame *fifo);
+static uint8_t sc_st_coeff_differ(const uint8_t *data);
+
+#endif
 
 /*!
  * @brief This internal API is used to validate ODR and AVG combinations for accel
@@ -1677,20 +1487,6 @@ static int8_t check_data_index(uint16_t data_index, const struct bmi3_fifo_frame
  */
 static int8_t validate_acc_odr_avg(uint8_t acc_odr, uint8_t acc_avg);
 
-/*!
- * @brief This internal API is used to check skipped samples for accel
- *
- * @param[in] odr   : Variable to store accel ODR
- * @param[in] avg   : Variable to store accel AVG
- *
- * @return Result of API execution status
- *
- * @return 0 -> Success
- * @return < 0 -> Fail
- *
- */
-static int8_t accel_skipped_samples_check(float odr, float avg);
-
 /*!
  * @brief This internal API is used to validate ODR and AVG combinations for gyro
  *
@@ -1706,10 +1502,9 @@ static int8_t accel_skipped_samples_check(float odr, float avg);
 static int8_t validate_gyr_odr_avg(uint8_t gyr_odr, uint8_t gyr_avg);
 
 /*!
- * @brief This internal API is used to check skipped samples for gyro
+ * @brief This internal API writes the command register value to enable cfg res.
  *
- * @param[in] odr   : Variable to store gyro ODR
- * @param[in] avg   : Variable to store gyro AVG
+ * @param[in,out] dev       : Structure instance of bmi3_dev.
  *
  * @return Result of API execution status
  *
@@ -1717,10 +1512,10 @@ static int8_t validate_gyr_odr_avg(uint8_t gyr_odr, uint8_t gyr_avg);
  * @return < 0 -> Fail
  *
  */
-static int8_t gyro_skipped_samples_check(float odr, float avg);
+static int8_t config_array_set_command(struct bmi3_dev *dev);
 
 /*!
- * @brief This internal API writes the command register value to enable cfg res.
+ * @brief This internal API sets the value_one to feature engine in cfg res.
  *
  * @param[in,out] dev       : Structure instance of bmi3_dev.
  *
@@ -1730,10 +1525,10 @@ static int8_t gyro_skipped_samples_check(float odr, float avg);
  * @return < 0 -> Fail
  *
  */
-static int8_t config_array_set_command(struct bmi3_dev *dev);
+static int8_t config_array_set_value_one_page(struct bmi3_dev *dev);
 
 /*!
- * @brief This internal API sets the value_one to feature engine in cfg res.
+ * @brief This internal API writes the config array in cfg res.
  *
  * @param[in,out] dev       : Structure instance of bmi3_dev.
  *
@@ -1743,11 +1538,14 @@ static int8_t config_array_set_command(struct bmi3_dev *dev);
  * @return < 0 -> Fail
  *
  */
-static int8_t config_array_set_value_one_page(struct bmi3_dev *dev);
+static int8_t write_config_array(struct bmi3_dev *dev);
 
 /*!
- * @brief This internal API writes the config array in cfg res.
+ * @brief This internal API reads back an uploaded config array and compares
+ * it with the given array.
  *
+ * @param[in] config_array  : Pointer variable to store config array.
+ * @param[in] config_size   : Variable to store size of config array.
  * @param[in,out] dev       : Structure instance of bmi3_dev.
  *
  * @return Result of API execution status
@@ -1756,13 +1554,11 @@ static int8_t config_array_set_value_one_page(struct bmi3_dev *dev);
  * @return < 0 -> Fail
  *
  */
-static int8_t write_config_array(struct bmi3_dev *dev);
+static int8_t verify_config_array(const uint8_t *config_array, uint16_t config_size, struct bmi3_dev *dev);
 
 /*!
- * @brief This internal API writes config array.
+ * @brief This internal API writes config version array to feature engine register.
  *
- * @param[in] config_array  : Pointer variable to store config array.
- * @param[in] config_size   : Variable to store size of config array.
  * @param[in,out] dev       : Structure instance of bmi3_dev.
  *
  * @return Result of API execution status
@@ -1771,13 +1567,13 @@ static int8_t write_config_array(struct bmi3_dev *dev);
  * @return < 0 -> Fail
  *
  */
-static int8_t load_config_array(const uint8_t *config_array, uint16_t config_size, struct bmi3_dev *dev);
+static int8_t write_config_version(struct bmi3_dev *dev);
 
 /*!
- * @brief This internal API writes config array.
+ * @brief This internal API checks whether the sensor kept its state over a
+ * reset of the host, i.e. no power-on reset is detected and the feature
+ * engine is active. "warm_started" of bmi3_dev is updated accordingly.
  *
- * @param[in] config_array  : Pointer variable to store config array.
- * @param[in] config_size   : Variable to store size of config array.
  * @param[in,out] dev       : Structure instance of bmi3_dev.
  *
  * @return Result of API execution status
@@ -1786,307 +1582,12094 @@ static int8_t load_config_array(const uint8_t *config_array, uint16_t config_siz
  * @return < 0 -> Fail
  *
  */
-static int8_t upload_file(uint16_t config_base_addr, const uint8_t *config_array, uint16_t indx, struct bmi3_dev *dev);
+static int8_t check_warm_start(struct bmi3_dev *dev);
 
 /*!
- * @brief This internal API writes config version array to feature engine register.
+ * @brief This internal API submits an asynchronous read and moves the
+ * asynchronous transfer to the given state.
  *
- * @param[in,out] dev       : Structure instance of bmi3_dev.
+ * @param[in] reg_addr : Register address from which data is read.
+ * @param[out] data    : Pointer to data buffer with space for the dummy bytes.
+ * @param[in] len      : No. of bytes to be read along with the dummy bytes.
+ * @param[in] state    : State of the asynchronous transfer.
+ * @param[in] dev      : Structure instance of bmi3_dev.
  *
  * @return Result of API execution status
  *
  * @return 0 -> Success
  * @return < 0 -> Fail
- *
  */
-static int8_t write_config_version(struct bmi3_dev *dev);
-
-/******************************************************************************/
-/*!  @name      User Interface Definitions                            */
-/******************************************************************************/
+static int8_t async_submit(uint8_t reg_addr, uint8_t *data, uint32_t len, uint8_t state, struct bmi3_dev *dev);
 
 /*!
- * @brief This API is the entry point for bmi3 sensor. It reads and validates the
- * chip-id of the sensor.
+ * @brief This internal API checks whether an asynchronous request can be started.
+ *
+ * @param[in] dev : Structure instance of bmi3_dev.
+ *
+ * @return Result of API execution status
+ *
+ * @return 0 -> Success
+ * @return < 0 -> Fail
  */
-int8_t bmi3_init(struct bmi3_dev *dev)
-{
-    /* Variable to store result of API */
-    int8_t rslt;
-
-    /* Variable to assign chip id */
-    uint8_t chip_id[2] = { 0 };
+static int8_t async_check(const struct bmi3_dev *dev);
 
-    /* Null-pointer check */
-    rslt = null_ptr_check(dev);
+/*!
+ * @brief This internal API parses the data of a completed asynchronous transfer.
+ *
+ * @param[in] dev : Structure instance of bmi3_dev.
+ *
+ * @return Result of API execution status
+ *
+ * @return 0 -> Success
+ * @return < 0 -> Fail
+ */
+static int8_t async_parse(struct bmi3_dev *dev);
 
-    if (rslt == BMI3_OK)
-    {
-        dev->chip_id = 0;
+/*!
+ * @brief This internal API inserts the idle time required before an access,
+ * if the previous access was a write.
+ *
+ * @param[in,out] dev : Structure instance of bmi3_dev.
+ *
+ * @return None
+ */
+static void insert_idle_time(struct bmi3_dev *dev);
 
-        /* An extra dummy byte is read during SPI read */
-        if (dev->intf == BMI3_SPI_INTF)
-        {
-            dev->dummy_byte = 1;
-        }
-        else
-        {
-            dev->dummy_byte = 2;
-        }
-    }
+/*!
+ * @brief This internal API stages feature engine data to be written by
+ * "flush_feature_batch".
+ *
+ * @param[in] base_addr : Base address of the feature in words.
+ * @param[in] data      : Feature engine data.
+ * @param[in] len       : Length of the data in bytes.
+ * @param[in,out] batch : Structure instance of bmi3_feature_batch.
+ *
+ * @return Result of API execution status
+ *
+ * @return 0 -> Success
+ * @return < 0 -> Fail
+ */
+static int8_t stage_feature_data(uint8_t base_addr, const uint8_t *data, uint8_t len, struct bmi3_feature_batch *batch);
 
-    if (rslt == BMI3_OK)
-    {
-        /* Perform soft-reset to bring all register values to their default values */
-        rslt = bmi3_soft_reset(dev);
+/*!
+ * @brief This internal API writes the staged feature engine data, each run
+ * of consecutive words with a single base address and data transfer.
+ *
+ * @param[in,out] batch : Structure instance of bmi3_feature_batch.
+ * @param[in] dev       : Structure instance of bmi3_dev.
+ *
+ * @return Result of API execution status
+ *
+ * @return 0 -> Success
+ * @return < 0 -> Fail
+ */
+static int8_t flush_feature_batch(struct bmi3_feature_batch *batch, struct bmi3_dev *dev);
 
-        if (rslt == BMI3_OK)
-        {
-            /* Read chip-id of the BMI3 sensor */
-            rslt = bmi3_get_regs(BMI3_REG_CHIP_ID, chip_id, 2, dev);
+/*!
+ * @brief This internal API invalidates the shadow register cache.
+ *
+ * @param[in,out] dev : Structure instance of bmi3_dev.
+ *
+ * @return None
+ */
+static void invalidate_reg_cache(struct bmi3_dev *dev);
 
-            if (rslt == BMI3_OK)
-            {
-                dev->chip_id = chip_id[0];
-            }
-        }
-    }
+/*!
+ * @brief This internal API reads the data from the shadow register cache.
+ *
+ * @param[in] reg_addr : Register address from which data is read.
+ * @param[out] data    : Pointer to data buffer where read data is stored.
+ * @param[in] len      : No. of bytes of data to be read.
+ * @param[in,out] dev  : Structure instance of bmi3_dev.
+ *
+ * @return BMI3_ENABLE if the data is served from the cache, BMI3_DISABLE otherwise
+ */
+static uint8_t cache_read(uint8_t reg_addr, uint8_t *data, uint16_t len, struct bmi3_dev *dev);
 
-    if (rslt == BMI3_OK)
-    {
-        if (((chip_id[1] & BMI3_REV_ID_MASK) >> BMI3_REV_ID_POS) == BMI3_ENABLE)
-        {
-            dev->accel_bit_width = BMI3_ACC_DP_OFF_XYZ_14_BIT_MASK;
-        }
-        else
-        {
-            dev->accel_bit_width = BMI3_ACC_DP_OFF_XYZ_13_BIT_MASK;
-        }
-    }
+/*!
+ * @brief This internal API stores the data read from or written to the
+ * sensor in the shadow register cache.
+ *
+ * @param[in] reg_addr : Register address of the data.
+ * @param[in] data     : Pointer to data buffer.
+ * @param[in] len      : No. of bytes of data.
+ * @param[in,out] dev  : Structure instance of bmi3_dev.
+ *
+ * @return None
+ */
+static void cache_store(uint8_t reg_addr, const uint8_t *data, uint16_t len, struct bmi3_dev *dev);
 
-    return rslt;
-}
+/*!
+ * @brief This internal API updates the shadow register cache on a write to
+ * the sensor.
+ *
+ * @param[in] reg_addr : Register address to which the data is written.
+ * @param[in] data     : Pointer to data buffer.
+ * @param[in] len      : No. of bytes of data.
+ * @param[in,out] dev  : Structure instance of bmi3_dev.
+ *
+ * @return None
+ */
+static void cache_write(uint8_t reg_addr, const uint8_t *data, uint16_t len, struct bmi3_dev *dev);
 
 /*!
- * @brief This API reads the data from the given register address of bmi3
- * sensor.
+ * @brief This internal API writes the feature engine transmission address to
+ * the sensor before an access to the transmission data register, if the
+ * previous access to it was served from the cache.
  *
- * @note For most of the registers auto address increment applies, with the
- * exception of a few special registers, which trap the address. For e.g.,
- * Register address - 0x03.
+ * @param[in] reg_addr : Register address to be accessed.
+ * @param[in,out] dev  : Structure instance of bmi3_dev.
+ *
+ * @return Result of API execution status
+ *
+ * @return 0 -> Success
+ * @return < 0 -> Fail
  */
-int8_t bmi3_get_regs(uint8_t reg_addr, uint8_t *data, uint16_t len, struct bmi3_dev *dev)
-{
-    /* Variable to store result of API */
-    int8_t rslt;
+static int8_t cache_sync_feature_addr(uint8_t reg_addr, struct bmi3_dev *dev);
 
-    /* Variable to define temporary buffer */
-    uint8_t temp_buf[BMI3_MAX_LEN];
+/*!
+ * @brief This internal API tunes the FIFO water-mark level as per the host
+ * budget of bmi3_dev, if accel or gyro configuration is set.
+ *
+ * @param[in] sens_cfg : Structure instance of bmi3_sens_config.
+ * @param[in] n_sens   : Number of sensors selected.
+ * @param[in] dev      : Structure instance of bmi3_dev.
+ *
+ * @return Result of API execution status
+ *
+ * @return 0 -> Success
+ * @return < 0 -> Fail
+ */
+static int8_t retune_fifo_wm(const struct bmi3_sens_config *sens_cfg, uint8_t n_sens, struct bmi3_dev *dev);
 
-    /* Variable to define loop */
-    uint16_t index = 0;
+/*!
+ * @brief This internal API starts the FIFO read of the next device of a group.
+ *
+ * @param[in,out] group : Structure instance of bmi3_dev_group.
+ *
+ * @return None
+ */
+static void group_read_next(struct bmi3_dev_group *group);
 
-    /* Null-pointer check */
-    rslt = null_ptr_check(dev);
+/*!
+ * @brief This internal API locks the device, if a lock function is set.
+ *
+ * @param[in] dev : Structure instance of bmi3_dev.
+ *
+ * @return None
+ */
+static void lock_dev(const struct bmi3_dev *dev);
 
-    if ((rslt == BMI3_OK) && (data != NULL))
-    {
-        /* Configuring reg_addr for SPI Interface */
-        if (dev->intf == BMI3_SPI_INTF)
-        {
-            reg_addr = (reg_addr | BMI3_SPI_RD_MASK);
-        }
+/*!
+ * @brief This internal API unlocks the device, if an unlock function is set.
+ *
+ * @param[in] dev : Structure instance of bmi3_dev.
+ *
+ * @return None
+ */
+static void unlock_dev(const struct bmi3_dev *dev);
 
-        dev->intf_rslt = dev->read(reg_addr, temp_buf, len + dev->dummy_byte, dev->intf_ptr);
-        dev->delay_us(2, dev->intf_ptr);
+/*!
+ * @brief This internal API begins a batch of bus operations, if a batch begin
+ * function is set.
+ *
+ * @param[in,out] dev : Structure instance of bmi3_dev.
+ *
+ * @return None
+ */
+static void begin_batch(struct bmi3_dev *dev);
 
-        if (dev->intf_rslt == BMI3_INTF_RET_SUCCESS)
-        {
-            /* Read the data from the position next to dummy byte */
-            while (index < len)
-            {
-                data[index] = temp_buf[index + dev->dummy_byte];
-                index++;
-            }
-        }
-        else
-        {
-            rslt = BMI3_E_COM_FAIL;
-        }
-    }
-    else
-    {
-        rslt = BMI3_E_NULL_PTR;
-    }
+/*!
+ * @brief This internal API ends a batch of bus operations and submits the
+ * queued operations, if a batch end function is set.
+ *
+ * @param[in]     rslt : Result of the operations of the batch.
+ * @param[in,out] dev  : Structure instance of bmi3_dev.
+ *
+ * @return Result of API execution status
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ */
+static int8_t end_batch(int8_t rslt, struct bmi3_dev *dev);
 
-    return rslt;
-}
+/*!
+ * @brief This internal API sets the unit conversion scale factor of the
+ * accelerometer or gyroscope for the given range and the resolution of the device.
+ *
+ * @param[in] sens_type : BMI3_ACCEL or BMI3_GYRO.
+ * @param[in] range     : Range of the sensor, BMI3_ACC_RANGE_* or BMI3_GYR_RANGE_*.
+ * @param[in] dev       : Structure instance of bmi3_dev.
+ *
+ * @return None
+ */
+static void set_unit_scale(uint8_t sens_type, uint8_t range, struct bmi3_dev *dev);
 
 /*!
- * @brief This API writes data to the given register address of bmi3 sensor.
+ * @brief This internal API applies the correction of the accelerometer or gyro
+ * data to the x, y and z data of a frame.
+ *
+ * @param[in,out] x    : X-axis data.
+ * @param[in,out] y    : Y-axis data.
+ * @param[in,out] z    : Z-axis data.
+ * @param[in]     corr : Structure instance of bmi3_axes_correction.
+ *
+ * @return None
  */
-int8_t bmi3_set_regs(uint8_t reg_addr, const uint8_t *data, uint16_t len, struct bmi3_dev *dev)
-{
-    /* Variable to store result of API */
-    int8_t rslt;
+static void correct_axes(int16_t *x, int16_t *y, int16_t *z, const struct bmi3_axes_correction *corr);
 
-    /* Null-pointer check */
-    rslt = null_ptr_check(dev);
+#ifdef BMI3_BUS_STATS
 
-    if ((rslt == BMI3_OK) && (data != NULL))
-    {
-        /* Configuring reg_addr for SPI Interface */
-        if (dev->intf == BMI3_SPI_INTF)
-        {
-            reg_addr = (reg_addr & BMI3_SPI_WR_MASK);
-        }
+/*!
+ * @brief This internal API gets the timestamp at the start of a transaction,
+ * 0 if no timestamp function is set.
+ *
+ * @param[in] dev : Structure instance of bmi3_dev.
+ *
+ * @return Timestamp in microseconds
+ */
+static uint32_t bus_stats_start(const struct bmi3_dev *dev);
 
-        dev->intf_rslt = dev->write(reg_addr, data, len, dev->intf_ptr);
-        dev->delay_us(2, dev->intf_ptr);
+/*!
+ * @brief This internal API records a transaction in the bus statistics.
+ *
+ * @param[in] reg_addr : Register address of the transaction, along with SPI read bit.
+ * @param[in] is_write : BMI3_ENABLE for a write, BMI3_DISABLE for a read.
+ * @param[in] len      : Number of bytes transferred.
+ * @param[in] start    : Timestamp at the start of the transaction.
+ * @param[in] rslt     : Result of the transaction.
+ * @param[in] dev      : Structure instance of bmi3_dev.
+ *
+ * @return None
+ */
+static void bus_stats_record(uint8_t reg_addr,
+                             uint8_t is_write,
+                             uint32_t len,
+                             uint32_t start,
+                             int8_t rslt,
+                             struct bmi3_dev *dev);
+#endif
 
-        if (dev->intf_rslt != BMI3_INTF_RET_SUCCESS)
-        {
-            rslt = BMI3_E_COM_FAIL;
-        }
-    }
-    else
-    {
-        rslt = BMI3_E_NULL_PTR;
-    }
+#ifdef BMI3_RUNNING_STATS
 
-    return rslt;
-}
+/*!
+ * @brief This internal API accumulates the samples of an axis. The loop has no
+ * dependency between samples other than the reductions, so that it can be
+ * vectorized by the compiler.
+ *
+ * @param[in]     data  : Array of samples.
+ * @param[in]     count : Number of samples.
+ * @param[in,out] stats : Structure instance of bmi3_axis_stats.
+ *
+ * @return None
+ */
+static void update_axis_stats(const int16_t *data, uint16_t count, struct bmi3_axis_stats *stats);
 
 /*!
- * @brief This API resets bmi3 sensor. All registers are overwritten with
- * their default values.
+ * @brief This internal API accumulates a single sample of an axis.
+ *
+ * @param[in]     data  : Sample.
+ * @param[in,out] stats : Structure instance of bmi3_axis_stats.
+ *
+ * @return None
  */
-int8_t bmi3_soft_reset(struct bmi3_dev *dev)
-{
-    /* Variable to store result of API */
-    int8_t rslt;
+static void add_axis_sample(int16_t data, struct bmi3_axis_stats *stats);
+
+/*!
+ * @brief This internal API merges the accumulator of an axis into another.
+ *
+ * @param[in]     src : Structure instance of bmi3_axis_stats to be merged.
+ * @param[in,out] dst : Structure instance of bmi3_axis_stats.
+ *
+ * @return None
+ */
+static void merge_axis_stats(const struct bmi3_axis_stats *src, struct bmi3_axis_stats *dst);
+
+/*!
+ * @brief This internal API computes the statistics of an axis from its accumulator.
+ *
+ * @param[in]  stats  : Structure instance of bmi3_axis_stats.
+ * @param[in]  count  : Number of samples accumulated, not 0.
+ * @param[out] result : Structure instance of bmi3_axis_stats_result.
+ *
+ * @return None
+ */
+static void get_axis_stats_result(const struct bmi3_axis_stats *stats,
+                                  uint32_t count,
+                                  struct bmi3_axis_stats_result *result);
+
+/*!
+ * @brief This internal API resets the accumulators of x, y and z axis.
+ *
+ * @param[out] stats : Structure instance of bmi3_axes_stats.
+ *
+ * @return None
+ */
+static void reset_axes_stats(struct bmi3_axes_stats *stats);
+#endif
+
+/*!
+ * @brief This internal API gets the interrupt status bits with a registered callback.
+ *
+ * @param[in] disp : Structure instance of bmi3_int_dispatcher.
+ *
+ * @return Interrupt status bits with a registered callback
+ */
+static uint16_t get_registered_int_status(const struct bmi3_int_dispatcher *disp);
+
+/*!
+ * @brief This internal API reads the interrupt status registers of the
+ * dispatcher in one burst, along with the data registers and the step counter
+ * if they are needed by the registered callbacks.
+ *
+ * @param[in]  registered : Interrupt status bits with a registered callback.
+ * @param[out] fired      : Interrupt status bits with a registered callback that fired.
+ * @param[in,out] disp    : Structure instance of bmi3_int_dispatcher.
+ * @param[in]  dev        : Structure instance of bmi3_dev.
+ *
+ * @return Result of API execution status
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ */
+static int8_t get_int_status_burst(uint16_t registered,
+                                   uint16_t *fired,
+                                   struct bmi3_int_dispatcher *disp,
+                                   struct bmi3_dev *dev);
+
+/*!
+ * @brief This internal API reads the orientation and tap detection output in one read.
+ *
+ * @param[out] data : Structure instance of bmi3_int_event_data.
+ * @param[in]  dev  : Structure instance of bmi3_dev.
+ *
+ * @return Result of API execution status
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ */
+static int8_t get_feature_event_output(struct bmi3_int_event_data *data, struct bmi3_dev *dev);
+
+/*!
+ * @brief This internal API reads the i3c sync accel, gyro, temperature and
+ * time data of a device in one burst.
+ *
+ * @param[out] sample : Structure instance of bmi3_i3c_sync_sample.
+ * @param[in]  dev    : Structure instance of bmi3_dev.
+ *
+ * @return Result of API execution status
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ */
+static int8_t get_i3c_sync_sample(struct bmi3_i3c_sync_sample *sample, struct bmi3_dev *dev);
+
+/*!
+ * @brief This internal API aligns the i3c sync data of a group: gets the newest
+ * sync time and whether all devices have it.
+ *
+ * @param[in,out] frame : Structure instance of bmi3_i3c_sync_frame.
+ *
+ * @return None
+ */
+static void align_i3c_sync_frame(struct bmi3_i3c_sync_frame *frame);
+
+/*!
+ * @brief This internal API reads data from the given register address with
+ * the given read function, along with the dummy bytes.
+ *
+ * @param[in]  reg_addr : Register address from which data is read.
+ * @param[out] data     : Pointer to data buffer, of length len + dummy bytes.
+ * @param[in]  len      : Number of bytes of data to be read.
+ * @param[in]  read     : Read function.
+ * @param[in]  dev      : Structure instance of bmi3_dev.
+ *
+ * @return Result of API execution status
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ */
+static int8_t read_regs_direct(uint8_t reg_addr,
+                               uint8_t *data,
+                               uint16_t len,
+                               bmi3_read_fptr_t read,
+                               struct bmi3_dev *dev);
+
+/*!
+ * @brief This internal API gets the read function for FIFO data: the I3C
+ * HDR-DDR read function if set and I3C is used, the read function otherwise.
+ *
+ * @param[in] dev : Structure instance of bmi3_dev.
+ *
+ * @return Read function
+ */
+static bmi3_read_fptr_t get_fifo_read(const struct bmi3_dev *dev);
+
+/*!
+ * @brief This internal API reads the payloads of the fired interrupts which
+ * are not read along with the interrupt status.
+ *
+ * @param[in]     fired   : Interrupt status bits with a registered callback that fired.
+ * @param[in]     in_data : Interrupt status bits of which the payload is already read.
+ * @param[in,out] disp    : Structure instance of bmi3_int_dispatcher.
+ * @param[in]     dev     : Structure instance of bmi3_dev.
+ *
+ * @return Result of API execution status
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ */
+static int8_t get_int_event_payload(uint16_t fired,
+                                    uint16_t in_data,
+                                    struct bmi3_int_dispatcher *disp,
+                                    struct bmi3_dev *dev);
+
+/*!
+ * @brief This internal API calls the callbacks of the fired interrupts.
+ *
+ * @param[in] fired : Interrupt status bits with a registered callback that fired.
+ * @param[in] disp  : Structure instance of bmi3_int_dispatcher.
+ *
+ * @return None
+ */
+static void call_int_callbacks(uint16_t fired, const struct bmi3_int_dispatcher *disp);
+
+/*!
+ * @brief This internal API checks the targets of the ODR and power governor.
+ *
+ * @param[in] target : Structure instance of bmi3_governor_target.
+ *
+ * @return Result of API execution status
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ */
+static int8_t check_governor_target(const struct bmi3_governor_target *target);
+
+/*!
+ * @brief This internal API sets the user configuration, alternate
+ * configuration and switch sources of the ODR and power governor.
+ *
+ * @param[in] target : Structure instance of bmi3_governor_target.
+ * @param[in] dev    : Structure instance of bmi3_dev.
+ *
+ * @return Result of API execution status
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ */
+static int8_t set_governor_config(const struct bmi3_governor_target *target, struct bmi3_dev *dev);
+
+/*!
+ * @brief This internal API sets the FIFO water-mark level which keeps the
+ * latency budget at rest and avoids FIFO overflow in motion.
+ *
+ * @param[in]  target  : Structure instance of bmi3_governor_target.
+ * @param[out] fifo_wm : FIFO water-mark level set, 0 if FIFO has no accel or gyro frames.
+ * @param[in]  dev     : Structure instance of bmi3_dev.
+ *
+ * @return Result of API execution status
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ */
+static int8_t set_governor_fifo_wm(const struct bmi3_governor_target *target, uint16_t *fifo_wm, struct bmi3_dev *dev);
+
+/*!
+ * @brief This internal API zigzag-encodes the delta of two samples, so that
+ * small negative and positive deltas have a small bit width.
+ *
+ * @param[in] data : Sample.
+ * @param[in] prev : Previous sample.
+ *
+ * @return Zigzag-encoded delta
+ */
+static uint32_t get_zigzag_delta(int16_t data, int16_t prev);
+
+/*!
+ * @brief This internal API gets the number of bits of a value.
+ *
+ * @param[in] value : Value.
+ *
+ * @return Number of bits, 0 for 0
+ */
+static uint8_t get_bit_width(uint32_t value);
+
+/*!
+ * @brief This internal API writes a value to a bit stream, least significant bit first.
+ *
+ * @param[in,out] buf     : Bit stream, cleared in advance.
+ * @param[in,out] bit_pos : Bit position in the bit stream.
+ * @param[in]     value   : Value.
+ * @param[in]     width   : Number of bits of the value.
+ *
+ * @return None
+ */
+static void put_bits(uint8_t *buf, uint32_t *bit_pos, uint32_t value, uint8_t width);
+
+/*!
+ * @brief This internal API reads a value from a bit stream, least significant bit first.
+ *
+ * @param[in]     buf     : Bit stream.
+ * @param[in,out] bit_pos : Bit position in the bit stream.
+ * @param[in]     width   : Number of bits of the value.
+ *
+ * @return Value
+ */
+static uint32_t get_bits(const uint8_t *buf, uint32_t *bit_pos, uint8_t width);
+
+/*!
+ * @brief This internal API counts the dummy frames of a sensor in the FIFO data.
+ *
+ * @param[in] sens_offset : Byte offset of the sensor in the frame.
+ * @param[in] dummy_frame : Dummy frame value of the sensor.
+ * @param[in] frames      : Number of frames of the sensor.
+ * @param[in] layout      : Structure instance of bmi3_fifo_frame_layout.
+ * @param[in] fifo        : Structure instance of bmi3_fifo_frame.
+ * @param[in] dev         : Structure instance of bmi3_dev.
+ *
+ * @return Number of dummy frames
+ */
+static uint16_t count_fifo_dummy_frames(uint8_t sens_offset,
+                                        uint16_t dummy_frame,
+                                        uint16_t frames,
+                                        const struct bmi3_fifo_frame_layout *layout,
+                                        const struct bmi3_fifo_frame *fifo,
+                                        const struct bmi3_dev *dev);
+
+/*!
+ * @brief This internal API gets the number of frames of a sensor of the census.
+ *
+ * @param[in] sens_offset : Byte offset of the sensor in the frame.
+ * @param[in] sens_len    : Length of the sensor data in bytes.
+ * @param[in] census      : Structure instance of bmi3_fifo_census.
+ *
+ * @return Number of frames of the sensor
+ */
+static uint16_t get_census_frames(uint8_t sens_offset, uint8_t sens_len, const struct bmi3_fifo_census *census);
+
+/*!
+ * @brief This internal API reads words of the feature engine starting at the
+ * given base address.
+ *
+ * @param[in]  base_addr : Base address of the first word.
+ * @param[out] data      : Data of the words.
+ * @param[in]  len       : Number of bytes to be read.
+ * @param[in]  dev       : Structure instance of bmi3_dev.
+ *
+ * @return Result of API execution status
+ *
+ * @return 0 -> Success
+ * @return < 0 -> Fail
+ *
+ */
+static int8_t get_feature_words(uint8_t base_addr, uint8_t *data, uint16_t len, struct bmi3_dev *dev);
+
+/*!
+ * @brief This internal API writes words of the feature engine starting at the
+ * given base address.
+ *
+ * @param[in] base_addr : Base address of the first word.
+ * @param[in] data      : Data of the words.
+ * @param[in] len       : Number of bytes to be written.
+ * @param[in] dev       : Structure instance of bmi3_dev.
+ *
+ * @return Result of API execution status
+ *
+ * @return 0 -> Success
+ * @return < 0 -> Fail
+ *
+ */
+static int8_t set_feature_words(uint8_t base_addr, const uint8_t *data, uint16_t len, struct bmi3_dev *dev);
+
+/*!
+ * @brief This internal API computes the CRC-16 of the calibration blob.
+ *
+ * @param[in] data : Data of the calibration blob.
+ * @param[in] len  : Number of bytes covered by the CRC.
+ *
+ * @return CRC-16
+ */
+static uint16_t get_calib_crc(const uint8_t *data, uint8_t len);
+
+/*!
+ * @brief This internal API writes the registers of the configuration image,
+ * in dependency order and with the sensors enabled last.
+ *
+ * @param[in] image : Structure instance of bmi3_config_image.
+ * @param[in] dev   : Structure instance of bmi3_dev.
+ *
+ * @return Result of API execution status
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ */
+static int8_t set_config_image_regs(const struct bmi3_config_image *image, struct bmi3_dev *dev);
+
+/*!
+ * @brief This internal API reconstructs the unwrapped sensor time of a FIFO
+ * sample and takes it over as time of the last sample.
+ *
+ * @param[in,out] fifo_time   : Structure instance of bmi3_fifo_time.
+ * @param[in]     fifo        : Structure instance of bmi3_fifo_frame.
+ * @param[in]     sensor_time : Sensor time of the sample, used if sensor time is enabled in FIFO.
+ * @param[in]     index       : Index of the sample in the FIFO data.
+ * @param[in]     count       : Number of samples of the FIFO data.
+ *
+ * @return Unwrapped sensor time of the sample
+ */
+static uint64_t get_fifo_sample_time(struct bmi3_fifo_time *fifo_time,
+                                     const struct bmi3_fifo_frame *fifo,
+                                     uint16_t sensor_time,
+                                     uint16_t index,
+                                     uint16_t count);
+
+/*!
+ * @brief This internal API parses the accelerometer and gyro frames of the
+ * FIFO data at their native rates, keeping track of the frame of each sample.
+ *
+ * @param[out]    multi_rate : Structure instance of bmi3_fifo_multi_rate.
+ * @param[in,out] fifo_time  : Structure instance of bmi3_fifo_time at the FIFO frame rate, NULL for no timestamps.
+ * @param[in]     fifo       : Structure instance of bmi3_fifo_frame.
+ * @param[in]     dev        : Structure instance of bmi3_dev.
+ *
+ * @return Result of API execution status
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ */
+static int8_t parse_fifo_multi_rate(struct bmi3_fifo_multi_rate *multi_rate,
+                                    struct bmi3_fifo_time *fifo_time,
+                                    const struct bmi3_fifo_frame *fifo,
+                                    const struct bmi3_dev *dev);
+
+/*!
+ * @brief This internal API parses the frames of the FIFO data holding both an
+ * accelerometer and a gyro sample into joined 6-DoF samples.
+ *
+ * @param[out] data   : Structure instance of bmi3_fifo_6dof_data where the parsed data is stored.
+ * @param[in]  layout : Layout of the frame.
+ * @param[in]  fifo   : Structure instance of bmi3_fifo_frame.
+ * @param[in]  dev    : Structure instance of bmi3_dev.
+ *
+ * @return Number of joined samples
+ */
+static uint16_t parse_fifo_6dof(struct bmi3_fifo_6dof_data *data,
+                                const struct bmi3_fifo_frame_layout *layout,
+                                const struct bmi3_fifo_frame *fifo,
+                                const struct bmi3_dev *dev);
+
+#ifdef BMI3_FUSION
+
+/*!
+ * @brief This internal API gets the integer square root.
+ *
+ * @param[in] value : Value of which the square root is taken.
+ *
+ * @return Square root, rounded down
+ */
+static uint32_t get_isqrt(uint64_t value);
+
+/*!
+ * @brief This internal API updates the orientation fusion by a 6-DoF sample.
+ *
+ * @param[in]     sample : Structure instance of bmi3_fifo_6dof_data.
+ * @param[in]     dt     : Time since the last sample in sensor time ticks.
+ * @param[in,out] fusion : Structure instance of bmi3_fusion.
+ * @param[in]     dev    : Structure instance of bmi3_dev.
+ *
+ * @return None
+ */
+static void update_fusion(const struct bmi3_fifo_6dof_data *sample,
+                          uint32_t dt,
+                          struct bmi3_fusion *fusion,
+                          const struct bmi3_dev *dev);
+#endif
+
+#ifdef BMI3_SPECTRUM
+
+/*!
+ * @brief This internal API gets the Goertzel filter coefficient of a bin:
+ * 2 * cos(2 * pi * bin / len) with BMI3_GOERTZEL_FRAC_BITS fraction bits.
+ *
+ * @param[in] bin : Frequency bin, up to half the block length.
+ * @param[in] len : Number of samples of a block.
+ *
+ * @return Filter coefficient
+ */
+static int32_t get_goertzel_coeff(uint16_t bin, uint16_t len);
+
+/*!
+ * @brief This internal API runs the samples of an axis through the bank of
+ * Goertzel filters.
+ *
+ * @param[in]     data   : Samples of the axis.
+ * @param[in]     count  : Number of samples.
+ * @param[in]     coeff  : Filter coefficient of each bin.
+ * @param[in]     n_bins : Number of bins.
+ * @param[in,out] s1     : Last state of each bin.
+ * @param[in,out] s2     : State before the last of each bin.
+ *
+ * @return None
+ */
+static void run_goertzel(const int16_t *data,
+                         uint16_t count,
+                         const int32_t *coeff,
+                         uint8_t n_bins,
+                         int32_t *s1,
+                         int32_t *s2);
+
+/*!
+ * @brief This internal API gets the spectral summary of a completed block and
+ * restarts the filters.
+ *
+ * @param[in,out] spec    : Structure instance of bmi3_spectrum.
+ * @param[out]    summary : Structure instance of bmi3_spectrum_summary.
+ *
+ * @return None
+ */
+static void finish_spectrum_block(struct bmi3_spectrum *spec, struct bmi3_spectrum_summary *summary);
+#endif
+
+#ifdef BMI3_SHOCK_DETECT
+
+/*!
+ * @brief This internal API scans the accelerometer frames of the FIFO data for
+ * axis values above the threshold.
+ *
+ * @param[in]     threshold : Threshold in LSB.
+ * @param[in]     config    : Structure instance of bmi3_shock_config.
+ * @param[out]    events    : Structure instance of bmi3_shock_event.
+ * @param[in,out] n_events  : Number of elements of "events" as input, number of shocks as output.
+ * @param[in]     layout    : Layout of the frame.
+ * @param[in]     fifo      : Structure instance of bmi3_fifo_frame.
+ * @param[in]     dev       : Structure instance of bmi3_dev.
+ *
+ * @return None
+ */
+static void scan_fifo_shocks(int32_t threshold,
+                             const struct bmi3_shock_config *config,
+                             struct bmi3_shock_event *events,
+                             uint8_t *n_events,
+                             const struct bmi3_fifo_frame_layout *layout,
+                             const struct bmi3_fifo_frame *fifo,
+                             const struct bmi3_dev *dev);
+#endif
+
+/*!
+ * @brief This internal API gets the sensor/feature data for accelerometer, gyroscope,
+ * step counter, orientation, i3c sync accel, i3c sync gyro and i3c sync temperature.
+ *
+ * @param[in,out] sensor_data : Structure instance of bmi3_sensor_data.
+ * @param[in]     n_sens      : Number of sensors selected.
+ * @param[in]     dev         : Structure instance of bmi3_dev.
+ *
+ * @return Result of API execution status
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ */
+static int8_t get_sensor_data(struct bmi3_sensor_data *sensor_data, uint8_t n_sens, struct bmi3_dev *dev);
+
+/*!
+ * @brief This internal API gives the index of a buffer of a ping-pong FIFO
+ * acquisition from the free-running count of buffers.
+ *
+ * @param[in] pingpong : Structure instance of bmi3_fifo_pingpong.
+ * @param[in] count    : Free-running count of buffers.
+ *
+ * @return Index of the buffer
+ */
+static uint8_t pingpong_index(const struct bmi3_fifo_pingpong *pingpong, uint8_t count);
+
+/*!
+ * @brief This internal API gives the number of bytes of the config array
+ * written at once.
+ *
+ * @param[in] dev : Structure instance of bmi3_dev.
+ *
+ * @return Number of bytes written at once
+ */
+static uint16_t get_upload_burst_len(const struct bmi3_dev *dev);
+
+/*!
+ * @brief This internal API runs a step of the resumable soft-reset.
+ *
+ * @param[in,out] op  : Structure instance of bmi3_op.
+ * @param[in,out] dev : Structure instance of bmi3_dev.
+ *
+ * @return Result of API execution status
+ * @retval 0 -> Success
+ * @retval BMI3_W_OP_PENDING -> Step is run, the operation continues
+ * @retval < 0 -> Fail
+ */
+static int8_t op_soft_reset(struct bmi3_op *op, struct bmi3_dev *dev);
+
+/*!
+ * @brief This internal API runs a step of the resumable self-test.
+ *
+ * @param[in,out] op  : Structure instance of bmi3_op.
+ * @param[in,out] dev : Structure instance of bmi3_dev.
+ *
+ * @return Result of API execution status
+ * @retval 0 -> Success
+ * @retval BMI3_W_OP_PENDING -> Step is run, the operation continues
+ * @retval < 0 -> Fail
+ */
+static int8_t op_self_test(struct bmi3_op *op, struct bmi3_dev *dev);
+
+/*!
+ * @brief This internal API runs a step of the resumable gyro self-calibration.
+ *
+ * @param[in,out] op  : Structure instance of bmi3_op.
+ * @param[in,out] dev : Structure instance of bmi3_dev.
+ *
+ * @return Result of API execution status
+ * @retval 0 -> Success
+ * @retval BMI3_W_OP_PENDING -> Step is run, the operation continues
+ * @retval < 0 -> Fail
+ */
+static int8_t op_gyro_sc(struct bmi3_op *op, struct bmi3_dev *dev);
+
+/*!
+ * @brief This internal API runs a step of the resumable config array upload,
+ * writing one burst of the config array.
+ *
+ * @param[in,out] op  : Structure instance of bmi3_op.
+ * @param[in,out] dev : Structure instance of bmi3_dev.
+ *
+ * @return Result of API execution status
+ * @retval 0 -> Success
+ * @retval BMI3_W_OP_PENDING -> Step is run, the operation continues
+ * @retval < 0 -> Fail
+ */
+static int8_t op_upload_config_array(struct bmi3_op *op, struct bmi3_dev *dev);
+
+/*!
+ * @brief This internal API runs a step of the resumable accel FOC, polling
+ * the data ready status once.
+ *
+ * @param[in,out] op  : Structure instance of bmi3_op.
+ * @param[in,out] dev : Structure instance of bmi3_dev.
+ *
+ * @return Result of API execution status
+ * @retval 0 -> Success
+ * @retval BMI3_W_OP_PENDING -> Step is run, the operation continues
+ * @retval < 0 -> Fail
+ */
+static int8_t op_accel_foc(struct bmi3_op *op, struct bmi3_dev *dev);
+
+/*!
+ * @brief This internal API resets the state of a resumable operation.
+ *
+ * @param[in]  kind : Operation, BMI3_OP_SOFT_RESET to BMI3_OP_ACCEL_FOC.
+ * @param[out] op   : Structure instance of bmi3_op.
+ */
+static void op_init(uint8_t kind, struct bmi3_op *op);
+
+/*!
+ * @brief This internal API decides whether a failed transfer is retried, as
+ * per the retry policy of bmi3_dev and the register accessed, and waits for
+ * the backoff delay before the retry.
+ *
+ * @param[in]     reg_addr : Register address of the transfer, without the SPI read bit.
+ * @param[in]     is_write : BMI3_ENABLE for a write, BMI3_DISABLE for a read.
+ * @param[in]     attempt  : Number of retries done so far.
+ * @param[in,out] dev      : Structure instance of bmi3_dev.
+ *
+ * @return BMI3_ENABLE if the transfer is to be retried, BMI3_DISABLE otherwise
+ */
+static uint8_t retry_transfer(uint8_t reg_addr, uint8_t is_write, uint8_t attempt, struct bmi3_dev *dev);
+
+/*!
+ * @brief This internal API unwraps a 32-bit sensor time against the newest
+ * sample of the clock synchronization.
+ *
+ * @param[in] sensor_time : Sensor time in ticks of 39.0625 microseconds.
+ * @param[in] cs          : Structure instance of bmi3_clock_sync.
+ *
+ * @return Unwrapped sensor time, within 2^31 ticks of the newest sample
+ */
+static uint64_t clock_sync_unwrap(uint32_t sensor_time, const struct bmi3_clock_sync *cs);
+
+/*!
+ * @brief This internal API scales a distance in ticks with the rate of the
+ * clock synchronization.
+ *
+ * @param[in] delta : Distance in ticks, within 2^31 ticks.
+ * @param[in] rate  : Nanoseconds per tick with BMI3_CLOCK_SYNC_RATE_FRAC fraction bits.
+ *
+ * @return Distance in nanoseconds
+ */
+static int64_t clock_sync_scale(int64_t delta, int64_t rate);
+
+/*!
+ * @brief This internal API estimates the drift and offset of the clock
+ * synchronization from the samples of its window.
+ *
+ * @param[in,out] cs : Structure instance of bmi3_clock_sync.
+ */
+static void clock_sync_fit(struct bmi3_clock_sync *cs);
+
+/*!
+ * @brief This internal API prepares the next procedure of the plan of a unit.
+ *
+ * @param[in]     line : Structure instance of bmi3_calib_line.
+ * @param[in,out] unit : Structure instance of bmi3_calib_unit.
+ *
+ * @return Result of API execution status
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ */
+static int8_t calib_unit_prep(const struct bmi3_calib_line *line, struct bmi3_calib_unit *unit);
+
+/*!
+ * @brief This internal API runs the next step of a unit, starting the next
+ * procedure of the plan or reading the calibration state at its end. A failure
+ * is recorded in the unit, which is then done.
+ *
+ * @param[in]     line : Structure instance of bmi3_calib_line.
+ * @param[in,out] unit : Structure instance of bmi3_calib_unit.
+ */
+static void calib_unit_step(const struct bmi3_calib_line *line, struct bmi3_calib_unit *unit);
+
+/*!
+ * @brief This internal API gets the feature engine words holding the
+ * configuration of a feature.
+ *
+ * @param[in]  type      : Type of the feature.
+ * @param[out] base_addr : Base address of the first word.
+ * @param[out] n_words   : Number of words.
+ *
+ * @return Result of API execution status
+ * @retval 0 -> Success
+ * @retval BMI3_E_INVALID_SENSOR -> Not configured through the feature engine
+ */
+static int8_t get_feature_span(uint8_t type, uint8_t *base_addr, uint8_t *n_words);
+
+/*!
+ * @brief This internal API decodes the configuration of a feature from the
+ * words of a feature engine image.
+ *
+ * @param[in]     image    : Structure instance of bmi3_feature_batch.
+ * @param[in,out] sens_cfg : Structure instance of bmi3_sens_config, of which
+ *                           the type selects the feature.
+ *
+ * @return Result of API execution status
+ * @retval 0 -> Success
+ * @retval BMI3_E_INVALID_SENSOR -> Not configured through the feature engine
+ * @retval BMI3_E_INVALID_INPUT -> Words of the feature not held by the image
+ */
+static int8_t unpack_feature_config(const struct bmi3_feature_batch *image, struct bmi3_sens_config *sens_cfg);
+
+/*!
+ * @brief This internal API reads the feature engine words of the features in
+ * the list at once, if more than one feature is in the list.
+ *
+ * @param[in]  sens_cfg : Structure instance of bmi3_sens_config.
+ * @param[in]  n_sens   : Number of sensors/features in the list.
+ * @param[out] image    : Structure instance of bmi3_feature_batch, "dirty"
+ *                        marks the words read, 0 if none.
+ * @param[in]  dev      : Structure instance of bmi3_dev.
+ *
+ * @return Result of API execution status
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ */
+static int8_t get_feature_config_words(const struct bmi3_sens_config *sens_cfg,
+                                       uint8_t n_sens,
+                                       struct bmi3_feature_batch *image,
+                                       struct bmi3_dev *dev);
+
+/*!
+ * @brief This internal API drops the words of a feature batch which are
+ * unchanged against the words on the sensor. Short runs of unchanged words
+ * between changed words are kept, as one transfer costs less than two.
+ *
+ * @param[in]     written : Words on the sensor, NULL if not known.
+ * @param[in,out] batch   : Structure instance of bmi3_feature_batch.
+ *
+ * @return None
+ */
+static void skip_unchanged_words(const struct bmi3_feature_batch *written, struct bmi3_feature_batch *batch);
+
+/*!
+ * @brief This internal API encodes the configuration of a feature into a
+ * feature batch.
+ *
+ * @param[in]     sens_cfg : Structure instance of bmi3_sens_config.
+ * @param[in,out] batch    : Structure instance of bmi3_feature_batch.
+ * @param[in]     dev      : Structure instance of bmi3_dev, to check the
+ *                           configuration against the accel configuration,
+ *                           NULL for no check.
+ *
+ * @return Result of API execution status
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ */
+static int8_t pack_feature_config(const struct bmi3_sens_config *sens_cfg,
+                                  struct bmi3_feature_batch *batch,
+                                  struct bmi3_dev *dev);
+
+/*!
+ * @brief This internal API reads an accel, gyro or alternate configuration.
+ *
+ * @param[in,out] sens_cfg : Structure instance of bmi3_sens_config, of which
+ *                           the type selects the configuration.
+ * @param[in]     dev      : Structure instance of bmi3_dev.
+ *
+ * @return Result of API execution status
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ */
+static int8_t get_reg_config(struct bmi3_sens_config *sens_cfg, struct bmi3_dev *dev);
+
+/*!
+ * @brief This internal API writes an accel, gyro or alternate configuration.
+ *
+ * @param[in]     sens_cfg : Structure instance of bmi3_sens_config.
+ * @param[in,out] dev      : Structure instance of bmi3_dev.
+ *
+ * @return Result of API execution status
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ */
+static int8_t set_reg_config(struct bmi3_sens_config *sens_cfg, struct bmi3_dev *dev);
+
+/*!
+ * @brief This internal API compares two accel, gyro or alternate configurations.
+ *
+ * @param[in] cfg1 : Structure instance of bmi3_sens_config.
+ * @param[in] cfg2 : Structure instance of bmi3_sens_config of the same type.
+ *
+ * @return BMI3_ENABLE if the register values are the same, BMI3_DISABLE otherwise
+ */
+static uint8_t is_same_reg_config(const struct bmi3_sens_config *cfg1, const struct bmi3_sens_config *cfg2);
+
+/*!
+ * @brief This internal API gets the order in which an accel, gyro or
+ * alternate configuration is written.
+ *
+ * @param[in] type : Type of the configuration.
+ *
+ * @return 0 for alternate, 1 for accel and gyro, 2 for other configurations
+ */
+static uint8_t get_reg_config_order(uint8_t type);
+
+/*!
+ * @brief This internal API counts a sample to the statistics of the auto-range
+ * governor and decides on a range switch.
+ *
+ * @param[in]     x       : Data in x-axis.
+ * @param[in]     y       : Data in y-axis.
+ * @param[in]     z       : Data in z-axis.
+ * @param[in]     sat     : Non-zero if an axis of the sample is saturated.
+ * @param[in,out] ar      : Structure instance of bmi3_auto_range.
+ *
+ * @return None
+ */
+static void auto_range_sample(int16_t x, int16_t y, int16_t z, uint8_t sat, struct bmi3_auto_range *ar);
+
+/*!
+ * @brief This internal API gets the magnitude of a sample in LSB.
+ *
+ * @param[in] data    : Data of an axis.
+ *
+ * @return Magnitude, 0x8000 for the most negative value
+ */
+static uint16_t auto_range_abs(int16_t data);
+
+/*!
+ * @brief This internal API interpolates offset and gain of the thermal
+ * compensation table at a temperature into the axes correction.
+ *
+ * @param[in]     temp    : Temperature in LSB.
+ * @param[in,out] comp    : Structure instance of bmi3_thermal_comp.
+ *
+ * @return None
+ */
+static void interpolate_thermal_comp(int16_t temp, struct bmi3_thermal_comp *comp);
+
+/*!
+ * @brief This internal API sets the FIFO and the mapping of the data-ready and
+ * FIFO water-mark interrupts of a scheduler mode. Other interrupts of the
+ * mapping are kept.
+ *
+ * @param[in] mode      : BMI3_SCHED_DRDY or BMI3_SCHED_FIFO.
+ * @param[in] fifo_wm   : FIFO water-mark level in FIFO mode.
+ * @param[in] sched     : Structure instance of bmi3_sched.
+ * @param[in,out] dev   : Structure instance of bmi3_dev.
+ *
+ * @return Result of API execution status
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ */
+static int8_t set_sched_mode(uint8_t mode, uint16_t fifo_wm, const struct bmi3_sched *sched, struct bmi3_dev *dev);
+
+/*!
+ * @brief This internal API reads one sample of the data registers of the
+ * sensors of the scheduler into the sample queues.
+ *
+ * @param[in] sched          : Structure instance of bmi3_sched.
+ * @param[in,out] accel_queue : Queue of the accel samples.
+ * @param[in,out] gyro_queue  : Queue of the gyro samples.
+ * @param[out] dropped       : Number of samples not pushed as a queue is full.
+ * @param[in,out] dev        : Structure instance of bmi3_dev.
+ *
+ * @return Result of API execution status
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ */
+static int8_t push_sched_drdy(const struct bmi3_sched *sched,
+                              struct bmi3_sample_queue *accel_queue,
+                              struct bmi3_sample_queue *gyro_queue,
+                              uint16_t *dropped,
+                              struct bmi3_dev *dev);
+
+/*!
+ * @brief This internal API decodes the error register.
+ *
+ * @param[in]  data    : Error register, LSB first.
+ * @param[out] err_reg : Structure instance of bmi3_err_reg.
+ */
+static void unpack_err_reg(const uint8_t *data, struct bmi3_err_reg *err_reg);
+
+/*!
+ * @brief This internal API gets the faults of a health snapshot.
+ *
+ * @param[in] health : Structure instance of bmi3_health.
+ *
+ * @return Faults, BMI3_HEALTH_*
+ */
+static uint16_t get_health_faults(const struct bmi3_health *health);
+
+#ifdef BMI3_PACKED_BUF
+
+/*!
+ * @brief This internal API sets the saturation flags of a sample in the
+ * saturation side-band of a packed buffer.
+ *
+ * @param[in,out] sat : Saturation side-band.
+ * @param[in]     pos : Index of the sample.
+ * @param[in]     val : Saturation flags, BMI3_PACKED_SAT_*.
+ */
+static void set_packed_sat(uint8_t *sat, uint16_t pos, uint8_t val);
+
+/*!
+ * @brief This internal API limits the number of samples to unpack to the
+ * samples of a packed buffer from an index on.
+ *
+ * @param[in] buf   : Structure instance of bmi3_packed_buf.
+ * @param[in] first : Index of the first sample.
+ * @param[in] count : Number of samples requested.
+ *
+ * @return Number of samples to unpack
+ */
+static uint16_t unpacked_count(const struct bmi3_packed_buf *buf, uint16_t first, uint16_t count);
+#endif
+
+#ifdef BMI3_FLIGHT_REC
+
+/*!
+ * @brief This internal API unpacks a sample of the ring of a flight recorder.
+ *
+ * @param[in]  axes      : Packed sample.
+ * @param[in]  sens_time : Unwrapped sensor time of the sample.
+ * @param[out] data      : Unpacked sample.
+ */
+static void unpack_rec_sample(const struct bmi3_packed_axes *axes, uint32_t sens_time, struct bmi3_sens_axes_data *data);
+#endif
+
+/*!
+ * @brief This internal API packs the gyro data path offsets and gains into the
+ * register image of BMI3_REG_GYR_DP_OFF_X to BMI3_REG_GYR_DP_DGAIN_Z.
+ *
+ * @param[in]  gyr_dp_gain_offset : Structure instance of bmi3_gyr_dp_gain_offset.
+ * @param[out] gyr_off_gain       : Register image, 12 bytes.
+ */
+static void pack_gyro_dp_off_dgain(const struct bmi3_gyr_dp_gain_offset *gyr_dp_gain_offset, uint8_t *gyr_off_gain);
+
+/*!
+ * @brief This internal API corrects a 10-bit gyro data path offset by the mean
+ * of the accumulated samples of an axis.
+ *
+ * @param[in] off  : Data path offset, two's complement of 10 bits.
+ * @param[in] sum  : Sum of the samples of the axis.
+ * @param[in] bias : Structure instance of bmi3_gyro_bias.
+ *
+ * @return Corrected data path offset
+ */
+static uint16_t correct_gyro_dp_off(uint16_t off, int32_t sum, const struct bmi3_gyro_bias *bias);
+
+/*!
+ * @brief This internal API packs an axis remap into the axis remap word of
+ * the feature engine.
+ *
+ * @param[in]  remapped_axis : Structure that stores re-mapped axes.
+ * @param[out] remap_data    : Axis remap word, 2 bytes, cleared by the caller.
+ */
+static void pack_remap_word(const struct bmi3_axes_remap *remapped_axis, uint8_t *remap_data);
+
+/*!
+ * @brief This internal API adds an interval without gap to the running
+ * average and the jitter histogram of the analysis of the FIFO frame intervals.
+ *
+ * @param[in]     interval : Interval of a frame in sensor time ticks.
+ * @param[in,out] jitter   : Structure instance of bmi3_fifo_jitter.
+ */
+static void add_fifo_jitter_interval(uint32_t interval, struct bmi3_fifo_jitter *jitter);
+
+/*!
+ * @brief This internal API adds an increment of the step counter to the
+ * step cadence.
+ *
+ * @param[in]     step_count  : Step count of the sensor.
+ * @param[in]     sensor_time : 32-bit sensor time of the step count.
+ * @param[in,out] cadence     : Structure instance of bmi3_step_cadence.
+ */
+static void add_step_increment(uint32_t step_count, uint32_t sensor_time, struct bmi3_step_cadence *cadence);
+
+/*!
+ * @brief This internal API reads the available FIFO data given by the fill
+ * level, limited by the buffer.
+ *
+ * @param[in]     fifo_config : FIFO configuration of the sensor.
+ * @param[in,out] fifo        : Structure instance of bmi3_fifo_frame, with the fill level.
+ * @param[in]     dev         : Structure instance of bmi3_dev.
+ *
+ * @return Result of API execution status
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ */
+static int8_t read_available_fifo(uint16_t fifo_config, struct bmi3_fifo_frame *fifo, struct bmi3_dev *dev);
+
+/*!
+ * @brief This internal API initializes the state kept by the device structure,
+ * before the first access to the sensor.
+ *
+ * @param[in,out] dev : Structure instance of bmi3_dev.
+ */
+static void init_dev_state(struct bmi3_dev *dev);
+
+/*!
+ * @brief This internal API stores the chip-id and the accel offset bit width
+ * given by the revision of the sensor.
+ *
+ * @param[in]     chip_id : Chip-id register, 2 bytes.
+ * @param[in,out] dev     : Structure instance of bmi3_dev.
+ */
+static void set_chip_id(const uint8_t *chip_id, struct bmi3_dev *dev);
+
+/*!
+ * @brief This internal API selects the variant matching the chip-id of the
+ * device and assigns its resolution.
+ *
+ * @param[in]     variants   : Array of pointers to the variants.
+ * @param[in]     n_variants : Number of variants.
+ * @param[in,out] dev        : Structure instance of bmi3_dev.
+ *
+ * @return Result of API execution status
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail, BMI3_E_DEV_NOT_FOUND if no variant matches
+ */
+static int8_t select_variant(const struct bmi3_variant *const *variants, uint8_t n_variants, struct bmi3_dev *dev);
+
+/*!
+ * @brief This internal API runs the setup of the variant of the device, unless
+ * the sensor was warm started, and gets the scale factors of the ranges.
+ *
+ * @param[in,out] dev : Structure instance of bmi3_dev, of which the variant is selected.
+ *
+ * @return Result of API execution status
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ */
+static int8_t setup_variant(struct bmi3_dev *dev);
+
+/*!
+ * @brief This internal API runs the next stage of a unit of a bring-up.
+ *
+ * @param[in,out] bring_up : Structure instance of bmi3_bring_up.
+ * @param[in,out] unit     : Unit of the bring-up.
+ */
+static void bring_up_unit_step(struct bmi3_bring_up *bring_up, struct bmi3_bring_up_unit *unit);
+
+/*!
+ * @brief This internal API reads the chip-id of a device, before any soft-reset,
+ * and selects its variant.
+ *
+ * @param[in]     bring_up : Structure instance of bmi3_bring_up.
+ * @param[in,out] dev      : Structure instance of bmi3_dev.
+ *
+ * @return Result of API execution status
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail, BMI3_E_DEV_NOT_FOUND if no variant matches the chip-id
+ */
+static int8_t probe_bring_up_unit(const struct bmi3_bring_up *bring_up, struct bmi3_dev *dev);
+
+/*!
+ * @brief This internal API gets the supply current of the accel in the given
+ * configuration, and its output data rate.
+ *
+ * @param[in]  cfg   : Structure instance of bmi3_accel_config.
+ * @param[in]  table : Structure instance of bmi3_current_table.
+ * @param[out] odr   : Output data rate in mHz, 0 if the accel is disabled.
+ *
+ * @return Current in nA
+ */
+static uint32_t get_accel_current(const struct bmi3_accel_config *cfg,
+                                  const struct bmi3_current_table *table,
+                                  uint32_t *odr);
+
+/*!
+ * @brief This internal API gets the supply current of the gyro in the given
+ * configuration, and its output data rate.
+ *
+ * @param[in]  cfg   : Structure instance of bmi3_gyro_config.
+ * @param[in]  table : Structure instance of bmi3_current_table.
+ * @param[out] odr   : Output data rate in mHz, 0 if the gyro does not sample.
+ *
+ * @return Current in nA
+ */
+static uint32_t get_gyro_current(const struct bmi3_gyro_config *cfg,
+                                 const struct bmi3_current_table *table,
+                                 uint32_t *odr);
+
+/*!
+ * @brief This internal API gets the modeled time of bus transactions.
+ *
+ * @param[in] model  : Structure instance of bmi3_bus_model.
+ * @param[in] reads  : Number of read transactions.
+ * @param[in] writes : Number of write transactions.
+ * @param[in] bytes  : Number of bytes transferred, along with dummy bytes.
+ *
+ * @return Time in nanoseconds, not scaled
+ */
+static uint64_t get_bus_model_ns(const struct bmi3_bus_model *model, uint64_t reads, uint64_t writes, uint64_t bytes);
+
+/*!
+ * @brief This internal API adds the wake-ups of an interrupt source to the sums
+ * of a power estimate. Each wake-up reads the interrupt status and the data.
+ *
+ * @param[in]     rate       : Rate of the wake-ups in mHz.
+ * @param[in]     status_len : Bytes of the interrupt status read.
+ * @param[in]     data_len   : Bytes of the data read, 0 if no data is read.
+ * @param[in]     model      : Structure instance of bmi3_bus_model.
+ * @param[in,out] sum        : Sums of the estimate, BMI3_POWER_SUMS entries.
+ */
+static void add_power_wakeups(uint64_t rate,
+                              uint16_t status_len,
+                              uint16_t data_len,
+                              const struct bmi3_bus_model *model,
+                              uint64_t *sum);
+
+/*!
+ * @brief This internal API gets the idle time required after a write access,
+ * as per "idle_time_us" of bmi3_dev.
+ *
+ * @param[in] dev : Structure instance of bmi3_dev.
+ *
+ * @return Idle time in microseconds
+ */
+static uint32_t get_idle_time(const struct bmi3_dev *dev);
+
+/******************************************************************************/
+/*!  @name      User Interface Definitions                            */
+/******************************************************************************/
+
+/*!
+ * @brief This API is the entry point for bmi3 sensor. It reads and validates the
+ * chip-id of the sensor.
+ */
+int8_t bmi3_init(struct bmi3_dev *dev)
+{
+    /* Variable to store result of API */
+    int8_t rslt;
+
+    /* Variable to assign chip id */
+    uint8_t chip_id[2] = { 0 };
+
+    /* Variable to read the status register */
+    uint8_t status[2] = { 0 };
+
+    lock_dev(dev);
+
+    /* Null-pointer check */
+    rslt = null_ptr_check(dev);
+
+    if (rslt == BMI3_OK)
+    {
+        init_dev_state(dev);
+    }
+
+    if ((rslt == BMI3_OK) && (dev->boot_cfg != NULL) && (dev->boot_cfg->warm_start == BMI3_ENABLE))
+    {
+        /* Check whether the sensor kept its state over a reset of the host */
+        rslt = check_warm_start(dev);
+    }
+
+    if (rslt == BMI3_OK)
+    {
+        if (dev->warm_started == BMI3_DISABLE)
+        {
+            /* Perform soft-reset to bring all register values to their default values */
+            rslt = bmi3_soft_reset(dev);
+
+            /* The power-on reset flag is set by the soft-reset as well. It is cleared on read,
+             * so that the next warm start can tell whether the sensor lost power since
+             */
+            if ((rslt == BMI3_OK) && (dev->boot_cfg != NULL) && (dev->boot_cfg->warm_start == BMI3_ENABLE))
+            {
+                rslt = bmi3_get_regs(BMI3_REG_STATUS, status, 2, dev);
+            }
+        }
+
+        if (rslt == BMI3_OK)
+        {
+            /* Read chip-id of the BMI3 sensor */
+            rslt = bmi3_get_regs(BMI3_REG_CHIP_ID, chip_id, 2, dev);
+
+            if (rslt == BMI3_OK)
+            {
+                set_chip_id(chip_id, dev);
+            }
+        }
+    }
+
+    unlock_dev(dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API initializes the sensor with the variant matching its chip-id,
+ * with a single soft-reset.
+ */
+int8_t bmi3_probe_and_init(const struct bmi3_variant *const *variants, uint8_t n_variants, struct bmi3_dev *dev)
+{
+    /* Variable to store result of API */
+    int8_t rslt;
+
+    if (variants == NULL)
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
+    else
+    {
+        /* Soft-reset and chip-id read, done once whatever the number of variants */
+        rslt = bmi3_init(dev);
+    }
+
+    if (rslt == BMI3_OK)
+    {
+        rslt = select_variant(variants, n_variants, dev);
+    }
+
+    if (rslt == BMI3_OK)
+    {
+        rslt = setup_variant(dev);
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This API reads the data from the given register address of bmi3
+ * sensor.
+ *
+ * @note For most of the registers auto address increment applies, with the
+ * exception of a few special registers, which trap the address. For e.g.,
+ * Register address - 0x03.
+ */
+int8_t bmi3_get_regs(uint8_t reg_addr, uint8_t *data, uint16_t len, struct bmi3_dev *dev)
+{
+    /* Variable to store result of API */
+    int8_t rslt;
+
+    /* Variable to define temporary buffer */
+#ifdef BMI3_DEV_SCRATCH
+    uint8_t *temp_buf = NULL;
+#else
+    uint8_t temp_buf[BMI3_MAX_LEN];
+#endif
+
+    /* Variable to define loop */
+    uint16_t index = 0;
+
+    /* Variable to store whether the device is locked */
+    uint8_t locked = BMI3_DISABLE;
+
+    /* Null-pointer check */
+    rslt = null_ptr_check(dev);
+
+#ifdef BMI3_DEV_SCRATCH
+    if (rslt == BMI3_OK)
+    {
+        temp_buf = dev->scratch;
+    }
+
+    if ((rslt == BMI3_OK) && (data != NULL) && (temp_buf != NULL))
+#else
+    if ((rslt == BMI3_OK) && (data != NULL))
+#endif
+    {
+        /* Temporary buffer has to hold the data along with the dummy bytes */
+        if ((len + dev->dummy_byte) <= BMI3_MAX_LEN)
+        {
+            /* Cache is shared with other users of the device */
+            locked = dev->cache.enable;
+#ifdef BMI3_DEV_SCRATCH
+
+            /* So is the scratch buffer */
+            locked = BMI3_ENABLE;
+#endif
+
+            if (locked == BMI3_ENABLE)
+            {
+                lock_dev(dev);
+            }
+
+            /* Read from the sensor only if the data is not cached */
+            if (cache_read(reg_addr, data, len, dev) != BMI3_ENABLE)
+            {
+                rslt = cache_sync_feature_addr(reg_addr, dev);
+
+                if (rslt == BMI3_OK)
+                {
+                    rslt = bmi3_get_regs_direct(reg_addr, temp_buf, len, dev);
+                }
+
+                if (rslt == BMI3_OK)
+                {
+                    /* Read the data from the position next to dummy byte */
+                    while (index < len)
+                    {
+                        data[index] = temp_buf[index + dev->dummy_byte];
+                        index++;
+                    }
+
+                    cache_store(reg_addr, data, len, dev);
+                }
+            }
+
+            if (locked == BMI3_ENABLE)
+            {
+                unlock_dev(dev);
+            }
+        }
+        else
+        {
+            rslt = BMI3_E_INVALID_INPUT;
+        }
+    }
+    else
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This API reads the data from the given register address of bmi3
+ * sensor directly into the buffer of the user, along with the dummy bytes.
+ */
+int8_t bmi3_get_regs_direct(uint8_t reg_addr, uint8_t *data, uint16_t len, struct bmi3_dev *dev)
+{
+    /* Variable to store result of API */
+    int8_t rslt;
+
+    /* Null-pointer check */
+    rslt = null_ptr_check(dev);
+
+    if ((rslt == BMI3_OK) && (data != NULL))
+    {
+        rslt = read_regs_direct(reg_addr, data, len, dev->read, dev);
+    }
+    else
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This API writes data to the given register address of bmi3 sensor.
+ */
+int8_t bmi3_set_regs(uint8_t reg_addr, const uint8_t *data, uint16_t len, struct bmi3_dev *dev)
+{
+    /* Variable to store result of API */
+    int8_t rslt;
+
+    /* Variable to store number of retries */
+    uint8_t attempt = 0;
+
+#ifdef BMI3_BUS_STATS
+
+    /* Variable to store timestamp at the start of the transaction */
+    uint32_t start;
+#endif
+
+    /* Null-pointer check */
+    rslt = null_ptr_check(dev);
+
+    if ((rslt == BMI3_OK) && (data != NULL))
+    {
+        /* Configuring reg_addr for SPI Interface */
+        if (dev->intf == BMI3_SPI_INTF)
+        {
+            reg_addr = (reg_addr & BMI3_SPI_WR_MASK);
+        }
+
+        /* Cache is shared with other users of the device */
+        if (dev->cache.enable == BMI3_ENABLE)
+        {
+            lock_dev(dev);
+        }
+
+        do
+        {
+            /* Restore the transmission address if the previous access was served from the cache,
+             * or if it is lost by a failed transfer
+             */
+            rslt = cache_sync_feature_addr(reg_addr, dev);
+
+            if (rslt == BMI3_OK)
+            {
+                /* Insert the idle time if the previous access was a write */
+                insert_idle_time(dev);
+
+#ifdef BMI3_BUS_STATS
+                start = bus_stats_start(dev);
+#endif
+
+                dev->intf_rslt = dev->write(reg_addr, data, len, dev->intf_ptr);
+
+                /* Idle time is inserted only before the next access, if any */
+                dev->idle_due_us = get_idle_time(dev);
+                dev->idle_pending = BMI3_ENABLE;
+
+                /* Feature engine data differs from the last image written, if any */
+                if ((reg_addr == BMI3_REG_FEATURE_DATA_TX) || (reg_addr == BMI3_REG_CMD))
+                {
+                    dev->feature_image = NULL;
+                }
+
+                if (dev->intf_rslt != BMI3_INTF_RET_SUCCESS)
+                {
+                    rslt = BMI3_E_COM_FAIL;
+                }
+                else
+                {
+                    /* Write-through to the cache */
+                    cache_write(reg_addr, data, len, dev);
+                }
+
+#ifdef BMI3_BUS_STATS
+                bus_stats_record(reg_addr, BMI3_ENABLE, len, start, rslt, dev);
+#endif
+            }
+        } while ((rslt == BMI3_E_COM_FAIL) &&
+                 (retry_transfer(reg_addr, BMI3_ENABLE, attempt++, dev) == BMI3_ENABLE));
+
+        if ((rslt == BMI3_OK) && (attempt != 0))
+        {
+            dev->retry_stats.recovered++;
+        }
+
+        if (dev->cache.enable == BMI3_ENABLE)
+        {
+            unlock_dev(dev);
+        }
+    }
+    else
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This API resets bmi3 sensor. All registers are overwritten with
+ * their default values.
+ */
+int8_t bmi3_soft_reset(struct bmi3_dev *dev)
+{
+    /* Variable to store result of API */
+    int8_t rslt;
 
     /* Variable to read the dummy byte */
     uint8_t dummy_byte[2] = { 0 };
 
-    /* Variable to store feature data array */
-    uint8_t feature_data[2] = { 0x2c, 0x01 };
+    /* Variable to store feature data array */
+    uint8_t feature_data[2] = { 0x2c, 0x01 };
+
+    /* Variable to enable feature engine bit */
+    uint8_t feature_engine_en[2] = { BMI3_ENABLE, 0 };
+
+    /* Variable to store status value for feature engine enable */
+    uint8_t reg_data[2] = { 0 };
+
+    /* Array variable to store feature IO status */
+    uint8_t feature_io_status[2] = { BMI3_ENABLE, 0 };
+
+    /* Default boot configuration */
+    const struct bmi3_boot_cfg default_boot_cfg = {
+        BMI3_FEATURE_ENGINE_POLL_DELAY, BMI3_FEATURE_ENGINE_TIMEOUT, BMI3_ENABLE, BMI3_DISABLE
+    };
+
+    /* Boot configuration in use */
+    const struct bmi3_boot_cfg *boot_cfg = &default_boot_cfg;
+
+    /* Variable to store time elapsed while polling the feature engine status */
+    uint32_t elapsed = 0;
+
+    lock_dev(dev);
+
+    /* Null-pointer check */
+    rslt = null_ptr_check(dev);
+
+    if ((rslt == BMI3_OK) && (dev->boot_cfg != NULL))
+    {
+        boot_cfg = dev->boot_cfg;
+
+        if ((boot_cfg->feature_engine_en == BMI3_ENABLE) && (boot_cfg->poll_interval_us == 0))
+        {
+            rslt = BMI3_E_INVALID_INPUT;
+        }
+    }
+
+    if (rslt == BMI3_OK)
+    {
+        begin_batch(dev);
+
+        /* Reset bmi3 device */
+        rslt = bmi3_set_command_register(BMI3_CMD_SOFT_RESET, dev);
+        dev->delay_us(BMI3_SOFT_RESET_DELAY, dev->intf_ptr);
+
+        /* Performing a dummy read after a soft-reset */
+        if ((rslt == BMI3_OK) && (dev->intf == BMI3_SPI_INTF))
+        {
+            rslt = bmi3_get_regs(BMI3_REG_CHIP_ID, dummy_byte, 2, dev);
+        }
+
+        /* Enabling Feature engine, unless it is not required */
+        if ((rslt == BMI3_OK) && (boot_cfg->feature_engine_en == BMI3_ENABLE))
+        {
+            rslt = bmi3_set_regs(BMI3_REG_FEATURE_IO2, feature_data, 2, dev);
+
+            if (rslt == BMI3_OK)
+            {
+                /* Enabling feature status bit */
+                rslt = bmi3_set_regs(BMI3_REG_FEATURE_IO_STATUS, feature_io_status, 2, dev);
+            }
+
+            if (rslt == BMI3_OK)
+            {
+                /* Enable feature engine bit */
+                rslt = bmi3_set_regs(BMI3_REG_FEATURE_CTRL, feature_engine_en, 2, dev);
+            }
+
+            if (rslt == BMI3_OK)
+            {
+                /* Checking the status bit for feature engine enable */
+                do
+                {
+                    dev->delay_us(boot_cfg->poll_interval_us, dev->intf_ptr);
+
+                    rslt = bmi3_get_regs(BMI3_REG_FEATURE_IO1, reg_data, 2, dev);
+
+                    if (rslt == BMI3_OK)
+                    {
+                        if (reg_data[0] & BMI3_FEATURE_ENGINE_ENABLE_MASK)
+                        {
+                            rslt = BMI3_OK;
+
+                            break;
+                        }
+                        else
+                        {
+                            rslt = BMI3_E_FEATURE_ENGINE_STATUS;
+                        }
+                    }
+
+                    elapsed += boot_cfg->poll_interval_us;
+                } while (elapsed < boot_cfg->timeout_us);
+            }
+        }
+
+        rslt = end_batch(rslt, dev);
+    }
+
+    unlock_dev(dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API writes the available sensor specific commands to the sensor.
+ */
+int8_t bmi3_set_command_register(uint16_t command, struct bmi3_dev *dev)
+{
+    /* Variable to store result of API */
+    int8_t rslt;
+
+    /* Array variable to store command value */
+    uint8_t reg_data[2] = { 0 };
+
+    reg_data[0] = (uint8_t)(command & BMI3_SET_LOW_BYTE);
+    reg_data[1] = (uint8_t)((command & BMI3_SET_HIGH_BYTE) >> 8);
+
+    /* Set the command in the command register */
+    rslt = bmi3_set_regs(BMI3_REG_CMD, reg_data, 2, dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API gets the interrupt 1 status of both feature and data
+ * interrupts
+ */
+int8_t bmi3_get_int1_status(uint16_t *int_status, struct bmi3_dev *dev)
+{
+    /* Variable to store result of API */
+    int8_t rslt;
+
+    /* Array to store data */
+    uint8_t data_array[2] = { 0 };
+
+    if (int_status != NULL)
+    {
+        /* Get the interrupt status */
+        rslt = bmi3_get_regs(BMI3_REG_INT_STATUS_INT1, data_array, 2, dev);
+
+        if (rslt == BMI3_OK)
+        {
+            *int_status = (uint16_t)(data_array[0] | ((uint16_t)data_array[1] << 8));
+        }
+    }
+    else
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This API gets the interrupt 2 status of both feature and data
+ * interrupts
+ */
+int8_t bmi3_get_int2_status(uint16_t *int_status, struct bmi3_dev *dev)
+{
+    /* Variable to store result of API */
+    int8_t rslt;
+
+    /* Array to store data */
+    uint8_t data_array[2] = { 0 };
+
+    if (int_status != NULL)
+    {
+        /* Get the interrupt status */
+        rslt = bmi3_get_regs(BMI3_REG_INT_STATUS_INT2, data_array, 2, dev);
+
+        if (rslt == BMI3_OK)
+        {
+            *int_status = (uint16_t)(data_array[0] | ((uint16_t)data_array[1] << 8));
+        }
+    }
+    else
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This API initializes the interrupt dispatcher with no callback registered.
+ */
+int8_t bmi3_int_dispatch_init(uint8_t sources, void *ctx, struct bmi3_int_dispatcher *disp)
+{
+    /* Variable to store result of API */
+    int8_t rslt = BMI3_OK;
+
+    /* Variable to loop through the interrupt status bits */
+    uint8_t loop;
+
+    if (disp != NULL)
+    {
+        if ((sources != 0) && ((sources & ~BMI3_INT_SRC_ALL) == 0))
+        {
+            for (loop = 0; loop < BMI3_INT_STATUS_BIT_COUNT; loop++)
+            {
+                disp->callback[loop] = NULL;
+            }
+
+            disp->ctx = ctx;
+            disp->sources = sources;
+        }
+        else
+        {
+            rslt = BMI3_E_INVALID_INPUT;
+        }
+    }
+    else
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This API registers a callback for one or more interrupt status bits.
+ */
+int8_t bmi3_int_dispatch_register(uint16_t int_status,
+                                  bmi3_int_event_fptr_t callback,
+                                  struct bmi3_int_dispatcher *disp)
+{
+    /* Variable to store result of API */
+    int8_t rslt = BMI3_OK;
+
+    /* Variable to loop through the interrupt status bits */
+    uint8_t loop;
+
+    if (disp != NULL)
+    {
+        if (int_status != 0)
+        {
+            for (loop = 0; loop < BMI3_INT_STATUS_BIT_COUNT; loop++)
+            {
+                if (int_status & (UINT16_C(1) << loop))
+                {
+                    disp->callback[loop] = callback;
+                }
+            }
+        }
+        else
+        {
+            rslt = BMI3_E_INVALID_INPUT;
+        }
+    }
+    else
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This API reads the interrupt status and the payload of the fired
+ * interrupts, then calls the registered callbacks.
+ */
+int8_t bmi3_int_dispatch(struct bmi3_int_dispatcher *disp, struct bmi3_dev *dev)
+{
+    /* Variable to store result of API */
+    int8_t rslt;
+
+    /* Variable to store the interrupt status bits with a registered callback */
+    uint16_t registered;
+
+    /* Variable to store the interrupt status bits with a registered callback that fired */
+    uint16_t fired = 0;
+
+    rslt = null_ptr_check(dev);
+
+    if ((rslt == BMI3_OK) && (disp != NULL))
+    {
+        registered = get_registered_int_status(disp);
+
+        lock_dev(dev);
+
+        rslt = get_int_status_burst(registered, &fired, disp, dev);
+
+        if (rslt == BMI3_OK)
+        {
+            /* Payloads outside the burst are read only if their interrupt fired */
+            rslt = get_int_event_payload(fired,
+                                         BMI3_INT_STATUS_DRDY_ALL | BMI3_INT_STATUS_STEP_COUNTER,
+                                         disp,
+                                         dev);
+        }
+
+        unlock_dev(dev);
+
+        if (rslt == BMI3_OK)
+        {
+            call_int_callbacks(fired, disp);
+        }
+    }
+    else if (rslt == BMI3_OK)
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This API takes the IBI status delivered by the host controller in the
+ * in-band interrupt payload, reads the payload of the fired interrupts and
+ * calls the registered callbacks.
+ */
+int8_t bmi3_int_dispatch_ibi(uint16_t ibi_status, struct bmi3_int_dispatcher *disp, struct bmi3_dev *dev)
+{
+    /* Variable to store result of API */
+    int8_t rslt;
+
+    /* Variable to store the interrupt status bits with a registered callback that fired */
+    uint16_t fired;
+
+    rslt = null_ptr_check(dev);
+
+    if ((rslt == BMI3_OK) && (disp != NULL))
+    {
+        fired = ibi_status & get_registered_int_status(disp);
+
+        disp->data.int1_status = 0;
+        disp->data.int2_status = 0;
+        disp->data.ibi_status = ibi_status;
+
+        lock_dev(dev);
+
+        /* No status round-trip, only the payloads of the fired interrupts are read */
+        rslt = get_int_event_payload(fired, 0, disp, dev);
+
+        unlock_dev(dev);
+
+        if (rslt == BMI3_OK)
+        {
+            call_int_callbacks(fired, disp);
+        }
+    }
+    else if (rslt == BMI3_OK)
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This API maps the interrupt sources to the data and event pins of a route.
+ */
+int8_t bmi3_set_int_route(const struct bmi3_int_route *route, struct bmi3_dev *dev)
+{
+    /* Variable to store result of API */
+    int8_t rslt;
+
+    /* Array to store INT_MAP1 and INT_MAP2 */
+    uint8_t reg_data[4];
+
+    /* Variable to store the pins of all sources, 2 bits each in interrupt status bit order */
+    uint32_t map = 0;
+
+    /* Structure to define the latch mode */
+    struct bmi3_int_pin_config int_cfg = { 0 };
+
+    /* Variable to loop through the interrupt status bits */
+    uint8_t loop;
+
+    lock_dev(dev);
+
+    /* Null-pointer check */
+    rslt = null_ptr_check(dev);
+
+    if ((rslt == BMI3_OK) && (route == NULL))
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
+
+    if ((rslt == BMI3_OK) &&
+        (((route->data_pin != BMI3_INT1) && (route->data_pin != BMI3_INT2)) ||
+         (route->event_pin == BMI3_INT_NONE) || (route->event_pin >= BMI3_INT_PIN_MAX) ||
+         (route->event_pin == route->data_pin) || (route->data_status & ~BMI3_INT_STATUS_DATA_ALL) ||
+         (route->event_status & BMI3_INT_STATUS_DATA_ALL) || (route->int_latch > BMI3_INT_LATCH_EN)))
+    {
+        rslt = BMI3_E_INVALID_INPUT;
+    }
+
+    if (rslt == BMI3_OK)
+    {
+        /* Same layout as the fields of bmi3_map_interrupt */
+        for (loop = 0; loop < BMI3_INT_STATUS_BIT_COUNT; loop++)
+        {
+            if (route->data_status & (UINT16_C(1) << loop))
+            {
+                map |= (uint32_t)route->data_pin << (loop * BMI3_INT_MAP_BITS);
+            }
+            else if (route->event_status & (UINT16_C(1) << loop))
+            {
+                map |= (uint32_t)route->event_pin << (loop * BMI3_INT_MAP_BITS);
+            }
+        }
+
+        reg_data[0] = (uint8_t)map;
+        reg_data[1] = (uint8_t)(map >> 8);
+        reg_data[2] = (uint8_t)(map >> 16);
+        reg_data[3] = (uint8_t)(map >> 24);
+
+        int_cfg.int_latch = route->int_latch;
+
+        begin_batch(dev);
+
+        rslt = bmi3_set_regs(BMI3_REG_INT_MAP1, reg_data, 4, dev);
+
+        if (rslt == BMI3_OK)
+        {
+            rslt = set_latch_mode(&int_cfg, dev);
+        }
+
+        rslt = end_batch(rslt, dev);
+    }
+
+    unlock_dev(dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API initializes the dispatcher of the event pin of a route.
+ */
+int8_t bmi3_int_route_dispatch_init(const struct bmi3_int_route *route, void *ctx, struct bmi3_int_dispatcher *disp)
+{
+    /* Variable to store result of API */
+    int8_t rslt;
+
+    /* Variable to store the interrupt status register of the event pin */
+    uint8_t sources = 0;
+
+    if (route != NULL)
+    {
+        if (route->event_pin == BMI3_INT1)
+        {
+            sources = BMI3_INT_SRC_INT1;
+        }
+        else if (route->event_pin == BMI3_INT2)
+        {
+            sources = BMI3_INT_SRC_INT2;
+        }
+        else if (route->event_pin == BMI3_I3C_INT)
+        {
+            sources = BMI3_INT_SRC_IBI;
+        }
+
+        /* No source is rejected as invalid input */
+        rslt = bmi3_int_dispatch_init(sources, ctx, disp);
+    }
+    else
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This API services the data pin of a route.
+ */
+int8_t bmi3_int_route_service_data(const struct bmi3_int_route *route,
+                                   uint16_t *int_status,
+                                   struct bmi3_fifo_frame *fifo,
+                                   struct bmi3_dev *dev)
+{
+    /* Variable to store result of API */
+    int8_t rslt;
+
+    /* Array to store the interrupt status of the data pin */
+    uint8_t reg_data[2] = { 0 };
+
+    /* Variable to store FIFO configuration */
+    uint16_t fifo_config = 0;
+
+    /* Variable to store the FIFO sources to be served */
+    uint16_t fifo_status = 0;
+
+    lock_dev(dev);
+
+    /* Null-pointer check */
+    rslt = null_ptr_check(dev);
+
+    if ((rslt == BMI3_OK) && ((route == NULL) || (int_status == NULL) || (fifo == NULL) || (fifo->data == NULL)))
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
+
+    if (rslt == BMI3_OK)
+    {
+        *int_status = 0;
+        fifo->available_fifo_len = 0;
+        fifo_status = route->data_status & (BMI3_INT_STATUS_FWM | BMI3_INT_STATUS_FFULL);
+
+        if (route->int_latch == BMI3_INT_LATCH_EN)
+        {
+            /* Reading the status of the data pin only leaves the event pin latched */
+            rslt = bmi3_get_regs((route->data_pin == BMI3_INT1) ? BMI3_REG_INT_STATUS_INT1 : BMI3_REG_INT_STATUS_INT2,
+                                 reg_data,
+                                 2,
+                                 dev);
+
+            *int_status = (uint16_t)(reg_data[0] | ((uint16_t)reg_data[1] << 8)) & route->data_status;
+            fifo_status &= *int_status;
+        }
+    }
+
+    if ((rslt == BMI3_OK) && (fifo_status != 0))
+    {
+        rslt = bmi3_get_fifo_length(&fifo->available_fifo_len, dev);
+
+        if (rslt == BMI3_OK)
+        {
+            /* Served without bus access if the shadow register cache is enabled */
+            rslt = bmi3_get_fifo_config(&fifo_config, dev);
+        }
+
+        if (rslt == BMI3_OK)
+        {
+            rslt = read_available_fifo(fifo_config, fifo, dev);
+        }
+    }
+
+    unlock_dev(dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API gets the re-mapped x, y and z axes from the sensor and
+ * updates the values in the device structure.
+ *
+ * @note: XYZ axis denotes x = x, y = y, z = z
+ * Similarly,
+ *    YXZ, x = y, y = x, z = z
+ *
+ */
+int8_t bmi3_get_remap_axes(struct bmi3_axes_remap *remapped_axis, struct bmi3_dev *dev)
+{
+    /* Variable to store result of API */
+    int8_t rslt;
+
+    /* Array variable to get remapped axis data */
+    uint8_t remap_data[4];
+
+    /* Array variable to store base address of remap axis data */
+    uint8_t base_addr[2] = { BMI3_BASE_ADDR_AXIS_REMAP, 0 };
+
+    /* Variable to store axis remap data */
+    uint8_t reg_data;
+
+    lock_dev(dev);
+
+    if (remapped_axis != NULL)
+    {
+        /* Set the configuration to feature engine register */
+        rslt = bmi3_set_regs(BMI3_REG_FEATURE_DATA_ADDR, base_addr, 2, dev);
+
+        if (rslt == BMI3_OK)
+        {
+            /* Get the configuration from the feature engine register where axis
+             * re-mapping feature resides
+             */
+            rslt = bmi3_get_regs(BMI3_REG_FEATURE_DATA_TX, remap_data, 4, dev);
+
+            if (rslt == BMI3_OK)
+            {
+                reg_data = remap_data[0];
+
+                /* Get the re-mapped axis */
+                remapped_axis->axis_map = BMI3_GET_BIT_POS0(reg_data, BMI3_XYZ_AXIS);
+
+                /* Get the re-mapped x-axis polarity */
+                remapped_axis->invert_x = BMI3_GET_BITS(reg_data, BMI3_X_AXIS_SIGN);
+
+                /* Get the re-mapped y-axis polarity */
+                remapped_axis->invert_y = BMI3_GET_BITS(reg_data, BMI3_Y_AXIS_SIGN);
+
+                /* Get the re-mapped z-axis polarity */
+                remapped_axis->invert_z = BMI3_GET_BITS(reg_data, BMI3_Z_AXIS_SIGN);
+            }
+        }
+    }
+    else
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
+
+    unlock_dev(dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API sets the re-mapped x, y and z axes to the sensor and
+ * updates them in the device structure.
+ */
+int8_t bmi3_set_remap_axes(const struct bmi3_axes_remap remapped_axis, struct bmi3_dev *dev)
+{
+    /* Variable to store result of API */
+    int8_t rslt;
+
+    /* Structure instance of sensor config */
+    struct bmi3_sens_config config = { 0 };
+
+    /* Variable to define the register address */
+    uint8_t base_addr[2] = { BMI3_BASE_ADDR_AXIS_REMAP, 0 };
+
+    /* Array variable to get remapped axis data */
+    uint8_t remap_data[4] = { 0 };
+
+    lock_dev(dev);
+
+    /* Set the configuration to feature engine register */
+    rslt = bmi3_set_regs(BMI3_REG_FEATURE_DATA_ADDR, base_addr, 2, dev);
+
+    if (rslt == BMI3_OK)
+    {
+        pack_remap_word(&remapped_axis, remap_data);
+
+        /* Set the configuration back to the page */
+        rslt = bmi3_set_regs(BMI3_REG_FEATURE_DATA_TX, remap_data, 2, dev);
+
+        if (rslt == BMI3_OK)
+        {
+            rslt = axes_remap_acc_power_mode_status(config, dev);
+        }
+    }
+
+    unlock_dev(dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API stages an axis remap.
+ */
+int8_t bmi3_prepare_remap_axes(const struct bmi3_axes_remap *remapped_axis, struct bmi3_remap_stage *stage)
+{
+    /* Variable to store result of API */
+    int8_t rslt = BMI3_OK;
+
+    if ((remapped_axis != NULL) && (stage != NULL))
+    {
+        stage->remap = *remapped_axis;
+        stage->word[0] = 0;
+        stage->word[1] = 0;
+
+        pack_remap_word(remapped_axis, stage->word);
+    }
+    else
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This API applies a staged axis remap with the least disturbance of
+ * the accel.
+ */
+int8_t bmi3_apply_remap_axes(const struct bmi3_remap_stage *stage, struct bmi3_dev *dev)
+{
+    /* Variable to store result of API */
+    int8_t rslt;
+
+    /* Array to store the axis remap word of the sensor */
+    uint8_t remap_data[2] = { 0 };
+
+    /* Arrays to store the accel configuration and the one with accel disabled */
+    uint8_t acc_conf[2] = { 0 };
+    uint8_t acc_off[2];
+
+    /* Variable to store interrupt status */
+    uint16_t int_status;
+
+    /* Variable to define feature engine errors */
+    uint8_t feature_engine_err_reg_lsb, feature_engine_err_reg_msb;
+
+    /* Variable to define loop */
+    uint8_t index;
+
+    /* Variable to store whether the accel is enabled */
+    uint8_t acc_on;
+
+    lock_dev(dev);
+
+    /* Null-pointer check */
+    rslt = null_ptr_check(dev);
+
+    if ((rslt == BMI3_OK) && (stage != NULL))
+    {
+        /* Served from the shadow register cache if it is enabled */
+        rslt = get_feature_words(BMI3_BASE_ADDR_AXIS_REMAP, remap_data, 2, dev);
+
+        if ((rslt == BMI3_OK) && ((remap_data[0] != stage->word[0]) || (remap_data[1] != stage->word[1])))
+        {
+            rslt = bmi3_get_regs(BMI3_REG_ACC_CONF, acc_conf, 2, dev);
+            acc_on = (acc_conf[1] & (BMI3_ACC_MODE_MASK >> 8)) ? BMI3_ENABLE : BMI3_DISABLE;
+
+            /* Axis remap is only taken over while the accel is disabled */
+            acc_off[0] = acc_conf[0];
+            acc_off[1] = (uint8_t)(acc_conf[1] & ~(BMI3_ACC_MODE_MASK >> 8));
+
+            begin_batch(dev);
+
+            if (rslt == BMI3_OK)
+            {
+                rslt = set_feature_words(BMI3_BASE_ADDR_AXIS_REMAP, stage->word, 2, dev);
+            }
+
+            if ((rslt == BMI3_OK) && (acc_on == BMI3_ENABLE))
+            {
+                rslt = bmi3_set_regs(BMI3_REG_ACC_CONF, acc_off, 2, dev);
+            }
+
+            if (rslt == BMI3_OK)
+            {
+                rslt = bmi3_set_command_register(BMI3_CMD_AXIS_MAP_UPDATE, dev);
+            }
+
+            rslt = end_batch(rslt, dev);
+
+            if ((rslt == BMI3_OK) && (acc_on == BMI3_ENABLE))
+            {
+                for (index = 0; index < BMI3_REMAP_APPLY_POLLS; index++)
+                {
+                    dev->delay_us(BMI3_REMAP_APPLY_POLL_US, dev->intf_ptr);
+
+                    rslt = bmi3_get_feature_engine_error_status(&feature_engine_err_reg_lsb,
+                                                                &feature_engine_err_reg_msb,
+                                                                dev);
+
+                    if ((rslt != BMI3_OK) ||
+                        ((feature_engine_err_reg_lsb & BMI3_NO_ERROR_MASK) &&
+                         (feature_engine_err_reg_msb & (BMI3_AXIS_MAP_COMPLETE_MASK >> 8))))
+                    {
+                        break;
+                    }
+                }
+
+                if (rslt == BMI3_OK)
+                {
+                    /* Clearing status registers by reading it, before powering up accelerometer */
+                    rslt = bmi3_get_int1_status(&int_status, dev);
+                }
+
+                if (rslt == BMI3_OK)
+                {
+                    rslt = bmi3_set_regs(BMI3_REG_ACC_CONF, acc_conf, 2, dev);
+                }
+            }
+        }
+    }
+    else if (rslt == BMI3_OK)
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
+
+    unlock_dev(dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API sets the sensor/feature configuration.
+ */
+int8_t bmi3_set_sensor_config(struct bmi3_sens_config *sens_cfg, uint8_t n_sens, struct bmi3_dev *dev)
+{
+    /* Variable to store result of API */
+    int8_t rslt;
+
+    /* Variable to store result of feature engine writes */
+    int8_t flush_rslt;
+
+    /* Variable to define loop */
+    uint8_t loop;
+
+    /* Structure to collect the feature configurations, so that adjacent ones are written at once */
+    struct bmi3_feature_batch batch;
+
+    lock_dev(dev);
+
+    /* Null-pointer check */
+    rslt = null_ptr_check(dev);
+
+    if ((rslt == BMI3_OK) && (sens_cfg != NULL))
+    {
+        batch.dirty = 0;
+
+        for (loop = 0; loop < n_sens; loop++)
+        {
+            switch (sens_cfg[loop].type)
+            {
+                case BMI3_ACCEL:
+                    rslt = set_accel_config(&sens_cfg[loop].cfg.acc, dev);
+
+                    if (rslt == BMI3_OK)
+                    {
+                        set_unit_scale(BMI3_ACCEL, sens_cfg[loop].cfg.acc.range, dev);
+                    }
+
+                    break;
+
+                case BMI3_GYRO:
+                    rslt = set_gyro_config(&sens_cfg[loop].cfg.gyr, dev);
+
+                    if (rslt == BMI3_OK)
+                    {
+                        set_unit_scale(BMI3_GYRO, sens_cfg[loop].cfg.gyr.range, dev);
+                    }
+
+                    break;
+
+                case BMI3_ALT_ACCEL:
+                    rslt = set_alternate_accel_config(&sens_cfg[loop].cfg.alt_acc, dev);
+                    break;
+
+                case BMI3_ALT_GYRO:
+                    rslt = set_alternate_gyro_config(&sens_cfg[loop].cfg.alt_gyr, dev);
+                    break;
+
+                default:
+                    rslt = pack_feature_config(&sens_cfg[loop], &batch, dev);
+                    break;
+            }
+
+            /* Return error if any of the get sensor data fails */
+            if (rslt != BMI3_OK)
+            {
+                break;
+            }
+        }
+
+        /* Write the feature configurations set before any failure */
+        flush_rslt = flush_feature_batch(&batch, dev);
+
+        if (rslt == BMI3_OK)
+        {
+            rslt = flush_rslt;
+        }
+
+        if (rslt == BMI3_OK)
+        {
+            rslt = retune_fifo_wm(sens_cfg, n_sens, dev);
+        }
+    }
+    else
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
+
+    unlock_dev(dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API gets the sensor/feature configuration.
+ */
+int8_t bmi3_get_sensor_config(struct bmi3_sens_config *sens_cfg, uint8_t n_sens, struct bmi3_dev *dev)
+{
+    /* Variable to store result of API */
+    int8_t rslt;
+
+    /* Variable to define loop */
+    uint8_t loop = 0;
+
+    /* Feature engine words of the features in the list, read at once */
+    struct bmi3_feature_batch batch;
+
+    /* Words of a feature */
+    uint8_t base_addr = 0;
+    uint8_t n_words = 0;
+
+    lock_dev(dev);
+
+    /* Null-pointer check */
+    rslt = null_ptr_check(dev);
+
+    if ((rslt == BMI3_OK) && (sens_cfg != NULL))
+    {
+        rslt = get_feature_config_words(sens_cfg, n_sens, &batch, dev);
+
+        for (loop = 0; (loop < n_sens) && (rslt == BMI3_OK); loop++)
+        {
+            if ((batch.dirty != 0) && (get_feature_span(sens_cfg[loop].type, &base_addr, &n_words) == BMI3_OK))
+            {
+                rslt = unpack_feature_config(&batch, &sens_cfg[loop]);
+            }
+            else
+            {
+                switch (sens_cfg[loop].type)
+                {
+                    case BMI3_ACCEL:
+                        rslt = get_accel_config(&sens_cfg[loop].cfg.acc, dev);
+                        break;
+
+                    case BMI3_GYRO:
+                        rslt = get_gyro_config(&sens_cfg[loop].cfg.gyr, dev);
+                        break;
+
+                    case BMI3_ALT_ACCEL:
+                        rslt = get_alternate_accel_config(&sens_cfg[loop].cfg.alt_acc, dev);
+                        break;
+
+                    case BMI3_ALT_GYRO:
+                        rslt = get_alternate_gyro_config(&sens_cfg[loop].cfg.alt_gyr, dev);
+                        break;
+
+                    default:
+                        rslt = get_feature_config(&sens_cfg[loop], dev);
+                        break;
+                }
+            }
+        }
+    }
+    else
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
+
+    unlock_dev(dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API encodes the feature configurations into a feature engine image.
+ */
+int8_t bmi3_get_feature_image(const struct bmi3_sens_config *sens_cfg,
+                              uint8_t n_sens,
+                              struct bmi3_feature_batch *image)
+{
+    /* Variable to store result of API */
+    int8_t rslt = BMI3_OK;
+
+    /* Variable to define loop */
+    uint8_t loop;
+
+    if ((sens_cfg != NULL) && (image != NULL))
+    {
+        image->dirty = 0;
+
+        for (loop = 0; (loop < n_sens) && (rslt == BMI3_OK); loop++)
+        {
+            rslt = pack_feature_config(&sens_cfg[loop], image, NULL);
+        }
+    }
+    else
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This API writes a feature engine image, only the words which differ
+ * with the image written before.
+ */
+int8_t bmi3_set_feature_image(const struct bmi3_feature_batch *image, struct bmi3_dev *dev)
+{
+    /* Variable to store result of API */
+    int8_t rslt;
+
+    /* Structure to collect the words to be written */
+    struct bmi3_feature_batch batch;
+
+    lock_dev(dev);
+
+    /* Null-pointer check */
+    rslt = null_ptr_check(dev);
+
+    if ((rslt == BMI3_OK) && (image != NULL))
+    {
+        batch = *image;
+
+        /* Words of the image on the sensor are skipped */
+        skip_unchanged_words(dev->feature_image, &batch);
+
+        begin_batch(dev);
+        rslt = flush_feature_batch(&batch, dev);
+        rslt = end_batch(rslt, dev);
+
+        if (rslt == BMI3_OK)
+        {
+            dev->feature_image = image;
+        }
+    }
+    else if (rslt == BMI3_OK)
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
+
+    unlock_dev(dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API reads the configurations of all features into a feature engine image.
+ */
+int8_t bmi3_read_feature_image(struct bmi3_feature_batch *image, struct bmi3_dev *dev)
+{
+    /* Variable to store result of API */
+    int8_t rslt;
+
+    lock_dev(dev);
+
+    /* Null-pointer check */
+    rslt = null_ptr_check(dev);
+
+    if ((rslt == BMI3_OK) && (image != NULL))
+    {
+        image->dirty = 0;
+
+        rslt = get_feature_words(BMI3_BASE_ADDR_AXIS_REMAP,
+                                 &image->data[BMI3_BASE_ADDR_AXIS_REMAP * 2],
+                                 (uint16_t)((BMI3_FEATURE_BATCH_MAX_WORDS - BMI3_BASE_ADDR_AXIS_REMAP) * 2),
+                                 dev);
+
+        if (rslt == BMI3_OK)
+        {
+            image->dirty = BMI3_CONFIG_IMAGE_FEATURE_MASK;
+        }
+    }
+    else if (rslt == BMI3_OK)
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
+
+    unlock_dev(dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API decodes the feature configurations from a feature engine image.
+ */
+int8_t bmi3_decode_feature_image(const struct bmi3_feature_batch *image,
+                                 struct bmi3_sens_config *sens_cfg,
+                                 uint8_t n_sens)
+{
+    /* Variable to store result of API */
+    int8_t rslt = BMI3_OK;
+
+    /* Variable to define loop */
+    uint8_t loop;
+
+    if ((image != NULL) && (sens_cfg != NULL))
+    {
+        for (loop = 0; (loop < n_sens) && (rslt == BMI3_OK); loop++)
+        {
+            rslt = unpack_feature_config(image, &sens_cfg[loop]);
+        }
+    }
+    else
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This API maps/un-maps data interrupts to that of interrupt pins.
+ */
+int8_t bmi3_map_interrupt(struct bmi3_map_int map_int, struct bmi3_dev *dev)
+{
+    /* Variable to store result of API */
+    int8_t rslt;
+
+    /* Variable to store register data */
+    uint8_t reg_data[4] = { 0 };
+    uint16_t temp_value = 0;
+
+    lock_dev(dev);
+    begin_batch(dev);
+
+    /* Read interrupt map1 and map2 and register */
+    rslt = bmi3_get_regs(BMI3_REG_INT_MAP1, reg_data, 4, dev);
+
+    if (rslt == BMI3_OK)
+    {
+        reg_data[0] = BMI3_SET_BIT_POS0(reg_data[0], BMI3_NO_MOTION_OUT, map_int.no_motion_out);
+        reg_data[0] = BMI3_SET_BITS(reg_data[0], BMI3_ANY_MOTION_OUT, map_int.any_motion_out);
+        reg_data[0] = BMI3_SET_BITS(reg_data[0], BMI3_FLAT_OUT, map_int.flat_out);
+        reg_data[0] = BMI3_SET_BITS(reg_data[0], BMI3_ORIENTATION_OUT, map_int.orientation_out);
+
+        temp_value = (uint16_t)(reg_data[1]) << 8;
+        temp_value = BMI3_SET_BITS(temp_value, BMI3_STEP_DETECTOR_OUT, map_int.step_detector_out);
+        temp_value = BMI3_SET_BITS(temp_value, BMI3_STEP_COUNTER_OUT, map_int.step_counter_out);
+        temp_value = BMI3_SET_BITS(temp_value, BMI3_SIG_MOTION_OUT, map_int.sig_motion_out);
+        temp_value = BMI3_SET_BITS(temp_value, BMI3_TILT_OUT, map_int.tilt_out);
+        reg_data[1] = (uint8_t)(temp_value >> 8);
+
+        reg_data[2] = BMI3_SET_BIT_POS0(reg_data[2], BMI3_TAP_OUT, map_int.tap_out);
+        reg_data[2] = BMI3_SET_BITS(reg_data[2], BMI3_I3C_OUT, map_int.i3c_out);
+        reg_data[2] = BMI3_SET_BITS(reg_data[2], BMI3_ERR_STATUS, map_int.err_status);
+        reg_data[2] = BMI3_SET_BITS(reg_data[2], BMI3_TEMP_DRDY_INT, map_int.temp_drdy_int);
+
+        temp_value = (uint16_t)(reg_data[3]) << 8;
+        temp_value = BMI3_SET_BITS(temp_value, BMI3_GYR_DRDY_INT, map_int.gyr_drdy_int);
+        temp_value = BMI3_SET_BITS(temp_value, BMI3_ACC_DRDY_INT, map_int.acc_drdy_int);
+        temp_value = BMI3_SET_BITS(temp_value, BMI3_FIFO_WATERMARK_INT, map_int.fifo_watermark_int);
+        temp_value = BMI3_SET_BITS(temp_value, BMI3_FIFO_FULL_INT, map_int.fifo_full_int);
+        reg_data[3] = (uint8_t)(temp_value >> 8);
+
+        rslt = bmi3_set_regs(BMI3_REG_INT_MAP1, reg_data, 4, dev);
+    }
+
+    rslt = end_batch(rslt, dev);
+    unlock_dev(dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API selects the sensors/features to be enabled or disabled.
+ */
+int8_t bmi3_select_sensor(struct bmi3_feature_enable *enable, struct bmi3_dev *dev)
+{
+    /* Variable to store result of API */
+    int8_t rslt;
+
+    if (enable != NULL)
+    {
+        rslt = set_feature_enable(enable, dev);
+
+        if (rslt == BMI3_OK)
+        {
+            rslt = get_feature_enable(enable, dev);
+        }
+    }
+    else
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
+
+    return rslt;
+}
+
+/*!
+ * @details This API gets the sensor data such as accel, gyro, temperature, sensor time, saturation flags
+ * and interrupt status
+ */
+int8_t bmi3_read_reg_data(uint8_t *reg_data, struct bmi3_dev *dev)
+{
+    /* Variable to store result of API */
+    int8_t rslt;
+
+    rslt = bmi3_get_regs(BMI3_REG_ACC_DATA_X, reg_data, BMI3_READ_REG_DATA_LEN, dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API gets the sensor/feature data for accelerometer, gyroscope,
+ * step counter, orientation, i3c sync accel, i3c sync gyro and i3c sync temperature.
+ */
+int8_t bmi3_get_sensor_data(struct bmi3_sensor_data *sensor_data, uint8_t n_sens, struct bmi3_dev *dev)
+{
+    /* Variable to store result of API */
+    int8_t rslt;
+
+    /* Null-pointer check */
+    rslt = null_ptr_check(dev);
+
+    if ((rslt == BMI3_OK) && (sensor_data != NULL))
+    {
+        rslt = get_sensor_data(sensor_data, n_sens, dev);
+    }
+    else
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This API gets the sensor/feature data without checking the device.
+ */
+int8_t bmi3_get_sensor_data_fast(struct bmi3_sensor_data *sensor_data, uint8_t n_sens, struct bmi3_dev *dev)
+{
+    /* Variable to store result of API */
+    int8_t rslt;
+
+    rslt = get_sensor_data(sensor_data, n_sens, dev);
+
+    return rslt;
+}
+
+/*!
+ *  @brief This API reads the error status from the sensor.
+ */
+int8_t bmi3_get_error_status(struct bmi3_err_reg *err_reg, struct bmi3_dev *dev)
+{
+    /* Variable to store result of API */
+    int8_t rslt;
+
+    /* Array variable to get error status from register */
+    uint8_t data[2] = { 0 };
+
+    if (err_reg != NULL)
+    {
+        /* Read the error codes */
+        rslt = bmi3_get_regs(BMI3_REG_ERR_REG, data, 2, dev);
+
+        if (rslt == BMI3_OK)
+        {
+            unpack_err_reg(data, err_reg);
+        }
+    }
+    else
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
+
+    return rslt;
+}
+
+/*!
+ *  @brief This API reads the feature engine error status from the sensor.
+ */
+int8_t bmi3_get_feature_engine_error_status(uint8_t *feature_engine_err_reg_lsb,
+                                            uint8_t *feature_engine_err_reg_msb,
+                                            struct bmi3_dev *dev)
+{
+    /* Variable to store result of API */
+    int8_t rslt;
+
+    /* Array variable to get error status from register */
+    uint8_t data[2];
+
+    if ((feature_engine_err_reg_lsb != NULL) && (feature_engine_err_reg_msb != NULL))
+    {
+        /* Read the feature engine error codes */
+        rslt = bmi3_get_regs(BMI3_REG_FEATURE_IO1, data, 2, dev);
+        if (rslt == BMI3_OK)
+        {
+            *feature_engine_err_reg_lsb = data[0];
+
+            *feature_engine_err_reg_msb = data[1];
+        }
+    }
+    else
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This API sets:
+ *        1) The output configuration of the selected interrupt pin:
+ *           INT1 or INT2.
+ *        2) The interrupt mode: permanently latched or non-latched.
+ */
+int8_t bmi3_set_int_pin_config(const struct bmi3_int_pin_config *int_cfg, struct bmi3_dev *dev)
+{
+    /* Variable to store result of API */
+    int8_t rslt;
+
+    /* Variable to define data array */
+    uint8_t data_array[3] = { 0 };
+
+    /* Variable to store register data */
+    uint16_t reg_data = 0;
+
+    /* Variable to define type of interrupt pin  */
+    uint8_t int_pin = 0;
+
+    lock_dev(dev);
+
+    /* Null-pointer check */
+    rslt = null_ptr_check(dev);
+    begin_batch(dev);
+
+    if ((rslt == BMI3_OK) && (int_cfg != NULL))
+    {
+        /* Copy the pin type to a local variable */
+        int_pin = int_cfg->pin_type;
+
+        if ((int_pin > BMI3_INT_NONE) && (int_pin < BMI3_INT_PIN_MAX))
+        {
+            /* Get the previous configuration data */
+            rslt = bmi3_get_regs(BMI3_REG_IO_INT_CTRL, data_array, 3, dev);
+
+            if (rslt == BMI3_OK)
+            {
+                /* Set interrupt pin 1 configuration */
+                if (int_pin == BMI3_INT1)
+                {
+                    reg_data = data_array[0];
+
+                    /* Configure active low or high */
+                    reg_data = BMI3_SET_BIT_POS0(reg_data, BMI3_INT1_LVL, int_cfg->pin_cfg[0].lvl);
+
+                    /* Configure push-pull or open drain */
+                    reg_data = BMI3_SET_BITS(reg_data, BMI3_INT1_OD, int_cfg->pin_cfg[0].od);
+
+                    /* Configure output enable */
+                    reg_data = BMI3_SET_BITS(reg_data, BMI3_INT1_OUTPUT_EN, int_cfg->pin_cfg[0].output_en);
+
+                    /* Copy the data to be written in the respective array */
+                    data_array[0] = (uint8_t)(reg_data & 0xFF);
+                }
+
+                /* Set interrupt pin 2 configuration */
+                if (int_pin == BMI3_INT2)
+                {
+                    reg_data = ((uint16_t)data_array[1] << 8);
+
+                    /* Configure active low or high */
+                    reg_data = BMI3_SET_BITS(reg_data, BMI3_INT2_LVL, int_cfg->pin_cfg[1].lvl);
+
+                    /* Configure push-pull or open drain */
+                    reg_data = BMI3_SET_BITS(reg_data, BMI3_INT2_OD, int_cfg->pin_cfg[1].od);
+
+                    /* Configure output enable */
+                    reg_data = BMI3_SET_BITS(reg_data, BMI3_INT2_OUTPUT_EN, int_cfg->pin_cfg[1].output_en);
+
+                    /* Copy the data to be written in the respective array */
+                    data_array[1] = (uint8_t)(reg_data >> 8);
+                }
+
+                /* Set the configurations simultaneously as
+                 * INT1_IO_CTRL, INT2_IO_CTRL, and INT_LATCH lie
+                 * in consecutive addresses
+                 */
+                rslt = bmi3_set_regs(BMI3_REG_IO_INT_CTRL, data_array, 2, dev);
+
+                if (rslt == BMI3_OK)
+                {
+                    rslt = set_latch_mode(int_cfg, dev);
+                }
+            }
+        }
+        else
+        {
+            rslt = BMI3_E_INVALID_INT_PIN;
+        }
+    }
+    else
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
+
+    rslt = end_batch(rslt, dev);
+    unlock_dev(dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API gets:
+ *        1) The output configuration of the selected interrupt pin:
+ *           INT1 or INT2.
+ *        2) The interrupt mode: permanently latched or non-latched.
+ */
+int8_t bmi3_get_int_pin_config(struct bmi3_int_pin_config *int_cfg, struct bmi3_dev *dev)
+{
+    /* Variable to store result of API */
+    int8_t rslt;
+
+    /* Variable to define data array */
+    uint8_t data_array[3] = { 0 };
+
+    /* Variable to define type of interrupt pin  */
+    uint8_t int_pin = 0;
+
+    uint16_t reg_data;
+
+    if (int_cfg != NULL)
+    {
+        /* Copy the pin type to a local variable */
+        int_pin = int_cfg->pin_type;
+
+        /* Get the previous configuration data */
+        rslt = bmi3_get_regs(BMI3_REG_IO_INT_CTRL, data_array, 3, dev);
+
+        if (rslt == BMI3_OK)
+        {
+            /* Get interrupt pin 1 configuration */
+            if (int_pin == BMI3_INT1)
+            {
+                /* Get active low or high */
+                int_cfg->pin_cfg[0].lvl = BMI3_GET_BIT_POS0(data_array[0], BMI3_INT1_LVL);
+
+                /* Get push-pull or open drain */
+                int_cfg->pin_cfg[0].od = BMI3_GET_BITS(data_array[0], BMI3_INT1_OD);
+
+                /* Get output enable */
+                int_cfg->pin_cfg[0].output_en = BMI3_GET_BITS(data_array[0], BMI3_INT1_OUTPUT_EN);
+            }
+
+            /* Get interrupt pin 2 configuration */
+            if (int_pin == BMI3_INT2)
+            {
+                reg_data = ((uint16_t)data_array[1] << 8);
+
+                /* Get active low or high */
+                int_cfg->pin_cfg[1].lvl = BMI3_GET_BITS(reg_data, BMI3_INT2_LVL);
+
+                /* Get push-pull or open drain */
+                int_cfg->pin_cfg[1].od = BMI3_GET_BITS(reg_data, BMI3_INT2_OD);
+
+                /* Get output enable */
+                int_cfg->pin_cfg[1].output_en = BMI3_GET_BITS(reg_data, BMI3_INT2_OUTPUT_EN);
+            }
+
+            rslt = get_latch_mode(int_cfg, dev);
+        }
+    }
+    else
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This API is used to get the sensor time.
+ */
+int8_t bmi3_get_sensor_time(uint32_t *sensor_time, struct bmi3_dev *dev)
+{
+    /* Variable to store result of API */
+    int8_t rslt;
+
+    uint8_t reg_data[4] = { 0 };
+
+    if (sensor_time != NULL)
+    {
+        rslt = bmi3_get_regs(BMI3_REG_SENSOR_TIME_0, reg_data, 4, dev);
+        if (rslt == BMI3_OK)
+        {
+            *sensor_time =
+                (uint32_t)(reg_data[0] | (uint32_t)reg_data[1] << 8 | (uint32_t)reg_data[2] << 16 |
+                           (uint32_t)reg_data[3] <<
+                    24);
+        }
+    }
+    else
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This API reads the FIFO data.
+ */
+int8_t bmi3_read_fifo_data(struct bmi3_fifo_frame *fifo, struct bmi3_dev *dev)
+{
+    /* Variable to store result of API */
+    int8_t rslt;
+
+    /* Array to store FIFO configuration data */
+    uint8_t config_data[2] = { 0 };
+
+    lock_dev(dev);
+
+    /* Null-pointer check */
+    if (fifo != NULL)
+    {
+        /* Get the set FIFO frame configurations */
+        rslt = bmi3_get_regs(BMI3_REG_FIFO_CONF, config_data, 2, dev);
+
+        if (rslt == BMI3_OK)
+        {
+            /* Get sensor enable status, of which the data is to be read */
+            fifo->available_fifo_sens =
+                (uint16_t)(((config_data[0]) | ((uint16_t) config_data[1] << 8)) & BMI3_FIFO_ALL_EN);
+
+            /* Select the frame layout once, so that parsing needs no further configuration checks */
+            fifo->layout = get_fifo_frame_layout(fifo->available_fifo_sens);
+
+            /* Length includes the dummy bytes, which are read in front of the FIFO data */
+            if (fifo->length > dev->dummy_byte)
+            {
+                rslt = read_regs_direct(BMI3_REG_FIFO_DATA,
+                                        fifo->data,
+                                        (uint16_t)(fifo->length - dev->dummy_byte),
+                                        get_fifo_read(dev),
+                                        dev);
+            }
+            else
+            {
+                rslt = BMI3_E_COM_FAIL;
+            }
+        }
+    }
+    else
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
+
+    unlock_dev(dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API reads the FIFO data with the FIFO configuration of the
+ * previous read and without checking the device.
+ */
+int8_t bmi3_read_fifo_data_fast(struct bmi3_fifo_frame *fifo, struct bmi3_dev *dev)
+{
+    /* Variable to store result of API */
+    int8_t rslt = BMI3_E_COM_FAIL;
+
+    lock_dev(dev);
+
+    /* Length includes the dummy bytes, which are read in front of the FIFO data */
+    if (fifo->length > dev->dummy_byte)
+    {
+        rslt = read_regs_direct(BMI3_REG_FIFO_DATA,
+                                fifo->data,
+                                (uint16_t)(fifo->length - dev->dummy_byte),
+                                get_fifo_read(dev),
+                                dev);
+    }
+
+    unlock_dev(dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API parses and extracts the accelerometer frames from FIFO data
+ * read by the "bmi3_read_fifo_data" API and stores it in the "accel_data"
+ * structure instance.
+ */
+int8_t bmi3_extract_accel(struct bmi3_fifo_sens_axes_data *accel_data,
+                          struct bmi3_fifo_frame *fifo,
+                          const struct bmi3_dev *dev)
+{
+    /* Variable to store result of API */
+    int8_t rslt;
+
+    rslt = null_ptr_check(dev);
+
+    /* Null-pointer check */
+    if ((rslt == BMI3_OK) && (accel_data != NULL) && (fifo != NULL))
+    {
+        /* Parse only the accelerometer frames */
+        rslt = parse_fifo_frames(accel_data, NULL, NULL, fifo, dev);
+    }
+    else
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This API parses and extracts the accelerometer frames from FIFO data
+ * without checking the arguments.
+ */
+int8_t bmi3_extract_accel_fast(struct bmi3_fifo_sens_axes_data *accel_data,
+                               struct bmi3_fifo_frame *fifo,
+                               const struct bmi3_dev *dev)
+{
+    /* Variable to store result of API */
+    int8_t rslt;
+
+    rslt = parse_fifo_frames(accel_data, NULL, NULL, fifo, dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API parses and extracts the temperature frames from FIFO data
+ * read by the "bmi3_read_fifo_data" API and stores it in the "temp_data"
+ * structure instance.
+ */
+int8_t bmi3_extract_temperature(struct bmi3_fifo_temperature_data *temp_data,
+                                struct bmi3_fifo_frame *fifo,
+                                const struct bmi3_dev *dev)
+{
+    /* Variable to store result of API */
+    int8_t rslt;
+
+    rslt = null_ptr_check(dev);
+
+    /* Null-pointer check */
+    if ((rslt == BMI3_OK) && (temp_data != NULL) && (fifo != NULL))
+    {
+        /* Parse only the temperature frames */
+        rslt = parse_fifo_frames(NULL, NULL, temp_data, fifo, dev);
+    }
+    else
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This API parses and extracts the gyro frames from FIFO data
+ * read by the "bmi3_read_fifo_data" API and stores it in the "gyro_data"
+ * structure instance.
+ */
+int8_t bmi3_extract_gyro(struct bmi3_fifo_sens_axes_data *gyro_data,
+                         struct bmi3_fifo_frame *fifo,
+                         const struct bmi3_dev *dev)
+{
+    /* Variable to store result of API */
+    int8_t rslt;
+
+    rslt = null_ptr_check(dev);
+
+    /* Null-pointer check */
+    if ((rslt == BMI3_OK) && (gyro_data != NULL) && (fifo != NULL))
+    {
+        /* Parse only the gyro frames */
+        rslt = parse_fifo_frames(NULL, gyro_data, NULL, fifo, dev);
+    }
+    else
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This API parses and extracts the gyro frames from FIFO data
+ * without checking the arguments.
+ */
+int8_t bmi3_extract_gyro_fast(struct bmi3_fifo_sens_axes_data *gyro_data,
+                              struct bmi3_fifo_frame *fifo,
+                              const struct bmi3_dev *dev)
+{
+    /* Variable to store result of API */
+    int8_t rslt;
+
+    rslt = parse_fifo_frames(NULL, gyro_data, NULL, fifo, dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API parses and extracts the accelerometer, gyro and temperature
+ * frames from FIFO data read by the "bmi3_read_fifo_data" API in a single pass
+ * and stores them in the "accel_data", "gyro_data" and "temp_data" structure
+ * instances.
+ */
+int8_t bmi3_extract_all(struct bmi3_fifo_sens_axes_data *accel_data,
+                        struct bmi3_fifo_sens_axes_data *gyro_data,
+                        struct bmi3_fifo_temperature_data *temp_data,
+                        struct bmi3_fifo_frame *fifo,
+                        const struct bmi3_dev *dev)
+{
+    /* Variable to store result of API */
+    int8_t rslt;
+
+    rslt = null_ptr_check(dev);
+
+    if ((rslt == BMI3_OK) && (fifo != NULL))
+    {
+        /* Output structure is required only for the sensors enabled in FIFO */
+        if (((fifo->available_fifo_sens & BMI3_FIFO_HEAD_LESS_ACC_FRM) && (accel_data == NULL)) ||
+            ((fifo->available_fifo_sens & BMI3_FIFO_HEAD_LESS_GYR_FRM) && (gyro_data == NULL)) ||
+            ((fifo->available_fifo_sens & BMI3_FIFO_HEAD_LESS_TEMP_FRM) && (temp_data == NULL)))
+        {
+            rslt = BMI3_E_NULL_PTR;
+        }
+        else
+        {
+            /* Frame counts of sensors which are not enabled in FIFO are cleared */
+            fifo->avail_fifo_accel_frames = 0;
+            fifo->avail_fifo_gyro_frames = 0;
+            fifo->avail_fifo_temp_frames = 0;
+
+            rslt = parse_fifo_frames(accel_data, gyro_data, temp_data, fifo, dev);
+        }
+    }
+    else
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This API parses and extracts the accelerometer, gyro and temperature
+ * frames [first_frame, end_frame) of FIFO data read by the "bmi3_read_fifo_data"
+ * API, without modifying the FIFO frame.
+ */
+int8_t bmi3_extract_range(struct bmi3_fifo_sens_axes_data *accel_data,
+                          struct bmi3_fifo_sens_axes_data *gyro_data,
+                          struct bmi3_fifo_temperature_data *temp_data,
+                          uint16_t first_frame,
+                          uint16_t end_frame,
+                          struct bmi3_fifo_census *count,
+                          const struct bmi3_fifo_frame *fifo,
+                          const struct bmi3_dev *dev)
+{
+    /* Variable to store result of API */
+    int8_t rslt;
+
+    /* Pointer to the layout of the frame */
+    const struct bmi3_fifo_frame_layout *layout;
+
+    /* Variables to store the first byte and the end of the range */
+    uint32_t data_index;
+    uint32_t data_end;
+
+    /* Variable to store the end of valid FIFO data */
+    uint16_t fifo_end;
+
+    rslt = null_ptr_check(dev);
+
+    if ((rslt == BMI3_OK) && (count != NULL) && (fifo != NULL) && (fifo->data != NULL))
+    {
+        layout = select_fifo_frame_layout(fifo);
+
+        /* Output structure is required only for the sensors enabled in FIFO */
+        if (((layout->acc_offset != BMI3_FIFO_NO_DATA) && (accel_data == NULL)) ||
+            ((layout->gyr_offset != BMI3_FIFO_NO_DATA) && (gyro_data == NULL)) ||
+            ((layout->temp_offset != BMI3_FIFO_NO_DATA) && (temp_data == NULL)))
+        {
+            rslt = BMI3_E_NULL_PTR;
+        }
+        else if (end_frame < first_frame)
+        {
+            rslt = BMI3_E_INVALID_INPUT;
+        }
+        else
+        {
+            fifo_end = get_fifo_data_end(fifo, dev);
+            data_index = dev->dummy_byte + ((uint32_t)first_frame * layout->frame_len);
+            data_end = dev->dummy_byte + ((uint32_t)end_frame * layout->frame_len);
+
+            /* Range is limited by the valid FIFO data, the last frame may be incomplete */
+            if (data_end > fifo_end)
+            {
+                data_end = fifo_end;
+            }
+
+            if (data_index > data_end)
+            {
+                data_index = data_end;
+            }
+
+            count->frames = 0;
+            count->partial_len = 0;
+            count->accel_dummy_frames = 0;
+            count->gyro_dummy_frames = 0;
+            count->temp_dummy_frames = 0;
+
+            if (layout->frame_len != 0)
+            {
+                count->frames = (uint16_t)((data_end - data_index) / layout->frame_len);
+                count->partial_len = (uint8_t)((data_end - data_index) % layout->frame_len);
+            }
+
+            rslt = parse_fifo_frame_range(accel_data,
+                                          gyro_data,
+                                          temp_data,
+                                          (uint16_t)data_index,
+                                          (uint16_t)data_end,
+                                          count,
+                                          fifo,
+                                          dev);
+        }
+    }
+    else if (rslt == BMI3_OK)
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This API parses and extracts the accelerometer and gyro frames of FIFO
+ * data read by the "bmi3_read_fifo_data" API at their native rates, with accel
+ * and gyro running at different ODRs.
+ */
+int8_t bmi3_extract_multi_rate(struct bmi3_fifo_multi_rate *multi_rate,
+                               struct bmi3_fifo_time *fifo_time,
+                               const struct bmi3_fifo_frame *fifo,
+                               const struct bmi3_dev *dev)
+{
+    /* Variable to store result of API */
+    int8_t rslt;
+
+    /* Pointer to the layout of the frame */
+    const struct bmi3_fifo_frame_layout *layout;
+
+    rslt = null_ptr_check(dev);
+
+    if ((rslt == BMI3_OK) && (multi_rate != NULL) && (fifo != NULL) && (fifo->data != NULL))
+    {
+        layout = select_fifo_frame_layout(fifo);
+
+        /* Output arrays are required only for the sensors enabled in FIFO */
+        if (((layout->acc_offset != BMI3_FIFO_NO_DATA) && (multi_rate->accel_data == NULL)) ||
+            ((layout->gyr_offset != BMI3_FIFO_NO_DATA) && (multi_rate->gyro_data == NULL)))
+        {
+            rslt = BMI3_E_NULL_PTR;
+        }
+        else
+        {
+            rslt = parse_fifo_multi_rate(multi_rate, fifo_time, fifo, dev);
+        }
+    }
+    else if (rslt == BMI3_OK)
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This API parses and extracts the accelerometer and gyro frames of FIFO
+ * data read by the "bmi3_read_fifo_data" API into joined 6-DoF samples.
+ */
+int8_t bmi3_extract_6dof(struct bmi3_fifo_6dof_data *data,
+                         struct bmi3_fifo_frame *fifo,
+                         const struct bmi3_dev *dev)
+{
+    /* Variable to store result of API */
+    int8_t rslt;
+
+    /* Pointer to the layout of the frame */
+    const struct bmi3_fifo_frame_layout *layout;
+
+    rslt = null_ptr_check(dev);
+
+    if ((rslt == BMI3_OK) && (data != NULL) && (fifo != NULL) && (fifo->data != NULL))
+    {
+        layout = select_fifo_frame_layout(fifo);
+
+        /* Both sensors have to be part of the frame */
+        if ((layout->acc_offset != BMI3_FIFO_NO_DATA) && (layout->gyr_offset != BMI3_FIFO_NO_DATA))
+        {
+            fifo->avail_fifo_accel_frames = parse_fifo_6dof(data, layout, fifo, dev);
+            fifo->avail_fifo_gyro_frames = fifo->avail_fifo_accel_frames;
+        }
+        else
+        {
+            rslt = BMI3_E_INVALID_INPUT;
+        }
+    }
+    else if (rslt == BMI3_OK)
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
+
+    return rslt;
+}
+
+#ifdef BMI3_SHOCK_DETECT
+
+/*!
+ * @brief This API detects shocks in the accelerometer frames of FIFO data read
+ * by the "bmi3_read_fifo_data" API, without extracting the frames.
+ */
+int8_t bmi3_detect_shock(const struct bmi3_shock_config *config,
+                         struct bmi3_shock_event *events,
+                         uint8_t *n_events,
+                         const struct bmi3_fifo_frame *fifo,
+                         const struct bmi3_dev *dev)
+{
+    /* Variable to store result of API */
+    int8_t rslt;
+
+    /* Pointer to the layout of the frame */
+    const struct bmi3_fifo_frame_layout *layout;
+
+    rslt = null_ptr_check(dev);
+
+    if ((rslt == BMI3_OK) && (config != NULL) && (events != NULL) && (n_events != NULL) && (fifo != NULL) &&
+        (fifo->data != NULL))
+    {
+        layout = select_fifo_frame_layout(fifo);
+
+        /* Threshold is given in g, the accel range has to be known */
+        if ((layout->acc_offset == BMI3_FIFO_NO_DATA) || (dev->unit_scale.acc_q == 0) || (config->threshold < 0))
+        {
+            rslt = BMI3_E_INVALID_INPUT;
+        }
+        else
+        {
+            scan_fifo_shocks(config->threshold / dev->unit_scale.acc_q, config, events, n_events, layout, fifo, dev);
+        }
+    }
+    else if (rslt == BMI3_OK)
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
+
+    return rslt;
+}
+#endif
+
+/*!
+ * @brief This API parses and extracts the accelerometer frames from FIFO data
+ * read by the "bmi3_read_fifo_data" API and stores them in separate x, y, z and
+ * sensor time arrays of the "accel_planes" structure instance.
+ */
+int8_t bmi3_extract_accel_planes(const struct bmi3_fifo_sens_axes_planes *accel_planes,
+                                 struct bmi3_fifo_frame *fifo,
+                                 const struct bmi3_dev *dev)
+{
+    /* Variable to store result of API */
+    int8_t rslt;
+
+    rslt = null_ptr_check(dev);
+
+    /* Null-pointer check */
+    if ((rslt == BMI3_OK) && (accel_planes != NULL) && (accel_planes->x != NULL) && (accel_planes->y != NULL) &&
+        (accel_planes->z != NULL) && (fifo != NULL))
+    {
+        rslt = parse_fifo_axes_planes(accel_planes,
+                                      BMI3_FIFO_HEAD_LESS_ACC_FRM,
+                                      &fifo->avail_fifo_accel_frames,
+                                      fifo,
+                                      dev);
+    }
+    else
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This API parses and extracts the gyro frames from FIFO data
+ * read by the "bmi3_read_fifo_data" API and stores them in separate x, y, z and
+ * sensor time arrays of the "gyro_planes" structure instance.
+ */
+int8_t bmi3_extract_gyro_planes(const struct bmi3_fifo_sens_axes_planes *gyro_planes,
+                                struct bmi3_fifo_frame *fifo,
+                                const struct bmi3_dev *dev)
+{
+    /* Variable to store result of API */
+    int8_t rslt;
+
+    rslt = null_ptr_check(dev);
+
+    /* Null-pointer check */
+    if ((rslt == BMI3_OK) && (gyro_planes != NULL) && (gyro_planes->x != NULL) && (gyro_planes->y != NULL) &&
+        (gyro_planes->z != NULL) && (fifo != NULL))
+    {
+        rslt = parse_fifo_axes_planes(gyro_planes, BMI3_FIFO_HEAD_LESS_GYR_FRM, &fifo->avail_fifo_gyro_frames, fifo, dev);
+    }
+    else
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This API counts the accelerometer, gyro and temperature frames of the
+ * FIFO data from the FIFO length and frame layout, without parsing the data.
+ */
+int8_t bmi3_fifo_census(struct bmi3_fifo_census *census,
+                        uint8_t count_dummy,
+                        const struct bmi3_fifo_frame *fifo,
+                        const struct bmi3_dev *dev)
+{
+    /* Variable to store result of API */
+    int8_t rslt;
+
+    /* Pointer to the layout of the frame */
+    const struct bmi3_fifo_frame_layout *layout;
+
+    /* Variable to store the number of bytes of valid FIFO data */
+    uint16_t data_len;
+
+    rslt = null_ptr_check(dev);
+
+    if ((rslt == BMI3_OK) && (census != NULL) && (fifo != NULL) &&
+        ((count_dummy != BMI3_ENABLE) || (fifo->data != NULL)))
+    {
+        layout = select_fifo_frame_layout(fifo);
+        data_len = get_fifo_data_end(fifo, dev);
+        data_len = (data_len > dev->dummy_byte) ? (uint16_t)(data_len - dev->dummy_byte) : 0;
+
+        census->frames = 0;
+        census->partial_len = 0;
+
+        /* Headerless frames have a fixed length for the sensors enabled in FIFO */
+        if (layout->frame_len != 0)
+        {
+            census->frames = data_len / layout->frame_len;
+            census->partial_len = (uint8_t)(data_len % layout->frame_len);
+        }
+
+        /* Like the parser, a sensor of the incomplete frame at the end is counted if its data is complete */
+        census->accel_frames = get_census_frames(layout->acc_offset, BMI3_LENGTH_FIFO_ACC, census);
+        census->gyro_frames = get_census_frames(layout->gyr_offset, BMI3_LENGTH_FIFO_GYR, census);
+        census->temp_frames = get_census_frames(layout->temp_offset, BMI3_LENGTH_TEMPERATURE, census);
+        census->accel_dummy_frames = 0;
+        census->gyro_dummy_frames = 0;
+        census->temp_dummy_frames = 0;
+
+        if (count_dummy == BMI3_ENABLE)
+        {
+            if (census->accel_frames != 0)
+            {
+                census->accel_dummy_frames = count_fifo_dummy_frames(layout->acc_offset,
+                                                                     BMI3_FIFO_ACCEL_DUMMY_FRAME,
+                                                                     census->accel_frames,
+                                                                     layout,
+                                                                     fifo,
+                                                                     dev);
+            }
+
+            if (census->gyro_frames != 0)
+            {
+                census->gyro_dummy_frames = count_fifo_dummy_frames(layout->gyr_offset,
+                                                                    BMI3_FIFO_GYRO_DUMMY_FRAME,
+                                                                    census->gyro_frames,
+                                                                    layout,
+                                                                    fifo,
+                                                                    dev);
+            }
+
+            if (census->temp_frames != 0)
+            {
+                census->temp_dummy_frames = count_fifo_dummy_frames(layout->temp_offset,
+                                                                    BMI3_FIFO_TEMP_DUMMY_FRAME,
+                                                                    census->temp_frames,
+                                                                    layout,
+                                                                    fifo,
+                                                                    dev);
+            }
+
+            census->accel_frames -= census->accel_dummy_frames;
+            census->gyro_frames -= census->gyro_dummy_frames;
+            census->temp_frames -= census->temp_dummy_frames;
+        }
+    }
+    else if (rslt == BMI3_OK)
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This API sets the FIFO water-mark level in words.
+ */
+int8_t bmi3_set_fifo_wm(uint16_t fifo_wm, struct bmi3_dev *dev)
+{
+    /* Variable to store result of API */
+    int8_t rslt;
+
+    /* Array to store data */
+    uint8_t data[2] = { 0 };
+
+    uint16_t fifo_watermark = fifo_wm & BMI3_FIFO_WATERMARK_MASK;
+
+    /* Get LSB value of FIFO water-mark */
+    data[0] = BMI3_GET_LSB(fifo_watermark);
+
+    /* Get MSB value of FIFO water-mark */
+    data[1] = BMI3_GET_MSB(fifo_watermark);
+
+    /* Set the FIFO water-mark level */
+    rslt = bmi3_set_regs(BMI3_REG_FIFO_WATERMARK, data, BMI3_LENGTH_FIFO_WM, dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API reads the FIFO water-mark level in words.
+ */
+int8_t bmi3_get_fifo_wm(uint16_t *fifo_wm, struct bmi3_dev *dev)
+{
+    /* Variable to store result of API */
+    int8_t rslt;
+
+    /* Array to to store data */
+    uint8_t data[2] = { 0 };
+
+    if (fifo_wm != NULL)
+    {
+        /* Read the FIFO water-mark level */
+        rslt = bmi3_get_regs(BMI3_REG_FIFO_WATERMARK, data, BMI3_LENGTH_FIFO_WM, dev);
+
+        if (rslt == BMI3_OK)
+        {
+            (*fifo_wm) = (uint16_t)((data[0] | (uint16_t) data[1] << 8));
+        }
+    }
+    else
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This API sets the FIFO configuration in the sensor.
+ */
+int8_t bmi3_set_fifo_config(uint16_t config, uint8_t enable, struct bmi3_dev *dev)
+{
+    /* Variable to store result of API */
+    int8_t rslt;
+
+    /* Array variable to store fifo config data */
+    uint8_t data[2] = { 0 };
+
+    /* Variable to store data of FIFO configuration register */
+    uint16_t fifo_config = config & BMI3_FIFO_CONFIG_MASK;
+
+    lock_dev(dev);
+
+    rslt = bmi3_get_regs(BMI3_REG_FIFO_CONF, data, 2, dev);
+
+    if (rslt == BMI3_OK)
+    {
+        if (enable == BMI3_ENABLE)
+        {
+            data[0] = data[0] | (uint8_t)fifo_config;
+            data[1] = data[1] | (uint8_t)(fifo_config >> 8);
+        }
+        else
+        {
+            data[0] = data[0] & (~fifo_config);
+            data[1] = data[1] & (~(fifo_config >> 8));
+        }
+
+        rslt = bmi3_set_regs(BMI3_REG_FIFO_CONF, data, 2, dev);
+    }
+
+    /* Frames stored in FIFO may have changed */
+    if ((rslt == BMI3_OK) && (dev->fifo_wm_budget != NULL))
+    {
+        rslt = bmi3_tune_fifo_wm(dev->fifo_wm_budget, dev);
+    }
+
+    unlock_dev(dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API reads the FIFO configuration from the sensor.
+ */
+int8_t bmi3_get_fifo_config(uint16_t *fifo_config, struct bmi3_dev *dev)
+{
+    /* Variable to store result of API */
+    int8_t rslt;
+
+    /* Array to store data */
+    uint8_t data[2] = { 0 };
+
+    if (fifo_config != NULL)
+    {
+        /* Get the FIFO configuration value */
+        rslt = bmi3_get_regs(BMI3_REG_FIFO_CONF, data, 2, dev);
+
+        if (rslt == BMI3_OK)
+        {
+            (*fifo_config) = ((data[0] & BMI3_FIFO_CONFIG_MASK) | (((uint16_t)data[1] << 8) & BMI3_FIFO_CONFIG_MASK));
+        }
+    }
+    else
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This API gets the length of FIFO data available in the sensor in
+ * words.
+ */
+int8_t bmi3_get_fifo_length(uint16_t *fifo_avail_len, struct bmi3_dev *dev)
+{
+    /* Variable to store result of API */
+    int8_t rslt;
+
+    /* Variable to define byte index */
+    uint16_t reg_data;
+
+    /* Array to store FIFO data length */
+    uint8_t data[BMI3_LENGTH_FIFO_DATA] = { 0 };
+
+    if (fifo_avail_len != NULL)
+    {
+        /* Read FIFO length */
+        rslt = bmi3_get_regs(BMI3_REG_FIFO_FILL_LEVEL, data, BMI3_LENGTH_FIFO_DATA, dev);
+
+        if (rslt == BMI3_OK)
+        {
+            /* Get the MSB byte of FIFO length */
+            data[0] = BMI3_GET_BIT_POS0(data[0], BMI3_FIFO_FILL_LEVEL);
+
+            reg_data = ((uint16_t)data[1] << 8);
+
+            reg_data = BMI3_GET_BIT_POS0(reg_data, BMI3_FIFO_FILL_LEVEL);
+
+            /* Get total FIFO length */
+            *fifo_avail_len = (uint16_t)(reg_data | data[0]);
+
+            if (*fifo_avail_len == 0)
+            {
+                rslt = BMI3_W_FIFO_EMPTY;
+            }
+        }
+    }
+    else
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This API is used to perform the self-test for either accel or gyro or both.
+ */
+int8_t bmi3_perform_self_test(uint8_t st_selection, struct bmi3_st_result *st_result_status, struct bmi3_dev *dev)
+{
+    /* Variable to store result of API */
+    int8_t rslt;
+
+    /* Variable to store the state of the self-test */
+    struct bmi3_st_ctx st_ctx = { 0 };
+
+    lock_dev(dev);
+
+    if (st_result_status != NULL)
+    {
+        rslt = bmi3_self_test_start(st_selection, &st_ctx, dev);
+
+        if (rslt == BMI3_OK)
+        {
+            do
+            {
+                /* A delay of 350ms (35ms * 10(limit)) is required to run self-test for accel and gyro */
+                dev->delay_us(BMI3_ST_DELAY, dev->intf_ptr);
+
+                rslt = bmi3_self_test_poll(&st_ctx, dev);
+            } while (rslt == BMI3_W_ST_ONGOING);
+
+            rslt = bmi3_self_test_finish(&st_ctx, st_result_status, dev);
+        }
+    }
+    else
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
+
+    unlock_dev(dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API prepares the self-test and triggers it without waiting
+ * for the result.
+ */
+int8_t bmi3_self_test_start(uint8_t st_selection, struct bmi3_st_ctx *st_ctx, struct bmi3_dev *dev)
+{
+    /* Variable to store result of API */
+    int8_t rslt;
+
+    uint8_t data_array[BMI3_SC_ST_COEFF_LEN] = { 0 };
+
+    /* Variable to store gyro filter coefficient base address */
+    uint8_t gyro_filter_coeff_base_addr[2] = { BMI3_BASE_ADDR_GYRO_SC_ST_COEFFICIENTS, 0 };
+
+    lock_dev(dev);
+
+    /* Null-pointer check */
+    rslt = null_ptr_check(dev);
+
+    if ((rslt == BMI3_OK) && (st_ctx != NULL))
+    {
+        st_ctx->state = BMI3_ST_STATE_IDLE;
+        st_ctx->st_selection = st_selection;
+        st_ctx->polls = 0;
+        st_ctx->feature_io1 = 0;
+
+        rslt = bmi3_set_regs(BMI3_REG_FEATURE_DATA_ADDR, gyro_filter_coeff_base_addr, 2, dev);
+
+        if (rslt == BMI3_OK)
+        {
+            rslt = bmi3_set_regs(BMI3_REG_FEATURE_DATA_TX, data_array, BMI3_SC_ST_COEFF_LEN, dev);
+        }
+
+#ifdef BMI330
+
+        /* Coefficients are read back and rewritten only if the feature engine did not restore them, on the
+         * variants which need it
+         */
+        if ((rslt == BMI3_OK) && ((dev->variant == NULL) || (dev->variant->gyro_sc_st_coeff == BMI3_ENABLE)))
+        {
+            rslt = bmi3_set_regs(BMI3_REG_FEATURE_DATA_ADDR, gyro_filter_coeff_base_addr, 2, dev);
+
+            if (rslt == BMI3_OK)
+            {
+                rslt = bmi3_get_regs(BMI3_REG_FEATURE_DATA_TX, data_array, BMI3_SC_ST_COEFF_LEN, dev);
+            }
+
+            if ((rslt == BMI3_OK) && (sc_st_coeff_differ(data_array) == BMI3_ENABLE))
+            {
+                rslt = set_gyro_filter_coefficients(dev);
+            }
+        }
+
+#endif
+
+        if (rslt == BMI3_OK)
+        {
+            /* Get and set the self-test mode given by the user in the self-test dma register. */
+            rslt = get_set_st_dma(st_selection, dev);
+        }
+
+        if (rslt == BMI3_OK)
+        {
+            /* Get default accel configurations, restored by bmi3_self_test_finish */
+            rslt = get_accel_config(&st_ctx->acc_cfg, dev);
+        }
+
+        if (rslt == BMI3_OK)
+        {
+            /* Sets the self-test preconditions and triggers the self-test in the
+             * command register. */
+            rslt = self_test_conditions(st_selection, dev);
+
+            if (rslt == BMI3_OK)
+            {
+                st_ctx->state = BMI3_ST_STATE_RUNNING;
+            }
+        }
+    }
+    else
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
+
+    unlock_dev(dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API reads the self-test status once.
+ */
+int8_t bmi3_self_test_poll(struct bmi3_st_ctx *st_ctx, struct bmi3_dev *dev)
+{
+    /* Variable to store result of API */
+    int8_t rslt;
+
+    /* Variable to define data array */
+    uint8_t data_array[2] = { 0 };
+
+    /* Null-pointer check */
+    rslt = null_ptr_check(dev);
+
+    if ((rslt == BMI3_OK) && (st_ctx != NULL))
+    {
+        if (st_ctx->state == BMI3_ST_STATE_RUNNING)
+        {
+            rslt = bmi3_get_regs(BMI3_REG_FEATURE_IO1, data_array, 2, dev);
+
+            if (rslt == BMI3_OK)
+            {
+                st_ctx->polls++;
+
+                if (((data_array[0] & BMI3_SC_ST_STATUS_MASK) >> BMI3_SC_ST_COMPLETE_POS) == BMI3_TRUE)
+                {
+                    st_ctx->feature_io1 = data_array[0];
+                    st_ctx->state = BMI3_ST_STATE_COMPLETE;
+                }
+                else if (st_ctx->polls >= BMI3_ST_POLL_LIMIT)
+                {
+                    st_ctx->state = BMI3_ST_STATE_TIMEOUT;
+                }
+                else
+                {
+                    rslt = BMI3_W_ST_ONGOING;
+                }
+            }
+        }
+        else if (st_ctx->state == BMI3_ST_STATE_IDLE)
+        {
+            rslt = BMI3_E_INVALID_STATUS;
+        }
+    }
+    else
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This API reads the self-test result and restores the accel
+ * configuration.
+ */
+int8_t bmi3_self_test_finish(struct bmi3_st_ctx *st_ctx, struct bmi3_st_result *st_result_status, struct bmi3_dev *dev)
+{
+    /* Variable to store result of API */
+    int8_t rslt;
+
+    /* Variable to store result of restoring the accel configuration */
+    int8_t restore_rslt;
+
+    lock_dev(dev);
+
+    /* Null-pointer check */
+    rslt = null_ptr_check(dev);
+
+    if ((rslt == BMI3_OK) && (st_ctx != NULL) && (st_result_status != NULL))
+    {
+        if (st_ctx->state != BMI3_ST_STATE_IDLE)
+        {
+            rslt = get_st_result(st_ctx, st_result_status, dev);
+
+            /* Restore accel configurations, also if the self-test failed or is aborted */
+            restore_rslt = set_accel_config(&st_ctx->acc_cfg, dev);
+
+            if (rslt == BMI3_OK)
+            {
+                rslt = restore_rslt;
+            }
+
+            st_ctx->state = BMI3_ST_STATE_IDLE;
+        }
+        else
+        {
+            rslt = BMI3_E_INVALID_STATUS;
+        }
+    }
+    else
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
+
+    unlock_dev(dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API writes the config array and config version in cfg res.
+ */
+int8_t bmi3_configure_enhanced_flexibility(struct bmi3_dev *dev)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    lock_dev(dev);
+
+    /* Null-pointer check */
+    rslt = null_ptr_check(dev);
+
+    if (rslt == BMI3_OK)
+    {
+        /* Bytes written are multiples of 2 */
+        if ((dev->read_write_len % 2) != 0)
+        {
+            dev->read_write_len = dev->read_write_len - 1;
+        }
+
+        /* BMI3 has 16 bit address and hence the minimum read write length should be 2 bytes */
+        if (dev->read_write_len < 2)
+        {
+            dev->read_write_len = 2;
+        }
+
+        rslt = config_array_set_command(dev);
+
+        if (rslt == BMI3_OK)
+        {
+            rslt = config_array_set_value_one_page(dev);
+
+            if (rslt == BMI3_OK)
+            {
+                /* Write the config array */
+                rslt = write_config_array(dev);
+            }
+        }
+    }
+
+    unlock_dev(dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API uploads a config array to the feature engine in bursts of
+ * the largest length supported by the bus driver.
+ */
+int8_t bmi3_upload_config_array(const uint8_t *config_array, uint16_t config_size, struct bmi3_dev *dev)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    /* Variable to store the largest number of bytes written at once */
+    uint16_t burst_len;
+
+    /* Variable to store the number of bytes written at once */
+    uint16_t len = 0;
+
+    /* Variable to loop */
+    uint16_t indx;
+
+    lock_dev(dev);
+
+    /* Null-pointer check */
+    rslt = null_ptr_check(dev);
+
+    if ((rslt == BMI3_OK) && (config_array != NULL))
+    {
+        if (config_size > BMI3_CONFIG_ARRAY_DATA_START_ADDR)
+        {
+            burst_len = get_upload_burst_len(dev);
+
+            /* First two bytes of config array denotes the base address. The transmission address
+             * auto-increments, so it is set once for the whole array
+             */
+            rslt = bmi3_set_regs(BMI3_REG_FEATURE_DATA_ADDR, config_array, 2, dev);
+
+            for (indx = BMI3_CONFIG_ARRAY_DATA_START_ADDR; (rslt == BMI3_OK) && (indx < config_size); indx += len)
+            {
+                /* The remaining bytes are written in a single transfer */
+                len = (uint16_t)(config_size - indx);
+
+                if (len > burst_len)
+                {
+                    len = burst_len;
+                }
+
+                rslt = bmi3_set_regs(BMI3_REG_FEATURE_DATA_TX, &config_array[indx], len, dev);
+            }
+
+            if ((rslt == BMI3_OK) && (dev->upload_cfg != NULL) && (dev->upload_cfg->verify == BMI3_ENABLE))
+            {
+                rslt = verify_config_array(config_array, config_size, dev);
+            }
+        }
+        else
+        {
+            rslt = BMI3_E_INVALID_INPUT;
+        }
+    }
+    else
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
+
+    unlock_dev(dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API checks whether a config array is already loaded in the
+ * feature engine.
+ */
+int8_t bmi3_check_config_array(const uint8_t *config_version,
+                               const uint8_t *config_array,
+                               uint16_t config_size,
+                               uint8_t *loaded,
+                               struct bmi3_dev *dev)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    /* Array to store the data read back */
+    uint8_t data[BMI3_UPLOAD_VERIFY_LEN] = { 0 };
+
+    /* Array to store the feature engine address of the compared data */
+    uint8_t addr[2];
+
+    /* Variable to store the number of bytes compared */
+    uint16_t len;
+
+    /* Variable to store the start index of the compared data */
+    uint16_t indx;
+
+    /* Variable to store the feature engine address in words */
+    uint16_t base_addr;
+
+    /* Variable to loop */
+    uint16_t pos;
+
+    lock_dev(dev);
+
+    /* Null-pointer check */
+    rslt = null_ptr_check(dev);
+
+    if ((rslt == BMI3_OK) && (config_version != NULL) && (config_array != NULL) && (loaded != NULL))
+    {
+        *loaded = BMI3_DISABLE;
+
+        if (config_size > BMI3_CONFIG_ARRAY_DATA_START_ADDR)
+        {
+            /* Read the config version word */
+            rslt = bmi3_set_regs(BMI3_REG_FEATURE_DATA_ADDR, config_version, 2, dev);
+
+            if (rslt == BMI3_OK)
+            {
+                rslt = bmi3_get_regs(BMI3_REG_FEATURE_DATA_TX, data, 2, dev);
+            }
+
+            if ((rslt == BMI3_OK) &&
+                (data[0] == config_version[BMI3_CONFIG_ARRAY_DATA_START_ADDR]) &&
+                (data[1] == config_version[BMI3_CONFIG_ARRAY_DATA_START_ADDR + 1]))
+            {
+                /* A matching version can be left from another image, so the tail of the array is compared too */
+                len = (uint16_t)(config_size - BMI3_CONFIG_ARRAY_DATA_START_ADDR);
+
+                if (len > BMI3_UPLOAD_VERIFY_LEN)
+                {
+                    len = BMI3_UPLOAD_VERIFY_LEN;
+                }
+
+                len &= (uint16_t)~1u;
+                indx = (uint16_t)(config_size - len);
+
+                base_addr = (uint16_t)(config_array[0] | ((uint16_t)config_array[1] << 8));
+                base_addr = (uint16_t)(base_addr + ((indx - BMI3_CONFIG_ARRAY_DATA_START_ADDR) / 2));
+
+                addr[0] = BMI3_GET_LSB(base_addr);
+                addr[1] = BMI3_GET_MSB(base_addr);
+
+                rslt = bmi3_set_regs(BMI3_REG_FEATURE_DATA_ADDR, addr, 2, dev);
+
+                if (rslt == BMI3_OK)
+                {
+                    rslt = bmi3_get_regs(BMI3_REG_FEATURE_DATA_TX, data, len, dev);
+                }
+
+                if (rslt == BMI3_OK)
+                {
+                    *loaded = BMI3_ENABLE;
+
+                    for (pos = 0; pos < len; pos++)
+                    {
+                        if (data[pos] != config_array[indx + pos])
+                        {
+                            *loaded = BMI3_DISABLE;
+                        }
+                    }
+                }
+            }
+        }
+        else
+        {
+            rslt = BMI3_E_INVALID_INPUT;
+        }
+    }
+    else
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
+
+    unlock_dev(dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API is used to get the config version.
+ */
+int8_t bmi3_get_config_version(struct bmi3_config_version *config_version, struct bmi3_dev *dev)
+{
+    /* Variable to store result of API */
+    int8_t rslt = BMI3_OK;
+
+    /* Array to store base address of config */
+    uint8_t data[2] = { BMI3_BASE_ADDR_CONFIG_VERSION, 0 };
+
+    /* Variable to store version number */
+    uint8_t version[6];
+
+    uint16_t lsb_msb;
+
+    lock_dev(dev);
+
+    if (config_version != NULL)
+    {
+        /* Set the config version base address to feature engine transmission address to start DMA transaction */
+        rslt = bmi3_set_regs(BMI3_REG_FEATURE_DATA_ADDR, data, 2, dev);
+
+        if (rslt == BMI3_OK)
+        {
+            /* Get the configuration from the feature engine register */
+            rslt = bmi3_get_regs(BMI3_REG_FEATURE_DATA_TX, version, 6, dev);
+
+            if (rslt == BMI3_OK)
+            {
+                /* Get word to calculate config major and minor version from same word */
+                lsb_msb = (uint16_t)(version[0] | ((uint16_t) version[1] << 8));
+
+                config_version->config1_minor_version = (uint8_t)(lsb_msb & BMI3_CONFIG_1_MINOR_MASK);
+
+                config_version->config1_major_version = (lsb_msb & BMI3_CONFIG_1_MAJOR_MASK) >> BMI3_CONFIG_POS;
+
+                /* Get word to calculate config major and minor version from same word */
+                lsb_msb = (uint16_t)(version[2] | ((uint16_t) version[3] << 8));
+
+                config_version->config2_minor_version = (uint8_t)(lsb_msb & BMI3_CONFIG_2_MINOR_MASK);
+
+                config_version->config2_major_version = (lsb_msb & BMI3_CONFIG_2_MAJOR_MASK) >> BMI3_CONFIG_POS;
+            }
+        }
+    }
+    else
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
+
+    unlock_dev(dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API is used to perform the self-calibration for either sensitivity or offset or both.
+ */
+int8_t bmi3_perform_gyro_sc(uint8_t sc_selection,
+                            uint8_t apply_corr,
+                            struct bmi3_self_calib_rslt *sc_rslt,
+                            struct bmi3_dev *dev)
+{
+    /* Variable to store result of API */
+    int8_t rslt;
+
+    /* Variable to store the state of the self-calibration */
+    struct bmi3_sc_ctx sc_ctx = { 0 };
+
+    lock_dev(dev);
+
+    if (sc_rslt != NULL)
+    {
+        rslt = bmi3_gyro_sc_start(sc_selection, apply_corr, &sc_ctx, dev);
+
+        if (rslt == BMI3_OK)
+        {
+            do
+            {
+                /* A delay of 430ms (43ms * 10(limit)) is required to perform self calibration */
+                dev->delay_us(BMI3_SC_DELAY, dev->intf_ptr);
+
+                rslt = bmi3_gyro_sc_poll(&sc_ctx, dev);
+            } while (rslt == BMI3_W_SC_ONGOING);
+
+            rslt = bmi3_gyro_sc_finish(&sc_ctx, sc_rslt, dev);
+        }
+    }
+    else
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
+
+    unlock_dev(dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API prepares the gyro self-calibration and triggers it
+ * without waiting for the result.
+ */
+int8_t bmi3_gyro_sc_start(uint8_t sc_selection, uint8_t apply_corr, struct bmi3_sc_ctx *sc_ctx, struct bmi3_dev *dev)
+{
+    /* Variable to store result of API */
+    int8_t rslt;
+
+    /* Structure to store sensor configuration for accel */
+    struct bmi3_sens_config set_config;
+
+    lock_dev(dev);
+
+    /* Null-pointer check */
+    rslt = null_ptr_check(dev);
+
+    if ((rslt == BMI3_OK) && (sc_ctx != NULL))
+    {
+        sc_ctx->state = BMI3_ST_STATE_IDLE;
+        sc_ctx->polls = 0;
+        sc_ctx->feature_io1 = 0;
+        sc_ctx->acc_cfg.type = BMI3_ACCEL;
+
+        /* Get accel configurations, restored by bmi3_gyro_sc_finish */
+        rslt = bmi3_get_sensor_config(&sc_ctx->acc_cfg, 1, dev);
+
+        if (rslt == BMI3_OK)
+        {
+            /* Enable accelerometer */
+            set_config.type = BMI3_ACCEL;
+
+            /* Definition of accel configuration which are the preconditions for self-calibration */
+            set_config.cfg.acc = sc_ctx->acc_cfg.cfg.acc;
+            set_config.cfg.acc.acc_mode = BMI3_ACC_MODE_HIGH_PERF;
+            set_config.cfg.acc.odr = BMI3_ACC_ODR_100HZ;
+            set_config.cfg.acc.range = BMI3_ACC_RANGE_8G;
+
+            /* Write the sensor configurations */
+            rslt = bmi3_set_sensor_config(&set_config, 1, dev);
+        }
+
+        if (rslt == BMI3_OK)
+        {
+            /* Disable alternate accel and gyro mode */
+            rslt = disable_alt_conf_acc_gyr_mode(dev);
+        }
+
+        if (rslt == BMI3_OK)
+        {
+            /* Get and set the self-calibration mode given by the user in the self-calibration dma register. */
+            rslt = get_set_sc_dma(sc_selection, apply_corr, dev);
+
+            if (rslt == BMI3_OK)
+            {
+                /* Trigger the self-calibration command */
+                rslt = bmi3_set_command_register(BMI3_CMD_SELF_CALIB_TRIGGER, dev);
+
+                if (rslt == BMI3_OK)
+                {
+                    sc_ctx->state = BMI3_ST_STATE_RUNNING;
+                }
+            }
+        }
+    }
+    else
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
+
+    unlock_dev(dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API reads the gyro self-calibration status once.
+ */
+int8_t bmi3_gyro_sc_poll(struct bmi3_sc_ctx *sc_ctx, struct bmi3_dev *dev)
+{
+    /* Variable to store result of API */
+    int8_t rslt;
+
+    /* Variable to define data array */
+    uint8_t data_array[2] = { 0 };
+
+    /* Null-pointer check */
+    rslt = null_ptr_check(dev);
+
+    if ((rslt == BMI3_OK) && (sc_ctx != NULL))
+    {
+        if (sc_ctx->state == BMI3_ST_STATE_RUNNING)
+        {
+            rslt = bmi3_get_regs(BMI3_REG_FEATURE_IO1, data_array, 2, dev);
+
+            if (rslt == BMI3_OK)
+            {
+                sc_ctx->polls++;
+
+                if (((data_array[0] & BMI3_SC_ST_STATUS_MASK) >> BMI3_SC_ST_COMPLETE_POS) == BMI3_TRUE)
+                {
+                    sc_ctx->feature_io1 = data_array[0];
+                    sc_ctx->state = BMI3_ST_STATE_COMPLETE;
+                }
+                else if (sc_ctx->polls >= BMI3_SC_POLL_LIMIT)
+                {
+                    sc_ctx->state = BMI3_ST_STATE_TIMEOUT;
+                }
+                else
+                {
+                    rslt = BMI3_W_SC_ONGOING;
+                }
+            }
+        }
+        else if (sc_ctx->state == BMI3_ST_STATE_IDLE)
+        {
+            rslt = BMI3_E_INVALID_STATUS;
+        }
+    }
+    else
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This API reads the gyro self-calibration result and restores the
+ * accel configuration.
+ */
+int8_t bmi3_gyro_sc_finish(struct bmi3_sc_ctx *sc_ctx, struct bmi3_self_calib_rslt *sc_rslt, struct bmi3_dev *dev)
+{
+    /* Variable to store result of API */
+    int8_t rslt;
+
+    /* Variable to store result of restoring the accel configuration */
+    int8_t restore_rslt;
+
+    lock_dev(dev);
+
+    /* Null-pointer check */
+    rslt = null_ptr_check(dev);
+
+    if ((rslt == BMI3_OK) && (sc_ctx != NULL) && (sc_rslt != NULL))
+    {
+        if (sc_ctx->state != BMI3_ST_STATE_IDLE)
+        {
+            rslt = get_sc_gyro_rslt(sc_ctx, sc_rslt, dev);
+
+            /* Restore accel configurations, also if the self-calibration failed or is aborted */
+            restore_rslt = bmi3_set_sensor_config(&sc_ctx->acc_cfg, 1, dev);
+
+            if (rslt == BMI3_OK)
+            {
+                rslt = restore_rslt;
+            }
+
+            sc_ctx->state = BMI3_ST_STATE_IDLE;
+        }
+        else
+        {
+            rslt = BMI3_E_INVALID_STATUS;
+        }
+    }
+    else
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
+
+    unlock_dev(dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API is used to set the data sample rate for i3c sync
+ */
+int8_t bmi3_set_i3c_tc_sync_tph(uint16_t sample_rate, struct bmi3_dev *dev)
+{
+    /* Variable to store result of API */
+    int8_t rslt;
+
+    uint16_t reg_data;
+
+    /* To get the second byte data in word calculation */
+    uint16_t tc_tph;
+
+    /* Array to store data */
+    uint8_t data_array[2] = { 0 };
+
+    lock_dev(dev);
+
+    /* Get the data sample rate of i3c sync */
+    rslt = bmi3_get_regs(BMI3_REG_I3C_TC_SYNC_TPH, data_array, 2, dev);
+
+    if (rslt == BMI3_OK)
+    {
+        data_array[0] = (uint8_t)BMI3_SET_BIT_POS0(data_array[0], BMI3_I3C_TC_SYNC_TPH, sample_rate);
+
+        reg_data = ((uint16_t)data_array[1] << 8);
+
+        tc_tph = (uint8_t)BMI3_SET_BIT_POS0(reg_data, BMI3_I3C_TC_SYNC_TPH, sample_rate);
+
+        data_array[1] = (uint8_t)(tc_tph >> 8);
+
+        rslt = bmi3_set_regs(BMI3_REG_I3C_TC_SYNC_TPH, data_array, 2, dev);
+    }
+
+    unlock_dev(dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API is used to get the data sample rate for i3c sync
+ */
+int8_t bmi3_get_i3c_tc_sync_tph(uint16_t *sample_rate, struct bmi3_dev *dev)
+{
+    /* Variable to store result of API */
+    int8_t rslt;
+
+    /* Array to store data */
+    uint8_t data_array[2] = { 0 };
+
+    lock_dev(dev);
+
+    if (sample_rate != NULL)
+    {
+        /* Get the data sample rate of i3c sync */
+        rslt = bmi3_get_regs(BMI3_REG_I3C_TC_SYNC_TPH, data_array, 2, dev);
+
+        if (rslt == BMI3_OK)
+        {
+            /* Get i3c sync tph sample rate */
+            *sample_rate = (uint16_t)(data_array[0] | (uint16_t)data_array[1] << 8);
+        }
+    }
+    else
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
+
+    unlock_dev(dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API is used set the TU(time unit) value is used to scale the delay time payload
+ * according to the hosts needs
+ */
+int8_t bmi3_set_i3c_tc_sync_tu(uint8_t delay_time, struct bmi3_dev *dev)
+{
+    /* Variable to store result of API */
+    int8_t rslt;
+
+    /* Variable to define data array */
+    uint8_t data_array[2] = { 0 };
+
+    lock_dev(dev);
+
+    /* Get the i3c sync time unit */
+    rslt = bmi3_get_regs(BMI3_REG_I3C_TC_SYNC_TU, data_array, 2, dev);
+
+    if (rslt == BMI3_OK)
+    {
+        /* Set the i3c sync time unit */
+        data_array[0] = BMI3_SET_BIT_POS0(data_array[0], BMI3_I3C_TC_SYNC_TU, delay_time);
+
+        rslt = bmi3_set_regs(BMI3_REG_I3C_TC_SYNC_TU, data_array, 2, dev);
+    }
+
+    unlock_dev(dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API is used get the TU(time unit) value is used to scale the delay time payload
+ * according to the hosts needs
+ */
+int8_t bmi3_get_i3c_tc_sync_tu(uint8_t *delay_time, struct bmi3_dev *dev)
+{
+    /* Variable to store result of API */
+    int8_t rslt;
+
+    /* Variable to define data array */
+    uint8_t data_array[2] = { 0 };
+
+    lock_dev(dev);
+
+    if (delay_time != NULL)
+    {
+        /* Get the i3c sync time unit */
+        rslt = bmi3_get_regs(BMI3_REG_I3C_TC_SYNC_TU, data_array, 2, dev);
+
+        if (rslt == BMI3_OK)
+        {
+            *delay_time = BMI3_GET_BIT_POS0(data_array[0], BMI3_I3C_TC_SYNC_TU);
+        }
+    }
+    else
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
+
+    unlock_dev(dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API is used to set the i3c sync ODR.
+ */
+int8_t bmi3_set_i3c_tc_sync_odr(uint8_t odr, struct bmi3_dev *dev)
+{
+    /* Variable to store result of API */
+    int8_t rslt;
+
+    /* Variable to define data array */
+    uint8_t data_array[2] = { 0 };
+
+    lock_dev(dev);
+
+    /* Get the i3c sync ODR */
+    rslt = bmi3_get_regs(BMI3_REG_I3C_TC_SYNC_ODR, data_array, 2, dev);
+
+    if (rslt == BMI3_OK)
+    {
+        /* Set the i3c sync ODR */
+        data_array[0] = BMI3_SET_BIT_POS0(data_array[0], BMI3_I3C_TC_SYNC_ODR, odr);
+
+        rslt = bmi3_set_regs(BMI3_REG_I3C_TC_SYNC_ODR, data_array, 2, dev);
+    }
+
+    unlock_dev(dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API is used to get the i3c sync ODR.
+ */
+int8_t bmi3_get_i3c_tc_sync_odr(uint8_t *odr, struct bmi3_dev *dev)
+{
+    /* Variable to store result of API */
+    int8_t rslt;
+
+    /* Array to store data */
+    uint8_t data_array[2] = { 0 };
+
+    lock_dev(dev);
+
+    if (odr != NULL)
+    {
+        /* Get the i3c sync ODR */
+        rslt = bmi3_get_regs(BMI3_REG_I3C_TC_SYNC_ODR, data_array, 2, dev);
+
+        if (rslt == BMI3_OK)
+        {
+            *odr = BMI3_GET_BIT_POS0(data_array[0], BMI3_I3C_TC_SYNC_ODR);
+        }
+    }
+    else
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
+
+    unlock_dev(dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This internal API gets i3c sync i3c_tc_res
+ */
+int8_t bmi3_get_i3c_sync_i3c_tc_res(uint8_t *i3c_tc_res, struct bmi3_dev *dev)
+{
+    /* Variable to store result of API */
+    int8_t rslt;
+
+    /* Array to define the feature configuration */
+    uint8_t i3c_sync_i3c_tc_res[2] = { 0 };
+
+    /* Array to set the base address of i3c sync feature */
+    uint8_t base_addr[2] = { BMI3_BASE_ADDR_I3C_SYNC, 0 };
+
+    /* Variable to define array offset */
+    uint8_t idx = 0;
+
+    /* Variable to define LSB */
+    uint16_t lsb;
+
+    /* Variable to define MSB */
+    uint16_t msb;
+
+    /* Variable to define a word */
+    uint16_t lsb_msb;
+
+    lock_dev(dev);
+
+    if (i3c_tc_res != NULL)
+    {
+        /* Set the tap base address to feature engine transmission address to start DMA transaction */
+        rslt = bmi3_set_regs(BMI3_REG_FEATURE_DATA_ADDR, base_addr, 2, dev);
+
+        if (rslt == BMI3_OK)
+        {
+            /* Get the configuration from the feature engine register where tap feature resides */
+            rslt = bmi3_get_regs(BMI3_REG_FEATURE_DATA_TX, i3c_sync_i3c_tc_res, 2, dev);
+
+            if (rslt == BMI3_OK)
+            {
+                /* Get word to calculate i3c_tc_res from the same word */
+                lsb = (uint16_t) i3c_sync_i3c_tc_res[idx++];
+                msb = ((uint16_t) i3c_sync_i3c_tc_res[idx++] << 8);
+                lsb_msb = lsb | msb;
+
+                /* Get i3c_tc_res */
+                *i3c_tc_res = (uint8_t)(lsb_msb & BMI3_I3C_SYNC_FILTER_EN_MASK);
+            }
+        }
+    }
+    else
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
+
+    unlock_dev(dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This internal API sets i3c sync i3c_tc_res
+ */
+int8_t bmi3_set_i3c_sync_i3c_tc_res(uint8_t i3c_tc_res, struct bmi3_dev *dev)
+{
+    /* Variable to store result of API */
+    int8_t rslt;
+
+    /* Array to define the feature configuration */
+    uint8_t i3c_sync_i3c_tc_res[2] = { 0 };
+
+    /* Array to set the base address of i3c sync feature */
+    uint8_t base_addr[2] = { BMI3_BASE_ADDR_I3C_SYNC, 0 };
+
+    lock_dev(dev);
+
+    /* Set the tap base address to feature engine transmission address to start DMA transaction */
+    rslt = bmi3_set_regs(BMI3_REG_FEATURE_DATA_ADDR, base_addr, 2, dev);
+
+    if (rslt == BMI3_OK)
+    {
+        /* Set i3c_tc_res */
+        i3c_sync_i3c_tc_res[0] = BMI3_SET_BIT_POS0(i3c_sync_i3c_tc_res[0], BMI3_I3C_SYNC_FILTER_EN, i3c_tc_res);
+
+        /* Left shift by 8 times so that we can set rest of the values of i3c_tc_res data in word */
+        i3c_sync_i3c_tc_res[1] = (uint8_t)(i3c_sync_i3c_tc_res[1] << 8);
+
+        /* Set the configuration back to the feature engine register */
+        rslt = bmi3_set_regs(BMI3_REG_FEATURE_DATA_TX, i3c_sync_i3c_tc_res, 2, dev);
+    }
+
+    unlock_dev(dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API is used to enable accel and gyro for alternate configuration
+ */
+int8_t bmi3_alternate_config_ctrl(uint8_t config_en, uint8_t alt_rst_conf, struct bmi3_dev *dev)
+{
+    /* Variable to store result of API */
+    int8_t rslt;
+
+    uint8_t data[2] = { 0 };
+
+    lock_dev(dev);
+
+    rslt = bmi3_get_regs(BMI3_REG_ALT_CONF, data, 2, dev);
+
+    if (rslt == BMI3_OK)
+    {
+        data[0] = (config_en & (BMI3_ALT_ACC_ENABLE | BMI3_ALT_GYR_ENABLE));
+        data[1] = (alt_rst_conf & BMI3_ALT_CONF_RESET_ON);
+
+        rslt = bmi3_set_regs(BMI3_REG_ALT_CONF, data, 2, dev);
+    }
+
+    unlock_dev(dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API is used to read the status of alternate configuration
+ */
+int8_t bmi3_read_alternate_status(struct bmi3_alt_status *alt_status, struct bmi3_dev *dev)
+{
+    /* Variable to store result of API */
+    int8_t rslt;
+
+    uint8_t data[2] = { 0 };
+
+    if (alt_status != NULL)
+    {
+        rslt = bmi3_get_regs(BMI3_REG_ALT_STATUS, data, 2, dev);
+
+        if (rslt == BMI3_OK)
+        {
+            alt_status->alt_accel_status = (data[0] & BMI3_ALT_ACCEL_STATUS_MASK);
+            alt_status->alt_gyro_status = (data[0] & BMI3_ALT_GYRO_STATUS_MASK) >> BMI3_ALT_GYRO_STATUS_POS;
+        }
+    }
+    else
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This API initializes the health monitor, the first snapshot is
+ * taken by the next poll.
+ */
+int8_t bmi3_health_init(uint16_t period, struct bmi3_health *health)
+{
+    /* Variable to store result of API */
+    int8_t rslt = BMI3_OK;
+
+    if (health == NULL)
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
+    else if (period == 0)
+    {
+        rslt = BMI3_E_INVALID_INPUT;
+    }
+    else
+    {
+        health->err_reg.fatal_err = 0;
+        health->err_reg.feat_eng_ovrld = 0;
+        health->err_reg.feat_eng_wd = 0;
+        health->err_reg.acc_conf_err = 0;
+        health->err_reg.gyr_conf_err = 0;
+        health->err_reg.i3c_error0 = 0;
+        health->err_reg.i3c_error3 = 0;
+        health->alt_status.alt_accel_status = 0;
+        health->alt_status.alt_gyro_status = 0;
+        health->status = 0;
+        health->feature_status = 0;
+        health->faults = 0;
+        health->period = period;
+        health->countdown = 1;
+        health->snapshots = 0;
+        health->faulty = 0;
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This API takes a health snapshot of the error, sensor status,
+ * feature engine and alternate configuration status registers every
+ * "period" calls.
+ */
+int8_t bmi3_health_poll(struct bmi3_health *health, struct bmi3_dev *dev)
+{
+    /* Variable to store result of API */
+    int8_t rslt;
+
+    /* Array to store the error and status registers */
+    uint8_t reg_data[4] = { 0 };
+
+    /* Array to store the feature engine status and alternate configuration registers */
+    uint8_t feature_io1[2] = { 0 };
+    uint8_t alt_conf[2] = { 0 };
+    uint8_t alt_status[2] = { 0 };
+
+    lock_dev(dev);
+
+    rslt = null_ptr_check(dev);
+
+    if ((rslt == BMI3_OK) && (health == NULL))
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
+
+    if ((rslt == BMI3_OK) && (--health->countdown == 0))
+    {
+        health->countdown = health->period;
+
+        /* Error and status registers are adjacent, interrupt status up to feature IO1 is clear-on-read */
+        rslt = bmi3_get_regs(BMI3_REG_ERR_REG, reg_data, 4, dev);
+
+        if (rslt == BMI3_OK)
+        {
+            rslt = bmi3_get_regs(BMI3_REG_FEATURE_IO1, feature_io1, 2, dev);
+        }
+
+        /* Alternate status is read only if switching is enabled in the cached alternate configuration */
+        if ((rslt == BMI3_OK) &&
+            ((cache_read(BMI3_REG_ALT_CONF, alt_conf, 2, dev) == BMI3_DISABLE) ||
+             (alt_conf[0] & (BMI3_ALT_ACC_EN_MASK | BMI3_ALT_GYR_EN_MASK))))
+        {
+            rslt = bmi3_get_regs(BMI3_REG_ALT_STATUS, alt_status, 2, dev);
+        }
+
+        if (rslt == BMI3_OK)
+        {
+            unpack_err_reg(reg_data, &health->err_reg);
+            health->status = (uint16_t)(reg_data[2] | ((uint16_t)reg_data[3] << 8));
+            health->feature_status = (uint16_t)(feature_io1[0] | ((uint16_t)feature_io1[1] << 8));
+            health->alt_status.alt_accel_status = (alt_status[0] & BMI3_ALT_ACCEL_STATUS_MASK);
+            health->alt_status.alt_gyro_status = (alt_status[0] & BMI3_ALT_GYRO_STATUS_MASK) >>
+                                                 BMI3_ALT_GYRO_STATUS_POS;
+
+            health->faults = get_health_faults(health);
+            health->snapshots++;
+
+            if (health->faults != 0)
+            {
+                health->faulty++;
+            }
+
+            /* Configuration of the sensor is lost by a reset, the shadow registers are stale */
+            if (health->faults & BMI3_HEALTH_POR)
+            {
+                invalidate_reg_cache(dev);
+            }
+        }
+    }
+
+    unlock_dev(dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API gets offset dgain for the sensor which stores self-calibrated values for accel.
+ */
+int8_t bmi3_get_acc_dp_off_dgain(struct bmi3_acc_dp_gain_offset *acc_dp_gain_offset, struct bmi3_dev *dev)
+{
+    /* Variable to store result of API */
+    int8_t rslt;
+
+    uint8_t reg_data[12] = { 0 };
+
+    uint16_t acc_dp_off_x, acc_dp_off_y, acc_dp_off_z;
+    uint8_t acc_dp_dgain_x, acc_dp_dgain_y, acc_dp_dgain_z;
+
+    lock_dev(dev);
+
+    /* NULL pointer check */
+    if (acc_dp_gain_offset != NULL)
+    {
+        /* Get temperature user offset for accel */
+        rslt = bmi3_get_regs(BMI3_REG_ACC_DP_OFF_X, reg_data, 12, dev);
+
+        if (rslt == BMI3_OK)
+        {
+            acc_dp_off_x = (uint16_t)(((uint16_t)reg_data[1] << 8) | reg_data[0]);
+            acc_dp_dgain_x = reg_data[2];
+            acc_dp_off_y = (uint16_t)(((uint16_t)reg_data[5] << 8) | reg_data[4]);
+            acc_dp_dgain_y = reg_data[6];
+            acc_dp_off_z = (uint16_t)(((uint16_t)reg_data[9] << 8) | reg_data[8]);
+            acc_dp_dgain_z = reg_data[10];
+
+            acc_dp_gain_offset->acc_dp_off_x = (acc_dp_off_x & dev->accel_bit_width);
+            acc_dp_gain_offset->acc_dp_dgain_x = (acc_dp_dgain_x & BMI3_ACC_DP_DGAIN_X_MASK);
+            acc_dp_gain_offset->acc_dp_off_y = (acc_dp_off_y & dev->accel_bit_width);
+            acc_dp_gain_offset->acc_dp_dgain_y = (acc_dp_dgain_y & BMI3_ACC_DP_DGAIN_Y_MASK);
+            acc_dp_gain_offset->acc_dp_off_z = (acc_dp_off_z & dev->accel_bit_width);
+            acc_dp_gain_offset->acc_dp_dgain_z = (acc_dp_dgain_z & BMI3_ACC_DP_DGAIN_Z_MASK);
+        }
+    }
+    else
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
+
+    unlock_dev(dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API gets offset dgain for the sensor which stores self-calibrated values for gyro.
+ */
+int8_t bmi3_get_gyro_dp_off_dgain(struct bmi3_gyr_dp_gain_offset *gyr_dp_gain_offset, struct bmi3_dev *dev)
+{
+    /* Variable to store result of API */
+    int8_t rslt;
+
+    uint8_t reg_data[12];
+
+    uint16_t gyr_dp_off_x, gyr_dp_off_y, gyr_dp_off_z;
+    uint8_t gyr_dp_dgain_x, gyr_dp_dgain_y, gyr_dp_dgain_z;
+
+    lock_dev(dev);
+
+    /* NULL pointer check */
+    if (gyr_dp_gain_offset != NULL)
+    {
+        /* Get temperature user offset for gyro */
+        rslt = bmi3_get_regs(BMI3_REG_GYR_DP_OFF_X, reg_data, 12, dev);
+
+        if (rslt == BMI3_OK)
+        {
+            gyr_dp_off_x = (uint16_t)(((uint16_t)reg_data[1] << 8) | reg_data[0]);
+            gyr_dp_dgain_x = reg_data[2];
+            gyr_dp_off_y = (uint16_t)(((uint16_t)reg_data[5] << 8) | reg_data[4]);
+            gyr_dp_dgain_y = reg_data[6];
+            gyr_dp_off_z = (uint16_t)(((uint16_t)reg_data[9] << 8) | reg_data[8]);
+            gyr_dp_dgain_z = reg_data[10];
+
+            gyr_dp_gain_offset->gyr_dp_off_x = BMI3_GET_BIT_POS0(gyr_dp_off_x, BMI3_GYR_DP_OFF_X);
+            gyr_dp_gain_offset->gyr_dp_dgain_x = BMI3_GET_BIT_POS0(gyr_dp_dgain_x, BMI3_GYR_DP_DGAIN_X);
+            gyr_dp_gain_offset->gyr_dp_off_y = BMI3_GET_BIT_POS0(gyr_dp_off_y, BMI3_GYR_DP_OFF_Y);
+            gyr_dp_gain_offset->gyr_dp_dgain_y = BMI3_GET_BIT_POS0(gyr_dp_dgain_y, BMI3_GYR_DP_DGAIN_Y);
+            gyr_dp_gain_offset->gyr_dp_off_z = BMI3_GET_BIT_POS0(gyr_dp_off_z, BMI3_GYR_DP_OFF_Z);
+            gyr_dp_gain_offset->gyr_dp_dgain_z = BMI3_GET_BIT_POS0(gyr_dp_dgain_z, BMI3_GYR_DP_DGAIN_Z);
+        }
+    }
+    else
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
+
+    unlock_dev(dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API sets offset dgain for the sensor which stores self-calibrated values for accel.
+ */
+int8_t bmi3_set_acc_dp_off_dgain(const struct bmi3_acc_dp_gain_offset *acc_dp_gain_offset, struct bmi3_dev *dev)
+{
+    /* Variable to store result of API */
+    int8_t rslt;
+
+    uint8_t acc_dp_gain_x, acc_dp_gain_y, acc_dp_gain_z;
+
+    uint16_t acc_dp_off_x1, acc_dp_off_y1, acc_dp_off_z1;
+
+    uint8_t acc_off_gain[12] = { 0 };
+
+    lock_dev(dev);
+
+    /* Null-pointer check */
+    rslt = null_ptr_check(dev);
+
+    /* NULL pointer check */
+    if ((rslt == BMI3_OK) && (acc_dp_gain_offset != NULL))
+    {
+        acc_dp_off_x1 = (acc_dp_gain_offset->acc_dp_off_x & dev->accel_bit_width);
+
+        acc_dp_gain_x = (uint8_t)(acc_dp_gain_offset->acc_dp_dgain_x & BMI3_ACC_DP_DGAIN_X_MASK);
+
+        acc_dp_off_y1 = (acc_dp_gain_offset->acc_dp_off_y & dev->accel_bit_width);
+
+        acc_dp_gain_y = (uint8_t)(acc_dp_gain_offset->acc_dp_dgain_y & BMI3_ACC_DP_DGAIN_Y_MASK);
+
+        acc_dp_off_z1 = (acc_dp_gain_offset->acc_dp_off_z & dev->accel_bit_width);
+
+        acc_dp_gain_z = (uint8_t)(acc_dp_gain_offset->acc_dp_dgain_z & BMI3_ACC_DP_DGAIN_Z_MASK);
+
+        acc_off_gain[0] = (uint8_t)(acc_dp_off_x1 & BMI3_SET_LOW_BYTE);
+        acc_off_gain[1] = (acc_dp_off_x1 & BMI3_SET_HIGH_BYTE) >> 8;
+        acc_off_gain[2] = acc_dp_gain_x;
+        acc_off_gain[4] = (uint8_t)(acc_dp_off_y1 & BMI3_SET_LOW_BYTE);
+        acc_off_gain[5] = (acc_dp_off_y1 & BMI3_SET_HIGH_BYTE) >> 8;
+        acc_off_gain[6] = acc_dp_gain_y;
+        acc_off_gain[8] = (uint8_t)(acc_dp_off_z1 & BMI3_SET_LOW_BYTE);
+        acc_off_gain[9] = (acc_dp_off_z1 & BMI3_SET_HIGH_BYTE) >> 8;
+        acc_off_gain[10] = acc_dp_gain_z;
+
+        /* Set dp offset for accel */
+        rslt = bmi3_set_regs(BMI3_REG_ACC_DP_OFF_X, acc_off_gain, 12, dev);
+    }
+    else
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
+
+    unlock_dev(dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API sets offset dgain for the sensor which stores self-calibrated values for gyro.
+ */
+int8_t bmi3_set_gyro_dp_off_dgain(const struct bmi3_gyr_dp_gain_offset *gyr_dp_gain_offset, struct bmi3_dev *dev)
+{
+    /* Variable to store result of API */
+    int8_t rslt;
+
+    uint8_t gyr_off_gain[12] = { 0 };
+
+    lock_dev(dev);
+
+    /* NULL pointer check */
+    if (gyr_dp_gain_offset != NULL)
+    {
+        pack_gyro_dp_off_dgain(gyr_dp_gain_offset, gyr_off_gain);
+
+        /* Set dp offset for gyro */
+        rslt = bmi3_set_regs(BMI3_REG_GYR_DP_OFF_X, gyr_off_gain, 12, dev);
+    }
+    else
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
+
+    unlock_dev(dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API initializes the online gyro bias tracker.
+ */
+int8_t bmi3_gyro_bias_init(uint8_t range,
+                           uint16_t min_samples,
+                           uint8_t gain_shift,
+                           struct bmi3_gyro_bias *bias,
+                           struct bmi3_dev *dev)
+{
+    /* Variable to store result of API */
+    int8_t rslt;
+
+    if (bias != NULL)
+    {
+        if ((range <= BMI3_GYR_RANGE_2000DPS) && (min_samples != 0) && (gain_shift <= 7))
+        {
+            bias->sum[0] = 0;
+            bias->sum[1] = 0;
+            bias->sum[2] = 0;
+            bias->n = 0;
+            bias->min_samples = min_samples;
+            bias->updates = 0;
+            bias->range = range;
+            bias->gain_shift = gain_shift;
+            bias->still = BMI3_DISABLE;
+
+            rslt = bmi3_get_gyro_dp_off_dgain(&bias->dp, dev);
+        }
+        else
+        {
+            rslt = BMI3_E_INVALID_INPUT;
+        }
+    }
+    else
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This API feeds the gyro bias tracker with a burst of FIFO samples.
+ */
+int8_t bmi3_gyro_bias_update(uint16_t int_status,
+                             const struct bmi3_fifo_sens_axes_data *gyro_data,
+                             uint16_t n_frames,
+                             struct bmi3_gyro_bias *bias,
+                             struct bmi3_dev *dev)
+{
+    /* Variable to store result of API */
+    int8_t rslt = BMI3_OK;
+
+    /* Variable to define loop */
+    uint16_t idx;
+
+    /* Data path offsets before and after the estimate */
+    uint16_t old_off[3];
+    uint16_t *off[3];
+
+    /* Variables to store index of the first and last offset which changes */
+    uint8_t first = 3, last = 0;
+
+    /* Variable to store the register image of the offsets and gains */
+    uint8_t gyr_off_gain[12] = { 0 };
+
+    if ((gyro_data != NULL) && (bias != NULL) && (dev != NULL))
+    {
+        /* Motion ends the interval even if both interrupts are pending */
+        if (int_status & BMI3_INT_STATUS_ANY_MOTION)
+        {
+            bias->still = BMI3_DISABLE;
+        }
+        else if (int_status & BMI3_INT_STATUS_NO_MOTION)
+        {
+            bias->still = BMI3_ENABLE;
+        }
+
+        if (bias->still == BMI3_DISABLE)
+        {
+            bias->sum[0] = 0;
+            bias->sum[1] = 0;
+            bias->sum[2] = 0;
+            bias->n = 0;
+        }
+        else
+        {
+            for (idx = 0; idx < n_frames; idx++)
+            {
+                bias->sum[0] += gyro_data[idx].x;
+                bias->sum[1] += gyro_data[idx].y;
+                bias->sum[2] += gyro_data[idx].z;
+            }
+
+            bias->n += n_frames;
+        }
+
+        if ((bias->still == BMI3_ENABLE) && (bias->n >= bias->min_samples))
+        {
+            off[0] = &bias->dp.gyr_dp_off_x;
+            off[1] = &bias->dp.gyr_dp_off_y;
+            off[2] = &bias->dp.gyr_dp_off_z;
+
+            for (idx = 0; idx < 3; idx++)
+            {
+                old_off[idx] = *off[idx];
+                *off[idx] = correct_gyro_dp_off(*off[idx], bias->sum[idx], bias);
+
+                if (*off[idx] != old_off[idx])
+                {
+                    first = (idx < first) ? (uint8_t)idx : first;
+                    last = (uint8_t)idx;
+                }
+
+                bias->sum[idx] = 0;
+            }
+
+            bias->n = 0;
+
+            if (first < 3)
+            {
+                /* Offset of each axis is followed by its gain, only the span of changed offsets is written */
+                pack_gyro_dp_off_dgain(&bias->dp, gyr_off_gain);
+                rslt = bmi3_set_regs((uint8_t)(BMI3_REG_GYR_DP_OFF_X + (first * 2)),
+                                     &gyr_off_gain[first * 4],
+                                     (uint16_t)(((last - first) * 4) + 2),
+                                     dev);
+
+                if (rslt == BMI3_OK)
+                {
+                    bias->updates++;
+                }
+            }
+        }
+    }
+    else
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This API initializes the step cadence.
+ */
+int8_t bmi3_step_cadence_init(uint16_t watermark_level, struct bmi3_step_cadence *cadence, struct bmi3_dev *dev)
+{
+    /* Variable to store result of API */
+    int8_t rslt;
+
+    /* Structure to define the step counter configuration */
+    struct bmi3_sens_config config = { 0 };
+
+    lock_dev(dev);
+
+    /* Null-pointer check */
+    rslt = null_ptr_check(dev);
+
+    if ((rslt == BMI3_OK) && (cadence == NULL))
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
+
+    if ((rslt == BMI3_OK) && (watermark_level > BMI3_STEP_WATERMARK_MASK))
+    {
+        rslt = BMI3_E_INVALID_INPUT;
+    }
+
+    if (rslt == BMI3_OK)
+    {
+        config.type = BMI3_STEP_COUNTER;
+
+        rslt = bmi3_get_sensor_config(&config, 1, dev);
+    }
+
+    if ((rslt == BMI3_OK) && (config.cfg.step_counter.watermark_level != watermark_level))
+    {
+        config.cfg.step_counter.watermark_level = watermark_level;
+
+        rslt = bmi3_set_sensor_config(&config, 1, dev);
+    }
+
+    if (rslt == BMI3_OK)
+    {
+        rslt = bmi3_get_sensor_time(&cadence->last_time, dev);
+    }
+
+    if (rslt == BMI3_OK)
+    {
+        rslt = get_step_counter_sensor_data(&cadence->last_count, BMI3_REG_FEATURE_IO2, dev);
+    }
+
+    if (rslt == BMI3_OK)
+    {
+        cadence->steps = 0;
+        cadence->cadence_mhz = 0;
+        cadence->interval_avg_us = 0;
+        cadence->interval_dev_us = 0;
+        cadence->interval_min_us = 0;
+        cadence->interval_max_us = 0;
+        cadence->updates = 0;
+        cadence->bouts = 0;
+        cadence->in_bout = BMI3_DISABLE;
+    }
+
+    unlock_dev(dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API updates the step cadence on a step interrupt.
+ */
+int8_t bmi3_step_cadence_update(uint16_t int_status, struct bmi3_step_cadence *cadence, struct bmi3_dev *dev)
+{
+    /* Variable to store result of API */
+    int8_t rslt;
+
+    /* Variables to store the sensor time and step count of the increment */
+    uint32_t sensor_time = 0;
+    uint32_t step_count = 0;
+
+    lock_dev(dev);
+
+    /* Null-pointer check */
+    rslt = null_ptr_check(dev);
+
+    if ((rslt == BMI3_OK) && (cadence == NULL))
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
+
+    if ((rslt == BMI3_OK) && (int_status & (BMI3_INT_STATUS_STEP_COUNTER | BMI3_INT_STATUS_STEP_DETECTOR)))
+    {
+        rslt = bmi3_get_sensor_time(&sensor_time, dev);
+
+        if (rslt == BMI3_OK)
+        {
+            rslt = get_step_counter_sensor_data(&step_count, BMI3_REG_FEATURE_IO2, dev);
+        }
+
+        if (rslt == BMI3_OK)
+        {
+            add_step_increment(step_count, sensor_time, cadence);
+        }
+    }
+
+    unlock_dev(dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API gets user offset dgain for the sensor which stores self-calibrated values for accel.
+ */
+int8_t bmi3_get_user_acc_off_dgain(struct bmi3_acc_usr_gain_offset *acc_usr_gain_offset, struct bmi3_dev *dev)
+{
+    /* Variable to store result of API */
+    int8_t rslt;
+
+    uint8_t reg_data[12];
+
+    uint8_t base_addr[2] = { BMI3_BASE_ADDR_ACC_OFFSET_GAIN, 0 };
+
+    lock_dev(dev);
+
+    /* NULL pointer check */
+    if (acc_usr_gain_offset != NULL)
+    {
+        /* Set the user accel offset base address to feature engine transmission address to start DMA transaction */
+        rslt = bmi3_set_regs(BMI3_REG_FEATURE_DATA_ADDR, base_addr, 2, dev);
+
+        if (rslt == BMI3_OK)
+        {
+            /* Get the configuration from the feature engine register */
+            rslt = bmi3_get_regs(BMI3_REG_FEATURE_DATA_TX, reg_data, 12, dev);
+
+            if (rslt == BMI3_OK)
+            {
+                acc_usr_gain_offset->acc_usr_off_x =
+                    (uint16_t)((((uint16_t)reg_data[1] << 8) | reg_data[0]) & BMI3_ACC_USR_OFF_X_MASK);
+                acc_usr_gain_offset->acc_usr_off_y =
+                    (uint16_t)((((uint16_t)reg_data[3] << 8) | reg_data[2]) & BMI3_ACC_USR_OFF_Y_MASK);
+                acc_usr_gain_offset->acc_usr_off_z =
+                    (uint16_t)((((uint16_t)reg_data[5] << 8) | reg_data[4]) & BMI3_ACC_USR_OFF_Z_MASK);
+                acc_usr_gain_offset->acc_usr_gain_x = (uint8_t)(reg_data[6] & BMI3_ACC_USR_GAIN_X_MASK);
+                acc_usr_gain_offset->acc_usr_gain_y = (uint8_t)(reg_data[8] & BMI3_ACC_USR_GAIN_Y_MASK);
+                acc_usr_gain_offset->acc_usr_gain_z = (uint8_t)(reg_data[10] & BMI3_ACC_USR_GAIN_Z_MASK);
+            }
+        }
+    }
+    else
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
+
+    unlock_dev(dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API sets user offset dgain for the sensor which stores self-calibrated values for accel.
+ */
+int8_t bmi3_set_user_acc_off_dgain(const struct bmi3_acc_usr_gain_offset *acc_usr_gain_offset, struct bmi3_dev *dev)
+{
+    /* Variable to store result of API */
+    int8_t rslt;
+
+    uint8_t acc_usr_gain_x, acc_usr_gain_y, acc_usr_gain_z;
+
+    uint16_t acc_usr_off_x1, acc_usr_off_y1, acc_usr_off_z1;
+
+    uint16_t acc_usr_off_x2, acc_usr_off_y2, acc_usr_off_z2;
+
+    uint16_t acc_usr_off_x, acc_usr_off_y, acc_usr_off_z;
+
+    uint8_t reg_data[12] = { 0 };
+
+    uint8_t user_acc_off_gain[12] = { 0 };
+
+    uint8_t base_addr[2] = { BMI3_BASE_ADDR_ACC_OFFSET_GAIN, 0 };
+
+    lock_dev(dev);
+
+    /* NULL pointer check */
+    if (acc_usr_gain_offset != NULL)
+    {
+        /* Set the user accel offset base address to feature engine transmission address to start DMA transaction */
+        rslt = bmi3_set_regs(BMI3_REG_FEATURE_DATA_ADDR, base_addr, 2, dev);
+
+        if (rslt == BMI3_OK)
+        {
+            acc_usr_off_x1 = BMI3_SET_BIT_POS0(reg_data[0], BMI3_ACC_USR_OFF_X, acc_usr_gain_offset->acc_usr_off_x);
+
+            acc_usr_off_x = ((uint16_t)reg_data[1] << 8);
+
+            acc_usr_off_x2 = BMI3_SET_BIT_POS0(acc_usr_off_x, BMI3_ACC_USR_OFF_X, acc_usr_gain_offset->acc_usr_off_x);
+
+            acc_usr_off_y1 = BMI3_SET_BIT_POS0(reg_data[2], BMI3_ACC_USR_OFF_Y, acc_usr_gain_offset->acc_usr_off_y);
+
+            acc_usr_off_y = ((uint16_t)reg_data[3] << 8);
+
+            acc_usr_off_y2 = BMI3_SET_BIT_POS0(acc_usr_off_y, BMI3_ACC_USR_OFF_Y, acc_usr_gain_offset->acc_usr_off_y);
+
+            acc_usr_off_z1 = BMI3_SET_BIT_POS0(reg_data[4], BMI3_ACC_USR_OFF_Z, acc_usr_gain_offset->acc_usr_off_z);
+
+            acc_usr_off_z = ((uint16_t)reg_data[5] << 8);
+
+            acc_usr_off_z2 = BMI3_SET_BIT_POS0(acc_usr_off_z, BMI3_ACC_USR_OFF_Z, acc_usr_gain_offset->acc_usr_off_z);
+
+            acc_usr_gain_x = BMI3_SET_BIT_POS0(reg_data[6], BMI3_ACC_USR_GAIN_X, acc_usr_gain_offset->acc_usr_gain_x);
+
+            acc_usr_gain_y = BMI3_SET_BIT_POS0(reg_data[8], BMI3_ACC_USR_GAIN_Y, acc_usr_gain_offset->acc_usr_gain_y);
+
+            acc_usr_gain_z = BMI3_SET_BIT_POS0(reg_data[10], BMI3_ACC_USR_GAIN_Z, acc_usr_gain_offset->acc_usr_gain_z);
+
+            user_acc_off_gain[0] = (uint8_t)acc_usr_off_x1;
+            user_acc_off_gain[1] = acc_usr_off_x2 >> 8;
+            user_acc_off_gain[2] = (uint8_t)acc_usr_off_y1;
+            user_acc_off_gain[3] = acc_usr_off_y2 >> 8;
+            user_acc_off_gain[4] = (uint8_t)acc_usr_off_z1;
+            user_acc_off_gain[5] = acc_usr_off_z2 >> 8;
+            user_acc_off_gain[6] = acc_usr_gain_x;
+            user_acc_off_gain[8] = acc_usr_gain_y;
+            user_acc_off_gain[10] = acc_usr_gain_z;
+
+            /* Set the configuration to the feature engine register */
+            rslt = bmi3_set_regs(BMI3_REG_FEATURE_DATA_TX, user_acc_off_gain, 12, dev);
+        }
+    }
+    else
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
+
+    unlock_dev(dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API performs Fast Offset Compensation for accelerometer.
+ */
+int8_t bmi3_perform_accel_foc(const struct bmi3_accel_foc_g_value *accel_g_value, struct bmi3_dev *dev)
+{
+    /* Variable to store result of API */
+    int8_t rslt;
+
+    /* Structure to define the accelerometer configurations */
+    struct bmi3_accel_config acc_cfg = { 0 };
+    struct bmi3_sens_config config = { 0 };
+
+    lock_dev(dev);
+
+    /* Configure the type */
+    config.type = BMI3_ACCEL;
+
+    /* Null-pointer check */
+    rslt = null_ptr_check(dev);
+
+    if ((rslt == BMI3_OK) && (accel_g_value != NULL))
+    {
+        /* Check for input validity */
+        if ((((BMI3_ABS(accel_g_value->x)) + (BMI3_ABS(accel_g_value->y)) + (BMI3_ABS(accel_g_value->z))) == 1) &&
+            ((accel_g_value->sign == 1) || (accel_g_value->sign == 0)))
+        {
+            rslt = verify_foc_position(BMI3_ACCEL, accel_g_value, dev);
+
+            if (rslt == BMI3_OK)
+            {
+                /* Get accelerometer configurations */
+                rslt = bmi3_get_sensor_config(&config, 1, dev);
+            }
+
+            /* Perform accelerometer FOC */
+            if (rslt == BMI3_OK)
+            {
+                rslt = perform_accel_foc(accel_g_value, &acc_cfg, dev);
+            }
+
+            /* Set the configurations */
+            if (rslt == BMI3_OK)
+            {
+                rslt = bmi3_set_sensor_config(&config, 1, dev);
+            }
+        }
+        else
+        {
+            rslt = BMI3_E_INVALID_INPUT;
+        }
+    }
+    else
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
+
+    unlock_dev(dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API prepares a resumable soft-reset.
+ */
+int8_t bmi3_op_soft_reset(struct bmi3_op *op)
+{
+    /* Variable to store result of API */
+    int8_t rslt = BMI3_OK;
+
+    if (op != NULL)
+    {
+        op_init(BMI3_OP_SOFT_RESET, op);
+    }
+    else
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This API prepares a resumable self-test.
+ */
+int8_t bmi3_op_self_test(uint8_t st_selection, struct bmi3_st_result *st_result_status, struct bmi3_op *op)
+{
+    /* Variable to store result of API */
+    int8_t rslt = BMI3_OK;
+
+    if ((op != NULL) && (st_result_status != NULL))
+    {
+        op_init(BMI3_OP_SELF_TEST, op);
+        op->selection = st_selection;
+        op->st_result = st_result_status;
+    }
+    else
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This API prepares a resumable gyro self-calibration.
+ */
+int8_t bmi3_op_gyro_sc(uint8_t sc_selection,
+                       uint8_t apply_corr,
+                       struct bmi3_self_calib_rslt *sc_rslt,
+                       struct bmi3_op *op)
+{
+    /* Variable to store result of API */
+    int8_t rslt = BMI3_OK;
+
+    if ((op != NULL) && (sc_rslt != NULL))
+    {
+        op_init(BMI3_OP_GYRO_SC, op);
+        op->selection = sc_selection;
+        op->apply_corr = apply_corr;
+        op->sc_rslt = sc_rslt;
+    }
+    else
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This API prepares a resumable upload of a config array.
+ */
+int8_t bmi3_op_upload_config_array(const uint8_t *config_array, uint16_t config_size, struct bmi3_op *op)
+{
+    /* Variable to store result of API */
+    int8_t rslt = BMI3_OK;
+
+    if ((op == NULL) || (config_array == NULL))
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
+    else if (config_size <= BMI3_CONFIG_ARRAY_DATA_START_ADDR)
+    {
+        rslt = BMI3_E_INVALID_INPUT;
+    }
+    else
+    {
+        op_init(BMI3_OP_UPLOAD_CONFIG, op);
+        op->config_array = config_array;
+        op->config_size = config_size;
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This API prepares a resumable accel FOC.
+ */
+int8_t bmi3_op_accel_foc(const struct bmi3_accel_foc_g_value *accel_g_value, struct bmi3_op *op)
+{
+    /* Variable to store result of API */
+    int8_t rslt = BMI3_OK;
+
+    if ((op == NULL) || (accel_g_value == NULL))
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
+    else if ((((BMI3_ABS(accel_g_value->x)) + (BMI3_ABS(accel_g_value->y)) + (BMI3_ABS(accel_g_value->z))) != 1) ||
+             (accel_g_value->sign > 1))
+    {
+        rslt = BMI3_E_INVALID_INPUT;
+    }
+    else
+    {
+        op_init(BMI3_OP_ACCEL_FOC, op);
+        op->accel_g_value = accel_g_value;
+
+        /* First sample is polled after a period of the 50Hz ODR */
+        op->wait_us = BMI3_OP_FOC_DELAY;
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This API runs the next step of a resumable operation.
+ */
+int8_t bmi3_op_step(struct bmi3_op *op, struct bmi3_dev *dev)
+{
+    /* Variable to store result of API */
+    int8_t rslt;
+
+    lock_dev(dev);
+
+    /* Null-pointer check */
+    rslt = null_ptr_check(dev);
+
+    if ((rslt == BMI3_OK) && (op == NULL))
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
+
+    if (rslt == BMI3_OK)
+    {
+        op->wait_us = 0;
+
+        switch (op->kind)
+        {
+            case BMI3_OP_SOFT_RESET:
+                rslt = op_soft_reset(op, dev);
+                break;
+
+            case BMI3_OP_SELF_TEST:
+                rslt = op_self_test(op, dev);
+                break;
+
+            case BMI3_OP_GYRO_SC:
+                rslt = op_gyro_sc(op, dev);
+                break;
+
+            case BMI3_OP_UPLOAD_CONFIG:
+                rslt = op_upload_config_array(op, dev);
+                break;
+
+            case BMI3_OP_ACCEL_FOC:
+                rslt = op_accel_foc(op, dev);
+                break;
+
+            default:
+                rslt = BMI3_E_INVALID_STATUS;
+                break;
+        }
+
+        /* Operation is complete, successfully or not */
+        if (rslt != BMI3_W_OP_PENDING)
+        {
+            op->kind = BMI3_OP_NONE;
+        }
+    }
+
+    unlock_dev(dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API initializes a calibration line over the devices of a group.
+ */
+int8_t bmi3_calib_line_init(const uint8_t *plan,
+                            uint8_t n_plan,
+                            const struct bmi3_accel_foc_g_value *accel_g_value,
+                            const struct bmi3_dev_group *group,
+                            struct bmi3_calib_line *line)
+{
+    /* Variable to store result of API */
+    int8_t rslt = BMI3_OK;
+
+    /* Variable to define loop */
+    uint8_t idx;
+
+    if ((plan == NULL) || (group == NULL) || (line == NULL))
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
+    else if ((n_plan == 0) || (n_plan > BMI3_CALIB_PLAN_MAX) || (group->n_dev == 0) ||
+             (group->n_dev > BMI3_GROUP_MAX_DEV))
+    {
+        rslt = BMI3_E_INVALID_INPUT;
+    }
+    else
+    {
+        for (idx = 0; (idx < n_plan) && (rslt == BMI3_OK); idx++)
+        {
+            if ((plan[idx] != BMI3_OP_SOFT_RESET) && (plan[idx] != BMI3_OP_SELF_TEST) &&
+                (plan[idx] != BMI3_OP_GYRO_SC) && (plan[idx] != BMI3_OP_ACCEL_FOC))
+            {
+                rslt = BMI3_E_INVALID_INPUT;
+            }
+            else if ((plan[idx] == BMI3_OP_ACCEL_FOC) && (accel_g_value == NULL))
+            {
+                rslt = BMI3_E_NULL_PTR;
+            }
+            else
+            {
+                line->plan[idx] = plan[idx];
+            }
+        }
+
+        for (idx = 0; (idx < group->n_dev) && (rslt == BMI3_OK); idx++)
+        {
+            rslt = null_ptr_check(group->dev[idx]);
+        }
+    }
+
+    if (rslt == BMI3_OK)
+    {
+        for (idx = 0; idx < group->n_dev; idx++)
+        {
+            line->unit[idx].dev = group->dev[idx];
+            line->unit[idx].op.kind = BMI3_OP_NONE;
+            line->unit[idx].wait_us = 0;
+            line->unit[idx].next = 0;
+            line->unit[idx].done = BMI3_DISABLE;
+            line->unit[idx].rslt = BMI3_OK;
+            line->unit[idx].failed_op = BMI3_OP_NONE;
+        }
+
+        line->n_plan = n_plan;
+        line->n_unit = group->n_dev;
+        line->pending = group->n_dev;
+        line->st_selection = BMI3_ST_BOTH_ACC_GYR;
+        line->sc_selection = BMI3_SC_SENSITIVITY_EN | BMI3_SC_OFFSET_EN;
+        line->apply_corr = BMI3_ENABLE;
+        line->accel_g_value = accel_g_value;
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This API runs the next step of the units of a calibration line.
+ */
+int8_t bmi3_calib_line_step(uint32_t elapsed_us, uint32_t *wait_us, struct bmi3_calib_line *line)
+{
+    /* Variable to store result of API */
+    int8_t rslt = BMI3_OK;
+
+    /* Variable to define loop */
+    uint8_t idx;
+
+    /* Shortest wait of the running units */
+    uint32_t wait = UINT32_MAX;
+
+    struct bmi3_calib_unit *unit;
+
+    if ((wait_us == NULL) || (line == NULL))
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
+    else
+    {
+        line->pending = 0;
+
+        for (idx = 0; idx < line->n_unit; idx++)
+        {
+            unit = &line->unit[idx];
+
+            if (unit->done == BMI3_DISABLE)
+            {
+                unit->wait_us = (unit->wait_us > elapsed_us) ? (unit->wait_us - elapsed_us) : 0;
+
+                if (unit->wait_us == 0)
+                {
+                    calib_unit_step(line, unit);
+                }
+            }
+
+            if (unit->done == BMI3_DISABLE)
+            {
+                line->pending++;
+
+                if (unit->wait_us < wait)
+                {
+                    wait = unit->wait_us;
+                }
+            }
+        }
+
+        if (line->pending > 0)
+        {
+            *wait_us = wait;
+            rslt = BMI3_W_OP_PENDING;
+        }
+        else
+        {
+            *wait_us = 0;
+        }
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This API runs a calibration line until the plans of all units are complete.
+ */
+int8_t bmi3_calib_line_run(struct bmi3_calib_line *line)
+{
+    /* Variable to store result of API */
+    int8_t rslt;
+
+    /* Time waited before the step */
+    uint32_t wait_us = 0;
+
+    do
+    {
+        rslt = bmi3_calib_line_step(wait_us, &wait_us, line);
+
+        if ((rslt == BMI3_W_OP_PENDING) && (wait_us > 0))
+        {
+            line->unit[0].dev->delay_us(wait_us, line->unit[0].dev->intf_ptr);
+        }
+    } while (rslt == BMI3_W_OP_PENDING);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API initializes a bring-up over several devices.
+ */
+int8_t bmi3_bring_up_init(const struct bmi3_variant *const *variants,
+                          uint8_t n_variants,
+                          const struct bmi3_reg_image *image,
+                          struct bmi3_dev * const *dev,
+                          uint8_t n_dev,
+                          struct bmi3_bring_up *bring_up)
+{
+    /* Variable to store result of API */
+    int8_t rslt = BMI3_OK;
+
+    /* Variable to define loop */
+    uint8_t idx;
+
+    if ((variants == NULL) || (dev == NULL) || (bring_up == NULL))
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
+    else if ((n_variants == 0) || (n_dev == 0) || (n_dev > BMI3_GROUP_MAX_DEV))
+    {
+        rslt = BMI3_E_INVALID_INPUT;
+    }
+    else
+    {
+        for (idx = 0; (idx < n_dev) && (rslt == BMI3_OK); idx++)
+        {
+            rslt = null_ptr_check(dev[idx]);
+        }
+    }
+
+    if (rslt == BMI3_OK)
+    {
+        for (idx = 0; idx < n_dev; idx++)
+        {
+            bring_up->unit[idx].dev = dev[idx];
+            bring_up->unit[idx].op.kind = BMI3_OP_NONE;
+            bring_up->unit[idx].wait_us = 0;
+            bring_up->unit[idx].stage = BMI3_BRING_UP_PROBE;
+            bring_up->unit[idx].rslt = BMI3_OK;
+        }
+
+        bring_up->variants = variants;
+        bring_up->n_variants = n_variants;
+        bring_up->image = image;
+        bring_up->n_unit = n_dev;
+        bring_up->pending = n_dev;
+        bring_up->n_ready = 0;
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This API runs the next step of the units of a bring-up.
+ */
+int8_t bmi3_bring_up_step(uint32_t elapsed_us, uint32_t *wait_us, struct bmi3_bring_up *bring_up)
+{
+    /* Variable to store result of API */
+    int8_t rslt = BMI3_OK;
+
+    /* Variable to define loop */
+    uint8_t idx;
+
+    /* Shortest wait of the running units */
+    uint32_t wait = UINT32_MAX;
+
+    struct bmi3_bring_up_unit *unit;
+
+    if ((wait_us == NULL) || (bring_up == NULL))
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
+    else
+    {
+        bring_up->pending = 0;
+
+        /* Units are stepped in turn, so that the soft-resets are issued back-to-back and
+         * the feature engine of all units is polled in the same pass
+         */
+        for (idx = 0; idx < bring_up->n_unit; idx++)
+        {
+            unit = &bring_up->unit[idx];
+
+            if (unit->stage != BMI3_BRING_UP_DONE)
+            {
+                unit->wait_us = (unit->wait_us > elapsed_us) ? (unit->wait_us - elapsed_us) : 0;
+
+                if (unit->wait_us == 0)
+                {
+                    bring_up_unit_step(bring_up, unit);
+                }
+            }
+
+            if (unit->stage != BMI3_BRING_UP_DONE)
+            {
+                bring_up->pending++;
+
+                if (unit->wait_us < wait)
+                {
+                    wait = unit->wait_us;
+                }
+            }
+        }
+
+        if (bring_up->pending > 0)
+        {
+            *wait_us = wait;
+            rslt = BMI3_W_OP_PENDING;
+        }
+        else
+        {
+            *wait_us = 0;
+        }
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This API runs a bring-up until all units are complete.
+ */
+int8_t bmi3_bring_up_run(struct bmi3_bring_up *bring_up)
+{
+    /* Variable to store result of API */
+    int8_t rslt;
+
+    /* Time waited before the step */
+    uint32_t wait_us = 0;
+
+    do
+    {
+        rslt = bmi3_bring_up_step(wait_us, &wait_us, bring_up);
+
+        if ((rslt == BMI3_W_OP_PENDING) && (wait_us > 0))
+        {
+            bring_up->unit[0].dev->delay_us(wait_us, bring_up->unit[0].dev->intf_ptr);
+        }
+    } while (rslt == BMI3_W_OP_PENDING);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API performs Fast Offset Compensation for accelerometer from a
+ * single burst of accel-only FIFO data.
+ */
+int8_t bmi3_perform_accel_foc_fifo(const struct bmi3_accel_foc_g_value *accel_g_value,
+                                   const struct bmi3_accel_foc_fifo_cfg *foc_cfg,
+                                   struct bmi3_dev *dev)
+{
+    /* Variable to store result of API */
+    int8_t rslt;
+
+    /* Variable to store result of restoring the configuration */
+    int8_t restore_rslt;
+
+    /* Variable to store whether the configuration is to be restored */
+    uint8_t restore = BMI3_DISABLE;
+
+    /* Structure to define the accelerometer configurations */
+    struct bmi3_accel_config acc_cfg = { 0 };
+    struct bmi3_sens_config config = { 0 };
+    struct bmi3_sens_config foc_config = { 0 };
+
+    /* Arrays to store the FIFO configuration of the user and of FOC */
+    uint8_t fifo_conf[2] = { 0 };
+    uint8_t foc_fifo_conf[2] = { (uint8_t)BMI3_FIFO_STOP_ON_FULL, (uint8_t)(BMI3_FIFO_ACC_EN >> 8) };
+
+    /* Structure to store the average of accelerometer data */
+    struct bmi3_foc_temp_value temp_foc_data = { 0 };
+    struct bmi3_sens_axes_data accel_avg = { 0 };
+
+    lock_dev(dev);
+
+    /* Configure the type */
+    config.type = BMI3_ACCEL;
+
+    /* Null-pointer check */
+    rslt = null_ptr_check(dev);
+
+    if ((rslt == BMI3_OK) && (accel_g_value != NULL) && (foc_cfg != NULL))
+    {
+        /* Check for input validity */
+        if ((((BMI3_ABS(accel_g_value->x)) + (BMI3_ABS(accel_g_value->y)) + (BMI3_ABS(accel_g_value->z))) == 1) &&
+            ((accel_g_value->sign == 1) || (accel_g_value->sign == 0)) && (foc_cfg->sample_count != 0) &&
+            (foc_cfg->sample_count <= BMI3_FOC_FIFO_MAX_SAMPLES))
+        {
+            /* Get accelerometer and FIFO configurations */
+            rslt = bmi3_get_sensor_config(&config, 1, dev);
+
+            if (rslt == BMI3_OK)
+            {
+                rslt = bmi3_get_regs(BMI3_REG_FIFO_CONF, fifo_conf, 2, dev);
+            }
+
+            if (rslt == BMI3_OK)
+            {
+                restore = BMI3_ENABLE;
+
+                foc_config = config;
+
+                if (foc_cfg->odr != 0)
+                {
+                    foc_config.cfg.acc.odr = foc_cfg->odr;
+                }
+
+                rslt = bmi3_set_sensor_config(&foc_config, 1, dev);
+            }
+
+            /* Store accel-only frames from now on, without overwriting the oldest ones */
+            if (rslt == BMI3_OK)
+            {
+                rslt = bmi3_set_regs(BMI3_REG_FIFO_CONF, foc_fifo_conf, 2, dev);
+            }
+
+            if (rslt == BMI3_OK)
+            {
+                rslt = flush_fifo(dev);
+            }
+
+            if (rslt == BMI3_OK)
+            {
+                rslt = get_fifo_average_of_accel_data(foc_cfg->sample_count,
+                                                      foc_config.cfg.acc.odr,
+                                                      &temp_foc_data,
+                                                      dev);
+            }
+
+            if (rslt == BMI3_OK)
+            {
+                rslt = check_foc_position(BMI3_ACCEL, accel_g_value, temp_foc_data, dev);
+            }
+
+            if (rslt == BMI3_OK)
+            {
+                accel_avg.x = (int16_t)(temp_foc_data.x);
+                accel_avg.y = (int16_t)(temp_foc_data.y);
+                accel_avg.z = (int16_t)(temp_foc_data.z);
+
+                rslt = set_accel_foc_offset(accel_g_value, &accel_avg, &acc_cfg, dev);
+            }
+
+            /* Restore the configurations, also if FOC failed. Frames of FOC are flushed */
+            if (restore == BMI3_ENABLE)
+            {
+                restore_rslt = bmi3_set_sensor_config(&config, 1, dev);
+
+                if (restore_rslt == BMI3_OK)
+                {
+                    restore_rslt = bmi3_set_regs(BMI3_REG_FIFO_CONF, fifo_conf, 2, dev);
+                }
+
+                if (restore_rslt == BMI3_OK)
+                {
+                    restore_rslt = flush_fifo(dev);
+                }
+
+                if (rslt == BMI3_OK)
+                {
+                    rslt = restore_rslt;
+                }
+            }
+        }
+        else
+        {
+            rslt = BMI3_E_INVALID_INPUT;
+        }
+    }
+    else
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
+
+    unlock_dev(dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API gets the data ready status of power on reset, accelerometer, gyroscope
+ * and temperature.
+ */
+int8_t bmi3_get_sensor_status(uint16_t *status, struct bmi3_dev *dev)
+{
+    /* Variable to store result of API */
+    int8_t rslt;
+
+    uint8_t data[2] = { 0 };
+
+    if (status != NULL)
+    {
+        /* Read the status register */
+        rslt = bmi3_get_regs(BMI3_REG_STATUS, data, 2, dev);
+
+        *status = (uint16_t)(data[0] | ((uint16_t)data[1] << 8));
+    }
+    else
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This API gets the I3C IBI status of both feature and data
+ * interrupts
+ */
+int8_t bmi3_get_i3c_ibi_status(uint16_t *int_status, struct bmi3_dev *dev)
+{
+    /* Variable to store result of API */
+    int8_t rslt;
+
+    /* Array to store data */
+    uint8_t data_array[2] = { 0 };
+
+    if (int_status != NULL)
+    {
+        /* Get the interrupt status */
+        rslt = bmi3_get_regs(BMI3_REG_INT_STATUS_IBI, data_array, 2, dev);
+
+        if (rslt == BMI3_OK)
+        {
+            *int_status = (uint16_t) data_array[0] | ((uint16_t) data_array[1] << 8);
+        }
+    }
+    else
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This API gets accel gyro offset gain reset values.
+ */
+int8_t bmi3_get_acc_gyr_off_gain_reset(uint8_t *acc_off_gain_reset, uint8_t *gyr_off_gain_reset, struct bmi3_dev *dev)
+{
+    /* Variable to store result of API */
+    int8_t rslt;
+
+    /* Array to define the accel gyro user gain offset reset values */
+    uint8_t acc_gyr_off_gain_reset[2] = { 0 };
+
+    /* Array to set the base address of accel gyro offset and gain reset */
+    uint8_t base_addr[2] = { BMI3_BASE_ADDR_ACC_GYR_OFFSET_GAIN_RESET, 0 };
+
+    uint8_t idx = 0;
+
+    /* Variable to define LSB */
+    uint16_t lsb;
+
+    /* Variable to define MSB */
+    uint16_t msb;
+
+    /* Variable to define a word */
+    uint16_t lsb_msb;
+
+    lock_dev(dev);
+
+    if ((acc_off_gain_reset != NULL) && (gyr_off_gain_reset != NULL))
+    {
+        /* Set the accel gyro offset and gain reset base address to feature engine transmission address to start DMA
+         * transaction */
+        rslt = bmi3_set_regs(BMI3_REG_FEATURE_DATA_ADDR, base_addr, 2, dev);
+
+        if (rslt == BMI3_OK)
+        {
+            /* Get the configuration from the feature engine register where accel gyro offset and gain reset value
+             * resides */
+            rslt = bmi3_get_regs(BMI3_REG_FEATURE_DATA_TX, acc_gyr_off_gain_reset, 2, dev);
+
+            if (rslt == BMI3_OK)
+            {
+                /* Get word to calculate acc_off_gain_reset and gyr_off_gain_reset */
+                lsb = (uint16_t) acc_gyr_off_gain_reset[idx++];
+                msb = ((uint16_t) acc_gyr_off_gain_reset[idx++] << 8);
+                lsb_msb = (lsb | msb);
+
+                /* Get accel offset gain reset */
+                *acc_off_gain_reset = (uint8_t)(lsb_msb & BMI3_ACC_OFF_GAIN_RESET_MASK);
+
+                /* Get gyro offset gain reset */
+                *gyr_off_gain_reset = (uint8_t)(lsb_msb & BMI3_GYR_OFF_GAIN_RESET_MASK) >> BMI3_GYR_OFF_GAIN_RESET_POS;
+            }
+        }
+    }
+    else
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
+
+    unlock_dev(dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API sets accel gyro offset gain reset values.
+ */
+int8_t bmi3_set_acc_gyr_off_gain_reset(uint8_t acc_off_gain_reset, uint8_t gyr_off_gain_reset, struct bmi3_dev *dev)
+{
+    /* Variable to store result of API */
+    int8_t rslt;
+
+    /* Array to define the accel gyro user gain offset reset values */
+    uint8_t acc_gyr_off_gain_reset[2] = { 0 };
+
+    /* Array to set the base address of accel gyro offset and gain reset */
+    uint8_t base_addr[2] = { BMI3_BASE_ADDR_ACC_GYR_OFFSET_GAIN_RESET, 0 };
+
+    uint8_t data_array[2] = { 0 };
+
+    lock_dev(dev);
+
+    /* Set the accel gyro offset and gain reset base address to feature engine transmission address to start DMA
+     * transaction */
+    rslt = bmi3_set_regs(BMI3_REG_FEATURE_DATA_ADDR, base_addr, 2, dev);
+
+    if (rslt == BMI3_OK)
+    {
+        /* Set accel offset gain reset */
+        acc_off_gain_reset = BMI3_SET_BIT_POS0(data_array[0], BMI3_ACC_OFF_GAIN_RESET, acc_off_gain_reset);
+
+        /* Set gyro offset gain reset */
+        gyr_off_gain_reset = BMI3_SET_BITS(data_array[0], BMI3_GYR_OFF_GAIN_RESET, gyr_off_gain_reset);
+
+        acc_gyr_off_gain_reset[0] = (acc_off_gain_reset | gyr_off_gain_reset);
+
+        /* Set the configurations back to the feature engine register */
+        rslt = bmi3_set_regs(BMI3_REG_FEATURE_DATA_TX, acc_gyr_off_gain_reset, 2, dev);
+    }
+
+    unlock_dev(dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API reads the calibration state of the device into a blob.
+ */
+int8_t bmi3_get_calib_blob(struct bmi3_calib_blob *blob, struct bmi3_dev *dev)
+{
+    /* Variable to store result of API */
+    int8_t rslt;
+
+    /* Variable to store the CRC */
+    uint16_t crc;
+
+    lock_dev(dev);
+
+    /* Null-pointer check */
+    rslt = null_ptr_check(dev);
+
+    if ((rslt == BMI3_OK) && (blob != NULL))
+    {
+        blob->data[0] = BMI3_CALIB_BLOB_VERSION;
+        blob->data[1] = dev->chip_id;
+
+        /* Accel and gyro dp offset and gain registers are adjacent */
+        rslt = bmi3_get_regs(BMI3_REG_ACC_DP_OFF_X, &blob->data[BMI3_CALIB_BLOB_DP_POS], BMI3_CALIB_BLOB_DP_LEN, dev);
+
+        /* Offset and gain reset word is followed by the accel and gyro user offset and gain words */
+        if (rslt == BMI3_OK)
+        {
+            rslt = get_feature_words(BMI3_BASE_ADDR_ACC_GYR_OFFSET_GAIN_RESET,
+                                     &blob->data[BMI3_CALIB_BLOB_USR_POS],
+                                     BMI3_CALIB_BLOB_USR_LEN,
+                                     dev);
+        }
+
+        if (rslt == BMI3_OK)
+        {
+            rslt = get_feature_words(BMI3_BASE_ADDR_AXIS_REMAP, &blob->data[BMI3_CALIB_BLOB_REMAP_POS], 2, dev);
+        }
+
+        if (rslt == BMI3_OK)
+        {
+            crc = get_calib_crc(blob->data, BMI3_CALIB_BLOB_CRC_POS);
+            blob->data[BMI3_CALIB_BLOB_CRC_POS] = (uint8_t)(crc & BMI3_SET_LOW_BYTE);
+            blob->data[BMI3_CALIB_BLOB_CRC_POS + 1] = (uint8_t)((crc & BMI3_SET_HIGH_BYTE) >> 8);
+        }
+    }
+    else if (rslt == BMI3_OK)
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
+
+    unlock_dev(dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API restores the calibration state of the device from a blob.
+ */
+int8_t bmi3_set_calib_blob(const struct bmi3_calib_blob *blob, struct bmi3_dev *dev)
+{
+    /* Variable to store result of API */
+    int8_t rslt;
+
+    /* Variable to store the CRC */
+    uint16_t crc;
+
+    /* Array to store axis remap word of the sensor */
+    uint8_t remap_data[2] = { 0 };
+
+    /* Structure instance of sensor config */
+    struct bmi3_sens_config config = { 0 };
+
+    lock_dev(dev);
+
+    /* Null-pointer check */
+    rslt = null_ptr_check(dev);
+
+    if ((rslt == BMI3_OK) && (blob != NULL))
+    {
+        crc = get_calib_crc(blob->data, BMI3_CALIB_BLOB_CRC_POS);
+
+        if ((blob->data[0] != BMI3_CALIB_BLOB_VERSION) || (blob->data[1] != dev->chip_id) ||
+            (blob->data[BMI3_CALIB_BLOB_CRC_POS] != (uint8_t)(crc & BMI3_SET_LOW_BYTE)) ||
+            (blob->data[BMI3_CALIB_BLOB_CRC_POS + 1] != (uint8_t)((crc & BMI3_SET_HIGH_BYTE) >> 8)))
+        {
+            rslt = BMI3_E_CALIB_BLOB;
+        }
+
+        if (rslt == BMI3_OK)
+        {
+            begin_batch(dev);
+
+            rslt = bmi3_set_regs(BMI3_REG_ACC_DP_OFF_X,
+                                 &blob->data[BMI3_CALIB_BLOB_DP_POS],
+                                 BMI3_CALIB_BLOB_DP_LEN,
+                                 dev);
+
+            if (rslt == BMI3_OK)
+            {
+                rslt = set_feature_words(BMI3_BASE_ADDR_ACC_GYR_OFFSET_GAIN_RESET,
+                                         &blob->data[BMI3_CALIB_BLOB_USR_POS],
+                                         BMI3_CALIB_BLOB_USR_LEN,
+                                         dev);
+            }
+
+            rslt = end_batch(rslt, dev);
+        }
+
+        /* Axis remap is applied by a command sequence, only if it differs from the one of the sensor */
+        if (rslt == BMI3_OK)
+        {
+            rslt = get_feature_words(BMI3_BASE_ADDR_AXIS_REMAP, remap_data, 2, dev);
+        }
+
+        if ((rslt == BMI3_OK) &&
+            ((remap_data[0] != blob->data[BMI3_CALIB_BLOB_REMAP_POS]) ||
+             (remap_data[1] != blob->data[BMI3_CALIB_BLOB_REMAP_POS + 1])))
+        {
+            rslt = set_feature_words(BMI3_BASE_ADDR_AXIS_REMAP, &blob->data[BMI3_CALIB_BLOB_REMAP_POS], 2, dev);
+
+            if (rslt == BMI3_OK)
+            {
+                rslt = axes_remap_acc_power_mode_status(config, dev);
+            }
+        }
+    }
+    else if (rslt == BMI3_OK)
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
+
+    unlock_dev(dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API captures the complete configuration of the device.
+ */
+int8_t bmi3_get_config_image(struct bmi3_config_image *image, struct bmi3_dev *dev)
+{
+    /* Variable to store result of API */
+    int8_t rslt;
+
+    lock_dev(dev);
+
+    /* Null-pointer check */
+    rslt = null_ptr_check(dev);
+
+    if ((rslt == BMI3_OK) && (image != NULL))
+    {
+        image->feature.dirty = BMI3_CONFIG_IMAGE_FEATURE_MASK;
+
+        rslt = get_feature_words(BMI3_BASE_ADDR_AXIS_REMAP,
+                                 &image->feature.data[BMI3_BASE_ADDR_AXIS_REMAP * 2],
+                                 (uint16_t)((BMI3_FEATURE_BATCH_MAX_WORDS - BMI3_BASE_ADDR_AXIS_REMAP) * 2),
+                                 dev);
+
+        if (rslt == BMI3_OK)
+        {
+            rslt = bmi3_get_regs(BMI3_REG_FEATURE_IO0, image->feature_io, 2, dev);
+        }
+
+        if (rslt == BMI3_OK)
+        {
+            rslt = bmi3_get_regs(BMI3_REG_ACC_CONF, image->sens_conf, BMI3_CONFIG_IMAGE_SENS_LEN, dev);
+        }
+
+        if (rslt == BMI3_OK)
+        {
+            rslt = bmi3_get_regs(BMI3_REG_FIFO_WATERMARK, image->int_conf, BMI3_CONFIG_IMAGE_INT_LEN, dev);
+
+            /* FIFO flush is not part of the configuration */
+            image->int_conf[BMI3_CONFIG_IMAGE_FIFO_CTRL_POS] = 0;
+            image->int_conf[BMI3_CONFIG_IMAGE_FIFO_CTRL_POS + 1] = 0;
+        }
+    }
+    else if (rslt == BMI3_OK)
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
+
+    unlock_dev(dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API applies a configuration image to the device.
+ */
+int8_t bmi3_set_config_image(const struct bmi3_config_image *image, struct bmi3_dev *dev)
+{
+    /* Variable to store result of API */
+    int8_t rslt;
+
+    /* Feature engine words to be written, the image itself is left untouched */
+    struct bmi3_feature_batch feature;
+
+    lock_dev(dev);
+
+    /* Null-pointer check */
+    rslt = null_ptr_check(dev);
+
+    if ((rslt == BMI3_OK) && (image != NULL))
+    {
+        feature = image->feature;
+
+        begin_batch(dev);
+
+        rslt = flush_feature_batch(&feature, dev);
+
+        /* Axis remap is taken over while the accel is still disabled */
+        if ((rslt == BMI3_OK) && (image->feature.dirty & ((uint64_t)1 << BMI3_BASE_ADDR_AXIS_REMAP)))
+        {
+            rslt = bmi3_set_command_register(BMI3_CMD_AXIS_MAP_UPDATE, dev);
+        }
+
+        if (rslt == BMI3_OK)
+        {
+            rslt = set_config_image_regs(image, dev);
+        }
+
+        rslt = end_batch(rslt, dev);
+
+        if (rslt == BMI3_OK)
+        {
+            set_unit_scale(BMI3_ACCEL,
+                           (uint8_t)BMI3_GET_BITS(image->sens_conf[0], BMI3_ACC_RANGE),
+                           dev);
+            set_unit_scale(BMI3_GYRO,
+                           (uint8_t)BMI3_GET_BITS(image->sens_conf[2], BMI3_GYR_RANGE),
+                           dev);
+        }
+    }
+    else if (rslt == BMI3_OK)
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
+
+    unlock_dev(dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API applies only the changes between the current and the target configurations.
+ */
+int8_t bmi3_set_sensor_config_diff(const struct bmi3_sens_config *current,
+                                   struct bmi3_sens_config *target,
+                                   uint8_t n_sens,
+                                   struct bmi3_dev *dev)
+{
+    /* Variable to store result of API */
+    int8_t rslt;
+
+    /* Variable to define loop */
+    uint8_t loop;
+
+    /* Variable to define the pass of the register writes, alternate first */
+    uint8_t pass;
+
+    /* Words of a feature */
+    uint8_t base_addr = 0;
+    uint8_t n_words = 0;
+
+    /* Span of the words of the target features */
+    uint8_t first = BMI3_FEATURE_BATCH_MAX_WORDS;
+    uint8_t end = 0;
+
+    /* Feature engine words on the sensor and of the target */
+    struct bmi3_feature_batch written;
+    struct bmi3_feature_batch batch;
+
+    /* Configuration on the sensor */
+    struct bmi3_sens_config cfg;
+
+    lock_dev(dev);
+
+    /* Null-pointer check */
+    rslt = null_ptr_check(dev);
+
+    if ((rslt == BMI3_OK) && (target != NULL))
+    {
+        written.dirty = 0;
+        batch.dirty = 0;
+
+        for (loop = 0; (loop < n_sens) && (rslt == BMI3_OK); loop++)
+        {
+            if ((current != NULL) && (current[loop].type != target[loop].type))
+            {
+                rslt = BMI3_E_INVALID_INPUT;
+            }
+            else if (get_feature_span(target[loop].type, &base_addr, &n_words) != BMI3_OK)
+            {
+                /* Accel, gyro and alternate configurations are compared once the feature engine words are written */
+                rslt = (get_reg_config_order(target[loop].type) < 2) ? BMI3_OK : BMI3_E_INVALID_SENSOR;
+            }
+            else
+            {
+                rslt = pack_feature_config(&target[loop], &batch, NULL);
+
+                if ((rslt == BMI3_OK) && (current != NULL))
+                {
+                    rslt = pack_feature_config(&current[loop], &written, NULL);
+                }
+
+                first = (base_addr < first) ? base_addr : first;
+                end = ((base_addr + n_words) > end) ? (uint8_t)(base_addr + n_words) : end;
+            }
+        }
+
+        /* Words on the sensor are read at once */
+        if ((rslt == BMI3_OK) && (current == NULL) && (end > first))
+        {
+            rslt = get_feature_words(first, &written.data[first * 2], (uint16_t)((end - first) * 2), dev);
+
+            if (rslt == BMI3_OK)
+            {
+                written.dirty = ((UINT64_C(1) << (end - first)) - 1) << first;
+            }
+        }
+
+        if (rslt == BMI3_OK)
+        {
+            skip_unchanged_words(&written, &batch);
+
+            begin_batch(dev);
+
+            rslt = flush_feature_batch(&batch, dev);
+
+            /* Alternate configurations first, accel and gyro configurations enable the sensors */
+            for (pass = 0; (pass < 2) && (rslt == BMI3_OK); pass++)
+            {
+                for (loop = 0; (loop < n_sens) && (rslt == BMI3_OK); loop++)
+                {
+                    if (get_reg_config_order(target[loop].type) == pass)
+                    {
+                        if (current != NULL)
+                        {
+                            cfg = current[loop];
+                        }
+                        else
+                        {
+                            cfg.type = target[loop].type;
+                            rslt = get_reg_config(&cfg, dev);
+                        }
+
+                        if ((rslt == BMI3_OK) && (is_same_reg_config(&cfg, &target[loop]) == BMI3_DISABLE))
+                        {
+                            rslt = set_reg_config(&target[loop], dev);
+                        }
+                    }
+                }
+            }
+
+            rslt = end_batch(rslt, dev);
+        }
+    }
+    else if (rslt == BMI3_OK)
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
+
+    unlock_dev(dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API writes register values built at compile time.
+ */
+int8_t bmi3_set_reg_image(const struct bmi3_reg_image *image, struct bmi3_dev *dev)
+{
+    /* Variable to store result of API */
+    int8_t rslt;
+
+    /* Array to store the registers from FIFO_WATERMARK to INT_MAP2, FIFO_CTRL is kept zero */
+    uint8_t int_conf[BMI3_CONFIG_IMAGE_INT_LEN] = { 0 };
+
+    /* Array to store ACC_CONF and GYR_CONF */
+    uint8_t sens_conf[4];
+
+    lock_dev(dev);
+
+    /* Null-pointer check */
+    rslt = null_ptr_check(dev);
+
+    if ((rslt == BMI3_OK) && (image != NULL))
+    {
+        int_conf[0] = BMI3_GET_LSB(image->fifo_watermark);
+        int_conf[1] = BMI3_GET_MSB(image->fifo_watermark);
+        int_conf[2] = BMI3_GET_LSB(image->fifo_conf);
+        int_conf[3] = BMI3_GET_MSB(image->fifo_conf);
+        int_conf[6] = BMI3_GET_LSB(image->io_int_ctrl);
+        int_conf[7] = BMI3_GET_MSB(image->io_int_ctrl);
+        int_conf[8] = BMI3_GET_LSB(image->int_conf);
+        int_conf[9] = BMI3_GET_MSB(image->int_conf);
+        int_conf[10] = BMI3_GET_LSB(image->int_map1);
+        int_conf[11] = BMI3_GET_MSB(image->int_map1);
+        int_conf[12] = BMI3_GET_LSB(image->int_map2);
+        int_conf[13] = BMI3_GET_MSB(image->int_map2);
+
+        sens_conf[0] = BMI3_GET_LSB(image->acc_conf);
+        sens_conf[1] = BMI3_GET_MSB(image->acc_conf);
+        sens_conf[2] = BMI3_GET_LSB(image->gyr_conf);
+        sens_conf[3] = BMI3_GET_MSB(image->gyr_conf);
+
+        begin_batch(dev);
+
+        /* Interrupt and FIFO configuration, so that no sample is lost once the sensors are enabled */
+        rslt = bmi3_set_regs(BMI3_REG_FIFO_WATERMARK, int_conf, BMI3_CONFIG_IMAGE_INT_LEN, dev);
+
+        /* Accel and gyro configurations enable the sensors */
+        if (rslt == BMI3_OK)
+        {
+            rslt = bmi3_set_regs(BMI3_REG_ACC_CONF, sens_conf, 4, dev);
+        }
+
+        rslt = end_batch(rslt, dev);
+
+        if (rslt == BMI3_OK)
+        {
+            set_unit_scale(BMI3_ACCEL, (uint8_t)BMI3_GET_BITS(image->acc_conf, BMI3_ACC_RANGE), dev);
+            set_unit_scale(BMI3_GYRO, (uint8_t)BMI3_GET_BITS(image->gyr_conf, BMI3_GYR_RANGE), dev);
+        }
+    }
+    else if (rslt == BMI3_OK)
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
+
+    unlock_dev(dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API starts a non-blocking read of the FIFO data.
+ */
+int8_t bmi3_async_read_fifo_data(struct bmi3_fifo_frame *fifo, bmi3_async_done_fptr_t done, struct bmi3_dev *dev)
+{
+    /* Variable to store result of API */
+    int8_t rslt;
+
+    rslt = async_check(dev);
+
+    if ((rslt == BMI3_OK) && (fifo != NULL) && (fifo->data != NULL))
+    {
+        if (fifo->length != 0)
+        {
+            dev->async.done = done;
+            dev->async.fifo = fifo;
+            dev->async.fifo_len = fifo->length;
+
+            /* Get the set FIFO frame configurations first, FIFO data is read on its completion */
+            rslt = async_submit(BMI3_REG_FIFO_CONF,
+                                dev->async.buf,
+                                (uint32_t)BMI3_LENGTH_FIFO_CONFIG + dev->dummy_byte,
+                                BMI3_ASYNC_FIFO_CONF,
+                                dev);
+        }
+        else
+        {
+            rslt = BMI3_E_COM_FAIL;
+        }
+    }
+    else if (rslt == BMI3_OK)
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This API starts a non-blocking read of accelerometer, gyro and
+ * temperature data.
+ */
+int8_t bmi3_async_get_sensor_data(struct bmi3_sensor_data *sensor_data,
+                                  uint8_t n_sens,
+                                  bmi3_async_done_fptr_t done,
+                                  struct bmi3_dev *dev)
+{
+    /* Variable to store result of API */
+    int8_t rslt;
+
+    /* Variable to define loop */
+    uint8_t loop;
+
+    rslt = async_check(dev);
+
+    if ((rslt == BMI3_OK) && (sensor_data != NULL))
+    {
+        /* Only the sensors available in the data registers can be read at once */
+        for (loop = 0; loop < n_sens; loop++)
+        {
+            if ((sensor_data[loop].type != BMI3_ACCEL) && (sensor_data[loop].type != BMI3_GYRO) &&
+                (sensor_data[loop].type != BMI3_TEMP))
+            {
+                rslt = BMI3_E_INVALID_SENSOR;
+                break;
+            }
+        }
+
+        if (rslt == BMI3_OK)
+        {
+            dev->async.done = done;
+            dev->async.sensor_data = sensor_data;
+            dev->async.n_sens = n_sens;
+
+            /* Up to the saturation flags, not the interrupt status registers which are cleared on read */
+            rslt = async_submit(BMI3_REG_ACC_DATA_X,
+                                dev->async.buf,
+                                (uint32_t)BMI3_READ_REG_DATA_SAT_LEN + dev->dummy_byte,
+                                BMI3_ASYNC_SENSOR_DATA,
+                                dev);
+        }
+    }
+    else if (rslt == BMI3_OK)
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This API starts a non-blocking read of the INT1 and INT2 interrupt
+ * status registers.
+ */
+int8_t bmi3_async_get_int_status(uint16_t *int1_status,
+                                 uint16_t *int2_status,
+                                 bmi3_async_done_fptr_t done,
+                                 struct bmi3_dev *dev)
+{
+    /* Variable to store result of API */
+    int8_t rslt;
+
+    rslt = async_check(dev);
+
+    if ((rslt == BMI3_OK) && (int1_status != NULL) && (int2_status != NULL))
+    {
+        dev->async.done = done;
+        dev->async.int1_status = int1_status;
+        dev->async.int2_status = int2_status;
+
+        rslt = async_submit(BMI3_REG_INT_STATUS_INT1,
+                            dev->async.buf,
+                            (uint32_t)BMI3_ASYNC_INT_STATUS_LEN + dev->dummy_byte,
+                            BMI3_ASYNC_INT_STATUS,
+                            dev);
+    }
+    else if (rslt == BMI3_OK)
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This API is called by the platform once the transfer started by the
+ * "read_async" function pointer is complete. It parses the data, starts the
+ * next transfer of the request if any, or calls the completion function.
+ */
+int8_t bmi3_async_complete(BMI3_INTF_RET_TYPE intf_rslt, struct bmi3_dev *dev)
+{
+    /* Variable to store result of API */
+    int8_t rslt = BMI3_OK;
+
+    /* Variable to store completion function of the request */
+    bmi3_async_done_fptr_t done;
+
+    if (dev == NULL)
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
+    else if (dev->async.state == BMI3_ASYNC_IDLE)
+    {
+        rslt = BMI3_E_INVALID_STATUS;
+    }
+    else
+    {
+        dev->intf_rslt = intf_rslt;
+
+        if (intf_rslt != BMI3_INTF_RET_SUCCESS)
+        {
+            rslt = BMI3_E_COM_FAIL;
+        }
+        else if (dev->async.state == BMI3_ASYNC_FIFO_CONF)
+        {
+            rslt = async_parse(dev);
+
+            if (rslt == BMI3_OK)
+            {
+                /* Read FIFO data into the buffer of the user */
+                rslt = async_submit(BMI3_REG_FIFO_DATA,
+                                    dev->async.fifo->data,
+                                    dev->async.fifo_len,
+                                    BMI3_ASYNC_FIFO_DATA,
+                                    dev);
+            }
+        }
+        else if (dev->async.state == BMI3_ASYNC_FIFO_SERVICE)
+        {
+            rslt = async_parse(dev);
+
+            if ((rslt == BMI3_OK) && (dev->async.fifo->available_fifo_len != 0))
+            {
+                /* Get the set FIFO frame configurations, FIFO data is read on its completion */
+                rslt = async_submit(BMI3_REG_FIFO_CONF,
+                                    dev->async.buf,
+                                    (uint32_t)BMI3_LENGTH_FIFO_CONFIG + dev->dummy_byte,
+                                    BMI3_ASYNC_FIFO_CONF,
+                                    dev);
+            }
+            else
+            {
+                dev->async.state = BMI3_ASYNC_IDLE;
+            }
+        }
+        else
+        {
+            rslt = async_parse(dev);
+            dev->async.state = BMI3_ASYNC_IDLE;
+        }
+
+        /* Request is complete if no further transfer is pending */
+        if ((rslt != BMI3_OK) || (dev->async.state == BMI3_ASYNC_IDLE))
+        {
+            dev->async.state = BMI3_ASYNC_IDLE;
+            dev->async.rslt = rslt;
+            done = dev->async.done;
+
+            if (done != NULL)
+            {
+                done(rslt, dev);
+            }
+        }
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This API invalidates the shadow register cache.
+ */
+int8_t bmi3_invalidate_reg_cache(struct bmi3_dev *dev)
+{
+    /* Variable to store result of API */
+    int8_t rslt;
+
+    /* Null-pointer check */
+    rslt = null_ptr_check(dev);
+
+    if (rslt == BMI3_OK)
+    {
+        invalidate_reg_cache(dev);
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This API gets a snapshot of the statistics of the retry policy.
+ */
+int8_t bmi3_get_retry_stats(struct bmi3_retry_stats *stats, const struct bmi3_dev *dev)
+{
+    /* Variable to store result of API */
+    int8_t rslt;
+
+    rslt = null_ptr_check(dev);
+
+    if ((rslt == BMI3_OK) && (stats != NULL))
+    {
+        *stats = dev->retry_stats;
+    }
+    else if (rslt == BMI3_OK)
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This API resets the statistics of the retry policy.
+ */
+int8_t bmi3_reset_retry_stats(struct bmi3_dev *dev)
+{
+    /* Variable to store result of API */
+    int8_t rslt;
+
+    rslt = null_ptr_check(dev);
+
+    if (rslt == BMI3_OK)
+    {
+        dev->retry_stats.retries = 0;
+        dev->retry_stats.recovered = 0;
+        dev->retry_stats.failed = 0;
+        dev->retry_stats.fifo_lost = 0;
+        dev->retry_stats.status_lost = 0;
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This API initializes the FIFO timestamp reconstruction for the
+ * given ODR and anchors it to the sensor time.
+ */
+int8_t bmi3_fifo_time_init(struct bmi3_fifo_time *fifo_time, uint8_t odr, struct bmi3_dev *dev)
+{
+    /* Variable to store result of API */
+    int8_t rslt;
+
+    if (fifo_time != NULL)
+    {
+        if ((odr >= BMI3_ACC_ODR_0_78HZ) && (odr <= BMI3_ACC_ODR_6400HZ))
+        {
+            /* Sample period doubles with each ODR step below 6400Hz */
+            fifo_time->period = BMI3_FIFO_TIME_6400HZ_TICKS << (BMI3_ACC_ODR_6400HZ - odr);
+            fifo_time->anchor = 0;
+
+            rslt = bmi3_fifo_time_anchor(fifo_time, dev);
+        }
+        else
+        {
+            rslt = BMI3_E_INVALID_INPUT;
+        }
+    }
+    else
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This API anchors the FIFO timestamp reconstruction to the current
+ * sensor time.
+ */
+int8_t bmi3_fifo_time_anchor(struct bmi3_fifo_time *fifo_time, struct bmi3_dev *dev)
+{
+    /* Variable to store result of API */
+    int8_t rslt;
+
+    /* Variable to store sensor time */
+    uint32_t sensor_time = 0;
+
+    /* Variable to store unwrapped sensor time */
+    uint64_t anchor;
+
+    if (fifo_time != NULL)
+    {
+        rslt = bmi3_get_sensor_time(&sensor_time, dev);
+
+        if (rslt == BMI3_OK)
+        {
+            /* Unwrap the 32-bit sensor time, which is counting up */
+            anchor = (fifo_time->anchor & ~(uint64_t)UINT32_MAX) | sensor_time;
+
+            if (anchor < fifo_time->anchor)
+            {
+                anchor += ((uint64_t)1 << 32);
+            }
+
+            fifo_time->anchor = anchor;
+
+            /* Timestamps of the following samples are derived from the anchor */
+            fifo_time->last_valid = BMI3_DISABLE;
+        }
+    }
+    else
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This API reconstructs the unwrapped sensor time of each extracted
+ * FIFO sample.
+ */
+int8_t bmi3_fifo_time_update(struct bmi3_fifo_time *fifo_time,
+                             const struct bmi3_fifo_frame *fifo,
+                             const struct bmi3_fifo_sens_axes_data *data,
+                             uint16_t count,
+                             uint64_t *timestamp)
+{
+    /* Variable to store result of API */
+    int8_t rslt = BMI3_OK;
+
+    /* Variable to define loop */
+    uint16_t index;
+
+    if ((fifo_time != NULL) && (fifo != NULL) && (data != NULL) && (timestamp != NULL))
+    {
+        for (index = 0; index < count; index++)
+        {
+            timestamp[index] = get_fifo_sample_time(fifo_time, fifo, data[index].sensor_time, index, count);
+        }
+    }
+    else
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This API initializes the accounting of the FIFO frames lost by
+ * overflows.
+ */
+int8_t bmi3_fifo_loss_init(uint8_t odr, uint8_t flush_on_full, struct bmi3_fifo_loss *loss)
+{
+    /* Variable to store result of API */
+    int8_t rslt = BMI3_OK;
+
+    if (loss == NULL)
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
+    else if ((odr < BMI3_ACC_ODR_0_78HZ) || (odr > BMI3_ACC_ODR_6400HZ) || (flush_on_full > BMI3_ENABLE))
+    {
+        rslt = BMI3_E_INVALID_INPUT;
+    }
+    else
+    {
+        /* Sample period doubles with each ODR step below 6400Hz */
+        loss->period = BMI3_FIFO_TIME_6400HZ_TICKS << (BMI3_ACC_ODR_6400HZ - odr);
+        loss->frames = 0;
+        loss->lost_frames = 0;
+        loss->gaps = 0;
+        loss->overflows = 0;
+        loss->resyncs = 0;
+        loss->last_time = 0;
+        loss->last_valid = BMI3_DISABLE;
+        loss->flush_on_full = flush_on_full;
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This API counts the FIFO frames lost in front of each extracted
+ * frame from the discontinuities of the sensor time.
+ */
+int8_t bmi3_fifo_loss_update(const struct bmi3_fifo_sens_axes_data *data,
+                             uint16_t n_frames,
+                             struct bmi3_fifo_loss *loss)
+{
+    /* Variable to store result of API */
+    int8_t rslt = BMI3_OK;
+
+    /* Variable to store the frame periods elapsed since the last frame */
+    uint32_t elapsed;
+
+    /* Variable to define loop */
+    uint16_t index;
+
+    if ((data == NULL) || (loss == NULL))
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
+    else
+    {
+        for (index = 0; index < n_frames; index++)
+        {
+            if (loss->last_valid == BMI3_ENABLE)
+            {
+                /* Difference of the 16-bit sensor time, rounded to the frame period */
+                elapsed = ((uint16_t)(data[index].sensor_time - loss->last_time) + (loss->period / 2)) / loss->period;
+
+                if (elapsed > 1)
+                {
+                    loss->gaps++;
+                    loss->lost_frames += elapsed - 1;
+                    rslt = BMI3_W_FIFO_GAP;
+                }
+            }
+
+            loss->last_time = data[index].sensor_time;
+            loss->last_valid = BMI3_ENABLE;
+        }
+
+        loss->frames += n_frames;
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This API counts a FIFO full interrupt and, if enabled, flushes the
+ * FIFO to resume the stream at a frame boundary.
+ */
+int8_t bmi3_fifo_loss_service(uint16_t int_status,
+                              struct bmi3_fifo_stream *stream,
+                              struct bmi3_fifo_loss *loss,
+                              struct bmi3_dev *dev)
+{
+    /* Variable to store result of API */
+    int8_t rslt;
+
+    rslt = null_ptr_check(dev);
+
+    if ((rslt == BMI3_OK) && (loss == NULL))
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
+
+    if ((rslt == BMI3_OK) && (int_status & BMI3_INT_STATUS_FFULL))
+    {
+        loss->overflows++;
+
+        if (loss->flush_on_full == BMI3_ENABLE)
+        {
+            /* Single write, FIFO and interrupt configuration are kept */
+            rslt = flush_fifo(dev);
+
+            if (rslt == BMI3_OK)
+            {
+                /* Bytes of a frame split by the flush are dropped */
+                if (stream != NULL)
+                {
+                    stream->fill = 0;
+                }
+
+                loss->resyncs++;
+            }
+        }
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This API initializes the analysis of the FIFO frame intervals.
+ */
+int8_t bmi3_fifo_jitter_init(uint8_t odr, struct bmi3_fifo_jitter *jitter)
+{
+    /* Variable to store result of API */
+    int8_t rslt = BMI3_OK;
+
+    /* Variable to define loop */
+    uint8_t index;
+
+    if (jitter == NULL)
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
+    else if ((odr < BMI3_ACC_ODR_0_78HZ) || (odr > BMI3_ACC_ODR_6400HZ))
+    {
+        rslt = BMI3_E_INVALID_INPUT;
+    }
+    else
+    {
+        for (index = 0; index < BMI3_FIFO_JITTER_BINS; index++)
+        {
+            jitter->hist[index] = 0;
+        }
+
+        /* Sample period doubles with each ODR step below 6400Hz */
+        jitter->period = BMI3_FIFO_TIME_6400HZ_TICKS << (BMI3_ACC_ODR_6400HZ - odr);
+        jitter->interval_avg = jitter->period << BMI3_FIFO_JITTER_FRAC;
+        jitter->span = 0;
+        jitter->intervals = 0;
+        jitter->frames = 0;
+        jitter->gaps = 0;
+        jitter->lost_frames = 0;
+        jitter->short_intervals = 0;
+        jitter->max_dev = 0;
+        jitter->last_time = 0;
+        jitter->last_valid = BMI3_DISABLE;
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This API adds the FIFO frame intervals to the analysis.
+ */
+int8_t bmi3_fifo_jitter_update(const struct bmi3_fifo_sens_axes_data *data,
+                               uint16_t n_frames,
+                               struct bmi3_fifo_jitter *jitter)
+{
+    /* Variable to store result of API */
+    int8_t rslt = BMI3_OK;
+
+    /* Variable to store the interval of a frame in ticks */
+    uint32_t interval;
+
+    /* Variable to store the frame periods elapsed since the last frame */
+    uint32_t elapsed;
+
+    /* Variable to define loop */
+    uint16_t index;
+
+    if ((data == NULL) || (jitter == NULL))
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
+    else
+    {
+        for (index = 0; index < n_frames; index++)
+        {
+            if (jitter->last_valid == BMI3_ENABLE)
+            {
+                /* Difference of the 16-bit sensor time */
+                interval = (uint16_t)(data[index].sensor_time - jitter->last_time);
+                elapsed = (interval + (jitter->period / 2)) / jitter->period;
+
+                jitter->span += interval;
+                jitter->intervals++;
+
+                if (elapsed > 1)
+                {
+                    jitter->gaps++;
+                    jitter->lost_frames += elapsed - 1;
+                    rslt = BMI3_W_FIFO_GAP;
+                }
+                else if (elapsed == 0)
+                {
+                    jitter->short_intervals++;
+                }
+                else
+                {
+                    add_fifo_jitter_interval(interval, jitter);
+                }
+            }
+
+            jitter->last_time = data[index].sensor_time;
+            jitter->last_valid = BMI3_ENABLE;
+        }
+
+        jitter->frames += n_frames;
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This API derives the effective ODR and jitter from the analysis.
+ */
+int8_t bmi3_fifo_jitter_query(const struct bmi3_fifo_jitter *jitter, struct bmi3_fifo_jitter_report *report)
+{
+    /* Variable to store result of API */
+    int8_t rslt = BMI3_OK;
+
+    /* Variables to store the intervals without gap and those counted so far */
+    uint32_t total;
+    uint32_t sum = 0;
+
+    /* Variable to define loop */
+    uint8_t index;
+
+    if ((jitter == NULL) || (report == NULL))
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
+    else
+    {
+        report->odr_mhz = 0;
+        report->delivered_mhz = 0;
+        report->odr_error_ppm = 0;
+        report->jitter_p99 = 0;
+
+        total = jitter->intervals - jitter->gaps - jitter->short_intervals;
+
+        if (jitter->span > 0)
+        {
+            report->delivered_mhz =
+                (uint32_t)(((uint64_t)jitter->intervals * BMI3_SENSORTIME_TICKS_PER_S * 1000) / jitter->span);
+        }
+
+        if (total > 0)
+        {
+            report->odr_mhz =
+                (uint32_t)(((uint64_t)BMI3_SENSORTIME_TICKS_PER_S * 1000 << BMI3_FIFO_JITTER_FRAC) /
+                           jitter->interval_avg);
+
+            /* Relative to the interval: the nominal ODR is not an integer number of mHz below 1.5625Hz */
+            report->odr_error_ppm =
+                (int32_t)((((int64_t)jitter->period << BMI3_FIFO_JITTER_FRAC) - (int64_t)jitter->interval_avg) *
+                          1000000 / (int64_t)jitter->interval_avg);
+
+            for (index = 0; index < BMI3_FIFO_JITTER_BINS; index++)
+            {
+                sum += jitter->hist[index];
+
+                if ((uint64_t)sum * 100 >= (uint64_t)total * 99)
+                {
+                    break;
+                }
+            }
+
+            if (index >= (BMI3_FIFO_JITTER_BINS - 1))
+            {
+                report->jitter_p99 = jitter->max_dev;
+            }
+            else
+            {
+                /* Upper bound of the bin */
+                report->jitter_p99 = (uint16_t)((UINT16_C(1) << index) - 1);
+            }
+        }
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This API initializes the synchronization of the sensor time to a host clock.
+ */
+int8_t bmi3_clock_sync_init(uint32_t max_uncertainty_ns, struct bmi3_clock_sync *cs)
+{
+    /* Variable to store result of API */
+    int8_t rslt = BMI3_OK;
+
+    /* Variable to define loop */
+    uint8_t index;
+
+    if (cs != NULL)
+    {
+        for (index = 0; index < BMI3_CLOCK_SYNC_SAMPLES; index++)
+        {
+            cs->sample[index].ticks = 0;
+            cs->sample[index].host_ns = 0;
+        }
+
+        cs->ref_ticks = 0;
+        cs->ref_host_ns = 0;
+        cs->rate = BMI3_CLOCK_SYNC_NOMINAL_RATE;
+        cs->max_uncertainty_ns = max_uncertainty_ns;
+        cs->last_raw = 0;
+        cs->accepted = 0;
+        cs->rejected = 0;
+        cs->restarts = 0;
+        cs->head = 0;
+        cs->count = 0;
+    }
+    else
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This API adds a (sensor time, host time) sample to the synchronization.
+ */
+int8_t bmi3_clock_sync_add(uint32_t sensor_time, uint64_t host_ns, uint32_t uncertainty_ns, struct bmi3_clock_sync *cs)
+{
+    /* Variable to store result of API */
+    int8_t rslt = BMI3_OK;
+
+    /* Variable to store unwrapped sensor time */
+    uint64_t ticks = 0;
+
+    /* Pointer to the newest sample */
+    const struct bmi3_clock_sync_sample *newest;
+
+    if (cs == NULL)
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
+    else if ((cs->max_uncertainty_ns != 0) && (uncertainty_ns > cs->max_uncertainty_ns))
+    {
+        cs->rejected++;
+        rslt = BMI3_W_SAMPLE_REJECTED;
+    }
+    else
+    {
+        if (cs->count != 0)
+        {
+            newest = &cs->sample[(cs->head + BMI3_CLOCK_SYNC_SAMPLES - 1) % BMI3_CLOCK_SYNC_SAMPLES];
+            ticks = clock_sync_unwrap(sensor_time, cs);
+
+            /* Sensor reset or host clock step, the window restarts */
+            if ((ticks <= newest->ticks) || (host_ns <= newest->host_ns))
+            {
+                cs->count = 0;
+                cs->restarts++;
+            }
+        }
+
+        if (cs->count == 0)
+        {
+            /* Room below the first sample for the unwrapping of earlier sensor times */
+            ticks = ((uint64_t)1 << 32) | sensor_time;
+        }
+
+        cs->sample[cs->head].ticks = ticks;
+        cs->sample[cs->head].host_ns = host_ns;
+        cs->head = (uint8_t)((cs->head + 1) % BMI3_CLOCK_SYNC_SAMPLES);
+
+        if (cs->count < BMI3_CLOCK_SYNC_SAMPLES)
+        {
+            cs->count++;
+        }
+
+        cs->last_raw = sensor_time;
+        cs->accepted++;
+
+        clock_sync_fit(cs);
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This API reads the sensor time and adds it to the synchronization.
+ */
+int8_t bmi3_clock_sync_capture(bmi3_host_time_ns_fptr_t host_time_ns, struct bmi3_clock_sync *cs, struct bmi3_dev *dev)
+{
+    /* Variable to store result of API */
+    int8_t rslt;
+
+    /* Variable to store sensor time */
+    uint32_t sensor_time = 0;
+
+    /* Variables to store host time before and after the read */
+    uint64_t before;
+    uint64_t after;
+
+    rslt = null_ptr_check(dev);
+
+    if ((rslt == BMI3_OK) && (host_time_ns != NULL) && (cs != NULL))
+    {
+        before = host_time_ns(dev->intf_ptr);
+        rslt = bmi3_get_sensor_time(&sensor_time, dev);
+        after = host_time_ns(dev->intf_ptr);
+
+        if (rslt == BMI3_OK)
+        {
+            if (after < before)
+            {
+                after = before;
+            }
+
+            rslt = bmi3_clock_sync_add(sensor_time,
+                                       before + ((after - before) / 2),
+                                       ((after - before) > UINT32_MAX) ? UINT32_MAX : (uint32_t)(after - before),
+                                       cs);
+        }
+    }
+    else if (rslt == BMI3_OK)
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This API converts sensor times into host times.
+ */
+int8_t bmi3_clock_sync_to_host(const uint64_t *sensor_time,
+                               uint16_t count,
+                               uint64_t *host_ns,
+                               const struct bmi3_clock_sync *cs)
+{
+    /* Variable to store result of API */
+    int8_t rslt = BMI3_OK;
+
+    /* Variable to define loop */
+    uint16_t index;
+
+    /* Variable to store distance to the reference point in ticks */
+    int64_t delta;
+
+    if ((sensor_time != NULL) && (host_ns != NULL) && (cs != NULL))
+    {
+        if (cs->count != 0)
+        {
+            for (index = 0; index < count; index++)
+            {
+                delta = (int64_t)clock_sync_unwrap((uint32_t)sensor_time[index], cs) - (int64_t)cs->ref_ticks;
+                host_ns[index] = (uint64_t)((int64_t)cs->ref_host_ns + clock_sync_scale(delta, cs->rate));
+            }
+        }
+        else
+        {
+            rslt = BMI3_E_INVALID_STATUS;
+        }
+    }
+    else
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This API gets the drift of the synchronization.
+ */
+int8_t bmi3_clock_sync_get_drift(const struct bmi3_clock_sync *cs, int32_t *drift_ppb)
+{
+    /* Variable to store result of API */
+    int8_t rslt = BMI3_OK;
+
+    /* Variable to store drift */
+    int64_t drift;
+
+    if ((cs != NULL) && (drift_ppb != NULL))
+    {
+        drift = ((cs->rate - BMI3_CLOCK_SYNC_NOMINAL_RATE) * 1000) / (BMI3_CLOCK_SYNC_NOMINAL_RATE / 1000000);
+
+        if (drift > INT32_MAX)
+        {
+            drift = INT32_MAX;
+        }
+        else if (drift < INT32_MIN)
+        {
+            drift = INT32_MIN;
+        }
+
+        *drift_ppb = (int32_t)drift;
+    }
+    else
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This API initializes a continuous FIFO stream.
+ */
+int8_t bmi3_fifo_stream_init(struct bmi3_fifo_stream *stream,
+                             uint8_t *buf,
+                             uint16_t size,
+                             uint16_t chunk,
+                             struct bmi3_dev *dev)
+{
+    /* Variable to store result of API */
+    int8_t rslt;
+
+    /* Variable to store FIFO configuration */
+    uint16_t fifo_config = 0;
+
+    if ((stream != NULL) && (buf != NULL))
+    {
+        if ((chunk >= 2) && ((uint32_t)chunk + BMI3_MAX_DUMMY_BYTE <= size))
+        {
+            /* Frame layout is given by the FIFO configuration */
+            rslt = bmi3_get_fifo_config(&fifo_config, dev);
+
+            if (rslt == BMI3_OK)
+            {
+                stream->buf = buf;
+                stream->size = size;
+                stream->chunk = chunk & (uint16_t)~1U;
+                stream->fill = 0;
+                stream->fifo_sens = fifo_config & BMI3_FIFO_ALL_EN;
+            }
+        }
+        else
+        {
+            rslt = BMI3_E_INVALID_INPUT;
+        }
+    }
+    else
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This API reads a chunk of FIFO data into the stream.
+ */
+int8_t bmi3_fifo_stream_read(struct bmi3_fifo_stream *stream, struct bmi3_dev *dev)
+{
+    /* Variable to store result of API */
+    int8_t rslt;
+
+    /* Variable to store number of bytes to be read */
+    uint16_t len;
+
+    /* Variable to index the bytes */
+    uint16_t index;
+
+    /* Variable to store frame length */
+    uint8_t frame_len;
+
+    /* Array to store the bytes overwritten by the dummy bytes */
+    uint8_t saved[BMI3_MAX_DUMMY_BYTE];
+
+    /* Pointer to the position of the read */
+    uint8_t *dest;
+
+    lock_dev(dev);
+
+    rslt = null_ptr_check(dev);
+
+    if ((rslt == BMI3_OK) && (stream != NULL) && (stream->buf != NULL))
+    {
+        frame_len = get_fifo_frame_layout(stream->fifo_sens)->frame_len;
+
+        /* Read at most as many words as the buffer can take */
+        len = (stream->size - BMI3_MAX_DUMMY_BYTE - stream->fill) & (uint16_t)~1U;
+
+        if (len > stream->chunk)
+        {
+            len = stream->chunk;
+        }
+
+        if ((len != 0) && (frame_len != 0))
+        {
+            /* Dummy bytes of the read overwrite the bytes in front of the new data */
+            dest = &stream->buf[BMI3_MAX_DUMMY_BYTE + stream->fill - dev->dummy_byte];
+
+            for (index = 0; index < dev->dummy_byte; index++)
+            {
+                saved[index] = dest[index];
+            }
+
+            rslt = read_regs_direct(BMI3_REG_FIFO_DATA, dest, len, get_fifo_read(dev), dev);
+
+            for (index = 0; index < dev->dummy_byte; index++)
+            {
+                dest[index] = saved[index];
+            }
+
+            if (rslt == BMI3_OK)
+            {
+                /* FIFO is empty from the first frame starting with the empty word */
+                index = (uint16_t)(((stream->fill + frame_len - 1) / frame_len) * frame_len);
+
+                while ((index + 1) < (stream->fill + len))
+                {
+                    if ((stream->buf[BMI3_MAX_DUMMY_BYTE + index] |
+                         ((uint16_t)stream->buf[BMI3_MAX_DUMMY_BYTE + index + 1] << 8)) == BMI3_FIFO_EMPTY_WORD)
+                    {
+                        len = index - stream->fill;
+                        break;
+                    }
+
+                    index += frame_len;
+                }
+
+                stream->fill += len;
+            }
+        }
+    }
+    else if (rslt == BMI3_OK)
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
+
+    unlock_dev(dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API extracts the complete frames of the stream and keeps the
+ * bytes of an incomplete frame for the next read.
+ */
+int8_t bmi3_fifo_stream_extract(struct bmi3_fifo_sens_axes_data *accel_data,
+                                struct bmi3_fifo_sens_axes_data *gyro_data,
+                                struct bmi3_fifo_temperature_data *temp_data,
+                                struct bmi3_fifo_frame *fifo,
+                                struct bmi3_fifo_stream *stream,
+                                const struct bmi3_dev *dev)
+{
+    /* Variable to store result of API */
+    int8_t rslt;
+
+    /* Variable to store frame length */
+    uint8_t frame_len;
+
+    /* Variable to store number of bytes of complete frames */
+    uint16_t complete;
+
+    /* Variable to index the bytes */
+    uint16_t index;
+
+    rslt = null_ptr_check(dev);
+
+    if ((rslt == BMI3_OK) && (fifo != NULL) && (stream != NULL) && (stream->buf != NULL))
+    {
+        frame_len = get_fifo_frame_layout(stream->fifo_sens)->frame_len;
+        complete = (frame_len != 0) ? (uint16_t)((stream->fill / frame_len) * frame_len) : 0;
+
+        /* FIFO frame refers to the complete frames of the stream, preceded by the dummy bytes */
+        fifo->data = &stream->buf[BMI3_MAX_DUMMY_BYTE - dev->dummy_byte];
+        fifo->length = complete + dev->dummy_byte;
+        fifo->available_fifo_len = complete / 2;
+        fifo->available_fifo_sens = stream->fifo_sens;
+        fifo->layout = get_fifo_frame_layout(stream->fifo_sens);
+
+        rslt = bmi3_extract_all(accel_data, gyro_data, temp_data, fifo, dev);
+
+        if (rslt == BMI3_OK)
+        {
+            /* Carry the bytes of the incomplete frame over to the next read */
+            for (index = complete; index < stream->fill; index++)
+            {
+                stream->buf[BMI3_MAX_DUMMY_BYTE + index - complete] = stream->buf[BMI3_MAX_DUMMY_BYTE + index];
+            }
+
+            stream->fill -= complete;
+        }
+    }
+    else if (rslt == BMI3_OK)
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This API initializes a single-producer, single-consumer queue of FIFO samples.
+ */
+int8_t bmi3_sample_queue_init(struct bmi3_sample_queue *queue,
+                              struct bmi3_fifo_sens_axes_data *slots,
+                              uint16_t num_slots)
+{
+    /* Variable to store result of API */
+    int8_t rslt = BMI3_OK;
+
+    if ((queue == NULL) || (slots == NULL))
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
+    else if ((num_slots == 0) || ((num_slots & (num_slots - 1)) != 0))
+    {
+        rslt = BMI3_E_INVALID_INPUT;
+    }
+    else
+    {
+        queue->head = 0;
+        queue->pending = 0;
+        queue->tail_cache = 0;
+        queue->tail = 0;
+        queue->head_cache = 0;
+        queue->slots = slots;
+        queue->mask = (uint32_t)num_slots - 1;
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This API gets the contiguous free slots of the queue for the producer.
+ */
+int8_t bmi3_sample_queue_reserve(struct bmi3_sample_queue *queue,
+                                 struct bmi3_fifo_sens_axes_data **slots,
+                                 uint16_t *count)
+{
+    /* Variable to store result of API */
+    int8_t rslt = BMI3_E_NULL_PTR;
+
+    /* Variable to store the slots up to the end of the buffer */
+    uint32_t to_end;
+
+    /* Variable to store number of free slots known to the producer */
+    uint32_t free_slots;
+
+    if ((queue != NULL) && (queue->slots != NULL) && (slots != NULL) && (count != NULL))
+    {
+        to_end = (queue->mask + 1) - (queue->pending & queue->mask);
+        free_slots = (queue->mask + 1) - (queue->pending - queue->tail_cache);
+
+        /* Consumer index is loaded only if the copy limits the contiguous space */
+        if (free_slots < to_end)
+        {
+            queue->tail_cache = BMI3_LOAD_ACQUIRE(&queue->tail);
+            free_slots = (queue->mask + 1) - (queue->pending - queue->tail_cache);
+        }
+
+        *slots = &queue->slots[queue->pending & queue->mask];
+        *count = (uint16_t)((free_slots < to_end) ? free_slots : to_end);
+        rslt = BMI3_OK;
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This API marks reserved slots as written, without publishing them.
+ */
+int8_t bmi3_sample_queue_produce(struct bmi3_sample_queue *queue, uint16_t count)
+{
+    /* Variable to store result of API */
+    int8_t rslt = BMI3_E_NULL_PTR;
+
+    if (queue != NULL)
+    {
+        /* More slots than free are not taken */
+        if (count <= ((queue->mask + 1) - (queue->pending - queue->tail_cache)))
+        {
+            queue->pending += count;
+            rslt = BMI3_OK;
+        }
+        else
+        {
+            rslt = BMI3_E_INVALID_INPUT;
+        }
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This API publishes all slots written by the producer with one store.
+ */
+int8_t bmi3_sample_queue_commit(struct bmi3_sample_queue *queue)
+{
+    /* Variable to store result of API */
+    int8_t rslt = BMI3_E_NULL_PTR;
+
+    if (queue != NULL)
+    {
+        BMI3_STORE_RELEASE(&queue->head, queue->pending);
+        rslt = BMI3_OK;
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This API gets the contiguous published slots of the queue for the consumer.
+ */
+int8_t bmi3_sample_queue_peek(struct bmi3_sample_queue *queue,
+                              const struct bmi3_fifo_sens_axes_data **slots,
+                              uint16_t *count)
+{
+    /* Variable to store result of API */
+    int8_t rslt = BMI3_E_NULL_PTR;
+
+    /* Variable to store the index of the next slot of the consumer */
+    uint32_t tail;
+
+    /* Variable to store the slots up to the end of the buffer */
+    uint32_t to_end;
+
+    /* Variable to store number of slots known to the consumer */
+    uint32_t used;
+
+    if ((queue != NULL) && (queue->slots != NULL) && (slots != NULL) && (count != NULL))
+    {
+        tail = queue->tail;
+        to_end = (queue->mask + 1) - (tail & queue->mask);
+        used = queue->head_cache - tail;
+
+        /* Producer index is loaded only if the copy limits the contiguous data */
+        if (used < to_end)
+        {
+            queue->head_cache = BMI3_LOAD_ACQUIRE(&queue->head);
+            used = queue->head_cache - tail;
+        }
+
+        *slots = &queue->slots[tail & queue->mask];
+        *count = (uint16_t)((used < to_end) ? used : to_end);
+        rslt = BMI3_OK;
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This API releases slots read by the consumer to the producer.
+ */
+int8_t bmi3_sample_queue_release(struct bmi3_sample_queue *queue, uint16_t count)
+{
+    /* Variable to store result of API */
+    int8_t rslt = BMI3_E_NULL_PTR;
+
+    if (queue != NULL)
+    {
+        /* More slots than published are not released */
+        if (count <= (queue->head_cache - queue->tail))
+        {
+            BMI3_STORE_RELEASE(&queue->tail, queue->tail + count);
+            rslt = BMI3_OK;
+        }
+        else
+        {
+            rslt = BMI3_E_INVALID_INPUT;
+        }
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This API extracts the FIFO frames straight into the free slots of the
+ * accel and gyro queues and publishes them with one store per queue.
+ */
+int8_t bmi3_sample_queue_push_fifo(struct bmi3_sample_queue *accel_queue,
+                                   struct bmi3_sample_queue *gyro_queue,
+                                   uint16_t *dropped,
+                                   const struct bmi3_fifo_frame *fifo,
+                                   const struct bmi3_dev *dev)
+{
+    /* Variable to store result of API */
+    int8_t rslt;
+
+    /* Array to drop the temperature frames */
+    struct bmi3_fifo_temperature_data temp_data[BMI3_SAMPLE_QUEUE_TEMP_CHUNK];
+
+    /* Pointers to the free slots */
+    struct bmi3_fifo_sens_axes_data *accel_slots = NULL;
+    struct bmi3_fifo_sens_axes_data *gyro_slots = NULL;
+
+    /* Pointer to the frame layout */
+    const struct bmi3_fifo_frame_layout *layout;
+
+    /* Structure to store the number of frames */
+    struct bmi3_fifo_census census;
+
+    /* Variables to store the frames pushed, of the FIFO data and of a range */
+    uint16_t first = 0;
+    uint16_t frames = 0;
+    uint16_t count;
+    uint16_t free_slots;
+
+    rslt = bmi3_fifo_census(&census, BMI3_DISABLE, fifo, dev);
+
+    if (rslt == BMI3_OK)
+    {
+        layout = select_fifo_frame_layout(fifo);
+        frames = census.frames;
+
+        if (((layout->acc_offset != BMI3_FIFO_NO_DATA) && (accel_queue == NULL)) ||
+            ((layout->gyr_offset != BMI3_FIFO_NO_DATA) && (gyro_queue == NULL)))
+        {
+            rslt = BMI3_E_NULL_PTR;
+        }
+
+        while ((rslt == BMI3_OK) && (first < frames))
+        {
+            count = (uint16_t)(frames - first);
+
+            if (layout->temp_offset != BMI3_FIFO_NO_DATA)
+            {
+                count = (count < BMI3_SAMPLE_QUEUE_TEMP_CHUNK) ? count : BMI3_SAMPLE_QUEUE_TEMP_CHUNK;
+            }
+
+            /* A range fills the contiguous free slots of both queues */
+            if (layout->acc_offset != BMI3_FIFO_NO_DATA)
+            {
+                rslt = bmi3_sample_queue_reserve(accel_queue, &accel_slots, &free_slots);
+                count = (count < free_slots) ? count : free_slots;
+            }
+
+            if (layout->gyr_offset != BMI3_FIFO_NO_DATA)
+            {
+                rslt = bmi3_sample_queue_reserve(gyro_queue, &gyro_slots, &free_slots);
+                count = (count < free_slots) ? count : free_slots;
+            }
+
+            if ((rslt != BMI3_OK) || (count == 0))
+            {
+                break;
+            }
+
+            rslt = bmi3_extract_range(accel_slots,
+                                      gyro_slots,
+                                      temp_data,
+                                      first,
+                                      (uint16_t)(first + count),
+                                      &census,
+                                      fifo,
+                                      dev);
+
+            if (rslt == BMI3_OK)
+            {
+                if (accel_slots != NULL)
+                {
+                    accel_queue->pending += census.accel_frames;
+                }
+
+                if (gyro_slots != NULL)
+                {
+                    gyro_queue->pending += census.gyro_frames;
+                }
+
+                first += count;
+            }
+        }
+
+        /* Frames extracted so far are published, also on error */
+        if (accel_slots != NULL)
+        {
+            BMI3_STORE_RELEASE(&accel_queue->head, accel_queue->pending);
+        }
+
+        if (gyro_slots != NULL)
+        {
+            BMI3_STORE_RELEASE(&gyro_queue->head, gyro_queue->pending);
+        }
+
+        if ((rslt == BMI3_OK) && (first < frames))
+        {
+            rslt = BMI3_W_QUEUE_FULL;
+        }
+    }
+
+    if (dropped != NULL)
+    {
+        *dropped = (uint16_t)(frames - first);
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This API initializes the latest frames of a FIFO stream.
+ */
+int8_t bmi3_latest_init(uint8_t odr, bmi3_host_time_ns_fptr_t host_time_ns, struct bmi3_latest *latest)
+{
+    /* Variable to store result of API */
+    int8_t rslt = BMI3_OK;
+
+    if ((host_time_ns != NULL) && (latest != NULL))
+    {
+        if ((odr >= BMI3_ACC_ODR_0_78HZ) && (odr <= BMI3_ACC_ODR_6400HZ))
+        {
+            latest->host_time_ns = host_time_ns;
+            latest->push_ns = 0;
+            latest->reg_reads = 0;
+            latest->head = 0;
+            latest->count = 0;
+
+            /* Output data rate in mHz halves with each ODR step below 6400Hz */
+            latest->period_ns = (uint32_t)(UINT64_C(1000000000000) / (BMI3_ODR_6400HZ_MHZ >> (BMI3_ACC_ODR_6400HZ - odr)));
+        }
+        else
+        {
+            rslt = BMI3_E_INVALID_INPUT;
+        }
+    }
+    else
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This API keeps the latest frames of a batch read from FIFO.
+ */
+int8_t bmi3_latest_push(const struct bmi3_fifo_6dof_data *data,
+                        uint16_t n_frames,
+                        struct bmi3_latest *latest,
+                        struct bmi3_dev *dev)
+{
+    /* Variable to store result of API */
+    int8_t rslt;
+
+    /* Variable to define loop */
+    uint16_t idx;
+
+    rslt = null_ptr_check(dev);
+
+    if ((rslt == BMI3_OK) && (data != NULL) && (latest != NULL) && (latest->host_time_ns != NULL))
+    {
+        lock_dev(dev);
+
+        /* Older frames of a large batch would be overwritten anyway */
+        idx = (n_frames > BMI3_LATEST_MAX_FRAMES) ? (uint16_t)(n_frames - BMI3_LATEST_MAX_FRAMES) : 0;
+
+        for (; idx < n_frames; idx++)
+        {
+            latest->head = (uint8_t)((latest->head + 1) % BMI3_LATEST_MAX_FRAMES);
+            latest->frame[latest->head] = data[idx];
+
+            if (latest->count < BMI3_LATEST_MAX_FRAMES)
+            {
+                latest->count++;
+            }
+        }
+
+        if (n_frames != 0)
+        {
+            latest->push_ns = latest->host_time_ns(dev->intf_ptr);
+        }
+
+        unlock_dev(dev);
+    }
+    else if (rslt == BMI3_OK)
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This API gives the latest frames of the stream.
+ */
+int8_t bmi3_latest_peek(struct bmi3_fifo_6dof_data *data,
+                        uint8_t *count,
+                        struct bmi3_latest *latest,
+                        struct bmi3_dev *dev)
+{
+    /* Variable to store result of API */
+    int8_t rslt;
+
+    /* Array to store accel, gyro, temperature and sensor time registers */
+    uint8_t reg_data[BMI3_LATEST_REG_LEN] = { 0 };
+
+    /* Variables to define loop and number of frames given */
+    uint8_t idx, given = 0;
+
+    rslt = null_ptr_check(dev);
+
+    if ((rslt == BMI3_OK) && (data != NULL) && (count != NULL) && (latest != NULL) && (latest->host_time_ns != NULL))
+    {
+        lock_dev(dev);
+
+        if ((*count != 0) &&
+            ((latest->count == 0) || ((latest->host_time_ns(dev->intf_ptr) - latest->push_ns) >= latest->period_ns)))
+        {
+            /* Data registers hold a newer sample than the last push */
+            rslt = bmi3_get_regs(BMI3_REG_ACC_DATA_X, reg_data, BMI3_LATEST_REG_LEN, dev);
+
+            if (rslt == BMI3_OK)
+            {
+                data[0].acc_x = (int16_t)(((uint16_t)reg_data[1] << 8) | reg_data[0]);
+                data[0].acc_y = (int16_t)(((uint16_t)reg_data[3] << 8) | reg_data[2]);
+                data[0].acc_z = (int16_t)(((uint16_t)reg_data[5] << 8) | reg_data[4]);
+                data[0].gyr_x = (int16_t)(((uint16_t)reg_data[7] << 8) | reg_data[6]);
+                data[0].gyr_y = (int16_t)(((uint16_t)reg_data[9] << 8) | reg_data[8]);
+                data[0].gyr_z = (int16_t)(((uint16_t)reg_data[11] << 8) | reg_data[10]);
+                data[0].sensor_time = (uint16_t)(((uint16_t)reg_data[15] << 8) | reg_data[14]);
+
+                latest->reg_reads++;
+                given = 1;
+            }
+        }
+
+        if (rslt == BMI3_OK)
+        {
+            for (idx = 0; (given < *count) && (idx < latest->count); idx++)
+            {
+                data[given] = latest->frame[(latest->head + BMI3_LATEST_MAX_FRAMES - idx) % BMI3_LATEST_MAX_FRAMES];
+                given++;
+            }
+
+            *count = given;
+        }
+
+        unlock_dev(dev);
+    }
+    else if (rslt == BMI3_OK)
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This API initializes a context which owns all buffers of the FIFO
+ * path, carved out of the arena provided by the user.
+ */
+int8_t bmi3_ctx_init(struct bmi3_ctx *ctx,
+                     uint8_t *arena,
+                     uint32_t arena_size,
+                     uint16_t fifo_words,
+                     uint16_t fifo_config,
+                     struct bmi3_dev *dev)
+{
+    /* Variable to store result of API */
+    int8_t rslt;
+
+    /* Variable to store number of frames the arena holds */
+    uint16_t frames;
+
+    /* Pointer to the free space of the arena */
+    uint8_t *pos;
+
+    rslt = null_ptr_check(dev);
+
+    if ((rslt == BMI3_OK) && (ctx != NULL) && (arena != NULL))
+    {
+        fifo_config &= BMI3_FIFO_ALL_EN;
+
+        if (!(fifo_config & (BMI3_FIFO_ACC_EN | BMI3_FIFO_GYR_EN | BMI3_FIFO_TEMP_EN)) || (fifo_words == 0) ||
+            (fifo_words > BMI3_FIFO_SIZE_WORDS) || (arena_size < BMI3_CTX_ARENA_SIZE(fifo_words, fifo_config)))
+        {
+            rslt = BMI3_E_INVALID_INPUT;
+        }
+        else
+        {
+            frames = (uint16_t)BMI3_CTX_FRAMES(fifo_words, fifo_config);
+
+            /* Output arrays hold 16-bit words */
+            pos = arena + ((uintptr_t)arena & 1);
+
+            ctx->dev = dev;
+            ctx->fifo_config = fifo_config;
+            ctx->fifo_len = (uint16_t)(fifo_words * 2);
+            ctx->accel_data = NULL;
+            ctx->gyro_data = NULL;
+            ctx->temp_data = NULL;
+
+            if (fifo_config & BMI3_FIFO_ACC_EN)
+            {
+                ctx->accel_data = (struct bmi3_fifo_sens_axes_data *)(void *)pos;
+                pos += frames * sizeof(struct bmi3_fifo_sens_axes_data);
+            }
+
+            if (fifo_config & BMI3_FIFO_GYR_EN)
+            {
+                ctx->gyro_data = (struct bmi3_fifo_sens_axes_data *)(void *)pos;
+                pos += frames * sizeof(struct bmi3_fifo_sens_axes_data);
+            }
+
+            if (fifo_config & BMI3_FIFO_TEMP_EN)
+            {
+                ctx->temp_data = (struct bmi3_fifo_temperature_data *)(void *)pos;
+                pos += frames * sizeof(struct bmi3_fifo_temperature_data);
+            }
+
+            ctx->fifo.data = pos;
+            ctx->fifo.length = 0;
+            ctx->fifo.available_fifo_len = 0;
+            ctx->fifo.available_fifo_sens = fifo_config;
+            ctx->fifo.avail_fifo_accel_frames = 0;
+            ctx->fifo.avail_fifo_gyro_frames = 0;
+            ctx->fifo.avail_fifo_temp_frames = 0;
+            ctx->fifo.layout = get_fifo_frame_layout(fifo_config);
+#ifdef BMI3_DEV_SCRATCH
+
+            /* Register reads of the device use the scratch buffer of the arena */
+            pos += ctx->fifo_len + BMI3_MAX_DUMMY_BYTE;
+            dev->scratch = pos;
+#endif
+        }
+    }
+    else if (rslt == BMI3_OK)
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This API reads the available FIFO data into the raw FIFO buffer of the
+ * context and extracts it into the output arrays of the context.
+ */
+int8_t bmi3_ctx_read_fifo(struct bmi3_ctx *ctx)
+{
+    /* Variable to store result of API */
+    int8_t rslt;
+
+    /* Variable to store FIFO configuration */
+    uint16_t fifo_config = 0;
+
+    /* Variable to store number of bytes to be read */
+    uint16_t len;
+
+    if ((ctx != NULL) && (ctx->fifo.data != NULL))
+    {
+        lock_dev(ctx->dev);
+
+        ctx->fifo.avail_fifo_accel_frames = 0;
+        ctx->fifo.avail_fifo_gyro_frames = 0;
+        ctx->fifo.avail_fifo_temp_frames = 0;
+
+        rslt = bmi3_get_fifo_length(&ctx->fifo.available_fifo_len, ctx->dev);
+
+        if (rslt == BMI3_OK)
+        {
+            /* Served without bus access if the shadow register cache is enabled */
+            rslt = bmi3_get_fifo_config(&fifo_config, ctx->dev);
+        }
+
+        if (rslt == BMI3_OK)
+        {
+            /* Output arrays are sized for the FIFO configuration of the context */
+            if ((fifo_config & BMI3_FIFO_ALL_EN) != ctx->fifo_config)
+            {
+                rslt = BMI3_E_INVALID_STATUS;
+            }
+            else if (ctx->fifo.available_fifo_len == 0)
+            {
+                rslt = BMI3_W_FIFO_EMPTY;
+            }
+        }
+
+        if (rslt == BMI3_OK)
+        {
+            /* Read the available FIFO data, limited by the raw FIFO buffer */
+            len = (uint16_t)(ctx->fifo.available_fifo_len * 2);
+
+            if (len > ctx->fifo_len)
+            {
+                len = ctx->fifo_len;
+            }
+
+            ctx->fifo.available_fifo_len = len / 2;
+            ctx->fifo.length = (uint16_t)(len + ctx->dev->dummy_byte);
+            ctx->fifo.available_fifo_sens = ctx->fifo_config;
+            ctx->fifo.layout = get_fifo_frame_layout(ctx->fifo_config);
+
+            rslt = read_regs_direct(BMI3_REG_FIFO_DATA, ctx->fifo.data, len, get_fifo_read(ctx->dev), ctx->dev);
+        }
+
+        if (rslt == BMI3_OK)
+        {
+            rslt = bmi3_extract_all(ctx->accel_data, ctx->gyro_data, ctx->temp_data, &ctx->fifo, ctx->dev);
+        }
+
+        unlock_dev(ctx->dev);
+    }
+    else
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This API services the FIFO interrupts: it reads the interrupt status
+ * and FIFO fill level in one burst, and the FIFO data if a FIFO watermark or
+ * full interrupt is pending.
+ */
+int8_t bmi3_fifo_service(uint16_t *int1_status,
+                         uint16_t *int2_status,
+                         struct bmi3_fifo_frame *fifo,
+                         struct bmi3_dev *dev)
+{
+    /* Variable to store result of API */
+    int8_t rslt;
+
+    /* Array to store interrupt status, feature IO and FIFO fill level registers */
+    uint8_t reg_data[BMI3_FIFO_SERVICE_LEN] = { 0 };
+
+    /* Variables to store interrupt status */
+    uint16_t int1, int2;
+
+    /* Variable to store FIFO configuration */
+    uint16_t fifo_config = 0;
+
+    lock_dev(dev);
+
+    if ((int1_status != NULL) && (fifo != NULL) && (fifo->data != NULL))
+    {
+        /* Interrupt status and fill level registers are adjacent, read them at once */
+        rslt = bmi3_get_regs(BMI3_REG_INT_STATUS_INT1, reg_data, BMI3_FIFO_SERVICE_LEN, dev);
+
+        if (rslt == BMI3_OK)
+        {
+            int1 = (uint16_t)(reg_data[0] | ((uint16_t)reg_data[1] << 8));
+            int2 = (uint16_t)(reg_data[2] | ((uint16_t)reg_data[3] << 8));
+
+            *int1_status = int1;
+
+            if (int2_status != NULL)
+            {
+                *int2_status = int2;
+            }
+
+            fifo->available_fifo_len =
+                (uint16_t)(reg_data[BMI3_FIFO_SERVICE_FILL_LEVEL_POS] |
+                           ((uint16_t)reg_data[BMI3_FIFO_SERVICE_FILL_LEVEL_POS + 1] << 8)) & BMI3_FIFO_FILL_LEVEL_MASK;
+
+            if (!((int1 | int2) & (BMI3_INT_STATUS_FWM | BMI3_INT_STATUS_FFULL)))
+            {
+                /* No FIFO interrupt is pending */
+                fifo->available_fifo_len = 0;
+            }
+            else if (fifo->available_fifo_len == 0)
+            {
+                rslt = BMI3_W_FIFO_EMPTY;
+            }
+            else
+            {
+                /* Served without bus access if the shadow register cache is enabled */
+                rslt = bmi3_get_fifo_config(&fifo_config, dev);
+            }
+        }
+
+        if ((rslt == BMI3_OK) && (fifo->available_fifo_len != 0))
+        {
+            rslt = read_available_fifo(fifo_config, fifo, dev);
+        }
+    }
+    else
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
+
+    unlock_dev(dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API computes the FIFO water-mark level for the given ODRs,
+ * FIFO frames and host budget.
+ */
+int8_t bmi3_compute_fifo_wm(const struct bmi3_fifo_wm_budget *budget,
+                            uint16_t fifo_sens,
+                            uint8_t acc_odr,
+                            uint8_t gyr_odr,
+                            uint16_t *fifo_wm)
+{
+    /* Variable to store result of API */
+    int8_t rslt = BMI3_OK;
+
+    /* Variable to store ODR of the frames */
+    uint8_t odr = 0;
+
+    /* Variable to store frame length in words */
+    uint16_t frame_words;
+
+    /* Variable to store FIFO data rate in milli-words per second */
+    uint64_t rate;
+
+    /* Variables to store water-mark levels limited by latency and overflow */
+    uint64_t wm_latency, wm_overflow;
+
+    /* Variable to store words of FIFO not filled during service */
+    uint64_t free_words;
+
+    if ((budget != NULL) && (fifo_wm != NULL))
+    {
+        /* Frames are stored at the higher ODR of the sensors enabled in FIFO */
+        if (fifo_sens & BMI3_FIFO_ACC_EN)
+        {
+            odr = acc_odr;
+        }
+
+        if ((fifo_sens & BMI3_FIFO_GYR_EN) && (gyr_odr > odr))
+        {
+            odr = gyr_odr;
+        }
+
+        frame_words = get_fifo_frame_layout(fifo_sens)->frame_len / 2;
+
+        if ((odr < BMI3_ACC_ODR_0_78HZ) || (odr > BMI3_ACC_ODR_6400HZ) || (frame_words == 0) || (budget->bus_hz == 0))
+        {
+            rslt = BMI3_E_INVALID_INPUT;
+        }
+    }
+    else
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
+
+    if (rslt == BMI3_OK)
+    {
+        rate = (uint64_t)(BMI3_ODR_6400HZ_MHZ >> (BMI3_ACC_ODR_6400HZ - odr)) * frame_words;
+
+        /* Words stored within the latency budget */
+        wm_latency = (rate * budget->latency_us) / UINT64_C(1000000000);
+
+        /*
+         * Words stored until the FIFO is read, while servicing and reading the
+         * water-mark level of 16-bit words, must fit in the FIFO:
+         * wm + rate * (service + wm * 16 / bus_hz) <= size
+         */
+        free_words = (uint64_t)BMI3_FIFO_SIZE_WORDS * UINT64_C(1000000000);
+
+        if ((rate * budget->service_us) < free_words)
+        {
+            free_words -= rate * budget->service_us;
+            wm_overflow = free_words /
+                          (UINT64_C(1000000000) + ((rate * UINT64_C(16) * UINT64_C(1000000)) / budget->bus_hz));
+        }
+        else
+        {
+            wm_overflow = 0;
+        }
+
+        if (wm_latency > wm_overflow)
+        {
+            wm_latency = wm_overflow;
+        }
+
+        if (wm_latency > BMI3_FIFO_WATERMARK_MASK)
+        {
+            wm_latency = BMI3_FIFO_WATERMARK_MASK;
+        }
+
+        /* Water-mark level is a multiple of the frame length, at least one frame */
+        wm_latency = (wm_latency / frame_words) * frame_words;
+
+        if (wm_latency == 0)
+        {
+            if (wm_overflow >= frame_words)
+            {
+                wm_latency = frame_words;
+            }
+            else
+            {
+                /* FIFO overflow cannot be avoided with the given budget */
+                rslt = BMI3_E_INVALID_INPUT;
+            }
+        }
+
+        *fifo_wm = (uint16_t)wm_latency;
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This API sets the FIFO water-mark level computed for the current
+ * accel, gyro and FIFO configuration and the given host budget.
+ */
+int8_t bmi3_tune_fifo_wm(const struct bmi3_fifo_wm_budget *budget, struct bmi3_dev *dev)
+{
+    /* Variable to store result of API */
+    int8_t rslt;
+
+    /* Structures to store accel and gyro configurations */
+    struct bmi3_accel_config acc_config = { 0 };
+    struct bmi3_gyro_config gyr_config = { 0 };
+
+    /* Variable to store FIFO configuration */
+    uint16_t fifo_config = 0;
+
+    /* Variable to store FIFO water-mark level */
+    uint16_t fifo_wm = 0;
+
+    lock_dev(dev);
+
+    rslt = null_ptr_check(dev);
+
+    if (rslt == BMI3_OK)
+    {
+        rslt = bmi3_get_fifo_config(&fifo_config, dev);
+    }
+
+    if ((rslt == BMI3_OK) && (fifo_config & BMI3_FIFO_ACC_EN))
+    {
+        rslt = get_accel_config(&acc_config, dev);
+    }
+
+    if ((rslt == BMI3_OK) && (fifo_config & BMI3_FIFO_GYR_EN))
+    {
+        rslt = get_gyro_config(&gyr_config, dev);
+    }
+
+    if (rslt == BMI3_OK)
+    {
+        rslt = bmi3_compute_fifo_wm(budget, fifo_config & BMI3_FIFO_ALL_EN, acc_config.odr, gyr_config.odr, &fifo_wm);
+    }
+
+    if (rslt == BMI3_OK)
+    {
+        rslt = bmi3_set_fifo_wm(fifo_wm, dev);
+    }
+
+    unlock_dev(dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API estimates the supply current, host wake-ups and bus activity
+ * of a configuration.
+ */
+int8_t bmi3_estimate_power(const struct bmi3_power_cfg *cfg,
+                           const struct bmi3_current_table *table,
+                           const struct bmi3_bus_model *model,
+                           struct bmi3_power_estimate *estimate)
+{
+    /* Variable to store result of API */
+    int8_t rslt = BMI3_OK;
+
+    /* Default current table, typical values */
+    const struct bmi3_current_table default_table = {
+        BMI3_CURRENT_BASE_NA, BMI3_CURRENT_ACC_HP_NA, BMI3_CURRENT_ACC_NORMAL_NA, BMI3_CURRENT_ACC_LP_NA,
+        BMI3_CHARGE_ACC_LP_SAMPLE_PC, BMI3_CURRENT_GYR_HP_NA, BMI3_CURRENT_GYR_NORMAL_NA, BMI3_CURRENT_GYR_LP_NA,
+        BMI3_CHARGE_GYR_LP_SAMPLE_PC, BMI3_CURRENT_GYR_DRIVE_NA
+    };
+
+    /* Output data rates of accel and gyro in mHz, 0 if disabled */
+    uint32_t acc_mhz = 0;
+    uint32_t gyr_mhz = 0;
+
+    /* Sums of wake-ups, transactions and bytes in mHz and of the bus time in ns per 1000 s */
+    uint64_t sum[BMI3_POWER_SUMS] = { 0 };
+
+    /* FIFO data rate in milli-words per second */
+    uint64_t fifo_rate;
+
+    /* Words read on each FIFO interrupt */
+    uint16_t fifo_words = 0;
+
+    uint16_t frame_words;
+    uint8_t idx;
+
+    if ((cfg == NULL) || (model == NULL) || (estimate == NULL) || ((cfg->n_sens != 0) && (cfg->sens_cfg == NULL)))
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
+    else if (model->bus_hz == 0)
+    {
+        rslt = BMI3_E_INVALID_INPUT;
+    }
+    else
+    {
+        if (table == NULL)
+        {
+            table = &default_table;
+        }
+
+        estimate->sensor_na = table->base_na;
+
+        for (idx = 0; idx < cfg->n_sens; idx++)
+        {
+            if (cfg->sens_cfg[idx].type == BMI3_ACCEL)
+            {
+                estimate->sensor_na += get_accel_current(&cfg->sens_cfg[idx].cfg.acc, table, &acc_mhz);
+            }
+            else if (cfg->sens_cfg[idx].type == BMI3_GYRO)
+            {
+                estimate->sensor_na += get_gyro_current(&cfg->sens_cfg[idx].cfg.gyr, table, &gyr_mhz);
+            }
+        }
+
+        if (cfg->map_int != NULL)
+        {
+            if ((cfg->map_int->fifo_watermark_int != BMI3_INT_NONE) && (cfg->fifo_sens != 0))
+            {
+                fifo_words = cfg->fifo_wm;
+
+                if (fifo_words == 0)
+                {
+                    rslt = BMI3_E_INVALID_INPUT;
+                }
+            }
+            else if ((cfg->map_int->fifo_full_int != BMI3_INT_NONE) && (cfg->fifo_sens != 0))
+            {
+                fifo_words = BMI3_FIFO_SIZE_WORDS;
+            }
+
+            if ((rslt == BMI3_OK) && (fifo_words != 0))
+            {
+                /* Frames are stored at the higher ODR of the sensors enabled in FIFO */
+                fifo_rate = (cfg->fifo_sens & BMI3_FIFO_ACC_EN) ? acc_mhz : 0;
+
+                if ((cfg->fifo_sens & BMI3_FIFO_GYR_EN) && (gyr_mhz > fifo_rate))
+                {
+                    fifo_rate = gyr_mhz;
+                }
+
+                frame_words = get_fifo_frame_layout(cfg->fifo_sens)->frame_len / 2;
+                fifo_rate *= frame_words;
+
+                /* Fill level and interrupt status are read at once, then the FIFO data */
+                add_power_wakeups(fifo_rate / fifo_words, BMI3_FIFO_SERVICE_LEN, (uint16_t)(fifo_words * 2), model, sum);
+            }
+
+            /* Interrupt status and data of the sensor are read on each data ready interrupt */
+            if (cfg->map_int->acc_drdy_int != BMI3_INT_NONE)
+            {
+                add_power_wakeups(acc_mhz, 2, BMI3_POWER_AXES_LEN, model, sum);
+            }
+
+            if (cfg->map_int->gyr_drdy_int != BMI3_INT_NONE)
+            {
+                add_power_wakeups(gyr_mhz, 2, BMI3_POWER_AXES_LEN, model, sum);
+            }
+        }
+
+        /* Interrupt status is read on each feature interrupt */
+        add_power_wakeups(cfg->event_mhz, 2, 0, model, sum);
+    }
+
+    if (rslt == BMI3_OK)
+    {
+        sum[BMI3_POWER_SUM_BUS] = (sum[BMI3_POWER_SUM_BUS] * model->scale_q16) / BMI3_BUS_MODEL_SCALE_ONE;
+
+        sum[BMI3_POWER_SUM_BYTES] /= 1000;
+        sum[BMI3_POWER_SUM_BUS] /= UINT64_C(1000000);
+
+        for (idx = 0; idx < BMI3_POWER_SUMS; idx++)
+        {
+            sum[idx] = (sum[idx] > UINT32_MAX) ? UINT32_MAX : sum[idx];
+        }
+
+        estimate->wakeups_mhz = (uint32_t)sum[BMI3_POWER_SUM_WAKEUPS];
+        estimate->xfers_mhz = (uint32_t)sum[BMI3_POWER_SUM_XFERS];
+        estimate->bytes_per_s = (uint32_t)sum[BMI3_POWER_SUM_BYTES];
+        estimate->bus_us_per_s = (uint32_t)sum[BMI3_POWER_SUM_BUS];
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This API programs the user and alternate configurations, the switch
+ * sources and the FIFO water-mark level from the targets of the governor.
+ */
+int8_t bmi3_governor_config(const struct bmi3_governor_target *target,
+                            struct bmi3_governor *gov,
+                            struct bmi3_dev *dev)
+{
+    /* Variable to store result of API */
+    int8_t rslt;
+
+    /* Variable to store FIFO water-mark level */
+    uint16_t fifo_wm = 0;
+
+    /* Structure to store feature enable */
+    struct bmi3_feature_enable enable = { 0 };
+
+    lock_dev(dev);
+
+    rslt = null_ptr_check(dev);
+
+    if ((rslt == BMI3_OK) && ((target == NULL) || (gov == NULL)))
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
+
+    if (rslt == BMI3_OK)
+    {
+        rslt = check_governor_target(target);
+    }
+
+    if (rslt == BMI3_OK)
+    {
+        rslt = set_governor_config(target, dev);
+    }
+
+    if (rslt == BMI3_OK)
+    {
+        /* No-motion switches to the alternate configuration and any-motion back to the user configuration */
+        rslt = get_feature_enable(&enable, dev);
+
+        if (rslt == BMI3_OK)
+        {
+            enable.no_motion_x_en = BMI3_ENABLE;
+            enable.no_motion_y_en = BMI3_ENABLE;
+            enable.no_motion_z_en = BMI3_ENABLE;
+            enable.any_motion_x_en = BMI3_ENABLE;
+            enable.any_motion_y_en = BMI3_ENABLE;
+            enable.any_motion_z_en = BMI3_ENABLE;
+
+            rslt = bmi3_select_sensor(&enable, dev);
+        }
+    }
+
+    if (rslt == BMI3_OK)
+    {
+        rslt = bmi3_alternate_config_ctrl((target->gyro_en == BMI3_ENABLE) ?
+                                          (BMI3_ALT_ACC_ENABLE | BMI3_ALT_GYR_ENABLE) : BMI3_ALT_ACC_ENABLE,
+                                          BMI3_ALT_CONF_RESET_OFF,
+                                          dev);
+    }
+
+    if ((rslt == BMI3_OK) && (target->budget != NULL))
+    {
+        rslt = set_governor_fifo_wm(target, &fifo_wm, dev);
+    }
+
+    if (rslt == BMI3_OK)
+    {
+        gov->active_odr = target->active_odr;
+        gov->idle_odr = target->idle_odr;
+        gov->alt_active = BMI3_DISABLE;
+        gov->odr = target->active_odr;
+        gov->fifo_wm = fifo_wm;
+    }
+
+    unlock_dev(dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API reads which configuration is active and reports the
+ * effective sample rate to the FIFO timestamp reconstruction.
+ */
+int8_t bmi3_governor_update(struct bmi3_governor *gov, struct bmi3_fifo_time *fifo_time, struct bmi3_dev *dev)
+{
+    /* Variable to store result of API */
+    int8_t rslt;
+
+    /* Structure to store alternate status */
+    struct bmi3_alt_status alt_status = { 0 };
+
+    if (gov != NULL)
+    {
+        rslt = bmi3_read_alternate_status(&alt_status, dev);
+
+        if (rslt == BMI3_OK)
+        {
+            gov->alt_active = alt_status.alt_accel_status;
+            gov->odr = (gov->alt_active == BMI3_ENABLE) ? gov->idle_odr : gov->active_odr;
+
+            if ((fifo_time != NULL) && (gov->odr >= BMI3_ACC_ODR_0_78HZ) && (gov->odr <= BMI3_ACC_ODR_6400HZ))
+            {
+                /* Sample period doubles with each ODR step below 6400Hz */
+                fifo_time->period = BMI3_FIFO_TIME_6400HZ_TICKS << (BMI3_ACC_ODR_6400HZ - gov->odr);
+            }
+        }
+    }
+    else
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This API initializes the auto-range governor from the range set in
+ * the sensor.
+ */
+int8_t bmi3_auto_range_init(const struct bmi3_auto_range_target *target,
+                            struct bmi3_auto_range *ar,
+                            struct bmi3_dev *dev)
+{
+    /* Variable to store result of API */
+    int8_t rslt;
+
+    /* Variable to store the coarsest range of the sensor */
+    uint8_t range_limit;
+
+    /* Structure to read the range set in the sensor */
+    struct bmi3_sens_config config = { 0 };
+
+    rslt = null_ptr_check(dev);
+
+    if ((rslt == BMI3_OK) && ((target == NULL) || (ar == NULL)))
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
+
+    if (rslt == BMI3_OK)
+    {
+        range_limit = (target->type == BMI3_ACCEL) ? BMI3_ACC_RANGE_16G : BMI3_GYR_RANGE_2000DPS;
+
+        /* Half of up_thres is reached right after a switch to a coarser range, a finer range doubles it */
+        if (((target->type != BMI3_ACCEL) && (target->type != BMI3_GYRO)) || (target->min_range > target->max_range) ||
+            (target->max_range > range_limit) || ((uint32_t)target->down_thres * 2U >= target->up_thres))
+        {
+            rslt = BMI3_E_INVALID_INPUT;
+        }
+    }
+
+    if (rslt == BMI3_OK)
+    {
+        config.type = target->type;
+        rslt = bmi3_get_sensor_config(&config, 1, dev);
+    }
+
+    if (rslt == BMI3_OK)
+    {
+        ar->target = *target;
+        ar->range = (target->type == BMI3_ACCEL) ? config.cfg.acc.range : config.cfg.gyr.range;
+        set_unit_scale(target->type, ar->range, dev);
+        ar->scale_q = (target->type == BMI3_ACCEL) ? dev->unit_scale.acc_q : dev->unit_scale.gyr_q;
+        ar->prev_scale_q = ar->scale_q;
+        ar->prev_frames = 0;
+        ar->quiet = 0;
+        ar->peak = 0;
+        ar->n_switch = 0;
+        ar->n_sat = 0;
+
+        /* A range out of the targets is corrected by the next apply */
+        ar->next_range = ar->range;
+
+        if (ar->range < target->min_range)
+        {
+            ar->next_range = target->min_range;
+        }
+        else if (ar->range > target->max_range)
+        {
+            ar->next_range = target->max_range;
+        }
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This API counts a sample of the data registers to the auto-range
+ * governor.
+ */
+int8_t bmi3_auto_range_update(const struct bmi3_sens_axes_data *data, struct bmi3_auto_range *ar)
+{
+    /* Variable to store result of API */
+    int8_t rslt = BMI3_OK;
+
+    if ((data != NULL) && (ar != NULL))
+    {
+        auto_range_sample(data->x, data->y, data->z, (uint8_t)(data->sat_x | data->sat_y | data->sat_z), ar);
+    }
+    else
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This API counts FIFO frames to the auto-range governor and tags each
+ * frame with the scale of the range it was sampled with.
+ */
+int8_t bmi3_auto_range_update_fifo(const struct bmi3_fifo_sens_axes_data *data,
+                                   uint16_t n_frames,
+                                   int32_t *scale_q,
+                                   struct bmi3_auto_range *ar)
+{
+    /* Variable to store result of API */
+    int8_t rslt = BMI3_OK;
+
+    /* Variable to define loop */
+    uint16_t loop;
+
+    if ((data != NULL) && (ar != NULL))
+    {
+        for (loop = 0; loop < n_frames; loop++)
+        {
+            /* Frames sampled before the last switch are tagged only, their range is not the one set */
+            if (ar->prev_frames > 0)
+            {
+                ar->prev_frames--;
+
+                if (scale_q != NULL)
+                {
+                    scale_q[loop] = ar->prev_scale_q;
+                }
+            }
+            else
+            {
+                auto_range_sample(data[loop].x, data[loop].y, data[loop].z, BMI3_DISABLE, ar);
+
+                if (scale_q != NULL)
+                {
+                    scale_q[loop] = ar->scale_q;
+                }
+            }
+        }
+    }
+    else
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This API sets the range decided by the auto-range governor and
+ * counts the frames left in the FIFO with the previous range.
+ */
+int8_t bmi3_auto_range_apply(struct bmi3_auto_range *ar, struct bmi3_dev *dev)
+{
+    /* Variable to store result of API */
+    int8_t rslt;
+
+    /* Register of the sensor configuration */
+    uint8_t reg_addr;
+
+    /* Array to store the sensor configuration and FIFO configuration */
+    uint8_t reg_data[2] = { 0 };
+    uint8_t fifo_conf[2] = { 0 };
+
+    /* Variable to store the FIFO fill level in words */
+    uint16_t fifo_len = 0;
+
+    /* Variable to store the layout of the FIFO frames */
+    const struct bmi3_fifo_frame_layout *layout;
+
+    uint8_t data_offset;
+
+    lock_dev(dev);
+
+    rslt = null_ptr_check(dev);
+
+    if ((rslt == BMI3_OK) && (ar == NULL))
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
+
+    if ((rslt == BMI3_OK) && (ar->next_range != ar->range))
+    {
+        reg_addr = (ar->target.type == BMI3_ACCEL) ? BMI3_REG_ACC_CONF : BMI3_REG_GYR_CONF;
+
+        /* Configurations are served by the register cache, if enabled */
+        rslt = bmi3_get_regs(BMI3_REG_FIFO_CONF, fifo_conf, 2, dev);
+
+        if (rslt == BMI3_OK)
+        {
+            rslt = bmi3_get_regs(reg_addr, reg_data, 2, dev);
+        }
+
+        /* Fill level is read right before the switch, frames in the FIFO keep the previous range */
+        if (rslt == BMI3_OK)
+        {
+            rslt = bmi3_get_fifo_length(&fifo_len, dev);
+            rslt = (rslt == BMI3_W_FIFO_EMPTY) ? BMI3_OK : rslt;
+        }
+
+        if (rslt == BMI3_OK)
+        {
+            /* Range field is at the same position in the accel and gyro configuration */
+            reg_data[0] = BMI3_SET_BITS(reg_data[0], BMI3_ACC_RANGE, ar->next_range);
+            rslt = bmi3_set_regs(reg_addr, reg_data, 2, dev);
+        }
+
+        if (rslt == BMI3_OK)
+        {
+            layout = get_fifo_frame_layout(((uint16_t)fifo_conf[1] << 8) & BMI3_FIFO_HEAD_LESS_ALL_FRM);
+            data_offset = (ar->target.type == BMI3_ACCEL) ? layout->acc_offset : layout->gyr_offset;
+
+            ar->prev_frames = 0;
+
+            if ((data_offset != BMI3_FIFO_NO_DATA) && (layout->frame_len > 0))
+            {
+                ar->prev_frames = (uint16_t)((fifo_len * 2U) / layout->frame_len);
+            }
+
+            set_unit_scale(ar->target.type, ar->next_range, dev);
+            ar->prev_scale_q = ar->scale_q;
+            ar->scale_q = (ar->target.type == BMI3_ACCEL) ? dev->unit_scale.acc_q : dev->unit_scale.gyr_q;
+            ar->range = ar->next_range;
+            ar->quiet = 0;
+            ar->peak = 0;
+            ar->n_switch++;
+        }
+    }
+
+    unlock_dev(dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API initializes the scheduler, with no consumer registered.
+ */
+int8_t bmi3_sched_init(uint16_t fifo_sens,
+                       uint8_t int_pin,
+                       uint32_t service_us,
+                       uint32_t bus_hz,
+                       struct bmi3_sched *sched)
+{
+    /* Variable to store result of API */
+    int8_t rslt = BMI3_OK;
+
+    uint8_t idx;
+
+    if (sched == NULL)
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
+    else if (((fifo_sens & (BMI3_FIFO_ACC_EN | BMI3_FIFO_GYR_EN)) == 0) ||
+             ((fifo_sens & ~(BMI3_FIFO_ACC_EN | BMI3_FIFO_GYR_EN)) != 0) || (int_pin == BMI3_INT_NONE) ||
+             (int_pin > BMI3_I3C_INT) || (bus_hz == 0))
+    {
+        rslt = BMI3_E_INVALID_INPUT;
+    }
+    else
+    {
+        for (idx = 0; idx < BMI3_SCHED_MAX_CONSUMERS; idx++)
+        {
+            sched->consumer[idx].latency_us = 0;
+            sched->consumer[idx].odr = 0;
+        }
+
+        sched->service_us = service_us;
+        sched->bus_hz = bus_hz;
+        sched->fifo_sens = fifo_sens;
+        sched->int_pin = int_pin;
+        sched->mode = BMI3_SCHED_DRDY;
+        sched->odr = 0;
+        sched->applied = BMI3_DISABLE;
+        sched->fifo_wm = 0;
+        sched->latency_us = 0;
+        sched->wakeup_mhz = 0;
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This API sets or removes the requirements of a consumer of the
+ * scheduler.
+ */
+int8_t bmi3_sched_set_consumer(uint8_t id, uint32_t latency_us, uint8_t odr, struct bmi3_sched *sched)
+{
+    /* Variable to store result of API */
+    int8_t rslt = BMI3_OK;
+
+    if (sched == NULL)
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
+    else if ((id >= BMI3_SCHED_MAX_CONSUMERS) ||
+             ((latency_us != 0) && ((odr < BMI3_ACC_ODR_0_78HZ) || (odr > BMI3_ACC_ODR_6400HZ))))
+    {
+        rslt = BMI3_E_INVALID_INPUT;
+    }
+    else
+    {
+        sched->consumer[id].latency_us = latency_us;
+        sched->consumer[id].odr = (latency_us != 0) ? odr : 0;
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This API decides between data-ready and FIFO mode from the
+ * requirements of the consumers and sets the ODR, FIFO and interrupt mapping.
+ */
+int8_t bmi3_sched_apply(struct bmi3_sched *sched, struct bmi3_dev *dev)
+{
+    /* Variable to store result of API */
+    int8_t rslt;
+
+    /* Array to store the accel and gyro configurations */
+    struct bmi3_sens_config config[2] = { { 0 } };
+
+    /* Structure to store the budget of the FIFO water-mark level */
+    struct bmi3_fifo_wm_budget budget;
+
+    /* Variables to store the tightest latency and highest ODR of the consumers */
+    uint32_t latency_us = 0;
+    uint8_t odr = 0;
+
+    /* Variables to store the mode decided and its FIFO water-mark level */
+    uint8_t mode = BMI3_SCHED_DRDY;
+    uint16_t fifo_wm = 0;
+
+    /* Variable to store the frame length in words */
+    uint16_t frame_words;
+
+    /* Variable to store the data rate in milli-Hz */
+    uint32_t odr_mhz;
+
+    uint8_t n_sens = 0;
+    uint8_t changed = BMI3_DISABLE;
+    uint8_t idx;
+
+    lock_dev(dev);
+
+    rslt = null_ptr_check(dev);
+
+    if ((rslt == BMI3_OK) && (sched == NULL))
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
+
+    if (rslt == BMI3_OK)
+    {
+        for (idx = 0; idx < BMI3_SCHED_MAX_CONSUMERS; idx++)
+        {
+            if (sched->consumer[idx].latency_us != 0)
+            {
+                if ((latency_us == 0) || (sched->consumer[idx].latency_us < latency_us))
+                {
+                    latency_us = sched->consumer[idx].latency_us;
+                }
+
+                if (sched->consumer[idx].odr > odr)
+                {
+                    odr = sched->consumer[idx].odr;
+                }
+            }
+        }
+
+        if (latency_us == 0)
+        {
+            rslt = BMI3_E_INVALID_INPUT;
+        }
+    }
+
+    if (rslt == BMI3_OK)
+    {
+        if (sched->fifo_sens & BMI3_FIFO_ACC_EN)
+        {
+            config[n_sens++].type = BMI3_ACCEL;
+        }
+
+        if (sched->fifo_sens & BMI3_FIFO_GYR_EN)
+        {
+            config[n_sens++].type = BMI3_GYRO;
+        }
+
+        rslt = bmi3_get_sensor_config(config, n_sens, dev);
+    }
+
+    if (rslt == BMI3_OK)
+    {
+        /* ODR field has the same codes for accel and gyro */
+        for (idx = 0; idx < n_sens; idx++)
+        {
+            if ((config[idx].type == BMI3_ACCEL) && (config[idx].cfg.acc.odr != odr))
+            {
+                config[idx].cfg.acc.odr = odr;
+                changed = BMI3_ENABLE;
+            }
+            else if ((config[idx].type == BMI3_GYRO) && (config[idx].cfg.gyr.odr != odr))
+            {
+                config[idx].cfg.gyr.odr = odr;
+                changed = BMI3_ENABLE;
+            }
+        }
+
+        if (changed == BMI3_ENABLE)
+        {
+            rslt = bmi3_set_sensor_config(config, n_sens, dev);
+        }
+    }
+
+    if (rslt == BMI3_OK)
+    {
+        budget.latency_us = latency_us;
+        budget.service_us = sched->service_us;
+        budget.bus_hz = sched->bus_hz;
+        frame_words = get_fifo_frame_layout(sched->fifo_sens)->frame_len / 2;
+
+        /* Batching saves interrupts from two frames per water-mark level on */
+        if ((bmi3_compute_fifo_wm(&budget, sched->fifo_sens, odr, odr, &fifo_wm) == BMI3_OK) &&
+            (fifo_wm >= (frame_words * 2)))
+        {
+            mode = BMI3_SCHED_FIFO;
+        }
+        else
+        {
+            fifo_wm = 0;
+        }
+
+        /* Nothing is written if the mode and water-mark level are kept */
+        if ((sched->applied != BMI3_ENABLE) || (mode != sched->mode) || (fifo_wm != sched->fifo_wm))
+        {
+            sched->applied = BMI3_DISABLE;
+            rslt = set_sched_mode(mode, fifo_wm, sched, dev);
+        }
+    }
+
+    if (rslt == BMI3_OK)
+    {
+        odr_mhz = BMI3_ODR_6400HZ_MHZ >> (BMI3_ACC_ODR_6400HZ - odr);
+
+        sched->mode = mode;
+        sched->odr = odr;
+        sched->fifo_wm = fifo_wm;
+        sched->latency_us = latency_us;
+        sched->wakeup_mhz = (mode == BMI3_SCHED_FIFO) ? ((odr_mhz * frame_words) / fifo_wm) : odr_mhz;
+        sched->applied = BMI3_ENABLE;
+    }
+
+    unlock_dev(dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API serves the interrupt of the scheduler and pushes the samples
+ * read, from the data registers or the FIFO, to the sample queues.
+ */
+int8_t bmi3_sched_service(const struct bmi3_sched *sched,
+                          struct bmi3_sample_queue *accel_queue,
+                          struct bmi3_sample_queue *gyro_queue,
+                          uint16_t *dropped,
+                          struct bmi3_fifo_frame *fifo,
+                          struct bmi3_dev *dev)
+{
+    /* Variable to store result of API */
+    int8_t rslt;
+
+    /* Variable to store the interrupt status */
+    uint16_t int_status = 0;
+
+    /* Variable to store the samples dropped */
+    uint16_t n_dropped = 0;
+
+    lock_dev(dev);
+
+    rslt = null_ptr_check(dev);
+
+    if ((rslt == BMI3_OK) && ((sched == NULL) || (sched->applied != BMI3_ENABLE)))
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
+
+    if ((rslt == BMI3_OK) && (sched->mode == BMI3_SCHED_FIFO))
+    {
+        rslt = bmi3_fifo_service(&int_status, NULL, fifo, dev);
+
+        if ((rslt == BMI3_OK) && (fifo->available_fifo_len != 0))
+        {
+            rslt = bmi3_sample_queue_push_fifo(accel_queue, gyro_queue, &n_dropped, fifo, dev);
+        }
+    }
+    else if (rslt == BMI3_OK)
+    {
+        rslt = push_sched_drdy(sched, accel_queue, gyro_queue, &n_dropped, dev);
+    }
+
+    if (dropped != NULL)
+    {
+        *dropped = n_dropped;
+    }
+
+    unlock_dev(dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API starts a non-blocking service of the FIFO interrupts.
+ */
+int8_t bmi3_async_fifo_service(uint16_t *int1_status,
+                               uint16_t *int2_status,
+                               struct bmi3_fifo_frame *fifo,
+                               bmi3_async_done_fptr_t done,
+                               struct bmi3_dev *dev)
+{
+    /* Variable to store result of API */
+    int8_t rslt;
+
+    rslt = async_check(dev);
+
+    if ((rslt == BMI3_OK) && (int1_status != NULL) && (int2_status != NULL) && (fifo != NULL) &&
+        (fifo->data != NULL))
+    {
+        if (fifo->length > dev->dummy_byte)
+        {
+            dev->async.done = done;
+            dev->async.fifo = fifo;
+            dev->async.int1_status = int1_status;
+            dev->async.int2_status = int2_status;
+
+            /* Interrupt status and fill level registers are adjacent, read them at once */
+            rslt = async_submit(BMI3_REG_INT_STATUS_INT1,
+                                dev->async.buf,
+                                (uint32_t)BMI3_FIFO_SERVICE_LEN + dev->dummy_byte,
+                                BMI3_ASYNC_FIFO_SERVICE,
+                                dev);
+        }
+        else
+        {
+            rslt = BMI3_E_COM_FAIL;
+        }
+    }
+    else if (rslt == BMI3_OK)
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This API initializes a group of devices and assigns each device an
+ * equal part of the arena to store its FIFO data.
+ */
+int8_t bmi3_group_init(struct bmi3_dev_group *group,
+                       struct bmi3_dev * const *dev,
+                       uint8_t n_dev,
+                       uint8_t *arena,
+                       uint16_t arena_size)
+{
+    /* Variable to store result of API */
+    int8_t rslt = BMI3_OK;
+
+    /* Variable to define loop */
+    uint8_t loop;
+
+    if ((group == NULL) || (dev == NULL) || (arena == NULL))
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
+    else if ((n_dev == 0) || (n_dev > BMI3_GROUP_MAX_DEV))
+    {
+        rslt = BMI3_E_INVALID_INPUT;
+    }
+    else
+    {
+        /* FIFO data is read in words, keep each part of the arena word aligned */
+        group->slot_len = (uint16_t)((arena_size / n_dev) & ~1U);
+        group->n_dev = n_dev;
+        group->next_read = n_dev;
+        group->next_parse = n_dev;
+
+        for (loop = 0; (loop < n_dev) && (rslt == BMI3_OK); loop++)
+        {
+            rslt = null_ptr_check(dev[loop]);
+
+            if ((rslt == BMI3_OK) && (group->slot_len <= dev[loop]->dummy_byte))
+            {
+                rslt = BMI3_E_INVALID_INPUT;
+            }
+
+            if (rslt == BMI3_OK)
+            {
+                group->dev[loop] = dev[loop];
+                group->fifo[loop].data = &arena[loop * group->slot_len];
+                group->fifo[loop].length = group->slot_len;
+                group->fifo[loop].available_fifo_len = 0;
+                group->int1_status[loop] = 0;
+                group->int2_status[loop] = 0;
+                group->rslt[loop] = BMI3_OK;
+            }
+        }
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This API starts the FIFO service of the devices of a group.
+ */
+int8_t bmi3_group_start(struct bmi3_dev_group *group)
+{
+    /* Variable to store result of API */
+    int8_t rslt = BMI3_OK;
+
+    if (group == NULL)
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
+    else if (group->n_dev == 0)
+    {
+        rslt = BMI3_E_INVALID_INPUT;
+    }
+    else if (group->next_parse < group->n_dev)
+    {
+        /* Previous service of the group is not complete */
+        rslt = BMI3_E_BUSY;
+    }
+    else
+    {
+        group->next_read = 0;
+        group->next_parse = 0;
+
+        group_read_next(group);
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This API gives the next device of a group of which the FIFO data is
+ * read, after starting the FIFO read of the device following it.
+ */
+int8_t bmi3_group_next(struct bmi3_dev_group *group, uint8_t *index)
+{
+    /* Variable to store result of API */
+    int8_t rslt = BMI3_OK;
+
+    /* Variable to store index of the device */
+    uint8_t idx;
+
+    if ((group == NULL) || (index == NULL))
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
+    else if (group->next_parse >= group->n_dev)
+    {
+        *index = BMI3_GROUP_DONE;
+    }
+    else
+    {
+        idx = group->next_parse;
+
+        if (group->dev[idx]->async.state != BMI3_ASYNC_IDLE)
+        {
+            /* FIFO read of the device is still in progress */
+            rslt = BMI3_E_BUSY;
+        }
+        else
+        {
+            if (group->rslt[idx] == BMI3_E_BUSY)
+            {
+                /* Asynchronous read is complete, get its result */
+                group->rslt[idx] = group->dev[idx]->async.rslt;
+            }
+
+            /* Transfer of the following device runs while this device is parsed */
+            group_read_next(group);
+
+            group->next_parse++;
+            *index = idx;
+            rslt = group->rslt[idx];
+        }
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This API initializes a ping-pong FIFO acquisition and assigns each
+ * buffer an equal part of the arena.
+ */
+int8_t bmi3_pingpong_init(struct bmi3_fifo_pingpong *pingpong,
+                          uint8_t *arena,
+                          uint16_t arena_size,
+                          uint8_t n_buf,
+                          struct bmi3_dev *dev)
+{
+    /* Variable to store result of API */
+    int8_t rslt;
+
+    /* Variable to define loop */
+    uint8_t loop;
+
+    rslt = null_ptr_check(dev);
+
+    if ((rslt == BMI3_OK) && ((pingpong == NULL) || (arena == NULL)))
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
+
+    if ((rslt == BMI3_OK) && ((n_buf < 2) || (n_buf > BMI3_PINGPONG_MAX_BUF)))
+    {
+        rslt = BMI3_E_INVALID_INPUT;
+    }
+
+    if (rslt == BMI3_OK)
+    {
+        /* FIFO data is read in words, keep each part of the arena word aligned */
+        pingpong->slot_len = (uint16_t)((arena_size / n_buf) & ~1U);
+
+        if (pingpong->slot_len <= dev->dummy_byte)
+        {
+            rslt = BMI3_E_INVALID_INPUT;
+        }
+    }
+
+    if (rslt == BMI3_OK)
+    {
+        pingpong->dev = dev;
+        pingpong->n_buf = n_buf;
+        pingpong->head = 0;
+        pingpong->parse = 0;
+        pingpong->tail = 0;
+        pingpong->overruns = 0;
+
+        for (loop = 0; loop < n_buf; loop++)
+        {
+            pingpong->fifo[loop].data = &arena[loop * pingpong->slot_len];
+            pingpong->fifo[loop].length = pingpong->slot_len;
+            pingpong->fifo[loop].available_fifo_len = 0;
+            pingpong->int1_status[loop] = 0;
+            pingpong->int2_status[loop] = 0;
+            pingpong->rslt[loop] = BMI3_OK;
+        }
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This API starts the FIFO read of a ping-pong FIFO acquisition into
+ * the next free buffer.
+ */
+int8_t bmi3_pingpong_start(struct bmi3_fifo_pingpong *pingpong)
+{
+    /* Variable to store result of API */
+    int8_t rslt = BMI3_OK;
+
+    /* Variable to store count of FIFO reads started */
+    uint8_t head;
+
+    /* Variable to store index of the buffer */
+    uint8_t idx;
+
+    /* Pointer to the device */
+    struct bmi3_dev *dev;
+
+    if ((pingpong == NULL) || (pingpong->dev == NULL))
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
+    else
+    {
+        dev = pingpong->dev;
+        head = pingpong->head;
+
+        if (dev->async.state != BMI3_ASYNC_IDLE)
+        {
+            /* Previous FIFO read is still in progress */
+            rslt = BMI3_E_BUSY;
+        }
+        else if ((uint8_t)(head - BMI3_LOAD_ACQUIRE(&pingpong->tail)) >= pingpong->n_buf)
+        {
+            /* All buffers are owned by the user, FIFO data stays in the FIFO until the next read */
+            pingpong->overruns++;
+            rslt = BMI3_W_QUEUE_FULL;
+        }
+        else
+        {
+            if (head != pingpong->tail)
+            {
+                idx = pingpong_index(pingpong, (uint8_t)(head - 1));
+
+                if (pingpong->rslt[idx] == BMI3_E_BUSY)
+                {
+                    /* Previous read is complete, keep its result before the next read overwrites it */
+                    pingpong->rslt[idx] = dev->async.rslt;
+                }
+            }
+
+            idx = pingpong_index(pingpong, head);
+            pingpong->fifo[idx].length = pingpong->slot_len;
+
+            if (dev->read_async != NULL)
+            {
+                pingpong->rslt[idx] = BMI3_E_BUSY;
+                rslt = bmi3_async_fifo_service(&pingpong->int1_status[idx],
+                                               &pingpong->int2_status[idx],
+                                               &pingpong->fifo[idx],
+                                               NULL,
+                                               dev);
+            }
+            else
+            {
+                rslt = bmi3_fifo_service(&pingpong->int1_status[idx],
+                                         &pingpong->int2_status[idx],
+                                         &pingpong->fifo[idx],
+                                         dev);
+                pingpong->rslt[idx] = rslt;
+
+                /* Warnings are given with the buffer */
+                if (rslt > BMI3_OK)
+                {
+                    rslt = BMI3_OK;
+                }
+            }
+
+            if (rslt == BMI3_OK)
+            {
+                /* Hand the buffer over to the user side */
+                BMI3_STORE_RELEASE(&pingpong->head, (uint8_t)(head + 1));
+            }
+        }
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This API hands the oldest filled buffer of a ping-pong FIFO
+ * acquisition over to the user.
+ */
+int8_t bmi3_pingpong_acquire(struct bmi3_fifo_pingpong *pingpong, uint8_t *index)
+{
+    /* Variable to store result of API */
+    int8_t rslt = BMI3_OK;
+
+    /* Variable to store index of the buffer */
+    uint8_t idx;
+
+    if ((pingpong == NULL) || (pingpong->dev == NULL) || (index == NULL))
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
+    else
+    {
+        *index = BMI3_PINGPONG_NONE;
+
+        if (pingpong->parse != BMI3_LOAD_ACQUIRE(&pingpong->head))
+        {
+            idx = pingpong_index(pingpong, pingpong->parse);
+            rslt = pingpong->rslt[idx];
+
+            if ((rslt == BMI3_E_BUSY) && (pingpong->dev->async.state == BMI3_ASYNC_IDLE))
+            {
+                rslt = pingpong->dev->async.rslt;
+            }
+            else if (rslt == BMI3_E_BUSY)
+            {
+                /* Either in progress, or the next read started and kept the result of this one */
+                rslt = pingpong->rslt[idx];
+            }
+
+            if (rslt != BMI3_E_BUSY)
+            {
+                pingpong->parse++;
+                *index = idx;
+            }
+        }
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This API gives a buffer of a ping-pong FIFO acquisition back, to be
+ * filled by a following FIFO read.
+ */
+int8_t bmi3_pingpong_release(struct bmi3_fifo_pingpong *pingpong, uint8_t index)
+{
+    /* Variable to store result of API */
+    int8_t rslt = BMI3_OK;
+
+    /* Variable to store count of buffers given back */
+    uint8_t tail;
+
+    if (pingpong == NULL)
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
+    else
+    {
+        tail = pingpong->tail;
+
+        /* Buffers are given back in the order they are handed over */
+        if ((tail == pingpong->parse) || (index != pingpong_index(pingpong, tail)))
+        {
+            rslt = BMI3_E_INVALID_INPUT;
+        }
+        else
+        {
+            BMI3_STORE_RELEASE(&pingpong->tail, (uint8_t)(tail + 1));
+        }
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This API initializes a group of devices of which the i3c sync data is aligned.
+ */
+int8_t bmi3_i3c_sync_group_init(struct bmi3_i3c_sync_group *group,
+                                struct bmi3_dev * const *dev,
+                                uint8_t n_dev)
+{
+    /* Variable to store result of API */
+    int8_t rslt = BMI3_OK;
+
+    /* Variable to define loop */
+    uint8_t loop;
+
+    if ((group == NULL) || (dev == NULL))
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
+    else if ((n_dev == 0) || (n_dev > BMI3_GROUP_MAX_DEV))
+    {
+        rslt = BMI3_E_INVALID_INPUT;
+    }
+    else
+    {
+        group->n_dev = 0;
+
+        for (loop = 0; (loop < n_dev) && (rslt == BMI3_OK); loop++)
+        {
+            rslt = null_ptr_check(dev[loop]);
+
+            if (rslt == BMI3_OK)
+            {
+                group->dev[loop] = dev[loop];
+            }
+        }
+
+        if (rslt == BMI3_OK)
+        {
+            group->n_dev = n_dev;
+        }
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This API sets the i3c sync data sample rate, delay time and ODR of
+ * all devices of a group.
+ */
+int8_t bmi3_i3c_sync_group_config(const struct bmi3_i3c_sync_cfg *cfg, const struct bmi3_i3c_sync_group *group)
+{
+    /* Variable to store result of API */
+    int8_t rslt = BMI3_OK;
+
+    /* Array to store the TPH, TU and ODR registers */
+    uint8_t reg_data[6] = { 0 };
+
+    /* Variable to define loop */
+    uint8_t loop;
+
+    if ((cfg == NULL) || (group == NULL))
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
+    else if (group->n_dev == 0)
+    {
+        rslt = BMI3_E_INVALID_INPUT;
+    }
+    else
+    {
+        for (loop = 0; (loop < group->n_dev) && (rslt == BMI3_OK); loop++)
+        {
+            lock_dev(group->dev[loop]);
+
+            /* TPH, TU and ODR registers are adjacent, update them at once */
+            rslt = bmi3_get_regs(BMI3_REG_I3C_TC_SYNC_TPH, reg_data, 6, group->dev[loop]);
+
+            if (rslt == BMI3_OK)
+            {
+                reg_data[0] = (uint8_t)(cfg->tph & BMI3_SET_LOW_BYTE);
+                reg_data[1] = (uint8_t)((cfg->tph & BMI3_SET_HIGH_BYTE) >> 8);
+                reg_data[2] = BMI3_SET_BIT_POS0(reg_data[2], BMI3_I3C_TC_SYNC_TU, cfg->tu);
+                reg_data[4] = BMI3_SET_BIT_POS0(reg_data[4], BMI3_I3C_TC_SYNC_ODR, cfg->odr);
+
+                rslt = bmi3_set_regs(BMI3_REG_I3C_TC_SYNC_TPH, reg_data, 6, group->dev[loop]);
+            }
+
+            unlock_dev(group->dev[loop]);
+        }
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This API reads the i3c sync data of all devices of a group and aligns
+ * them to the same sync time.
+ */
+int8_t bmi3_i3c_sync_group_read(struct bmi3_i3c_sync_frame *frame, const struct bmi3_i3c_sync_group *group)
+{
+    /* Variable to store result of API */
+    int8_t rslt = BMI3_OK;
+
+    /* Variable to define loop */
+    uint8_t loop;
+
+    /* Variable to count the reads of the devices behind the newest sync time */
+    uint8_t retry;
+
+    if ((frame == NULL) || (group == NULL))
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
+    else if (group->n_dev == 0)
+    {
+        rslt = BMI3_E_INVALID_INPUT;
+    }
+    else
+    {
+        frame->n_dev = group->n_dev;
+
+        for (loop = 0; (loop < group->n_dev) && (rslt == BMI3_OK); loop++)
+        {
+            rslt = get_i3c_sync_sample(&frame->sample[loop], group->dev[loop]);
+        }
+
+        if (rslt == BMI3_OK)
+        {
+            align_i3c_sync_frame(frame);
+        }
+
+        /* A sync event between the reads of the devices leaves the devices read before it one sample behind */
+        for (retry = 0; (retry < BMI3_I3C_SYNC_READ_RETRY) && (rslt == BMI3_OK) && (frame->aligned == BMI3_DISABLE);
+             retry++)
+        {
+            for (loop = 0; (loop < group->n_dev) && (rslt == BMI3_OK); loop++)
+            {
+                if (frame->sample[loop].acc.sync_time != frame->sync_time)
+                {
+                    rslt = get_i3c_sync_sample(&frame->sample[loop], group->dev[loop]);
+                }
+            }
+
+            if (rslt == BMI3_OK)
+            {
+                align_i3c_sync_frame(frame);
+            }
+        }
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This API updates the unit conversion scale factors from the set
+ * accelerometer and gyroscope ranges.
+ */
+int8_t bmi3_update_unit_scale(struct bmi3_dev *dev)
+{
+    /* Variable to store result of API */
+    int8_t rslt;
+
+    /* Structures to store accel and gyro configurations */
+    struct bmi3_accel_config acc_config = { 0 };
+    struct bmi3_gyro_config gyr_config = { 0 };
+
+    rslt = null_ptr_check(dev);
+
+    if (rslt == BMI3_OK)
+    {
+        rslt = get_accel_config(&acc_config, dev);
+    }
+
+    if (rslt == BMI3_OK)
+    {
+        rslt = get_gyro_config(&gyr_config, dev);
+    }
+
+    if (rslt == BMI3_OK)
+    {
+        set_unit_scale(BMI3_ACCEL, acc_config.range, dev);
+        set_unit_scale(BMI3_GYRO, gyr_config.range, dev);
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This API converts an array of accelerometer, gyroscope or temperature
+ * data to fixed-point g, degree per second or degree celsius.
+ */
+int8_t bmi3_lsb_to_q(const int16_t *lsb, int32_t *out, uint16_t count, uint8_t sens_type, const struct bmi3_dev *dev)
+{
+    /* Variable to store result of API */
+    int8_t rslt = BMI3_OK;
+
+    /* Variable to define loop */
+    uint16_t loop;
+
+    /* Variables to store scale and offset of the conversion */
+    int32_t scale = 0;
+    int32_t offset = 0;
+
+    if ((lsb == NULL) || (out == NULL) || (dev == NULL))
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
+    else
+    {
+        switch (sens_type)
+        {
+            case BMI3_ACCEL:
+                scale = dev->unit_scale.acc_q;
+                break;
+
+            case BMI3_GYRO:
+                scale = dev->unit_scale.gyr_q;
+                break;
+
+            case BMI3_TEMP:
+                scale = (INT32_C(1) << BMI3_UNIT_Q_FRAC_BITS) / BMI3_TEMP_LSB_PER_DEGC;
+                offset = BMI3_TEMP_OFFSET_DEGC << BMI3_UNIT_Q_FRAC_BITS;
+                break;
+
+            default:
+                rslt = BMI3_E_INVALID_SENSOR;
+                break;
+        }
+
+        if ((rslt == BMI3_OK) && (scale == 0))
+        {
+            /* Range or resolution is not known */
+            rslt = BMI3_E_INVALID_INPUT;
+        }
+    }
+
+    if (rslt == BMI3_OK)
+    {
+        /* Full scale of 16-bit data fits in 32-bit for all the ranges */
+        for (loop = 0; loop < count; loop++)
+        {
+            out[loop] = ((int32_t)lsb[loop] * scale) + offset;
+        }
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This API converts an array of accelerometer, gyroscope or temperature
+ * data to g, degree per second or degree celsius in float.
+ */
+int8_t bmi3_lsb_to_float(const int16_t *lsb, float *out, uint16_t count, uint8_t sens_type, const struct bmi3_dev *dev)
+{
+    /* Variable to store result of API */
+    int8_t rslt = BMI3_OK;
+
+    /* Variable to define loop */
+    uint16_t loop;
+
+    /* Variables to store scale and offset of the conversion */
+    float scale = 0.0f;
+    float offset = 0.0f;
+
+    if ((lsb == NULL) || (out == NULL) || (dev == NULL))
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
+    else
+    {
+        switch (sens_type)
+        {
+            case BMI3_ACCEL:
+                scale = dev->unit_scale.acc_f;
+                break;
+
+            case BMI3_GYRO:
+                scale = dev->unit_scale.gyr_f;
+                break;
+
+            case BMI3_TEMP:
+                scale = 1.0f / (float)BMI3_TEMP_LSB_PER_DEGC;
+                offset = (float)BMI3_TEMP_OFFSET_DEGC;
+                break;
+
+            default:
+                rslt = BMI3_E_INVALID_SENSOR;
+                break;
+        }
+
+        if ((rslt == BMI3_OK) && (scale == 0.0f))
+        {
+            /* Range or resolution is not known */
+            rslt = BMI3_E_INVALID_INPUT;
+        }
+    }
+
+    if (rslt == BMI3_OK)
+    {
+        /* Multiply-add without dependency between iterations, to be vectorized by the compiler */
+        for (loop = 0; loop < count; loop++)
+        {
+            out[loop] = ((float)lsb[loop] * scale) + offset;
+        }
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This API sets the correction of the accelerometer or gyro data from
+ * the axis re-mapping, offset and gain.
+ */
+int8_t bmi3_set_axes_correction(struct bmi3_axes_correction *corr,
+                                const struct bmi3_axes_remap *remap,
+                                const int16_t *offset,
+                                const uint16_t *gain)
+{
+    /* Variable to store result of API */
+    int8_t rslt = BMI3_OK;
+
+    /* Variables to define loop */
+    uint8_t row, col;
+
+    /* Source axis of the re-mapped x, y and z axis for each BMI3_MAP_*_AXIS */
+    static const uint8_t remap_src[6][3] = {
+        { BMI3_X_AXIS, BMI3_Y_AXIS, BMI3_Z_AXIS }, { BMI3_Y_AXIS, BMI3_X_AXIS, BMI3_Z_AXIS },
+        { BMI3_X_AXIS, BMI3_Z_AXIS, BMI3_Y_AXIS }, { BMI3_Z_AXIS, BMI3_X_AXIS, BMI3_Y_AXIS },
+        { BMI3_Y_AXIS, BMI3_Z_AXIS, BMI3_X_AXIS }, { BMI3_Z_AXIS, BMI3_Y_AXIS, BMI3_X_AXIS }
+    };
+
+    /* Variable to store the sign of the re-mapped axes */
+    uint8_t invert[3];
+
+    if ((corr == NULL) || (remap == NULL))
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
+    else if (remap->axis_map > BMI3_MAP_ZYX_AXIS)
+    {
+        rslt = BMI3_E_INVALID_INPUT;
+    }
+    else
+    {
+        invert[BMI3_X_AXIS] = remap->invert_x;
+        invert[BMI3_Y_AXIS] = remap->invert_y;
+        invert[BMI3_Z_AXIS] = remap->invert_z;
+
+        for (row = 0; row < 3; row++)
+        {
+            for (col = 0; col < 3; col++)
+            {
+                corr->matrix[row][col] = 0;
+            }
+
+            corr->matrix[row][remap_src[remap->axis_map][row]] = (invert[row] == BMI3_MAP_NEGATIVE) ? -1 : 1;
+            corr->offset[row] = (offset != NULL) ? offset[row] : 0;
+            corr->gain[row] = (gain != NULL) ? gain[row] : BMI3_AXES_CORR_GAIN_UNITY;
+        }
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This API sets up the thermal compensation of the offset and gain of
+ * an axes correction from a calibration table.
+ */
+int8_t bmi3_thermal_comp_init(const struct bmi3_thermal_point *points,
+                              uint8_t n_points,
+                              uint16_t min_delta,
+                              struct bmi3_axes_correction *corr,
+                              struct bmi3_thermal_comp *comp)
+{
+    /* Variable to store result of API */
+    int8_t rslt = BMI3_OK;
+
+    /* Variable to define loop */
+    uint8_t loop;
+
+    if ((points == NULL) || (corr == NULL) || (comp == NULL))
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
+    else if ((n_points == 0) || (n_points > BMI3_THERMAL_MAX_POINTS))
+    {
+        rslt = BMI3_E_INVALID_INPUT;
+    }
+    else
+    {
+        for (loop = 1; (loop < n_points) && (rslt == BMI3_OK); loop++)
+        {
+            if (points[loop].temp <= points[loop - 1].temp)
+            {
+                rslt = BMI3_E_INVALID_INPUT;
+            }
+        }
+    }
+
+    if (rslt == BMI3_OK)
+    {
+        comp->points = points;
+        comp->n_points = n_points;
+        comp->min_delta = min_delta;
+        comp->corr = corr;
+        comp->temp = 0;
+        comp->valid = BMI3_DISABLE;
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This API updates offset and gain of the axes correction from the
+ * mean of temperature samples.
+ */
+int8_t bmi3_thermal_comp_update(const struct bmi3_fifo_temperature_data *temp_data,
+                                uint16_t n_temp,
+                                struct bmi3_thermal_comp *comp)
+{
+    /* Variable to store result of API */
+    int8_t rslt = BMI3_OK;
+
+    /* Variable to define loop */
+    uint16_t loop;
+
+    /* Sum and number of the valid samples */
+    int32_t sum = 0;
+    uint16_t count = 0;
+
+    int16_t temp;
+    int32_t delta;
+
+    if ((temp_data == NULL) || (comp == NULL) || (comp->corr == NULL))
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
+    else
+    {
+        for (loop = 0; loop < n_temp; loop++)
+        {
+            /* Dummy frames of the FIFO hold no temperature */
+            if (temp_data[loop].temp_data != BMI3_FIFO_TEMP_DUMMY_FRAME)
+            {
+                sum += (int16_t)temp_data[loop].temp_data;
+                count++;
+            }
+        }
+
+        if (count == 0)
+        {
+            rslt = BMI3_W_FIFO_EMPTY;
+        }
+        else
+        {
+            temp = (int16_t)(sum / count);
+            delta = (int32_t)temp - comp->temp;
+            delta = (delta < 0) ? -delta : delta;
+
+            /* Offset and gain follow the temperature at a low rate, the frames are corrected by the FIFO parser */
+            if ((comp->valid != BMI3_ENABLE) || (delta >= comp->min_delta))
+            {
+                interpolate_thermal_comp(temp, comp);
+            }
+        }
+    }
+
+    return rslt;
+}
+
+#ifdef BMI3_RUNNING_STATS
+
+/*!
+ * @brief This API resets running statistics accumulators.
+ */
+int8_t bmi3_stats_reset(struct bmi3_axes_stats *stats)
+{
+    /* Variable to store result of API */
+    int8_t rslt = BMI3_OK;
+
+    if (stats != NULL)
+    {
+        reset_axes_stats(stats);
+    }
+    else
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This API accumulates the x, y and z samples of separate arrays, as
+ * extracted by "bmi3_extract_accel_planes" or "bmi3_extract_gyro_planes".
+ */
+int8_t bmi3_stats_update(const struct bmi3_fifo_sens_axes_planes *planes,
+                         uint16_t count,
+                         struct bmi3_axes_stats *stats)
+{
+    /* Variable to store result of API */
+    int8_t rslt = BMI3_OK;
+
+    if ((planes != NULL) && (planes->x != NULL) && (planes->y != NULL) && (planes->z != NULL) && (stats != NULL))
+    {
+        /* Each axis is a contiguous array, accumulated in a separate loop */
+        update_axis_stats(planes->x, count, &stats->x);
+        update_axis_stats(planes->y, count, &stats->y);
+        update_axis_stats(planes->z, count, &stats->z);
+
+        stats->count += count;
+    }
+    else
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This API accumulates the accelerometer or gyro samples directly from
+ * the FIFO data, without storing the frames.
+ */
+int8_t bmi3_fifo_stats(uint16_t sens_sel,
+                       struct bmi3_axes_stats *stats,
+                       const struct bmi3_fifo_frame *fifo,
+                       const struct bmi3_dev *dev)
+{
+    /* Variable to store result of API */
+    int8_t rslt;
+
+    /* Pointer to the layout of the frame */
+    const struct bmi3_fifo_frame_layout *layout;
+
+    /* Pointer to the sensor data of a frame */
+    const uint8_t *data;
+
+    /* Variable to store the end of valid FIFO data */
+    uint16_t data_end;
+
+    /* Variable to index the bytes */
+    uint16_t data_index;
+
+    /* Variable to store byte offset of the sensor in the frame */
+    uint8_t sens_offset = BMI3_FIFO_NO_DATA;
+
+    /* Variable to store dummy frame value of the sensor */
+    uint16_t dummy_frame = BMI3_FIFO_ACCEL_DUMMY_FRAME;
+
+    /* Variable to store the x-axis data */
+    uint16_t data_x;
+
+    rslt = null_ptr_check(dev);
+
+    if ((rslt == BMI3_OK) && (stats != NULL) && (fifo != NULL) && (fifo->data != NULL))
+    {
+        layout = select_fifo_frame_layout(fifo);
+        data_end = get_fifo_data_end(fifo, dev);
+
+        if (sens_sel == BMI3_FIFO_HEAD_LESS_ACC_FRM)
+        {
+            sens_offset = layout->acc_offset;
+        }
+        else if (sens_sel == BMI3_FIFO_HEAD_LESS_GYR_FRM)
+        {
+            sens_offset = layout->gyr_offset;
+            dummy_frame = BMI3_FIFO_GYRO_DUMMY_FRAME;
+        }
+        else
+        {
+            rslt = BMI3_E_INVALID_SENSOR;
+        }
+
+        if ((rslt == BMI3_OK) && (sens_offset == BMI3_FIFO_NO_DATA))
+        {
+            rslt = BMI3_E_INVALID_SENSOR;
+        }
+
+        /* Frames whose sensor data is read completely are accumulated, dummy frames are skipped */
+        for (data_index = dev->dummy_byte;
+             (rslt == BMI3_OK) && ((data_index + sens_offset + BMI3_LENGTH_FIFO_ACC) <= data_end);
+             data_index += layout->frame_len)
+        {
+            data = &fifo->data[data_index + sens_offset];
+            data_x = (uint16_t)(((uint16_t)data[1] << 8) | data[0]);
+
+            if (data_x != dummy_frame)
+            {
+                add_axis_sample((int16_t)data_x, &stats->x);
+                add_axis_sample((int16_t)(((uint16_t)data[3] << 8) | data[2]), &stats->y);
+                add_axis_sample((int16_t)(((uint16_t)data[5] << 8) | data[4]), &stats->z);
+
+                stats->count++;
+            }
+        }
+    }
+    else if (rslt == BMI3_OK)
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This API merges running statistics accumulators.
+ */
+int8_t bmi3_stats_merge(const struct bmi3_axes_stats *src, struct bmi3_axes_stats *dst)
+{
+    /* Variable to store result of API */
+    int8_t rslt = BMI3_OK;
+
+    if ((src != NULL) && (dst != NULL))
+    {
+        merge_axis_stats(&src->x, &dst->x);
+        merge_axis_stats(&src->y, &dst->y);
+        merge_axis_stats(&src->z, &dst->z);
+
+        dst->count += src->count;
+    }
+    else
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This API stores the accumulator of a burst in a rolling window,
+ * replacing the oldest burst once the window is full.
+ */
+int8_t bmi3_stats_window_push(const struct bmi3_axes_stats *burst, struct bmi3_stats_window *window)
+{
+    /* Variable to store result of API */
+    int8_t rslt = BMI3_OK;
+
+    if ((burst != NULL) && (window != NULL) && (window->bursts != NULL))
+    {
+        if ((window->size != 0) && (window->next < window->size))
+        {
+            window->bursts[window->next] = *burst;
+
+            window->next++;
+
+            if (window->next == window->size)
+            {
+                window->next = 0;
+            }
+
+            if (window->count < window->size)
+            {
+                window->count++;
+            }
+        }
+        else
+        {
+            rslt = BMI3_E_INVALID_INPUT;
+        }
+    }
+    else
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This API merges the accumulators of all bursts of a rolling window.
+ */
+int8_t bmi3_stats_window_get(const struct bmi3_stats_window *window, struct bmi3_axes_stats *stats)
+{
+    /* Variable to store result of API */
+    int8_t rslt = BMI3_OK;
+
+    /* Variable to loop through the bursts */
+    uint8_t loop;
+
+    if ((window != NULL) && (stats != NULL) && ((window->bursts != NULL) || (window->count == 0)))
+    {
+        reset_axes_stats(stats);
+
+        /* Minimum and maximum cannot be removed from a sum, so the window is merged again */
+        for (loop = 0; loop < window->count; loop++)
+        {
+            merge_axis_stats(&window->bursts[loop].x, &stats->x);
+            merge_axis_stats(&window->bursts[loop].y, &stats->y);
+            merge_axis_stats(&window->bursts[loop].z, &stats->z);
+
+            stats->count += window->bursts[loop].count;
+        }
+    }
+    else
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This API computes mean, variance, minimum, maximum and peak-to-peak
+ * value of x, y and z axis from running statistics accumulators.
+ */
+int8_t bmi3_stats_get_result(const struct bmi3_axes_stats *stats, struct bmi3_axes_stats_result *result)
+{
+    /* Variable to store result of API */
+    int8_t rslt = BMI3_OK;
+
+    /* Statistics of no samples */
+    const struct bmi3_axis_stats_result no_result = { 0, 0, 0, 0, 0 };
+
+    if ((stats != NULL) && (result != NULL))
+    {
+        result->count = stats->count;
+        result->x = no_result;
+        result->y = no_result;
+        result->z = no_result;
+
+        if (stats->count != 0)
+        {
+            get_axis_stats_result(&stats->x, stats->count, &result->x);
+            get_axis_stats_result(&stats->y, stats->count, &result->y);
+            get_axis_stats_result(&stats->z, stats->count, &result->z);
+        }
+    }
+    else
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
+
+    return rslt;
+}
+#endif
+
+/*!
+ * @brief This API initializes the delta encoder or decoder of FIFO samples.
+ */
+int8_t bmi3_delta_init(uint8_t odr, uint16_t sensor_time, struct bmi3_delta_codec *codec)
+{
+    /* Variable to store result of API */
+    int8_t rslt = BMI3_OK;
+
+    if (codec != NULL)
+    {
+        if ((odr >= BMI3_ACC_ODR_0_78HZ) && (odr <= BMI3_ACC_ODR_6400HZ))
+        {
+            /* First sample is encoded against zero */
+            codec->x = 0;
+            codec->y = 0;
+            codec->z = 0;
+            codec->sensor_time = sensor_time;
+
+            /* Sample period doubles with each ODR step below 6400Hz */
+            codec->period = (uint16_t)(BMI3_FIFO_TIME_6400HZ_TICKS << (BMI3_ACC_ODR_6400HZ - odr));
+        }
+        else
+        {
+            rslt = BMI3_E_INVALID_INPUT;
+        }
+    }
+    else
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This API encodes FIFO samples into blocks of zigzag-encoded deltas
+ * bit-packed with the bit width of each axis.
+ */
+int8_t bmi3_delta_encode(const struct bmi3_fifo_sens_axes_data *data,
+                         uint16_t *count,
+                         uint8_t *buf,
+                         uint16_t *len,
+                         struct bmi3_delta_codec *codec)
+{
+    /* Variable to store result of API */
+    int8_t rslt = BMI3_OK;
+
+    /* Variables to store number of samples encoded and in the block */
+    uint16_t done = 0;
+    uint8_t n_block;
+
+    /* Variable to store number of bytes written */
+    uint16_t used = 0;
+
+    /* Variable to store length of the block */
+    uint16_t block_len;
+
+    /* Variables to store bit widths of the axes */
+    uint8_t width[3];
+
+    /* Variable to store bit width of a delta */
+    uint8_t ax_width;
+
+    /* Variable to store the previous sample while getting the bit widths */
+    struct bmi3_delta_codec prev;
+
+    /* Variable to store bit position in the block */
+    uint32_t bit_pos;
+
+    /* Variables to define loop */
+    uint16_t loop;
+    uint8_t index;
+
+    if ((data != NULL) && (count != NULL) && (buf != NULL) && (len != NULL) && (codec != NULL))
+    {
+        while (done < *count)
+        {
+            n_block = (uint8_t)(((*count - done) < BMI3_DELTA_BLOCK_SAMPLES) ? (*count - done) :
+                                BMI3_DELTA_BLOCK_SAMPLES);
+
+            /* First pass gets the bit width of each axis, the largest of the block */
+            prev = *codec;
+            width[0] = 0;
+            width[1] = 0;
+            width[2] = 0;
+
+            for (index = 0; index < n_block; index++)
+            {
+                ax_width = get_bit_width(get_zigzag_delta(data[done + index].x, prev.x));
+                width[0] = (ax_width > width[0]) ? ax_width : width[0];
+                ax_width = get_bit_width(get_zigzag_delta(data[done + index].y, prev.y));
+                width[1] = (ax_width > width[1]) ? ax_width : width[1];
+                ax_width = get_bit_width(get_zigzag_delta(data[done + index].z, prev.z));
+                width[2] = (ax_width > width[2]) ? ax_width : width[2];
+
+                prev.x = data[done + index].x;
+                prev.y = data[done + index].y;
+                prev.z = data[done + index].z;
+            }
+
+            block_len = (uint16_t)(BMI3_DELTA_HEADER_LEN + (((n_block * (width[0] + width[1] + width[2])) + 7) / 8));
+
+            /* Only complete blocks are written */
+            if ((used + block_len) > *len)
+            {
+                break;
+            }
+
+            for (loop = used; loop < (used + block_len); loop++)
+            {
+                buf[loop] = 0;
+            }
+
+            buf[used] = n_block;
+            buf[used + 1] = (uint8_t)(width[0] | (width[1] << 5));
+            buf[used + 2] = (uint8_t)((width[1] >> 3) | (width[2] << 2));
+
+            /* Second pass packs the deltas */
+            bit_pos = 0;
+
+            for (index = 0; index < n_block; index++)
+            {
+                put_bits(&buf[used + BMI3_DELTA_HEADER_LEN], &bit_pos, get_zigzag_delta(data[done].x, codec->x),
+                         width[0]);
+                put_bits(&buf[used + BMI3_DELTA_HEADER_LEN], &bit_pos, get_zigzag_delta(data[done].y, codec->y),
+                         width[1]);
+                put_bits(&buf[used + BMI3_DELTA_HEADER_LEN], &bit_pos, get_zigzag_delta(data[done].z, codec->z),
+                         width[2]);
+
+                codec->x = data[done].x;
+                codec->y = data[done].y;
+                codec->z = data[done].z;
+                codec->sensor_time = (uint16_t)(codec->sensor_time + codec->period);
+                done++;
+            }
+
+            used = (uint16_t)(used + block_len);
+        }
+
+        *count = done;
+        *len = used;
+    }
+    else
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This API decodes blocks of the delta-encoded sample format back into
+ * FIFO samples, with the sensor time implied by the ODR.
+ */
+int8_t bmi3_delta_decode(const uint8_t *buf,
+                         uint16_t *len,
+                         struct bmi3_fifo_sens_axes_data *data,
+                         uint16_t *count,
+                         struct bmi3_delta_codec *codec)
+{
+    /* Variable to store result of API */
+    int8_t rslt = BMI3_OK;
+
+    /* Variables to store number of samples decoded and in the block */
+    uint16_t done = 0;
+    uint8_t n_block;
+
+    /* Variable to store number of bytes read */
+    uint16_t used = 0;
+
+    /* Variable to store length of the block */
+    uint16_t block_len;
+
+    /* Variables to store bit widths of the axes */
+    uint8_t width[3];
+
+    /* Variable to store bit position in the block */
+    uint32_t bit_pos;
+
+    /* Variable to store zigzag-encoded delta */
+    uint32_t delta;
+
+    /* Pointers to the axes of the last sample */
+    int16_t *axis[3];
+
+    /* Variables to define loop */
+    uint8_t index;
+    uint8_t ax;
+
+    if ((buf != NULL) && (len != NULL) && (data != NULL) && (count != NULL) && (codec != NULL))
+    {
+        axis[0] = &codec->x;
+        axis[1] = &codec->y;
+        axis[2] = &codec->z;
+
+        while ((rslt == BMI3_OK) && ((used + BMI3_DELTA_HEADER_LEN) <= *len))
+        {
+            n_block = buf[used];
+            width[0] = buf[used + 1] & 0x1F;
+            width[1] = (uint8_t)(((buf[used + 1] >> 5) | (buf[used + 2] << 3)) & 0x1F);
+            width[2] = (buf[used + 2] >> 2) & 0x1F;
+
+            if ((n_block == 0) || (n_block > BMI3_DELTA_BLOCK_SAMPLES) || (width[0] > BMI3_DELTA_MAX_WIDTH) ||
+                (width[1] > BMI3_DELTA_MAX_WIDTH) || (width[2] > BMI3_DELTA_MAX_WIDTH))
+            {
+                rslt = BMI3_E_INVALID_INPUT;
+            }
+            else
+            {
+                block_len =
+                    (uint16_t)(BMI3_DELTA_HEADER_LEN + (((n_block * (width[0] + width[1] + width[2])) + 7) / 8));
+
+                /* Only complete blocks are decoded, into the space left */
+                if (((used + block_len) > *len) || ((done + n_block) > *count))
+                {
+                    break;
+                }
+
+                bit_pos = 0;
+
+                for (index = 0; index < n_block; index++)
+                {
+                    for (ax = 0; ax < 3; ax++)
+                    {
+                        delta = get_bits(&buf[used + BMI3_DELTA_HEADER_LEN], &bit_pos, width[ax]);
+
+                        /* Undo zigzag: even values are positive, odd values negative deltas */
+                        if (delta & 1)
+                        {
+                            *axis[ax] = (int16_t)(*axis[ax] - (int32_t)((delta + 1) >> 1));
+                        }
+                        else
+                        {
+                            *axis[ax] = (int16_t)(*axis[ax] + (int32_t)(delta >> 1));
+                        }
+                    }
+
+                    data[done].x = codec->x;
+                    data[done].y = codec->y;
+                    data[done].z = codec->z;
+                    data[done].sensor_time = codec->sensor_time;
+                    codec->sensor_time = (uint16_t)(codec->sensor_time + codec->period);
+                    done++;
+                }
+
+                used = (uint16_t)(used + block_len);
+            }
+        }
+
+        *count = done;
+        *len = used;
+    }
+    else
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
+
+    return rslt;
+}
+
+#ifdef BMI3_PACKED_BUF
+
+/*!
+ * @brief This API empties a packed sample buffer and sets its sample period.
+ */
+int8_t bmi3_packed_init(uint8_t odr, struct bmi3_packed_buf *buf)
+{
+    /* Variable to store result of API */
+    int8_t rslt = BMI3_OK;
+
+    if ((buf != NULL) && (buf->axes != NULL))
+    {
+        if ((odr >= BMI3_ACC_ODR_0_78HZ) && (odr <= BMI3_ACC_ODR_6400HZ))
+        {
+            buf->count = 0;
+            buf->sens_time = 0;
+
+            /* Sample period doubles with each ODR step below 6400Hz */
+            buf->period = BMI3_FIFO_TIME_6400HZ_TICKS << (BMI3_ACC_ODR_6400HZ - odr);
+        }
+        else
+        {
+            rslt = BMI3_E_INVALID_INPUT;
+        }
+    }
+    else
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This API appends samples to a packed sample buffer.
+ */
+int8_t bmi3_packed_append(const struct bmi3_sens_axes_data *data, uint16_t *count, struct bmi3_packed_buf *buf)
+{
+    /* Variable to store result of API */
+    int8_t rslt = BMI3_OK;
+
+    /* Variables to define loop and index of the buffer */
+    uint16_t idx, pos;
+
+    /* Variable to store saturation flags of a sample */
+    uint8_t sat;
+
+    if ((data != NULL) && (count != NULL) && (buf != NULL) && (buf->axes != NULL))
+    {
+        if ((buf->count == 0) && (*count != 0))
+        {
+            buf->sens_time = data[0].sens_time;
+        }
+
+        if (*count > (buf->capacity - buf->count))
+        {
+            *count = (uint16_t)(buf->capacity - buf->count);
+        }
+
+        for (idx = 0; idx < *count; idx++)
+        {
+            pos = (uint16_t)(buf->count + idx);
+
+            buf->axes[pos].x = data[idx].x;
+            buf->axes[pos].y = data[idx].y;
+            buf->axes[pos].z = data[idx].z;
+
+            if (buf->sat != NULL)
+            {
+                sat = (uint8_t)((data[idx].sat_x ? BMI3_PACKED_SAT_X : 0) | (data[idx].sat_y ? BMI3_PACKED_SAT_Y : 0) |
+                                (data[idx].sat_z ? BMI3_PACKED_SAT_Z : 0));
+                set_packed_sat(buf->sat, pos, sat);
+            }
+
+            if (buf->temp != NULL)
+            {
+                buf->temp[pos] = data[idx].temp_data;
+            }
+        }
+
+        buf->count = (uint16_t)(buf->count + *count);
+    }
+    else
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This API appends FIFO samples to a packed sample buffer.
+ */
+int8_t bmi3_packed_append_fifo(const struct bmi3_fifo_sens_axes_data *data,
+                               uint16_t *count,
+                               struct bmi3_packed_buf *buf)
+{
+    /* Variable to store result of API */
+    int8_t rslt = BMI3_OK;
+
+    /* Variables to define loop and index of the buffer */
+    uint16_t idx, pos;
+
+    if ((data != NULL) && (count != NULL) && (buf != NULL) && (buf->axes != NULL))
+    {
+        if ((buf->count == 0) && (*count != 0))
+        {
+            buf->sens_time = data[0].sensor_time;
+        }
+
+        if (*count > (buf->capacity - buf->count))
+        {
+            *count = (uint16_t)(buf->capacity - buf->count);
+        }
+
+        for (idx = 0; idx < *count; idx++)
+        {
+            pos = (uint16_t)(buf->count + idx);
+
+            buf->axes[pos].x = data[idx].x;
+            buf->axes[pos].y = data[idx].y;
+            buf->axes[pos].z = data[idx].z;
+
+            if (buf->sat != NULL)
+            {
+                set_packed_sat(buf->sat, pos, 0);
+            }
+        }
+
+        buf->count = (uint16_t)(buf->count + *count);
+    }
+    else
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This API unpacks samples of a packed sample buffer.
+ */
+int8_t bmi3_packed_unpack(const struct bmi3_packed_buf *buf,
+                          uint16_t first,
+                          struct bmi3_sens_axes_data *data,
+                          uint16_t *count)
+{
+    /* Variable to store result of API */
+    int8_t rslt = BMI3_OK;
+
+    /* Variables to define loop and index of the buffer */
+    uint16_t idx, pos;
+
+    /* Variable to store saturation flags of a sample */
+    uint8_t sat = 0;
+
+    if ((buf != NULL) && (buf->axes != NULL) && (data != NULL) && (count != NULL))
+    {
+        *count = unpacked_count(buf, first, *count);
+
+        for (idx = 0; idx < *count; idx++)
+        {
+            pos = (uint16_t)(first + idx);
+
+            data[idx].x = buf->axes[pos].x;
+            data[idx].y = buf->axes[pos].y;
+            data[idx].z = buf->axes[pos].z;
+            data[idx].sens_time = buf->sens_time + (pos * buf->period);
+
+            if (buf->sat != NULL)
+            {
+                sat = (uint8_t)(buf->sat[pos / 2] >> ((pos & 1) * 4));
+            }
+
+            data[idx].sat_x = (sat & BMI3_PACKED_SAT_X) ? 1 : 0;
+            data[idx].sat_y = (sat & BMI3_PACKED_SAT_Y) ? 1 : 0;
+            data[idx].sat_z = (sat & BMI3_PACKED_SAT_Z) ? 1 : 0;
+            data[idx].temp_data = (buf->temp != NULL) ? buf->temp[pos] : 0;
+        }
+    }
+    else
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This API unpacks samples of a packed sample buffer into FIFO samples.
+ */
+int8_t bmi3_packed_unpack_fifo(const struct bmi3_packed_buf *buf,
+                               uint16_t first,
+                               struct bmi3_fifo_sens_axes_data *data,
+                               uint16_t *count)
+{
+    /* Variable to store result of API */
+    int8_t rslt = BMI3_OK;
+
+    /* Variables to define loop and index of the buffer */
+    uint16_t idx, pos;
+
+    if ((buf != NULL) && (buf->axes != NULL) && (data != NULL) && (count != NULL))
+    {
+        *count = unpacked_count(buf, first, *count);
+
+        for (idx = 0; idx < *count; idx++)
+        {
+            pos = (uint16_t)(first + idx);
+
+            data[idx].x = buf->axes[pos].x;
+            data[idx].y = buf->axes[pos].y;
+            data[idx].z = buf->axes[pos].z;
+            data[idx].sensor_time = (uint16_t)(buf->sens_time + (pos * buf->period));
+        }
+    }
+    else
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
+
+    return rslt;
+}
+#endif
+
+#ifdef BMI3_FLIGHT_REC
+
+/*!
+ * @brief This API empties and arms a flight recorder.
+ */
+int8_t bmi3_flight_rec_init(uint8_t odr, uint16_t post, uint16_t trigger_mask, struct bmi3_flight_rec *rec)
+{
+    /* Variable to store result of API */
+    int8_t rslt = BMI3_OK;
+
+    if ((rec != NULL) && (rec->accel != NULL))
+    {
+        if ((odr >= BMI3_ACC_ODR_0_78HZ) && (odr <= BMI3_ACC_ODR_6400HZ) && (post < rec->capacity))
+        {
+            rec->sens_time = 0;
+            rec->event_time = 0;
+            rec->post = post;
+            rec->head = 0;
+            rec->count = 0;
+            rec->pre_count = 0;
+            rec->post_left = 0;
+            rec->trigger_mask = trigger_mask;
+            rec->event_status = 0;
+            rec->started = BMI3_DISABLE;
+            rec->state = BMI3_FLIGHT_REC_ARMED;
+
+            /* Sample period doubles with each ODR step below 6400Hz */
+            rec->period = BMI3_FIFO_TIME_6400HZ_TICKS << (BMI3_ACC_ODR_6400HZ - odr);
+        }
+        else
+        {
+            rslt = BMI3_E_INVALID_INPUT;
+        }
+    }
+    else
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This API packs samples into the ring of a flight recorder.
+ */
+int8_t bmi3_flight_rec_feed(const struct bmi3_fifo_sens_axes_data *accel_data,
+                            const struct bmi3_fifo_sens_axes_data *gyro_data,
+                            uint16_t n_frames,
+                            struct bmi3_flight_rec *rec)
+{
+    /* Variable to store result of API */
+    int8_t rslt = BMI3_OK;
+
+    /* Variables to define loop and index of the ring */
+    uint16_t idx, pos;
+
+    if ((accel_data != NULL) && (rec != NULL) && (rec->accel != NULL))
+    {
+        if ((rec->started == BMI3_DISABLE) && (n_frames != 0))
+        {
+            rec->sens_time = accel_data[0].sensor_time;
+            rec->started = BMI3_ENABLE;
+        }
+
+        for (idx = 0; (idx < n_frames) && (rslt == BMI3_OK); idx++)
+        {
+            if (rec->state == BMI3_FLIGHT_REC_FROZEN)
+            {
+                rslt = BMI3_W_FLIGHT_REC_FROZEN;
+            }
+            else
+            {
+                /* While armed the post-event window is kept free, the oldest sample is overwritten */
+                while ((rec->state == BMI3_FLIGHT_REC_ARMED) && (rec->count >= (rec->capacity - rec->post)))
+                {
+                    rec->head = (uint16_t)((rec->head + 1) % rec->capacity);
+                    rec->sens_time += rec->period;
+                    rec->count--;
+                }
+
+                pos = (uint16_t)((rec->head + rec->count) % rec->capacity);
+
+                rec->accel[pos].x = accel_data[idx].x;
+                rec->accel[pos].y = accel_data[idx].y;
+                rec->accel[pos].z = accel_data[idx].z;
+
+                if ((rec->gyro != NULL) && (gyro_data != NULL))
+                {
+                    rec->gyro[pos].x = gyro_data[idx].x;
+                    rec->gyro[pos].y = gyro_data[idx].y;
+                    rec->gyro[pos].z = gyro_data[idx].z;
+                }
+
+                rec->count++;
+
+                if (rec->state == BMI3_FLIGHT_REC_TRIGGERED)
+                {
+                    rec->post_left--;
+
+                    if (rec->post_left == 0)
+                    {
+                        rec->state = BMI3_FLIGHT_REC_FROZEN;
+                    }
+                }
+            }
+        }
+    }
+    else
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This API triggers an armed flight recorder on a trigger interrupt.
+ */
+int8_t bmi3_flight_rec_trigger(uint16_t int_status, struct bmi3_flight_rec *rec)
+{
+    /* Variable to store result of API */
+    int8_t rslt = BMI3_OK;
+
+    if (rec != NULL)
+    {
+        if ((rec->state == BMI3_FLIGHT_REC_ARMED) && (int_status & rec->trigger_mask))
+        {
+            rec->event_status = int_status & rec->trigger_mask;
+            rec->pre_count = rec->count;
+            rec->event_time = rec->sens_time + ((uint32_t)rec->count * rec->period);
+            rec->post_left = rec->post;
+            rec->state = (rec->post != 0) ? BMI3_FLIGHT_REC_TRIGGERED : BMI3_FLIGHT_REC_FROZEN;
+        }
+    }
+    else
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This API reads a chunk of a FIFO stream into a flight recorder and
+ * triggers it.
+ */
+int8_t bmi3_flight_rec_service(uint16_t int_status,
+                               struct bmi3_fifo_sens_axes_data *accel_data,
+                               struct bmi3_fifo_sens_axes_data *gyro_data,
+                               struct bmi3_fifo_frame *fifo,
+                               struct bmi3_fifo_stream *stream,
+                               struct bmi3_flight_rec *rec,
+                               struct bmi3_dev *dev)
+{
+    /* Variable to store result of API */
+    int8_t rslt;
+
+    /* Variable to store the warning of the extraction */
+    int8_t warn = BMI3_OK;
+
+    if ((accel_data != NULL) && (fifo != NULL) && (rec != NULL))
+    {
+        rslt = bmi3_fifo_stream_read(stream, dev);
+
+        if (rslt == BMI3_OK)
+        {
+            rslt = bmi3_fifo_stream_extract(accel_data, gyro_data, NULL, fifo, stream, dev);
+
+            /* Dummy frames are not recorded, the frames extracted still are */
+            if (rslt > BMI3_OK)
+            {
+                warn = rslt;
+                rslt = BMI3_OK;
+            }
+        }
+
+        if (rslt == BMI3_OK)
+        {
+            rslt = bmi3_flight_rec_feed(accel_data, gyro_data, fifo->avail_fifo_accel_frames, rec);
+        }
+
+        if (rslt >= BMI3_OK)
+        {
+            warn = (rslt > BMI3_OK) ? rslt : warn;
+            rslt = bmi3_flight_rec_trigger(int_status, rec);
+        }
+
+        if (rslt == BMI3_OK)
+        {
+            rslt = warn;
+        }
+    }
+    else
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This API exports samples of the ring of a flight recorder.
+ */
+int8_t bmi3_flight_rec_export(const struct bmi3_flight_rec *rec,
+                              uint16_t first,
+                              struct bmi3_sens_axes_data *accel_data,
+                              struct bmi3_sens_axes_data *gyro_data,
+                              uint16_t *count)
+{
+    /* Variable to store result of API */
+    int8_t rslt = BMI3_OK;
+
+    /* Variables to define loop and index of the ring */
+    uint16_t idx, pos;
+
+    /* Variable to store the number of samples from the index on */
+    uint16_t avail;
+
+    /* Variable to store sensor time of a sample */
+    uint32_t sens_time;
+
+    if ((rec != NULL) && (rec->accel != NULL) && (accel_data != NULL) && (count != NULL))
+    {
+        avail = (first < rec->count) ? (uint16_t)(rec->count - first) : 0;
+        *count = (*count < avail) ? *count : avail;
+
+        for (idx = 0; idx < *count; idx++)
+        {
+            pos = (uint16_t)((rec->head + first + idx) % rec->capacity);
+            sens_time = rec->sens_time + ((uint32_t)(first + idx) * rec->period);
+
+            unpack_rec_sample(&rec->accel[pos], sens_time, &accel_data[idx]);
+
+            if ((rec->gyro != NULL) && (gyro_data != NULL))
+            {
+                unpack_rec_sample(&rec->gyro[pos], sens_time, &gyro_data[idx]);
+            }
+        }
+    }
+    else
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This API arms a flight recorder again.
+ */
+int8_t bmi3_flight_rec_rearm(struct bmi3_flight_rec *rec)
+{
+    /* Variable to store result of API */
+    int8_t rslt = BMI3_OK;
+
+    if (rec != NULL)
+    {
+        rec->pre_count = 0;
+        rec->post_left = 0;
+        rec->event_status = 0;
+        rec->state = BMI3_FLIGHT_REC_ARMED;
+    }
+    else
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
+
+    return rslt;
+}
+#endif
+
+#ifdef BMI3_DECIMATOR
+
+/*!
+ * @brief This API initializes a CIC decimator of FIFO samples.
+ */
+int8_t bmi3_decimator_init(uint8_t in_odr, uint8_t out_odr, uint8_t order, struct bmi3_decimator *dec)
+{
+    /* Variable to store result of API */
+    int8_t rslt = BMI3_OK;
+
+    /* Variables to define loop */
+    uint8_t stage, axis;
+
+    if (dec != NULL)
+    {
+        /* Ratio doubles with each ODR step, the gain grows by log2 of the ratio per stage */
+        if ((in_odr <= BMI3_ACC_ODR_6400HZ) && (out_odr >= BMI3_ACC_ODR_0_78HZ) && (in_odr > out_odr) &&
+            (order >= 1) && (order <= BMI3_DECIM_MAX_ORDER) &&
+            (((uint16_t)order * (in_odr - out_odr)) <= BMI3_DECIM_MAX_GROWTH))
+        {
+            for (stage = 0; stage < BMI3_DECIM_MAX_ORDER; stage++)
+            {
+                for (axis = 0; axis < 3; axis++)
+                {
+                    dec->integ[stage][axis] = 0;
+                    dec->comb[stage][axis] = 0;
+                }
+            }
+
+            dec->ratio = (uint8_t)(UINT8_C(1) << (in_odr - out_odr));
+            dec->order = order;
+            dec->shift = (uint8_t)(order * (in_odr - out_odr));
+            dec->phase = 0;
+        }
+        else
+        {
+            rslt = BMI3_E_INVALID_INPUT;
+        }
+    }
+    else
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
 
-    /* Variable to enable feature engine bit */
-    uint8_t feature_engine_en[2] = { BMI3_ENABLE, 0 };
+    return rslt;
+}
 
-    /* Variable to store status value for feature engine enable */
-    uint8_t reg_data[2] = { 0 };
+/*!
+ * @brief This API decimates FIFO samples by the ratio of the decimator.
+ */
+int8_t bmi3_decimate(const struct bmi3_fifo_sens_axes_data *in,
+                     uint16_t in_count,
+                     struct bmi3_fifo_sens_axes_data *out,
+                     uint16_t *out_count,
+                     struct bmi3_decimator *dec)
+{
+    /* Variable to store result of API */
+    int8_t rslt = BMI3_OK;
 
-    /* Array variable to store feature IO status */
-    uint8_t feature_io_status[2] = { BMI3_ENABLE, 0 };
+    /* Variables to define loop */
+    uint16_t index;
+    uint8_t stage, axis;
 
-    uint8_t loop = 1;
+    /* Variable to index the output samples */
+    uint16_t out_index = 0;
 
-    /* Null-pointer check */
-    rslt = null_ptr_check(dev);
+    /* Variables to store the axes passing through the stages */
+    uint32_t value[3];
+    uint32_t delay;
 
-    if (rslt == BMI3_OK)
+    /* Variable to store the rounding of the normalization */
+    int32_t round;
+
+    if ((in != NULL) && (out != NULL) && (out_count != NULL) && (dec != NULL) && (dec->order != 0))
     {
-        /* Reset bmi3 device */
-        rslt = bmi3_set_command_register(BMI3_CMD_SOFT_RESET, dev);
-        dev->delay_us(BMI3_SOFT_RESET_DELAY, dev->intf_ptr);
+        round = (dec->shift != 0) ? (INT32_C(1) << (dec->shift - 1)) : 0;
 
-        /* Performing a dummy read after a soft-reset */
-        if ((rslt == BMI3_OK) && (dev->intf == BMI3_SPI_INTF))
+        for (index = 0; index < in_count; index++)
         {
-            rslt = bmi3_get_regs(BMI3_REG_CHIP_ID, dummy_byte, 2, dev);
+            value[0] = (uint32_t)(int32_t)in[index].x;
+            value[1] = (uint32_t)(int32_t)in[index].y;
+            value[2] = (uint32_t)(int32_t)in[index].z;
+
+            /* Integrators run at the input rate, overflows cancel out in the combs */
+            for (stage = 0; stage < dec->order; stage++)
+            {
+                for (axis = 0; axis < 3; axis++)
+                {
+                    dec->integ[stage][axis] += value[axis];
+                    value[axis] = dec->integ[stage][axis];
+                }
+            }
+
+            dec->phase++;
+
+            if (dec->phase == dec->ratio)
+            {
+                dec->phase = 0;
+
+                /* Combs run at the output rate */
+                for (stage = 0; stage < dec->order; stage++)
+                {
+                    for (axis = 0; axis < 3; axis++)
+                    {
+                        delay = value[axis];
+                        value[axis] -= dec->comb[stage][axis];
+                        dec->comb[stage][axis] = delay;
+                    }
+                }
+
+                /* Output is written after the input is read, so that both may be the same array */
+                out[out_index].x = (int16_t)((int32_t)(value[0] + (uint32_t)round) >> dec->shift);
+                out[out_index].y = (int16_t)((int32_t)(value[1] + (uint32_t)round) >> dec->shift);
+                out[out_index].z = (int16_t)((int32_t)(value[2] + (uint32_t)round) >> dec->shift);
+                out[out_index].sensor_time = in[index].sensor_time;
+                out_index++;
+            }
         }
 
-        /* Enabling Feature engine */
-        if (rslt == BMI3_OK)
+        *out_count = out_index;
+    }
+    else
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
+
+    return rslt;
+}
+#endif
+
+#ifdef BMI3_SPECTRUM
+
+/*!
+ * @brief This API initializes the spectral summary of FIFO samples.
+ */
+int8_t bmi3_spectrum_init(const uint16_t *bins, uint8_t n_bins, uint16_t block_len, struct bmi3_spectrum *spec)
+{
+    /* Variable to store result of API */
+    int8_t rslt = BMI3_OK;
+
+    /* Variables to define loop */
+    uint8_t axis, bin;
+
+    if ((bins != NULL) && (spec != NULL))
+    {
+        if ((n_bins == 0) || (n_bins > BMI3_SPECTRUM_MAX_BINS) || (block_len < 2) ||
+            (block_len > BMI3_SPECTRUM_MAX_LEN))
         {
-            rslt = bmi3_set_regs(BMI3_REG_FEATURE_IO2, feature_data, 2, dev);
+            rslt = BMI3_E_INVALID_INPUT;
         }
 
-        if (rslt == BMI3_OK)
+        for (bin = 0; (rslt == BMI3_OK) && (bin < n_bins); bin++)
         {
-            /* Enabling feature status bit */
-            rslt = bmi3_set_regs(BMI3_REG_FEATURE_IO_STATUS, feature_io_status, 2, dev);
+            /* Bins from the block rate up to the Nyquist frequency */
+            if ((bins[bin] == 0) || (bins[bin] > (block_len / 2)))
+            {
+                rslt = BMI3_E_INVALID_INPUT;
+            }
+            else
+            {
+                spec->coeff[bin] = get_goertzel_coeff(bins[bin], block_len);
+
+                for (axis = 0; axis < 3; axis++)
+                {
+                    spec->s1[axis][bin] = 0;
+                    spec->s2[axis][bin] = 0;
+                }
+            }
         }
 
         if (rslt == BMI3_OK)
         {
-            /* Enable feature engine bit */
-            rslt = bmi3_set_regs(BMI3_REG_FEATURE_CTRL, feature_engine_en, 2, dev);
+            spec->kernel = NULL;
+            spec->block_len = block_len;
+            spec->pos = 0;
+            spec->n_bins = n_bins;
         }
+    }
+    else
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
 
-        if (rslt == BMI3_OK)
+    return rslt;
+}
+
+/*!
+ * @brief This API updates the spectral summary by FIFO samples.
+ */
+int8_t bmi3_spectrum_update(const struct bmi3_fifo_sens_axes_planes *planes,
+                            uint16_t count,
+                            struct bmi3_spectrum *spec,
+                            struct bmi3_spectrum_summary *summary)
+{
+    /* Variable to store result of API */
+    int8_t rslt = BMI3_OK;
+
+    /* Variables to store the samples done and the samples up to the end of the block */
+    uint16_t done = 0;
+    uint16_t chunk;
+
+    /* Kernel of the filters */
+    bmi3_goertzel_fptr_t kernel;
+
+    if ((planes != NULL) && (planes->x != NULL) && (planes->y != NULL) && (planes->z != NULL) && (spec != NULL) &&
+        (summary != NULL) && (spec->n_bins != 0))
+    {
+        kernel = (spec->kernel != NULL) ? spec->kernel : run_goertzel;
+        summary->blocks = 0;
+
+        while (done < count)
         {
-            /* Checking the status bit for feature engine enable */
-            while (loop <= 10)
+            chunk = (uint16_t)(spec->block_len - spec->pos);
+
+            if (chunk > (count - done))
             {
-                dev->delay_us(100000, dev->intf_ptr);
+                chunk = (uint16_t)(count - done);
+            }
 
-                rslt = bmi3_get_regs(BMI3_REG_FEATURE_IO1, reg_data, 2, dev);
+            /* Each axis is a contiguous array, filtered in a separate pass */
+            kernel(&planes->x[done], chunk, spec->coeff, spec->n_bins, spec->s1[0], spec->s2[0]);
+            kernel(&planes->y[done], chunk, spec->coeff, spec->n_bins, spec->s1[1], spec->s2[1]);
+            kernel(&planes->z[done], chunk, spec->coeff, spec->n_bins, spec->s1[2], spec->s2[2]);
 
-                if (rslt == BMI3_OK)
-                {
-                    if (reg_data[0] & BMI3_FEATURE_ENGINE_ENABLE_MASK)
-                    {
-                        rslt = BMI3_OK;
+            done += chunk;
+            spec->pos += chunk;
 
-                        break;
-                    }
-                    else
-                    {
-                        rslt = BMI3_E_FEATURE_ENGINE_STATUS;
-                    }
-                }
+            if (spec->pos == spec->block_len)
+            {
+                finish_spectrum_block(spec, summary);
+            }
+        }
+    }
+    else
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
+
+    return rslt;
+}
+#endif
+
+#ifdef BMI3_BUS_STATS
+
+/*!
+ * @brief This API gets a snapshot of the bus statistics.
+ */
+int8_t bmi3_get_bus_stats(struct bmi3_bus_stats *stats, const struct bmi3_dev *dev)
+{
+    /* Variable to store result of API */
+    int8_t rslt;
+
+    rslt = null_ptr_check(dev);
+
+    if ((rslt == BMI3_OK) && (stats != NULL))
+    {
+        *stats = dev->bus_stats;
+    }
+    else if (rslt == BMI3_OK)
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This API resets the bus statistics.
+ */
+int8_t bmi3_reset_bus_stats(struct bmi3_dev *dev)
+{
+    /* Variable to store result of API */
+    int8_t rslt;
+
+    /* Variable to define loop */
+    uint8_t loop;
+
+    rslt = null_ptr_check(dev);
+
+    if (rslt == BMI3_OK)
+    {
+        for (loop = 0; loop < BMI3_BUS_STATS_REGS; loop++)
+        {
+            dev->bus_stats.reads[loop] = 0;
+            dev->bus_stats.writes[loop] = 0;
+            dev->bus_stats.bytes[loop] = 0;
+            dev->bus_stats.time_us[loop] = 0;
+        }
+
+        for (loop = 0; loop < BMI3_BUS_STATS_HIST_BINS; loop++)
+        {
+            dev->bus_stats.hist[loop] = 0;
+        }
+
+        dev->bus_stats.com_fail = 0;
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This API calibrates the scale factor of a bus model with the bus statistics.
+ */
+int8_t bmi3_calibrate_bus_model(const struct bmi3_bus_stats *stats, struct bmi3_bus_model *model)
+{
+    /* Variable to store result of API */
+    int8_t rslt = BMI3_OK;
+
+    /* Variable to define loop */
+    uint8_t loop;
+
+    /* Sums of the statistics of all registers */
+    uint64_t reads = 0;
+    uint64_t writes = 0;
+    uint64_t bytes = 0;
+    uint64_t time_ns = 0;
+
+    /* Modeled time of the transactions recorded */
+    uint64_t model_ns = 0;
+
+    if ((stats == NULL) || (model == NULL))
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
+    else if (model->bus_hz == 0)
+    {
+        rslt = BMI3_E_INVALID_INPUT;
+    }
+    else
+    {
+        for (loop = 0; loop < BMI3_BUS_STATS_REGS; loop++)
+        {
+            reads += stats->reads[loop];
+            writes += stats->writes[loop];
+            bytes += stats->bytes[loop];
+            time_ns += (uint64_t)stats->time_us[loop] * 1000;
+        }
+
+        model_ns = get_bus_model_ns(model, reads, writes, bytes);
+
+        /* Time is not measured without "timestamp_us" of bmi3_dev */
+        if ((model_ns == 0) || (time_ns == 0))
+        {
+            rslt = BMI3_E_INVALID_INPUT;
+        }
+    }
+
+    if (rslt == BMI3_OK)
+    {
+        model->scale_q16 = (uint32_t)(((time_ns * BMI3_BUS_MODEL_SCALE_ONE) + (model_ns / 2)) / model_ns);
+    }
+
+    return rslt;
+}
+#endif
+
+#ifdef BMI3_EVENT_LATENCY
+
+/*!
+ * @brief This API resets the event latency instrumentation.
+ */
+int8_t bmi3_event_latency_reset(struct bmi3_event_latency *lat)
+{
+    /* Variable to store result of API */
+    int8_t rslt = BMI3_OK;
+
+    /* Variables to define loop */
+    uint8_t loop;
+    uint8_t bin;
+
+    if (lat != NULL)
+    {
+        lat->sync_sensor_time = 0;
+        lat->sync_host_us = 0;
+        lat->synced = BMI3_DISABLE;
+
+        for (loop = 0; loop < BMI3_EVENT_LATENCY_FEATURES; loop++)
+        {
+            lat->feature[loop].count = 0;
+            lat->feature[loop].min_us = UINT32_MAX;
+            lat->feature[loop].max_us = 0;
+            lat->feature[loop].sum_us = 0;
 
-                loop++;
+            for (bin = 0; bin < BMI3_EVENT_LATENCY_HIST_BINS; bin++)
+            {
+                lat->feature[loop].hist[bin] = 0;
             }
         }
     }
+    else
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
 
     return rslt;
 }
 
 /*!
- * @brief This API writes the available sensor specific commands to the sensor.
+ * @brief This API reads the sensor time and correlates it with the host timestamp.
  */
-int8_t bmi3_set_command_register(uint16_t command, struct bmi3_dev *dev)
+int8_t bmi3_event_latency_sync(uint32_t host_us, struct bmi3_event_latency *lat, struct bmi3_dev *dev)
 {
     /* Variable to store result of API */
     int8_t rslt;
 
-    /* Array variable to store command value */
-    uint8_t reg_data[2] = { 0 };
+    /* Variable to store the sensor time */
+    uint32_t sensor_time = 0;
 
-    reg_data[0] = (uint8_t)(command & BMI3_SET_LOW_BYTE);
-    reg_data[1] = (uint8_t)((command & BMI3_SET_HIGH_BYTE) >> 8);
+    if (lat != NULL)
+    {
+        rslt = bmi3_get_sensor_time(&sensor_time, dev);
 
-    /* Set the command in the command register */
-    rslt = bmi3_set_regs(BMI3_REG_CMD, reg_data, 2, dev);
+        if (rslt == BMI3_OK)
+        {
+            lat->sync_sensor_time = sensor_time;
+            lat->sync_host_us = host_us;
+            lat->synced = BMI3_ENABLE;
+        }
+    }
+    else
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This API converts a sensor time into a host timestamp.
+ */
+int8_t bmi3_event_latency_host_us(uint32_t sensor_time, const struct bmi3_event_latency *lat, uint32_t *host_us)
+{
+    /* Variable to store result of API */
+    int8_t rslt = BMI3_OK;
+
+    /* Variable to store the sensor time relative to the synchronization, negative if before */
+    int64_t delta;
+
+    if ((lat != NULL) && (host_us != NULL))
+    {
+        if (lat->synced == BMI3_ENABLE)
+        {
+            /* Sensor time wraps around at 32 bits, an event is at most half the range apart */
+            delta = (int32_t)(sensor_time - lat->sync_sensor_time);
+            delta = (delta * (int64_t)BMI3_SENSORTIME_US_NUM) / (int64_t)BMI3_SENSORTIME_US_DEN;
+
+            *host_us = (uint32_t)(lat->sync_host_us + (uint32_t)delta);
+        }
+        else
+        {
+            rslt = BMI3_E_INVALID_STATUS;
+        }
+    }
+    else
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
 
     return rslt;
 }
 
 /*!
- * @brief This API gets the interrupt 1 status of both feature and data
- * interrupts
+ * @brief This API records the latency of the feature interrupts that fired.
  */
-int8_t bmi3_get_int1_status(uint16_t *int_status, struct bmi3_dev *dev)
+int8_t bmi3_event_latency_record(uint16_t int_status,
+                                 uint32_t event_us,
+                                 uint32_t handler_us,
+                                 struct bmi3_event_latency *lat)
 {
     /* Variable to store result of API */
-    int8_t rslt;
+    int8_t rslt = BMI3_OK;
 
-    /* Array to store data */
-    uint8_t data_array[2] = { 0 };
+    /* Variable to store the latency, host timestamps wrap around at 32 bits */
+    uint32_t latency = handler_us - event_us;
 
-    if (int_status != NULL)
+    /* Variable to store histogram bin of the latency */
+    uint8_t bin = 0;
+
+    /* Variable to loop through the feature interrupts */
+    uint8_t loop;
+
+    /* Pointer to the statistics of a feature interrupt */
+    struct bmi3_event_latency_stats *stats;
+
+    if (lat != NULL)
     {
-        /* Get the interrupt status */
-        rslt = bmi3_get_regs(BMI3_REG_INT_STATUS_INT1, data_array, 2, dev);
+        while ((latency >> bin) && (bin < (BMI3_EVENT_LATENCY_HIST_BINS - 1)))
+        {
+            bin++;
+        }
 
-        if (rslt == BMI3_OK)
+        for (loop = 0; loop < BMI3_EVENT_LATENCY_FEATURES; loop++)
         {
-            *int_status = (uint16_t)(data_array[0] | ((uint16_t)data_array[1] << 8));
+            if (int_status & (UINT16_C(1) << loop))
+            {
+                stats = &lat->feature[loop];
+
+                stats->count++;
+                stats->sum_us += latency;
+                stats->hist[bin]++;
+
+                if (latency < stats->min_us)
+                {
+                    stats->min_us = latency;
+                }
+
+                if (latency > stats->max_us)
+                {
+                    stats->max_us = latency;
+                }
+            }
         }
     }
     else
@@ -2096,27 +13679,38 @@ int8_t bmi3_get_int1_status(uint16_t *int_status, struct bmi3_dev *dev)
 
     return rslt;
 }
+#endif
+
+#ifdef BMI3_FUSION
 
 /*!
- * @brief This API gets the interrupt 2 status of both feature and data
- * interrupts
+ * @brief This API initializes the orientation fusion.
  */
-int8_t bmi3_get_int2_status(uint16_t *int_status, struct bmi3_dev *dev)
+int8_t bmi3_fusion_init(int32_t kp, int32_t ki, struct bmi3_fusion *fusion)
 {
     /* Variable to store result of API */
-    int8_t rslt;
-
-    /* Array to store data */
-    uint8_t data_array[2] = { 0 };
+    int8_t rslt = BMI3_OK;
 
-    if (int_status != NULL)
+    if (fusion != NULL)
     {
-        /* Get the interrupt status */
-        rslt = bmi3_get_regs(BMI3_REG_INT_STATUS_INT2, data_array, 2, dev);
-
-        if (rslt == BMI3_OK)
+        if ((kp >= 0) && (ki >= 0))
         {
-            *int_status = (uint16_t)(data_array[0] | ((uint16_t)data_array[1] << 8));
+            /* Orientation starts at the identity, the accel pulls it towards gravity */
+            fusion->q[0] = INT32_C(1) << BMI3_FUSION_Q_FRAC_BITS;
+            fusion->q[1] = 0;
+            fusion->q[2] = 0;
+            fusion->q[3] = 0;
+            fusion->integ[0] = 0;
+            fusion->integ[1] = 0;
+            fusion->integ[2] = 0;
+            fusion->kp = kp;
+            fusion->ki = ki;
+            fusion->last = 0;
+            fusion->last_valid = BMI3_DISABLE;
+        }
+        else
+        {
+            rslt = BMI3_E_INVALID_INPUT;
         }
     }
     else
@@ -2128,55 +13722,49 @@ int8_t bmi3_get_int2_status(uint16_t *int_status, struct bmi3_dev *dev)
 }
 
 /*!
- * @brief This API gets the re-mapped x, y and z axes from the sensor and
- * updates the values in the device structure.
- *
- * @note: XYZ axis denotes x = x, y = y, z = z
- * Similarly,
- *    YXZ, x = y, y = x, z = z
- *
+ * @brief This API updates the orientation fusion by the 6-DoF samples of a
+ * FIFO read.
  */
-int8_t bmi3_get_remap_axes(struct bmi3_axes_remap *remapped_axis, struct bmi3_dev *dev)
+int8_t bmi3_fusion_update(const struct bmi3_fifo_6dof_data *data,
+                          uint16_t count,
+                          struct bmi3_fifo_time *fifo_time,
+                          const struct bmi3_fifo_frame *fifo,
+                          struct bmi3_fusion *fusion,
+                          const struct bmi3_dev *dev)
 {
     /* Variable to store result of API */
-    int8_t rslt;
-
-    /* Array variable to get remapped axis data */
-    uint8_t remap_data[4];
+    int8_t rslt = BMI3_OK;
 
-    /* Array variable to store base address of remap axis data */
-    uint8_t base_addr[2] = { BMI3_BASE_ADDR_AXIS_REMAP, 0 };
+    /* Variable to define loop */
+    uint16_t index;
 
-    /* Variable to store axis remap data */
-    uint8_t reg_data;
+    /* Variables to store time of the sample and the time step */
+    uint64_t time;
+    uint64_t dt;
 
-    if (remapped_axis != NULL)
+    if ((data != NULL) && (fifo_time != NULL) && (fifo != NULL) && (fusion != NULL) && (dev != NULL))
     {
-        /* Set the configuration to feature engine register */
-        rslt = bmi3_set_regs(BMI3_REG_FEATURE_DATA_ADDR, base_addr, 2, dev);
-
-        if (rslt == BMI3_OK)
+        if ((dev->unit_scale.acc_q == 0) || (dev->unit_scale.gyr_q == 0))
         {
-            /* Get the configuration from the feature engine register where axis
-             * re-mapping feature resides
-             */
-            rslt = bmi3_get_regs(BMI3_REG_FEATURE_DATA_TX, remap_data, 4, dev);
-
-            if (rslt == BMI3_OK)
+            /* Range or resolution is not known */
+            rslt = BMI3_E_INVALID_INPUT;
+        }
+        else
+        {
+            for (index = 0; index < count; index++)
             {
-                reg_data = remap_data[0];
-
-                /* Get the re-mapped axis */
-                remapped_axis->axis_map = BMI3_GET_BIT_POS0(reg_data, BMI3_XYZ_AXIS);
-
-                /* Get the re-mapped x-axis polarity */
-                remapped_axis->invert_x = BMI3_GET_BITS(reg_data, BMI3_X_AXIS_SIGN);
+                time = get_fifo_sample_time(fifo_time, fifo, data[index].sensor_time, index, count);
+                dt = ((fusion->last_valid == BMI3_ENABLE) && (time > fusion->last)) ? (time - fusion->last) :
+                     fifo_time->period;
 
-                /* Get the re-mapped y-axis polarity */
-                remapped_axis->invert_y = BMI3_GET_BITS(reg_data, BMI3_Y_AXIS_SIGN);
+                if (dt > BMI3_FUSION_MAX_DT)
+                {
+                    dt = BMI3_FUSION_MAX_DT;
+                }
 
-                /* Get the re-mapped z-axis polarity */
-                remapped_axis->invert_z = BMI3_GET_BITS(reg_data, BMI3_Z_AXIS_SIGN);
+                update_fusion(&data[index], (uint32_t)dt, fusion, dev);
+                fusion->last = time;
+                fusion->last_valid = BMI3_ENABLE;
             }
         }
     }
@@ -2187,135 +13775,162 @@ int8_t bmi3_get_remap_axes(struct bmi3_axes_remap *remapped_axis, struct bmi3_de
 
     return rslt;
 }
+#endif
+
+/***************************************************************************/
+
+/*!                   Local Function Definitions
+ ****************************************************************************/
 
 /*!
- * @brief This API sets the re-mapped x, y and z axes to the sensor and
- * updates them in the device structure.
+ * @brief This internal API sets accelerometer configurations like ODR, accel mode,
+ * bandwidth, average samples and range.
  */
-int8_t bmi3_set_remap_axes(const struct bmi3_axes_remap remapped_axis, struct bmi3_dev *dev)
+static int8_t set_accel_config(struct bmi3_accel_config *config, struct bmi3_dev *dev)
 {
     /* Variable to store result of API */
     int8_t rslt;
 
-    /* Structure instance of sensor config */
-    struct bmi3_sens_config config = { 0 };
+    /* Variable to store data */
+    uint8_t reg_data[2] = { 0 };
 
-    /* Variable to define the register address */
-    uint8_t base_addr[2] = { BMI3_BASE_ADDR_AXIS_REMAP, 0 };
+    uint16_t odr, range, bwp, avg_num, acc_mode;
 
-    /* Array variable to get remapped axis data */
-    uint8_t remap_data[4] = { 0 };
+    if (config != NULL)
+    {
+        /* Validate bandwidth and averaging samples */
+        rslt = validate_bw_avg_acc_mode(&config->bwp, &config->acc_mode, &config->avg_num, dev);
 
-    /* Set the configuration to feature engine register */
-    rslt = bmi3_set_regs(BMI3_REG_FEATURE_DATA_ADDR, base_addr, 2, dev);
+        if (rslt == BMI3_OK)
+        {
+            /* Validate ODR and range */
+            rslt = validate_acc_odr_range(&config->odr, &config->range, dev);
+        }
 
-    if (rslt == BMI3_OK)
-    {
-        /* Set the value of re-mapped axis */
-        remap_data[0] = BMI3_SET_BIT_POS0(remap_data[0], BMI3_XYZ_AXIS, remapped_axis.axis_map);
+        if (rslt == BMI3_OK)
+        {
+            if (config->acc_mode == BMI3_ACC_MODE_LOW_PWR)
+            {
+                rslt = validate_acc_odr_avg(config->odr, config->avg_num);
+            }
 
-        /* Set the value of re-mapped x-axis sign */
-        remap_data[0] |= BMI3_SET_BITS(remap_data[0], BMI3_X_AXIS_SIGN, remapped_axis.invert_x);
+            if ((config->acc_mode == BMI3_ACC_MODE_NORMAL) || (config->acc_mode == BMI3_ACC_MODE_HIGH_PERF))
+            {
+                if ((config->odr >= BMI3_ACC_ODR_0_78HZ) && (config->odr <= BMI3_ACC_ODR_6_25HZ))
+                {
+                    rslt = BMI3_E_ACC_INVALID_CFG;
+                }
+            }
+        }
 
-        /* Set the value of re-mapped y-axis sign */
-        remap_data[0] |= BMI3_SET_BITS(remap_data[0], BMI3_Y_AXIS_SIGN, remapped_axis.invert_y);
+        if (rslt == BMI3_OK)
+        {
+            /* Set accelerometer ODR */
+            odr = BMI3_SET_BIT_POS0(reg_data[0], BMI3_ACC_ODR, config->odr);
 
-        /* Set the value of re-mapped z-axis sign */
-        remap_data[0] |= BMI3_SET_BITS(remap_data[0], BMI3_Z_AXIS_SIGN, remapped_axis.invert_z);
+            /* Set accelerometer range */
+            range = BMI3_SET_BITS(reg_data[0], BMI3_ACC_RANGE, config->range);
 
-        /* Set the configuration back to the page */
-        rslt = bmi3_set_regs(BMI3_REG_FEATURE_DATA_TX, remap_data, 2, dev);
+            /* Set accelerometer bandwidth */
+            bwp = BMI3_SET_BITS(reg_data[0], BMI3_ACC_BW, config->bwp);
 
-        if (rslt == BMI3_OK)
+            /* Set accelerometer average number of samples */
+            avg_num = BMI3_SET_BITS(reg_data[1], BMI3_ACC_AVG_NUM, config->avg_num);
+
+            /* Set accelerometer accel mode */
+            acc_mode = BMI3_SET_BITS(reg_data[1], BMI3_ACC_MODE, config->acc_mode);
+
+            reg_data[0] = (uint8_t)(odr | range | bwp);
+            reg_data[1] = (uint8_t)((avg_num | acc_mode) >> 8);
+
+            /* Set configurations for accel */
+            rslt = bmi3_set_regs(BMI3_REG_ACC_CONF, reg_data, 2, dev);
+        }
+        else
         {
-            rslt = axes_remap_acc_power_mode_status(config, dev);
+            rslt = BMI3_E_ACC_INVALID_CFG;
         }
     }
+    else
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
 
     return rslt;
 }
 
 /*!
- * @brief This API sets the sensor/feature configuration.
+ * @brief This internal API gets accelerometer configurations like ODR,
+ * bandwidth, accel mode, average samples and gravity range.
  */
-int8_t bmi3_set_sensor_config(struct bmi3_sens_config *sens_cfg, uint8_t n_sens, struct bmi3_dev *dev)
+static int8_t get_accel_config(struct bmi3_accel_config *config, struct bmi3_dev *dev)
 {
     /* Variable to store result of API */
     int8_t rslt;
 
-    /* Variable to define loop */
-    uint8_t loop;
+    /* Array to store data */
+    uint8_t data_array[2] = { 0 };
 
-    /* Null-pointer check */
-    rslt = null_ptr_check(dev);
+    uint16_t reg_data;
 
-    if ((rslt == BMI3_OK) && (sens_cfg != NULL))
+    if (config != NULL)
     {
-        for (loop = 0; loop < n_sens; loop++)
-        {
-            switch (sens_cfg[loop].type)
-            {
-                case BMI3_ACCEL:
-                    rslt = set_accel_config(&sens_cfg[loop].cfg.acc, dev);
-                    break;
-
-                case BMI3_GYRO:
-                    rslt = set_gyro_config(&sens_cfg[loop].cfg.gyr, dev);
-                    break;
-
-                case BMI3_ANY_MOTION:
-                    rslt = set_any_motion_config(&sens_cfg[loop].cfg.any_motion, dev);
-                    break;
+        /* Read the sensor configuration details */
+        rslt = bmi3_get_regs(BMI3_REG_ACC_CONF, data_array, 2, dev);
 
-                case BMI3_NO_MOTION:
-                    rslt = set_no_motion_config(&sens_cfg[loop].cfg.no_motion, dev);
-                    break;
+        if (rslt == BMI3_OK)
+        {
+            reg_data = data_array[0];
 
-                case BMI3_SIG_MOTION:
-                    rslt = set_sig_motion_config(&sens_cfg[loop].cfg.sig_motion, dev);
-                    break;
+            /* Get accelerometer ODR */
+            config->odr = BMI3_GET_BIT_POS0(reg_data, BMI3_ACC_ODR);
 
-                case BMI3_FLAT:
-                    rslt = set_flat_config(&sens_cfg[loop].cfg.flat, dev);
-                    break;
+            /* Get accelerometer range */
+            config->range = BMI3_GET_BITS(reg_data, BMI3_ACC_RANGE);
 
-                case BMI3_TILT:
-                    rslt = set_tilt_config(&sens_cfg[loop].cfg.tilt, dev);
-                    break;
+            /* Get accelerometer bandwidth */
+            config->bwp = BMI3_GET_BITS(reg_data, BMI3_ACC_BW);
 
-                case BMI3_ORIENTATION:
-                    rslt = set_orientation_config(&sens_cfg[loop].cfg.orientation, dev);
-                    break;
+            reg_data = (uint16_t)data_array[1] << 8;
 
-                case BMI3_STEP_COUNTER:
-                    rslt = set_step_config(&sens_cfg[loop].cfg.step_counter, dev);
-                    break;
+            /* Get accelerometer average samples */
+            config->avg_num = BMI3_GET_BITS(reg_data, BMI3_ACC_AVG_NUM);
 
-                case BMI3_TAP:
-                    rslt = set_tap_config(&sens_cfg[loop].cfg.tap, dev);
-                    break;
+            /* Get accel mode */
+            config->acc_mode = BMI3_GET_BITS(reg_data, BMI3_ACC_MODE);
+        }
+    }
+    else
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
 
-                case BMI3_ALT_ACCEL:
-                    rslt = set_alternate_accel_config(&sens_cfg[loop].cfg.alt_acc, dev);
-                    break;
+    return rslt;
+}
 
-                case BMI3_ALT_GYRO:
-                    rslt = set_alternate_gyro_config(&sens_cfg[loop].cfg.alt_gyr, dev);
-                    break;
+/*!
+ * @brief This internal API validates bandwidth and accel mode of the
+ * accelerometer set by the user.
+ */
+static int8_t validate_bw_avg_acc_mode(uint8_t *bandwidth, uint8_t *acc_mode, uint8_t *avg_num, struct bmi3_dev *dev)
+{
+    /* Variable to store result of API */
+    int8_t rslt;
 
-                case BMI3_ALT_AUTO_CONFIG:
-                    rslt = set_alternate_auto_config(&sens_cfg[loop].cfg.alt_auto_cfg, dev);
-                    break;
+    if ((bandwidth != NULL) && (acc_mode != NULL) && (avg_num != NULL))
+    {
+        /* Validate and auto-correct accel mode */
+        rslt = check_boundary_val(acc_mode, BMI3_ACC_MODE_DISABLE, BMI3_ACC_MODE_HIGH_PERF, dev);
 
-                default:
-                    rslt = BMI3_E_INVALID_SENSOR;
-                    break;
-            }
+        if (rslt == BMI3_OK)
+        {
+            /* Validate for averaging number of samples */
+            rslt = check_boundary_val(avg_num, BMI3_ACC_AVG1, BMI3_ACC_AVG64, dev);
 
-            /* Return error if any of the get sensor data fails */
-            if (rslt != BMI3_OK)
+            if (rslt == BMI3_OK)
             {
-                break;
+                /* Validate bandwidth */
+                rslt = check_boundary_val(bandwidth, BMI3_ACC_BW_ODR_HALF, BMI3_ACC_BW_ODR_QUARTER, dev);
             }
         }
     }
@@ -2328,87 +13943,60 @@ int8_t bmi3_set_sensor_config(struct bmi3_sens_config *sens_cfg, uint8_t n_sens,
 }
 
 /*!
- * @brief This API gets the sensor/feature configuration.
+ * @brief This internal API validates ODR and range of the accelerometer set by
+ * the user.
  */
-int8_t bmi3_get_sensor_config(struct bmi3_sens_config *sens_cfg, uint8_t n_sens, struct bmi3_dev *dev)
+static int8_t validate_acc_odr_range(uint8_t *odr, uint8_t *range, struct bmi3_dev *dev)
 {
     /* Variable to store result of API */
     int8_t rslt;
 
-    /* Variable to define loop */
-    uint8_t loop = 0;
-
-    /* Null-pointer check */
-    rslt = null_ptr_check(dev);
-
-    if ((rslt == BMI3_OK) && (sens_cfg != NULL))
+    if ((odr != NULL) && (range != NULL))
     {
-        for (loop = 0; loop < n_sens; loop++)
-        {
-            switch (sens_cfg[loop].type)
-            {
-                case BMI3_ACCEL:
-                    rslt = get_accel_config(&sens_cfg[loop].cfg.acc, dev);
-                    break;
-
-                case BMI3_GYRO:
-                    rslt = get_gyro_config(&sens_cfg[loop].cfg.gyr, dev);
-                    break;
-
-                case BMI3_ANY_MOTION:
-                    rslt = get_any_motion_config(&sens_cfg[loop].cfg.any_motion, dev);
-                    break;
-
-                case BMI3_NO_MOTION:
-                    rslt = get_no_motion_config(&sens_cfg[loop].cfg.no_motion, dev);
-                    break;
-
-                case BMI3_SIG_MOTION:
-                    rslt = get_sig_motion_config(&sens_cfg[loop].cfg.sig_motion, dev);
-                    break;
-
-                case BMI3_FLAT:
-                    rslt = get_flat_config(&sens_cfg[loop].cfg.flat, dev);
-                    break;
-
-                case BMI3_TILT:
-                    rslt = get_tilt_config(&sens_cfg[loop].cfg.tilt, dev);
-                    break;
-
-                case BMI3_ORIENTATION:
-                    rslt = get_orientation_config(&sens_cfg[loop].cfg.orientation, dev);
-                    break;
-
-                case BMI3_STEP_COUNTER:
-                    rslt = get_step_config(&sens_cfg[loop].cfg.step_counter, dev);
-                    break;
+        /* Validate and auto correct ODR */
+        rslt = check_boundary_val(odr, BMI3_ACC_ODR_0_78HZ, BMI3_ACC_ODR_6400HZ, dev);
 
-                case BMI3_TAP:
-                    rslt = get_tap_config(&sens_cfg[loop].cfg.tap, dev);
-                    break;
+        if (rslt == BMI3_OK)
+        {
+            /* Validate and auto correct Range */
+            rslt = check_boundary_val(range, BMI3_ACC_RANGE_2G, BMI3_ACC_RANGE_16G, dev);
+        }
+    }
+    else
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
 
-                case BMI3_ALT_ACCEL:
-                    rslt = get_alternate_accel_config(&sens_cfg[loop].cfg.alt_acc, dev);
-                    break;
+    return rslt;
+}
 
-                case BMI3_ALT_GYRO:
-                    rslt = get_alternate_gyro_config(&sens_cfg[loop].cfg.alt_gyr, dev);
-                    break;
+/*!
+ * @brief This internal API is used to validate the boundary conditions.
+ */
+static int8_t check_boundary_val(uint8_t *val, uint8_t min, uint8_t max, struct bmi3_dev *dev)
+{
+    /* Variable to store result of API */
+    int8_t rslt;
 
-                case BMI3_ALT_AUTO_CONFIG:
-                    rslt = get_alternate_auto_config(&sens_cfg[loop].cfg.alt_auto_cfg, dev);
-                    break;
+    /* Null-pointer check */
+    rslt = null_ptr_check(dev);
 
-                default:
-                    rslt = BMI3_E_INVALID_SENSOR;
-                    break;
-            }
+    if ((rslt == BMI3_OK) && (val != NULL))
+    {
+        /* Check if value is below minimum value */
+        if (*val < min)
+        {
+            /* Auto correct the invalid value to minimum value */
+            *val = min;
+            dev->info |= BMI3_I_MIN_VALUE;
+        }
 
-            /* Return error if any of the get sensor data fails */
-            if (rslt != BMI3_OK)
-            {
-                break;
-            }
+        /* Check if value is above maximum value */
+        if (*val > max)
+        {
+            /* Auto correct the invalid value to maximum value */
+            *val = max;
+            dev->info |= BMI3_I_MAX_VALUE;
         }
     }
     else
@@ -2420,67 +14008,101 @@ int8_t bmi3_get_sensor_config(struct bmi3_sens_config *sens_cfg, uint8_t n_sens,
 }
 
 /*!
- * @brief This API maps/un-maps data interrupts to that of interrupt pins.
+ * @brief This internal API sets gyroscope configurations like ODR,
+ * bandwidth, gyro mode, average samples and dps range.
  */
-int8_t bmi3_map_interrupt(struct bmi3_map_int map_int, struct bmi3_dev *dev)
+static int8_t set_gyro_config(struct bmi3_gyro_config *config, struct bmi3_dev *dev)
 {
     /* Variable to store result of API */
     int8_t rslt;
 
-    /* Variable to store register data */
-    uint8_t reg_data[4] = { 0 };
-    uint16_t temp_value = 0;
+    /* Variable to store data */
+    uint8_t reg_data[2] = { 0 };
 
-    /* Read interrupt map1 and map2 and register */
-    rslt = bmi3_get_regs(BMI3_REG_INT_MAP1, reg_data, 4, dev);
+    uint16_t odr, range, bwp, avg_num, gyr_mode;
 
-    if (rslt == BMI3_OK)
+    if (config != NULL)
     {
-        reg_data[0] = BMI3_SET_BIT_POS0(reg_data[0], BMI3_NO_MOTION_OUT, map_int.no_motion_out);
-        reg_data[0] = BMI3_SET_BITS(reg_data[0], BMI3_ANY_MOTION_OUT, map_int.any_motion_out);
-        reg_data[0] = BMI3_SET_BITS(reg_data[0], BMI3_FLAT_OUT, map_int.flat_out);
-        reg_data[0] = BMI3_SET_BITS(reg_data[0], BMI3_ORIENTATION_OUT, map_int.orientation_out);
+        /* Validate bandwidth, average samples and mode */
+        rslt = validate_bw_avg_gyr_mode(&config->bwp, &config->gyr_mode, &config->avg_num, dev);
 
-        temp_value = (uint16_t)(reg_data[1]) << 8;
-        temp_value = BMI3_SET_BITS(temp_value, BMI3_STEP_DETECTOR_OUT, map_int.step_detector_out);
-        temp_value = BMI3_SET_BITS(temp_value, BMI3_STEP_COUNTER_OUT, map_int.step_counter_out);
-        temp_value = BMI3_SET_BITS(temp_value, BMI3_SIG_MOTION_OUT, map_int.sig_motion_out);
-        temp_value = BMI3_SET_BITS(temp_value, BMI3_TILT_OUT, map_int.tilt_out);
-        reg_data[1] = (uint8_t)(temp_value >> 8);
+        if (rslt == BMI3_OK)
+        {
+            /* Validate ODR and range */
+            rslt = validate_gyr_odr_range(&config->odr, &config->range, dev);
+        }
 
-        reg_data[2] = BMI3_SET_BIT_POS0(reg_data[2], BMI3_TAP_OUT, map_int.tap_out);
-        reg_data[2] = BMI3_SET_BITS(reg_data[2], BMI3_I3C_OUT, map_int.i3c_out);
-        reg_data[2] = BMI3_SET_BITS(reg_data[2], BMI3_ERR_STATUS, map_int.err_status);
-        reg_data[2] = BMI3_SET_BITS(reg_data[2], BMI3_TEMP_DRDY_INT, map_int.temp_drdy_int);
+        if (rslt == BMI3_OK)
+        {
+            if (config->gyr_mode == BMI3_GYR_MODE_LOW_PWR)
+            {
+                rslt = validate_gyr_odr_avg(config->odr, config->avg_num);
+            }
+        }
 
-        temp_value = (uint16_t)(reg_data[3]) << 8;
-        temp_value = BMI3_SET_BITS(temp_value, BMI3_GYR_DRDY_INT, map_int.gyr_drdy_int);
-        temp_value = BMI3_SET_BITS(temp_value, BMI3_ACC_DRDY_INT, map_int.acc_drdy_int);
-        temp_value = BMI3_SET_BITS(temp_value, BMI3_FIFO_WATERMARK_INT, map_int.fifo_watermark_int);
-        temp_value = BMI3_SET_BITS(temp_value, BMI3_FIFO_FULL_INT, map_int.fifo_full_int);
-        reg_data[3] = (uint8_t)(temp_value >> 8);
+        if (rslt == BMI3_OK)
+        {
+            /* Set gyroscope ODR */
+            odr = BMI3_SET_BIT_POS0(reg_data[0], BMI3_GYR_ODR, config->odr);
 
-        rslt = bmi3_set_regs(BMI3_REG_INT_MAP1, reg_data, 4, dev);
+            /* Set gyroscope range */
+            range = BMI3_SET_BITS(reg_data[0], BMI3_GYR_RANGE, config->range);
+
+            /* Set gyroscope bandwidth */
+            bwp = BMI3_SET_BITS(reg_data[0], BMI3_GYR_BW, config->bwp);
+
+            /* Set gyroscope average sample */
+            avg_num = BMI3_SET_BITS(reg_data[1], BMI3_GYR_AVG_NUM, config->avg_num);
+
+            /* Set gyroscope mode */
+            gyr_mode = BMI3_SET_BITS(reg_data[1], BMI3_GYR_MODE, config->gyr_mode);
+
+            reg_data[0] = (uint8_t)(odr | range | bwp);
+            reg_data[1] = (uint8_t)((avg_num | gyr_mode) >> 8);
+
+            /* Set gyro configurations */
+            rslt = bmi3_set_regs(BMI3_REG_GYR_CONF, reg_data, 2, dev);
+        }
+        else
+        {
+            rslt = BMI3_E_GYRO_INVALID_CFG;
+        }
+    }
+    else
+    {
+        rslt = BMI3_E_NULL_PTR;
     }
 
     return rslt;
 }
 
 /*!
- * @brief This API selects the sensors/features to be enabled or disabled.
+ * @brief This internal API validates bandwidth, average samples and gyr mode of the
+ * gyroscope set by the user.
  */
-int8_t bmi3_select_sensor(struct bmi3_feature_enable *enable, struct bmi3_dev *dev)
+static int8_t validate_bw_avg_gyr_mode(uint8_t *bandwidth,
+                                       uint8_t *gyr_mode,
+                                       const uint8_t *avg_num,
+                                       struct bmi3_dev *dev)
 {
     /* Variable to store result of API */
     int8_t rslt;
 
-    if (enable != NULL)
+    if ((bandwidth != NULL) && (gyr_mode != NULL) && (avg_num != NULL))
     {
-        rslt = set_feature_enable(enable, dev);
+        /* Validate and auto-correct gyro mode */
+        rslt = check_boundary_val(gyr_mode, BMI3_GYR_MODE_DISABLE, BMI3_GYR_MODE_HIGH_PERF, dev);
 
         if (rslt == BMI3_OK)
         {
-            rslt = get_feature_enable(enable, dev);
+            /* Validate for averaging mode */
+            rslt = check_boundary_val(bandwidth, BMI3_GYR_AVG1, BMI3_GYR_AVG64, dev);
+
+            if (rslt == BMI3_OK)
+            {
+                /* Validate for bandwidth */
+                rslt = check_boundary_val(bandwidth, BMI3_GYR_BW_ODR_HALF, BMI3_GYR_BW_ODR_QUARTER, dev);
+            }
         }
     }
     else
@@ -2492,94 +14114,73 @@ int8_t bmi3_select_sensor(struct bmi3_feature_enable *enable, struct bmi3_dev *d
 }
 
 /*!
- * @details This API gets the sensor data such as accel, gyro, temperature, sensor time, saturation flags
- * and interrupt status
+ * @brief This internal API validates ODR and range of the gyroscope set by
+ * the user.
  */
-int8_t bmi3_read_reg_data(uint8_t *reg_data, struct bmi3_dev *dev)
+static int8_t validate_gyr_odr_range(uint8_t *odr, uint8_t *range, struct bmi3_dev *dev)
 {
     /* Variable to store result of API */
     int8_t rslt;
 
-    rslt = bmi3_get_regs(BMI3_REG_ACC_DATA_X, reg_data, BMI3_READ_REG_DATA_LEN, dev);
+    if ((odr != NULL) && (range != NULL))
+    {
+        /* Validate and auto correct ODR */
+        rslt = check_boundary_val(odr, BMI3_GYR_ODR_0_78HZ, BMI3_GYR_ODR_6400HZ, dev);
+
+        if (rslt == BMI3_OK)
+        {
+            /* Validate and auto correct Range */
+            rslt = check_boundary_val(range, BMI3_GYR_RANGE_125DPS, BMI3_GYR_RANGE_2000DPS, dev);
+        }
+    }
+    else
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
 
     return rslt;
 }
 
 /*!
- * @brief This API gets the sensor/feature data for accelerometer, gyroscope,
- * step counter, orientation, i3c sync accel, i3c sync gyro and i3c sync temperature.
+ * @brief This internal API stores the accelerometer, sensortime and accel saturation data from the register.
  */
-int8_t bmi3_get_sensor_data(struct bmi3_sensor_data *sensor_data, uint8_t n_sens, struct bmi3_dev *dev)
+static int8_t get_accel_sensortime_sat_data(struct bmi3_sens_axes_data *data, const uint8_t *reg_data)
 {
     /* Variable to store result of API */
-    int8_t rslt;
-
-    /* Variable to define loop */
-    uint8_t loop;
-
-    uint8_t reg_data[BMI3_READ_REG_DATA_LEN];
-
-    /* Null-pointer check */
-    rslt = null_ptr_check(dev);
-
-    if ((rslt == BMI3_OK) && (sensor_data != NULL))
-    {
-        rslt = bmi3_read_reg_data(reg_data, dev);
-
-        if (rslt == BMI3_OK)
-        {
-            for (loop = 0; loop < n_sens; loop++)
-            {
-                switch (sensor_data[loop].type)
-                {
-                    case BMI3_ACCEL:
-                        rslt = get_accel_sensortime_sat_data(&sensor_data[loop].sens_data.acc, reg_data);
-                        break;
+    int8_t rslt = BMI3_OK;
 
-                    case BMI3_GYRO:
-                        rslt = get_gyro_sensortime_sat_data(&sensor_data[loop].sens_data.gyr, reg_data);
-                        break;
+    /* Stores the accel x, y, z axis, sensortime and accel saturation data from register */
+    uint16_t acc_data[6];
 
-                    case BMI3_TEMP:
-                        rslt = get_temp_sensortime_data(&sensor_data[loop].sens_data.temp, reg_data);
-                        break;
+    if ((data != NULL) && (reg_data != NULL))
+    {
+        acc_data[0] = (reg_data[0] | (uint16_t)reg_data[1] << 8);
+        acc_data[1] = (reg_data[2] | (uint16_t)reg_data[3] << 8);
+        acc_data[2] = (reg_data[4] | (uint16_t)reg_data[5] << 8);
+        acc_data[3] = (reg_data[14] | (uint16_t)reg_data[15] << 8);
+        acc_data[4] = (reg_data[16] | (uint16_t)reg_data[17] << 8);
+        acc_data[5] = reg_data[18];
 
-                    case BMI3_STEP_COUNTER:
-                        rslt = get_step_counter_sensor_data(&sensor_data[loop].sens_data.step_counter_output,
-                                                            BMI3_REG_FEATURE_IO2,
-                                                            dev);
-                        break;
+        /* Stores accel x-axis data */
+        data->x = (int16_t)acc_data[0];
 
-                    case BMI3_ORIENTATION:
-                        rslt = get_orient_output_data(&sensor_data[loop].sens_data.orient_output,
-                                                      BMI3_REG_FEATURE_EVENT_EXT,
-                                                      dev);
-                        break;
+        /* Stores accel y-axis data */
+        data->y = (int16_t)acc_data[1];
 
-                    case BMI3_I3C_SYNC_ACCEL:
-                        rslt = get_i3c_sync_accel_sensor_data(&sensor_data[loop].sens_data.i3c_sync, dev);
-                        break;
+        /* Stores accel z-axis data */
+        data->z = (int16_t)acc_data[2];
 
-                    case BMI3_I3C_SYNC_GYRO:
-                        rslt = get_i3c_sync_gyro_sensor_data(&sensor_data[loop].sens_data.i3c_sync, dev);
-                        break;
+        /* Stores sensor time data */
+        data->sens_time = (acc_data[3] | ((uint32_t)acc_data[4] << 16));
 
-                    case BMI3_I3C_SYNC_TEMP:
-                        rslt = get_i3c_sync_temp_data(&sensor_data[loop].sens_data.i3c_sync, dev);
-                        break;
+        /* Stores saturation x-axis data */
+        data->sat_x = (acc_data[5] & BMI3_SATF_ACC_X_MASK);
 
-                    default:
-                        rslt = BMI3_E_INVALID_SENSOR;
-                        break;
-                }
+        /* Stores saturation y-axis data */
+        data->sat_y = (acc_data[5] & BMI3_SATF_ACC_Y_MASK) >> BMI3_SATF_ACC_Y_POS;
 
-                /* Return error if any of the get sensor data fails */
-                if (rslt != BMI3_OK)
-                {
-                    break;
-                }
-            }
-        }
+        /* Stores saturation z-axis data */
+        data->sat_z = (acc_data[5] & BMI3_SATF_ACC_Z_MASK) >> BMI3_SATF_ACC_Z_POS;
     }
     else
     {
@@ -2590,50 +14191,45 @@ int8_t bmi3_get_sensor_data(struct bmi3_sensor_data *sensor_data, uint8_t n_sens
 }
 
 /*!
- *  @brief This API reads the error status from the sensor.
+ * @brief This internal API stores the gyroscope, sensortime and gyro saturation data from the register.
  */
-int8_t bmi3_get_error_status(struct bmi3_err_reg *err_reg, struct bmi3_dev *dev)
+static int8_t get_gyro_sensortime_sat_data(struct bmi3_sens_axes_data *data, const uint8_t *reg_data)
 {
     /* Variable to store result of API */
-    int8_t rslt;
-
-    /* Array variable to get error status from register */
-    uint8_t data[2] = { 0 };
+    int8_t rslt = BMI3_OK;
 
-    uint16_t reg_data;
+    /* Variable to store x, y and z axis gyro data */
+    uint16_t gyr_data[6];
 
-    if (err_reg != NULL)
+    if ((data != NULL) && (reg_data != NULL))
     {
-        /* Read the error codes */
-        rslt = bmi3_get_regs(BMI3_REG_ERR_REG, data, 2, dev);
-
-        if (rslt == BMI3_OK)
-        {
-            reg_data = data[0];
-
-            /* Fatal error */
-            err_reg->fatal_err = BMI3_GET_BIT_POS0(reg_data, BMI3_FATAL_ERR);
+        gyr_data[0] = (reg_data[6] | (uint16_t)reg_data[7] << 8);
+        gyr_data[1] = (reg_data[8] | (uint16_t)reg_data[9] << 8);
+        gyr_data[2] = (reg_data[10] | (uint16_t)reg_data[11] << 8);
+        gyr_data[3] = (reg_data[14] | (uint16_t)reg_data[15] << 8);
+        gyr_data[4] = (reg_data[16] | (uint16_t)reg_data[17] << 8);
+        gyr_data[5] = reg_data[18];
 
-            /* Interrupt request overrun error */
-            err_reg->feat_eng_ovrld = BMI3_GET_BITS(reg_data, BMI3_FEAT_ENG_OVRLD);
+        /* Stores gyro x-axis data */
+        data->x = (int16_t)gyr_data[0];
 
-            /* Indicates watch cell code */
-            err_reg->feat_eng_wd = BMI3_GET_BITS(reg_data, BMI3_FEAT_ENG_WD);
+        /* Stores gyro y-axis data */
+        data->y = (int16_t)gyr_data[1];
 
-            /* Indicates accel configuration error */
-            err_reg->acc_conf_err = BMI3_GET_BITS(reg_data, BMI3_ACC_CONF_ERR);
+        /* Stores gyro z-axis data */
+        data->z = (int16_t)gyr_data[2];
 
-            /* Indicates gyro configuration error */
-            err_reg->gyr_conf_err = BMI3_GET_BITS(reg_data, BMI3_GYR_CONF_ERR);
+        /* Stores sensor time data */
+        data->sens_time = (gyr_data[3] | ((uint32_t)gyr_data[4] << 16));
 
-            reg_data = data[1];
+        /* Stores saturation x-axis data */
+        data->sat_x = (gyr_data[5] & BMI3_SATF_GYR_X_MASK) >> BMI3_SATF_GYR_X_POS;
 
-            /* Indicates SDR parity error */
-            err_reg->i3c_error0 = BMI3_GET_BITS(reg_data, BMI3_I3C_ERROR0);
+        /* Stores saturation y-axis data */
+        data->sat_y = (gyr_data[5] & BMI3_SATF_GYR_Y_MASK) >> BMI3_SATF_GYR_Y_POS;
 
-            /* Indicates I3C error */
-            err_reg->i3c_error3 = BMI3_GET_BITS(reg_data, BMI3_I3C_ERROR3);
-        }
+        /* Stores saturation z-axis data */
+        data->sat_z = (gyr_data[5] & BMI3_SATF_GYR_Z_MASK) >> BMI3_SATF_GYR_Z_POS;
     }
     else
     {
@@ -2644,28 +14240,21 @@ int8_t bmi3_get_error_status(struct bmi3_err_reg *err_reg, struct bmi3_dev *dev)
 }
 
 /*!
- *  @brief This API reads the feature engine error status from the sensor.
+ * @brief This internal API reads the raw temperature data from the register and can be
+ * converted into degree celsius.
  */
-int8_t bmi3_get_feature_engine_error_status(uint8_t *feature_engine_err_reg_lsb,
-                                            uint8_t *feature_engine_err_reg_msb,
-                                            struct bmi3_dev *dev)
+static int8_t get_temp_sensortime_data(struct bmi3_sens_axes_data *data, const uint8_t *reg_data)
 {
     /* Variable to store result of API */
-    int8_t rslt;
-
-    /* Array variable to get error status from register */
-    uint8_t data[2];
+    int8_t rslt = BMI3_OK;
 
-    if ((feature_engine_err_reg_lsb != NULL) && (feature_engine_err_reg_msb != NULL))
+    if ((data != NULL) && (reg_data != NULL))
     {
-        /* Read the feature engine error codes */
-        rslt = bmi3_get_regs(BMI3_REG_FEATURE_IO1, data, 2, dev);
-        if (rslt == BMI3_OK)
-        {
-            *feature_engine_err_reg_lsb = data[0];
+        data->temp_data = (uint16_t)(reg_data[12] | ((uint16_t)reg_data[13] << 8));
 
-            *feature_engine_err_reg_msb = data[1];
-        }
+        /* Stores sensor time data */
+        data->sens_time =
+            (reg_data[14] | (uint16_t)reg_data[15] << 8 | (uint32_t)reg_data[16] << 16 | (uint32_t)reg_data[17] << 24);
     }
     else
     {
@@ -2676,91 +14265,76 @@ int8_t bmi3_get_feature_engine_error_status(uint8_t *feature_engine_err_reg_lsb,
 }
 
 /*!
- * @brief This API sets:
- *        1) The output configuration of the selected interrupt pin:
- *           INT1 or INT2.
- *        2) The interrupt mode: permanently latched or non-latched.
+ * @brief This internal API gets the step counter data from the register.
  */
-int8_t bmi3_set_int_pin_config(const struct bmi3_int_pin_config *int_cfg, struct bmi3_dev *dev)
+static int8_t get_step_counter_sensor_data(uint32_t *step_count, uint8_t reg_addr, struct bmi3_dev *dev)
 {
     /* Variable to store result of API */
     int8_t rslt;
 
-    /* Variable to define data array */
-    uint8_t data_array[3] = { 0 };
-
-    /* Variable to store register data */
-    uint16_t reg_data = 0;
-
-    /* Variable to define type of interrupt pin  */
-    uint8_t int_pin = 0;
-
-    /* Null-pointer check */
-    rslt = null_ptr_check(dev);
+    /* Array to define data stored in register */
+    uint8_t reg_data[4] = { 0 };
 
-    if ((rslt == BMI3_OK) && (int_cfg != NULL))
+    if (step_count != NULL)
     {
-        /* Copy the pin type to a local variable */
-        int_pin = int_cfg->pin_type;
+        /* Read the sensor data */
+        rslt = bmi3_get_regs(reg_addr, reg_data, 4, dev);
 
-        if ((int_pin > BMI3_INT_NONE) && (int_pin < BMI3_INT_PIN_MAX))
+        if (rslt == BMI3_OK)
         {
-            /* Get the previous configuration data */
-            rslt = bmi3_get_regs(BMI3_REG_IO_INT_CTRL, data_array, 3, dev);
-
-            if (rslt == BMI3_OK)
-            {
-                /* Set interrupt pin 1 configuration */
-                if (int_pin == BMI3_INT1)
-                {
-                    reg_data = data_array[0];
-
-                    /* Configure active low or high */
-                    reg_data = BMI3_SET_BIT_POS0(reg_data, BMI3_INT1_LVL, int_cfg->pin_cfg[0].lvl);
-
-                    /* Configure push-pull or open drain */
-                    reg_data = BMI3_SET_BITS(reg_data, BMI3_INT1_OD, int_cfg->pin_cfg[0].od);
-
-                    /* Configure output enable */
-                    reg_data = BMI3_SET_BITS(reg_data, BMI3_INT1_OUTPUT_EN, int_cfg->pin_cfg[0].output_en);
+            *step_count = get_step_counter(reg_data);
+        }
+    }
+    else
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
 
-                    /* Copy the data to be written in the respective array */
-                    data_array[0] = (uint8_t)(reg_data & 0xFF);
-                }
+    return rslt;
+}
 
-                /* Set interrupt pin 2 configuration */
-                if (int_pin == BMI3_INT2)
-                {
-                    reg_data = ((uint16_t)data_array[1] << 8);
+/*!
+ * @brief This internal API gets the step counter output from the register data.
+ */
+static uint32_t get_step_counter(const uint8_t *reg_data)
+{
+    /* Variable to store step counter output */
+    uint32_t step_count;
 
-                    /* Configure active low or high */
-                    reg_data = BMI3_SET_BITS(reg_data, BMI3_INT2_LVL, int_cfg->pin_cfg[1].lvl);
+    /* Get the step counter output in 4 bytes */
+    step_count = (uint32_t) reg_data[0];
+    step_count |= ((uint32_t) reg_data[1] << 8);
+    step_count |= ((uint32_t) reg_data[2] << 16);
+    step_count |= ((uint32_t) reg_data[3] << 24);
 
-                    /* Configure push-pull or open drain */
-                    reg_data = BMI3_SET_BITS(reg_data, BMI3_INT2_OD, int_cfg->pin_cfg[1].od);
+    return step_count;
+}
 
-                    /* Configure output enable */
-                    reg_data = BMI3_SET_BITS(reg_data, BMI3_INT2_OUTPUT_EN, int_cfg->pin_cfg[1].output_en);
+/*!
+ * @brief This internal API gets the output values of orientation: portrait-
+ * landscape and face up-down.
+ */
+static int8_t get_orient_output_data(struct bmi3_orientation_output *orient_out, uint8_t reg_addr, struct bmi3_dev *dev)
+{
+    /* Variable to store result of API */
+    int8_t rslt;
 
-                    /* Copy the data to be written in the respective array */
-                    data_array[1] = (uint8_t)(reg_data >> 8);
-                }
+    /* Array to define data stored in register */
+    uint8_t reg_data[2] = { 0 };
 
-                /* Set the configurations simultaneously as
-                 * INT1_IO_CTRL, INT2_IO_CTRL, and INT_LATCH lie
-                 * in consecutive addresses
-                 */
-                rslt = bmi3_set_regs(BMI3_REG_IO_INT_CTRL, data_array, 2, dev);
+    if (orient_out != NULL)
+    {
+        /* Read the data from feature engine status register */
+        rslt = bmi3_get_regs(reg_addr, reg_data, 2, dev);
 
-                if (rslt == BMI3_OK)
-                {
-                    rslt = set_latch_mode(int_cfg, dev);
-                }
-            }
-        }
-        else
+        if (rslt == BMI3_OK)
         {
-            rslt = BMI3_E_INVALID_INT_PIN;
+            /* Get the output value of the orientation detection feature */
+            orient_out->orientation_portrait_landscape = BMI3_GET_BIT_POS0(reg_data[0],
+                                                                           BMI3_ORIENTATION_PORTRAIT_LANDSCAPE);
+
+            /* Get the output value of the orientation face up-down feature */
+            orient_out->orientation_faceup_down = BMI3_GET_BITS(reg_data[0], BMI3_ORIENTATION_FACEUP_DOWN);
         }
     }
     else
@@ -2772,63 +14346,44 @@ int8_t bmi3_set_int_pin_config(const struct bmi3_int_pin_config *int_cfg, struct
 }
 
 /*!
- * @brief This API gets:
- *        1) The output configuration of the selected interrupt pin:
- *           INT1 or INT2.
- *        2) The interrupt mode: permanently latched or non-latched.
+ * @brief This internal API gets gyroscope configurations like ODR, gyro mode,
+ * bandwidth, averaging samples and range.
  */
-int8_t bmi3_get_int_pin_config(struct bmi3_int_pin_config *int_cfg, struct bmi3_dev *dev)
+static int8_t get_gyro_config(struct bmi3_gyro_config *config, struct bmi3_dev *dev)
 {
     /* Variable to store result of API */
     int8_t rslt;
 
-    /* Variable to define data array */
-    uint8_t data_array[3] = { 0 };
-
-    /* Variable to define type of interrupt pin  */
-    uint8_t int_pin = 0;
+    /* Array to store data */
+    uint8_t data_array[2] = { 0 };
 
     uint16_t reg_data;
 
-    if (int_cfg != NULL)
+    if (config != NULL)
     {
-        /* Copy the pin type to a local variable */
-        int_pin = int_cfg->pin_type;
-
-        /* Get the previous configuration data */
-        rslt = bmi3_get_regs(BMI3_REG_IO_INT_CTRL, data_array, 3, dev);
+        /* Read the sensor configuration details */
+        rslt = bmi3_get_regs(BMI3_REG_GYR_CONF, data_array, 2, dev);
 
         if (rslt == BMI3_OK)
         {
-            /* Get interrupt pin 1 configuration */
-            if (int_pin == BMI3_INT1)
-            {
-                /* Get active low or high */
-                int_cfg->pin_cfg[0].lvl = BMI3_GET_BIT_POS0(data_array[0], BMI3_INT1_LVL);
-
-                /* Get push-pull or open drain */
-                int_cfg->pin_cfg[0].od = BMI3_GET_BITS(data_array[0], BMI3_INT1_OD);
-
-                /* Get output enable */
-                int_cfg->pin_cfg[0].output_en = BMI3_GET_BITS(data_array[0], BMI3_INT1_OUTPUT_EN);
-            }
+            reg_data = data_array[0];
 
-            /* Get interrupt pin 2 configuration */
-            if (int_pin == BMI3_INT2)
-            {
-                reg_data = ((uint16_t)data_array[1] << 8);
+            /* Get gyro ODR */
+            config->odr = BMI3_GET_BIT_POS0(reg_data, BMI3_GYR_ODR);
 
-                /* Get active low or high */
-                int_cfg->pin_cfg[1].lvl = BMI3_GET_BITS(reg_data, BMI3_INT2_LVL);
+            /* Get gyro range */
+            config->range = BMI3_GET_BITS(reg_data, BMI3_GYR_RANGE);
 
-                /* Get push-pull or open drain */
-                int_cfg->pin_cfg[1].od = BMI3_GET_BITS(reg_data, BMI3_INT2_OD);
+            /* Get gyro bandwidth */
+            config->bwp = BMI3_GET_BITS(reg_data, BMI3_GYR_BW);
 
-                /* Get output enable */
-                int_cfg->pin_cfg[1].output_en = BMI3_GET_BITS(reg_data, BMI3_INT2_OUTPUT_EN);
-            }
+            reg_data = (uint16_t)data_array[1] << 8;
 
-            rslt = get_latch_mode(int_cfg, dev);
+            /* Get gyro average sample */
+            config->avg_num = BMI3_GET_BITS(reg_data, BMI3_GYR_AVG_NUM);
+
+            /* Get gyro mode */
+            config->gyr_mode = BMI3_GET_BITS(reg_data, BMI3_GYR_MODE);
         }
     }
     else
@@ -2840,164 +14395,161 @@ int8_t bmi3_get_int_pin_config(struct bmi3_int_pin_config *int_cfg, struct bmi3_
 }
 
 /*!
- * @brief This API is used to get the sensor time.
+ * @brief This internal API is used to validate the device structure pointer for
+ * null conditions.
  */
-int8_t bmi3_get_sensor_time(uint32_t *sensor_time, struct bmi3_dev *dev)
+static int8_t null_ptr_check(const struct bmi3_dev *dev)
 {
-    /* Variable to store result of API */
     int8_t rslt;
 
-    uint8_t reg_data[4] = { 0 };
-
-    if (sensor_time != NULL)
+    if ((dev == NULL) || (dev->read == NULL) || (dev->write == NULL) || (dev->delay_us == NULL))
     {
-        rslt = bmi3_get_regs(BMI3_REG_SENSOR_TIME_0, reg_data, 4, dev);
-        if (rslt == BMI3_OK)
-        {
-            *sensor_time =
-                (uint32_t)(reg_data[0] | (uint32_t)reg_data[1] << 8 | (uint32_t)reg_data[2] << 16 |
-                           (uint32_t)reg_data[3] <<
-                    24);
-        }
+        rslt = BMI3_E_NULL_PTR;
     }
     else
     {
-        rslt = BMI3_E_NULL_PTR;
+        /* Device structure is fine */
+        rslt = BMI3_OK;
     }
 
     return rslt;
 }
 
 /*!
- * @brief This API reads the FIFO data.
+ * @brief This internal API is used to get the enabled feature.
  */
-int8_t bmi3_read_fifo_data(struct bmi3_fifo_frame *fifo, struct bmi3_dev *dev)
+static int8_t get_feature_enable(struct bmi3_feature_enable *enable, struct bmi3_dev *dev)
 {
     /* Variable to store result of API */
-    int8_t rslt;
-
-    /* Array to store FIFO configuration data */
-    uint8_t config_data[2] = { 0 };
+    int8_t rslt = BMI3_OK;
 
-    /* Variable to store FIFO data address */
-    uint8_t reg_addr = BMI3_REG_FIFO_DATA;
+    uint8_t feature[2];
+    uint8_t reg_data;
+    uint16_t feature_config;
 
-    /* Null-pointer check */
-    if (fifo != NULL)
+    if (enable != NULL)
     {
-        /* Get the set FIFO frame configurations */
-        rslt = bmi3_get_regs(BMI3_REG_FIFO_CONF, config_data, 2, dev);
+        rslt = bmi3_get_regs(BMI3_REG_FEATURE_IO0, feature, 2, dev);
 
         if (rslt == BMI3_OK)
         {
-            /* Get sensor enable status, of which the data is to be read */
-            fifo->available_fifo_sens =
-                (uint16_t)(((config_data[0]) | ((uint16_t) config_data[1] << 8)) & BMI3_FIFO_ALL_EN);
+            reg_data = feature[0];
+            enable->no_motion_x_en = BMI3_GET_BIT_POS0(reg_data, BMI3_NO_MOTION_X_EN);
+            enable->no_motion_y_en = BMI3_GET_BITS(reg_data, BMI3_NO_MOTION_Y_EN);
+            enable->no_motion_z_en = BMI3_GET_BITS(reg_data, BMI3_NO_MOTION_Z_EN);
+            enable->any_motion_x_en = BMI3_GET_BITS(reg_data, BMI3_ANY_MOTION_X_EN);
+            enable->any_motion_y_en = BMI3_GET_BITS(reg_data, BMI3_ANY_MOTION_Y_EN);
+            enable->any_motion_z_en = BMI3_GET_BITS(reg_data, BMI3_ANY_MOTION_Z_EN);
+            enable->flat_en = BMI3_GET_BITS(reg_data, BMI3_FLAT_EN);
+            enable->orientation_en = BMI3_GET_BITS(reg_data, BMI3_ORIENTATION_EN);
 
-            if (fifo->length != 0)
-            {
-                /* Read FIFO data */
-                if (dev->intf == BMI3_SPI_INTF)
-                {
-                    reg_addr = (reg_addr | BMI3_SPI_RD_MASK);
-                }
+            feature_config = (uint16_t)feature[1] << 8;
 
-                rslt = dev->read(reg_addr, fifo->data, (uint32_t)fifo->length, dev->intf_ptr);
-            }
-            else
-            {
-                rslt = BMI3_E_COM_FAIL;
-            }
+            enable->step_detector_en = BMI3_GET_BITS(feature_config, BMI3_STEP_DETECTOR_EN);
+            enable->step_counter_en = BMI3_GET_BITS(feature_config, BMI3_STEP_COUNTER_EN);
+            enable->sig_motion_en = BMI3_GET_BITS(feature_config, BMI3_SIG_MOTION_EN);
+            enable->tilt_en = BMI3_GET_BITS(feature_config, BMI3_TILT_EN);
+            enable->tap_detector_s_tap_en = BMI3_GET_BITS(feature_config, BMI3_TAP_DETECTOR_S_TAP_EN);
+            enable->tap_detector_d_tap_en = BMI3_GET_BITS(feature_config, BMI3_TAP_DETECTOR_D_TAP_EN);
+            enable->tap_detector_t_tap_en = BMI3_GET_BITS(feature_config, BMI3_TAP_DETECTOR_T_TAP_EN);
+            enable->i3c_sync_en = BMI3_GET_BITS(feature_config, BMI3_I3C_SYNC_EN);
         }
     }
-    else
-    {
-        rslt = BMI3_E_NULL_PTR;
-    }
 
     return rslt;
 }
 
 /*!
- * @brief This API parses and extracts the accelerometer frames from FIFO data
- * read by the "bmi3_read_fifo_data" API and stores it in the "accel_data"
- * structure instance.
+ * @brief This internal API is used to set the feature.
  */
-int8_t bmi3_extract_accel(struct bmi3_fifo_sens_axes_data *accel_data,
-                          struct bmi3_fifo_frame *fifo,
-                          const struct bmi3_dev *dev)
+static int8_t set_feature_enable(const struct bmi3_feature_enable *enable, struct bmi3_dev *dev)
 {
     /* Variable to store result of API */
     int8_t rslt;
 
-    /* Variable to index the bytes */
-    uint16_t data_index = 0;
-
-    /* Variable to index accelerometer frames */
-    uint16_t accel_index = 0;
+    uint8_t feature[2] = { 0 };
+    uint8_t get_feature[2];
 
-    /* Variable to define the data enable byte */
-    uint16_t data_enable = 0;
+    /* Array variable to clear feature before enabling into register */
+    uint8_t reset[2] = { 0 };
 
-    rslt = null_ptr_check(dev);
+    /* Array to set feature_engine_gp_status in order to enable the feature */
+    uint8_t gp_status[2] = { 1, 0 };
 
-    /* Null-pointer check */
-    if ((rslt == BMI3_OK) && (accel_data != NULL) && (fifo != NULL))
+    if (enable != NULL)
     {
-        data_index = dev->dummy_byte;
-
-        /* Convert word to byte since all sensor enables are in a byte */
-        data_enable = fifo->available_fifo_sens & BMI3_FIFO_HEAD_LESS_ACC_FRM;
+        rslt = bmi3_get_regs(BMI3_REG_FEATURE_IO0, get_feature, 2, dev);
 
-        for (; (data_index < fifo->length);)
+        if (rslt == BMI3_OK)
         {
-            rslt = check_data_index(data_index, fifo);
+            feature[0] =
+                (uint8_t)(BMI3_SET_BIT_POS0(get_feature[0], BMI3_NO_MOTION_X_EN,
+                                            enable->no_motion_x_en) & BMI3_NO_MOTION_X_EN_MASK);
+            feature[0] |=
+                (uint8_t)(BMI3_SET_BITS(get_feature[0], BMI3_NO_MOTION_Y_EN,
+                                        enable->no_motion_y_en) & BMI3_NO_MOTION_Y_EN_MASK);
+            feature[0] |=
+                (uint8_t)(BMI3_SET_BITS(get_feature[0], BMI3_NO_MOTION_Z_EN,
+                                        enable->no_motion_z_en) & BMI3_NO_MOTION_Z_EN_MASK);
+            feature[0] |=
+                (uint8_t)(BMI3_SET_BITS(get_feature[0], BMI3_ANY_MOTION_X_EN,
+                                        enable->any_motion_x_en) & BMI3_ANY_MOTION_X_EN_MASK);
+            feature[0] |=
+                (uint8_t)(BMI3_SET_BITS(get_feature[0], BMI3_ANY_MOTION_Y_EN,
+                                        enable->any_motion_y_en) & BMI3_ANY_MOTION_Y_EN_MASK);
+            feature[0] |=
+                (uint8_t)(BMI3_SET_BITS(get_feature[0], BMI3_ANY_MOTION_Z_EN,
+                                        enable->any_motion_z_en) & BMI3_ANY_MOTION_Z_EN_MASK);
+            feature[0] |= (uint8_t)(BMI3_SET_BITS(get_feature[0], BMI3_FLAT_EN, enable->flat_en) & BMI3_FLAT_EN_MASK);
+            feature[0] |=
+                (uint8_t)(BMI3_SET_BITS(get_feature[0], BMI3_ORIENTATION_EN,
+                                        enable->orientation_en) & BMI3_ORIENTATION_EN_MASK);
 
-            if (rslt == BMI3_OK)
-            {
-                /* Unpack frame to get the accelerometer data */
-                rslt = unpack_fifo_data_frame(accel_data, &data_index, &accel_index, data_enable, fifo);
-            }
+            feature[1] =
+                (uint8_t)((BMI3_SET_BITS(get_feature[1], BMI3_STEP_DETECTOR_EN,
+                                         enable->step_detector_en) & BMI3_STEP_DETECTOR_EN_MASK) >> 8);
+            feature[1] |=
+                (uint8_t)((BMI3_SET_BITS(get_feature[1], BMI3_STEP_COUNTER_EN,
+                                         enable->step_counter_en) & BMI3_STEP_COUNTER_EN_MASK) >> 8);
+            feature[1] |=
+                (uint8_t)((BMI3_SET_BITS(get_feature[1], BMI3_SIG_MOTION_EN,
+                                         enable->sig_motion_en) & BMI3_SIG_MOTION_EN_MASK) >> 8);
 
-            if (rslt != BMI3_W_PARTIAL_READ)
-            {
-                if (fifo->available_fifo_sens == BMI3_FIFO_HEAD_LESS_ACC_FRM)
-                {
-                    data_index = data_index + BMI3_LENGTH_FIFO_ACC;
-                }
+            feature[1] |=
+                (uint8_t)((BMI3_SET_BITS(get_feature[1], BMI3_TILT_EN, enable->tilt_en) & BMI3_TILT_EN_MASK) >> 8);
 
-                /* If gyro enable with the accel, increment the accel index by 6
-                 * since gyro frame has 6 bytes of data
-                 */
-                if (fifo->available_fifo_sens & BMI3_FIFO_HEAD_LESS_GYR_FRM)
-                {
-                    data_index = data_index + BMI3_LENGTH_FIFO_GYR;
-                }
+            feature[1] |=
+                (uint8_t)((BMI3_SET_BITS(get_feature[1], BMI3_TAP_DETECTOR_S_TAP_EN,
+                                         enable->tap_detector_s_tap_en) & BMI3_TAP_DETECTOR_S_TAP_EN_MASK) >> 8);
 
-                /* If sensor time enable with the accel, increment the accel index by 2
-                 * since sensor time frame has 2 bytes of data
-                 */
-                if (fifo->available_fifo_sens & BMI3_FIFO_HEAD_LESS_SENS_TIME_FRM)
-                {
-                    data_index = data_index + BMI3_LENGTH_SENSOR_TIME;
-                }
+            feature[1] |=
+                (uint8_t)((BMI3_SET_BITS(get_feature[1], BMI3_TAP_DETECTOR_D_TAP_EN,
+                                         enable->tap_detector_d_tap_en) & BMI3_TAP_DETECTOR_D_TAP_EN_MASK) >> 8);
 
-                /* If temperature enable with the accel, increment the accel index by 2
-                 * since temperature frame has 2 bytes of data
-                 */
-                if (fifo->available_fifo_sens & BMI3_FIFO_HEAD_LESS_TEMP_FRM)
-                {
-                    data_index = data_index + BMI3_LENGTH_TEMPERATURE;
-                }
+            feature[1] |=
+                (uint8_t)((BMI3_SET_BITS(get_feature[1], BMI3_TAP_DETECTOR_T_TAP_EN,
+                                         enable->tap_detector_t_tap_en) & BMI3_TAP_DETECTOR_T_TAP_EN_MASK) >> 8);
+
+            feature[1] |=
+                (uint8_t)((BMI3_SET_BITS(get_feature[1], BMI3_I3C_SYNC_EN,
+                                         enable->i3c_sync_en) & BMI3_I3C_SYNC_EN_MASK) >> 8);
+
+            begin_batch(dev);
+
+            /* Reset the register before updating new values */
+            rslt = bmi3_set_regs(BMI3_REG_FEATURE_IO0, reset, 2, dev);
+
+            if (rslt == BMI3_OK)
+            {
+                rslt = bmi3_set_regs(BMI3_REG_FEATURE_IO0, feature, 2, dev);
             }
-        }
 
-        /* Update number of accelerometer frames to be read */
-        (fifo->avail_fifo_accel_frames) = accel_index;
+            if (rslt == BMI3_OK)
+            {
+                rslt = bmi3_set_regs(BMI3_REG_FEATURE_IO_STATUS, gp_status, 2, dev);
+            }
 
-        if (fifo->avail_fifo_accel_frames != 0)
-        {
-            rslt = BMI3_OK;
+            rslt = end_batch(rslt, dev);
         }
     }
     else
@@ -3009,80 +14561,54 @@ int8_t bmi3_extract_accel(struct bmi3_fifo_sens_axes_data *accel_data,
 }
 
 /*!
- * @brief This API parses and extracts the temperature frames from FIFO data
- * read by the "bmi3_read_fifo_data" API and stores it in the "temp_data"
- * structure instance.
+ * @brief This internal API gets the latch mode from register address
  */
-int8_t bmi3_extract_temperature(struct bmi3_fifo_temperature_data *temp_data,
-                                struct bmi3_fifo_frame *fifo,
-                                const struct bmi3_dev *dev)
+static int8_t get_latch_mode(struct bmi3_int_pin_config *int_cfg, struct bmi3_dev *dev)
 {
     /* Variable to store result of API */
     int8_t rslt;
 
-    /* Variable to index the bytes */
-    uint16_t data_index = 0;
-
-    /* Variable to index temperature frames */
-    uint16_t temp_index = 0;
-
-    /* Variable to define the data enable byte */
-    uint16_t data_enable = 0;
-
-    rslt = null_ptr_check(dev);
+    /* Variable to define data array */
+    uint8_t data_array[2] = { 0 };
 
-    /* Null-pointer check */
-    if ((rslt == BMI3_OK) && (temp_data != NULL) && (fifo != NULL))
+    if (int_cfg != NULL)
     {
-        data_index = dev->dummy_byte;
-
-        /* Convert word to byte since all sensor enables are in a byte */
-        data_enable = fifo->available_fifo_sens & BMI3_FIFO_HEAD_LESS_TEMP_FRM;
+        rslt = bmi3_get_regs(BMI3_REG_INT_CONF, data_array, 2, dev);
 
-        for (; (data_index < fifo->length);)
+        if (rslt == BMI3_OK)
         {
-            /* If accel enable with the temperature, increment the temperature index by 6
-             * since accel frame has 6 bytes of data
-             */
-            if (fifo->available_fifo_sens & BMI3_FIFO_HEAD_LESS_ACC_FRM)
-            {
-                data_index = data_index + BMI3_LENGTH_FIFO_ACC;
-            }
-
-            /* If gyro enable with the temperature, increment the temperature index by 6
-             * since gyro frame has 6 bytes of data
-             */
-            if (fifo->available_fifo_sens & BMI3_FIFO_HEAD_LESS_GYR_FRM)
-            {
-                data_index = data_index + BMI3_LENGTH_FIFO_GYR;
-            }
+            int_cfg->int_latch = BMI3_GET_BIT_POS0(data_array[0], BMI3_INT_LATCH);
+        }
+    }
+    else
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
 
-            rslt = check_data_index(data_index, fifo);
+    return rslt;
+}
 
-            if (rslt == BMI3_OK)
-            {
-                /* Unpack frame to get the temperature data */
-                rslt = unpack_fifo_data_frame(temp_data, &data_index, &temp_index, data_enable, fifo);
-            }
+/*!
+ * @brief This internal API sets the latch mode to register address
+ */
+static int8_t set_latch_mode(const struct bmi3_int_pin_config *int_cfg, struct bmi3_dev *dev)
+{
+    /* Variable to store result of API */
+    int8_t rslt;
 
-            if (rslt != BMI3_W_PARTIAL_READ)
-            {
-                /* If sensor time enable with the temperature, increment the temperature index by 2
-                 * since sensor time frame has 2 bytes of data
-                 */
-                if (fifo->available_fifo_sens & BMI3_FIFO_HEAD_LESS_SENS_TIME_FRM)
-                {
-                    data_index = data_index + BMI3_LENGTH_SENSOR_TIME;
-                }
-            }
-        }
+    /* Variable to define data array */
+    uint8_t data_array[2] = { 0 };
 
-        /* Update number of temperature frames to be read */
-        (fifo->avail_fifo_temp_frames) = temp_index;
+    if (int_cfg != NULL)
+    {
+        rslt = bmi3_get_regs(BMI3_REG_INT_CONF, data_array, 2, dev);
 
-        if (fifo->avail_fifo_temp_frames != 0)
+        if (rslt == BMI3_OK)
         {
-            rslt = BMI3_OK;
+            /* Configure the interrupt mode */
+            data_array[0] = BMI3_SET_BIT_POS0(data_array[0], BMI3_INT_LATCH, int_cfg->int_latch);
+
+            rslt = bmi3_set_regs(BMI3_REG_INT_CONF, data_array, 2, dev);
         }
     }
     else
@@ -3094,864 +14620,1189 @@ int8_t bmi3_extract_temperature(struct bmi3_fifo_temperature_data *temp_data,
 }
 
 /*!
- * @brief This API parses and extracts the gyro frames from FIFO data
- * read by the "bmi3_read_fifo_data" API and stores it in the "gyro_data"
- * structure instance.
+ * @brief This internal API gets the codec of a feature engine configuration.
  */
-int8_t bmi3_extract_gyro(struct bmi3_fifo_sens_axes_data *gyro_data,
-                         struct bmi3_fifo_frame *fifo,
-                         const struct bmi3_dev *dev)
+static const struct bmi3_feature_codec *get_feature_codec(uint8_t type)
 {
-    /* Variable to store result of API */
-    int8_t rslt;
-
-    /* Variable to index the bytes */
-    uint16_t data_index = 0;
-
-    /* Variable to index gyro frames */
-    uint16_t gyro_index = 0;
+    /* Variable to define loop */
+    uint8_t loop;
 
-    /* Variable to define the data enable byte */
-    uint16_t data_enable = 0;
+    /* Number of features handled */
+    uint8_t n_codecs = (uint8_t)(sizeof(bmi3_feature_codecs) / sizeof(bmi3_feature_codecs[0]));
 
-    rslt = null_ptr_check(dev);
+    const struct bmi3_feature_codec *codec = NULL;
 
-    /* Null-pointer check */
-    if ((rslt == BMI3_OK) && (gyro_data != NULL) && (fifo != NULL))
+    for (loop = 0; (loop < n_codecs) && (codec == NULL); loop++)
     {
-        data_index = dev->dummy_byte;
-
-        /* Convert word to byte since all sensor enables are in a byte */
-        data_enable = fifo->available_fifo_sens & BMI3_FIFO_HEAD_LESS_GYR_FRM;
-
-        for (; (data_index < fifo->length);)
+        if (bmi3_feature_codecs[loop].type == type)
         {
-            if (fifo->available_fifo_sens & BMI3_FIFO_HEAD_LESS_ACC_FRM)
-            {
-                data_index = data_index + BMI3_LENGTH_FIFO_ACC;
-            }
+            codec = &bmi3_feature_codecs[loop];
+        }
+    }
 
-            rslt = check_data_index(data_index, fifo);
+    return codec;
+}
 
-            if (rslt == BMI3_OK)
-            {
-                /* Unpack frame to get the gyro data */
-                rslt = unpack_fifo_data_frame(gyro_data, &data_index, &gyro_index, data_enable, fifo);
-            }
+/*!
+ * @brief This internal API decodes the fields of a feature configuration from
+ * the words of the feature engine.
+ */
+static void unpack_feature_fields(const uint8_t *data, const struct bmi3_feature_codec *codec, void *config)
+{
+    /* Variable to define loop */
+    uint8_t loop;
 
-            if (rslt != BMI3_W_PARTIAL_READ)
-            {
-                if (fifo->available_fifo_sens == BMI3_FIFO_HEAD_LESS_GYR_FRM)
-                {
-                    data_index = data_index + BMI3_LENGTH_FIFO_GYR;
-                }
+    const struct bmi3_feature_field *field;
+    uint8_t *member;
+    uint16_t word;
+    uint16_t value;
 
-                /* If sensor time enable with the gyro, increment the sensor time index by 2
-                 * since sensor time frame has 2 bytes of data
-                 */
-                if (fifo->available_fifo_sens & BMI3_FIFO_HEAD_LESS_SENS_TIME_FRM)
-                {
-                    data_index = data_index + BMI3_LENGTH_SENSOR_TIME;
-                }
+    for (loop = 0; loop < codec->n_fields; loop++)
+    {
+        field = &codec->fields[loop];
+        member = (uint8_t *)config + field->offset;
+        word = (uint16_t)(data[field->word * 2] | ((uint16_t)data[(field->word * 2) + 1] << 8));
+        value = (uint16_t)((word & field->mask) >> field->pos);
 
-                /* If temperature enable with the gyro, increment the temperature index by 2
-                 * since temperature frame has 2 bytes of data
-                 */
-                if (fifo->available_fifo_sens & BMI3_FIFO_HEAD_LESS_TEMP_FRM)
-                {
-                    data_index = data_index + BMI3_LENGTH_TEMPERATURE;
-                }
-            }
+        if (field->size == 1)
+        {
+            *member = (uint8_t)value;
         }
-
-        /* Update number of gyro frames to be read */
-        (fifo->avail_fifo_gyro_frames) = gyro_index;
-
-        if (fifo->avail_fifo_gyro_frames != 0)
+        else
         {
-            rslt = BMI3_OK;
+            *(uint16_t *)(void *)member = value;
         }
     }
-    else
+}
+
+/*!
+ * @brief This internal API encodes the fields of a feature configuration into
+ * the words of the feature engine.
+ */
+static void pack_feature_fields(const void *config, const struct bmi3_feature_codec *codec, uint8_t *data)
+{
+    /* Variable to define loop */
+    uint8_t loop;
+
+    const struct bmi3_feature_field *field;
+    const uint8_t *member;
+    uint16_t value;
+    uint16_t word;
+
+    for (loop = 0; loop < (codec->n_words * 2); loop++)
     {
-        rslt = BMI3_E_NULL_PTR;
+        data[loop] = 0;
     }
 
-    return rslt;
+    for (loop = 0; loop < codec->n_fields; loop++)
+    {
+        field = &codec->fields[loop];
+        member = (const uint8_t *)config + field->offset;
+        value = (field->size == 1) ? *member : *(const uint16_t *)(const void *)member;
+        word = (uint16_t)(data[field->word * 2] | ((uint16_t)data[(field->word * 2) + 1] << 8));
+        word |= (uint16_t)((value << field->pos) & field->mask);
+        data[field->word * 2] = (uint8_t)word;
+        data[(field->word * 2) + 1] = (uint8_t)(word >> 8);
+    }
 }
 
 /*!
- * @brief This API sets the FIFO water-mark level in words.
+ * @brief This internal API checks the accel configuration against the minimum
+ * low-power ODR needed by a feature.
  */
-int8_t bmi3_set_fifo_wm(uint16_t fifo_wm, struct bmi3_dev *dev)
+static int8_t check_feature_accel_config(const struct bmi3_feature_codec *codec, struct bmi3_dev *dev)
 {
     /* Variable to store result of API */
-    int8_t rslt;
-
-    /* Array to store data */
-    uint8_t data[2] = { 0 };
-
-    uint16_t fifo_watermark = fifo_wm & BMI3_FIFO_WATERMARK_MASK;
+    int8_t rslt = BMI3_OK;
 
-    /* Get LSB value of FIFO water-mark */
-    data[0] = BMI3_GET_LSB(fifo_watermark);
+    struct bmi3_accel_config acc_config = { 0 };
 
-    /* Get MSB value of FIFO water-mark */
-    data[1] = BMI3_GET_MSB(fifo_watermark);
+    /* Accel configuration is not checked when only the feature engine image is encoded */
+    if ((dev != NULL) && (codec->lp_min_odr != 0))
+    {
+        rslt = get_accel_config(&acc_config, dev);
 
-    /* Set the FIFO water-mark level */
-    rslt = bmi3_set_regs(BMI3_REG_FIFO_WATERMARK, data, BMI3_LENGTH_FIFO_WM, dev);
+        if ((rslt == BMI3_OK) && (acc_config.acc_mode == BMI3_ACC_MODE_LOW_PWR) &&
+            (acc_config.odr < codec->lp_min_odr))
+        {
+            rslt = BMI3_E_ACC_INVALID_CFG;
+        }
+    }
 
     return rslt;
 }
 
 /*!
- * @brief This API reads the FIFO water-mark level in words.
+ * @brief This internal API gets the configuration of a feature from the
+ * feature engine.
  */
-int8_t bmi3_get_fifo_wm(uint16_t *fifo_wm, struct bmi3_dev *dev)
+static int8_t get_feature_config(struct bmi3_sens_config *sens_cfg, struct bmi3_dev *dev)
 {
     /* Variable to store result of API */
     int8_t rslt;
 
-    /* Array to to store data */
-    uint8_t data[2] = { 0 };
+    /* Array to define the feature configuration */
+    uint8_t data[BMI3_FEATURE_CODEC_MAX_WORDS * 2];
 
-    if (fifo_wm != NULL)
+    const struct bmi3_feature_codec *codec = get_feature_codec(sens_cfg->type);
+
+    if (codec != NULL)
     {
-        /* Read the FIFO water-mark level */
-        rslt = bmi3_get_regs(BMI3_REG_FIFO_WATERMARK, data, BMI3_LENGTH_FIFO_WM, dev);
+        rslt = get_feature_words(codec->base_addr, data, (uint16_t)(codec->n_words * 2), dev);
 
         if (rslt == BMI3_OK)
         {
-            (*fifo_wm) = (uint16_t)((data[0] | (uint16_t) data[1] << 8));
+            unpack_feature_fields(data, codec, &sens_cfg->cfg);
         }
     }
     else
     {
-        rslt = BMI3_E_NULL_PTR;
+        rslt = BMI3_E_INVALID_SENSOR;
     }
 
     return rslt;
 }
 
 /*!
- * @brief This API sets the FIFO configuration in the sensor.
+ * @brief This internal API gets the layout of a headerless FIFO frame.
  */
-int8_t bmi3_set_fifo_config(uint16_t config, uint8_t enable, struct bmi3_dev *dev)
+static const struct bmi3_fifo_frame_layout *get_fifo_frame_layout(uint16_t available_fifo_sens)
+{
+    return &bmi3_fifo_frame_layouts[(available_fifo_sens & BMI3_FIFO_ALL_EN) >> BMI3_FIFO_LAYOUT_POS];
+}
+
+/*!
+ * @brief This internal API selects the frame layout to parse the FIFO data.
+ */
+static const struct bmi3_fifo_frame_layout *select_fifo_frame_layout(const struct bmi3_fifo_frame *fifo)
+{
+    /* Pointer to the layout of the frame */
+    const struct bmi3_fifo_frame_layout *layout = fifo->layout;
+
+    /* Select the layout again if FIFO configuration was changed after reading the FIFO data */
+    if ((layout == NULL) || (layout->fifo_sens != (fifo->available_fifo_sens & BMI3_FIFO_ALL_EN)))
+    {
+        layout = get_fifo_frame_layout(fifo->available_fifo_sens);
+    }
+
+    return layout;
+}
+
+/*!
+ * @brief This internal API gets the index of the end of valid FIFO data.
+ */
+static uint16_t get_fifo_data_end(const struct bmi3_fifo_frame *fifo, const struct bmi3_dev *dev)
+{
+    /* Variable to store the end of valid FIFO data */
+    uint32_t data_end;
+
+    /* Valid FIFO data starts after the dummy bytes and is limited by the bytes read */
+    data_end = (uint32_t)dev->dummy_byte + ((uint32_t)fifo->available_fifo_len * 2);
+
+    if (data_end > fifo->length)
+    {
+        data_end = fifo->length;
+    }
+
+    return (uint16_t)data_end;
+}
+
+/*!
+ * @brief This internal API parses the accelerometer or gyro frames from the FIFO
+ * data into separate x, y, z and sensor time arrays.
+ */
+static int8_t parse_fifo_axes_planes(const struct bmi3_fifo_sens_axes_planes *planes,
+                                     uint16_t sens_sel,
+                                     uint16_t *frame_count,
+                                     const struct bmi3_fifo_frame *fifo,
+                                     const struct bmi3_dev *dev)
 {
     /* Variable to store result of API */
-    int8_t rslt;
+    int8_t rslt = BMI3_W_FIFO_INVALID_FRAME;
 
-    /* Array variable to store fifo config data */
-    uint8_t data[2] = { 0 };
+    /* Pointer to the layout of the frame */
+    const struct bmi3_fifo_frame_layout *layout = select_fifo_frame_layout(fifo);
 
-    /* Variable to store data of FIFO configuration register */
-    uint16_t fifo_config = config & BMI3_FIFO_CONFIG_MASK;
+    /* Variable to store the end of valid FIFO data */
+    uint16_t data_end = get_fifo_data_end(fifo, dev);
 
-    rslt = bmi3_get_regs(BMI3_REG_FIFO_CONF, data, 2, dev);
+    /* Variable to store the number of complete frames */
+    uint16_t full_frames;
 
-    if (rslt == BMI3_OK)
+    /* Variable to index the bytes of the incomplete frame at the end */
+    uint16_t tail_index;
+
+    /* Variable to store byte offset of the sensor in the frame */
+    uint8_t sens_offset;
+
+    /* Variables to store dummy frame value and its warning for the sensor */
+    uint16_t dummy_frame;
+    int8_t dummy_rslt;
+
+    /* Variable to index frames */
+    uint16_t frame_index = 0;
+
+    /* Structure instance to store the arrays for the incomplete frame at the end */
+    struct bmi3_fifo_sens_axes_planes tail_planes;
+
+    /* Function pointer to unpack the complete frames */
+    bmi3_fifo_unpack_axes_fptr_t unpack_axes = unpack_axes_planes;
+
+    /* Pointer to the correction of the sensor */
+    const struct bmi3_axes_correction *corr;
+
+    /* Variable to loop through the unpacked frames */
+    uint16_t loop;
+
+    if (sens_sel == BMI3_FIFO_HEAD_LESS_ACC_FRM)
     {
-        if (enable == BMI3_ENABLE)
+        sens_offset = layout->acc_offset;
+        dummy_frame = BMI3_FIFO_ACCEL_DUMMY_FRAME;
+        dummy_rslt = BMI3_W_FIFO_ACCEL_DUMMY_FRAME;
+        corr = dev->acc_corr;
+    }
+    else
+    {
+        sens_offset = layout->gyr_offset;
+        dummy_frame = BMI3_FIFO_GYRO_DUMMY_FRAME;
+        dummy_rslt = BMI3_W_FIFO_GYRO_DUMMY_FRAME;
+        corr = dev->gyr_corr;
+    }
+
+    if ((sens_offset != BMI3_FIFO_NO_DATA) && (data_end > dev->dummy_byte))
+    {
+        full_frames = (uint16_t)((data_end - dev->dummy_byte) / layout->frame_len);
+
+        /* Use the platform specific (e.g. vectorized) unpack function if provided */
+        if (dev->fifo_unpack_axes != NULL)
         {
-            data[0] = data[0] | (uint8_t)fifo_config;
-            data[1] = data[1] | (uint8_t)(fifo_config >> 8);
+            unpack_axes = dev->fifo_unpack_axes;
         }
-        else
+
+        if (full_frames != 0)
         {
-            data[0] = data[0] & (~fifo_config);
-            data[1] = data[1] & (~(fifo_config >> 8));
+            frame_index = unpack_axes(&fifo->data[dev->dummy_byte],
+                                      full_frames,
+                                      layout->frame_len,
+                                      sens_offset,
+                                      layout->sens_time_offset,
+                                      dummy_frame,
+                                      planes);
+
+            rslt = dummy_rslt;
         }
 
-        rslt = bmi3_set_regs(BMI3_REG_FIFO_CONF, data, 2, dev);
+        /* Sensor data of the incomplete frame at the end is valid if it is read completely,
+         * even though sensor time is not available
+         */
+        tail_index = (uint16_t)(dev->dummy_byte + (full_frames * layout->frame_len));
+
+        if ((tail_index + sens_offset + BMI3_LENGTH_FIFO_ACC) <= data_end)
+        {
+            tail_planes.x = &planes->x[frame_index];
+            tail_planes.y = &planes->y[frame_index];
+            tail_planes.z = &planes->z[frame_index];
+            tail_planes.sensor_time = (planes->sensor_time != NULL) ? &planes->sensor_time[frame_index] : NULL;
+
+            frame_index += unpack_axes_planes(&fifo->data[tail_index],
+                                              1,
+                                              layout->frame_len,
+                                              sens_offset,
+                                              BMI3_FIFO_NO_DATA,
+                                              dummy_frame,
+                                              &tail_planes);
+
+            rslt = dummy_rslt;
+        }
+        else if (tail_index < data_end)
+        {
+            rslt = BMI3_W_PARTIAL_READ;
+        }
+
+        if (corr != NULL)
+        {
+            for (loop = 0; loop < frame_index; loop++)
+            {
+                correct_axes(&planes->x[loop], &planes->y[loop], &planes->z[loop], corr);
+            }
+        }
+    }
+
+    *frame_count = frame_index;
+
+    if (frame_index != 0)
+    {
+        rslt = BMI3_OK;
     }
 
     return rslt;
 }
 
 /*!
- * @brief This API reads the FIFO configuration from the sensor.
+ * @brief This internal API is the portable implementation to unpack accelerometer or
+ * gyro data of complete FIFO frames into separate arrays.
  */
-int8_t bmi3_get_fifo_config(uint16_t *fifo_config, struct bmi3_dev *dev)
+static uint16_t unpack_axes_planes(const uint8_t *frames,
+                                   uint16_t frame_count,
+                                   uint8_t frame_len,
+                                   uint8_t axes_offset,
+                                   uint8_t sens_time_offset,
+                                   uint16_t dummy_frame,
+                                   const struct bmi3_fifo_sens_axes_planes *planes)
 {
-    /* Variable to store result of API */
-    int8_t rslt;
+    /* Pointer to the sensor data of the frame */
+    const uint8_t *data = &frames[axes_offset];
 
-    /* Array to store data */
-    uint8_t data[2] = { 0 };
+    /* Variable to store the x-axis data */
+    uint16_t data_x;
 
-    if (fifo_config != NULL)
+    /* Variable to loop through the frames */
+    uint16_t loop;
+
+    /* Variable to index output arrays */
+    uint16_t out_index = 0;
+
+    for (loop = 0; loop < frame_count; loop++)
     {
-        /* Get the FIFO configuration value */
-        rslt = bmi3_get_regs(BMI3_REG_FIFO_CONF, data, 2, dev);
+        data_x = (uint16_t)(((uint16_t)data[1] << 8) | data[0]);
 
-        if (rslt == BMI3_OK)
+        /* Dummy frames are dropped */
+        if (data_x != dummy_frame)
         {
-            (*fifo_config) = ((data[0] & BMI3_FIFO_CONFIG_MASK) | (((uint16_t)data[1] << 8) & BMI3_FIFO_CONFIG_MASK));
+            planes->x[out_index] = (int16_t)data_x;
+            planes->y[out_index] = (int16_t)(((uint16_t)data[3] << 8) | data[2]);
+            planes->z[out_index] = (int16_t)(((uint16_t)data[5] << 8) | data[4]);
+
+            if (planes->sensor_time != NULL)
+            {
+                if (sens_time_offset != BMI3_FIFO_NO_DATA)
+                {
+                    planes->sensor_time[out_index] =
+                        (uint32_t)(((uint16_t)data[sens_time_offset - axes_offset + 1] << 8) |
+                                   data[sens_time_offset - axes_offset]);
+                }
+                else
+                {
+                    planes->sensor_time[out_index] = 0;
+                }
+            }
+
+            out_index++;
         }
-    }
-    else
-    {
-        rslt = BMI3_E_NULL_PTR;
+
+        data += frame_len;
     }
 
-    return rslt;
+    return out_index;
 }
 
 /*!
- * @brief This API gets the length of FIFO data available in the sensor in
- * words.
+ * @brief This internal API unpacks accelerometer or gyro data of complete FIFO
+ * frames into the structure array with the platform specific function.
  */
-int8_t bmi3_get_fifo_length(uint16_t *fifo_avail_len, struct bmi3_dev *dev)
+static uint16_t unpack_axes_frames(struct bmi3_fifo_sens_axes_data *data,
+                                   uint16_t data_index,
+                                   uint16_t frame_count,
+                                   uint16_t sens_sel,
+                                   const struct bmi3_fifo_frame_layout *layout,
+                                   const struct bmi3_fifo_frame *fifo,
+                                   const struct bmi3_dev *dev)
 {
-    /* Variable to store result of API */
-    int8_t rslt;
+    /* Variable to store the number of frames stored */
+    uint16_t out_count;
 
-    /* Variable to define byte index */
-    uint16_t reg_data;
+    /* Pointer to the correction of the sensor */
+    const struct bmi3_axes_correction *corr;
 
-    /* Array to store FIFO data length */
-    uint8_t data[BMI3_LENGTH_FIFO_DATA] = { 0 };
+    /* Variable to loop through the unpacked frames */
+    uint16_t loop;
 
-    if (fifo_avail_len != NULL)
+    if (sens_sel == BMI3_FIFO_HEAD_LESS_ACC_FRM)
     {
-        /* Read FIFO length */
-        rslt = bmi3_get_regs(BMI3_REG_FIFO_FILL_LEVEL, data, BMI3_LENGTH_FIFO_DATA, dev);
+        out_count = dev->fifo_unpack_frames(&fifo->data[data_index],
+                                            frame_count,
+                                            layout->frame_len,
+                                            layout->acc_offset,
+                                            layout->sens_time_offset,
+                                            BMI3_FIFO_ACCEL_DUMMY_FRAME,
+                                            data);
+        corr = dev->acc_corr;
+    }
+    else
+    {
+        out_count = dev->fifo_unpack_frames(&fifo->data[data_index],
+                                            frame_count,
+                                            layout->frame_len,
+                                            layout->gyr_offset,
+                                            layout->sens_time_offset,
+                                            BMI3_FIFO_GYRO_DUMMY_FRAME,
+                                            data);
+        corr = dev->gyr_corr;
+    }
 
-        if (rslt == BMI3_OK)
+    if (corr != NULL)
+    {
+        for (loop = 0; loop < out_count; loop++)
         {
-            /* Get the MSB byte of FIFO length */
-            data[0] = BMI3_GET_BIT_POS0(data[0], BMI3_FIFO_FILL_LEVEL);
+            correct_axes(&data[loop].x, &data[loop].y, &data[loop].z, corr);
+        }
+    }
 
-            reg_data = ((uint16_t)data[1] << 8);
+    return out_count;
+}
 
-            reg_data = BMI3_GET_BIT_POS0(reg_data, BMI3_FIFO_FILL_LEVEL);
+/*!
+ * @brief This internal API parses the accelerometer, gyro and temperature frames
+ * from the FIFO data in a single pass.
+ */
+static int8_t parse_fifo_frames(struct bmi3_fifo_sens_axes_data *accel_data,
+                                struct bmi3_fifo_sens_axes_data *gyro_data,
+                                struct bmi3_fifo_temperature_data *temp_data,
+                                struct bmi3_fifo_frame *fifo,
+                                const struct bmi3_dev *dev)
+{
+    /* Variable to store result of API */
+    int8_t rslt;
 
-            /* Get total FIFO length */
-            *fifo_avail_len = (uint16_t)(reg_data | data[0]);
+    /* Pointer to the layout of the frame */
+    const struct bmi3_fifo_frame_layout *layout = select_fifo_frame_layout(fifo);
 
-            if (*fifo_avail_len == 0)
-            {
-                rslt = BMI3_W_FIFO_EMPTY;
-            }
-        }
+    /* Structure instance to store the number of frames parsed */
+    struct bmi3_fifo_census count = { 0 };
+
+    rslt = parse_fifo_frame_range(accel_data,
+                                  gyro_data,
+                                  temp_data,
+                                  dev->dummy_byte,
+                                  get_fifo_data_end(fifo, dev),
+                                  &count,
+                                  fifo,
+                                  dev);
+
+    /* Update number of accelerometer, gyro and temperature frames to be read */
+    if ((accel_data != NULL) && (layout->acc_offset != BMI3_FIFO_NO_DATA))
+    {
+        fifo->avail_fifo_accel_frames = count.accel_frames;
     }
-    else
+
+    if ((gyro_data != NULL) && (layout->gyr_offset != BMI3_FIFO_NO_DATA))
     {
-        rslt = BMI3_E_NULL_PTR;
+        fifo->avail_fifo_gyro_frames = count.gyro_frames;
+    }
+
+    if ((temp_data != NULL) && (layout->temp_offset != BMI3_FIFO_NO_DATA))
+    {
+        fifo->avail_fifo_temp_frames = count.temp_frames;
     }
 
     return rslt;
 }
 
 /*!
- * @brief This API is used to perform the self-test for either accel or gyro or both.
+ * @brief This internal API parses the accelerometer, gyro and temperature frames
+ * of a range of the FIFO data.
  */
-int8_t bmi3_perform_self_test(uint8_t st_selection, struct bmi3_st_result *st_result_status, struct bmi3_dev *dev)
+static int8_t parse_fifo_frame_range(struct bmi3_fifo_sens_axes_data *accel_data,
+                                     struct bmi3_fifo_sens_axes_data *gyro_data,
+                                     struct bmi3_fifo_temperature_data *temp_data,
+                                     uint16_t data_index,
+                                     uint16_t data_end,
+                                     struct bmi3_fifo_census *count,
+                                     const struct bmi3_fifo_frame *fifo,
+                                     const struct bmi3_dev *dev)
 {
     /* Variable to store result of API */
-    int8_t rslt;
+    int8_t rslt = BMI3_W_FIFO_INVALID_FRAME;
 
-    uint8_t data_array[18] = { 0 };
+    /* Variable to store result of a single sensor frame */
+    int8_t frame_rslt;
 
-    /* Variable to store gyro filter coefficient base address */
-    uint8_t gyro_filter_coeff_base_addr[2] = { BMI3_BASE_ADDR_GYRO_SC_ST_COEFFICIENTS, 0 };
+    /* Pointer to the layout of the frame */
+    const struct bmi3_fifo_frame_layout *layout = select_fifo_frame_layout(fifo);
 
-    /* Get accel configurations */
-    struct bmi3_accel_config acc_cfg = { 0 };
+    /* Variables to index accelerometer, gyro and temperature frames */
+    uint16_t accel_index = 0;
+    uint16_t gyro_index = 0;
+    uint16_t temp_index = 0;
+
+    /* Variables to store the number of complete frames and to loop through them */
+    uint16_t full_frames;
+    uint16_t loop;
+
+    /* Skip the sensors which are not part of the frame */
+    if (layout->acc_offset == BMI3_FIFO_NO_DATA)
+    {
+        accel_data = NULL;
+    }
 
-    if (st_result_status != NULL)
+    if (layout->gyr_offset == BMI3_FIFO_NO_DATA)
     {
-        rslt = bmi3_set_regs(BMI3_REG_FEATURE_DATA_ADDR, gyro_filter_coeff_base_addr, 2, dev);
+        gyro_data = NULL;
+    }
 
-        if (rslt == BMI3_OK)
+    if (layout->temp_offset == BMI3_FIFO_NO_DATA)
+    {
+        temp_data = NULL;
+    }
+
+    if ((layout->frame_len != 0) && ((accel_data != NULL) || (gyro_data != NULL) || (temp_data != NULL)))
+    {
+        /* Complete frames are unpacked sensor by sensor with the platform specific (e.g. vectorized)
+         * function if provided, the loop below then parses the incomplete frame at the end
+         */
+        if ((dev->fifo_unpack_frames != NULL) && ((accel_data != NULL) || (gyro_data != NULL)) &&
+            (data_end > data_index))
         {
-            rslt = bmi3_set_regs(BMI3_REG_FEATURE_DATA_TX, data_array, 18, dev);
+            full_frames = (uint16_t)((data_end - data_index) / layout->frame_len);
 
-            if (rslt == BMI3_OK)
+            if (full_frames != 0)
             {
-                rslt = bmi3_set_regs(BMI3_REG_FEATURE_DATA_ADDR, gyro_filter_coeff_base_addr, 2, dev);
+                if (accel_data != NULL)
+                {
+                    accel_index = unpack_axes_frames(accel_data,
+                                                     data_index,
+                                                     full_frames,
+                                                     BMI3_FIFO_HEAD_LESS_ACC_FRM,
+                                                     layout,
+                                                     fifo,
+                                                     dev);
+                    rslt = BMI3_W_FIFO_ACCEL_DUMMY_FRAME;
+                }
 
-                if (rslt == BMI3_OK)
+                if (gyro_data != NULL)
                 {
-                    rslt = bmi3_get_regs(BMI3_REG_FEATURE_DATA_TX, data_array, 18, dev);
+                    gyro_index = unpack_axes_frames(gyro_data,
+                                                    data_index,
+                                                    full_frames,
+                                                    BMI3_FIFO_HEAD_LESS_GYR_FRM,
+                                                    layout,
+                                                    fifo,
+                                                    dev);
+                    rslt = BMI3_W_FIFO_GYRO_DUMMY_FRAME;
+                }
+
+                for (loop = 0; (temp_data != NULL) && (loop < full_frames); loop++)
+                {
+                    frame_rslt = unpack_temperature_data(&temp_data[temp_index],
+                                                         (uint16_t)(data_index + (loop * layout->frame_len)),
+                                                         data_end,
+                                                         layout,
+                                                         fifo);
+
+                    if (frame_rslt == BMI3_OK)
+                    {
+                        temp_index++;
+                    }
+
+                    rslt = frame_rslt;
                 }
+
+                data_index = (uint16_t)(data_index + (full_frames * layout->frame_len));
             }
         }
 
-#ifdef BMI330
-        uint16_t reg_data[9];
-        for (uint8_t data_index = 0; data_index < 9; data_index++)
+        for (; data_index < data_end; data_index += layout->frame_len)
         {
-            reg_data[data_index] =
-                (uint16_t)(data_array[data_index * 2] | (uint16_t)data_array[data_index * 2 + 1] << 8);
-        }
+            frame_rslt = BMI3_OK;
 
-        if ((reg_data[3] != BMI3_SC_ST_VALUE_3) &&
-            ((reg_data[0] != BMI3_SC_ST_VALUE_0) || (reg_data[1] != BMI3_SC_ST_VALUE_1) ||
-             (reg_data[2] != BMI3_SC_ST_VALUE_2) || (reg_data[4] != BMI3_SC_ST_VALUE_4) ||
-             (reg_data[5] != BMI3_SC_ST_VALUE_5) || (reg_data[6] != BMI3_SC_ST_VALUE_6) ||
-             (reg_data[7] != BMI3_SC_ST_VALUE_7) || (reg_data[8] != BMI3_SC_ST_VALUE_8)))
-        {
-            rslt = set_gyro_filter_coefficients(dev);
-        }
+            if (accel_data != NULL)
+            {
+                frame_rslt = unpack_accel_data(&accel_data[accel_index], data_index, data_end, layout, fifo);
 
-#endif
+                if ((frame_rslt == BMI3_OK) || (frame_rslt == BMI3_W_ST_PARTIAL_READ))
+                {
+                    if (dev->acc_corr != NULL)
+                    {
+                        correct_axes(&accel_data[accel_index].x,
+                                     &accel_data[accel_index].y,
+                                     &accel_data[accel_index].z,
+                                     dev->acc_corr);
+                    }
 
-        if (rslt == BMI3_OK)
-        {
-            /* Get and set the self-test mode given by the user in the self-test dma register. */
-            rslt = get_set_st_dma(st_selection, dev);
-        }
+                    accel_index++;
+                }
+            }
 
-        if (rslt == BMI3_OK)
-        {
-            /* Get default accel configurations */
-            rslt = get_accel_config(&acc_cfg, dev);
-        }
+            if ((gyro_data != NULL) && (frame_rslt != BMI3_W_PARTIAL_READ))
+            {
+                frame_rslt = unpack_gyro_data(&gyro_data[gyro_index], data_index, data_end, layout, fifo);
 
-        if (rslt == BMI3_OK)
-        {
-            /* Sets the self-test preconditions and triggers the self-test in the
-             * command register. */
-            rslt = self_test_conditions(st_selection, dev);
+                if ((frame_rslt == BMI3_OK) || (frame_rslt == BMI3_W_ST_PARTIAL_READ))
+                {
+                    if (dev->gyr_corr != NULL)
+                    {
+                        correct_axes(&gyro_data[gyro_index].x,
+                                     &gyro_data[gyro_index].y,
+                                     &gyro_data[gyro_index].z,
+                                     dev->gyr_corr);
+                    }
 
-            if (rslt == BMI3_OK)
+                    gyro_index++;
+                }
+            }
+
+            if ((temp_data != NULL) && (frame_rslt != BMI3_W_PARTIAL_READ))
             {
-                rslt = get_st_status_rslt(st_selection, st_result_status, dev);
+                frame_rslt = unpack_temperature_data(&temp_data[temp_index], data_index, data_end, layout, fifo);
+
+                if ((frame_rslt == BMI3_OK) || (frame_rslt == BMI3_W_ST_PARTIAL_READ))
+                {
+                    temp_index++;
+                }
             }
 
-            if (rslt == BMI3_OK)
+            rslt = frame_rslt;
+
+            /* Remaining frames are incomplete once a partial read occurs */
+            if (frame_rslt == BMI3_W_PARTIAL_READ)
             {
-                /* Restore accel configurations */
-                rslt = set_accel_config(&acc_cfg, dev);
+                break;
             }
         }
     }
-    else
+
+    count->accel_frames = accel_index;
+    count->gyro_frames = gyro_index;
+    count->temp_frames = temp_index;
+
+    if ((accel_index != 0) || (gyro_index != 0) || (temp_index != 0))
     {
-        rslt = BMI3_E_NULL_PTR;
+        rslt = BMI3_OK;
     }
 
     return rslt;
 }
 
 /*!
- * @brief This API writes the config array and config version in cfg res.
+ * @brief This internal API is used to parse accelerometer data from the
+ * FIFO data.
  */
-int8_t bmi3_configure_enhanced_flexibility(struct bmi3_dev *dev)
+static int8_t unpack_accel_data(struct bmi3_fifo_sens_axes_data *acc,
+                                uint16_t frame_index,
+                                uint16_t data_end,
+                                const struct bmi3_fifo_frame_layout *layout,
+                                const struct bmi3_fifo_frame *fifo)
 {
-    /* Variable to define error */
-    int8_t rslt;
+    /* Variable to store result of API */
+    int8_t rslt = BMI3_OK;
 
-    /* Null-pointer check */
-    rslt = null_ptr_check(dev);
+    /* Variable to store the accelerometer data index value */
+    uint16_t data_index = frame_index + layout->acc_offset;
 
-    if (rslt == BMI3_OK)
-    {
-        /* Bytes written are multiples of 2 */
-        if ((dev->read_write_len % 2) != 0)
-        {
-            dev->read_write_len = dev->read_write_len - 1;
-        }
+    /* Variable to store dummy data value which will get in FIFO data */
+    uint16_t dummy_data;
 
-        /* BMI3 has 16 bit address and hence the minimum read write length should be 2 bytes */
-        if (dev->read_write_len < 2)
-        {
-            dev->read_write_len = 2;
-        }
+    acc->sensor_time = 0;
 
-        rslt = config_array_set_command(dev);
+    if ((data_index + BMI3_LENGTH_FIFO_ACC) <= data_end)
+    {
+        /* To store the dummy data */
+        dummy_data = (uint16_t)(((uint16_t)fifo->data[data_index + 1] << 8) | fifo->data[data_index]);
 
-        if (rslt == BMI3_OK)
+        if (dummy_data != BMI3_FIFO_ACCEL_DUMMY_FRAME)
         {
-            rslt = config_array_set_value_one_page(dev);
+            /* Accelerometer raw x, y and z data */
+            acc->x = (int16_t)dummy_data;
+            acc->y = (int16_t)(((uint16_t)fifo->data[data_index + 3] << 8) | fifo->data[data_index + 2]);
+            acc->z = (int16_t)(((uint16_t)fifo->data[data_index + 5] << 8) | fifo->data[data_index + 4]);
 
-            if (rslt == BMI3_OK)
-            {
-                /* Write the config array */
-                rslt = write_config_array(dev);
-            }
+            rslt = unpack_sensor_time(&acc->sensor_time, frame_index, data_end, layout, fifo);
+        }
+        else
+        {
+            rslt = BMI3_W_FIFO_ACCEL_DUMMY_FRAME;
         }
     }
+    else
+    {
+        rslt = BMI3_W_PARTIAL_READ;
+    }
 
     return rslt;
 }
 
 /*!
- * @brief This API is used to get the config version.
+ * @brief This internal API is used to parse temperature data from the
+ * FIFO data.
  */
-int8_t bmi3_get_config_version(struct bmi3_config_version *config_version, struct bmi3_dev *dev)
+static int8_t unpack_temperature_data(struct bmi3_fifo_temperature_data *temp,
+                                      uint16_t frame_index,
+                                      uint16_t data_end,
+                                      const struct bmi3_fifo_frame_layout *layout,
+                                      const struct bmi3_fifo_frame *fifo)
 {
     /* Variable to store result of API */
     int8_t rslt = BMI3_OK;
 
-    /* Array to store base address of config */
-    uint8_t data[2] = { BMI3_BASE_ADDR_CONFIG_VERSION, 0 };
-
-    /* Variable to store version number */
-    uint8_t version[6];
+    /* Variable to store the temperature data index value */
+    uint16_t data_index = frame_index + layout->temp_offset;
 
-    uint16_t lsb_msb;
+    temp->sensor_time = 0;
 
-    if (config_version != NULL)
+    if ((data_index + BMI3_LENGTH_TEMPERATURE) <= data_end)
     {
-        /* Set the config version base address to feature engine transmission address to start DMA transaction */
-        rslt = bmi3_set_regs(BMI3_REG_FEATURE_DATA_ADDR, data, 2, dev);
+        /* Temperature raw data */
+        temp->temp_data = (uint16_t)(((uint16_t)fifo->data[data_index + 1] << 8) | fifo->data[data_index]);
 
-        if (rslt == BMI3_OK)
+        if (temp->temp_data != BMI3_FIFO_TEMP_DUMMY_FRAME)
         {
-            /* Get the configuration from the feature engine register */
-            rslt = bmi3_get_regs(BMI3_REG_FEATURE_DATA_TX, version, 6, dev);
-
-            if (rslt == BMI3_OK)
-            {
-                /* Get word to calculate config major and minor version from same word */
-                lsb_msb = (uint16_t)(version[0] | ((uint16_t) version[1] << 8));
-
-                config_version->config1_minor_version = (uint8_t)(lsb_msb & BMI3_CONFIG_1_MINOR_MASK);
-
-                config_version->config1_major_version = (lsb_msb & BMI3_CONFIG_1_MAJOR_MASK) >> BMI3_CONFIG_POS;
-
-                /* Get word to calculate config major and minor version from same word */
-                lsb_msb = (uint16_t)(version[2] | ((uint16_t) version[3] << 8));
-
-                config_version->config2_minor_version = (uint8_t)(lsb_msb & BMI3_CONFIG_2_MINOR_MASK);
-
-                config_version->config2_major_version = (lsb_msb & BMI3_CONFIG_2_MAJOR_MASK) >> BMI3_CONFIG_POS;
-            }
+            rslt = unpack_sensor_time(&temp->sensor_time, frame_index, data_end, layout, fifo);
+        }
+        else
+        {
+            rslt = BMI3_W_FIFO_TEMP_DUMMY_FRAME;
         }
     }
     else
     {
-        rslt = BMI3_E_NULL_PTR;
+        rslt = BMI3_W_PARTIAL_READ;
     }
 
     return rslt;
 }
 
 /*!
- * @brief This API is used to perform the self-calibration for either sensitivity or offset or both.
+ * @brief This internal API is used to parse gyro data from the
+ * FIFO data.
  */
-int8_t bmi3_perform_gyro_sc(uint8_t sc_selection,
-                            uint8_t apply_corr,
-                            struct bmi3_self_calib_rslt *sc_rslt,
-                            struct bmi3_dev *dev)
+static int8_t unpack_gyro_data(struct bmi3_fifo_sens_axes_data *gyro,
+                               uint16_t frame_index,
+                               uint16_t data_end,
+                               const struct bmi3_fifo_frame_layout *layout,
+                               const struct bmi3_fifo_frame *fifo)
 {
     /* Variable to store result of API */
-    int8_t rslt;
-
-    /* Structure to store sensor configuration for accel */
-    struct bmi3_sens_config get_config, set_config;
-
-    if (sc_rslt != NULL)
-    {
-        get_config.type = BMI3_ACCEL;
-
-        /* Get accel configurations */
-        rslt = bmi3_get_sensor_config(&get_config, 1, dev);
-
-        if (rslt == BMI3_OK)
-        {
-            /* Enable accelerometer */
-            set_config.type = BMI3_ACCEL;
+    int8_t rslt = BMI3_OK;
 
-            /* Definition of accel configuration which are the preconditions for self-calibration */
-            set_config.cfg.acc.acc_mode = BMI3_ACC_MODE_HIGH_PERF;
-            set_config.cfg.acc.odr = BMI3_ACC_ODR_100HZ;
-            set_config.cfg.acc.range = BMI3_ACC_RANGE_8G;
+    /* Variable to store the gyro data index value */
+    uint16_t data_index = frame_index + layout->gyr_offset;
 
-            /* Write the sensor configurations */
-            rslt = bmi3_set_sensor_config(&set_config, 1, dev);
-        }
+    gyro->sensor_time = 0;
 
-        if (rslt == BMI3_OK)
-        {
-            /* Disable alternate accel and gyro mode */
-            rslt = disable_alt_conf_acc_gyr_mode(dev);
-        }
+    if ((data_index + BMI3_LENGTH_FIFO_GYR) <= data_end)
+    {
+        /* Gyro raw x, y and z data */
+        gyro->x = (int16_t)(((uint16_t)fifo->data[data_index + 1] << 8) | fifo->data[data_index]);
+        gyro->y = (int16_t)(((uint16_t)fifo->data[data_index + 3] << 8) | fifo->data[data_index + 2]);
+        gyro->z = (int16_t)(((uint16_t)fifo->data[data_index + 5] << 8) | fifo->data[data_index + 4]);
 
-        if (rslt == BMI3_OK)
+        if ((uint16_t)gyro->x != BMI3_FIFO_GYRO_DUMMY_FRAME)
         {
-            /* Get and set the self-calibration mode given by the user in the self-calibration dma register. */
-            rslt = get_set_sc_dma(sc_selection, apply_corr, dev);
-
-            if (rslt == BMI3_OK)
-            {
-                /* Trigger the self-calibration command */
-                rslt = bmi3_set_command_register(BMI3_CMD_SELF_CALIB_TRIGGER, dev);
-
-                if (rslt == BMI3_OK)
-                {
-                    /* Get the self-calibration status and result */
-                    rslt = get_sc_gyro_rslt(sc_rslt, dev);
-                }
-            }
+            rslt = unpack_sensor_time(&gyro->sensor_time, frame_index, data_end, layout, fifo);
         }
-
-        if (rslt == BMI3_OK)
+        else
         {
-            /* Restore accel configurations */
-            rslt = bmi3_set_sensor_config(&get_config, 1, dev);
+            rslt = BMI3_W_FIFO_GYRO_DUMMY_FRAME;
         }
     }
     else
     {
-        rslt = BMI3_E_NULL_PTR;
+        rslt = BMI3_W_PARTIAL_READ;
     }
 
     return rslt;
 }
 
 /*!
- * @brief This API is used to set the data sample rate for i3c sync
+ * @brief This internal API is used to parse the sensor time of a frame from the
+ * FIFO data.
  */
-int8_t bmi3_set_i3c_tc_sync_tph(uint16_t sample_rate, struct bmi3_dev *dev)
+static int8_t unpack_sensor_time(uint16_t *sensor_time,
+                                 uint16_t frame_index,
+                                 uint16_t data_end,
+                                 const struct bmi3_fifo_frame_layout *layout,
+                                 const struct bmi3_fifo_frame *fifo)
 {
     /* Variable to store result of API */
-    int8_t rslt;
-
-    uint16_t reg_data;
-
-    /* To get the second byte data in word calculation */
-    uint16_t tc_tph;
-
-    /* Array to store data */
-    uint8_t data_array[2] = { 0 };
+    int8_t rslt = BMI3_OK;
 
-    /* Get the data sample rate of i3c sync */
-    rslt = bmi3_get_regs(BMI3_REG_I3C_TC_SYNC_TPH, data_array, 2, dev);
+    /* Variable to store the sensor time index value */
+    uint16_t data_index = frame_index + layout->sens_time_offset;
 
-    if (rslt == BMI3_OK)
+    if (layout->sens_time_offset != BMI3_FIFO_NO_DATA)
     {
-        data_array[0] = (uint8_t)BMI3_SET_BIT_POS0(data_array[0], BMI3_I3C_TC_SYNC_TPH, sample_rate);
-
-        reg_data = ((uint16_t)data_array[1] << 8);
-
-        tc_tph = (uint8_t)BMI3_SET_BIT_POS0(reg_data, BMI3_I3C_TC_SYNC_TPH, sample_rate);
-
-        data_array[1] = (uint8_t)(tc_tph >> 8);
-
-        rslt = bmi3_set_regs(BMI3_REG_I3C_TC_SYNC_TPH, data_array, 2, dev);
+        if ((data_index + BMI3_LENGTH_SENSOR_TIME) <= data_end)
+        {
+            /* Sensor time raw data */
+            *sensor_time = (uint16_t)(((uint16_t)fifo->data[data_index + 1] << 8) | fifo->data[data_index]);
+        }
+        else
+        {
+            rslt = BMI3_W_ST_PARTIAL_READ;
+        }
     }
 
     return rslt;
 }
 
 /*!
- * @brief This API is used to get the data sample rate for i3c sync
+ * @brief This internal API sets the precondition settings such as alternate accelerometer and
+ * gyroscope enable bits, accelerometer mode and output data rate.
  */
-int8_t bmi3_get_i3c_tc_sync_tph(uint16_t *sample_rate, struct bmi3_dev *dev)
+static int8_t st_precondition(uint8_t st_select, struct bmi3_dev *dev)
 {
     /* Variable to store result of API */
     int8_t rslt;
 
-    /* Array to store data */
-    uint8_t data_array[2] = { 0 };
+    /* Structure instance of sensor config */
+    struct bmi3_sens_config config = { 0 };
 
-    if (sample_rate != NULL)
-    {
-        /* Get the data sample rate of i3c sync */
-        rslt = bmi3_get_regs(BMI3_REG_I3C_TC_SYNC_TPH, data_array, 2, dev);
+    config.type = BMI3_ACCEL;
+
+    rslt = bmi3_get_sensor_config(&config, 1, dev);
 
-        if (rslt == BMI3_OK)
+    if (rslt == BMI3_OK)
+    {
+        switch (st_select)
         {
-            /* Get i3c sync tph sample rate */
-            *sample_rate = (uint16_t)(data_array[0] | (uint16_t)data_array[1] << 8);
+            case BMI3_ST_ACCEL_ONLY:
+                rslt = BMI3_OK;
+                break;
+            case BMI3_ST_GYRO_ONLY:
+            case BMI3_ST_BOTH_ACC_GYR:
+                rslt = BMI3_OK;
+                config.cfg.acc.acc_mode = BMI3_ACC_MODE_HIGH_PERF;
+                config.cfg.acc.odr = BMI3_ACC_ODR_100HZ;
+                break;
+            default:
+                rslt = BMI3_E_INVALID_ST_SELECTION;
+                break;
         }
     }
-    else
+
+    if (rslt == BMI3_OK)
     {
-        rslt = BMI3_E_NULL_PTR;
+        rslt = bmi3_set_sensor_config(&config, 1, dev);
     }
 
     return rslt;
 }
 
 /*!
- * @brief This API is used set the TU(time unit) value is used to scale the delay time payload
- * according to the hosts needs
+ * @brief This internal API gets and sets the self-test mode given
+ *  by the user in the self-test dma register.
  */
-int8_t bmi3_set_i3c_tc_sync_tu(uint8_t delay_time, struct bmi3_dev *dev)
+static int8_t get_set_st_dma(uint8_t st_selection, struct bmi3_dev *dev)
 {
     /* Variable to store result of API */
     int8_t rslt;
 
-    /* Variable to define data array */
-    uint8_t data_array[2] = { 0 };
+    uint8_t reg_data[2];
 
-    /* Get the i3c sync time unit */
-    rslt = bmi3_get_regs(BMI3_REG_I3C_TC_SYNC_TU, data_array, 2, dev);
+    /* Array to set the base address of self-test feature */
+    uint8_t base_addr[2] = { BMI3_BASE_ADDR_ST_SELECT, 0 };
+
+    rslt = bmi3_set_regs(BMI3_REG_FEATURE_DATA_ADDR, base_addr, 2, dev);
 
     if (rslt == BMI3_OK)
     {
-        /* Set the i3c sync time unit */
-        data_array[0] = BMI3_SET_BIT_POS0(data_array[0], BMI3_I3C_TC_SYNC_TU, delay_time);
+        rslt = bmi3_get_regs(BMI3_REG_FEATURE_DATA_TX, reg_data, 2, dev);
 
-        rslt = bmi3_set_regs(BMI3_REG_I3C_TC_SYNC_TU, data_array, 2, dev);
+        reg_data[0] = st_selection;
+
+        if (rslt == BMI3_OK)
+        {
+            rslt = bmi3_set_regs(BMI3_REG_FEATURE_DATA_ADDR, base_addr, 2, dev);
+
+            if (rslt == BMI3_OK)
+            {
+                rslt = bmi3_set_regs(BMI3_REG_FEATURE_DATA_TX, reg_data, 2, dev);
+            }
+        }
     }
 
     return rslt;
 }
 
 /*!
- * @brief This API is used get the TU(time unit) value is used to scale the delay time payload
- * according to the hosts needs
+ * @brief This internal API sets the self-test preconditions and triggers the self-test in the command register.
  */
-int8_t bmi3_get_i3c_tc_sync_tu(uint8_t *delay_time, struct bmi3_dev *dev)
+static int8_t self_test_conditions(uint8_t st_selection, struct bmi3_dev *dev)
 {
-    /* Variable to store result of API */
     int8_t rslt;
 
-    /* Variable to define data array */
-    uint8_t data_array[2] = { 0 };
+    /* Pre conditions to be checked */
+    rslt = st_precondition(st_selection, dev);
 
-    if (delay_time != NULL)
+    if (rslt == BMI3_OK)
     {
-        /* Get the i3c sync time unit */
-        rslt = bmi3_get_regs(BMI3_REG_I3C_TC_SYNC_TU, data_array, 2, dev);
+        /* Disable alternate accel and gyro mode */
+        rslt = disable_alt_conf_acc_gyr_mode(dev);
 
         if (rslt == BMI3_OK)
         {
-            *delay_time = BMI3_GET_BIT_POS0(data_array[0], BMI3_I3C_TC_SYNC_TU);
+            rslt = bmi3_set_command_register(BMI3_CMD_SELF_TEST_TRIGGER, dev);
         }
     }
-    else
-    {
-        rslt = BMI3_E_NULL_PTR;
-    }
 
     return rslt;
 }
 
 /*!
- * @brief This API is used to set the i3c sync ODR.
+ * @brief This internal API is used to disable alternate config accel and gyro mode for self-test precondition.
  */
-int8_t bmi3_set_i3c_tc_sync_odr(uint8_t odr, struct bmi3_dev *dev)
+static int8_t disable_alt_conf_acc_gyr_mode(struct bmi3_dev *dev)
 {
-    /* Variable to store result of API */
     int8_t rslt;
 
-    /* Variable to define data array */
-    uint8_t data_array[2] = { 0 };
+    struct bmi3_alt_accel_config alt_acc_cfg;
 
-    /* Get the i3c sync ODR */
-    rslt = bmi3_get_regs(BMI3_REG_I3C_TC_SYNC_ODR, data_array, 2, dev);
+    struct bmi3_alt_gyro_config alt_gyr_cfg;
+
+    rslt = get_alternate_accel_config(&alt_acc_cfg, dev);
 
     if (rslt == BMI3_OK)
     {
-        /* Set the i3c sync ODR */
-        data_array[0] = BMI3_SET_BIT_POS0(data_array[0], BMI3_I3C_TC_SYNC_ODR, odr);
+        alt_acc_cfg.alt_acc_mode = BMI3_DISABLE;
 
-        rslt = bmi3_set_regs(BMI3_REG_I3C_TC_SYNC_ODR, data_array, 2, dev);
+        rslt = set_alternate_accel_config(&alt_acc_cfg, dev);
+
+        if (rslt == BMI3_OK)
+        {
+            rslt = get_alternate_gyro_config(&alt_gyr_cfg, dev);
+
+            if (rslt == BMI3_OK)
+            {
+                alt_gyr_cfg.alt_gyro_mode = BMI3_DISABLE;
+
+                rslt = set_alternate_gyro_config(&alt_gyr_cfg, dev);
+            }
+        }
     }
 
     return rslt;
 }
 
 /*!
- * @brief This API is used to get the i3c sync ODR.
+ * @brief This internal API is used to get the error status of the self-test and the result of the event.
  */
-int8_t bmi3_get_i3c_tc_sync_odr(uint8_t *odr, struct bmi3_dev *dev)
+static int8_t get_st_result(const struct bmi3_st_ctx *st_ctx, struct bmi3_st_result *st_result_status,
+                            struct bmi3_dev *dev)
 {
     /* Variable to store result of API */
     int8_t rslt;
 
-    /* Array to store data */
-    uint8_t data_array[2] = { 0 };
+    /* Variable to define reg data */
+    uint8_t reg_data[2];
 
-    if (odr != NULL)
+    /* Variable to define feature engine errors */
+    uint8_t feature_engine_err_reg_lsb, feature_engine_err_reg_msb;
+
+    /* Array to set the base address of self-test feature */
+    uint8_t sc_st_base_addr[2] = { BMI3_BASE_ADDR_ST_RESULT, 0 };
+
+    st_result_status->self_test_err_status = 0;
+
+    rslt = bmi3_get_feature_engine_error_status(&feature_engine_err_reg_lsb, &feature_engine_err_reg_msb, dev);
+    st_result_status->self_test_err_status = feature_engine_err_reg_lsb & BMI3_SET_LOW_NIBBLE;
+
+    if (st_ctx->state == BMI3_ST_STATE_COMPLETE)
     {
-        /* Get the i3c sync ODR */
-        rslt = bmi3_get_regs(BMI3_REG_I3C_TC_SYNC_ODR, data_array, 2, dev);
+        /* To avoid retaining the values of last iteration , the values are cleared*/
+        st_result_status->acc_sens_x_ok = BMI3_DISABLE;
+        st_result_status->acc_sens_y_ok = BMI3_DISABLE;
+        st_result_status->acc_sens_z_ok = BMI3_DISABLE;
+        st_result_status->gyr_sens_x_ok = BMI3_DISABLE;
+        st_result_status->gyr_sens_y_ok = BMI3_DISABLE;
+        st_result_status->gyr_sens_z_ok = BMI3_DISABLE;
+        st_result_status->gyr_drive_ok = BMI3_DISABLE;
+
+        /*stores the self test result*/
+        st_result_status->self_test_rslt = (st_ctx->feature_io1 & BMI3_ST_RESULT_MASK) >> BMI3_ST_RESULT_POS;
+
+        rslt = bmi3_set_regs(BMI3_REG_FEATURE_DATA_ADDR, sc_st_base_addr, 2, dev);
 
         if (rslt == BMI3_OK)
         {
-            *odr = BMI3_GET_BIT_POS0(data_array[0], BMI3_I3C_TC_SYNC_ODR);
+            rslt = bmi3_get_regs(BMI3_REG_FEATURE_DATA_TX, reg_data, 2, dev);
+
+            if (rslt == BMI3_OK)
+            {
+
+                if (st_ctx->st_selection & BMI3_ST_ACCEL_ONLY)
+                {
+                    st_result_status->acc_sens_x_ok = (reg_data[0] & BMI3_ST_ACC_X_OK_MASK);
+                    st_result_status->acc_sens_y_ok = (reg_data[0] & BMI3_ST_ACC_Y_OK_MASK) >> BMI3_ST_ACC_Y_OK_POS;
+                    st_result_status->acc_sens_z_ok = (reg_data[0] & BMI3_ST_ACC_Z_OK_MASK) >> BMI3_ST_ACC_Z_OK_POS;
+                }
+
+                if (st_ctx->st_selection & BMI3_ST_GYRO_ONLY)
+                {
+                    st_result_status->gyr_sens_x_ok = (reg_data[0] & BMI3_ST_GYR_X_OK_MASK) >> BMI3_ST_GYR_X_OK_POS;
+                    st_result_status->gyr_sens_y_ok = (reg_data[0] & BMI3_ST_GYR_Y_OK_MASK) >> BMI3_ST_GYR_Y_OK_POS;
+                    st_result_status->gyr_sens_z_ok = (reg_data[0] & BMI3_ST_GYR_Z_OK_MASK) >> BMI3_ST_GYR_Z_OK_POS;
+                    st_result_status->gyr_drive_ok = (reg_data[0] & BMI3_ST_GYR_DRIVE_OK_MASK) >>
+                                                     BMI3_ST_GYR_DRIVE_OK_POS;
+                }
+            }
         }
     }
-    else
-    {
-        rslt = BMI3_E_NULL_PTR;
-    }
 
     return rslt;
 }
 
 /*!
- * @brief This internal API gets i3c sync i3c_tc_res
+ * @brief This internal API gets and sets the self-calibration mode given
+ *  by the user in the self-calibration dma register.
  */
-int8_t bmi3_get_i3c_sync_i3c_tc_res(uint8_t *i3c_tc_res, struct bmi3_dev *dev)
+static int8_t get_set_sc_dma(uint8_t sc_selection, uint8_t apply_corr, struct bmi3_dev *dev)
 {
     /* Variable to store result of API */
     int8_t rslt;
 
-    /* Array to define the feature configuration */
-    uint8_t i3c_sync_i3c_tc_res[2] = { 0 };
-
-    /* Array to set the base address of i3c sync feature */
-    uint8_t base_addr[2] = { BMI3_BASE_ADDR_I3C_SYNC, 0 };
-
-    /* Variable to define array offset */
-    uint8_t idx = 0;
-
-    /* Variable to define LSB */
-    uint16_t lsb;
+    uint8_t reg_data[2];
 
-    /* Variable to define MSB */
-    uint16_t msb;
+    /* Array to set the base address of self-calibration feature */
+    uint8_t sc_base_addr[2] = { BMI3_BASE_ADDR_GYRO_SC_SELECT, 0 };
 
-    /* Variable to define a word */
-    uint16_t lsb_msb;
+    rslt = bmi3_set_regs(BMI3_REG_FEATURE_DATA_ADDR, sc_base_addr, 2, dev);
 
-    if (i3c_tc_res != NULL)
+    if (rslt == BMI3_OK)
     {
-        /* Set the tap base address to feature engine transmission address to start DMA transaction */
-        rslt = bmi3_set_regs(BMI3_REG_FEATURE_DATA_ADDR, base_addr, 2, dev);
+        rslt = bmi3_get_regs(BMI3_REG_FEATURE_DATA_TX, reg_data, 2, dev);
+
+        /* The value of apply correction is appended with the selection given by the user */
+        reg_data[0] = (apply_corr | sc_selection);
 
         if (rslt == BMI3_OK)
         {
-            /* Get the configuration from the feature engine register where tap feature resides */
-            rslt = bmi3_get_regs(BMI3_REG_FEATURE_DATA_TX, i3c_sync_i3c_tc_res, 2, dev);
+            rslt = bmi3_set_regs(BMI3_REG_FEATURE_DATA_ADDR, sc_base_addr, 2, dev);
 
             if (rslt == BMI3_OK)
             {
-                /* Get word to calculate i3c_tc_res from the same word */
-                lsb = (uint16_t) i3c_sync_i3c_tc_res[idx++];
-                msb = ((uint16_t) i3c_sync_i3c_tc_res[idx++] << 8);
-                lsb_msb = lsb | msb;
-
-                /* Get i3c_tc_res */
-                *i3c_tc_res = (uint8_t)(lsb_msb & BMI3_I3C_SYNC_FILTER_EN_MASK);
+                rslt = bmi3_set_regs(BMI3_REG_FEATURE_DATA_TX, reg_data, 2, dev);
             }
         }
     }
-    else
-    {
-        rslt = BMI3_E_NULL_PTR;
-    }
 
     return rslt;
 }
 
-/*!
- * @brief This internal API sets i3c sync i3c_tc_res
- */
-int8_t bmi3_set_i3c_sync_i3c_tc_res(uint8_t i3c_tc_res, struct bmi3_dev *dev)
+/* This internal API is used to get the result of the gyro self-calibration event */
+static int8_t get_sc_gyro_rslt(const struct bmi3_sc_ctx *sc_ctx,
+                               struct bmi3_self_calib_rslt *sc_rslt,
+                               struct bmi3_dev *dev)
 {
     /* Variable to store result of API */
-    int8_t rslt;
-
-    /* Array to define the feature configuration */
-    uint8_t i3c_sync_i3c_tc_res[2] = { 0 };
+    int8_t rslt = BMI3_OK;
 
-    /* Array to set the base address of i3c sync feature */
-    uint8_t base_addr[2] = { BMI3_BASE_ADDR_I3C_SYNC, 0 };
+    /* Variable to define feature engine errors */
+    uint8_t feature_engine_err_reg_lsb, feature_engine_err_reg_msb;
 
-    /* Set the tap base address to feature engine transmission address to start DMA transaction */
-    rslt = bmi3_set_regs(BMI3_REG_FEATURE_DATA_ADDR, base_addr, 2, dev);
+    sc_rslt->sc_error_status = 0;
 
-    if (rslt == BMI3_OK)
+    if (sc_ctx->state == BMI3_ST_STATE_COMPLETE)
     {
-        /* Set i3c_tc_res */
-        i3c_sync_i3c_tc_res[0] = BMI3_SET_BIT_POS0(i3c_sync_i3c_tc_res[0], BMI3_I3C_SYNC_FILTER_EN, i3c_tc_res);
+        sc_rslt->gyro_sc_rslt = (sc_ctx->feature_io1 & BMI3_GYRO_SC_RESULT_MASK) >> BMI3_GYRO_SC_RESULT_POS;
 
-        /* Left shift by 8 times so that we can set rest of the values of i3c_tc_res data in word */
-        i3c_sync_i3c_tc_res[1] = (uint8_t)(i3c_sync_i3c_tc_res[1] << 8);
-
-        /* Set the configuration back to the feature engine register */
-        rslt = bmi3_set_regs(BMI3_REG_FEATURE_DATA_TX, i3c_sync_i3c_tc_res, 2, dev);
+        sc_rslt->sc_error_status = sc_ctx->feature_io1;
+    }
+    else
+    {
+        /* If limit elapses returning the error code, error status is returned */
+        rslt = bmi3_get_feature_engine_error_status(&feature_engine_err_reg_lsb, &feature_engine_err_reg_msb, dev);
+        sc_rslt->sc_error_status = feature_engine_err_reg_lsb;
     }
 
     return rslt;
 }
 
 /*!
- * @brief This API is used to enable accel and gyro for alternate configuration
+ * @brief This internal API reads the i3c sync data from the given base address
+ * up to the i3c sync time in one burst.
  */
-int8_t bmi3_alternate_config_ctrl(uint8_t config_en, uint8_t alt_rst_conf, struct bmi3_dev *dev)
+static int8_t get_i3c_sync_data(uint8_t *sync_data, uint8_t sync_base, struct bmi3_dev *dev)
 {
     /* Variable to store result of API */
     int8_t rslt;
 
-    uint8_t data[2] = { 0 };
+    /* Array to set the base address of i3c sync data */
+    uint8_t base_addr[2] = { sync_base, 0 };
 
-    rslt = bmi3_get_regs(BMI3_REG_ALT_CONF, data, 2, dev);
+    /* Set the i3c sync base address to feature engine transmission address to start DMA transaction */
+    rslt = bmi3_set_regs(BMI3_REG_FEATURE_DATA_ADDR, base_addr, 2, dev);
 
     if (rslt == BMI3_OK)
     {
-        data[0] = (config_en & (BMI3_ALT_ACC_ENABLE | BMI3_ALT_GYR_ENABLE));
-        data[1] = (alt_rst_conf & BMI3_ALT_CONF_RESET_ON);
-
-        rslt = bmi3_set_regs(BMI3_REG_ALT_CONF, data, 2, dev);
+        /* Get the data from the feature engine register where i3c sync data resides, till the sync time */
+        rslt = bmi3_get_regs(BMI3_REG_FEATURE_DATA_TX,
+                             sync_data,
+                             (uint16_t)((BMI3_BASE_ADDR_I3C_SYNC_TIME + 1 - sync_base) * 2),
+                             dev);
     }
 
     return rslt;
 }
 
 /*!
- * @brief This API is used to read the status of alternate configuration
+ * @brief This internal API gets the i3c sync accelerometer or gyroscope data
+ * from the i3c sync data read.
+ */
+static void get_i3c_sync_sensor_data(struct bmi3_i3c_sync_data *data,
+                                     const uint8_t *sync_data,
+                                     uint8_t base_addr,
+                                     uint8_t sync_base)
+{
+    /* Pointers to the sensor data and sync time in the data read */
+    const uint8_t *reg_data = &sync_data[(base_addr - sync_base) * 2];
+    const uint8_t *time_data = &sync_data[(BMI3_BASE_ADDR_I3C_SYNC_TIME - sync_base) * 2];
+
+    if (data != NULL)
+    {
+        data->sync_x = (reg_data[0] | (uint16_t)reg_data[1] << 8);
+        data->sync_y = (reg_data[2] | (uint16_t)reg_data[3] << 8);
+        data->sync_z = (reg_data[4] | (uint16_t)reg_data[5] << 8);
+        data->sync_time = (time_data[0] | (uint16_t)time_data[1] << 8);
+    }
+}
+
+/*!
+ * @brief This internal API gets the i3c sync temperature data from the i3c
+ * sync data read.
  */
-int8_t bmi3_read_alternate_status(struct bmi3_alt_status *alt_status, struct bmi3_dev *dev)
+static void get_i3c_sync_temp_data(struct bmi3_i3c_sync_data *data, const uint8_t *sync_data, uint8_t sync_base)
 {
-    /* Variable to store result of API */
-    int8_t rslt;
-
-    uint8_t data[2] = { 0 };
-
-    if (alt_status != NULL)
-    {
-        rslt = bmi3_get_regs(BMI3_REG_ALT_STATUS, data, 2, dev);
+    /* Pointers to the temperature data and sync time in the data read */
+    const uint8_t *reg_data = &sync_data[(BMI3_BASE_ADDR_I3C_SYNC_TEMP - sync_base) * 2];
+    const uint8_t *time_data = &sync_data[(BMI3_BASE_ADDR_I3C_SYNC_TIME - sync_base) * 2];
 
-        if (rslt == BMI3_OK)
-        {
-            alt_status->alt_accel_status = (data[0] & BMI3_ALT_ACCEL_STATUS_MASK);
-            alt_status->alt_gyro_status = (data[0] & BMI3_ALT_GYRO_STATUS_MASK) >> BMI3_ALT_GYRO_STATUS_POS;
-        }
-    }
-    else
+    if (data != NULL)
     {
-        rslt = BMI3_E_NULL_PTR;
+        data->sync_temp = (reg_data[0] | (uint16_t)reg_data[1] << 8);
+        data->sync_time = (time_data[0] | (uint16_t)time_data[1] << 8);
     }
-
-    return rslt;
 }
 
 /*!
- * @brief This API gets offset dgain for the sensor which stores self-calibrated values for accel.
+ * @brief This internal API sets alternate accelerometer configurations like ODR,
+ * accel mode and average number of samples.
  */
-int8_t bmi3_get_acc_dp_off_dgain(struct bmi3_acc_dp_gain_offset *acc_dp_gain_offset, struct bmi3_dev *dev)
+static int8_t set_alternate_accel_config(const struct bmi3_alt_accel_config *config, struct bmi3_dev *dev)
 {
     /* Variable to store result of API */
     int8_t rslt;
 
-    uint8_t reg_data[12] = { 0 };
+    /* Variable to store data */
+    uint8_t reg_data[2] = { 0 };
 
-    uint16_t acc_dp_off_x, acc_dp_off_y, acc_dp_off_z;
-    uint8_t acc_dp_dgain_x, acc_dp_dgain_y, acc_dp_dgain_z;
+    uint16_t alt_acc_odr, alt_acc_avg_num, alt_acc_mode;
 
-    /* NULL pointer check */
-    if (acc_dp_gain_offset != NULL)
+    if (config != NULL)
     {
-        /* Get temperature user offset for accel */
-        rslt = bmi3_get_regs(BMI3_REG_ACC_DP_OFF_X, reg_data, 12, dev);
+        /* Set alternate accelerometer ODR */
+        alt_acc_odr = BMI3_SET_BIT_POS0(reg_data[0], BMI3_ALT_ACC_ODR, config->alt_acc_odr);
 
-        if (rslt == BMI3_OK)
-        {
-            acc_dp_off_x = (uint16_t)(((uint16_t)reg_data[1] << 8) | reg_data[0]);
-            acc_dp_dgain_x = reg_data[2];
-            acc_dp_off_y = (uint16_t)(((uint16_t)reg_data[5] << 8) | reg_data[4]);
-            acc_dp_dgain_y = reg_data[6];
-            acc_dp_off_z = (uint16_t)(((uint16_t)reg_data[9] << 8) | reg_data[8]);
-            acc_dp_dgain_z = reg_data[10];
+        /* Set alternate accelerometer average number of samples */
+        alt_acc_avg_num = BMI3_SET_BITS(reg_data[1], BMI3_ALT_ACC_AVG_NUM, config->alt_acc_avg_num);
 
-            acc_dp_gain_offset->acc_dp_off_x = (acc_dp_off_x & dev->accel_bit_width);
-            acc_dp_gain_offset->acc_dp_dgain_x = (acc_dp_dgain_x & BMI3_ACC_DP_DGAIN_X_MASK);
-            acc_dp_gain_offset->acc_dp_off_y = (acc_dp_off_y & dev->accel_bit_width);
-            acc_dp_gain_offset->acc_dp_dgain_y = (acc_dp_dgain_y & BMI3_ACC_DP_DGAIN_Y_MASK);
-            acc_dp_gain_offset->acc_dp_off_z = (acc_dp_off_z & dev->accel_bit_width);
-            acc_dp_gain_offset->acc_dp_dgain_z = (acc_dp_dgain_z & BMI3_ACC_DP_DGAIN_Z_MASK);
-        }
+        /* Set alternate accelerometer mode */
+        alt_acc_mode = BMI3_SET_BITS(reg_data[1], BMI3_ALT_ACC_MODE, config->alt_acc_mode);
+
+        reg_data[0] = (uint8_t)(alt_acc_odr);
+        reg_data[1] = (uint8_t)((alt_acc_avg_num | alt_acc_mode) >> 8);
+
+        /* Set configurations of alternate accel */
+        rslt = bmi3_set_regs(BMI3_REG_ALT_ACC_CONF, reg_data, 2, dev);
     }
     else
     {
@@ -3962,39 +15813,38 @@ int8_t bmi3_get_acc_dp_off_dgain(struct bmi3_acc_dp_gain_offset *acc_dp_gain_off
 }
 
 /*!
- * @brief This API gets offset dgain for the sensor which stores self-calibrated values for gyro.
+ * @brief This internal API gets alternate accelerometer configurations like ODR,
+ * accel mode and average number of samples.
  */
-int8_t bmi3_get_gyro_dp_off_dgain(struct bmi3_gyr_dp_gain_offset *gyr_dp_gain_offset, struct bmi3_dev *dev)
+static int8_t get_alternate_accel_config(struct bmi3_alt_accel_config *config, struct bmi3_dev *dev)
 {
     /* Variable to store result of API */
     int8_t rslt;
 
-    uint8_t reg_data[12];
+    /* Array to store data */
+    uint8_t data_array[2] = { 0 };
 
-    uint16_t gyr_dp_off_x, gyr_dp_off_y, gyr_dp_off_z;
-    uint8_t gyr_dp_dgain_x, gyr_dp_dgain_y, gyr_dp_dgain_z;
+    uint16_t reg_data;
 
-    /* NULL pointer check */
-    if (gyr_dp_gain_offset != NULL)
+    if (config != NULL)
     {
-        /* Get temperature user offset for gyro */
-        rslt = bmi3_get_regs(BMI3_REG_GYR_DP_OFF_X, reg_data, 12, dev);
+        /* Read the sensor configuration details */
+        rslt = bmi3_get_regs(BMI3_REG_ALT_ACC_CONF, data_array, 2, dev);
 
         if (rslt == BMI3_OK)
         {
-            gyr_dp_off_x = (uint16_t)(((uint16_t)reg_data[1] << 8) | reg_data[0]);
-            gyr_dp_dgain_x = reg_data[2];
-            gyr_dp_off_y = (uint16_t)(((uint16_t)reg_data[5] << 8) | reg_data[4]);
-            gyr_dp_dgain_y = reg_data[6];
-            gyr_dp_off_z = (uint16_t)(((uint16_t)reg_data[9] << 8) | reg_data[8]);
-            gyr_dp_dgain_z = reg_data[10];
+            reg_data = data_array[0];
 
-            gyr_dp_gain_offset->gyr_dp_off_x = BMI3_GET_BIT_POS0(gyr_dp_off_x, BMI3_GYR_DP_OFF_X);
-            gyr_dp_gain_offset->gyr_dp_dgain_x = BMI3_GET_BIT_POS0(gyr_dp_dgain_x, BMI3_GYR_DP_DGAIN_X);
-            gyr_dp_gain_offset->gyr_dp_off_y = BMI3_GET_BIT_POS0(gyr_dp_off_y, BMI3_GYR_DP_OFF_Y);
-            gyr_dp_gain_offset->gyr_dp_dgain_y = BMI3_GET_BIT_POS0(gyr_dp_dgain_y, BMI3_GYR_DP_DGAIN_Y);
-            gyr_dp_gain_offset->gyr_dp_off_z = BMI3_GET_BIT_POS0(gyr_dp_off_z, BMI3_GYR_DP_OFF_Z);
-            gyr_dp_gain_offset->gyr_dp_dgain_z = BMI3_GET_BIT_POS0(gyr_dp_dgain_z, BMI3_GYR_DP_DGAIN_Z);
+            /* Get alternate accelerometer ODR */
+            config->alt_acc_odr = BMI3_GET_BIT_POS0(reg_data, BMI3_ALT_ACC_ODR);
+
+            reg_data = ((uint16_t)data_array[1] << 8);
+
+            /* Get alternate accelerometer average samples */
+            config->alt_acc_avg_num = BMI3_GET_BITS(reg_data, BMI3_ALT_ACC_AVG_NUM);
+
+            /* Get alternate accel mode */
+            config->alt_acc_mode = BMI3_GET_BITS(reg_data, BMI3_ALT_ACC_MODE);
         }
     }
     else
@@ -4006,49 +15856,35 @@ int8_t bmi3_get_gyro_dp_off_dgain(struct bmi3_gyr_dp_gain_offset *gyr_dp_gain_of
 }
 
 /*!
- * @brief This API sets offset dgain for the sensor which stores self-calibrated values for accel.
+ * @brief This internal API sets alternate gyro configurations like ODR,
+ * gyro mode and average number of samples.
  */
-int8_t bmi3_set_acc_dp_off_dgain(const struct bmi3_acc_dp_gain_offset *acc_dp_gain_offset, struct bmi3_dev *dev)
+static int8_t set_alternate_gyro_config(const struct bmi3_alt_gyro_config *config, struct bmi3_dev *dev)
 {
     /* Variable to store result of API */
     int8_t rslt;
 
-    uint8_t acc_dp_gain_x, acc_dp_gain_y, acc_dp_gain_z;
-
-    uint16_t acc_dp_off_x1, acc_dp_off_y1, acc_dp_off_z1;
-
-    uint8_t acc_off_gain[12] = { 0 };
+    /* Variable to store data */
+    uint8_t reg_data[2] = { 0 };
 
-    /* Null-pointer check */
-    rslt = null_ptr_check(dev);
+    uint16_t alt_gyro_odr, alt_gyro_avg_num, alt_gyro_mode;
 
-    /* NULL pointer check */
-    if ((rslt == BMI3_OK) && (acc_dp_gain_offset != NULL))
+    if (config != NULL)
     {
-        acc_dp_off_x1 = (acc_dp_gain_offset->acc_dp_off_x & dev->accel_bit_width);
-
-        acc_dp_gain_x = (uint8_t)(acc_dp_gain_offset->acc_dp_dgain_x & BMI3_ACC_DP_DGAIN_X_MASK);
-
-        acc_dp_off_y1 = (acc_dp_gain_offset->acc_dp_off_y & dev->accel_bit_width);
-
-        acc_dp_gain_y = (uint8_t)(acc_dp_gain_offset->acc_dp_dgain_y & BMI3_ACC_DP_DGAIN_Y_MASK);
+        /* Set alternate gyro ODR */
+        alt_gyro_odr = BMI3_SET_BIT_POS0(reg_data[0], BMI3_ALT_GYR_ODR, config->alt_gyro_odr);
 
-        acc_dp_off_z1 = (acc_dp_gain_offset->acc_dp_off_z & dev->accel_bit_width);
+        /* Set alternate gyro average number of samples */
+        alt_gyro_avg_num = BMI3_SET_BITS(reg_data[1], BMI3_ALT_GYR_AVG_NUM, config->alt_gyro_avg_num);
 
-        acc_dp_gain_z = (uint8_t)(acc_dp_gain_offset->acc_dp_dgain_z & BMI3_ACC_DP_DGAIN_Z_MASK);
+        /* Set alternate gyro mode */
+        alt_gyro_mode = BMI3_SET_BITS(reg_data[1], BMI3_ALT_GYR_MODE, config->alt_gyro_mode);
 
-        acc_off_gain[0] = (uint8_t)(acc_dp_off_x1 & BMI3_SET_LOW_BYTE);
-        acc_off_gain[1] = (acc_dp_off_x1 & BMI3_SET_HIGH_BYTE) >> 8;
-        acc_off_gain[2] = acc_dp_gain_x;
-        acc_off_gain[4] = (uint8_t)(acc_dp_off_y1 & BMI3_SET_LOW_BYTE);
-        acc_off_gain[5] = (acc_dp_off_y1 & BMI3_SET_HIGH_BYTE) >> 8;
-        acc_off_gain[6] = acc_dp_gain_y;
-        acc_off_gain[8] = (uint8_t)(acc_dp_off_z1 & BMI3_SET_LOW_BYTE);
-        acc_off_gain[9] = (acc_dp_off_z1 & BMI3_SET_HIGH_BYTE) >> 8;
-        acc_off_gain[10] = acc_dp_gain_z;
+        reg_data[0] = (uint8_t)(alt_gyro_odr);
+        reg_data[1] = (uint8_t)((alt_gyro_avg_num | alt_gyro_mode) >> 8);
 
-        /* Set dp offset for accel */
-        rslt = bmi3_set_regs(BMI3_REG_ACC_DP_OFF_X, acc_off_gain, 12, dev);
+        /* Set configurations of alternate gyro */
+        rslt = bmi3_set_regs(BMI3_REG_ALT_GYR_CONF, reg_data, 2, dev);
     }
     else
     {
@@ -4059,51 +15895,39 @@ int8_t bmi3_set_acc_dp_off_dgain(const struct bmi3_acc_dp_gain_offset *acc_dp_ga
 }
 
 /*!
- * @brief This API sets offset dgain for the sensor which stores self-calibrated values for gyro.
+ * @brief This internal API gets alternate gyro configurations like ODR,
+ * gyro mode and average number of samples.
  */
-int8_t bmi3_set_gyro_dp_off_dgain(const struct bmi3_gyr_dp_gain_offset *gyr_dp_gain_offset, struct bmi3_dev *dev)
+static int8_t get_alternate_gyro_config(struct bmi3_alt_gyro_config *config, struct bmi3_dev *dev)
 {
     /* Variable to store result of API */
     int8_t rslt;
 
-    uint8_t gyr_dp_gain_x, gyr_dp_gain_y, gyr_dp_gain_z;
-
-    uint16_t gyr_dp_off_x1, gyr_dp_off_y1, gyr_dp_off_z1;
-
-    uint16_t reg_data[6] = { 0 };
+    /* Array to store data */
+    uint8_t data_array[2] = { 0 };
 
-    uint8_t gyr_off_gain[12] = { 0 };
+    uint16_t reg_data;
 
-    /* NULL pointer check */
-    if (gyr_dp_gain_offset != NULL)
+    if (config != NULL)
     {
-        gyr_dp_off_x1 = BMI3_SET_BIT_POS0(reg_data[0], BMI3_GYR_DP_OFF_X, gyr_dp_gain_offset->gyr_dp_off_x);
-
-        gyr_dp_gain_x =
-            (uint8_t)BMI3_SET_BIT_POS0(reg_data[1], BMI3_GYR_DP_DGAIN_X, gyr_dp_gain_offset->gyr_dp_dgain_x);
-
-        gyr_dp_off_y1 = BMI3_SET_BIT_POS0(reg_data[2], BMI3_GYR_DP_OFF_Y, gyr_dp_gain_offset->gyr_dp_off_y);
+        /* Read the sensor configuration details */
+        rslt = bmi3_get_regs(BMI3_REG_ALT_GYR_CONF, data_array, 2, dev);
 
-        gyr_dp_gain_y =
-            (uint8_t)BMI3_SET_BIT_POS0(reg_data[3], BMI3_GYR_DP_DGAIN_Y, gyr_dp_gain_offset->gyr_dp_dgain_y);
+        if (rslt == BMI3_OK)
+        {
+            reg_data = data_array[0];
 
-        gyr_dp_off_z1 = BMI3_SET_BIT_POS0(reg_data[4], BMI3_GYR_DP_OFF_Z, gyr_dp_gain_offset->gyr_dp_off_z);
+            /* Get alternate gyro ODR */
+            config->alt_gyro_odr = BMI3_GET_BIT_POS0(reg_data, BMI3_ALT_GYR_ODR);
 
-        gyr_dp_gain_z =
-            (uint8_t)BMI3_SET_BIT_POS0(reg_data[5], BMI3_GYR_DP_DGAIN_Z, gyr_dp_gain_offset->gyr_dp_dgain_z);
+            reg_data = ((uint16_t)data_array[1] << 8);
 
-        gyr_off_gain[0] = (uint8_t)(gyr_dp_off_x1 & BMI3_SET_LOW_BYTE);
-        gyr_off_gain[1] = (gyr_dp_off_x1 & BMI3_SET_HIGH_BYTE) >> 8;
-        gyr_off_gain[2] = gyr_dp_gain_x;
-        gyr_off_gain[4] = (uint8_t)(gyr_dp_off_y1 & BMI3_SET_LOW_BYTE);
-        gyr_off_gain[5] = (gyr_dp_off_y1 & BMI3_SET_HIGH_BYTE) >> 8;
-        gyr_off_gain[6] = gyr_dp_gain_y;
-        gyr_off_gain[8] = (uint8_t)(gyr_dp_off_z1 & BMI3_SET_LOW_BYTE);
-        gyr_off_gain[9] = (gyr_dp_off_z1 & BMI3_SET_HIGH_BYTE) >> 8;
-        gyr_off_gain[10] = gyr_dp_gain_z;
+            /* Get alternate gyro average samples */
+            config->alt_gyro_avg_num = BMI3_GET_BITS(reg_data, BMI3_ALT_GYR_AVG_NUM);
 
-        /* Set dp offset for gyro */
-        rslt = bmi3_set_regs(BMI3_REG_GYR_DP_OFF_X, gyr_off_gain, 12, dev);
+            /* Get alternate gyro mode */
+            config->alt_gyro_mode = BMI3_GET_BITS(reg_data, BMI3_ALT_GYR_MODE);
+        }
     }
     else
     {
@@ -4114,2875 +15938,3411 @@ int8_t bmi3_set_gyro_dp_off_dgain(const struct bmi3_gyr_dp_gain_offset *gyr_dp_g
 }
 
 /*!
- * @brief This API gets user offset dgain for the sensor which stores self-calibrated values for accel.
+ * @brief This internal API is used to monitor the accel power mode during the axis remap.
  */
-int8_t bmi3_get_user_acc_off_dgain(struct bmi3_acc_usr_gain_offset *acc_usr_gain_offset, struct bmi3_dev *dev)
+static int8_t axes_remap_acc_power_mode_status(struct bmi3_sens_config config, struct bmi3_dev *dev)
 {
     /* Variable to store result of API */
     int8_t rslt;
 
-    uint8_t reg_data[12];
+    uint16_t int_status;
 
-    uint8_t base_addr[2] = { BMI3_BASE_ADDR_ACC_OFFSET_GAIN, 0 };
+    /* Variable to define feature engine errors */
+    uint8_t feature_engine_err_reg_lsb, feature_engine_err_reg_msb;
 
-    /* NULL pointer check */
-    if (acc_usr_gain_offset != NULL)
+    /* Variable to store the accel power mode during axis remap */
+    uint8_t acc_power_mode_status;
+
+    /* Variable to loop */
+    uint8_t index;
+
+    /* Variable to store time out value */
+    uint8_t time_out = 20;
+
+    /* Delay to read feature engine error status */
+    uint16_t axis_remap_delay = 5000;
+
+    config.type = BMI3_ACCEL;
+
+    rslt = bmi3_get_sensor_config(&config, 1, dev);
+
+    if ((rslt == BMI3_OK) && (config.cfg.acc.acc_mode != BMI3_ACC_MODE_DISABLE))
     {
-        /* Set the user accel offset base address to feature engine transmission address to start DMA transaction */
-        rslt = bmi3_set_regs(BMI3_REG_FEATURE_DATA_ADDR, base_addr, 2, dev);
+        acc_power_mode_status = config.cfg.acc.acc_mode;
+
+        config.cfg.acc.acc_mode = BMI3_ACC_MODE_DISABLE;
+
+        rslt = bmi3_set_sensor_config(&config, 1, dev);
 
         if (rslt == BMI3_OK)
         {
-            /* Get the configuration from the feature engine register */
-            rslt = bmi3_get_regs(BMI3_REG_FEATURE_DATA_TX, reg_data, 12, dev);
+            /* Axis mapping gets updated */
+            rslt = bmi3_set_command_register(BMI3_CMD_AXIS_MAP_UPDATE, dev);
+
+            for (index = 0; index < time_out; index++)
+            {
+                dev->delay_us(axis_remap_delay, dev->intf_ptr);
+
+                rslt = bmi3_get_feature_engine_error_status(&feature_engine_err_reg_lsb,
+                                                            &feature_engine_err_reg_msb,
+                                                            dev);
+
+                if ((feature_engine_err_reg_lsb & BMI3_NO_ERROR_MASK) &&
+                    (feature_engine_err_reg_msb & (BMI3_AXIS_MAP_COMPLETE_MASK >> 8)))
+                {
+                    break;
+                }
+            }
+
+            config.cfg.acc.acc_mode = acc_power_mode_status;
 
             if (rslt == BMI3_OK)
             {
-                acc_usr_gain_offset->acc_usr_off_x =
-                    (uint16_t)((((uint16_t)reg_data[1] << 8) | reg_data[0]) & BMI3_ACC_USR_OFF_X_MASK);
-                acc_usr_gain_offset->acc_usr_off_y =
-                    (uint16_t)((((uint16_t)reg_data[3] << 8) | reg_data[2]) & BMI3_ACC_USR_OFF_Y_MASK);
-                acc_usr_gain_offset->acc_usr_off_z =
-                    (uint16_t)((((uint16_t)reg_data[5] << 8) | reg_data[4]) & BMI3_ACC_USR_OFF_Z_MASK);
-                acc_usr_gain_offset->acc_usr_gain_x = (uint8_t)(reg_data[6] & BMI3_ACC_USR_GAIN_X_MASK);
-                acc_usr_gain_offset->acc_usr_gain_y = (uint8_t)(reg_data[8] & BMI3_ACC_USR_GAIN_Y_MASK);
-                acc_usr_gain_offset->acc_usr_gain_z = (uint8_t)(reg_data[10] & BMI3_ACC_USR_GAIN_Z_MASK);
+                /* Clearing status registers by reading it, before powering up accelerometer */
+                rslt = bmi3_get_int1_status(&int_status, dev);
+
+                if (rslt == BMI3_OK)
+                {
+                    rslt = bmi3_set_sensor_config(&config, 1, dev);
+                }
             }
         }
     }
-    else
+    else if (rslt == BMI3_OK)
     {
-        rslt = BMI3_E_NULL_PTR;
+        /* Axis mapping gets updated */
+        rslt = bmi3_set_command_register(BMI3_CMD_AXIS_MAP_UPDATE, dev);
     }
 
     return rslt;
 }
 
 /*!
- * @brief This API sets user offset dgain for the sensor which stores self-calibrated values for accel.
+ * @brief This internal API verifies and allows only the correct position to do Fast Offset Compensation for
+ * accelerometer.
  */
-int8_t bmi3_set_user_acc_off_dgain(const struct bmi3_acc_usr_gain_offset *acc_usr_gain_offset, struct bmi3_dev *dev)
+static int8_t verify_foc_position(uint8_t sens_list,
+                                  const struct bmi3_accel_foc_g_value *accel_g_axis,
+                                  struct bmi3_dev *dev)
 {
     /* Variable to store result of API */
     int8_t rslt;
 
-    uint8_t acc_usr_gain_x, acc_usr_gain_y, acc_usr_gain_z;
-
-    uint16_t acc_usr_off_x1, acc_usr_off_y1, acc_usr_off_z1;
+    /* Structure to store temporary accelerometer values */
+    struct bmi3_foc_temp_value temp_foc_data = { 0 };
 
-    uint16_t acc_usr_off_x2, acc_usr_off_y2, acc_usr_off_z2;
+    rslt = get_average_of_sensor_data(sens_list, &temp_foc_data, dev);
 
-    uint16_t acc_usr_off_x, acc_usr_off_y, acc_usr_off_z;
+    if (rslt == BMI3_OK)
+    {
+        rslt = check_foc_position(sens_list, accel_g_axis, temp_foc_data, dev);
+    }
 
-    uint8_t reg_data[12] = { 0 };
+    return rslt;
+}
 
-    uint8_t user_acc_off_gain[12] = { 0 };
+/*!
+ * @brief This internal API checks the position for Fast Offset Compensation
+ * from the average of the sensor data.
+ */
+static int8_t check_foc_position(uint8_t sens_list,
+                                 const struct bmi3_accel_foc_g_value *accel_g_axis,
+                                 struct bmi3_foc_temp_value temp_foc_data,
+                                 struct bmi3_dev *dev)
+{
+    /* Variable to store result of API */
+    int8_t rslt;
 
-    uint8_t base_addr[2] = { BMI3_BASE_ADDR_ACC_OFFSET_GAIN, 0 };
+    /* Structure to define accelerometer sensor axes */
+    struct bmi3_sens_axes_data avg_foc_data = { 0 };
 
-    /* NULL pointer check */
-    if (acc_usr_gain_offset != NULL)
+    if (sens_list == BMI3_ACCEL)
     {
-        /* Set the user accel offset base address to feature engine transmission address to start DMA transaction */
-        rslt = bmi3_set_regs(BMI3_REG_FEATURE_DATA_ADDR, base_addr, 2, dev);
-
-        if (rslt == BMI3_OK)
+        /* Taking modulus to make negative values as positive */
+        if ((accel_g_axis->x == 1) && (accel_g_axis->sign == 1))
         {
-            acc_usr_off_x1 = BMI3_SET_BIT_POS0(reg_data[0], BMI3_ACC_USR_OFF_X, acc_usr_gain_offset->acc_usr_off_x);
-
-            acc_usr_off_x = ((uint16_t)reg_data[1] << 8);
-
-            acc_usr_off_x2 = BMI3_SET_BIT_POS0(acc_usr_off_x, BMI3_ACC_USR_OFF_X, acc_usr_gain_offset->acc_usr_off_x);
-
-            acc_usr_off_y1 = BMI3_SET_BIT_POS0(reg_data[2], BMI3_ACC_USR_OFF_Y, acc_usr_gain_offset->acc_usr_off_y);
-
-            acc_usr_off_y = ((uint16_t)reg_data[3] << 8);
-
-            acc_usr_off_y2 = BMI3_SET_BIT_POS0(acc_usr_off_y, BMI3_ACC_USR_OFF_Y, acc_usr_gain_offset->acc_usr_off_y);
-
-            acc_usr_off_z1 = BMI3_SET_BIT_POS0(reg_data[4], BMI3_ACC_USR_OFF_Z, acc_usr_gain_offset->acc_usr_off_z);
-
-            acc_usr_off_z = ((uint16_t)reg_data[5] << 8);
-
-            acc_usr_off_z2 = BMI3_SET_BIT_POS0(acc_usr_off_z, BMI3_ACC_USR_OFF_Z, acc_usr_gain_offset->acc_usr_off_z);
-
-            acc_usr_gain_x = BMI3_SET_BIT_POS0(reg_data[6], BMI3_ACC_USR_GAIN_X, acc_usr_gain_offset->acc_usr_gain_x);
-
-            acc_usr_gain_y = BMI3_SET_BIT_POS0(reg_data[8], BMI3_ACC_USR_GAIN_Y, acc_usr_gain_offset->acc_usr_gain_y);
-
-            acc_usr_gain_z = BMI3_SET_BIT_POS0(reg_data[10], BMI3_ACC_USR_GAIN_Z, acc_usr_gain_offset->acc_usr_gain_z);
-
-            user_acc_off_gain[0] = (uint8_t)acc_usr_off_x1;
-            user_acc_off_gain[1] = acc_usr_off_x2 >> 8;
-            user_acc_off_gain[2] = (uint8_t)acc_usr_off_y1;
-            user_acc_off_gain[3] = acc_usr_off_y2 >> 8;
-            user_acc_off_gain[4] = (uint8_t)acc_usr_off_z1;
-            user_acc_off_gain[5] = acc_usr_off_z2 >> 8;
-            user_acc_off_gain[6] = acc_usr_gain_x;
-            user_acc_off_gain[8] = acc_usr_gain_y;
-            user_acc_off_gain[10] = acc_usr_gain_z;
-
-            /* Set the configuration to the feature engine register */
-            rslt = bmi3_set_regs(BMI3_REG_FEATURE_DATA_TX, user_acc_off_gain, 12, dev);
+            temp_foc_data.x = temp_foc_data.x * BMI3_FOC_INVERT_VALUE;
+        }
+        else if ((accel_g_axis->y == 1) && (accel_g_axis->sign == 1))
+        {
+            temp_foc_data.y = temp_foc_data.y * BMI3_FOC_INVERT_VALUE;
+        }
+        else if ((accel_g_axis->z == 1) && (accel_g_axis->sign == 1))
+        {
+            temp_foc_data.z = temp_foc_data.z * BMI3_FOC_INVERT_VALUE;
         }
     }
-    else
-    {
-        rslt = BMI3_E_NULL_PTR;
-    }
+
+    avg_foc_data.x = (int16_t)(temp_foc_data.x);
+    avg_foc_data.y = (int16_t)(temp_foc_data.y);
+    avg_foc_data.z = (int16_t)(temp_foc_data.z);
+
+    rslt = validate_foc_position(sens_list, accel_g_axis, avg_foc_data, dev);
 
     return rslt;
 }
 
 /*!
- * @brief This API performs Fast Offset Compensation for accelerometer.
+ * @brief This internal API reads and provides average for 128 samples of sensor data for accel FOC.
  */
-int8_t bmi3_perform_accel_foc(const struct bmi3_accel_foc_g_value *accel_g_value, struct bmi3_dev *dev)
+static int8_t get_average_of_sensor_data(uint8_t sens_list,
+                                         struct bmi3_foc_temp_value *temp_foc_data,
+                                         struct bmi3_dev *dev)
 {
     /* Variable to store result of API */
     int8_t rslt;
 
-    /* Structure to define the accelerometer configurations */
-    struct bmi3_accel_config acc_cfg = { 0 };
-    struct bmi3_sens_config config = { 0 };
+    /* Structure to store sensor data */
+    struct bmi3_sensor_data sensor_data = { 0 };
 
-    /* Configure the type */
-    config.type = BMI3_ACCEL;
+    uint8_t sample_count = 0;
+    uint8_t datardy_try_cnt;
+    uint16_t drdy_status = 0;
+
+    /* Assign sensor list to type */
+    sensor_data.type = sens_list;
 
-    /* Null-pointer check */
     rslt = null_ptr_check(dev);
 
-    if ((rslt == BMI3_OK) && (accel_g_value != NULL))
+    if (rslt == BMI3_OK)
     {
-        /* Check for input validity */
-        if ((((BMI3_ABS(accel_g_value->x)) + (BMI3_ABS(accel_g_value->y)) + (BMI3_ABS(accel_g_value->z))) == 1) &&
-            ((accel_g_value->sign == 1) || (accel_g_value->sign == 0)))
+        /* Read sensor values before FOC */
+        while (sample_count < BMI3_FOC_SAMPLE_LIMIT)
         {
-            rslt = verify_foc_position(BMI3_ACCEL, accel_g_value, dev);
+            datardy_try_cnt = 5;
+            do
+            {
+                /* 20ms delay for 50Hz ODR */
+                dev->delay_us(20000, dev->intf_ptr);
+                rslt = bmi3_get_sensor_status(&drdy_status, dev);
+                datardy_try_cnt--;
+            } while ((rslt == BMI3_OK) && (!(drdy_status)) && (datardy_try_cnt));
 
-            if (rslt == BMI3_OK)
+            if ((rslt != BMI3_OK) || (datardy_try_cnt == 0))
             {
-                /* Get accelerometer configurations */
-                rslt = bmi3_get_sensor_config(&config, 1, dev);
+                rslt = BMI3_E_DATA_RDY_INT_FAILED;
+                break;
             }
 
-            /* Perform accelerometer FOC */
+            rslt = bmi3_get_sensor_data(&sensor_data, 1, dev);
+
             if (rslt == BMI3_OK)
             {
-                rslt = perform_accel_foc(accel_g_value, &acc_cfg, dev);
+                if (sensor_data.type == BMI3_ACCEL)
+                {
+                    temp_foc_data->x += sensor_data.sens_data.acc.x;
+                    temp_foc_data->y += sensor_data.sens_data.acc.y;
+                    temp_foc_data->z += sensor_data.sens_data.acc.z;
+                }
+                else if (sensor_data.type == BMI3_GYRO)
+                {
+                    temp_foc_data->x += sensor_data.sens_data.gyr.x;
+                    temp_foc_data->y += sensor_data.sens_data.gyr.y;
+                    temp_foc_data->z += sensor_data.sens_data.gyr.z;
+                }
             }
-
-            /* Set the configurations */
-            if (rslt == BMI3_OK)
+            else
             {
-                rslt = bmi3_set_sensor_config(&config, 1, dev);
+                break;
             }
+
+            sample_count++;
         }
-        else
+
+        if (rslt == BMI3_OK)
         {
-            rslt = BMI3_E_INVALID_INPUT;
+            temp_foc_data->x = (temp_foc_data->x / BMI3_FOC_SAMPLE_LIMIT);
+            temp_foc_data->y = (temp_foc_data->y / BMI3_FOC_SAMPLE_LIMIT);
+            temp_foc_data->z = (temp_foc_data->z / BMI3_FOC_SAMPLE_LIMIT);
         }
     }
-    else
-    {
-        rslt = BMI3_E_NULL_PTR;
-    }
 
     return rslt;
 }
 
 /*!
- * @brief This API gets the data ready status of power on reset, accelerometer, gyroscope
- * and temperature.
+ * @brief This internal API validates accel FOC position as per the range
  */
-int8_t bmi3_get_sensor_status(uint16_t *status, struct bmi3_dev *dev)
+static int8_t validate_foc_position(uint8_t sens_list,
+                                    const struct bmi3_accel_foc_g_value *accel_g_axis,
+                                    struct bmi3_sens_axes_data avg_foc_data,
+                                    struct bmi3_dev *dev)
 {
     /* Variable to store result of API */
-    int8_t rslt;
-
-    uint8_t data[2] = { 0 };
-
-    if (status != NULL)
-    {
-        /* Read the status register */
-        rslt = bmi3_get_regs(BMI3_REG_STATUS, data, 2, dev);
+    int8_t rslt = BMI3_E_INVALID_INPUT;
 
-        *status = (uint16_t)(data[0] | ((uint16_t)data[1] << 8));
-    }
-    else
+    if (sens_list == BMI3_ACCEL)
     {
-        rslt = BMI3_E_NULL_PTR;
+        if (accel_g_axis->x == 1)
+        {
+            rslt = validate_foc_accel_axis(avg_foc_data.x, dev);
+        }
+        else if (accel_g_axis->y == 1)
+        {
+            rslt = validate_foc_accel_axis(avg_foc_data.y, dev);
+        }
+        else
+        {
+            rslt = validate_foc_accel_axis(avg_foc_data.z, dev);
+        }
     }
 
     return rslt;
 }
 
 /*!
- * @brief This API gets the I3C IBI status of both feature and data
- * interrupts
+ * @brief This internal API validates accel FOC axis given as input
  */
-int8_t bmi3_get_i3c_ibi_status(uint16_t *int_status, struct bmi3_dev *dev)
+static int8_t validate_foc_accel_axis(int16_t avg_foc_data, struct bmi3_dev *dev)
 {
     /* Variable to store result of API */
     int8_t rslt;
 
-    /* Array to store data */
-    uint8_t data_array[2] = { 0 };
+    /* Structure to store sensor configurations */
+    struct bmi3_sens_config sens_cfg = { 0 };
 
-    if (int_status != NULL)
+    /* Variable to store accel range */
+    uint8_t range;
+
+    /* Assign the accel type */
+    sens_cfg.type = BMI3_ACCEL;
+
+    /* Get accel configurations */
+    rslt = bmi3_get_sensor_config(&sens_cfg, 1, dev);
+
+    if (rslt == BMI3_OK)
     {
-        /* Get the interrupt status */
-        rslt = bmi3_get_regs(BMI3_REG_INT_STATUS_IBI, data_array, 2, dev);
+        /* Assign accel range to variable */
+        range = sens_cfg.cfg.acc.range;
 
-        if (rslt == BMI3_OK)
+        /* Reference LSB value of 2G */
+        if ((range == BMI3_ACC_RANGE_2G) && (avg_foc_data > BMI3_ACC_2G_MIN_NOISE_LIMIT) &&
+            (avg_foc_data < BMI3_ACC_2G_MAX_NOISE_LIMIT))
         {
-            *int_status = (uint16_t) data_array[0] | ((uint16_t) data_array[1] << 8);
+            rslt = BMI3_OK;
+        }
+        /* Reference LSB value of 4G */
+        else if ((range == BMI3_ACC_RANGE_4G) && (avg_foc_data > BMI3_ACC_4G_MIN_NOISE_LIMIT) &&
+                 (avg_foc_data < BMI3_ACC_4G_MAX_NOISE_LIMIT))
+        {
+            rslt = BMI3_OK;
+        }
+        /* Reference LSB value of 8G */
+        else if ((range == BMI3_ACC_RANGE_8G) && (avg_foc_data > BMI3_ACC_8G_MIN_NOISE_LIMIT) &&
+                 (avg_foc_data < BMI3_ACC_8G_MAX_NOISE_LIMIT))
+        {
+            rslt = BMI3_OK;
+        }
+        /* Reference LSB value of 16G */
+        else if ((range == BMI3_ACC_RANGE_16G) && (avg_foc_data > BMI3_ACC_16G_MIN_NOISE_LIMIT) &&
+                 (avg_foc_data < BMI3_ACC_16G_MAX_NOISE_LIMIT))
+        {
+            rslt = BMI3_OK;
+        }
+        else
+        {
+            rslt = BMI3_E_INVALID_FOC_POSITION;
         }
-    }
-    else
-    {
-        rslt = BMI3_E_NULL_PTR;
     }
 
     return rslt;
 }
 
 /*!
- * @brief This API gets accel gyro offset gain reset values.
+ * @brief This internal API performs Fast Offset Compensation for accelerometer.
  */
-int8_t bmi3_get_acc_gyr_off_gain_reset(uint8_t *acc_off_gain_reset, uint8_t *gyr_off_gain_reset, struct bmi3_dev *dev)
+static int8_t perform_accel_foc(const struct bmi3_accel_foc_g_value *accel_g_value,
+                                struct bmi3_accel_config *acc_cfg,
+                                struct bmi3_dev *dev)
 {
     /* Variable to store result of API */
-    int8_t rslt;
+    int8_t rslt = BMI3_E_INVALID_STATUS;
 
-    /* Array to define the accel gyro user gain offset reset values */
-    uint8_t acc_gyr_off_gain_reset[2] = { 0 };
+    /* Variable to define count */
+    uint8_t loop;
 
-    /* Array to set the base address of accel gyro offset and gain reset */
-    uint8_t base_addr[2] = { BMI3_BASE_ADDR_ACC_GYR_OFFSET_GAIN_RESET, 0 };
+    /* Variable to store status read from the status register */
+    uint16_t reg_status = 0;
 
-    uint8_t idx = 0;
+    /* Array of structure to store accelerometer data */
+    struct bmi3_sensor_data accel_value[BMI3_FOC_SAMPLE_LIMIT] = { { 0 } };
 
-    /* Variable to define LSB */
-    uint16_t lsb;
+    /* Structure to store accelerometer data temporarily */
+    struct bmi3_foc_temp_value temp = { 0, 0, 0 };
 
-    /* Variable to define MSB */
-    uint16_t msb;
+    /* Structure to store the average of accelerometer data */
+    struct bmi3_sens_axes_data accel_avg = { 0 };
 
-    /* Variable to define a word */
-    uint16_t lsb_msb;
+    /* Variable tries max 5 times for interrupt then generates timeout */
+    uint8_t try_cnt;
 
-    if ((acc_off_gain_reset != NULL) && (gyr_off_gain_reset != NULL))
+    uint8_t reg_data[BMI3_READ_REG_DATA_LEN] = { 0 };
+
+    for (loop = 0; loop < BMI3_FOC_SAMPLE_LIMIT; loop++)
     {
-        /* Set the accel gyro offset and gain reset base address to feature engine transmission address to start DMA
-         * transaction */
-        rslt = bmi3_set_regs(BMI3_REG_FEATURE_DATA_ADDR, base_addr, 2, dev);
+        try_cnt = 5;
+        reg_status = 0; /* Reset the value */
 
-        if (rslt == BMI3_OK)
+        while (try_cnt && (!(reg_status & BMI3_DRDY_ACC_MASK)))
         {
-            /* Get the configuration from the feature engine register where accel gyro offset and gain reset value
-             * resides */
-            rslt = bmi3_get_regs(BMI3_REG_FEATURE_DATA_TX, acc_gyr_off_gain_reset, 2, dev);
+            /* 20ms delay for 50Hz ODR */
+            dev->delay_us(20000, dev->intf_ptr);
+            rslt = bmi3_get_sensor_status(&reg_status, dev);
+            try_cnt--;
+        }
+
+        if (rslt != BMI3_OK)
+        {
+            return rslt;
+        }
 
+        if (reg_status & BMI3_DRDY_ACC_MASK)
+        {
+            rslt = bmi3_read_reg_data(reg_data, dev);
             if (rslt == BMI3_OK)
             {
-                /* Get word to calculate acc_off_gain_reset and gyr_off_gain_reset */
-                lsb = (uint16_t) acc_gyr_off_gain_reset[idx++];
-                msb = ((uint16_t) acc_gyr_off_gain_reset[idx++] << 8);
-                lsb_msb = (lsb | msb);
-
-                /* Get accel offset gain reset */
-                *acc_off_gain_reset = (uint8_t)(lsb_msb & BMI3_ACC_OFF_GAIN_RESET_MASK);
-
-                /* Get gyro offset gain reset */
-                *gyr_off_gain_reset = (uint8_t)(lsb_msb & BMI3_GYR_OFF_GAIN_RESET_MASK) >> BMI3_GYR_OFF_GAIN_RESET_POS;
+                rslt = get_accel_sensortime_sat_data(&accel_value[loop].sens_data.acc, reg_data);
             }
         }
+        else
+        {
+            return BMI3_E_INVALID_STATUS;
+        }
+
+        if (rslt == BMI3_OK)
+        {
+            /* Store the data in a temporary structure */
+            temp.x = temp.x + (int32_t)accel_value[loop].sens_data.acc.x;
+            temp.y = temp.y + (int32_t)accel_value[loop].sens_data.acc.y;
+            temp.z = temp.z + (int32_t)accel_value[loop].sens_data.acc.z;
+        }
+        else
+        {
+            break;
+        }
     }
-    else
+
+    if (rslt == BMI3_OK)
     {
-        rslt = BMI3_E_NULL_PTR;
+        /* Take average of x, y and z data for lesser noise */
+        accel_avg.x = (int16_t)(temp.x / BMI3_FOC_SAMPLE_LIMIT);
+        accel_avg.y = (int16_t)(temp.y / BMI3_FOC_SAMPLE_LIMIT);
+        accel_avg.z = (int16_t)(temp.z / BMI3_FOC_SAMPLE_LIMIT);
+
+        rslt = set_accel_foc_offset(accel_g_value, &accel_avg, acc_cfg, dev);
     }
 
     return rslt;
 }
 
 /*!
- * @brief This API sets accel gyro offset gain reset values.
+ * @brief This internal API computes the accelerometer offset from the
+ * average of the accelerometer data and writes it to the offset registers.
  */
-int8_t bmi3_set_acc_gyr_off_gain_reset(uint8_t acc_off_gain_reset, uint8_t gyr_off_gain_reset, struct bmi3_dev *dev)
+static int8_t set_accel_foc_offset(const struct bmi3_accel_foc_g_value *accel_g_value,
+                                   struct bmi3_sens_axes_data *accel_avg,
+                                   struct bmi3_accel_config *acc_cfg,
+                                   struct bmi3_dev *dev)
 {
     /* Variable to store result of API */
     int8_t rslt;
 
-    /* Array to define the accel gyro user gain offset reset values */
-    uint8_t acc_gyr_off_gain_reset[2] = { 0 };
+    /* Variable to define LSB per g value */
+    uint16_t lsb_per_g = 0;
 
-    /* Array to set the base address of accel gyro offset and gain reset */
-    uint8_t base_addr[2] = { BMI3_BASE_ADDR_ACC_GYR_OFFSET_GAIN_RESET, 0 };
+    /* Variable to define range */
+    uint8_t range = 0;
 
-    uint8_t data_array[2] = { 0 };
+    /* Structure to store accelerometer data deviation from ideal value */
+    struct bmi3_offset_delta delta = { 0, 0, 0 };
 
-    /* Set the accel gyro offset and gain reset base address to feature engine transmission address to start DMA
-     * transaction */
-    rslt = bmi3_set_regs(BMI3_REG_FEATURE_DATA_ADDR, base_addr, 2, dev);
+    /* Structure to store accelerometer offset values */
+    struct bmi3_acc_dp_gain_offset offset = { 0 };
+
+    rslt = get_accel_config(acc_cfg, dev);
 
     if (rslt == BMI3_OK)
     {
-        /* Set accel offset gain reset */
-        acc_off_gain_reset = BMI3_SET_BIT_POS0(data_array[0], BMI3_ACC_OFF_GAIN_RESET, acc_off_gain_reset);
+        /* Get the exact range value */
+        map_accel_range(acc_cfg->range, &range);
 
-        /* Set gyro offset gain reset */
-        gyr_off_gain_reset = BMI3_SET_BITS(data_array[0], BMI3_GYR_OFF_GAIN_RESET, gyr_off_gain_reset);
+        /* Get the smallest possible measurable acceleration level given the range and
+         * resolution */
+        lsb_per_g = (uint16_t)(power(2, dev->resolution) / (2 * range));
 
-        acc_gyr_off_gain_reset[0] = (acc_off_gain_reset | gyr_off_gain_reset);
+        /* Compensate acceleration data against gravity */
+        comp_for_gravity(lsb_per_g, accel_g_value, accel_avg, &delta);
 
-        /* Set the configurations back to the feature engine register */
-        rslt = bmi3_set_regs(BMI3_REG_FEATURE_DATA_TX, acc_gyr_off_gain_reset, 2, dev);
+        /* Scale according to offset register resolution */
+        scale_accel_offset(range, &delta, &offset, dev);
+
+        /* Invert the accelerometer offset data */
+        invert_accel_offset(&offset);
+
+        /* Write offset data in the offset compensation register */
+        rslt = bmi3_set_acc_dp_off_dgain(&offset, dev);
     }
 
     return rslt;
 }
 
-/***************************************************************************/
-
-/*!                   Local Function Definitions
- ****************************************************************************/
-
 /*!
- * @brief This internal API sets accelerometer configurations like ODR, accel mode,
- * bandwidth, average samples and range.
+ * @brief This internal API converts the accelerometer range value into
+ * corresponding integer value.
  */
-static int8_t set_accel_config(struct bmi3_accel_config *config, struct bmi3_dev *dev)
+static void map_accel_range(uint8_t range_in, uint8_t *range_out)
 {
-    /* Variable to store result of API */
-    int8_t rslt;
-
-    /* Variable to store data */
-    uint8_t reg_data[2] = { 0 };
-
-    uint16_t odr, range, bwp, avg_num, acc_mode;
-
-    if (config != NULL)
+    switch (range_in)
     {
-        /* Validate bandwidth and averaging samples */
-        rslt = validate_bw_avg_acc_mode(&config->bwp, &config->acc_mode, &config->avg_num, dev);
+        case BMI3_ACC_RANGE_2G:
+            *range_out = 2;
+            break;
+        case BMI3_ACC_RANGE_4G:
+            *range_out = 4;
+            break;
+        case BMI3_ACC_RANGE_8G:
+            *range_out = 8;
+            break;
+        case BMI3_ACC_RANGE_16G:
+            *range_out = 16;
+            break;
+        default:
 
-        if (rslt == BMI3_OK)
-        {
-            /* Validate ODR and range */
-            rslt = validate_acc_odr_range(&config->odr, &config->range, dev);
-        }
+            /* By default RANGE 8G is set */
+            *range_out = 8;
+            break;
+    }
+}
 
-        if (rslt == BMI3_OK)
-        {
-            if (config->acc_mode == BMI3_ACC_MODE_LOW_PWR)
-            {
-                rslt = validate_acc_odr_avg(config->odr, config->avg_num);
-            }
+/*!
+ * @brief This internal API is used to calculate the power of a value.
+ */
+static int32_t power(int16_t base, uint8_t resolution)
+{
+    /* Initialize loop */
+    uint8_t loop = 1;
 
-            if ((config->acc_mode == BMI3_ACC_MODE_NORMAL) || (config->acc_mode == BMI3_ACC_MODE_HIGH_PERF))
-            {
-                if ((config->odr >= BMI3_ACC_ODR_0_78HZ) && (config->odr <= BMI3_ACC_ODR_6_25HZ))
-                {
-                    rslt = BMI3_E_ACC_INVALID_CFG;
-                }
-            }
-        }
+    /* Initialize variable to store the power of 2 value */
+    int32_t value = 1;
 
-        if (rslt == BMI3_OK)
-        {
-            /* Set accelerometer ODR */
-            odr = BMI3_SET_BIT_POS0(reg_data[0], BMI3_ACC_ODR, config->odr);
+    for (; loop <= resolution; loop++)
+    {
+        value = (int32_t)(value * base);
+    }
 
-            /* Set accelerometer range */
-            range = BMI3_SET_BITS(reg_data[0], BMI3_ACC_RANGE, config->range);
+    return value;
+}
 
-            /* Set accelerometer bandwidth */
-            bwp = BMI3_SET_BITS(reg_data[0], BMI3_ACC_BW, config->bwp);
+/*!
+ * @brief This internal API compensate the accelerometer data against gravity.
+ */
+static void comp_for_gravity(uint16_t lsb_per_g,
+                             const struct bmi3_accel_foc_g_value *g_val,
+                             const struct bmi3_sens_axes_data *data,
+                             struct bmi3_offset_delta *comp_data)
+{
+    /* Array to store the accelerometer values in LSB */
+    int16_t accel_value_lsb[3] = { 0 };
 
-            /* Set accelerometer average number of samples */
-            avg_num = BMI3_SET_BITS(reg_data[1], BMI3_ACC_AVG_NUM, config->avg_num);
+    /* Convert g-value to LSB */
+    accel_value_lsb[BMI3_X_AXIS] = (int16_t)(lsb_per_g * g_val->x);
+    accel_value_lsb[BMI3_Y_AXIS] = (int16_t)(lsb_per_g * g_val->y);
+    accel_value_lsb[BMI3_Z_AXIS] = (int16_t)(lsb_per_g * g_val->z);
 
-            /* Set accelerometer accel mode */
-            acc_mode = BMI3_SET_BITS(reg_data[1], BMI3_ACC_MODE, config->acc_mode);
+    /* Get the compensated values for X, Y and Z axis */
+    comp_data->x = (data->x - accel_value_lsb[BMI3_X_AXIS]);
+    comp_data->y = (data->y - accel_value_lsb[BMI3_Y_AXIS]);
+    comp_data->z = (data->z - accel_value_lsb[BMI3_Z_AXIS]);
+}
 
-            reg_data[0] = (uint8_t)(odr | range | bwp);
-            reg_data[1] = (uint8_t)((avg_num | acc_mode) >> 8);
+/*!
+ * @brief This internal API scales the compensated accelerometer data according
+ * to the offset register resolution.
+ *
+ * @note The bit position is always greater than 0 since accelerometer data is
+ * 16 bit wide.
+ */
+static void scale_accel_offset(uint8_t range,
+                               const struct bmi3_offset_delta *comp_data,
+                               struct bmi3_acc_dp_gain_offset *data,
+                               const struct bmi3_dev *dev)
+{
+    uint8_t bit_pos;
+    uint8_t scale_factor;
 
-            /* Set configurations for accel */
-            rslt = bmi3_set_regs(BMI3_REG_ACC_CONF, reg_data, 2, dev);
-        }
-        else
-        {
-            rslt = BMI3_E_ACC_INVALID_CFG;
-        }
-    }
-    else
+    switch (range)
     {
-        rslt = BMI3_E_NULL_PTR;
+        case BMI3_ACC_2G:
+            bit_pos = BMI3_ACC_2G_BIT_POS;
+            break;
+        case BMI3_ACC_4G:
+            bit_pos = BMI3_ACC_4G_BIT_POS;
+            break;
+        case BMI3_ACC_8G:
+            bit_pos = BMI3_ACC_8G_BIT_POS;
+            break;
+        case BMI3_ACC_16G:
+            bit_pos = BMI3_ACC_16G_BIT_POS;
+            break;
+        default:
+            bit_pos = 4;
+            break;
     }
 
-    return rslt;
+    scale_factor = (uint8_t)power(2, bit_pos);
+
+    data->acc_dp_off_x = (uint16_t)((comp_data->x * scale_factor) & dev->accel_bit_width);
+    data->acc_dp_off_y = (uint16_t)((comp_data->y * scale_factor) & dev->accel_bit_width);
+    data->acc_dp_off_z = (uint16_t)((comp_data->z * scale_factor) & dev->accel_bit_width);
 }
 
 /*!
- * @brief This internal API gets accelerometer configurations like ODR,
- * bandwidth, accel mode, average samples and gravity range.
+ * @brief This internal API inverts the accelerometer offset data.
  */
-static int8_t get_accel_config(struct bmi3_accel_config *config, struct bmi3_dev *dev)
+static void invert_accel_offset(struct bmi3_acc_dp_gain_offset *offset_data)
 {
-    /* Variable to store result of API */
-    int8_t rslt;
-
-    /* Array to store data */
-    uint8_t data_array[2] = { 0 };
-
-    uint16_t reg_data;
-
-    if (config != NULL)
-    {
-        /* Read the sensor configuration details */
-        rslt = bmi3_get_regs(BMI3_REG_ACC_CONF, data_array, 2, dev);
-
-        if (rslt == BMI3_OK)
-        {
-            reg_data = data_array[0];
-
-            /* Get accelerometer ODR */
-            config->odr = BMI3_GET_BIT_POS0(reg_data, BMI3_ACC_ODR);
+    /* Get the offset data */
+    offset_data->acc_dp_off_x = (uint16_t)((offset_data->acc_dp_off_x) * (BMI3_FOC_INVERT_VALUE));
+    offset_data->acc_dp_off_y = (uint16_t)((offset_data->acc_dp_off_y) * (BMI3_FOC_INVERT_VALUE));
+    offset_data->acc_dp_off_z = (uint16_t)((offset_data->acc_dp_off_z) * (BMI3_FOC_INVERT_VALUE));
+}
 
-            /* Get accelerometer range */
-            config->range = BMI3_GET_BITS(reg_data, BMI3_ACC_RANGE);
+#ifdef BMI330
 
-            /* Get accelerometer bandwidth */
-            config->bwp = BMI3_GET_BITS(reg_data, BMI3_ACC_BW);
+/*!
+ * @brief This internal API sets the individual gyroscope
+ * filter coefficients in the respective dma registers.
+ */
+static int8_t set_gyro_filter_coefficients(struct bmi3_dev *dev)
+{
+    int8_t rslt;
 
-            reg_data = (uint16_t)data_array[1] << 8;
+    uint8_t gyro_filter_coeff_base_addr[2] = { BMI3_BASE_ADDR_GYRO_SC_ST_COEFFICIENTS, 0x00 };
 
-            /* Get accelerometer average samples */
-            config->avg_num = BMI3_GET_BITS(reg_data, BMI3_ACC_AVG_NUM);
+    rslt = bmi3_set_regs(BMI3_REG_FEATURE_DATA_ADDR, gyro_filter_coeff_base_addr, 2, dev);
 
-            /* Get accel mode */
-            config->acc_mode = BMI3_GET_BITS(reg_data, BMI3_ACC_MODE);
-        }
-    }
-    else
+    if (rslt == BMI3_OK)
     {
-        rslt = BMI3_E_NULL_PTR;
+        rslt = bmi3_set_regs(BMI3_REG_FEATURE_DATA_TX, bmi3_sc_st_coeff, BMI3_SC_ST_COEFF_LEN, dev);
     }
 
     return rslt;
 }
 
 /*!
- * @brief This internal API validates bandwidth and accel mode of the
- * accelerometer set by the user.
+ * @brief This internal API checks whether the gyro self-calibration/self-test
+ * coefficients read back from the feature engine have to be rewritten.
  */
-static int8_t validate_bw_avg_acc_mode(uint8_t *bandwidth, uint8_t *acc_mode, uint8_t *avg_num, struct bmi3_dev *dev)
+static uint8_t sc_st_coeff_differ(const uint8_t *data)
 {
-    /* Variable to store result of API */
-    int8_t rslt;
+    /* Variable to define loop */
+    uint8_t index;
 
-    if ((bandwidth != NULL) && (acc_mode != NULL) && (avg_num != NULL))
-    {
-        /* Validate and auto-correct accel mode */
-        rslt = check_boundary_val(acc_mode, BMI3_ACC_MODE_DISABLE, BMI3_ACC_MODE_HIGH_PERF, dev);
+    /* Variable to store whether a word other than word 3 differs */
+    uint8_t differ = BMI3_DISABLE;
 
-        if (rslt == BMI3_OK)
+    for (index = 0; index < BMI3_SC_ST_COEFF_LEN; index += 2)
+    {
+        if ((index != 6) &&
+            ((data[index] != bmi3_sc_st_coeff[index]) || (data[index + 1] != bmi3_sc_st_coeff[index + 1])))
         {
-            /* Validate for averaging number of samples */
-            rslt = check_boundary_val(avg_num, BMI3_ACC_AVG1, BMI3_ACC_AVG64, dev);
-
-            if (rslt == BMI3_OK)
-            {
-                /* Validate bandwidth */
-                rslt = check_boundary_val(bandwidth, BMI3_ACC_BW_ODR_HALF, BMI3_ACC_BW_ODR_QUARTER, dev);
-            }
+            differ = BMI3_ENABLE;
         }
     }
-    else
+
+    /* Set is kept if word 3 matches */
+    if ((data[6] == bmi3_sc_st_coeff[6]) && (data[7] == bmi3_sc_st_coeff[7]))
     {
-        rslt = BMI3_E_NULL_PTR;
+        differ = BMI3_DISABLE;
     }
 
-    return rslt;
+    return differ;
 }
+#endif
 
 /*!
- * @brief This internal API validates ODR and range of the accelerometer set by
- * the user.
+ * @brief This internal API is used to validate ODR and AVG combinations for accel
  */
-static int8_t validate_acc_odr_range(uint8_t *odr, uint8_t *range, struct bmi3_dev *dev)
+static int8_t validate_acc_odr_avg(uint8_t acc_odr, uint8_t acc_avg)
 {
-    /* Variable to store result of API */
-    int8_t rslt;
-
-    if ((odr != NULL) && (range != NULL))
-    {
-        /* Validate and auto correct ODR */
-        rslt = check_boundary_val(odr, BMI3_ACC_ODR_0_78HZ, BMI3_ACC_ODR_6400HZ, dev);
+    int8_t rslt = BMI3_E_ACC_INVALID_CFG;
 
-        if (rslt == BMI3_OK)
-        {
-            /* Validate and auto correct Range */
-            rslt = check_boundary_val(range, BMI3_ACC_RANGE_2G, BMI3_ACC_RANGE_16G, dev);
-        }
-    }
-    else
+    if ((acc_odr < BMI3_ODR_AVG_VALID_COUNT) && (acc_avg <= BMI3_ACC_AVG64) &&
+        (bmi3_odr_avg_valid[acc_odr] & (UINT8_C(1) << acc_avg)))
     {
-        rslt = BMI3_E_NULL_PTR;
+        rslt = BMI3_OK;
     }
 
     return rslt;
 }
 
 /*!
- * @brief This internal API is used to validate the boundary conditions.
+ * @brief This internal API is used to validate ODR and AVG combinations for gyro
  */
-static int8_t check_boundary_val(uint8_t *val, uint8_t min, uint8_t max, struct bmi3_dev *dev)
+static int8_t validate_gyr_odr_avg(uint8_t gyr_odr, uint8_t gyr_avg)
 {
-    /* Variable to store result of API */
-    int8_t rslt;
-
-    /* Null-pointer check */
-    rslt = null_ptr_check(dev);
-
-    if ((rslt == BMI3_OK) && (val != NULL))
-    {
-        /* Check if value is below minimum value */
-        if (*val < min)
-        {
-            /* Auto correct the invalid value to minimum value */
-            *val = min;
-            dev->info |= BMI3_I_MIN_VALUE;
-        }
+    int8_t rslt = BMI3_E_GYRO_INVALID_CFG;
 
-        /* Check if value is above maximum value */
-        if (*val > max)
-        {
-            /* Auto correct the invalid value to maximum value */
-            *val = max;
-            dev->info |= BMI3_I_MAX_VALUE;
-        }
-    }
-    else
+    if ((gyr_odr < BMI3_ODR_AVG_VALID_COUNT) && (gyr_avg <= BMI3_GYR_AVG64) &&
+        (bmi3_odr_avg_valid[gyr_odr] & (UINT8_C(1) << gyr_avg)))
     {
-        rslt = BMI3_E_NULL_PTR;
+        rslt = BMI3_OK;
     }
 
     return rslt;
 }
 
 /*!
- * @brief This internal API sets gyroscope configurations like ODR,
- * bandwidth, gyro mode, average samples and dps range.
+ * @brief This internal API writes the command register value to enable cfg res.
  */
-static int8_t set_gyro_config(struct bmi3_gyro_config *config, struct bmi3_dev *dev)
+static int8_t config_array_set_command(struct bmi3_dev *dev)
 {
-    /* Variable to store result of API */
+    /* Variable to define error */
     int8_t rslt;
 
-    /* Variable to store data */
-    uint8_t reg_data[2] = { 0 };
+    /* Array to read feature engine GP1 error status */
+    uint8_t feature_engine_gp_1[2] = { 0 };
 
-    uint16_t odr, range, bwp, avg_num, gyr_mode;
+    /* Array to get default value of cfg res register */
+    uint8_t cfg_res[2] = { 0 };
 
-    if (config != NULL)
-    {
-        /* Validate bandwidth, average samples and mode */
-        rslt = validate_bw_avg_gyr_mode(&config->bwp, &config->gyr_mode, &config->avg_num, dev);
+    /* Get error status of feature engine GP1 register */
+    rslt = bmi3_get_regs(BMI3_REG_FEATURE_IO1, feature_engine_gp_1, 2, dev);
 
-        if (rslt == BMI3_OK)
-        {
-            /* Validate ODR and range */
-            rslt = validate_gyr_odr_range(&config->odr, &config->range, dev);
-        }
+    /* Check whether feature engine is activated in error status */
+    if ((rslt == BMI3_OK) && (feature_engine_gp_1[0] == BMI3_FEAT_ENG_ACT_MASK))
+    {
+        /* Read default value of cfg res address */
+        rslt = bmi3_get_regs(BMI3_REG_CFG_RES, cfg_res, 2, dev);
+    }
 
-        if (rslt == BMI3_OK)
-        {
-            if (config->gyr_mode == BMI3_GYR_MODE_LOW_PWR)
-            {
-                rslt = validate_gyr_odr_avg(config->odr, config->avg_num);
-            }
-        }
+    /* Burst write the command register value to enable cfg res */
+    if (rslt == BMI3_OK)
+    {
+        rslt = bmi3_set_command_register(BMI3_CMD_2, dev);
 
         if (rslt == BMI3_OK)
         {
-            /* Set gyroscope ODR */
-            odr = BMI3_SET_BIT_POS0(reg_data[0], BMI3_GYR_ODR, config->odr);
-
-            /* Set gyroscope range */
-            range = BMI3_SET_BITS(reg_data[0], BMI3_GYR_RANGE, config->range);
-
-            /* Set gyroscope bandwidth */
-            bwp = BMI3_SET_BITS(reg_data[0], BMI3_GYR_BW, config->bwp);
-
-            /* Set gyroscope average sample */
-            avg_num = BMI3_SET_BITS(reg_data[1], BMI3_GYR_AVG_NUM, config->avg_num);
-
-            /* Set gyroscope mode */
-            gyr_mode = BMI3_SET_BITS(reg_data[1], BMI3_GYR_MODE, config->gyr_mode);
-
-            reg_data[0] = (uint8_t)(odr | range | bwp);
-            reg_data[1] = (uint8_t)((avg_num | gyr_mode) >> 8);
-
-            /* Set gyro configurations */
-            rslt = bmi3_set_regs(BMI3_REG_GYR_CONF, reg_data, 2, dev);
-        }
-        else
-        {
-            rslt = BMI3_E_GYRO_INVALID_CFG;
+            rslt = bmi3_set_command_register(BMI3_CMD_1, dev);
         }
     }
-    else
-    {
-        rslt = BMI3_E_NULL_PTR;
-    }
 
     return rslt;
 }
 
 /*!
- * @brief This internal API validates bandwidth, average samples and gyr mode of the
- * gyroscope set by the user.
+ * @brief This internal API sets the value_one to feature engine in cfg res.
  */
-static int8_t validate_bw_avg_gyr_mode(uint8_t *bandwidth,
-                                       uint8_t *gyr_mode,
-                                       const uint8_t *avg_num,
-                                       struct bmi3_dev *dev)
+static int8_t config_array_set_value_one_page(struct bmi3_dev *dev)
 {
-    /* Variable to store result of API */
+    /* Variable to define error */
     int8_t rslt;
 
-    if ((bandwidth != NULL) && (gyr_mode != NULL) && (avg_num != NULL))
-    {
-        /* Validate and auto-correct gyro mode */
-        rslt = check_boundary_val(gyr_mode, BMI3_GYR_MODE_DISABLE, BMI3_GYR_MODE_HIGH_PERF, dev);
+    /* Array to get value of cfg res register after writing the command register */
+    uint8_t cfg_res[2] = { 0 };
 
-        if (rslt == BMI3_OK)
-        {
-            /* Validate for averaging mode */
-            rslt = check_boundary_val(bandwidth, BMI3_GYR_AVG1, BMI3_GYR_AVG64, dev);
+    /* Array to store value_one */
+    uint8_t cfg_res_value[2] = { BMI3_CFG_RES_VALUE_ONE, BMI3_CFG_RES_MASK };
 
-            if (rslt == BMI3_OK)
-            {
-                /* Validate for bandwidth */
-                rslt = check_boundary_val(bandwidth, BMI3_GYR_BW_ODR_HALF, BMI3_GYR_BW_ODR_QUARTER, dev);
-            }
-        }
-    }
-    else
+    /* Read cfg res address */
+    rslt = bmi3_get_regs(BMI3_REG_CFG_RES, cfg_res, 2, dev);
+
+    if ((rslt == BMI3_OK) && (cfg_res[1] == BMI3_CFG_RES_MASK))
     {
-        rslt = BMI3_E_NULL_PTR;
+        rslt = bmi3_set_regs(BMI3_REG_CFG_RES, cfg_res_value, 2, dev);
     }
 
     return rslt;
 }
 
 /*!
- * @brief This internal API validates ODR and range of the gyroscope set by
- * the user.
+ * @brief This internal API writes the config array.
  */
-static int8_t validate_gyr_odr_range(uint8_t *odr, uint8_t *range, struct bmi3_dev *dev)
+static int8_t write_config_array(struct bmi3_dev *dev)
 {
-    /* Variable to store result of API */
+    /* Variable to define error */
     int8_t rslt;
 
-    if ((odr != NULL) && (range != NULL))
+    /* Array to reset the BMI3_REG_CFG_RES register */
+    uint8_t reset[2] = { 0 };
+
+    /* Variable to store whether the config array is already loaded */
+    uint8_t loaded = BMI3_DISABLE;
+
+    /* Skip the upload if the sensor kept the config array, e.g. on a reset of the host only */
+    rslt = bmi3_check_config_array(bmi3_config_version, bmi3_config_array_code, sizeof(bmi3_config_array_code), &loaded, dev);
+
+    if ((rslt == BMI3_OK) && (loaded == BMI3_DISABLE))
     {
-        /* Validate and auto correct ODR */
-        rslt = check_boundary_val(odr, BMI3_GYR_ODR_0_78HZ, BMI3_GYR_ODR_6400HZ, dev);
+        /* Download config code array */
+        rslt = bmi3_upload_config_array(bmi3_config_array_code, sizeof(bmi3_config_array_code), dev);
 
         if (rslt == BMI3_OK)
         {
-            /* Validate and auto correct Range */
-            rslt = check_boundary_val(range, BMI3_GYR_RANGE_125DPS, BMI3_GYR_RANGE_2000DPS, dev);
+            /* Download config array table array */
+            rslt = bmi3_upload_config_array(bmi3_config_array_table, sizeof(bmi3_config_array_table), dev);
+
+            if (rslt == BMI3_OK)
+            {
+                /* Download config version */
+                rslt = write_config_version(dev);
+            }
         }
     }
-    else
+
+    if (rslt == BMI3_OK)
     {
-        rslt = BMI3_E_NULL_PTR;
+        /* Reset the BMI3_REG_CFG_RES to return back to user page */
+        rslt = bmi3_set_regs(BMI3_REG_CFG_RES, reset, 2, dev);
     }
 
     return rslt;
 }
 
 /*!
- * @brief This internal API stores the accelerometer, sensortime and accel saturation data from the register.
+ * @brief This internal API reads back an uploaded config array and compares
+ * it with the given array.
  */
-static int8_t get_accel_sensortime_sat_data(struct bmi3_sens_axes_data *data, const uint8_t *reg_data)
+static int8_t verify_config_array(const uint8_t *config_array, uint16_t config_size, struct bmi3_dev *dev)
 {
-    /* Variable to store result of API */
-    int8_t rslt = BMI3_OK;
-
-    /* Stores the accel x, y, z axis, sensortime and accel saturation data from register */
-    uint16_t acc_data[6];
+    /* Variable to define error */
+    int8_t rslt;
 
-    if ((data != NULL) && (reg_data != NULL))
-    {
-        acc_data[0] = (reg_data[0] | (uint16_t)reg_data[1] << 8);
-        acc_data[1] = (reg_data[2] | (uint16_t)reg_data[3] << 8);
-        acc_data[2] = (reg_data[4] | (uint16_t)reg_data[5] << 8);
-        acc_data[3] = (reg_data[14] | (uint16_t)reg_data[15] << 8);
-        acc_data[4] = (reg_data[16] | (uint16_t)reg_data[17] << 8);
-        acc_data[5] = reg_data[18];
+    /* Array to store the data read back */
+    uint8_t data[BMI3_UPLOAD_VERIFY_LEN];
 
-        /* Stores accel x-axis data */
-        data->x = (int16_t)acc_data[0];
+    /* Variables to loop */
+    uint16_t indx;
+    uint16_t pos;
 
-        /* Stores accel y-axis data */
-        data->y = (int16_t)acc_data[1];
+    /* Variable to store the number of bytes read at once */
+    uint16_t len = 0;
 
-        /* Stores accel z-axis data */
-        data->z = (int16_t)acc_data[2];
+    /* First two bytes of config array denotes the base address */
+    rslt = bmi3_set_regs(BMI3_REG_FEATURE_DATA_ADDR, config_array, 2, dev);
 
-        /* Stores sensor time data */
-        data->sens_time = (acc_data[3] | ((uint32_t)acc_data[4] << 16));
+    for (indx = BMI3_CONFIG_ARRAY_DATA_START_ADDR; (rslt == BMI3_OK) && (indx < config_size); indx += len)
+    {
+        len = (uint16_t)(config_size - indx);
 
-        /* Stores saturation x-axis data */
-        data->sat_x = (acc_data[5] & BMI3_SATF_ACC_X_MASK);
+        if (len > BMI3_UPLOAD_VERIFY_LEN)
+        {
+            len = BMI3_UPLOAD_VERIFY_LEN;
+        }
 
-        /* Stores saturation y-axis data */
-        data->sat_y = (acc_data[5] & BMI3_SATF_ACC_Y_MASK) >> BMI3_SATF_ACC_Y_POS;
+        rslt = bmi3_get_regs(BMI3_REG_FEATURE_DATA_TX, data, len, dev);
 
-        /* Stores saturation z-axis data */
-        data->sat_z = (acc_data[5] & BMI3_SATF_ACC_Z_MASK) >> BMI3_SATF_ACC_Z_POS;
-    }
-    else
-    {
-        rslt = BMI3_E_NULL_PTR;
+        for (pos = 0; (rslt == BMI3_OK) && (pos < len); pos++)
+        {
+            if (data[pos] != config_array[indx + pos])
+            {
+                rslt = BMI3_E_CONFIG_VERIFY;
+            }
+        }
     }
 
     return rslt;
 }
 
 /*!
- * @brief This internal API stores the gyroscope, sensortime and gyro saturation data from the register.
+ * @brief This internal API writes config version array to feature engine register.
  */
-static int8_t get_gyro_sensortime_sat_data(struct bmi3_sens_axes_data *data, const uint8_t *reg_data)
+static int8_t write_config_version(struct bmi3_dev *dev)
 {
-    /* Variable to store result of API */
-    int8_t rslt = BMI3_OK;
-
-    /* Variable to store x, y and z axis gyro data */
-    uint16_t gyr_data[6];
-
-    if ((data != NULL) && (reg_data != NULL))
-    {
-        gyr_data[0] = (reg_data[6] | (uint16_t)reg_data[7] << 8);
-        gyr_data[1] = (reg_data[8] | (uint16_t)reg_data[9] << 8);
-        gyr_data[2] = (reg_data[10] | (uint16_t)reg_data[11] << 8);
-        gyr_data[3] = (reg_data[14] | (uint16_t)reg_data[15] << 8);
-        gyr_data[4] = (reg_data[16] | (uint16_t)reg_data[17] << 8);
-        gyr_data[5] = reg_data[18];
-
-        /* Stores gyro x-axis data */
-        data->x = (int16_t)gyr_data[0];
-
-        /* Stores gyro y-axis data */
-        data->y = (int16_t)gyr_data[1];
-
-        /* Stores gyro z-axis data */
-        data->z = (int16_t)gyr_data[2];
-
-        /* Stores sensor time data */
-        data->sens_time = (gyr_data[3] | ((uint32_t)gyr_data[4] << 16));
+    /* Variable to define error */
+    int8_t rslt;
 
-        /* Stores saturation x-axis data */
-        data->sat_x = (gyr_data[5] & BMI3_SATF_GYR_X_MASK) >> BMI3_SATF_GYR_X_POS;
+    /* Index variable to store the start address of data */
+    uint8_t indx = BMI3_CONFIG_ARRAY_DATA_START_ADDR;
 
-        /* Stores saturation y-axis data */
-        data->sat_y = (gyr_data[5] & BMI3_SATF_GYR_Y_MASK) >> BMI3_SATF_GYR_Y_POS;
+    /* Set the config array base address to feature engine transmission address to start DMA transaction */
+    rslt = bmi3_set_regs(BMI3_REG_FEATURE_DATA_ADDR, bmi3_config_version, 2, dev);
 
-        /* Stores saturation z-axis data */
-        data->sat_z = (gyr_data[5] & BMI3_SATF_GYR_Z_MASK) >> BMI3_SATF_GYR_Z_POS;
-    }
-    else
+    if (rslt == BMI3_OK)
     {
-        rslt = BMI3_E_NULL_PTR;
+        /* Set the config version data to feature engine transmission data address to start DMA transaction */
+        rslt = bmi3_set_regs(BMI3_REG_FEATURE_DATA_TX, &bmi3_config_version[indx], 2, dev);
     }
 
     return rslt;
 }
 
 /*!
- * @brief This internal API reads the raw temperature data from the register and can be
- * converted into degree celsius.
+ * @brief This internal API submits an asynchronous read.
  */
-static int8_t get_temp_sensortime_data(struct bmi3_sens_axes_data *data, const uint8_t *reg_data)
+static int8_t async_submit(uint8_t reg_addr, uint8_t *data, uint32_t len, uint8_t state, struct bmi3_dev *dev)
 {
     /* Variable to store result of API */
     int8_t rslt = BMI3_OK;
 
-    if ((data != NULL) && (reg_data != NULL))
+    /* Configuring reg_addr for SPI Interface */
+    if (dev->intf == BMI3_SPI_INTF)
     {
-        data->temp_data = (uint16_t)(reg_data[12] | ((uint16_t)reg_data[13] << 8));
-
-        /* Stores sensor time data */
-        data->sens_time =
-            (reg_data[14] | (uint16_t)reg_data[15] << 8 | (uint32_t)reg_data[16] << 16 | (uint32_t)reg_data[17] << 24);
+        reg_addr = (reg_addr | BMI3_SPI_RD_MASK);
     }
-    else
+
+    /* State is updated before the transfer, since it can complete before the function returns */
+    dev->async.state = state;
+
+    /* Insert the idle time if the previous access was a write */
+    insert_idle_time(dev);
+
+    dev->intf_rslt = dev->read_async(reg_addr, data, len, dev->intf_ptr);
+
+    if (dev->intf_rslt != BMI3_INTF_RET_SUCCESS)
     {
-        rslt = BMI3_E_NULL_PTR;
+        dev->async.state = BMI3_ASYNC_IDLE;
+        rslt = BMI3_E_COM_FAIL;
     }
 
+#ifdef BMI3_BUS_STATS
+
+    /* Transfer runs in background, only the submission is timed */
+    bus_stats_record(reg_addr, BMI3_DISABLE, len, bus_stats_start(dev), rslt, dev);
+#endif
+
     return rslt;
 }
 
 /*!
- * @brief This internal API gets the step counter data from the register.
+ * @brief This internal API checks whether an asynchronous request can be started.
  */
-static int8_t get_step_counter_sensor_data(uint32_t *step_count, uint8_t reg_addr, struct bmi3_dev *dev)
+static int8_t async_check(const struct bmi3_dev *dev)
 {
     /* Variable to store result of API */
     int8_t rslt;
 
-    /* Array to define data stored in register */
-    uint8_t reg_data[4] = { 0 };
+    rslt = null_ptr_check(dev);
 
-    if (step_count != NULL)
+    if ((rslt == BMI3_OK) && (dev->read_async == NULL))
     {
-        /* Read the sensor data */
-        rslt = bmi3_get_regs(reg_addr, reg_data, 4, dev);
-
-        if (rslt == BMI3_OK)
-        {
-            /* Get the step counter output in 4 bytes */
-            *step_count = (uint32_t) reg_data[0];
-            *step_count |= ((uint32_t) reg_data[1] << 8);
-            *step_count |= ((uint32_t) reg_data[2] << 16);
-            *step_count |= ((uint32_t) reg_data[3] << 24);
-        }
+        rslt = BMI3_E_NULL_PTR;
     }
-    else
+    else if ((rslt == BMI3_OK) && (dev->async.state != BMI3_ASYNC_IDLE))
     {
-        rslt = BMI3_E_NULL_PTR;
+        rslt = BMI3_E_BUSY;
     }
 
     return rslt;
 }
 
 /*!
- * @brief This internal API gets the output values of orientation: portrait-
- * landscape and face up-down.
+ * @brief This internal API parses the data of a completed asynchronous transfer.
  */
-static int8_t get_orient_output_data(struct bmi3_orientation_output *orient_out, uint8_t reg_addr, struct bmi3_dev *dev)
+static int8_t async_parse(struct bmi3_dev *dev)
 {
     /* Variable to store result of API */
-    int8_t rslt;
+    int8_t rslt = BMI3_OK;
 
-    /* Array to define data stored in register */
-    uint8_t reg_data[2] = { 0 };
+    /* Variable to define loop */
+    uint8_t loop;
 
-    if (orient_out != NULL)
-    {
-        /* Read the data from feature engine status register */
-        rslt = bmi3_get_regs(reg_addr, reg_data, 2, dev);
+    /* Pointer to the data next to the dummy bytes */
+    const uint8_t *reg_data = &dev->async.buf[dev->dummy_byte];
 
-        if (rslt == BMI3_OK)
-        {
-            /* Get the output value of the orientation detection feature */
-            orient_out->orientation_portrait_landscape = BMI3_GET_BIT_POS0(reg_data[0],
-                                                                           BMI3_ORIENTATION_PORTRAIT_LANDSCAPE);
+    /* Pointer to the sensor data of the request */
+    struct bmi3_sensor_data *sensor_data = dev->async.sensor_data;
 
-            /* Get the output value of the orientation face up-down feature */
-            orient_out->orientation_faceup_down = BMI3_GET_BITS(reg_data[0], BMI3_ORIENTATION_FACEUP_DOWN);
-        }
-    }
-    else
+    switch (dev->async.state)
     {
-        rslt = BMI3_E_NULL_PTR;
-    }
+        case BMI3_ASYNC_FIFO_CONF:
 
-    return rslt;
-}
+            /* Get sensor enable status, of which the data is to be read */
+            dev->async.fifo->available_fifo_sens =
+                (uint16_t)(((reg_data[0]) | ((uint16_t) reg_data[1] << 8)) & BMI3_FIFO_ALL_EN);
+            dev->async.fifo->layout = get_fifo_frame_layout(dev->async.fifo->available_fifo_sens);
+            break;
 
-/*!
- * @brief This internal API gets gyroscope configurations like ODR, gyro mode,
- * bandwidth, averaging samples and range.
- */
-static int8_t get_gyro_config(struct bmi3_gyro_config *config, struct bmi3_dev *dev)
-{
-    /* Variable to store result of API */
-    int8_t rslt;
+        case BMI3_ASYNC_FIFO_DATA:
 
-    /* Array to store data */
-    uint8_t data_array[2] = { 0 };
+            /* FIFO data is already in the buffer of the user */
+            break;
 
-    uint16_t reg_data;
+        case BMI3_ASYNC_SENSOR_DATA:
+            for (loop = 0; (loop < dev->async.n_sens) && (rslt == BMI3_OK); loop++)
+            {
+                if (sensor_data[loop].type == BMI3_ACCEL)
+                {
+                    rslt = get_accel_sensortime_sat_data(&sensor_data[loop].sens_data.acc, reg_data);
+                }
+                else if (sensor_data[loop].type == BMI3_GYRO)
+                {
+                    rslt = get_gyro_sensortime_sat_data(&sensor_data[loop].sens_data.gyr, reg_data);
+                }
+                else
+                {
+                    rslt = get_temp_sensortime_data(&sensor_data[loop].sens_data.temp, reg_data);
+                }
+            }
 
-    if (config != NULL)
-    {
-        /* Read the sensor configuration details */
-        rslt = bmi3_get_regs(BMI3_REG_GYR_CONF, data_array, 2, dev);
+            break;
 
-        if (rslt == BMI3_OK)
-        {
-            reg_data = data_array[0];
+        case BMI3_ASYNC_INT_STATUS:
+            *dev->async.int1_status = (uint16_t)(reg_data[0] | ((uint16_t)reg_data[1] << 8));
+            *dev->async.int2_status = (uint16_t)(reg_data[2] | ((uint16_t)reg_data[3] << 8));
+            break;
 
-            /* Get gyro ODR */
-            config->odr = BMI3_GET_BIT_POS0(reg_data, BMI3_GYR_ODR);
+        case BMI3_ASYNC_FIFO_SERVICE:
+            *dev->async.int1_status = (uint16_t)(reg_data[0] | ((uint16_t)reg_data[1] << 8));
+            *dev->async.int2_status = (uint16_t)(reg_data[2] | ((uint16_t)reg_data[3] << 8));
 
-            /* Get gyro range */
-            config->range = BMI3_GET_BITS(reg_data, BMI3_GYR_RANGE);
+            dev->async.fifo->available_fifo_len =
+                (uint16_t)(reg_data[BMI3_FIFO_SERVICE_FILL_LEVEL_POS] |
+                           ((uint16_t)reg_data[BMI3_FIFO_SERVICE_FILL_LEVEL_POS + 1] << 8)) & BMI3_FIFO_FILL_LEVEL_MASK;
 
-            /* Get gyro bandwidth */
-            config->bwp = BMI3_GET_BITS(reg_data, BMI3_GYR_BW);
+            if (!((*dev->async.int1_status | *dev->async.int2_status) & (BMI3_INT_STATUS_FWM | BMI3_INT_STATUS_FFULL)))
+            {
+                /* No FIFO interrupt is pending */
+                dev->async.fifo->available_fifo_len = 0;
+            }
+            else if (dev->async.fifo->available_fifo_len == 0)
+            {
+                rslt = BMI3_W_FIFO_EMPTY;
+            }
+            else
+            {
+                /* Read the available FIFO data, limited by the buffer */
+                dev->async.fifo_len = (uint16_t)(dev->async.fifo->available_fifo_len * 2 + dev->dummy_byte);
 
-            reg_data = (uint16_t)data_array[1] << 8;
+                if (dev->async.fifo_len > dev->async.fifo->length)
+                {
+                    dev->async.fifo_len = dev->async.fifo->length;
+                }
+            }
 
-            /* Get gyro average sample */
-            config->avg_num = BMI3_GET_BITS(reg_data, BMI3_GYR_AVG_NUM);
+            break;
 
-            /* Get gyro mode */
-            config->gyr_mode = BMI3_GET_BITS(reg_data, BMI3_GYR_MODE);
-        }
-    }
-    else
-    {
-        rslt = BMI3_E_NULL_PTR;
+        default:
+            rslt = BMI3_E_INVALID_STATUS;
+            break;
     }
 
     return rslt;
 }
 
 /*!
- * @brief This internal API is used to validate the device structure pointer for
- * null conditions.
+ * @brief This internal API inserts the idle time required before an access,
+ * if the previous access was a write.
  */
-static int8_t null_ptr_check(const struct bmi3_dev *dev)
+static void insert_idle_time(struct bmi3_dev *dev)
 {
-    int8_t rslt;
-
-    if ((dev == NULL) || (dev->read == NULL) || (dev->write == NULL) || (dev->delay_us == NULL))
-    {
-        rslt = BMI3_E_NULL_PTR;
-    }
-    else
+    if (dev->idle_pending == BMI3_ENABLE)
     {
-        /* Device structure is fine */
-        rslt = BMI3_OK;
-    }
+        if (dev->idle_due_us != 0)
+        {
+            dev->delay_us(dev->idle_due_us, dev->intf_ptr);
+        }
 
-    return rslt;
+        dev->idle_pending = BMI3_DISABLE;
+    }
 }
 
 /*!
- * @brief This internal API is used to get the enabled feature.
+ * @brief This internal API stages feature engine data to be written by
+ * "flush_feature_batch".
  */
-static int8_t get_feature_enable(struct bmi3_feature_enable *enable, struct bmi3_dev *dev)
+static int8_t stage_feature_data(uint8_t base_addr, const uint8_t *data, uint8_t len, struct bmi3_feature_batch *batch)
 {
     /* Variable to store result of API */
     int8_t rslt = BMI3_OK;
 
-    uint8_t feature[2];
-    uint8_t reg_data;
-    uint16_t feature_config;
+    /* Variable to define index */
+    uint8_t index;
 
-    if (enable != NULL)
+    if ((base_addr + ((len + 1) / 2)) <= BMI3_FEATURE_BATCH_MAX_WORDS)
     {
-        rslt = bmi3_get_regs(BMI3_REG_FEATURE_IO0, feature, 2, dev);
-
-        if (rslt == BMI3_OK)
+        for (index = 0; index < len; index++)
         {
-            reg_data = feature[0];
-            enable->no_motion_x_en = BMI3_GET_BIT_POS0(reg_data, BMI3_NO_MOTION_X_EN);
-            enable->no_motion_y_en = BMI3_GET_BITS(reg_data, BMI3_NO_MOTION_Y_EN);
-            enable->no_motion_z_en = BMI3_GET_BITS(reg_data, BMI3_NO_MOTION_Z_EN);
-            enable->any_motion_x_en = BMI3_GET_BITS(reg_data, BMI3_ANY_MOTION_X_EN);
-            enable->any_motion_y_en = BMI3_GET_BITS(reg_data, BMI3_ANY_MOTION_Y_EN);
-            enable->any_motion_z_en = BMI3_GET_BITS(reg_data, BMI3_ANY_MOTION_Z_EN);
-            enable->flat_en = BMI3_GET_BITS(reg_data, BMI3_FLAT_EN);
-            enable->orientation_en = BMI3_GET_BITS(reg_data, BMI3_ORIENTATION_EN);
-
-            feature_config = (uint16_t)feature[1] << 8;
+            batch->data[(base_addr * 2) + index] = data[index];
+        }
 
-            enable->step_detector_en = BMI3_GET_BITS(feature_config, BMI3_STEP_DETECTOR_EN);
-            enable->step_counter_en = BMI3_GET_BITS(feature_config, BMI3_STEP_COUNTER_EN);
-            enable->sig_motion_en = BMI3_GET_BITS(feature_config, BMI3_SIG_MOTION_EN);
-            enable->tilt_en = BMI3_GET_BITS(feature_config, BMI3_TILT_EN);
-            enable->tap_detector_s_tap_en = BMI3_GET_BITS(feature_config, BMI3_TAP_DETECTOR_S_TAP_EN);
-            enable->tap_detector_d_tap_en = BMI3_GET_BITS(feature_config, BMI3_TAP_DETECTOR_D_TAP_EN);
-            enable->tap_detector_t_tap_en = BMI3_GET_BITS(feature_config, BMI3_TAP_DETECTOR_T_TAP_EN);
-            enable->i3c_sync_en = BMI3_GET_BITS(feature_config, BMI3_I3C_SYNC_EN);
+        for (index = 0; index < ((len + 1) / 2); index++)
+        {
+            batch->dirty |= ((uint64_t)1 << (base_addr + index));
         }
     }
+    else
+    {
+        rslt = BMI3_E_INVALID_INPUT;
+    }
 
     return rslt;
 }
 
 /*!
- * @brief This internal API is used to set the feature.
+ * @brief This internal API writes the staged feature engine data, each run
+ * of consecutive words with a single base address and data transfer.
  */
-static int8_t set_feature_enable(const struct bmi3_feature_enable *enable, struct bmi3_dev *dev)
+static int8_t flush_feature_batch(struct bmi3_feature_batch *batch, struct bmi3_dev *dev)
 {
     /* Variable to store result of API */
-    int8_t rslt;
+    int8_t rslt = BMI3_OK;
 
-    uint8_t feature[2] = { 0 };
-    uint8_t get_feature[2];
+    /* Array to set the base address of the feature */
+    uint8_t base_addr[2] = { 0 };
 
-    /* Array variable to clear feature before enabling into register */
-    uint8_t reset[2] = { 0 };
+    /* Variables to define first and next to last word of a run */
+    uint8_t start = 0, end;
 
-    /* Array to set feature_engine_gp_status in order to enable the feature */
-    uint8_t gp_status[2] = { 1, 0 };
+    /* Variable to define number of words written at once */
+    uint8_t max_words = (uint8_t)(dev->read_write_len / 2);
 
-    if (enable != NULL)
+    if ((max_words == 0) || (max_words > BMI3_FEATURE_BATCH_MAX_WORDS))
     {
-        rslt = bmi3_get_regs(BMI3_REG_FEATURE_IO0, get_feature, 2, dev);
+        max_words = BMI3_FEATURE_BATCH_MAX_WORDS;
+    }
 
-        if (rslt == BMI3_OK)
+    while ((rslt == BMI3_OK) && (start < BMI3_FEATURE_BATCH_MAX_WORDS))
+    {
+        if (batch->dirty & ((uint64_t)1 << start))
         {
-            feature[0] =
-                (uint8_t)(BMI3_SET_BIT_POS0(get_feature[0], BMI3_NO_MOTION_X_EN,
-                                            enable->no_motion_x_en) & BMI3_NO_MOTION_X_EN_MASK);
-            feature[0] |=
-                (uint8_t)(BMI3_SET_BITS(get_feature[0], BMI3_NO_MOTION_Y_EN,
-                                        enable->no_motion_y_en) & BMI3_NO_MOTION_Y_EN_MASK);
-            feature[0] |=
-                (uint8_t)(BMI3_SET_BITS(get_feature[0], BMI3_NO_MOTION_Z_EN,
-                                        enable->no_motion_z_en) & BMI3_NO_MOTION_Z_EN_MASK);
-            feature[0] |=
-                (uint8_t)(BMI3_SET_BITS(get_feature[0], BMI3_ANY_MOTION_X_EN,
-                                        enable->any_motion_x_en) & BMI3_ANY_MOTION_X_EN_MASK);
-            feature[0] |=
-                (uint8_t)(BMI3_SET_BITS(get_feature[0], BMI3_ANY_MOTION_Y_EN,
-                                        enable->any_motion_y_en) & BMI3_ANY_MOTION_Y_EN_MASK);
-            feature[0] |=
-                (uint8_t)(BMI3_SET_BITS(get_feature[0], BMI3_ANY_MOTION_Z_EN,
-                                        enable->any_motion_z_en) & BMI3_ANY_MOTION_Z_EN_MASK);
-            feature[0] |= (uint8_t)(BMI3_SET_BITS(get_feature[0], BMI3_FLAT_EN, enable->flat_en) & BMI3_FLAT_EN_MASK);
-            feature[0] |=
-                (uint8_t)(BMI3_SET_BITS(get_feature[0], BMI3_ORIENTATION_EN,
-                                        enable->orientation_en) & BMI3_ORIENTATION_EN_MASK);
+            end = start;
 
-            feature[1] =
-                (uint8_t)((BMI3_SET_BITS(get_feature[1], BMI3_STEP_DETECTOR_EN,
-                                         enable->step_detector_en) & BMI3_STEP_DETECTOR_EN_MASK) >> 8);
-            feature[1] |=
-                (uint8_t)((BMI3_SET_BITS(get_feature[1], BMI3_STEP_COUNTER_EN,
-                                         enable->step_counter_en) & BMI3_STEP_COUNTER_EN_MASK) >> 8);
-            feature[1] |=
-                (uint8_t)((BMI3_SET_BITS(get_feature[1], BMI3_SIG_MOTION_EN,
-                                         enable->sig_motion_en) & BMI3_SIG_MOTION_EN_MASK) >> 8);
+            /* Extend the run over consecutive staged words */
+            while ((end < BMI3_FEATURE_BATCH_MAX_WORDS) && (batch->dirty & ((uint64_t)1 << end)) &&
+                   ((end - start) < max_words))
+            {
+                end++;
+            }
 
-            feature[1] |=
-                (uint8_t)((BMI3_SET_BITS(get_feature[1], BMI3_TILT_EN, enable->tilt_en) & BMI3_TILT_EN_MASK) >> 8);
+            /* Set the base address to feature engine transmission address to start DMA transaction */
+            base_addr[0] = start;
+            rslt = bmi3_set_regs(BMI3_REG_FEATURE_DATA_ADDR, base_addr, 2, dev);
 
-            feature[1] |=
-                (uint8_t)((BMI3_SET_BITS(get_feature[1], BMI3_TAP_DETECTOR_S_TAP_EN,
-                                         enable->tap_detector_s_tap_en) & BMI3_TAP_DETECTOR_S_TAP_EN_MASK) >> 8);
+            if (rslt == BMI3_OK)
+            {
+                rslt = bmi3_set_regs(BMI3_REG_FEATURE_DATA_TX,
+                                     &batch->data[start * 2],
+                                     (uint16_t)((end - start) * 2),
+                                     dev);
+            }
 
-            feature[1] |=
-                (uint8_t)((BMI3_SET_BITS(get_feature[1], BMI3_TAP_DETECTOR_D_TAP_EN,
-                                         enable->tap_detector_d_tap_en) & BMI3_TAP_DETECTOR_D_TAP_EN_MASK) >> 8);
+            start = end;
+        }
+        else
+        {
+            start++;
+        }
+    }
 
-            feature[1] |=
-                (uint8_t)((BMI3_SET_BITS(get_feature[1], BMI3_TAP_DETECTOR_T_TAP_EN,
-                                         enable->tap_detector_t_tap_en) & BMI3_TAP_DETECTOR_T_TAP_EN_MASK) >> 8);
+    batch->dirty = 0;
 
-            feature[1] |=
-                (uint8_t)((BMI3_SET_BITS(get_feature[1], BMI3_I3C_SYNC_EN,
-                                         enable->i3c_sync_en) & BMI3_I3C_SYNC_EN_MASK) >> 8);
+    return rslt;
+}
 
-            /* Reset the register before updating new values */
-            rslt = bmi3_set_regs(BMI3_REG_FEATURE_IO0, reset, 2, dev);
+/*!
+ * @brief This internal API invalidates the shadow register cache.
+ */
+static void invalidate_reg_cache(struct bmi3_dev *dev)
+{
+    dev->cache.reg_valid = 0;
+    dev->cache.feature_valid = 0;
+    dev->cache.feature_addr = 0;
+    dev->cache.feature_addr_sync = BMI3_DISABLE;
+    dev->cache.feature_page = 0;
+
+    /* Feature engine contents are not known either, the next image is written in full */
+    dev->feature_image = NULL;
+}
 
-            if (rslt == BMI3_OK)
+/*!
+ * @brief This internal API reads the data from the shadow register cache.
+ */
+static uint8_t cache_read(uint8_t reg_addr, uint8_t *data, uint16_t len, struct bmi3_dev *dev)
+{
+    /* Variable to store whether the data is available in the cache */
+    uint8_t hit = BMI3_DISABLE;
+
+    /* Variable to define loop */
+    uint16_t index;
+
+    /* Variable to store number of words */
+    uint16_t words = (uint16_t)((len + 1) / 2);
+
+    /* Variable to store mask of the words to be read */
+    uint64_t mask;
+
+    if ((dev->cache.enable == BMI3_ENABLE) && (words != 0))
+    {
+        if (reg_addr == BMI3_REG_FEATURE_DATA_TX)
+        {
+            if ((dev->cache.feature_page == 0) && (dev->cache.feature_addr >= BMI3_CACHE_FEATURE_START) &&
+                ((dev->cache.feature_addr + words) <= BMI3_FEATURE_BATCH_MAX_WORDS))
             {
-                rslt = bmi3_set_regs(BMI3_REG_FEATURE_IO0, feature, 2, dev);
+                mask = (((uint64_t)1 << words) - 1) << dev->cache.feature_addr;
+
+                if ((dev->cache.feature_valid & mask) == mask)
+                {
+                    for (index = 0; index < len; index++)
+                    {
+                        data[index] = dev->cache.feature[(dev->cache.feature_addr * 2) + index];
+                    }
+
+                    /* Transmission address of the sensor is not incremented, since it is not accessed */
+                    dev->cache.feature_addr += words;
+                    dev->cache.feature_addr_sync = BMI3_DISABLE;
+                    hit = BMI3_ENABLE;
+                }
             }
+        }
+        else if ((reg_addr >= BMI3_CACHE_REG_START) &&
+                 ((reg_addr + words) <= (BMI3_CACHE_REG_START + BMI3_CACHE_REG_COUNT)))
+        {
+            mask = (((uint64_t)1 << words) - 1) << (reg_addr - BMI3_CACHE_REG_START);
 
-            if (rslt == BMI3_OK)
+            if (((dev->cache.reg_valid & BMI3_CACHE_REG_MASK) & mask) == mask)
             {
-                rslt = bmi3_set_regs(BMI3_REG_FEATURE_IO_STATUS, gp_status, 2, dev);
+                for (index = 0; index < len; index++)
+                {
+                    data[index] = dev->cache.regs[((reg_addr - BMI3_CACHE_REG_START) * 2) + index];
+                }
+
+                hit = BMI3_ENABLE;
             }
         }
     }
-    else
-    {
-        rslt = BMI3_E_NULL_PTR;
-    }
 
-    return rslt;
+    return hit;
 }
 
 /*!
- * @brief This internal API gets the latch mode from register address
+ * @brief This internal API stores the data read from or written to the
+ * sensor in the shadow register cache.
  */
-static int8_t get_latch_mode(struct bmi3_int_pin_config *int_cfg, struct bmi3_dev *dev)
+static void cache_store(uint8_t reg_addr, const uint8_t *data, uint16_t len, struct bmi3_dev *dev)
 {
-    /* Variable to store result of API */
-    int8_t rslt;
+    /* Variable to define loop */
+    uint16_t index;
 
-    /* Variable to define data array */
-    uint8_t data_array[2] = { 0 };
+    /* Variable to store word address */
+    uint16_t word;
 
-    if (int_cfg != NULL)
+    if (dev->cache.enable == BMI3_ENABLE)
     {
-        rslt = bmi3_get_regs(BMI3_REG_INT_CONF, data_array, 2, dev);
+        for (index = 0; index < ((len + 1) / 2); index++)
+        {
+            if (reg_addr == BMI3_REG_FEATURE_DATA_TX)
+            {
+                word = dev->cache.feature_addr + index;
 
-        if (rslt == BMI3_OK)
+                if ((dev->cache.feature_page == 0) && (word >= BMI3_CACHE_FEATURE_START) &&
+                    (word < BMI3_FEATURE_BATCH_MAX_WORDS))
+                {
+                    /* A partially transferred word is not known */
+                    if (((index * 2) + 1) < len)
+                    {
+                        dev->cache.feature[word * 2] = data[index * 2];
+                        dev->cache.feature[(word * 2) + 1] = data[(index * 2) + 1];
+                        dev->cache.feature_valid |= ((uint64_t)1 << word);
+                    }
+                    else
+                    {
+                        dev->cache.feature_valid &= ~((uint64_t)1 << word);
+                    }
+                }
+            }
+            else
+            {
+                word = (uint16_t)(reg_addr + index);
+
+                if ((word >= BMI3_CACHE_REG_START) && (word < (BMI3_CACHE_REG_START + BMI3_CACHE_REG_COUNT)))
+                {
+                    word -= BMI3_CACHE_REG_START;
+
+                    if ((((index * 2) + 1) < len) && ((BMI3_CACHE_REG_MASK >> word) & 1))
+                    {
+                        dev->cache.regs[word * 2] = data[index * 2];
+                        dev->cache.regs[(word * 2) + 1] = data[(index * 2) + 1];
+                        dev->cache.reg_valid |= ((uint32_t)1 << word);
+                    }
+                    else
+                    {
+                        dev->cache.reg_valid &= ~((uint32_t)1 << word);
+                    }
+                }
+            }
+        }
+
+        /* Transmission address is incremented for each word transferred */
+        if (reg_addr == BMI3_REG_FEATURE_DATA_TX)
         {
-            int_cfg->int_latch = BMI3_GET_BIT_POS0(data_array[0], BMI3_INT_LATCH);
+            dev->cache.feature_addr += (uint16_t)(len / 2);
         }
     }
-    else
-    {
-        rslt = BMI3_E_NULL_PTR;
-    }
-
-    return rslt;
 }
 
 /*!
- * @brief This internal API sets the latch mode to register address
+ * @brief This internal API updates the shadow register cache on a write to
+ * the sensor.
  */
-static int8_t set_latch_mode(const struct bmi3_int_pin_config *int_cfg, struct bmi3_dev *dev)
+static void cache_write(uint8_t reg_addr, const uint8_t *data, uint16_t len, struct bmi3_dev *dev)
 {
-    /* Variable to store result of API */
-    int8_t rslt;
+    if (dev->cache.enable == BMI3_ENABLE)
+    {
+        switch (reg_addr)
+        {
+            case BMI3_REG_CMD:
 
-    /* Variable to define data array */
-    uint8_t data_array[2] = { 0 };
+                /* Commands like soft-reset, self-test and self-calibration update the configurations */
+                invalidate_reg_cache(dev);
+                break;
 
-    if (int_cfg != NULL)
-    {
-        rslt = bmi3_get_regs(BMI3_REG_INT_CONF, data_array, 2, dev);
+            case BMI3_REG_CFG_RES:
 
-        if (rslt == BMI3_OK)
-        {
-            /* Configure the interrupt mode */
-            data_array[0] = BMI3_SET_BIT_POS0(data_array[0], BMI3_INT_LATCH, int_cfg->int_latch);
+                /* Feature engine words of other pages are not cached */
+                dev->cache.feature_page = data[0];
+                dev->cache.feature_valid = 0;
+                break;
 
-            rslt = bmi3_set_regs(BMI3_REG_INT_CONF, data_array, 2, dev);
+            case BMI3_REG_FEATURE_DATA_ADDR:
+                if (len >= 2)
+                {
+                    dev->cache.feature_addr = (uint16_t)(data[0] | ((uint16_t)data[1] << 8));
+                    dev->cache.feature_addr_sync = BMI3_ENABLE;
+                }
+
+                break;
+
+            default:
+                cache_store(reg_addr, data, len, dev);
+                break;
         }
     }
-    else
-    {
-        rslt = BMI3_E_NULL_PTR;
-    }
-
-    return rslt;
 }
 
 /*!
- * @brief This internal API gets any-motion configurations like threshold,
- * duration, accel reference up, hysteresis and wait time.
+ * @brief This internal API writes the feature engine transmission address to
+ * the sensor before an access to the transmission data register, if the
+ * previous access to it was served from the cache.
  */
-static int8_t get_any_motion_config(struct bmi3_any_motion_config *config, struct bmi3_dev *dev)
+static int8_t cache_sync_feature_addr(uint8_t reg_addr, struct bmi3_dev *dev)
 {
     /* Variable to store result of API */
-    int8_t rslt;
+    int8_t rslt = BMI3_OK;
 
-    /* Array to define the feature configuration */
-    uint8_t any_mot_config[6] = { 0 };
+    /* Array to set the transmission address */
+    uint8_t base_addr[2];
 
-    /* Array to set the base address of any-motion feature */
-    uint8_t base_addr[2] = { BMI3_BASE_ADDR_ANY_MOTION, 0 };
+    if ((dev->cache.enable == BMI3_ENABLE) && (reg_addr == BMI3_REG_FEATURE_DATA_TX) &&
+        (dev->cache.feature_addr_sync != BMI3_ENABLE))
+    {
+        base_addr[0] = (uint8_t)(dev->cache.feature_addr & BMI3_SET_LOW_BYTE);
+        base_addr[1] = (uint8_t)((dev->cache.feature_addr & BMI3_SET_HIGH_BYTE) >> 8);
 
-    uint8_t idx = 0;
+        rslt = bmi3_set_regs(BMI3_REG_FEATURE_DATA_ADDR, base_addr, 2, dev);
+    }
 
-    /* Variable to define LSB */
-    uint16_t lsb;
+    return rslt;
+}
 
-    /* Variable to define MSB */
-    uint16_t msb;
+/*!
+ * @brief This internal API tunes the FIFO water-mark level as per the host
+ * budget of bmi3_dev, if accel or gyro configuration is set.
+ */
+static int8_t retune_fifo_wm(const struct bmi3_sens_config *sens_cfg, uint8_t n_sens, struct bmi3_dev *dev)
+{
+    /* Variable to store result of API */
+    int8_t rslt = BMI3_OK;
 
-    /* Variable to define a word */
-    uint16_t lsb_msb;
+    /* Variable to define loop */
+    uint8_t loop;
 
-    if (config != NULL)
+    if (dev->fifo_wm_budget != NULL)
     {
-        /* Set the any-motion base address to feature engine transmission address to start DMA transaction */
-        rslt = bmi3_set_regs(BMI3_REG_FEATURE_DATA_ADDR, base_addr, 2, dev);
-
-        if (rslt == BMI3_OK)
+        for (loop = 0; loop < n_sens; loop++)
         {
-            /* Get the configuration from the feature engine register where any-motion feature resides */
-            rslt = bmi3_get_regs(BMI3_REG_FEATURE_DATA_TX, any_mot_config, 6, dev);
-
-            if (rslt == BMI3_OK)
+            if ((sens_cfg[loop].type == BMI3_ACCEL) || (sens_cfg[loop].type == BMI3_GYRO))
             {
-                /* Get word to calculate threshold and accel reference up from same word */
-                lsb = (uint16_t) any_mot_config[idx++];
-                msb = ((uint16_t) any_mot_config[idx++] << 8);
-                lsb_msb = (lsb | msb);
-
-                /* Get threshold */
-                config->slope_thres = (lsb_msb & BMI3_ANY_NO_SLOPE_THRESHOLD_MASK);
+                rslt = bmi3_tune_fifo_wm(dev->fifo_wm_budget, dev);
+                break;
+            }
+        }
+    }
 
-                /* Get accel reference up */
-                config->acc_ref_up = (lsb_msb & BMI3_ANY_NO_ACC_REF_UP_MASK) >> BMI3_ANY_NO_ACC_REF_UP_POS;
+    return rslt;
+}
 
-                /* Get word to calculate hysteresis from the word */
-                lsb = (uint16_t) any_mot_config[idx++];
-                msb = ((uint16_t) any_mot_config[idx++] << 8);
-                lsb_msb = (lsb | msb);
+/*!
+ * @brief This internal API starts the FIFO read of the next device of a group.
+ */
+static void group_read_next(struct bmi3_dev_group *group)
+{
+    /* Variable to store index of the device */
+    uint8_t idx = group->next_read;
 
-                /* Get hysteresis */
-                config->hysteresis = (lsb_msb & BMI3_ANY_NO_HYSTERESIS_MASK);
+    /* Pointer to the device */
+    struct bmi3_dev *dev;
 
-                /* Get word to calculate duration and wait time from the same word */
-                lsb = (uint16_t) any_mot_config[idx++];
-                msb = ((uint16_t) any_mot_config[idx++] << 8);
-                lsb_msb = (lsb | msb);
+    if (idx < group->n_dev)
+    {
+        dev = group->dev[idx];
+        group->fifo[idx].length = group->slot_len;
+        group->next_read++;
 
-                /* Get duration */
-                config->duration = (lsb_msb & BMI3_ANY_NO_DURATION_MASK);
+        if (dev->read_async != NULL)
+        {
+            group->rslt[idx] = bmi3_async_fifo_service(&group->int1_status[idx],
+                                                       &group->int2_status[idx],
+                                                       &group->fifo[idx],
+                                                       NULL,
+                                                       dev);
 
-                /* Get wait time */
-                config->wait_time = (lsb_msb & BMI3_ANY_NO_WAIT_TIME_MASK) >> BMI3_ANY_NO_WAIT_TIME_POS;
+            if (group->rslt[idx] == BMI3_OK)
+            {
+                /* Result is taken once the transfer is complete */
+                group->rslt[idx] = BMI3_E_BUSY;
             }
         }
+        else
+        {
+            group->rslt[idx] = bmi3_fifo_service(&group->int1_status[idx],
+                                                 &group->int2_status[idx],
+                                                 &group->fifo[idx],
+                                                 dev);
+        }
     }
-    else
+}
+
+/*!
+ * @brief This internal API locks the device, if a lock function is set.
+ */
+static void lock_dev(const struct bmi3_dev *dev)
+{
+    if ((dev != NULL) && (dev->lock != NULL))
     {
-        rslt = BMI3_E_NULL_PTR;
+        dev->lock(dev->intf_ptr);
     }
-
-    return rslt;
 }
 
 /*!
- * @brief This internal API sets any-motion configurations like threshold,
- * duration, accel reference up, hysteresis and wait time.
+ * @brief This internal API unlocks the device, if an unlock function is set.
  */
-static int8_t set_any_motion_config(const struct bmi3_any_motion_config *config, struct bmi3_dev *dev)
+static void unlock_dev(const struct bmi3_dev *dev)
 {
-    /* Variable to store result of API */
-    int8_t rslt;
-
-    /* Array to set the base address of any-motion feature */
-    uint8_t base_addr[2] = { BMI3_BASE_ADDR_ANY_MOTION, 0 };
-
-    /* Array to define the feature configuration */
-    uint8_t any_mot_config[6] = { 0 };
-
-    uint16_t threshold, acc_ref_up, hysteresis, duration, wait_time;
-
-    if (config != NULL)
+    if ((dev != NULL) && (dev->unlock != NULL))
     {
-        /* Set the any-motion base address to feature engine transmission address to start DMA transaction */
-        rslt = bmi3_set_regs(BMI3_REG_FEATURE_DATA_ADDR, base_addr, 2, dev);
+        dev->unlock(dev->intf_ptr);
+    }
+}
 
-        if (rslt == BMI3_OK)
+/*!
+ * @brief This internal API begins a batch of bus operations, if a batch begin
+ * function is set.
+ */
+static void begin_batch(struct bmi3_dev *dev)
+{
+    if ((dev != NULL) && (dev->batch_begin != NULL) && (dev->batch_end != NULL))
+    {
+        if (dev->batch_depth == 0)
         {
-            /* Set threshold for lsb 8 bits */
-            any_mot_config[0] = (uint8_t)BMI3_SET_BIT_POS0(any_mot_config[0],
-                                                           BMI3_ANY_NO_SLOPE_THRESHOLD,
-                                                           config->slope_thres);
-
-            threshold = ((uint16_t)any_mot_config[1] << 8);
-
-            /* Set threshold for msb 8 bits */
-            any_mot_config[1] =
-                (BMI3_SET_BIT_POS0(threshold, BMI3_ANY_NO_SLOPE_THRESHOLD,
-                                   config->slope_thres) & BMI3_ANY_NO_SLOPE_THRESHOLD_MASK) >> 8;
-
-            acc_ref_up = ((uint16_t)any_mot_config[1] << 8);
+            dev->batch_begin(dev->intf_ptr);
+        }
 
-            /* Set accel reference */
-            any_mot_config[1] |=
-                (BMI3_SET_BITS(acc_ref_up, BMI3_ANY_NO_ACC_REF_UP,
-                               config->acc_ref_up) & BMI3_ANY_NO_ACC_REF_UP_MASK) >> 8;
+        dev->batch_depth++;
+    }
+}
 
-            /* Set hysteresis for lsb 8 bits */
-            any_mot_config[2] =
-                (uint8_t)BMI3_SET_BIT_POS0(any_mot_config[2], BMI3_ANY_NO_HYSTERESIS, config->hysteresis);
+/*!
+ * @brief This internal API ends a batch of bus operations and submits the
+ * queued operations, if a batch end function is set.
+ */
+static int8_t end_batch(int8_t rslt, struct bmi3_dev *dev)
+{
+    if ((dev != NULL) && (dev->batch_begin != NULL) && (dev->batch_end != NULL) && (dev->batch_depth != 0))
+    {
+        dev->batch_depth--;
 
-            hysteresis = ((uint16_t)any_mot_config[3] << 8);
+        if (dev->batch_depth == 0)
+        {
+            /* Queued operations are submitted even if the batch failed, to leave the bus idle */
+            dev->intf_rslt = dev->batch_end(dev->intf_ptr);
 
-            /* Set hysteresis for msb 8 bits */
-            any_mot_config[3] =
-                (BMI3_SET_BIT_POS0(hysteresis, BMI3_ANY_NO_HYSTERESIS,
-                                   config->hysteresis) & BMI3_ANY_NO_HYSTERESIS_MASK) >> 8;
+            if ((rslt == BMI3_OK) && (dev->intf_rslt != BMI3_INTF_RET_SUCCESS))
+            {
+                rslt = BMI3_E_COM_FAIL;
+            }
+        }
+    }
 
-            /* Set duration for lsb 8 bits */
-            any_mot_config[4] = (uint8_t)BMI3_SET_BIT_POS0(any_mot_config[4], BMI3_ANY_NO_DURATION, config->duration);
+    return rslt;
+}
 
-            duration = ((uint16_t)any_mot_config[5] << 8);
+/*!
+ * @brief This internal API sets the unit conversion scale factor of the
+ * accelerometer or gyroscope for the given range and the resolution of the device.
+ */
+static void set_unit_scale(uint8_t sens_type, uint8_t range, struct bmi3_dev *dev)
+{
+    /* Variable to store full scale of the range in g or degree per second */
+    uint32_t full_scale;
 
-            /* Set duration for msb 8 bits */
-            any_mot_config[5] =
-                (BMI3_SET_BIT_POS0(duration, BMI3_ANY_NO_DURATION, config->duration) & BMI3_ANY_NO_DURATION_MASK) >> 8;
+    /* Variables to store fixed-point and float scale factors */
+    int32_t scale_q = 0;
+    float scale_f = 0.0f;
 
-            wait_time = ((uint16_t)any_mot_config[5] << 8);
+    if (sens_type == BMI3_ACCEL)
+    {
+        full_scale = UINT32_C(2) << range;
+    }
+    else
+    {
+        full_scale = UINT32_C(125) << range;
+    }
 
-            /* Set wait time */
-            any_mot_config[5] |=
-                (BMI3_SET_BITS(wait_time, BMI3_ANY_NO_WAIT_TIME, config->wait_time) & BMI3_ANY_NO_WAIT_TIME_MASK) >> 8;
+    /* Half of the signed data range corresponds to the full scale */
+    if ((dev->resolution > 0) && (dev->resolution <= (BMI3_UNIT_Q_FRAC_BITS + 1)))
+    {
+        scale_q = (int32_t)((full_scale << BMI3_UNIT_Q_FRAC_BITS) >> (dev->resolution - 1));
+        scale_f = (float)full_scale / (float)(UINT32_C(1) << (dev->resolution - 1));
+    }
 
-            /* Set the configuration back to the feature engine register */
-            rslt = bmi3_set_regs(BMI3_REG_FEATURE_DATA_TX, any_mot_config, 6, dev);
-        }
+    if (sens_type == BMI3_ACCEL)
+    {
+        dev->unit_scale.acc_q = scale_q;
+        dev->unit_scale.acc_f = scale_f;
     }
     else
     {
-        rslt = BMI3_E_NULL_PTR;
+        dev->unit_scale.gyr_q = scale_q;
+        dev->unit_scale.gyr_f = scale_f;
     }
-
-    return rslt;
 }
 
 /*!
- * @brief This internal API gets no-motion configurations like threshold,
- * duration, accel reference up, hysteresis and wait time.
+ * @brief This internal API applies the correction of the accelerometer or gyro
+ * data to the x, y and z data of a frame.
  */
-static int8_t get_no_motion_config(struct bmi3_no_motion_config *config, struct bmi3_dev *dev)
+static void correct_axes(int16_t *x, int16_t *y, int16_t *z, const struct bmi3_axes_correction *corr)
 {
-    /* Variable to store result of API */
-    int8_t rslt;
-
-    /* Array to define the feature configuration */
-    uint8_t no_mot_config[6] = { 0 };
-
-    /* Array to set the base address of no-motion feature */
-    uint8_t base_addr[2] = { BMI3_BASE_ADDR_NO_MOTION, 0 };
+    /* Variable to define loop */
+    uint8_t row;
 
-    /* Variable to define array offset */
-    uint8_t idx = 0;
+    /* Variables to store the data before and after correction */
+    int32_t in[3];
+    int32_t out;
 
-    /* Variable to define LSB */
-    uint16_t lsb;
+    /* Array of pointers to the data of x, y and z axis */
+    int16_t *data[3];
 
-    /* Variable to define MSB */
-    uint16_t msb;
+    data[BMI3_X_AXIS] = x;
+    data[BMI3_Y_AXIS] = y;
+    data[BMI3_Z_AXIS] = z;
 
-    /* Variable to define a word */
-    uint16_t lsb_msb;
+    in[BMI3_X_AXIS] = *x;
+    in[BMI3_Y_AXIS] = *y;
+    in[BMI3_Z_AXIS] = *z;
 
-    if (config != NULL)
+    for (row = 0; row < 3; row++)
     {
-        /* Set the no-motion base address to feature engine transmission address to start DMA transaction */
-        rslt = bmi3_set_regs(BMI3_REG_FEATURE_DATA_ADDR, base_addr, 2, dev);
+        out = (corr->matrix[row][0] * in[0]) + (corr->matrix[row][1] * in[1]) + (corr->matrix[row][2] * in[2]);
+        out = ((out - corr->offset[row]) * (int32_t)corr->gain[row]) / (INT32_C(1) << BMI3_AXES_CORR_GAIN_FRAC_BITS);
 
-        if (rslt == BMI3_OK)
+        /* Saturate to the range of the data */
+        if (out > BMI3_AXES_CORR_DATA_MAX)
         {
-            /* Get the configuration from the feature engine register where no-motion feature resides */
-            rslt = bmi3_get_regs(BMI3_REG_FEATURE_DATA_TX, no_mot_config, 6, dev);
+            out = BMI3_AXES_CORR_DATA_MAX;
+        }
+        else if (out < BMI3_AXES_CORR_DATA_MIN)
+        {
+            out = BMI3_AXES_CORR_DATA_MIN;
+        }
 
-            if (rslt == BMI3_OK)
-            {
-                /* Get word to calculate threshold and accel reference up from same word */
-                lsb = (uint16_t) no_mot_config[idx++];
-                msb = ((uint16_t) no_mot_config[idx++] << 8);
-                lsb_msb = (uint16_t)(lsb | msb);
+        *data[row] = (int16_t)out;
+    }
+}
+
+#ifdef BMI3_BUS_STATS
 
-                /* Get threshold */
-                config->slope_thres = (lsb_msb & BMI3_ANY_NO_SLOPE_THRESHOLD_MASK);
+/*!
+ * @brief This internal API gets the timestamp at the start of a transaction,
+ * 0 if no timestamp function is set.
+ */
+static uint32_t bus_stats_start(const struct bmi3_dev *dev)
+{
+    /* Variable to store timestamp */
+    uint32_t timestamp = 0;
 
-                /* Get accel reference up */
-                config->acc_ref_up = (lsb_msb & BMI3_ANY_NO_ACC_REF_UP_MASK) >> BMI3_ANY_NO_ACC_REF_UP_POS;
+    if (dev->timestamp_us != NULL)
+    {
+        timestamp = dev->timestamp_us(dev->intf_ptr);
+    }
 
-                /* Get word to calculate hysteresis */
-                lsb = (uint16_t) no_mot_config[idx++];
-                msb = ((uint16_t) no_mot_config[idx++] << 8);
-                lsb_msb = (uint16_t)(lsb | msb);
+    return timestamp;
+}
 
-                /* Get hysteresis */
-                config->hysteresis = (lsb_msb & BMI3_ANY_NO_HYSTERESIS_MASK);
+/*!
+ * @brief This internal API records a transaction in the bus statistics.
+ */
+static void bus_stats_record(uint8_t reg_addr,
+                             uint8_t is_write,
+                             uint32_t len,
+                             uint32_t start,
+                             int8_t rslt,
+                             struct bmi3_dev *dev)
+{
+    /* Variable to store time of the transaction */
+    uint32_t elapsed = bus_stats_start(dev) - start;
 
-                /* Get word to calculate duration and wait time from same word */
-                lsb = (uint16_t) no_mot_config[idx++];
-                msb = ((uint16_t) no_mot_config[idx++] << 8);
-                lsb_msb = (uint16_t)(lsb | msb);
+    /* Variable to store histogram bin of the time */
+    uint8_t bin = 0;
 
-                /* Get duration */
-                config->duration = (lsb_msb & BMI3_ANY_NO_DURATION_MASK);
+    /* Register address without the SPI read bit */
+    reg_addr = reg_addr & (BMI3_BUS_STATS_REGS - 1);
 
-                /* Get wait time */
-                config->wait_time = (lsb_msb & BMI3_ANY_NO_WAIT_TIME_MASK) >> BMI3_ANY_NO_WAIT_TIME_POS;
-            }
-        }
+    if (is_write == BMI3_ENABLE)
+    {
+        dev->bus_stats.writes[reg_addr]++;
     }
     else
     {
-        rslt = BMI3_E_NULL_PTR;
+        dev->bus_stats.reads[reg_addr]++;
     }
 
-    return rslt;
+    dev->bus_stats.bytes[reg_addr] += len;
+    dev->bus_stats.time_us[reg_addr] += elapsed;
+
+    while ((elapsed != 0) && (bin < (BMI3_BUS_STATS_HIST_BINS - 1)))
+    {
+        elapsed >>= 1;
+        bin++;
+    }
+
+    dev->bus_stats.hist[bin]++;
+
+    if (rslt == BMI3_E_COM_FAIL)
+    {
+        dev->bus_stats.com_fail++;
+    }
 }
+#endif
 
 /*!
- * @brief This internal API sets no-motion configurations like threshold,
- * duration, accel reference up, hysteresis and wait time.
+ * @brief This internal API checks whether the sensor kept its state over a
+ * reset of the host.
  */
-static int8_t set_no_motion_config(const struct bmi3_no_motion_config *config, struct bmi3_dev *dev)
+static int8_t check_warm_start(struct bmi3_dev *dev)
 {
-    /* Variable to store result of API */
-    int8_t rslt;
+    /* Variable to define error */
+    int8_t rslt = BMI3_OK;
 
-    /* Array to set the base address of no-motion feature */
-    uint8_t base_addr[2] = { BMI3_BASE_ADDR_NO_MOTION, 0 };
+    /* Array to read the dummy byte */
+    uint8_t dummy_byte[2] = { 0 };
 
-    /* Array to define the feature configuration */
-    uint8_t no_mot_config[6] = { 0 };
+    /* Array to store the status register */
+    uint8_t status[2] = { 0 };
 
-    uint16_t threshold, acc_ref_up, hysteresis, duration, wait_time;
+    /* Array to store the feature engine status */
+    uint8_t feature_io[2] = { 0 };
 
-    if (config != NULL)
+    /* A dummy read switches the sensor to SPI, if it lost power */
+    if (dev->intf == BMI3_SPI_INTF)
     {
-        /* Set the no-motion base address to feature engine transmission address to start DMA transaction */
-        rslt = bmi3_set_regs(BMI3_REG_FEATURE_DATA_ADDR, base_addr, 2, dev);
+        rslt = bmi3_get_regs(BMI3_REG_CHIP_ID, dummy_byte, 2, dev);
+    }
 
-        if (rslt == BMI3_OK)
-        {
-            /* Set threshold for lsb 8 bits */
-            no_mot_config[0] = (uint8_t)BMI3_SET_BIT_POS0(no_mot_config[0],
-                                                          BMI3_ANY_NO_SLOPE_THRESHOLD,
-                                                          config->slope_thres);
+    if (rslt == BMI3_OK)
+    {
+        rslt = bmi3_get_regs(BMI3_REG_STATUS, status, 2, dev);
+    }
+
+    if (rslt == BMI3_OK)
+    {
+        rslt = bmi3_get_regs(BMI3_REG_FEATURE_IO1, feature_io, 2, dev);
+    }
 
-            threshold = ((uint16_t)no_mot_config[1] << 8);
+    if ((rslt == BMI3_OK) && ((status[0] & BMI3_POR_DETECTED_MASK) == 0) &&
+        ((feature_io[0] & BMI3_FEATURE_ENGINE_ENABLE_MASK) != 0))
+    {
+        dev->warm_started = BMI3_ENABLE;
+    }
 
-            /* Set threshold for msb 8 bits */
-            no_mot_config[1] =
-                (BMI3_SET_BIT_POS0(threshold, BMI3_ANY_NO_SLOPE_THRESHOLD,
-                                   config->slope_thres) & BMI3_ANY_NO_SLOPE_THRESHOLD_MASK) >> 8;
+    return rslt;
+}
 
-            acc_ref_up = ((uint16_t)no_mot_config[1] << 8);
+/*!
+ * @brief This internal API waits until the FIFO holds the given number of
+ * accel-only frames, reads them in bursts and provides their average for accel FOC.
+ */
+static int8_t get_fifo_average_of_accel_data(uint16_t sample_count,
+                                             uint8_t odr,
+                                             struct bmi3_foc_temp_value *temp_foc_data,
+                                             struct bmi3_dev *dev)
+{
+    /* Variable to store result of API */
+    int8_t rslt = BMI3_OK;
 
-            /* Set accel reference */
-            no_mot_config[1] |=
-                (BMI3_SET_BITS(acc_ref_up, BMI3_ANY_NO_ACC_REF_UP,
-                               config->acc_ref_up) & BMI3_ANY_NO_ACC_REF_UP_MASK) >> 8;
+    /* Array to store a burst of FIFO data, along with the dummy bytes */
+    uint8_t fifo_data[(BMI3_FOC_FIFO_CHUNK_FRAMES * BMI3_LENGTH_FIFO_ACC) + BMI3_MAX_DUMMY_BYTE] = { 0 };
 
-            /* Set hysteresis for lsb 8 bits */
-            no_mot_config[2] = (uint8_t)BMI3_SET_BIT_POS0(no_mot_config[2], BMI3_ANY_NO_HYSTERESIS, config->hysteresis);
+    /* Array to store the accel frames of a burst */
+    struct bmi3_fifo_sens_axes_data accel_data[BMI3_FOC_FIFO_CHUNK_FRAMES];
 
-            hysteresis = ((uint16_t)no_mot_config[3] << 8);
+    /* Structure to define the FIFO frame */
+    struct bmi3_fifo_frame fifo = { 0 };
 
-            /* Set hysteresis for msb 8 bits */
-            no_mot_config[3] =
-                (BMI3_SET_BIT_POS0(hysteresis, BMI3_ANY_NO_HYSTERESIS,
-                                   config->hysteresis) & BMI3_ANY_NO_HYSTERESIS_MASK) >> 8;
+    /* Correction of the accel data in use, offsets are computed from the uncorrected data */
+    const struct bmi3_axes_correction *acc_corr = dev->acc_corr;
 
-            /* Set duration for lsb 8 bits */
-            no_mot_config[4] = (uint8_t)BMI3_SET_BIT_POS0(no_mot_config[4], BMI3_ANY_NO_DURATION, config->duration);
+    /* Variable to store the sample period in microseconds */
+    uint32_t period_us = 0;
 
-            duration = ((uint16_t)no_mot_config[5] << 8);
+    /* Variable to store the time to wait in microseconds */
+    uint32_t wait_us;
 
-            /* Set duration for msb 8 bits */
-            no_mot_config[5] =
-                (BMI3_SET_BIT_POS0(duration, BMI3_ANY_NO_DURATION, config->duration) & BMI3_ANY_NO_DURATION_MASK) >> 8;
+    /* Variables to store the FIFO fill level and the level of all samples in words */
+    uint16_t fifo_len = 0;
+    uint16_t fifo_len_req = (uint16_t)(sample_count * (BMI3_LENGTH_FIFO_ACC / 2));
 
-            wait_time = ((uint16_t)no_mot_config[5] << 8);
+    /* Variables to count the samples */
+    uint16_t count = 0;
+    uint16_t frames;
+    uint16_t idx;
 
-            /* Set wait time */
-            no_mot_config[5] |=
-                (BMI3_SET_BITS(wait_time, BMI3_ANY_NO_WAIT_TIME, config->wait_time) & BMI3_ANY_NO_WAIT_TIME_MASK) >> 8;
+    /* Variable tries max BMI3_FOC_FIFO_TRY_CNT times for the FIFO fill level */
+    uint8_t try_cnt = BMI3_FOC_FIFO_TRY_CNT;
 
-            /* Set the configuration back to the feature engine register */
-            rslt = bmi3_set_regs(BMI3_REG_FEATURE_DATA_TX, no_mot_config, 6, dev);
-        }
+    if ((odr >= BMI3_ACC_ODR_0_78HZ) && (odr <= BMI3_ACC_ODR_6400HZ))
+    {
+        period_us = (uint32_t)(UINT64_C(1000000000) / (BMI3_ODR_6400HZ_MHZ >> (BMI3_ACC_ODR_6400HZ - odr)));
     }
     else
     {
-        rslt = BMI3_E_NULL_PTR;
+        rslt = BMI3_E_ACC_INVALID_CFG;
     }
 
-    return rslt;
-}
+    /* Wait for all samples at once, one sample period as margin */
+    wait_us = (uint32_t)((sample_count + 1u) * period_us);
 
-/*!
- * @brief This internal API gets flat configurations like theta, blocking,
- * hold-time, hysteresis, and slope threshold.
- */
-static int8_t get_flat_config(struct bmi3_flat_config *config, struct bmi3_dev *dev)
-{
-    /* Variable to store result of API */
-    int8_t rslt;
+    while ((rslt == BMI3_OK) && (fifo_len < fifo_len_req) && (try_cnt > 0))
+    {
+        dev->delay_us(wait_us, dev->intf_ptr);
 
-    /* Array to define the feature configuration */
-    uint8_t flat_config[4] = { 0 };
+        rslt = bmi3_get_fifo_length(&fifo_len, dev);
 
-    /* Array to set the base address of flat feature */
-    uint8_t base_addr[2] = { BMI3_BASE_ADDR_FLAT, 0 };
+        if (rslt == BMI3_W_FIFO_EMPTY)
+        {
+            rslt = BMI3_OK;
+        }
 
-    /* Variable to define the array offset */
-    uint8_t idx = 0;
+        /* Wait for the missing samples */
+        if (fifo_len < fifo_len_req)
+        {
+            wait_us = (uint32_t)((((fifo_len_req - fifo_len) / (BMI3_LENGTH_FIFO_ACC / 2)) + 1u) * period_us);
+        }
 
-    /* Variable to define LSB */
-    uint16_t lsb;
+        try_cnt--;
+    }
 
-    /* Variable to define MSB */
-    uint16_t msb;
+    if ((rslt == BMI3_OK) && (fifo_len < fifo_len_req))
+    {
+        rslt = BMI3_E_DATA_RDY_INT_FAILED;
+    }
 
-    /* Variable to define a word */
-    uint16_t lsb_msb;
+    dev->acc_corr = NULL;
 
-    if (config != NULL)
+    while ((rslt == BMI3_OK) && (count < sample_count))
     {
-        /* Set the flat base address to feature engine transmission address to start DMA transaction */
-        rslt = bmi3_set_regs(BMI3_REG_FEATURE_DATA_ADDR, base_addr, 2, dev);
+        frames = (uint16_t)(sample_count - count);
 
-        if (rslt == BMI3_OK)
+        if (frames > BMI3_FOC_FIFO_CHUNK_FRAMES)
         {
-            /* Get the configuration from the feature engine register where flat feature resides */
-            rslt = bmi3_get_regs(BMI3_REG_FEATURE_DATA_TX, flat_config, 4, dev);
-
-            if (rslt == BMI3_OK)
-            {
-                /* Get word to calculate theta, blocking and hold time from the same word */
-                lsb = (uint16_t) flat_config[idx++];
-                msb = ((uint16_t) flat_config[idx++] << 8);
-                lsb_msb = (lsb | msb);
+            frames = BMI3_FOC_FIFO_CHUNK_FRAMES;
+        }
 
-                /* Get theta */
-                config->theta = lsb_msb & BMI3_FLAT_THETA_MASK;
+        fifo.data = fifo_data;
+        fifo.length = (uint16_t)((frames * BMI3_LENGTH_FIFO_ACC) + dev->dummy_byte);
+        fifo.available_fifo_len = (uint16_t)(frames * (BMI3_LENGTH_FIFO_ACC / 2));
 
-                /* Get blocking */
-                config->blocking = (lsb_msb & BMI3_FLAT_BLOCKING_MASK) >> BMI3_FLAT_BLOCKING_POS;
+        rslt = bmi3_read_fifo_data(&fifo, dev);
 
-                /* Get hold time */
-                config->hold_time = (lsb_msb & BMI3_FLAT_HOLD_TIME_MASK) >> BMI3_FLAT_HOLD_TIME_POS;
+        if (rslt == BMI3_OK)
+        {
+            /* Dummy frames are dropped by the extractor and reported as warning */
+            fifo.avail_fifo_accel_frames = 0;
+            rslt = bmi3_extract_accel(accel_data, &fifo, dev);
 
-                /* Get word to calculate slope threshold and hysteresis from the same word */
-                lsb = (uint16_t) flat_config[idx++];
-                msb = ((uint16_t) flat_config[idx++] << 8);
-                lsb_msb = lsb | msb;
+            if (rslt > BMI3_OK)
+            {
+                rslt = BMI3_OK;
+            }
+        }
 
-                /* Get slope threshold */
-                config->slope_thres = lsb_msb & BMI3_FLAT_SLOPE_THRES_MASK;
+        if ((rslt == BMI3_OK) && (fifo.avail_fifo_accel_frames == 0))
+        {
+            rslt = BMI3_E_DATA_RDY_INT_FAILED;
+        }
 
-                /* Get hysteresis */
-                config->hysteresis = (lsb_msb & BMI3_FLAT_HYST_MASK) >> BMI3_FLAT_HYST_POS;
-            }
+        for (idx = 0; (rslt == BMI3_OK) && (idx < fifo.avail_fifo_accel_frames) && (count < sample_count); idx++)
+        {
+            temp_foc_data->x += accel_data[idx].x;
+            temp_foc_data->y += accel_data[idx].y;
+            temp_foc_data->z += accel_data[idx].z;
+            count++;
         }
     }
-    else
+
+    dev->acc_corr = acc_corr;
+
+    if (rslt == BMI3_OK)
     {
-        rslt = BMI3_E_NULL_PTR;
+        temp_foc_data->x = (temp_foc_data->x / sample_count);
+        temp_foc_data->y = (temp_foc_data->y / sample_count);
+        temp_foc_data->z = (temp_foc_data->z / sample_count);
     }
 
     return rslt;
 }
 
 /*!
- * @brief This internal API sets flat configurations like theta, blocking,
- * hold-time, hysteresis, and slope threshold.
+ * @brief This internal API flushes the FIFO.
  */
-static int8_t set_flat_config(const struct bmi3_flat_config *config, struct bmi3_dev *dev)
+static int8_t flush_fifo(struct bmi3_dev *dev)
 {
     /* Variable to store result of API */
     int8_t rslt;
 
-    /* Array to define the feature configuration */
-    uint8_t flat_config[4] = { 0 };
+    /* Array to flush the FIFO */
+    uint8_t fifo_ctrl[2] = { BMI3_FIFO_FLUSH_MASK, 0 };
 
-    /* Array to set the base address of flat feature */
-    uint8_t base_addr[2] = { BMI3_BASE_ADDR_FLAT, 0 };
+    rslt = bmi3_set_regs(BMI3_REG_FIFO_CTRL, fifo_ctrl, 2, dev);
 
-    uint16_t holdtime, hyst;
+    return rslt;
+}
 
-    if (config != NULL)
-    {
-        /* Set the flat base address to feature engine transmission address to start DMA transaction */
-        rslt = bmi3_set_regs(BMI3_REG_FEATURE_DATA_ADDR, base_addr, 2, dev);
+#ifdef BMI3_RUNNING_STATS
 
-        if (rslt == BMI3_OK)
-        {
-            /* Set theta */
-            flat_config[0] = BMI3_SET_BIT_POS0(flat_config[0], BMI3_FLAT_THETA, config->theta);
+/*!
+ * @brief This internal API accumulates the samples of an axis.
+ */
+static void update_axis_stats(const int16_t *data, uint16_t count, struct bmi3_axis_stats *stats)
+{
+    /* Variables to store the accumulators, kept local for the vectorized reductions */
+    int64_t sum = 0;
+    uint64_t sum_sq = 0;
+    int16_t min = stats->min;
+    int16_t max = stats->max;
 
-            /* Set blocking */
-            flat_config[0] |= BMI3_SET_BITS(flat_config[0], BMI3_FLAT_BLOCKING, config->blocking);
+    /* Variable to loop through the samples */
+    uint16_t loop;
 
-            /* Set hold time */
-            holdtime = ((uint16_t)flat_config[1] << 8);
-            flat_config[1] =
-                (BMI3_SET_BITS(holdtime, BMI3_FLAT_HOLD_TIME, config->hold_time) & BMI3_FLAT_HOLD_TIME_MASK) >> 8;
+    for (loop = 0; loop < count; loop++)
+    {
+        sum += data[loop];
+        sum_sq += (uint64_t)((int32_t)data[loop] * data[loop]);
+        min = (data[loop] < min) ? data[loop] : min;
+        max = (data[loop] > max) ? data[loop] : max;
+    }
 
-            /* Set slope threshold */
-            flat_config[2] = BMI3_SET_BIT_POS0(flat_config[2], BMI3_FLAT_SLOPE_THRES, config->slope_thres);
+    stats->sum += sum;
+    stats->sum_sq += sum_sq;
+    stats->min = min;
+    stats->max = max;
+}
 
-            /* Set hysteresis */
-            hyst = ((uint16_t)flat_config[3] << 8);
-            flat_config[3] = (BMI3_SET_BITS(hyst, BMI3_FLAT_HYST, config->hysteresis) & BMI3_FLAT_HYST_MASK) >> 8;
+/*!
+ * @brief This internal API accumulates a single sample of an axis.
+ */
+static void add_axis_sample(int16_t data, struct bmi3_axis_stats *stats)
+{
+    stats->sum += data;
+    stats->sum_sq += (uint64_t)((int32_t)data * data);
 
-            /* Set the configuration back to the feature engine register */
-            rslt = bmi3_set_regs(BMI3_REG_FEATURE_DATA_TX, flat_config, 4, dev);
-        }
-    }
-    else
+    if (data < stats->min)
     {
-        rslt = BMI3_E_NULL_PTR;
+        stats->min = data;
     }
 
-    return rslt;
+    if (data > stats->max)
+    {
+        stats->max = data;
+    }
 }
 
 /*!
- * @brief This internal API gets sig-motion configurations like block size,
- * peak 2 peak min, mcr min, peak 2 peak max and mcr max.
+ * @brief This internal API merges the accumulator of an axis into another.
  */
-static int8_t get_sig_motion_config(struct bmi3_sig_motion_config *config, struct bmi3_dev *dev)
+static void merge_axis_stats(const struct bmi3_axis_stats *src, struct bmi3_axis_stats *dst)
 {
-    /* Variable to store result of API */
-    int8_t rslt;
+    dst->sum += src->sum;
+    dst->sum_sq += src->sum_sq;
 
-    /* Array to define the feature configuration */
-    uint8_t sig_mot_config[6];
+    if (src->min < dst->min)
+    {
+        dst->min = src->min;
+    }
 
-    /* Variable to define LSB */
-    uint16_t lsb;
+    if (src->max > dst->max)
+    {
+        dst->max = src->max;
+    }
+}
 
-    /* Variable to define MSB */
-    uint16_t msb;
+/*!
+ * @brief This internal API computes the statistics of an axis from its accumulator.
+ */
+static void get_axis_stats_result(const struct bmi3_axis_stats *stats,
+                                  uint32_t count,
+                                  struct bmi3_axis_stats_result *result)
+{
+    /* Variable to store the magnitude of the sum */
+    uint64_t abs_sum = (uint64_t)((stats->sum < 0) ? -stats->sum : stats->sum);
 
-    /* Variable to define a word */
-    uint16_t lsb_msb;
+    /* Variables to store quotient and remainder of the sum by the count */
+    uint64_t quot = abs_sum / count;
+    uint64_t rem = abs_sum % count;
 
-    /* Array to set the base address of sig-motion feature */
-    uint8_t base_addr[2] = { BMI3_BASE_ADDR_SIG_MOTION, 0 };
+    /* Variable to store the square of the sum by the count, split to avoid overflow:
+     * (quot * count + rem)^2 / count = quot^2 * count + 2 * quot * rem + rem^2 / count
+     */
+    uint64_t sum_sq_mean = (quot * quot * count) + (2 * quot * rem) + ((rem * rem) / count);
 
-    /* Variable to define the array offset */
-    uint8_t idx = 0;
+    /* Mean rounded to nearest */
+    quot = (abs_sum + (count / 2)) / count;
+    result->mean = (int16_t)((stats->sum < 0) ? -(int64_t)quot : (int64_t)quot);
 
-    if (config != NULL)
+    if (stats->sum_sq > sum_sq_mean)
     {
-        /* Set the sig-motion base address to feature engine transmission address to start DMA transaction */
-        rslt = bmi3_set_regs(BMI3_REG_FEATURE_DATA_ADDR, base_addr, 2, dev);
-
-        if (rslt == BMI3_OK)
-        {
-            /* Get the configuration from the feature engine register where sig motion feature resides */
-            rslt = bmi3_get_regs(BMI3_REG_FEATURE_DATA_TX, sig_mot_config, 6, dev);
-
-            if (rslt == BMI3_OK)
-            {
-                /* Get word to calculate block size */
-                lsb = (uint16_t) sig_mot_config[idx++];
-                msb = ((uint16_t) sig_mot_config[idx++] << 8);
-                lsb_msb = (lsb | msb);
-
-                /* Get block size */
-                config->block_size = lsb_msb & BMI3_SIG_BLOCK_SIZE_MASK;
+        result->variance = (uint32_t)((stats->sum_sq - sum_sq_mean) / count);
+    }
+    else
+    {
+        result->variance = 0;
+    }
 
-                /* Get word to calculate peak 2 peak minimum from the same word */
-                lsb = (uint16_t) sig_mot_config[idx++];
-                msb = ((uint16_t) sig_mot_config[idx++] << 8);
-                lsb_msb = (lsb | msb);
+    result->min = stats->min;
+    result->max = stats->max;
+    result->peak_to_peak = (uint16_t)((int32_t)stats->max - stats->min);
+}
 
-                /* Get peak 2 peak minimum */
-                config->peak_2_peak_min = (lsb_msb & BMI3_SIG_P2P_MIN_MASK);
+/*!
+ * @brief This internal API resets the accumulators of x, y and z axis.
+ */
+static void reset_axes_stats(struct bmi3_axes_stats *stats)
+{
+    /* Accumulator of no samples, any sample is smaller than min and larger than max */
+    const struct bmi3_axis_stats no_stats = { 0, 0, INT16_MAX, INT16_MIN };
 
-                /* Get mcr minimum */
-                config->mcr_min = (lsb_msb & BMI3_SIG_MCR_MIN_MASK) >> BMI3_SIG_MCR_MIN_POS;
+    stats->count = 0;
+    stats->x = no_stats;
+    stats->y = no_stats;
+    stats->z = no_stats;
+}
+#endif
 
-                /* Get word to calculate peak 2 peak maximum and mcr maximum from the same word */
-                lsb = (uint16_t) sig_mot_config[idx++];
-                msb = ((uint16_t) sig_mot_config[idx++] << 8);
-                lsb_msb = (lsb | msb);
+/*!
+ * @brief This internal API gets the interrupt status bits with a registered callback.
+ */
+static uint16_t get_registered_int_status(const struct bmi3_int_dispatcher *disp)
+{
+    /* Variable to store the interrupt status bits with a registered callback */
+    uint16_t registered = 0;
 
-                /* Get peak 2 peak maximum */
-                config->peak_2_peak_max = (lsb_msb & BMI3_SIG_P2P_MAX_MASK);
+    /* Variable to loop through the interrupt status bits */
+    uint8_t loop;
 
-                /* Get mcr maximum */
-                config->mcr_max = (lsb_msb & BMI3_MCR_MAX_MASK) >> BMI3_MCR_MAX_POS;
-            }
-        }
-    }
-    else
+    for (loop = 0; loop < BMI3_INT_STATUS_BIT_COUNT; loop++)
     {
-        rslt = BMI3_E_NULL_PTR;
+        if (disp->callback[loop] != NULL)
+        {
+            registered |= (uint16_t)(UINT16_C(1) << loop);
+        }
     }
 
-    return rslt;
+    return registered;
 }
 
 /*!
- * @brief This internal API sets sig-motion configurations like block size,
- * peak 2 peak min, mcr min, peak 2 peak max and mcr max.
+ * @brief This internal API reads the interrupt status registers of the
+ * dispatcher in one burst, along with the data registers and the step counter
+ * if they are needed by the registered callbacks.
  */
-static int8_t set_sig_motion_config(const struct bmi3_sig_motion_config *config, struct bmi3_dev *dev)
+static int8_t get_int_status_burst(uint16_t registered,
+                                   uint16_t *fired,
+                                   struct bmi3_int_dispatcher *disp,
+                                   struct bmi3_dev *dev)
 {
     /* Variable to store result of API */
-    int8_t rslt;
+    int8_t rslt = BMI3_OK;
 
-    /* Array to set the base address of sig-motion feature */
-    uint8_t base_addr[2] = { BMI3_BASE_ADDR_SIG_MOTION, 0 };
+    /* Array to store register data along with the dummy bytes */
+    uint8_t buf[BMI3_READ_REG_DATA_STEP_LEN + BMI3_MAX_DUMMY_BYTE];
 
-    /* Array to define the feature configuration */
-    uint8_t sig_mot_config[6] = { 0 };
+    /* Pointer to the register data next to the dummy bytes */
+    const uint8_t *reg_data = buf;
 
-    struct bmi3_accel_config acc_config = { 0 };
+    /* Pointers to the interrupt status of INT1, INT2 and IBI */
+    uint16_t *int_status[3];
 
-    uint16_t block_size, p2p_min, mcr_min, p2p_max, mcr_max;
+    /* Variables to store first and last register of the burst */
+    uint8_t start_addr = BMI3_REG_INT_STATUS_IBI;
+    uint8_t end_addr = BMI3_REG_INT_STATUS_INT1;
 
-    if (config != NULL)
+    /* Variable to loop through the interrupt status registers */
+    uint8_t loop;
+
+    /* Variable to store the index of a register in the burst */
+    uint8_t idx;
+
+    int_status[0] = &disp->data.int1_status;
+    int_status[1] = &disp->data.int2_status;
+    int_status[2] = &disp->data.ibi_status;
+
+    for (loop = 0; loop < 3; loop++)
     {
-        rslt = get_accel_config(&acc_config, dev);
+        *int_status[loop] = 0;
 
-        if ((rslt == BMI3_OK) && (acc_config.acc_mode == BMI3_ACC_MODE_LOW_PWR))
+        if (disp->sources & (UINT8_C(1) << loop))
         {
-            if (acc_config.odr >= BMI3_ACC_ODR_50HZ)
-            {
-                rslt = BMI3_OK;
-            }
-            else
+            if ((BMI3_REG_INT_STATUS_INT1 + loop) < start_addr)
             {
-                rslt = BMI3_E_ACC_INVALID_CFG;
+                start_addr = BMI3_REG_INT_STATUS_INT1 + loop;
             }
-        }
-
-        if (rslt == BMI3_OK)
-        {
-            /* Set the sig-motion base address to feature engine transmission address to start DMA transaction */
-            rslt = bmi3_set_regs(BMI3_REG_FEATURE_DATA_ADDR, base_addr, 2, dev);
-
-            if (rslt == BMI3_OK)
-            {
-                /* Set block size for lsb 8 bits */
-                sig_mot_config[0] = (uint8_t)BMI3_SET_BIT_POS0(sig_mot_config[0],
-                                                               BMI3_SIG_BLOCK_SIZE,
-                                                               config->block_size);
 
-                block_size = ((uint16_t)sig_mot_config[1] << 8);
-
-                /* Set block size for msb 8 bits */
-                sig_mot_config[1] =
-                    (BMI3_SET_BIT_POS0(block_size, BMI3_SIG_BLOCK_SIZE,
-                                       config->block_size) & BMI3_SIG_BLOCK_SIZE_MASK) >> 8;
+            end_addr = BMI3_REG_INT_STATUS_INT1 + loop;
+        }
+    }
 
-                /* Set peak to peak minimum for lsb 8 bits */
-                sig_mot_config[2] = (uint8_t)BMI3_SET_BIT_POS0(sig_mot_config[2],
-                                                               BMI3_SIG_P2P_MIN,
-                                                               config->peak_2_peak_min);
+    /* Data registers precede and step counter follows the status registers, so that their
+     * payload is read in the same burst instead of a read of its own once the interrupt fired
+     */
+    if (registered & BMI3_INT_STATUS_DRDY_ALL)
+    {
+        start_addr = BMI3_REG_ACC_DATA_X;
+    }
 
-                p2p_min = ((uint16_t)sig_mot_config[3] << 8);
+    if (registered & BMI3_INT_STATUS_STEP_COUNTER)
+    {
+        end_addr = BMI3_REG_FEATURE_IO3;
+    }
 
-                /* Set peak to peak minimum for msb 8 bits */
-                sig_mot_config[3] =
-                    (BMI3_SET_BIT_POS0(p2p_min, BMI3_SIG_P2P_MIN,
-                                       config->peak_2_peak_min) & BMI3_SIG_P2P_MIN_MASK) >> 8;
+    if (start_addr > end_addr)
+    {
+        rslt = BMI3_E_INVALID_INPUT;
+    }
 
-                mcr_min = ((uint16_t)sig_mot_config[3] << 8);
+    if (rslt == BMI3_OK)
+    {
+        rslt = bmi3_get_regs_direct(start_addr, buf, (uint16_t)((end_addr - start_addr + 1) * 2), dev);
+        reg_data = &buf[dev->dummy_byte];
+    }
 
-                /* Set mcr minimum */
-                sig_mot_config[3] |=
-                    (BMI3_SET_BITS(mcr_min, BMI3_SIG_MCR_MIN, config->mcr_min) & BMI3_SIG_MCR_MIN_MASK) >> 8;
+    if (rslt == BMI3_OK)
+    {
+        *fired = 0;
 
-                /* Set peak to peak maximum for lsb 8 bits */
-                sig_mot_config[4] = (uint8_t)BMI3_SET_BIT_POS0(sig_mot_config[4],
-                                                               BMI3_SIG_P2P_MAX,
-                                                               config->peak_2_peak_max);
+        for (loop = 0; loop < 3; loop++)
+        {
+            if (disp->sources & (UINT8_C(1) << loop))
+            {
+                idx = (uint8_t)((BMI3_REG_INT_STATUS_INT1 + loop - start_addr) * 2);
+                *int_status[loop] = (uint16_t)(reg_data[idx] | ((uint16_t)reg_data[idx + 1] << 8));
+                *fired |= *int_status[loop];
+            }
+        }
 
-                p2p_max = ((uint16_t)sig_mot_config[5] << 8);
+        *fired &= registered;
 
-                /* Set peak to peak maximum for msb 8 bits */
-                sig_mot_config[5] =
-                    (BMI3_SET_BIT_POS0(p2p_max, BMI3_SIG_P2P_MAX,
-                                       config->peak_2_peak_max) & BMI3_SIG_P2P_MAX_MASK) >> 8;
+        if (*fired & BMI3_INT_STATUS_ACC_DRDY)
+        {
+            rslt = get_accel_sensortime_sat_data(&disp->data.acc, reg_data);
+        }
 
-                mcr_max = ((uint16_t)sig_mot_config[5] << 8);
+        if ((rslt == BMI3_OK) && (*fired & BMI3_INT_STATUS_GYR_DRDY))
+        {
+            rslt = get_gyro_sensortime_sat_data(&disp->data.gyr, reg_data);
+        }
 
-                /* Set mcr maximum */
-                sig_mot_config[5] |= (BMI3_SET_BITS(mcr_max, BMI3_MCR_MAX, config->mcr_max) & BMI3_MCR_MAX_MASK) >> 8;
+        if ((rslt == BMI3_OK) && (*fired & BMI3_INT_STATUS_TEMP_DRDY))
+        {
+            rslt = get_temp_sensortime_data(&disp->data.temp, reg_data);
+        }
 
-                /* Set the configuration back to the feature engine register */
-                rslt = bmi3_set_regs(BMI3_REG_FEATURE_DATA_TX, sig_mot_config, 6, dev);
-            }
+        if (*fired & BMI3_INT_STATUS_STEP_COUNTER)
+        {
+            disp->data.step_count = get_step_counter(&reg_data[(BMI3_REG_FEATURE_IO2 - start_addr) * 2]);
         }
     }
-    else
-    {
-        rslt = BMI3_E_NULL_PTR;
-    }
 
     return rslt;
 }
 
 /*!
- * @brief This internal API gets tilt configurations like segment size,
- * tilt angle, beta accel mean.
+ * @brief This internal API reads the orientation and tap detection output in one read.
  */
-static int8_t get_tilt_config(struct bmi3_tilt_config *config, struct bmi3_dev *dev)
+static int8_t get_feature_event_output(struct bmi3_int_event_data *data, struct bmi3_dev *dev)
 {
     /* Variable to store result of API */
     int8_t rslt;
 
-    /* Array to define the feature configuration */
-    uint8_t tilt_config[4] = { 0 };
-
-    /* Array to set the base address of tilt feature */
-    uint8_t base_addr[2] = { BMI3_BASE_ADDR_TILT, 0 };
-
-    /* Variable to define the array offset */
-    uint8_t idx = 0;
-
-    /* Variable to define LSB */
-    uint16_t lsb;
-
-    /* Variable to define MSB */
-    uint16_t msb;
+    /* Array to define data stored in register */
+    uint8_t reg_data[2] = { 0 };
 
-    /* Variable to define word */
-    uint16_t lsb_msb;
+    /* Read the data from feature engine status register */
+    rslt = bmi3_get_regs(BMI3_REG_FEATURE_EVENT_EXT, reg_data, 2, dev);
 
-    if (config != NULL)
+    if (rslt == BMI3_OK)
     {
-        /* Set the tilt base address to feature engine transmission address to start DMA transaction */
-        rslt = bmi3_set_regs(BMI3_REG_FEATURE_DATA_ADDR, base_addr, 2, dev);
-
-        if (rslt == BMI3_OK)
-        {
-            /* Get the configuration from the feature engine register where tilt feature resides */
-            rslt = bmi3_get_regs(BMI3_REG_FEATURE_DATA_TX, tilt_config, 4, dev);
-
-            if (rslt == BMI3_OK)
-            {
-                /* Get word to calculate segment size and minimum tilt angle from the same word */
-                lsb = ((uint16_t)tilt_config[idx++]);
-                msb = ((uint16_t)tilt_config[idx++]);
-                lsb_msb = (uint16_t)(lsb | (msb << 8));
+        data->orient.orientation_portrait_landscape = BMI3_GET_BIT_POS0(reg_data[0],
+                                                                        BMI3_ORIENTATION_PORTRAIT_LANDSCAPE);
+        data->orient.orientation_faceup_down = BMI3_GET_BITS(reg_data[0], BMI3_ORIENTATION_FACEUP_DOWN);
 
-                /* Get segment size */
-                config->segment_size = lsb_msb & BMI3_TILT_SEGMENT_SIZE_MASK;
-
-                /* Get minimum tilt angle */
-                config->min_tilt_angle = (lsb_msb & BMI3_TILT_MIN_TILT_ANGLE_MASK) >> BMI3_TILT_MIN_TILT_ANGLE_POS;
-
-                /* Get word to calculate beta accel mean */
-                lsb = ((uint16_t)tilt_config[idx++]);
-                msb = ((uint16_t)tilt_config[idx++]);
-                lsb_msb = (uint16_t)(lsb | (msb << 8));
-
-                /* Get beta accel mean */
-                config->beta_acc_mean = lsb_msb & BMI3_TILT_BETA_ACC_MEAN_MASK;
-            }
-        }
-    }
-    else
-    {
-        rslt = BMI3_E_NULL_PTR;
+        data->tap_status = reg_data[0] &
+                           (BMI3_TAP_DET_STATUS_SINGLE | BMI3_TAP_DET_STATUS_DOUBLE | BMI3_TAP_DET_STATUS_TRIPLE);
     }
 
     return rslt;
 }
 
 /*!
- * @brief This internal API sets tilt configurations like segment size,
- * tilt angle, beta accel mean.
+ * @brief This internal API reads the i3c sync accel, gyro, temperature and
+ * time data of a device in one burst.
  */
-static int8_t set_tilt_config(const struct bmi3_tilt_config *config, struct bmi3_dev *dev)
+static int8_t get_i3c_sync_sample(struct bmi3_i3c_sync_sample *sample, struct bmi3_dev *dev)
 {
     /* Variable to store result of API */
     int8_t rslt;
 
-    /* Array to set the base address of tilt feature */
-    uint8_t base_addr[2] = { BMI3_BASE_ADDR_TILT, 0 };
-
-    /* Array to define the feature configuration */
-    uint8_t tilt_config[4] = { 0 };
+    /* Array to store the i3c sync data */
+    uint8_t sync_data[BMI3_NUM_BYTES_I3C_SYNC_ALL] = { 0 };
 
-    uint16_t min_tilt_angle, beta_acc_mean;
+    /* Feature engine address and data transmission must not be interleaved with another access */
+    lock_dev(dev);
 
-    if (config != NULL)
-    {
-        /* Set the tilt base address to feature engine transmission address to start DMA transaction */
-        rslt = bmi3_set_regs(BMI3_REG_FEATURE_DATA_ADDR, base_addr, 2, dev);
+    rslt = get_i3c_sync_data(sync_data, BMI3_BASE_ADDR_I3C_SYNC_ACC, dev);
 
-        if (rslt == BMI3_OK)
-        {
-            /* Set segment size */
-            tilt_config[0] = BMI3_SET_BIT_POS0(tilt_config[0], BMI3_TILT_SEGMENT_SIZE, config->segment_size);
+    unlock_dev(dev);
 
-            min_tilt_angle = ((uint16_t)tilt_config[1] << 8);
+    if (rslt == BMI3_OK)
+    {
+        get_i3c_sync_sensor_data(&sample->acc, sync_data, BMI3_BASE_ADDR_I3C_SYNC_ACC, BMI3_BASE_ADDR_I3C_SYNC_ACC);
+        get_i3c_sync_sensor_data(&sample->gyr, sync_data, BMI3_BASE_ADDR_I3C_SYNC_GYR, BMI3_BASE_ADDR_I3C_SYNC_ACC);
+        get_i3c_sync_temp_data(&sample->temp, sync_data, BMI3_BASE_ADDR_I3C_SYNC_ACC);
+    }
 
-            /* Set minimum tilt angle */
-            tilt_config[1] =
-                (BMI3_SET_BITS(min_tilt_angle, BMI3_TILT_MIN_TILT_ANGLE,
-                               config->min_tilt_angle) & BMI3_TILT_MIN_TILT_ANGLE_MASK) >> 8;
+    return rslt;
+}
 
-            /* Set beta accel mean for lsb 8 bits */
-            tilt_config[2] = (uint8_t)BMI3_SET_BIT_POS0(tilt_config[2], BMI3_TILT_BETA_ACC_MEAN, config->beta_acc_mean);
+/*!
+ * @brief This internal API aligns the i3c sync data of a group: gets the newest
+ * sync time and whether all devices have it.
+ */
+static void align_i3c_sync_frame(struct bmi3_i3c_sync_frame *frame)
+{
+    /* Variable to define loop */
+    uint8_t loop;
 
-            beta_acc_mean = ((uint16_t)tilt_config[3] << 8);
+    frame->sync_time = frame->sample[0].acc.sync_time;
+    frame->aligned = BMI3_ENABLE;
 
-            /* Set beta accel mean for msb 8 bits */
-            tilt_config[3] =
-                (BMI3_SET_BIT_POS0(beta_acc_mean, BMI3_TILT_BETA_ACC_MEAN,
-                                   config->beta_acc_mean) & BMI3_TILT_BETA_ACC_MEAN_MASK) >> 8;
+    for (loop = 1; loop < frame->n_dev; loop++)
+    {
+        if (frame->sample[loop].acc.sync_time != frame->sync_time)
+        {
+            frame->aligned = BMI3_DISABLE;
 
-            /* Set the configuration back to the feature engine register */
-            rslt = bmi3_set_regs(BMI3_REG_FEATURE_DATA_TX, tilt_config, 4, dev);
+            /* Sync time wraps around at 16 bits */
+            if ((int16_t)(frame->sample[loop].acc.sync_time - frame->sync_time) > 0)
+            {
+                frame->sync_time = frame->sample[loop].acc.sync_time;
+            }
         }
     }
-    else
-    {
-        rslt = BMI3_E_NULL_PTR;
-    }
-
-    return rslt;
 }
 
 /*!
- * @brief This internal API gets orientation configurations like upside enable,
- * mode, blocking, theta, hold time, slope threshold and hysteresis.
+ * @brief This internal API reads data from the given register address with
+ * the given read function, along with the dummy bytes.
  */
-static int8_t get_orientation_config(struct bmi3_orientation_config *config, struct bmi3_dev *dev)
+static int8_t read_regs_direct(uint8_t reg_addr,
+                               uint8_t *data,
+                               uint16_t len,
+                               bmi3_read_fptr_t read,
+                               struct bmi3_dev *dev)
 {
     /* Variable to store result of API */
     int8_t rslt;
 
-    /* Array to define the feature configuration */
-    uint8_t orient_config[4] = { 0 };
-
-    /* Array to set the base address of orient feature */
-    uint8_t base_addr[2] = { BMI3_BASE_ADDR_ORIENT, 0 };
+    /* Variable to store register address of the transfer, with the read bit for SPI */
+    uint8_t addr = reg_addr;
 
-    /* Variable to define the array offset */
-    uint8_t idx = 0;
+    /* Variable to store number of retries */
+    uint8_t attempt = 0;
 
-    /* Variable to define LSB */
-    uint16_t lsb;
+#ifdef BMI3_BUS_STATS
 
-    /* Variable to define MSB */
-    uint16_t msb;
+    /* Variable to store timestamp at the start of the transaction */
+    uint32_t start;
+#endif
 
-    /* Variable to define a word */
-    uint16_t lsb_msb;
+    /* Configuring reg_addr for SPI Interface */
+    if (dev->intf == BMI3_SPI_INTF)
+    {
+        addr = (reg_addr | BMI3_SPI_RD_MASK);
+    }
 
-    if (config != NULL)
+    do
     {
-        /* Set the orient base address to feature engine transmission address to start DMA transaction */
-        rslt = bmi3_set_regs(BMI3_REG_FEATURE_DATA_ADDR, base_addr, 2, dev);
+        rslt = BMI3_OK;
 
-        if (rslt == BMI3_OK)
+        if (attempt != 0)
         {
-            /* Get the configuration from the feature engine register where orientation feature resides */
-            rslt = bmi3_get_regs(BMI3_REG_FEATURE_DATA_TX, orient_config, 4, dev);
+            /* Restore the transmission address if it is lost by the failed transfer */
+            rslt = cache_sync_feature_addr(reg_addr, dev);
+        }
 
-            if (rslt == BMI3_OK)
-            {
-                /* Get word to calculate upside down enable, mode, blocking, theta and hold time
-                 * from the same word */
-                lsb = (uint16_t) orient_config[idx++];
-                msb = ((uint16_t) orient_config[idx++] << 8);
-                lsb_msb = lsb | msb;
+        if (rslt == BMI3_OK)
+        {
+            /* Insert the idle time if the previous access was a write */
+            insert_idle_time(dev);
 
-                /* Get upside enable */
-                config->ud_en = lsb_msb & BMI3_ORIENT_UD_EN_MASK;
+#ifdef BMI3_BUS_STATS
+            start = bus_stats_start(dev);
+#endif
 
-                /* Get mode */
-                config->mode = (lsb_msb & BMI3_ORIENT_MODE_MASK) >> BMI3_ORIENT_MODE_POS;
+            dev->intf_rslt = read(addr, data, (uint32_t)len + dev->dummy_byte, dev->intf_ptr);
 
-                /* Get blocking */
-                config->blocking = (lsb_msb & BMI3_ORIENT_BLOCKING_MASK) >> BMI3_ORIENT_BLOCKING_POS;
+            if (dev->intf_rslt != BMI3_INTF_RET_SUCCESS)
+            {
+                rslt = BMI3_E_COM_FAIL;
+            }
 
-                /* Get theta */
-                config->theta = (lsb_msb & BMI3_ORIENT_THETA_MASK) >> BMI3_ORIENT_THETA_POS;
+#ifdef BMI3_BUS_STATS
+            bus_stats_record(addr, BMI3_DISABLE, (uint32_t)len + dev->dummy_byte, start, rslt, dev);
+#endif
+        }
+    } while ((rslt == BMI3_E_COM_FAIL) && (retry_transfer(reg_addr, BMI3_DISABLE, attempt++, dev) == BMI3_ENABLE));
 
-                /* Get hold time */
-                config->hold_time = (lsb_msb & BMI3_ORIENT_HOLD_TIME_MASK) >> BMI3_ORIENT_HOLD_TIME_POS;
+    if ((rslt == BMI3_OK) && (attempt != 0))
+    {
+        dev->retry_stats.recovered++;
+    }
 
-                /* Get word to calculate slope threshold and hysteresis from the same word */
-                lsb = (uint16_t) orient_config[idx++];
-                msb = ((uint16_t) orient_config[idx++] << 8);
-                lsb_msb = lsb | msb;
+    return rslt;
+}
 
-                /* Get slope threshold */
-                config->slope_thres = lsb_msb & BMI3_ORIENT_SLOPE_THRES_MASK;
+/*!
+ * @brief This internal API gets the read function for FIFO data.
+ */
+static bmi3_read_fptr_t get_fifo_read(const struct bmi3_dev *dev)
+{
+    /* Variable to store the read function */
+    bmi3_read_fptr_t read = dev->read;
 
-                /* Get hysteresis */
-                config->hysteresis = (lsb_msb & BMI3_ORIENT_HYST_MASK) >> BMI3_ORIENT_HYST_POS;
-            }
-        }
-    }
-    else
+    if ((dev->intf == BMI3_I3C_INTF) && (dev->read_hdr != NULL))
     {
-        rslt = BMI3_E_NULL_PTR;
+        read = dev->read_hdr;
     }
 
-    return rslt;
+    return read;
 }
 
 /*!
- * @brief This internal API sets orientation configurations like upside enable,
- * mode, blocking, theta, hold time, slope threshold and hysteresis.
+ * @brief This internal API reads the payloads of the fired interrupts which
+ * are not read along with the interrupt status.
  */
-static int8_t set_orientation_config(const struct bmi3_orientation_config *config, struct bmi3_dev *dev)
+static int8_t get_int_event_payload(uint16_t fired,
+                                    uint16_t in_data,
+                                    struct bmi3_int_dispatcher *disp,
+                                    struct bmi3_dev *dev)
 {
     /* Variable to store result of API */
-    int8_t rslt;
+    int8_t rslt = BMI3_OK;
 
-    /* Array to define the feature configuration */
-    uint8_t orient_config[4] = { 0 };
+    /* Array to store register data along with the dummy bytes */
+    uint8_t buf[BMI3_READ_REG_DATA_SAT_LEN + BMI3_MAX_DUMMY_BYTE];
 
-    /* Array to set the base address of orient feature */
-    uint8_t base_aadr[2] = { BMI3_BASE_ADDR_ORIENT, 0 };
+    /* Pointer to the register data next to the dummy bytes */
+    const uint8_t *reg_data = &buf[dev->dummy_byte];
 
-    uint16_t theta, hysteresis;
+    /* Interrupt status bits of which the payload is still to be read */
+    fired &= (uint16_t)~in_data;
 
-    if (config != NULL)
+    if (fired & BMI3_INT_STATUS_DRDY_ALL)
     {
-        /* Set the orient base address to feature engine transmission address to start DMA transaction */
-        rslt = bmi3_set_regs(BMI3_REG_FEATURE_DATA_ADDR, base_aadr, 2, dev);
+        /* Data registers up to the saturation flags, without the interrupt status registers */
+        rslt = bmi3_get_regs_direct(BMI3_REG_ACC_DATA_X, buf, BMI3_READ_REG_DATA_SAT_LEN, dev);
 
-        if (rslt == BMI3_OK)
+        if ((rslt == BMI3_OK) && (fired & BMI3_INT_STATUS_ACC_DRDY))
         {
-            /* Set upside down bit */
-            orient_config[0] = BMI3_SET_BIT_POS0(orient_config[0], BMI3_ORIENT_UD_EN, config->ud_en);
+            rslt = get_accel_sensortime_sat_data(&disp->data.acc, reg_data);
+        }
 
-            /* Set mode */
-            orient_config[0] |= BMI3_SET_BITS(orient_config[0], BMI3_ORIENT_MODE, config->mode);
+        if ((rslt == BMI3_OK) && (fired & BMI3_INT_STATUS_GYR_DRDY))
+        {
+            rslt = get_gyro_sensortime_sat_data(&disp->data.gyr, reg_data);
+        }
 
-            /* Set blocking */
-            orient_config[0] |= BMI3_SET_BITS(orient_config[0], BMI3_ORIENT_BLOCKING, config->blocking);
+        if ((rslt == BMI3_OK) && (fired & BMI3_INT_STATUS_TEMP_DRDY))
+        {
+            rslt = get_temp_sensortime_data(&disp->data.temp, reg_data);
+        }
+    }
 
-            /* Set theta for lsb 8 bits */
-            orient_config[0] |= (uint8_t)BMI3_SET_BITS(orient_config[0], BMI3_ORIENT_THETA, config->theta);
+    if ((rslt == BMI3_OK) && (fired & BMI3_INT_STATUS_STEP_COUNTER))
+    {
+        rslt = get_step_counter_sensor_data(&disp->data.step_count, BMI3_REG_FEATURE_IO2, dev);
+    }
 
-            theta = ((uint16_t)orient_config[1] << 8);
+    if ((rslt == BMI3_OK) && (fired & (BMI3_INT_STATUS_ORIENTATION | BMI3_INT_STATUS_TAP)))
+    {
+        rslt = get_feature_event_output(&disp->data, dev);
+    }
 
-            /* Set theta for msb 8 bits */
-            orient_config[1] = (BMI3_SET_BITS(theta, BMI3_ORIENT_THETA, config->theta) & BMI3_ORIENT_THETA_MASK) >> 8;
+    if ((rslt == BMI3_OK) && (fired & BMI3_INT_STATUS_ERR))
+    {
+        rslt = bmi3_get_error_status(&disp->data.err, dev);
+    }
 
-            /* Set hold time */
-            orient_config[1] |=
-                (BMI3_SET_BITS(orient_config[1], BMI3_ORIENT_HOLD_TIME,
-                               config->hold_time) & BMI3_ORIENT_HOLD_TIME_MASK) >> 8;
+    return rslt;
+}
 
-            /* Set slope threshold */
-            orient_config[2] = BMI3_SET_BIT_POS0(orient_config[2], BMI3_ORIENT_SLOPE_THRES, config->slope_thres);
+/*!
+ * @brief This internal API calls the callbacks of the fired interrupts.
+ */
+static void call_int_callbacks(uint16_t fired, const struct bmi3_int_dispatcher *disp)
+{
+    /* Variable to loop through the interrupt status bits */
+    uint8_t loop;
 
-            hysteresis = ((uint16_t)orient_config[3] << 8);
+    /* Callbacks are called without the device lock held */
+    for (loop = 0; loop < BMI3_INT_STATUS_BIT_COUNT; loop++)
+    {
+        if (fired & (UINT16_C(1) << loop))
+        {
+            disp->callback[loop]((uint16_t)(UINT16_C(1) << loop), &disp->data, disp->ctx);
+        }
+    }
+}
 
-            /* Set hysteresis */
-            orient_config[3] =
-                (BMI3_SET_BITS(hysteresis, BMI3_ORIENT_HYST, config->hysteresis) & BMI3_ORIENT_HYST_MASK) >> 8;
+/*!
+ * @brief This internal API checks the targets of the ODR and power governor.
+ */
+static int8_t check_governor_target(const struct bmi3_governor_target *target)
+{
+    /* Variable to store result of API */
+    int8_t rslt = BMI3_OK;
 
-            /* Set the configuration back to the feature engine register */
-            rslt = bmi3_set_regs(BMI3_REG_FEATURE_DATA_TX, orient_config, 4, dev);
-        }
+    if ((target->active_odr < BMI3_ACC_ODR_0_78HZ) || (target->active_odr > BMI3_ACC_ODR_6400HZ) ||
+        ((target->active_mode != BMI3_ACC_MODE_NORMAL) && (target->active_mode != BMI3_ACC_MODE_HIGH_PERF)))
+    {
+        rslt = BMI3_E_INVALID_INPUT;
     }
-    else
+    else if ((target->idle_odr < BMI3_ACC_ODR_0_78HZ) || (target->idle_odr > BMI3_ACC_ODR_400HZ) ||
+             (target->idle_odr > target->active_odr) || (target->idle_avg_num > BMI3_ACC_AVG64))
     {
-        rslt = BMI3_E_NULL_PTR;
+        /* Low-power mode is limited to 400Hz, rest must not sample faster than motion */
+        rslt = BMI3_E_INVALID_INPUT;
     }
 
     return rslt;
 }
 
 /*!
- * @brief This internal API gets step counter configurations like water-mark level,
- * reset counter and step counter parameters.
+ * @brief This internal API sets the user configuration, alternate
+ * configuration and switch sources of the ODR and power governor.
  */
-static int8_t get_step_config(struct bmi3_step_counter_config *config, struct bmi3_dev *dev)
+static int8_t set_governor_config(const struct bmi3_governor_target *target, struct bmi3_dev *dev)
 {
     /* Variable to store result of API */
     int8_t rslt;
 
-    /* Array to define the feature configuration */
-    uint8_t step_config[24] = { 0 };
-
-    /* Array to set the base address of step counter feature */
-    uint8_t base_addr[2] = { BMI3_BASE_ADDR_STEP_CNT, 0 };
-
-    /* Variable to define array offset */
-    uint8_t idx = 0;
+    /* Array of structures to store the configurations, gyro ones last */
+    struct bmi3_sens_config config[5] = { { 0 } };
 
-    /* Variable to define LSB */
-    uint16_t lsb;
+    /* Variable to store number of configurations */
+    uint8_t n_cfg = (target->gyro_en == BMI3_ENABLE) ? 5 : 3;
 
-    /* Variable to define MSB */
-    uint16_t msb;
+    config[0].type = BMI3_ACCEL;
+    config[1].type = BMI3_ALT_ACCEL;
+    config[2].type = BMI3_ALT_AUTO_CONFIG;
+    config[3].type = BMI3_GYRO;
+    config[4].type = BMI3_ALT_GYRO;
 
-    /* Variable to define word */
-    uint16_t lsb_msb;
+    /* Range, bandwidth and averaging in motion are kept as set by the user */
+    rslt = bmi3_get_sensor_config(config, n_cfg, dev);
 
-    if (config != NULL)
+    if (rslt == BMI3_OK)
     {
-        /* Set the step counter base address to feature engine transmission address to start DMA transaction */
-        rslt = bmi3_set_regs(BMI3_REG_FEATURE_DATA_ADDR, base_addr, 2, dev);
-
-        if (rslt == BMI3_OK)
-        {
-            /* Get the configuration from the feature engine register where step counter feature resides */
-            rslt = bmi3_get_regs(BMI3_REG_FEATURE_DATA_TX, step_config, 24, dev);
+        config[0].cfg.acc.odr = target->active_odr;
+        config[0].cfg.acc.acc_mode = target->active_mode;
 
-            if (rslt == BMI3_OK)
-            {
-                /* Get word to calculate water-mark level, reset counter from the same word */
-                lsb = ((uint16_t)step_config[idx++]);
-                msb = ((uint16_t)step_config[idx++]);
-                lsb_msb = (uint16_t)(lsb | (msb << 8));
-
-                /* Get water-mark level */
-                config->watermark_level = lsb_msb & BMI3_STEP_WATERMARK_MASK;
-
-                /* Get reset counter */
-                config->reset_counter = (lsb_msb & BMI3_STEP_RESET_COUNTER_MASK) >> BMI3_STEP_RESET_COUNTER_POS;
-
-                /* Get word to calculate minimum distance up */
-                lsb = ((uint16_t)step_config[idx++]);
-                msb = ((uint16_t)step_config[idx++]);
-                lsb_msb = (uint16_t)(lsb | (msb << 8));
-
-                /* Get minimum distance up */
-                config->env_min_dist_up = (lsb_msb & BMI3_STEP_ENV_MIN_DIST_UP_MASK);
-
-                /* Get word to calculate env coefficient up */
-                lsb = ((uint16_t)step_config[idx++]);
-                msb = ((uint16_t)step_config[idx++]);
-                lsb_msb = (uint16_t)(lsb | (msb << 8));
-
-                /* Get env coefficient up */
-                config->env_coef_up = (lsb_msb & BMI3_STEP_ENV_COEF_UP_MASK);
-
-                /* Get word to calculate env minimum distance down */
-                lsb = ((uint16_t)step_config[idx++]);
-                msb = ((uint16_t)step_config[idx++]);
-                lsb_msb = (uint16_t)(lsb | (msb << 8));
-
-                /* Get env minimum distance down */
-                config->env_min_dist_down = (lsb_msb & BMI3_STEP_ENV_MIN_DIST_DOWN_MASK);
-
-                /* Get word to calculate env coefficient down */
-                lsb = ((uint16_t)step_config[idx++]);
-                msb = ((uint16_t)step_config[idx++]);
-                lsb_msb = (uint16_t)(lsb | (msb << 8));
-
-                /* Get env coefficient down */
-                config->env_coef_down = (lsb_msb & BMI3_STEP_ENV_COEF_DOWN_MASK);
-
-                /* Get word to calculate mean val decay */
-                lsb = ((uint16_t)step_config[idx++]);
-                msb = ((uint16_t)step_config[idx++]);
-                lsb_msb = (uint16_t)(lsb | (msb << 8));
-
-                /* Get mean val decay */
-                config->mean_val_decay = (lsb_msb & BMI3_STEP_MEAN_VAL_DECAY_MASK);
-
-                /* Get word to calculate mean step duration */
-                lsb = ((uint16_t)step_config[idx++]);
-                msb = ((uint16_t)step_config[idx++]);
-                lsb_msb = (uint16_t)(lsb | (msb << 8));
-
-                /* Get mean step duration */
-                config->mean_step_dur = (lsb_msb & BMI3_STEP_MEAN_STEP_DUR_MASK);
+        config[1].cfg.alt_acc.alt_acc_odr = target->idle_odr;
+        config[1].cfg.alt_acc.alt_acc_mode = BMI3_ALT_ACC_MODE_LOW_PWR;
+        config[1].cfg.alt_acc.alt_acc_avg_num = target->idle_avg_num;
 
-                /* Get word to calculate step buffer size, filter cascade enabled and step counter increment
-                 * from the same word */
-                lsb = ((uint16_t)step_config[idx++]);
-                msb = ((uint16_t)step_config[idx++]);
-                lsb_msb = (uint16_t)(lsb | (msb << 8));
+        config[2].cfg.alt_auto_cfg.alt_conf_alt_switch_src_select = BMI3_ALT_NO_MOTION;
+        config[2].cfg.alt_auto_cfg.alt_conf_user_switch_src_select = BMI3_ALT_ANY_MOTION;
 
-                /* Get step buffer size */
-                config->step_buffer_size = lsb_msb & BMI3_STEP_BUFFER_SIZE_MASK;
+        config[3].cfg.gyr.odr = target->active_odr;
+        config[3].cfg.gyr.gyr_mode = target->active_mode;
 
-                /* Get filter cascade enable */
-                config->filter_cascade_enabled = (lsb_msb & BMI3_STEP_FILTER_CASCADE_ENABLED_MASK) >>
-                                                 BMI3_STEP_FILTER_CASCADE_ENABLED_POS;
+        config[4].cfg.alt_gyr.alt_gyro_odr = target->idle_odr;
+        config[4].cfg.alt_gyr.alt_gyro_mode = BMI3_ALT_GYR_MODE_SUSPEND;
 
-                /* Get step counter increment */
-                config->step_counter_increment = (lsb_msb & BMI3_STEP_COUNTER_INCREMENT_MASK) >>
-                                                 BMI3_STEP_COUNTER_INCREMENT_POS;
+        rslt = bmi3_set_sensor_config(config, n_cfg, dev);
+    }
 
-                /* Get word to calculate peak duration minimum walking and peak duration minimum running */
-                lsb = ((uint16_t)step_config[idx++]);
-                msb = ((uint16_t)step_config[idx++]);
-                lsb_msb = (uint16_t)(lsb | (msb << 8));
+    return rslt;
+}
 
-                /* Get peak duration minimum walking */
-                config->peak_duration_min_walking = lsb_msb & BMI3_STEP_PEAK_DURATION_MIN_WALKING_MASK;
+/*!
+ * @brief This internal API sets the FIFO water-mark level which keeps the
+ * latency budget at rest and avoids FIFO overflow in motion.
+ */
+static int8_t set_governor_fifo_wm(const struct bmi3_governor_target *target, uint16_t *fifo_wm, struct bmi3_dev *dev)
+{
+    /* Variable to store result of API */
+    int8_t rslt;
 
-                /* Get peak duration minimum running */
-                config->peak_duration_min_running = (lsb_msb & BMI3_STEP_PEAK_DURATION_MIN_RUNNING_MASK) >>
-                                                    BMI3_STEP_PEAK_DURATION_MIN_RUNNING_POS;
+    /* Variable to store FIFO configuration */
+    uint16_t fifo_config = 0;
 
-                /* Get word to calculate activity detection factor and activity detection threshold
-                 * from the same word */
-                lsb = ((uint16_t)step_config[idx++]);
-                msb = ((uint16_t)step_config[idx++]);
-                lsb_msb = (uint16_t)(lsb | (msb << 8));
+    /* Variable to store FIFO water-mark level in motion */
+    uint16_t active_wm = 0;
 
-                /* Get activity detection factor */
-                config->activity_detection_factor = lsb_msb & BMI3_STEP_ACTIVITY_DETECTION_FACTOR_MASK;
+    *fifo_wm = 0;
 
-                /* Get activity detection threshold */
-                config->activity_detection_thres = (lsb_msb & BMI3_STEP_ACTIVITY_DETECTION_THRESHOLD_MASK) >>
-                                                   BMI3_STEP_ACTIVITY_DETECTION_THRESHOLD_POS;
+    rslt = bmi3_get_fifo_config(&fifo_config, dev);
 
-                /* Get word to calculate step duration max and step duration window from the same word */
-                lsb = ((uint16_t)step_config[idx++]);
-                msb = ((uint16_t)step_config[idx++]);
-                lsb_msb = (uint16_t)(lsb | (msb << 8));
+    if ((rslt == BMI3_OK) && (fifo_config & (BMI3_FIFO_ACC_EN | BMI3_FIFO_GYR_EN)))
+    {
+        /* Water-mark levels shrink with the ODR for latency and grow with it for overflow */
+        rslt = bmi3_compute_fifo_wm(target->budget,
+                                    fifo_config & BMI3_FIFO_ALL_EN,
+                                    target->idle_odr,
+                                    target->idle_odr,
+                                    fifo_wm);
 
-                /* Get step duration max */
-                config->step_duration_max = lsb_msb & BMI3_STEP_DURATION_MAX_MASK;
+        if (rslt == BMI3_OK)
+        {
+            rslt = bmi3_compute_fifo_wm(target->budget,
+                                        fifo_config & BMI3_FIFO_ALL_EN,
+                                        target->active_odr,
+                                        target->active_odr,
+                                        &active_wm);
+        }
 
-                /* Get step duration window */
-                config->step_duration_window = (lsb_msb & BMI3_STEP_DURATION_WINDOW_MASK) >>
-                                               BMI3_STEP_DURATION_WINDOW_POS;
+        if (rslt == BMI3_OK)
+        {
+            if (active_wm < *fifo_wm)
+            {
+                *fifo_wm = active_wm;
+            }
 
-                /* Get word to calculate step duration pp enabled, duration threshold,
-                 * mean crossing pp enabled, mcr threshold from the same word */
-                lsb = ((uint16_t)step_config[idx++]);
-                msb = ((uint16_t)step_config[idx++]);
-                lsb_msb = (uint16_t)(lsb | (msb << 8));
+            rslt = bmi3_set_fifo_wm(*fifo_wm, dev);
+        }
+    }
 
-                /* Get step duration pp enable */
-                config->step_duration_pp_enabled = lsb_msb & BMI3_STEP_DURATION_PP_ENABLED_MASK;
+    return rslt;
+}
 
-                /* Get step duration threshold */
-                config->step_duration_thres = (lsb_msb & BMI3_STEP_DURATION_THRESHOLD_MASK) >>
-                                              BMI3_STEP_DURATION_THRESHOLD_POS;
+/*!
+ * @brief This internal API zigzag-encodes the delta of two samples.
+ */
+static uint32_t get_zigzag_delta(int16_t data, int16_t prev)
+{
+    /* Variable to store the delta */
+    int32_t delta = (int32_t)data - prev;
 
-                /* Get mean crossing pp enabled */
-                config->mean_crossing_pp_enabled = (lsb_msb & BMI3_STEP_MEAN_CROSSING_PP_ENABLED_MASK) >>
-                                                   BMI3_STEP_MEAN_CROSSING_PP_ENABLED_POS;
+    /* Variable to store the zigzag-encoded delta */
+    uint32_t zigzag;
 
-                /* Get mcr threshold */
-                config->mcr_threshold = (lsb_msb & BMI3_STEP_MCR_THRESHOLD_MASK) >> BMI3_STEP_MCR_THRESHOLD_POS;
-            }
-        }
+    if (delta >= 0)
+    {
+        zigzag = (uint32_t)delta << 1;
     }
     else
     {
-        rslt = BMI3_E_INVALID_SENSOR;
+        zigzag = ((uint32_t)(-delta) << 1) - 1;
     }
 
-    return rslt;
+    return zigzag;
 }
 
 /*!
- * @brief This internal API sets step counter configurations like water-mark level,
- * reset counter and step counter parameters.
+ * @brief This internal API gets the number of bits of a value.
  */
-static int8_t set_step_config(const struct bmi3_step_counter_config *config, struct bmi3_dev *dev)
+static uint8_t get_bit_width(uint32_t value)
 {
-    /* Variable to store result of API */
-    int8_t rslt;
+    /* Variable to store the number of bits */
+    uint8_t width = 0;
 
-    /* Array to set the base address of step counter feature */
-    uint8_t base_addr[2] = { BMI3_BASE_ADDR_STEP_CNT, 0 };
-
-    /* Array to define the feature configuration */
-    uint8_t step_config[24] = { 0 };
+    while (value != 0)
+    {
+        value >>= 1;
+        width++;
+    }
 
-    struct bmi3_accel_config acc_config = { 0 };
+    return width;
+}
 
-    uint16_t watermark, reset_counter, env_min_dist_up, env_coef_up, env_min_dist_down, env_coef_down;
-    uint16_t mean_val_decay, mean_step_dur, step_counter_increment, peak_duration_min_running;
-    uint16_t activity_detection_threshold, step_duration_window, mcr_threshold;
+/*!
+ * @brief This internal API writes a value to a bit stream, least significant bit first.
+ */
+static void put_bits(uint8_t *buf, uint32_t *bit_pos, uint32_t value, uint8_t width)
+{
+    /* Variables to store the bits written to the current byte */
+    uint8_t shift;
+    uint8_t take;
 
-    if (config != NULL)
+    while (width != 0)
     {
-        rslt = get_accel_config(&acc_config, dev);
-
-        if ((rslt == BMI3_OK) && (acc_config.acc_mode == BMI3_ACC_MODE_LOW_PWR))
-        {
-            if (acc_config.odr >= BMI3_ACC_ODR_50HZ)
-            {
-                rslt = BMI3_OK;
-            }
-            else
-            {
-                rslt = BMI3_E_ACC_INVALID_CFG;
-            }
-        }
-
-        if (rslt == BMI3_OK)
-        {
-            /* Set the step counter base address to feature engine transmission address to start DMA transaction */
-            rslt = bmi3_set_regs(BMI3_REG_FEATURE_DATA_ADDR, base_addr, 2, dev);
+        shift = (uint8_t)(*bit_pos & 7);
+        take = (uint8_t)(((8 - shift) < width) ? (8 - shift) : width);
 
-            if (rslt == BMI3_OK)
-            {
-                /* Set water-mark for lsb 8 bits */
-                step_config[0] =
-                    (uint8_t)BMI3_SET_BIT_POS0(step_config[0], BMI3_STEP_WATERMARK, config->watermark_level);
+        buf[*bit_pos >> 3] |= (uint8_t)((value & ((UINT32_C(1) << take) - 1)) << shift);
 
-                watermark = ((uint16_t)step_config[1] << 8);
+        value >>= take;
+        width = (uint8_t)(width - take);
+        *bit_pos += take;
+    }
+}
 
-                /* Set water-mark for msb 8 bits */
-                step_config[1] =
-                    (BMI3_SET_BIT_POS0(watermark, BMI3_STEP_WATERMARK,
-                                       config->watermark_level) & BMI3_STEP_WATERMARK_MASK) >> 8;
+/*!
+ * @brief This internal API reads a value from a bit stream, least significant bit first.
+ */
+static uint32_t get_bits(const uint8_t *buf, uint32_t *bit_pos, uint8_t width)
+{
+    /* Variable to store the value */
+    uint32_t value = 0;
 
-                reset_counter = ((uint16_t)step_config[1] << 8);
+    /* Variables to store the bits read from the current byte and the bits read so far */
+    uint8_t shift;
+    uint8_t take;
+    uint8_t done = 0;
 
-                /* Set reset counter */
-                step_config[1] |=
-                    (BMI3_SET_BITS(reset_counter, BMI3_STEP_RESET_COUNTER,
-                                   config->reset_counter) & BMI3_STEP_RESET_COUNTER_MASK) >> 8;
+    while (done < width)
+    {
+        shift = (uint8_t)(*bit_pos & 7);
+        take = (uint8_t)(((8 - shift) < (width - done)) ? (8 - shift) : (width - done));
 
-                /* Set env_min_dist_up for lsb 8 bits */
-                step_config[2] = (uint8_t)BMI3_SET_BIT_POS0(step_config[2],
-                                                            BMI3_STEP_ENV_MIN_DIST_UP,
-                                                            config->env_min_dist_up);
+        value |= ((uint32_t)(buf[*bit_pos >> 3] >> shift) & ((UINT32_C(1) << take) - 1)) << done;
 
-                env_min_dist_up = ((uint16_t)step_config[3] << 8);
+        done = (uint8_t)(done + take);
+        *bit_pos += take;
+    }
 
-                /* Set env_min_dist_up for msb 8 bits */
-                step_config[3] =
-                    (BMI3_SET_BIT_POS0(env_min_dist_up, BMI3_STEP_ENV_MIN_DIST_UP,
-                                       config->env_min_dist_up) & BMI3_STEP_ENV_MIN_DIST_UP_MASK) >> 8;
+    return value;
+}
 
-                /* Set env_coef_up for lsb 8 bits */
-                step_config[4] = (uint8_t)BMI3_SET_BIT_POS0(step_config[4], BMI3_STEP_ENV_COEF_UP, config->env_coef_up);
+/*!
+ * @brief This internal API counts the dummy frames of a sensor in the FIFO data.
+ */
+static uint16_t count_fifo_dummy_frames(uint8_t sens_offset,
+                                        uint16_t dummy_frame,
+                                        uint16_t frames,
+                                        const struct bmi3_fifo_frame_layout *layout,
+                                        const struct bmi3_fifo_frame *fifo,
+                                        const struct bmi3_dev *dev)
+{
+    /* Variable to store the number of dummy frames */
+    uint16_t dummy_frames = 0;
 
-                env_coef_up = ((uint16_t)step_config[5] << 8);
+    /* Variable to index the first byte of the sensor data */
+    uint16_t data_index = (uint16_t)(dev->dummy_byte + sens_offset);
 
-                /* Set env_coef_up for msb 8 bits */
-                step_config[5] =
-                    (BMI3_SET_BIT_POS0(env_coef_up, BMI3_STEP_ENV_COEF_UP,
-                                       config->env_coef_up) & BMI3_STEP_ENV_COEF_UP_MASK) >> 8;
+    /* Variable to define loop */
+    uint16_t loop;
 
-                /* Set env_min_dist_down for lsb 8 bits */
-                step_config[6] = (uint8_t)BMI3_SET_BIT_POS0(step_config[6],
-                                                            BMI3_STEP_ENV_MIN_DIST_DOWN,
-                                                            config->env_min_dist_down);
+    /* Only the first word of the sensor data is checked, as by the parser */
+    for (loop = 0; loop < frames; loop++)
+    {
+        if ((uint16_t)(((uint16_t)fifo->data[data_index + 1] << 8) | fifo->data[data_index]) == dummy_frame)
+        {
+            dummy_frames++;
+        }
 
-                env_min_dist_down = ((uint16_t)step_config[7] << 8);
+        data_index += layout->frame_len;
+    }
 
-                /* Set env_min_dist_down for msb 8 bits */
-                step_config[7] =
-                    (BMI3_SET_BIT_POS0(env_min_dist_down, BMI3_STEP_ENV_MIN_DIST_DOWN,
-                                       config->env_min_dist_down) & BMI3_STEP_ENV_MIN_DIST_DOWN_MASK) >> 8;
+    return dummy_frames;
+}
 
-                /* Set env_coef_down for lsb 8 bits */
-                step_config[8] = (uint8_t)BMI3_SET_BIT_POS0(step_config[8],
-                                                            BMI3_STEP_ENV_COEF_DOWN,
-                                                            config->env_coef_down);
+/*!
+ * @brief This internal API gets the number of frames of a sensor of the census.
+ */
+static uint16_t get_census_frames(uint8_t sens_offset, uint8_t sens_len, const struct bmi3_fifo_census *census)
+{
+    /* Variable to store the number of frames */
+    uint16_t frames = 0;
 
-                env_coef_down = ((uint16_t)step_config[9] << 8);
+    if (sens_offset != BMI3_FIFO_NO_DATA)
+    {
+        frames = census->frames;
 
-                /* Set env_coef_down for msb 8 bits */
-                step_config[9] =
-                    (BMI3_SET_BIT_POS0(env_coef_down, BMI3_STEP_ENV_COEF_DOWN,
-                                       config->env_coef_down) & BMI3_STEP_ENV_COEF_DOWN_MASK) >> 8;
+        if ((sens_offset + sens_len) <= census->partial_len)
+        {
+            frames++;
+        }
+    }
 
-                /* Set mean_val_decay for lsb 8 bits */
-                step_config[10] = (uint8_t)BMI3_SET_BIT_POS0(step_config[10],
-                                                             BMI3_STEP_MEAN_VAL_DECAY,
-                                                             config->mean_val_decay);
+    return frames;
+}
 
-                mean_val_decay = ((uint16_t)step_config[11] << 8);
+/*!
+ * @brief This internal API reads words of the feature engine starting at the
+ * given base address.
+ */
+static int8_t get_feature_words(uint8_t base_addr, uint8_t *data, uint16_t len, struct bmi3_dev *dev)
+{
+    /* Variable to store result of API */
+    int8_t rslt;
 
-                /* Set mean_val_decay for msb 8 bits */
-                step_config[11] =
-                    (BMI3_SET_BIT_POS0(mean_val_decay, BMI3_STEP_MEAN_VAL_DECAY,
-                                       config->mean_val_decay) & BMI3_STEP_MEAN_VAL_DECAY_MASK) >> 8;
+    /* Array to set the base address of the feature engine transmission */
+    uint8_t addr[2] = { 0 };
 
-                /* Set mean_step_dur for lsb 8 bits */
-                step_config[12] = (uint8_t)BMI3_SET_BIT_POS0(step_config[12],
-                                                             BMI3_STEP_MEAN_STEP_DUR,
-                                                             config->mean_step_dur);
+    addr[0] = base_addr;
 
-                mean_step_dur = ((uint16_t)step_config[13] << 8);
+    rslt = bmi3_set_regs(BMI3_REG_FEATURE_DATA_ADDR, addr, 2, dev);
 
-                /* Set mean_step_dur for msb 8 bits */
-                step_config[13] =
-                    (BMI3_SET_BIT_POS0(mean_step_dur, BMI3_STEP_MEAN_STEP_DUR,
-                                       config->mean_step_dur) & BMI3_STEP_MEAN_STEP_DUR_MASK) >> 8;
+    if (rslt == BMI3_OK)
+    {
+        rslt = bmi3_get_regs(BMI3_REG_FEATURE_DATA_TX, data, len, dev);
+    }
 
-                /* Set step buffer size */
-                step_config[14] = BMI3_SET_BIT_POS0(step_config[14], BMI3_STEP_BUFFER_SIZE, config->step_buffer_size);
+    return rslt;
+}
 
-                /* Set filter cascade */
-                step_config[14] |= BMI3_SET_BITS(step_config[14],
-                                                 BMI3_STEP_FILTER_CASCADE_ENABLED,
-                                                 config->filter_cascade_enabled);
+/*!
+ * @brief This internal API writes words of the feature engine starting at the
+ * given base address.
+ */
+static int8_t set_feature_words(uint8_t base_addr, const uint8_t *data, uint16_t len, struct bmi3_dev *dev)
+{
+    /* Variable to store result of API */
+    int8_t rslt;
 
-                /* Set step_counter_increment for lsb 8 bits */
-                step_config[14] |= (uint8_t)BMI3_SET_BITS(step_config[14],
-                                                          BMI3_STEP_COUNTER_INCREMENT,
-                                                          config->step_counter_increment);
+    /* Array to set the base address of the feature engine transmission */
+    uint8_t addr[2] = { 0 };
 
-                step_counter_increment = ((uint16_t)step_config[15] << 8);
+    addr[0] = base_addr;
 
-                /* Set step_counter_increment for msb 8 bits */
-                step_config[15] =
-                    (BMI3_SET_BITS(step_counter_increment, BMI3_STEP_COUNTER_INCREMENT,
-                                   config->step_counter_increment) & BMI3_STEP_COUNTER_INCREMENT_MASK) >> 8;
+    rslt = bmi3_set_regs(BMI3_REG_FEATURE_DATA_ADDR, addr, 2, dev);
 
-                /* Set peak_duration_min_walking for lsb 8 bits */
-                step_config[16] = BMI3_SET_BIT_POS0(step_config[16],
-                                                    BMI3_STEP_PEAK_DURATION_MIN_WALKING,
-                                                    config->peak_duration_min_walking);
+    if (rslt == BMI3_OK)
+    {
+        rslt = bmi3_set_regs(BMI3_REG_FEATURE_DATA_TX, data, len, dev);
+    }
 
-                peak_duration_min_running = ((uint16_t)step_config[17] << 8);
+    return rslt;
+}
 
-                /* Set peak_duration_min_walking for msb 8 bits */
-                step_config[17] =
-                    (BMI3_SET_BITS(peak_duration_min_running, BMI3_STEP_PEAK_DURATION_MIN_RUNNING,
-                                   config->peak_duration_min_running) & BMI3_STEP_PEAK_DURATION_MIN_RUNNING_MASK) >> 8;
+/*!
+ * @brief This internal API computes the CRC-16 of the calibration blob.
+ */
+static uint16_t get_calib_crc(const uint8_t *data, uint8_t len)
+{
+    /* Variable to store the CRC */
+    uint16_t crc = BMI3_CALIB_CRC_INIT;
 
-                /* Set activity detection fsctor */
-                step_config[18] = BMI3_SET_BIT_POS0(step_config[18],
-                                                    BMI3_STEP_ACTIVITY_DETECTION_FACTOR,
-                                                    config->activity_detection_factor);
+    /* Variables to define loop */
+    uint8_t index, bit;
 
-                /* Set activity_detection_threshold for lsb 8 bits */
-                step_config[18] |= (uint8_t)BMI3_SET_BITS(step_config[18],
-                                                          BMI3_STEP_ACTIVITY_DETECTION_THRESHOLD,
-                                                          config->activity_detection_thres);
+    for (index = 0; index < len; index++)
+    {
+        crc ^= (uint16_t)((uint16_t)data[index] << 8);
 
-                activity_detection_threshold = ((uint16_t)step_config[19] << 8);
+        for (bit = 0; bit < 8; bit++)
+        {
+            if (crc & UINT16_C(0x8000))
+            {
+                crc = (uint16_t)((crc << 1) ^ BMI3_CALIB_CRC_POLY);
+            }
+            else
+            {
+                crc = (uint16_t)(crc << 1);
+            }
+        }
+    }
 
-                /* Set activity_detection_threshold for msb 8 bits */
-                step_config[19] =
-                    (BMI3_SET_BITS(activity_detection_threshold, BMI3_STEP_ACTIVITY_DETECTION_THRESHOLD,
-                                   config->activity_detection_thres) & BMI3_STEP_ACTIVITY_DETECTION_THRESHOLD_MASK) >>
-                    8;
+    return crc;
+}
 
-                /* Set maximum step duration */
-                step_config[20] = BMI3_SET_BIT_POS0(step_config[20], BMI3_STEP_DURATION_MAX, config->step_duration_max);
+/*!
+ * @brief This internal API writes the registers of the configuration image,
+ * in dependency order and with the sensors enabled last.
+ */
+static int8_t set_config_image_regs(const struct bmi3_config_image *image, struct bmi3_dev *dev)
+{
+    /* Variable to store result of API */
+    int8_t rslt;
 
-                step_duration_window = ((uint16_t)step_config[21] << 8);
+    /* Array to set feature_engine_gp_status in order to enable the features */
+    uint8_t gp_status[2] = { 1, 0 };
 
-                /* Set step duration window */
-                step_config[21] =
-                    (BMI3_SET_BITS(step_duration_window, BMI3_STEP_DURATION_WINDOW,
-                                   config->step_duration_window) & BMI3_STEP_DURATION_WINDOW_MASK) >> 8;
+    /* Features are enabled once their configuration is written */
+    rslt = bmi3_set_regs(BMI3_REG_FEATURE_IO0, image->feature_io, 2, dev);
 
-                step_config[22] = BMI3_SET_BIT_POS0(step_config[22],
-                                                    BMI3_STEP_DURATION_PP_ENABLED,
-                                                    config->step_duration_pp_enabled);
+    if (rslt == BMI3_OK)
+    {
+        rslt = bmi3_set_regs(BMI3_REG_FEATURE_IO_STATUS, gp_status, 2, dev);
+    }
 
-                step_config[22] |= BMI3_SET_BITS(step_config[22],
-                                                 BMI3_STEP_DURATION_THRESHOLD,
-                                                 config->step_duration_thres);
+    /* Interrupt and FIFO configuration, so that no sample is lost once the sensors are enabled */
+    if (rslt == BMI3_OK)
+    {
+        rslt = bmi3_set_regs(BMI3_REG_FIFO_WATERMARK, image->int_conf, BMI3_CONFIG_IMAGE_INT_LEN, dev);
+    }
 
-                step_config[22] |= BMI3_SET_BITS(step_config[22],
-                                                 BMI3_STEP_MEAN_CROSSING_PP_ENABLED,
-                                                 config->mean_crossing_pp_enabled);
+    if (rslt == BMI3_OK)
+    {
+        rslt = bmi3_set_regs(BMI3_REG_ALT_ACC_CONF,
+                             &image->sens_conf[BMI3_CONFIG_IMAGE_ALT_POS],
+                             BMI3_CONFIG_IMAGE_ALT_LEN,
+                             dev);
+    }
 
-                /* Set mcr_threshold for lsb 8 bits */
-                step_config[22] |= (uint8_t)BMI3_SET_BITS(step_config[22],
-                                                          BMI3_STEP_MCR_THRESHOLD,
-                                                          config->mcr_threshold);
+    /* Accel and gyro configurations enable the sensors */
+    if (rslt == BMI3_OK)
+    {
+        rslt = bmi3_set_regs(BMI3_REG_ACC_CONF, image->sens_conf, 4, dev);
+    }
 
-                mcr_threshold = ((uint16_t)step_config[23] << 8);
+    return rslt;
+}
 
-                /* Set mcr_threshold for msb 8 bits */
-                step_config[23] =
-                    (BMI3_SET_BITS(mcr_threshold, BMI3_STEP_MCR_THRESHOLD,
-                                   config->mcr_threshold) & BMI3_STEP_MCR_THRESHOLD_MASK) >> 8;
+/*!
+ * @brief This internal API reconstructs the unwrapped sensor time of a FIFO
+ * sample and takes it over as time of the last sample.
+ */
+static uint64_t get_fifo_sample_time(struct bmi3_fifo_time *fifo_time,
+                                     const struct bmi3_fifo_frame *fifo,
+                                     uint16_t sensor_time,
+                                     uint16_t index,
+                                     uint16_t count)
+{
+    /* Variable to store time of the sample */
+    uint64_t time;
 
-                /* Set the configuration back to feature engine register */
-                rslt = bmi3_set_regs(BMI3_REG_FEATURE_DATA_TX, step_config, 24, dev);
-            }
+    if (fifo->available_fifo_sens & BMI3_FIFO_TIME_EN)
+    {
+        if (fifo_time->last_valid == BMI3_ENABLE)
+        {
+            /* Sensor time counts up from the last sample */
+            time = fifo_time->last + (uint16_t)(sensor_time - (uint16_t)fifo_time->last);
+        }
+        else
+        {
+            /* First sample can be before or after the anchor */
+            time = fifo_time->anchor + (uint64_t)(int64_t)(int16_t)(sensor_time - (uint16_t)fifo_time->anchor);
         }
     }
+    else if (fifo_time->last_valid == BMI3_ENABLE)
+    {
+        time = fifo_time->last + fifo_time->period;
+    }
     else
     {
-        rslt = BMI3_E_NULL_PTR;
+        /* Last sample of the read is taken at the anchor, which is read after the FIFO data */
+        time = fifo_time->anchor - ((uint64_t)(count - 1 - index) * fifo_time->period);
     }
 
-    return rslt;
+    fifo_time->last = time;
+    fifo_time->last_valid = BMI3_ENABLE;
+
+    return time;
 }
 
 /*!
- * @brief This internal API gets tap configurations like axes select, wait for time out, mode,
- * max peaks for tap, duration, tap peak threshold, max gest duration, max dur bw peaks,
- * shock settling duration.
+ * @brief This internal API parses the accelerometer and gyro frames of the
+ * FIFO data at their native rates, keeping track of the frame of each sample.
  */
-static int8_t get_tap_config(struct bmi3_tap_detector_config *config, struct bmi3_dev *dev)
+static int8_t parse_fifo_multi_rate(struct bmi3_fifo_multi_rate *multi_rate,
+                                    struct bmi3_fifo_time *fifo_time,
+                                    const struct bmi3_fifo_frame *fifo,
+                                    const struct bmi3_dev *dev)
 {
     /* Variable to store result of API */
-    int8_t rslt;
+    int8_t rslt = BMI3_W_FIFO_INVALID_FRAME;
 
-    /* Array to define the feature configuration */
-    uint8_t tap_config[6] = { 0 };
+    /* Variable to store result of a single sensor frame */
+    int8_t frame_rslt;
 
-    /* Array to set the base address of tap feature */
-    uint8_t base_addr[2] = { BMI3_BASE_ADDR_TAP, 0 };
+    /* Pointer to the layout of the frame */
+    const struct bmi3_fifo_frame_layout *layout = select_fifo_frame_layout(fifo);
 
-    /* Variable to define array offset */
-    uint8_t idx = 0;
+    /* Pointers to the samples of the frame, NULL if the sensor is a dummy frame or not part of the frame */
+    struct bmi3_fifo_sens_axes_data *acc;
+    struct bmi3_fifo_sens_axes_data *gyr;
 
-    /* Variable to define LSB */
-    uint16_t lsb;
+    /* Variables to index accelerometer and gyro samples */
+    uint16_t accel_index = 0;
+    uint16_t gyro_index = 0;
 
-    /* Variable to define MSB */
-    uint16_t msb;
+    /* Variables to index the frames, dummy frames included */
+    uint16_t frame = 0;
+    uint16_t frames = 0;
 
-    /* Variable to define a word */
-    uint16_t lsb_msb;
+    /* Variables to store the first byte and the end of valid FIFO data */
+    uint16_t data_index = dev->dummy_byte;
+    uint16_t data_end = get_fifo_data_end(fifo, dev);
 
-    if (config != NULL)
+    /* Variable to store time of the frame */
+    uint64_t time = 0;
+
+    /* Frame of the timestamp anchor is the last one, which may be incomplete */
+    if ((layout->frame_len != 0) && (data_end > data_index))
     {
-        /* Set the tap base address to feature engine transmission address to start DMA transaction */
-        rslt = bmi3_set_regs(BMI3_REG_FEATURE_DATA_ADDR, base_addr, 2, dev);
+        frames = (uint16_t)((data_end - data_index + layout->frame_len - 1) / layout->frame_len);
+    }
 
-        if (rslt == BMI3_OK)
+    for (; frame < frames; frame++, data_index += layout->frame_len)
+    {
+        frame_rslt = BMI3_OK;
+        acc = NULL;
+        gyr = NULL;
+
+        if (layout->acc_offset != BMI3_FIFO_NO_DATA)
         {
-            /* Get the configuration from the feature engine register where tap feature resides */
-            rslt = bmi3_get_regs(BMI3_REG_FEATURE_DATA_TX, tap_config, 6, dev);
+            frame_rslt = unpack_accel_data(&multi_rate->accel_data[accel_index], data_index, data_end, layout, fifo);
 
-            if (rslt == BMI3_OK)
+            if ((frame_rslt == BMI3_OK) || (frame_rslt == BMI3_W_ST_PARTIAL_READ))
             {
-                /* Get word to calculate axis select, wait for time out, max peaks for tap and mode
-                 * from the same word */
-                lsb = (uint16_t) tap_config[idx++];
-                msb = ((uint16_t) tap_config[idx++] << 8);
-                lsb_msb = lsb | msb;
+                acc = &multi_rate->accel_data[accel_index];
 
-                /* Get axis selection */
-                config->axis_sel = lsb_msb & BMI3_TAP_AXIS_SEL_MASK;
-
-                /* Get wait for time out */
-                config->wait_for_timeout = (lsb_msb & BMI3_TAP_WAIT_FR_TIME_OUT_MASK) >> BMI3_TAP_WAIT_FR_TIME_OUT_POS;
+                if (dev->acc_corr != NULL)
+                {
+                    correct_axes(&acc->x, &acc->y, &acc->z, dev->acc_corr);
+                }
+            }
+        }
 
-                /* Get max peaks for tap */
-                config->max_peaks_for_tap = (lsb_msb & BMI3_TAP_MAX_PEAKS_MASK) >> BMI3_TAP_MAX_PEAKS_POS;
+        if ((layout->gyr_offset != BMI3_FIFO_NO_DATA) && (frame_rslt != BMI3_W_PARTIAL_READ))
+        {
+            frame_rslt = unpack_gyro_data(&multi_rate->gyro_data[gyro_index], data_index, data_end, layout, fifo);
 
-                /* Get mode */
-                config->mode = (lsb_msb & BMI3_TAP_MODE_MASK) >> BMI3_TAP_MODE_POS;
+            if ((frame_rslt == BMI3_OK) || (frame_rslt == BMI3_W_ST_PARTIAL_READ))
+            {
+                gyr = &multi_rate->gyro_data[gyro_index];
 
-                /* Get word to calculate threshold, output configuration from the same word */
-                lsb = (uint16_t) tap_config[idx++];
-                msb = ((uint16_t) tap_config[idx++] << 8);
-                lsb_msb = lsb | msb;
+                if (dev->gyr_corr != NULL)
+                {
+                    correct_axes(&gyr->x, &gyr->y, &gyr->z, dev->gyr_corr);
+                }
+            }
+        }
 
-                /* Get tap peak threshold */
-                config->tap_peak_thres = lsb_msb & BMI3_TAP_PEAK_THRES_MASK;
+        /* Both samples of a frame share its sensor time */
+        if ((fifo_time != NULL) && ((acc != NULL) || (gyr != NULL)))
+        {
+            time = get_fifo_sample_time(fifo_time,
+                                        fifo,
+                                        (acc != NULL) ? acc->sensor_time : gyr->sensor_time,
+                                        frame,
+                                        frames);
+        }
 
-                /* Get max gesture duration */
-                config->max_gest_dur = (lsb_msb & BMI3_TAP_MAX_GEST_DUR_MASK) >> BMI3_TAP_MAX_GEST_DUR_POS;
+        if (acc != NULL)
+        {
+            if (multi_rate->accel_time != NULL)
+            {
+                multi_rate->accel_time[accel_index] = time;
+            }
 
-                /* Get word to calculate max_dur_between_peaks, tap_shock_settling_dur, min_quite_dur_between_taps
-                 *  and quite_time_after_gest from the same word */
-                lsb = (uint16_t) tap_config[idx++];
-                msb = ((uint16_t) tap_config[idx++] << 8);
-                lsb_msb = lsb | msb;
+            if (multi_rate->accel_pair != NULL)
+            {
+                multi_rate->accel_pair[accel_index] = (gyr != NULL) ? gyro_index : BMI3_FIFO_NO_PAIR;
+            }
 
-                /* Get maximum duration between peaks */
-                config->max_dur_between_peaks = lsb_msb & BMI3_TAP_MAX_DUR_BW_PEAKS_MASK;
+            accel_index++;
+        }
 
-                /* Get tap shock settling duration */
-                config->tap_shock_settling_dur = (lsb_msb & BMI3_TAP_SHOCK_SETT_DUR_MASK) >>
-                                                 BMI3_TAP_SHOCK_SETT_DUR_POS;
+        if (gyr != NULL)
+        {
+            if (multi_rate->gyro_time != NULL)
+            {
+                multi_rate->gyro_time[gyro_index] = time;
+            }
 
-                /* Get minimum quite duration between taps */
-                config->min_quite_dur_between_taps = (lsb_msb & BMI3_TAP_MIN_QUITE_DUR_BW_TAPS_MASK) >>
-                                                     BMI3_TAP_MIN_QUITE_DUR_BW_TAPS_POS;
+            gyro_index++;
+        }
 
-                /* Get quite time after gesture */
-                config->quite_time_after_gest = (lsb_msb & BMI3_TAP_QUITE_TIME_AFTR_GEST_MASK) >>
-                                                BMI3_TAP_QUITE_TIME_AFTR_GEST_POS;
-            }
+        /* Remaining frames are incomplete once a partial read occurs */
+        if (frame_rslt == BMI3_W_PARTIAL_READ)
+        {
+            break;
         }
     }
-    else
+
+    multi_rate->accel_frames = accel_index;
+    multi_rate->gyro_frames = gyro_index;
+
+    if ((accel_index != 0) || (gyro_index != 0))
     {
-        rslt = BMI3_E_NULL_PTR;
+        rslt = BMI3_OK;
     }
 
     return rslt;
 }
 
 /*!
- * @brief This internal API sets tap configurations like axes select, wait for time out, mode,
- * max peaks for tap, duration, tap peak threshold, max gest duration, max dur bw peaks,
- * shock settling duration.
+ * @brief This internal API parses the frames of the FIFO data holding both an
+ * accelerometer and a gyro sample into joined 6-DoF samples.
  */
-static int8_t set_tap_config(const struct bmi3_tap_detector_config *config, struct bmi3_dev *dev)
+static uint16_t parse_fifo_6dof(struct bmi3_fifo_6dof_data *data,
+                                const struct bmi3_fifo_frame_layout *layout,
+                                const struct bmi3_fifo_frame *fifo,
+                                const struct bmi3_dev *dev)
 {
-    /* Variable to store result of API */
-    int8_t rslt;
+    /* Variable to index the joined samples */
+    uint16_t out_index = 0;
 
-    /* Array to define the feature configuration */
-    uint8_t tap_config[6] = { 0 };
-
-    /* Array to set the base address of tap feature */
-    uint8_t base_aadr[2] = { BMI3_BASE_ADDR_TAP, 0 };
-
-    struct bmi3_accel_config acc_config = { 0 };
+    /* Variables to store the frame index and the end of valid FIFO data */
+    uint16_t data_index = dev->dummy_byte;
+    uint16_t data_end = get_fifo_data_end(fifo, dev);
 
-    uint16_t tap_peak_thres, max_gest_dur, min_quite_dur_between_taps, quite_time_after_gest;
+    /* Pointer to the accelerometer and gyro data of the frame */
+    const uint8_t *acc;
+    const uint8_t *gyr;
 
-    if (config != NULL)
+    for (; (uint32_t)data_index + layout->frame_len <= data_end; data_index += layout->frame_len)
     {
-        rslt = get_accel_config(&acc_config, dev);
+        acc = &fifo->data[data_index + layout->acc_offset];
+        gyr = &fifo->data[data_index + layout->gyr_offset];
 
-        if ((rslt == BMI3_OK) && (acc_config.acc_mode == BMI3_ACC_MODE_LOW_PWR))
+        /* Frames with a dummy frame of either sensor are not joined */
+        if (((((uint16_t)acc[1] << 8) | acc[0]) != BMI3_FIFO_ACCEL_DUMMY_FRAME) &&
+            ((((uint16_t)gyr[1] << 8) | gyr[0]) != BMI3_FIFO_GYRO_DUMMY_FRAME))
         {
-            if (acc_config.odr >= BMI3_ACC_ODR_200HZ)
+            data[out_index].acc_x = (int16_t)(((uint16_t)acc[1] << 8) | acc[0]);
+            data[out_index].acc_y = (int16_t)(((uint16_t)acc[3] << 8) | acc[2]);
+            data[out_index].acc_z = (int16_t)(((uint16_t)acc[5] << 8) | acc[4]);
+            data[out_index].gyr_x = (int16_t)(((uint16_t)gyr[1] << 8) | gyr[0]);
+            data[out_index].gyr_y = (int16_t)(((uint16_t)gyr[3] << 8) | gyr[2]);
+            data[out_index].gyr_z = (int16_t)(((uint16_t)gyr[5] << 8) | gyr[4]);
+            data[out_index].sensor_time = 0;
+
+            if (layout->sens_time_offset != BMI3_FIFO_NO_DATA)
             {
-                rslt = BMI3_OK;
+                data[out_index].sensor_time =
+                    (uint16_t)(((uint16_t)fifo->data[data_index + layout->sens_time_offset + 1] << 8) |
+                               fifo->data[data_index + layout->sens_time_offset]);
             }
-            else
+
+            if (dev->acc_corr != NULL)
+            {
+                correct_axes(&data[out_index].acc_x, &data[out_index].acc_y, &data[out_index].acc_z, dev->acc_corr);
+            }
+
+            if (dev->gyr_corr != NULL)
             {
-                rslt = BMI3_E_ACC_INVALID_CFG;
+                correct_axes(&data[out_index].gyr_x, &data[out_index].gyr_y, &data[out_index].gyr_z, dev->gyr_corr);
             }
+
+            out_index++;
         }
+    }
 
-        if (rslt == BMI3_OK)
-        {
-            /* Set the tap base address to feature engine transmission address to start DMA transaction */
-            rslt = bmi3_set_regs(BMI3_REG_FEATURE_DATA_ADDR, base_aadr, 2, dev);
+    return out_index;
+}
 
-            if (rslt == BMI3_OK)
-            {
-                /* Set axis_sel */
-                tap_config[0] = BMI3_SET_BIT_POS0(tap_config[0], BMI3_TAP_AXIS_SEL, config->axis_sel);
+#ifdef BMI3_FUSION
+
+/*!
+ * @brief This internal API gets the integer square root.
+ */
+static uint32_t get_isqrt(uint64_t value)
+{
+    /* Variables to store the root and the bit being tested */
+    uint64_t root = 0;
+    uint64_t bit = (uint64_t)1 << 62;
 
-                /* Set wait for time out */
-                tap_config[0] |= BMI3_SET_BITS(tap_config[0], BMI3_TAP_WAIT_FR_TIME_OUT, config->wait_for_timeout);
+    while (bit > value)
+    {
+        bit >>= 2;
+    }
 
-                /* Set maximum peaks for tap */
-                tap_config[0] |= BMI3_SET_BITS(tap_config[0], BMI3_TAP_MAX_PEAKS, config->max_peaks_for_tap);
+    /* Root is built bit by bit, from the highest one */
+    while (bit != 0)
+    {
+        if (value >= (root + bit))
+        {
+            value -= root + bit;
+            root = (root >> 1) + bit;
+        }
+        else
+        {
+            root >>= 1;
+        }
 
-                /* Set mode */
-                tap_config[0] |= BMI3_SET_BITS(tap_config[0], BMI3_TAP_MODE, config->mode);
+        bit >>= 2;
+    }
 
-                /* Set peak threshold first byte in word */
-                tap_config[2] = (uint8_t)BMI3_SET_BIT_POS0(tap_config[2], BMI3_TAP_PEAK_THRES, config->tap_peak_thres);
+    return (uint32_t)root;
+}
 
-                /* Left shift by 8 times so that we can set rest of the values of tap peak threshold conf in word */
-                tap_peak_thres = ((uint16_t)tap_config[3] << 8);
+/*!
+ * @brief This internal API updates the orientation fusion by a 6-DoF sample.
+ */
+static void update_fusion(const struct bmi3_fifo_6dof_data *sample,
+                          uint32_t dt,
+                          struct bmi3_fusion *fusion,
+                          const struct bmi3_dev *dev)
+{
+    /* Variables to store the quaternion */
+    int64_t q0 = fusion->q[0], q1 = fusion->q[1], q2 = fusion->q[2], q3 = fusion->q[3];
 
-                /* Set peak threshold second byte in word */
-                tap_config[3] =
-                    (BMI3_SET_BIT_POS0(tap_peak_thres, BMI3_TAP_PEAK_THRES,
-                                       config->tap_peak_thres) & BMI3_TAP_PEAK_THRES_MASK) >> 8;
+    /* Variables to store accel unit vector, estimated gravity and error, with BMI3_FUSION_Q_FRAC_BITS */
+    int64_t acc[3], grav[3], err[3];
 
-                max_gest_dur = ((uint16_t)tap_config[3] << 8);
+    /* Variables to store angular rate and rotation in radian, with BMI3_UNIT_Q_FRAC_BITS */
+    int64_t rate[3], angle[3];
 
-                /* Set max gesture duration */
-                tap_config[3] |=
-                    (BMI3_SET_BITS(max_gest_dur, BMI3_TAP_MAX_GEST_DUR,
-                                   config->max_gest_dur) & BMI3_TAP_MAX_GEST_DUR_MASK) >> 8;
+    /* Variables to store accel norm in LSB and magnitude in g with BMI3_UNIT_Q_FRAC_BITS */
+    uint32_t norm;
+    int32_t magnitude;
 
-                /* Set max duration between peaks */
-                tap_config[4] =
-                    (BMI3_SET_BIT_POS0(tap_config[4], BMI3_TAP_MAX_DUR_BW_PEAKS,
-                                       config->max_dur_between_peaks) & BMI3_TAP_MAX_DUR_BW_PEAKS_MASK);
+    /* Variable to define loop */
+    uint8_t axis;
 
-                /* Set shock settling duration */
-                tap_config[4] |=
-                    (BMI3_SET_BITS(tap_config[4], BMI3_TAP_SHOCK_SETT_DUR,
-                                   config->tap_shock_settling_dur) & BMI3_TAP_SHOCK_SETT_DUR_MASK);
+    rate[0] = ((int64_t)sample->gyr_x * dev->unit_scale.gyr_q * BMI3_FUSION_DEG_TO_RAD) >> BMI3_FUSION_Q_FRAC_BITS;
+    rate[1] = ((int64_t)sample->gyr_y * dev->unit_scale.gyr_q * BMI3_FUSION_DEG_TO_RAD) >> BMI3_FUSION_Q_FRAC_BITS;
+    rate[2] = ((int64_t)sample->gyr_z * dev->unit_scale.gyr_q * BMI3_FUSION_DEG_TO_RAD) >> BMI3_FUSION_Q_FRAC_BITS;
 
-                min_quite_dur_between_taps = ((uint16_t)tap_config[5] << 8);
+    norm = get_isqrt((uint64_t)((int64_t)sample->acc_x * sample->acc_x + (int64_t)sample->acc_y * sample->acc_y +
+                                (int64_t)sample->acc_z * sample->acc_z));
+    magnitude = (int32_t)norm * dev->unit_scale.acc_q;
 
-                /* Set quite duration between taps */
-                tap_config[5] =
-                    (BMI3_SET_BITS(min_quite_dur_between_taps, BMI3_TAP_MIN_QUITE_DUR_BW_TAPS,
-                                   config->min_quite_dur_between_taps) & BMI3_TAP_MIN_QUITE_DUR_BW_TAPS_MASK) >> 8;
+    /* Accel corrects the orientation only while it measures mainly gravity */
+    if ((norm != 0) && (BMI3_ABS(magnitude - (INT32_C(1) << BMI3_UNIT_Q_FRAC_BITS)) <= BMI3_FUSION_ACC_GATE))
+    {
+        acc[0] = ((int64_t)sample->acc_x << BMI3_FUSION_Q_FRAC_BITS) / norm;
+        acc[1] = ((int64_t)sample->acc_y << BMI3_FUSION_Q_FRAC_BITS) / norm;
+        acc[2] = ((int64_t)sample->acc_z << BMI3_FUSION_Q_FRAC_BITS) / norm;
 
-                quite_time_after_gest = ((uint16_t)tap_config[5] << 8);
+        /* Direction of gravity in the sensor frame as estimated by the quaternion */
+        grav[0] = ((q1 * q3) - (q0 * q2)) >> (BMI3_FUSION_Q_FRAC_BITS - 1);
+        grav[1] = ((q0 * q1) + (q2 * q3)) >> (BMI3_FUSION_Q_FRAC_BITS - 1);
+        grav[2] = ((q0 * q0) - (q1 * q1) - (q2 * q2) + (q3 * q3)) >> BMI3_FUSION_Q_FRAC_BITS;
 
-                /* Set quite time after gesture */
-                tap_config[5] |=
-                    (BMI3_SET_BITS(quite_time_after_gest, BMI3_TAP_QUITE_TIME_AFTR_GEST,
-                                   config->quite_time_after_gest) & BMI3_TAP_QUITE_TIME_AFTR_GEST_MASK) >> 8;
+        /* Error is the cross product of measured and estimated gravity */
+        err[0] = ((acc[1] * grav[2]) - (acc[2] * grav[1])) >> BMI3_FUSION_Q_FRAC_BITS;
+        err[1] = ((acc[2] * grav[0]) - (acc[0] * grav[2])) >> BMI3_FUSION_Q_FRAC_BITS;
+        err[2] = ((acc[0] * grav[1]) - (acc[1] * grav[0])) >> BMI3_FUSION_Q_FRAC_BITS;
 
-                /* Set the configuration back to the feature engine register */
-                rslt = bmi3_set_regs(BMI3_REG_FEATURE_DATA_TX, tap_config, 6, dev);
-            }
+        for (axis = 0; axis < 3; axis++)
+        {
+            fusion->integ[axis] +=
+                (int32_t)((((err[axis] * fusion->ki) >> BMI3_FUSION_Q_FRAC_BITS) * dt) / BMI3_SENSORTIME_TICKS_PER_S);
+            rate[axis] += ((err[axis] * fusion->kp) >> BMI3_FUSION_Q_FRAC_BITS);
         }
     }
-    else
+
+    for (axis = 0; axis < 3; axis++)
     {
-        rslt = BMI3_E_NULL_PTR;
+        angle[axis] = ((rate[axis] + fusion->integ[axis]) * dt) / BMI3_SENSORTIME_TICKS_PER_S;
+    }
+
+    /* Quaternion derivative is half the product of the quaternion and the rotation */
+    fusion->q[0] = (int32_t)(q0 + ((-(q1 * angle[0]) - (q2 * angle[1]) - (q3 * angle[2])) >>
+                                   (BMI3_UNIT_Q_FRAC_BITS + 1)));
+    fusion->q[1] = (int32_t)(q1 + (((q0 * angle[0]) + (q2 * angle[2]) - (q3 * angle[1])) >>
+                                   (BMI3_UNIT_Q_FRAC_BITS + 1)));
+    fusion->q[2] = (int32_t)(q2 + (((q0 * angle[1]) - (q1 * angle[2]) + (q3 * angle[0])) >>
+                                   (BMI3_UNIT_Q_FRAC_BITS + 1)));
+    fusion->q[3] = (int32_t)(q3 + (((q0 * angle[2]) + (q1 * angle[1]) - (q2 * angle[0])) >>
+                                   (BMI3_UNIT_Q_FRAC_BITS + 1)));
+
+    /* Quaternion is normalized to unit length */
+    q0 = fusion->q[0];
+    q1 = fusion->q[1];
+    q2 = fusion->q[2];
+    q3 = fusion->q[3];
+    norm = get_isqrt((uint64_t)((q0 * q0) + (q1 * q1) + (q2 * q2) + (q3 * q3)));
+
+    if (norm != 0)
+    {
+        fusion->q[0] = (int32_t)((q0 << BMI3_FUSION_Q_FRAC_BITS) / norm);
+        fusion->q[1] = (int32_t)((q1 << BMI3_FUSION_Q_FRAC_BITS) / norm);
+        fusion->q[2] = (int32_t)((q2 << BMI3_FUSION_Q_FRAC_BITS) / norm);
+        fusion->q[3] = (int32_t)((q3 << BMI3_FUSION_Q_FRAC_BITS) / norm);
+    }
+}
+#endif
+
+#ifdef BMI3_SPECTRUM
+
+/*!
+ * @brief This internal API gets the Goertzel filter coefficient of a bin.
+ */
+static int32_t get_goertzel_coeff(uint16_t bin, uint16_t len)
+{
+    /* Variables to store phase in 1/65536 turn and the sign of the cosine */
+    uint32_t phase = ((uint32_t)bin << 16) / len;
+    int64_t sign = 1;
+
+    /* Variables to store angle, its square, term and sum of the series with 30 fraction bits */
+    int64_t angle, square, term, sum;
+
+    /* Variable to define loop */
+    int64_t loop;
+
+    /* Cosine of the second quarter turn is the negative one of the first */
+    if (phase > UINT32_C(16384))
+    {
+        phase = UINT32_C(32768) - phase;
+        sign = -1;
+    }
+
+    /* 2 * pi / 65536 with 30 fraction bits */
+    angle = (int64_t)phase * INT64_C(102944);
+    square = (angle * angle) >> 30;
+    term = INT64_C(1) << 30;
+    sum = term;
+
+    /* Taylor series up to the 8th power, accurate to 2.5e-5 up to a quarter turn */
+    for (loop = 1; loop <= 4; loop++)
+    {
+        term = -((term * square) >> 30) / ((2 * loop - 1) * (2 * loop));
+        sum += term;
     }
 
-    return rslt;
+    return (int32_t)((sign * sum) >> (30 - BMI3_GOERTZEL_FRAC_BITS - 1));
 }
 
 /*!
- * @brief This internal API is used to update data index based on the frame length
+ * @brief This internal API runs the samples of an axis through the bank of
+ * Goertzel filters.
  */
-static void update_data_index(uint16_t *idx, uint16_t *updated_frm_idx, uint8_t len, int8_t rslt)
+static void run_goertzel(const int16_t *data,
+                         uint16_t count,
+                         const int32_t *coeff,
+                         uint8_t n_bins,
+                         int32_t *s1,
+                         int32_t *s2)
 {
-    /* Update data index */
-    (*idx) = (*idx) + len;
+    /* Variables to define loop */
+    uint16_t index;
+    uint8_t bin;
+
+    /* Variable to store the new state */
+    int32_t s;
 
-    if (rslt == 0 || rslt == BMI3_W_ST_PARTIAL_READ)
+    for (bin = 0; bin < n_bins; bin++)
     {
-        /* Update accelerometer, gyro and temperature frame index */
-        (*updated_frm_idx)++;
+        for (index = 0; index < count; index++)
+        {
+            s = data[index] + (int32_t)(((int64_t)coeff[bin] * s1[bin]) >> BMI3_GOERTZEL_FRAC_BITS) - s2[bin];
+            s2[bin] = s1[bin];
+            s1[bin] = s;
+        }
     }
 }
 
 /*!
- * @brief This internal API is used to parse the accelerometer, gyroscope and temperature data from the
- * FIFO data. It updates the current data byte to be parsed.
+ * @brief This internal API gets the spectral summary of a completed block and
+ * restarts the filters.
  */
-static int8_t unpack_fifo_data_frame(void *fifo_data,
-                                     uint16_t *idx,
-                                     uint16_t *updated_frm_idx,
-                                     uint16_t frame,
-                                     const struct bmi3_fifo_frame *fifo)
+static void finish_spectrum_block(struct bmi3_spectrum *spec, struct bmi3_spectrum_summary *summary)
 {
-    /* Variable to store result of API */
-    int8_t rslt = BMI3_OK;
-
-    /* Variable to store fifo available length in bytes */
-    uint16_t fifo_available_len_in_bytes;
-
-    struct bmi3_fifo_temperature_data *fifo_temp_data = (struct bmi3_fifo_temperature_data *)fifo_data;
-    struct bmi3_fifo_sens_axes_data *fifo_gyr_data = (struct bmi3_fifo_sens_axes_data *)fifo_data;
-    struct bmi3_fifo_sens_axes_data *fifo_acc_data = (struct bmi3_fifo_sens_axes_data *)fifo_data;
+    /* Variables to define loop */
+    uint8_t axis, bin;
 
-    /* Convert available fifo length from word to byte */
-    fifo_available_len_in_bytes = (uint16_t)(fifo->available_fifo_len * 2);
+    /* Variables to store power and squared amplitude of a bin */
+    int64_t power;
+    uint64_t energy;
 
-    switch (frame)
+    for (axis = 0; axis < 3; axis++)
     {
-        /* If frame contains only accelerometer data */
-        case BMI3_FIFO_HEAD_LESS_ACC_FRM:
+        summary->peak[axis] = 0;
 
-            /* Get the accelerometer data */
-            rslt = unpack_accel_data(&fifo_acc_data[(*updated_frm_idx)], *idx, fifo);
+        for (bin = 0; bin < spec->n_bins; bin++)
+        {
+            power = ((int64_t)spec->s1[axis][bin] * spec->s1[axis][bin]) +
+                    ((int64_t)spec->s2[axis][bin] * spec->s2[axis][bin]) -
+                    ((((int64_t)spec->coeff[bin] * spec->s1[axis][bin]) >> BMI3_GOERTZEL_FRAC_BITS) *
+                     spec->s2[axis][bin]);
 
-            if (rslt == 0 || rslt == BMI3_W_FIFO_ACCEL_DUMMY_FRAME || rslt == BMI3_W_ST_PARTIAL_READ)
-            {
-                update_data_index(idx, updated_frm_idx, BMI3_LENGTH_FIFO_ACC, rslt);
-            }
-            else if (rslt == BMI3_W_PARTIAL_READ)
+            /* Magnitude of a tone of amplitude A is A * N / 2 */
+            energy = (power > 0) ? (((uint64_t)power * 4) / ((uint32_t)spec->block_len * spec->block_len)) : 0;
+            summary->energy[axis][bin] = (energy > UINT32_MAX) ? UINT32_MAX : (uint32_t)energy;
+
+            if (summary->energy[axis][bin] > summary->energy[axis][summary->peak[axis]])
             {
-                /* Since partial occur making data start index to FIFO available length
-                 * to end of the loop */
-                *idx = fifo_available_len_in_bytes;
+                summary->peak[axis] = bin;
             }
 
-            break;
+            spec->s1[axis][bin] = 0;
+            spec->s2[axis][bin] = 0;
+        }
+    }
+
+    spec->pos = 0;
 
-        /* If frame contains gyro frame */
-        case BMI3_FIFO_HEAD_LESS_GYR_FRM:
+    if (summary->blocks < UINT8_MAX)
+    {
+        summary->blocks++;
+    }
+}
+#endif
 
-            /* Get the gyro data */
-            rslt = unpack_gyro_data(&fifo_gyr_data[(*updated_frm_idx)], *idx, fifo);
+#ifdef BMI3_SHOCK_DETECT
 
-            if (rslt == 0 || rslt == BMI3_W_FIFO_GYRO_DUMMY_FRAME || rslt == BMI3_W_ST_PARTIAL_READ)
-            {
-                update_data_index(idx, updated_frm_idx, BMI3_LENGTH_FIFO_GYR, rslt);
-            }
-            else if (rslt == BMI3_W_PARTIAL_READ)
-            {
-                /* Since partial occur making data start index to FIFO available length
-                 * to end of the loop */
-                *idx = fifo_available_len_in_bytes;
-            }
+/*!
+ * @brief This internal API scans the accelerometer frames of the FIFO data for
+ * axis values above the threshold.
+ */
+static void scan_fifo_shocks(int32_t threshold,
+                             const struct bmi3_shock_config *config,
+                             struct bmi3_shock_event *events,
+                             uint8_t *n_events,
+                             const struct bmi3_fifo_frame_layout *layout,
+                             const struct bmi3_fifo_frame *fifo,
+                             const struct bmi3_dev *dev)
+{
+    /* Variables to store the number of shocks and the maximum number */
+    uint8_t count = 0;
+    uint8_t max_count = *n_events;
 
-            break;
+    /* Variables to index the frames */
+    uint16_t frame = 0;
+    uint16_t frames = 0;
+
+    /* Variables to store the index of a frame and the end of valid FIFO data */
+    uint16_t data_index;
+    uint16_t data_end = get_fifo_data_end(fifo, dev);
+
+    /* Pointer to the accelerometer data of the frame */
+    const uint8_t *acc;
+
+    /* Variables to store axis values and the highest absolute one of the frame */
+    int32_t x, y, z;
+    int32_t level;
+
+    /* Variable to store the highest absolute axis value of the current shock */
+    int32_t peak_level = 0;
 
-        /* If frame contains temperature frame */
-        case BMI3_FIFO_HEAD_LESS_TEMP_FRM:
+    /* Pointer to the current shock, NULL if none */
+    struct bmi3_shock_event *event = NULL;
 
-            /* Get the temperature data */
-            rslt = unpack_temperature_data(&fifo_temp_data[(*updated_frm_idx)], *idx, fifo);
+    if (data_end > dev->dummy_byte)
+    {
+        frames = (uint16_t)((data_end - dev->dummy_byte) / layout->frame_len);
+    }
+
+    for (frame = 0; frame < frames; frame++)
+    {
+        acc = &fifo->data[dev->dummy_byte + ((uint32_t)frame * layout->frame_len) + layout->acc_offset];
+        x = (int16_t)(((uint16_t)acc[1] << 8) | acc[0]);
+        y = (int16_t)(((uint16_t)acc[3] << 8) | acc[2]);
+        z = (int16_t)(((uint16_t)acc[5] << 8) | acc[4]);
 
-            if (rslt == BMI3_OK || rslt == BMI3_W_FIFO_TEMP_DUMMY_FRAME || rslt == BMI3_W_ST_PARTIAL_READ)
+        /* Highest absolute axis value, as conditional moves rather than branches on the data */
+        level = BMI3_ABS(x);
+        level = (BMI3_ABS(y) > level) ? BMI3_ABS(y) : level;
+        level = (BMI3_ABS(z) > level) ? BMI3_ABS(z) : level;
+
+        if ((level > threshold) && ((uint16_t)x != BMI3_FIFO_ACCEL_DUMMY_FRAME))
+        {
+            /* Frames above the threshold within the context window of a shock extend it */
+            if ((event == NULL) || (frame >= event->end_frame))
             {
-                update_data_index(idx, updated_frm_idx, BMI3_LENGTH_TEMPERATURE, rslt);
+                if (count == max_count)
+                {
+                    break;
+                }
+
+                event = &events[count];
+                count++;
+                event->first_frame = (frame > config->pre_frames) ? (uint16_t)(frame - config->pre_frames) : 0;
+                peak_level = 0;
             }
-            else if (rslt == BMI3_W_PARTIAL_READ)
+
+            event->end_frame = ((uint32_t)frame + 1 + config->post_frames < frames) ?
+                               (uint16_t)(frame + 1 + config->post_frames) : frames;
+
+            if (level > peak_level)
             {
-                /* Since partial occur making data start index to FIFO available length
-                 * to end of the loop */
-                *idx = fifo_available_len_in_bytes;
+                peak_level = level;
+                event->peak_frame = frame;
+                event->peak.x = (int16_t)x;
+                event->peak.y = (int16_t)y;
+                event->peak.z = (int16_t)z;
             }
+        }
+    }
 
-            break;
-
-        default:
-            rslt = BMI3_W_FIFO_INVALID_FRAME;
+    /* Peaks are completed by the sensor time and the axes correction */
+    for (frame = 0; frame < count; frame++)
+    {
+        data_index = (uint16_t)(dev->dummy_byte + ((uint32_t)events[frame].peak_frame * layout->frame_len));
+        events[frame].peak.sensor_time = 0;
+        (void)unpack_sensor_time(&events[frame].peak.sensor_time, data_index, data_end, layout, fifo);
 
-            break;
+        if (dev->acc_corr != NULL)
+        {
+            correct_axes(&events[frame].peak.x, &events[frame].peak.y, &events[frame].peak.z, dev->acc_corr);
+        }
     }
 
-    return rslt;
+    *n_events = count;
 }
+#endif
 
 /*!
- * @brief This internal API is used to parse accelerometer data from the
- * FIFO data.
+ * @brief This internal API gets the sensor/feature data for accelerometer, gyroscope,
+ * step counter, orientation, i3c sync accel, i3c sync gyro and i3c sync temperature.
  */
-static int8_t unpack_accel_data(struct bmi3_fifo_sens_axes_data *acc,
-                                uint16_t data_start_index,
-                                const struct bmi3_fifo_frame *fifo)
+static int8_t get_sensor_data(struct bmi3_sensor_data *sensor_data, uint8_t n_sens, struct bmi3_dev *dev)
 {
     /* Variable to store result of API */
     int8_t rslt = BMI3_OK;
 
-    /* Variable to store the sensor time index value */
-    uint16_t sens_time_data_idx;
+    /* Variable to define loop */
+    uint8_t loop;
 
-    /* Variable to store LSB value */
-    uint16_t data_lsb;
+    /* Array to store register data along with the dummy bytes */
+    uint8_t buf[BMI3_READ_REG_DATA_SAT_LEN + BMI3_MAX_DUMMY_BYTE];
 
-    /* Variables to store MSB value */
-    uint16_t data_msb;
+    /* Pointer to the register data next to the dummy bytes */
+    const uint8_t *reg_data = buf;
 
-    /* Variable to store dummy data value which will get in FIFO data */
-    uint16_t dummy_data;
+    /* Array to store i3c sync data of the feature engine */
+    uint8_t sync_data[BMI3_NUM_BYTES_I3C_SYNC_ACC] = { 0 };
 
-    /* Variable to store fifo available length in bytes */
-    uint16_t fifo_available_len_in_bytes;
+    /* Variables to store the window of the data registers to be read, as byte offsets from accel data */
+    uint8_t data_start = BMI3_READ_REG_DATA_SAT_LEN;
+    uint8_t data_len = 0;
 
-    /* Convert available fifo length from word to byte */
-    fifo_available_len_in_bytes = (uint16_t)(fifo->available_fifo_len * 2);
+    /* Variable to store the feature engine base address of the i3c sync data to be read */
+    uint8_t sync_base = BMI3_BASE_ADDR_I3C_SYNC_TIME;
 
-    if ((data_start_index + BMI3_LENGTH_FIFO_ACC) <= fifo_available_len_in_bytes)
+    /* Plan the bursts: data registers and i3c sync data are read once for all the requested sensors */
+    for (loop = 0; loop < n_sens; loop++)
     {
-        /* Accelerometer raw x data */
-        data_lsb = fifo->data[data_start_index++];
-        data_msb = fifo->data[data_start_index++];
+        switch (sensor_data[loop].type)
+        {
+            /* Only the data of the requested sensors is read, along with sensor time and saturation flags */
+            case BMI3_ACCEL:
+                data_start = 0;
+                data_len = BMI3_READ_REG_DATA_SAT_LEN;
+                break;
 
-        /* To store the dummy data */
-        dummy_data = (uint16_t)(((uint16_t)data_msb << 8) | data_lsb);
+            case BMI3_GYRO:
+                if (data_start > BMI3_READ_REG_DATA_GYR_POS)
+                {
+                    data_start = BMI3_READ_REG_DATA_GYR_POS;
+                }
 
-        if (dummy_data != BMI3_FIFO_ACCEL_DUMMY_FRAME)
-        {
-            acc->x = (int16_t)(((uint16_t)data_msb << 8) | data_lsb);
+                data_len = BMI3_READ_REG_DATA_SAT_LEN;
+                break;
 
-            /* Accelerometer raw y data */
-            data_lsb = fifo->data[data_start_index++];
-            data_msb = fifo->data[data_start_index++];
-            acc->y = (int16_t)(((uint16_t)data_msb << 8) | data_lsb);
+            case BMI3_TEMP:
+                if (data_start > BMI3_READ_REG_DATA_TEMP_POS)
+                {
+                    data_start = BMI3_READ_REG_DATA_TEMP_POS;
+                }
 
-            /* Accelerometer raw z data */
-            data_lsb = fifo->data[data_start_index++];
-            data_msb = fifo->data[data_start_index++];
-            acc->z = (int16_t)(((uint16_t)data_msb << 8) | data_lsb);
-        }
-        else
-        {
-            rslt = BMI3_W_FIFO_ACCEL_DUMMY_FRAME;
+                if (data_len < BMI3_READ_REG_DATA_TIME_LEN)
+                {
+                    data_len = BMI3_READ_REG_DATA_TIME_LEN;
+                }
+
+                break;
+
+            case BMI3_I3C_SYNC_ACCEL:
+                sync_base = BMI3_BASE_ADDR_I3C_SYNC_ACC;
+                break;
+
+            case BMI3_I3C_SYNC_GYRO:
+                if (sync_base > BMI3_BASE_ADDR_I3C_SYNC_GYR)
+                {
+                    sync_base = BMI3_BASE_ADDR_I3C_SYNC_GYR;
+                }
+
+                break;
+
+            case BMI3_I3C_SYNC_TEMP:
+                if (sync_base > BMI3_BASE_ADDR_I3C_SYNC_TEMP)
+                {
+                    sync_base = BMI3_BASE_ADDR_I3C_SYNC_TEMP;
+                }
+
+                break;
+
+            default:
+                break;
         }
     }
-    else
+
+    if (data_len != 0)
     {
-        rslt = BMI3_W_PARTIAL_READ;
+        /* Read the data registers without copying them out of the dummy bytes. The window is placed in the
+         * buffer at its offset from accel data, so that the register data is decoded at the same offsets.
+         * The burst ends at the saturation flags, as the interrupt status registers next to them are
+         * cleared on read; step counter is read in a burst of its own
+         */
+        rslt = read_regs_direct((uint8_t)(BMI3_REG_ACC_DATA_X + (data_start / 2)),
+                                &buf[data_start],
+                                (uint16_t)(data_len - data_start),
+                                dev->read,
+                                dev);
+        reg_data = &buf[dev->dummy_byte];
     }
 
-    sens_time_data_idx = data_start_index;
-    acc->sensor_time = 0;
+    if ((rslt == BMI3_OK) && (sync_base != BMI3_BASE_ADDR_I3C_SYNC_TIME))
+    {
+        rslt = get_i3c_sync_data(sync_data, sync_base, dev);
+    }
 
-    if (fifo->available_fifo_sens & BMI3_FIFO_HEAD_LESS_SENS_TIME_FRM)
+    if (rslt == BMI3_OK)
     {
-        if (fifo->available_fifo_sens & BMI3_FIFO_HEAD_LESS_GYR_FRM)
+        for (loop = 0; loop < n_sens; loop++)
         {
-            sens_time_data_idx = sens_time_data_idx + BMI3_LENGTH_FIFO_GYR;
-        }
+            switch (sensor_data[loop].type)
+            {
+                case BMI3_ACCEL:
+                    rslt = get_accel_sensortime_sat_data(&sensor_data[loop].sens_data.acc, reg_data);
+                    break;
 
-        if (fifo->available_fifo_sens & BMI3_FIFO_HEAD_LESS_TEMP_FRM)
-        {
-            sens_time_data_idx = sens_time_data_idx + BMI3_LENGTH_TEMPERATURE;
-        }
+                case BMI3_GYRO:
+                    rslt = get_gyro_sensortime_sat_data(&sensor_data[loop].sens_data.gyr, reg_data);
+                    break;
 
-        if ((sens_time_data_idx + BMI3_LENGTH_SENSOR_TIME) <= fifo_available_len_in_bytes)
-        {
-            /* Sensor time raw data */
-            data_lsb = fifo->data[sens_time_data_idx++];
-            data_msb = fifo->data[sens_time_data_idx++];
+                case BMI3_TEMP:
+                    rslt = get_temp_sensortime_data(&sensor_data[loop].sens_data.temp, reg_data);
+                    break;
 
-            acc->sensor_time = (uint16_t)(((uint16_t)data_msb << 8) | data_lsb);
-        }
-        else
-        {
-            rslt = BMI3_W_ST_PARTIAL_READ;
+                case BMI3_STEP_COUNTER:
+                    rslt = get_step_counter_sensor_data(&sensor_data[loop].sens_data.step_counter_output,
+                                                        BMI3_REG_FEATURE_IO2,
+                                                        dev);
+                    break;
+
+                case BMI3_ORIENTATION:
+                    rslt = get_orient_output_data(&sensor_data[loop].sens_data.orient_output,
+                                                  BMI3_REG_FEATURE_EVENT_EXT,
+                                                  dev);
+                    break;
+
+                case BMI3_I3C_SYNC_ACCEL:
+                    get_i3c_sync_sensor_data(&sensor_data[loop].sens_data.i3c_sync,
+                                             sync_data,
+                                             BMI3_BASE_ADDR_I3C_SYNC_ACC,
+                                             sync_base);
+                    break;
+
+                case BMI3_I3C_SYNC_GYRO:
+                    get_i3c_sync_sensor_data(&sensor_data[loop].sens_data.i3c_sync,
+                                             sync_data,
+                                             BMI3_BASE_ADDR_I3C_SYNC_GYR,
+                                             sync_base);
+                    break;
+
+                case BMI3_I3C_SYNC_TEMP:
+                    get_i3c_sync_temp_data(&sensor_data[loop].sens_data.i3c_sync, sync_data, sync_base);
+                    break;
+
+                default:
+                    rslt = BMI3_E_INVALID_SENSOR;
+                    break;
+            }
+
+            /* Return error if any of the get sensor data fails */
+            if (rslt != BMI3_OK)
+            {
+                break;
+            }
         }
     }
 
@@ -6990,1928 +19350,2015 @@ static int8_t unpack_accel_data(struct bmi3_fifo_sens_axes_data *acc,
 }
 
 /*!
- * @brief This internal API is used to parse temperature data from the
- * FIFO data.
+ * @brief This internal API gives the index of a buffer of a ping-pong FIFO
+ * acquisition from the free-running count of buffers.
  */
-static int8_t unpack_temperature_data(struct bmi3_fifo_temperature_data *temp,
-                                      uint16_t data_start_index,
-                                      const struct bmi3_fifo_frame *fifo)
+static uint8_t pingpong_index(const struct bmi3_fifo_pingpong *pingpong, uint8_t count)
 {
-    /* Variable to store result of API */
-    int8_t rslt = BMI3_OK;
-
-    /* Variable to store the sensor time index value */
-    uint16_t sens_time_data_idx;
-
-    /* Variables to store LSB value */
-    uint16_t data_lsb;
-
-    /* Variables to store MSB value */
-    uint16_t data_msb;
-
-    /* Variable to store dummy data value which will get in FIFO data */
-    uint16_t dummy_data;
-
-    /* Variable to store fifo available length in bytes */
-    uint16_t fifo_available_len_in_bytes;
-
-    /* Convert available fifo length from word to byte */
-    fifo_available_len_in_bytes = (uint16_t)(fifo->available_fifo_len * 2);
-
-    if ((data_start_index + BMI3_LENGTH_TEMPERATURE) <= fifo_available_len_in_bytes)
-    {
-        /* Temperature raw data */
-        data_lsb = fifo->data[data_start_index++];
-        data_msb = fifo->data[data_start_index++];
-
-        /* To store the dummy data */
-        dummy_data = (uint16_t)(((uint16_t)data_msb << 8) | data_lsb);
+    /* Counts wrap at 256, which is not a multiple of every number of buffers */
+    return (uint8_t)(count % pingpong->n_buf);
+}
 
-        temp->temp_data = (uint16_t)(((uint16_t)data_msb << 8) | data_lsb);
+/*!
+ * @brief This internal API gives the number of bytes of the config array
+ * written at once.
+ */
+static uint16_t get_upload_burst_len(const struct bmi3_dev *dev)
+{
+    /* Variable to store the largest number of bytes written at once */
+    uint16_t burst_len = dev->read_write_len;
 
-        if (dummy_data != BMI3_FIFO_TEMP_DUMMY_FRAME)
-        {
-            temp->temp_data = (uint16_t)(((uint16_t)data_msb << 8) | data_lsb);
-        }
-        else
-        {
-            rslt = BMI3_W_FIFO_TEMP_DUMMY_FRAME;
-        }
-    }
-    else
+    if ((dev->upload_cfg != NULL) && (dev->upload_cfg->max_burst_len != 0))
     {
-        rslt = BMI3_W_PARTIAL_READ;
+        burst_len = dev->upload_cfg->max_burst_len;
     }
 
-    sens_time_data_idx = data_start_index;
-    temp->sensor_time = 0;
+    /* Bytes written are multiples of 2, at least one word */
+    burst_len &= (uint16_t)~1u;
 
-    if (fifo->available_fifo_sens & BMI3_FIFO_HEAD_LESS_SENS_TIME_FRM)
+    if (burst_len < 2)
     {
-        if ((sens_time_data_idx + BMI3_LENGTH_SENSOR_TIME) <= fifo_available_len_in_bytes)
-        {
-            /* Sensor time raw data */
-            data_lsb = fifo->data[sens_time_data_idx++];
-            data_msb = fifo->data[sens_time_data_idx++];
-            temp->sensor_time = (uint16_t)(((uint16_t)data_msb << 8) | data_lsb);
-        }
-        else
-        {
-            rslt = BMI3_W_ST_PARTIAL_READ;
-        }
+        burst_len = 2;
     }
 
-    return rslt;
+    return burst_len;
 }
 
 /*!
- * @brief This internal API is used to parse gyro data from the
- * FIFO data.
+ * @brief This internal API runs a step of the resumable soft-reset.
  */
-static int8_t unpack_gyro_data(struct bmi3_fifo_sens_axes_data *gyro,
-                               uint16_t data_start_index,
-                               const struct bmi3_fifo_frame *fifo)
+static int8_t op_soft_reset(struct bmi3_op *op, struct bmi3_dev *dev)
 {
     /* Variable to store result of API */
     int8_t rslt = BMI3_OK;
 
-    /* Variable to store the sensor time index value */
-    uint16_t sens_time_data_idx;
+    /* Variable to read the dummy byte */
+    uint8_t dummy_byte[2] = { 0 };
 
-    /* Variables to store LSB value */
-    uint16_t data_lsb;
+    /* Variable to store feature data array */
+    uint8_t feature_data[2] = { 0x2c, 0x01 };
 
-    /* Variables to store MSB value */
-    uint16_t data_msb;
+    /* Variable to enable feature engine bit */
+    uint8_t feature_engine_en[2] = { BMI3_ENABLE, 0 };
 
-    /* Variable to store dummy data value which will get in FIFO data */
-    uint16_t dummy_data;
+    /* Variable to store status value for feature engine enable */
+    uint8_t reg_data[2] = { 0 };
 
-    /* Variable to store fifo available length in bytes */
-    uint16_t fifo_available_len_in_bytes;
+    /* Array variable to store feature IO status */
+    uint8_t feature_io_status[2] = { BMI3_ENABLE, 0 };
 
-    /* Convert available fifo length from word to byte */
-    fifo_available_len_in_bytes = (uint16_t)(fifo->available_fifo_len * 2);
+    /* Default boot configuration */
+    const struct bmi3_boot_cfg default_boot_cfg = {
+        BMI3_FEATURE_ENGINE_POLL_DELAY, BMI3_FEATURE_ENGINE_TIMEOUT, BMI3_ENABLE, BMI3_DISABLE
+    };
 
-    if ((data_start_index + BMI3_LENGTH_FIFO_GYR) <= fifo_available_len_in_bytes)
+    /* Boot configuration in use */
+    const struct bmi3_boot_cfg *boot_cfg = &default_boot_cfg;
+
+    if (dev->boot_cfg != NULL)
     {
-        /* Gyro raw x data */
-        data_lsb = fifo->data[data_start_index++];
-        data_msb = fifo->data[data_start_index++];
+        boot_cfg = dev->boot_cfg;
+    }
 
-        /* To store the dummy data */
-        dummy_data = (uint16_t)(((uint16_t)data_msb << 8) | data_lsb);
+    switch (op->step)
+    {
+        case 0:
+            if ((boot_cfg->feature_engine_en == BMI3_ENABLE) && (boot_cfg->poll_interval_us == 0))
+            {
+                rslt = BMI3_E_INVALID_INPUT;
+            }
+            else
+            {
+                /* Reset bmi3 device */
+                rslt = bmi3_set_command_register(BMI3_CMD_SOFT_RESET, dev);
+            }
 
-        gyro->x = (int16_t)(((uint16_t)data_msb << 8) | data_lsb);
+            if (rslt == BMI3_OK)
+            {
+                op->wait_us = BMI3_SOFT_RESET_DELAY;
+                op->step = 1;
+                rslt = BMI3_W_OP_PENDING;
+            }
 
-        /* Gyro raw y data */
-        data_lsb = fifo->data[data_start_index++];
-        data_msb = fifo->data[data_start_index++];
-        gyro->y = (int16_t)(((uint16_t)data_msb << 8) | data_lsb);
+            break;
 
-        /* Gyro raw z data */
-        data_lsb = fifo->data[data_start_index++];
-        data_msb = fifo->data[data_start_index++];
-        gyro->z = (int16_t)(((uint16_t)data_msb << 8) | data_lsb);
+        case 1:
 
-        if (dummy_data == BMI3_FIFO_GYRO_DUMMY_FRAME)
-        {
-            rslt = BMI3_W_FIFO_GYRO_DUMMY_FRAME;
-        }
-    }
-    else
-    {
-        rslt = BMI3_W_PARTIAL_READ;
-    }
+            /* Performing a dummy read after a soft-reset */
+            if (dev->intf == BMI3_SPI_INTF)
+            {
+                rslt = bmi3_get_regs(BMI3_REG_CHIP_ID, dummy_byte, 2, dev);
+            }
 
-    sens_time_data_idx = data_start_index;
-    gyro->sensor_time = 0;
+            /* Enabling Feature engine, unless it is not required */
+            if ((rslt == BMI3_OK) && (boot_cfg->feature_engine_en == BMI3_ENABLE))
+            {
+                rslt = bmi3_set_regs(BMI3_REG_FEATURE_IO2, feature_data, 2, dev);
 
-    if (fifo->available_fifo_sens & BMI3_FIFO_HEAD_LESS_SENS_TIME_FRM)
-    {
-        if (fifo->available_fifo_sens & BMI3_FIFO_HEAD_LESS_TEMP_FRM)
-        {
-            sens_time_data_idx = sens_time_data_idx + BMI3_LENGTH_TEMPERATURE;
-        }
+                if (rslt == BMI3_OK)
+                {
+                    /* Enabling feature status bit */
+                    rslt = bmi3_set_regs(BMI3_REG_FEATURE_IO_STATUS, feature_io_status, 2, dev);
+                }
 
-        if ((sens_time_data_idx + BMI3_LENGTH_SENSOR_TIME) <= fifo_available_len_in_bytes)
-        {
-            /* Sensor time raw data */
-            data_lsb = fifo->data[sens_time_data_idx++];
-            data_msb = fifo->data[sens_time_data_idx++];
-            gyro->sensor_time = (uint16_t)(((uint16_t)data_msb << 8) | data_lsb);
-        }
-        else
-        {
-            rslt = BMI3_W_ST_PARTIAL_READ;
-        }
+                if (rslt == BMI3_OK)
+                {
+                    /* Enable feature engine bit */
+                    rslt = bmi3_set_regs(BMI3_REG_FEATURE_CTRL, feature_engine_en, 2, dev);
+                }
+
+                if (rslt == BMI3_OK)
+                {
+                    op->elapsed = 0;
+                    op->wait_us = boot_cfg->poll_interval_us;
+                    op->step = 2;
+                    rslt = BMI3_W_OP_PENDING;
+                }
+            }
+
+            break;
+
+        default:
+
+            /* Checking the status bit for feature engine enable */
+            rslt = bmi3_get_regs(BMI3_REG_FEATURE_IO1, reg_data, 2, dev);
+            op->elapsed += boot_cfg->poll_interval_us;
+
+            if ((rslt == BMI3_OK) && !(reg_data[0] & BMI3_FEATURE_ENGINE_ENABLE_MASK))
+            {
+                if (op->elapsed < boot_cfg->timeout_us)
+                {
+                    op->wait_us = boot_cfg->poll_interval_us;
+                    rslt = BMI3_W_OP_PENDING;
+                }
+                else
+                {
+                    rslt = BMI3_E_FEATURE_ENGINE_STATUS;
+                }
+            }
+
+            break;
     }
 
     return rslt;
 }
 
 /*!
- * @brief This internal API sets the precondition settings such as alternate accelerometer and
- * gyroscope enable bits, accelerometer mode and output data rate.
+ * @brief This internal API runs a step of the resumable self-test.
  */
-static int8_t st_precondition(uint8_t st_select, struct bmi3_dev *dev)
+static int8_t op_self_test(struct bmi3_op *op, struct bmi3_dev *dev)
 {
     /* Variable to store result of API */
     int8_t rslt;
 
-    /* Structure instance of sensor config */
-    struct bmi3_sens_config config = { 0 };
-
-    config.type = BMI3_ACCEL;
-
-    rslt = bmi3_get_sensor_config(&config, 1, dev);
+    if (op->step == 0)
+    {
+        rslt = bmi3_self_test_start(op->selection, &op->st_ctx, dev);
 
-    if (rslt == BMI3_OK)
+        if (rslt == BMI3_OK)
+        {
+            op->step = 1;
+            rslt = BMI3_W_ST_ONGOING;
+        }
+    }
+    else
     {
-        switch (st_select)
+        rslt = bmi3_self_test_poll(&op->st_ctx, dev);
+
+        if (rslt != BMI3_W_ST_ONGOING)
         {
-            case BMI3_ST_ACCEL_ONLY:
-                rslt = BMI3_OK;
-                break;
-            case BMI3_ST_GYRO_ONLY:
-            case BMI3_ST_BOTH_ACC_GYR:
-                rslt = BMI3_OK;
-                config.cfg.acc.acc_mode = BMI3_ACC_MODE_HIGH_PERF;
-                config.cfg.acc.odr = BMI3_ACC_ODR_100HZ;
-                break;
-            default:
-                rslt = BMI3_E_INVALID_ST_SELECTION;
-                break;
+            /* Accel configuration is restored, also if the poll failed */
+            rslt = bmi3_self_test_finish(&op->st_ctx, op->st_result, dev);
         }
     }
 
-    if (rslt == BMI3_OK)
+    if (rslt == BMI3_W_ST_ONGOING)
     {
-        rslt = bmi3_set_sensor_config(&config, 1, dev);
+        /* A delay of 35ms is required between two polls of the self-test status */
+        op->wait_us = BMI3_ST_DELAY;
+        rslt = BMI3_W_OP_PENDING;
     }
 
     return rslt;
 }
 
 /*!
- * @brief This internal API gets and sets the self-test mode given
- *  by the user in the self-test dma register.
+ * @brief This internal API runs a step of the resumable gyro self-calibration.
  */
-static int8_t get_set_st_dma(uint8_t st_selection, struct bmi3_dev *dev)
+static int8_t op_gyro_sc(struct bmi3_op *op, struct bmi3_dev *dev)
 {
     /* Variable to store result of API */
     int8_t rslt;
 
-    uint8_t reg_data[2];
-
-    /* Array to set the base address of self-test feature */
-    uint8_t base_addr[2] = { BMI3_BASE_ADDR_ST_SELECT, 0 };
-
-    rslt = bmi3_set_regs(BMI3_REG_FEATURE_DATA_ADDR, base_addr, 2, dev);
-
-    if (rslt == BMI3_OK)
+    if (op->step == 0)
     {
-        rslt = bmi3_get_regs(BMI3_REG_FEATURE_DATA_TX, reg_data, 2, dev);
-
-        reg_data[0] = st_selection;
+        rslt = bmi3_gyro_sc_start(op->selection, op->apply_corr, &op->sc_ctx, dev);
 
         if (rslt == BMI3_OK)
         {
-            rslt = bmi3_set_regs(BMI3_REG_FEATURE_DATA_ADDR, base_addr, 2, dev);
-
-            if (rslt == BMI3_OK)
-            {
-                rslt = bmi3_set_regs(BMI3_REG_FEATURE_DATA_TX, reg_data, 2, dev);
-            }
+            op->step = 1;
+            rslt = BMI3_W_SC_ONGOING;
         }
     }
-
-    return rslt;
-}
-
-/*!
- * @brief This internal API sets the self-test preconditions and triggers the self-test in the command register.
- */
-static int8_t self_test_conditions(uint8_t st_selection, struct bmi3_dev *dev)
-{
-    int8_t rslt;
-
-    /* Pre conditions to be checked */
-    rslt = st_precondition(st_selection, dev);
-
-    if (rslt == BMI3_OK)
+    else
     {
-        /* Disable alternate accel and gyro mode */
-        rslt = disable_alt_conf_acc_gyr_mode(dev);
+        rslt = bmi3_gyro_sc_poll(&op->sc_ctx, dev);
 
-        if (rslt == BMI3_OK)
+        if (rslt != BMI3_W_SC_ONGOING)
         {
-            rslt = bmi3_set_command_register(BMI3_CMD_SELF_TEST_TRIGGER, dev);
+            /* Accel configuration is restored, also if the poll failed */
+            rslt = bmi3_gyro_sc_finish(&op->sc_ctx, op->sc_rslt, dev);
         }
     }
 
+    if (rslt == BMI3_W_SC_ONGOING)
+    {
+        /* A delay of 43ms is required between two polls of the self-calibration status */
+        op->wait_us = BMI3_SC_DELAY;
+        rslt = BMI3_W_OP_PENDING;
+    }
+
     return rslt;
 }
 
 /*!
- * @brief This internal API is used to disable alternate config accel and gyro mode for self-test precondition.
+ * @brief This internal API runs a step of the resumable config array upload,
+ * writing one burst of the config array.
  */
-static int8_t disable_alt_conf_acc_gyr_mode(struct bmi3_dev *dev)
+static int8_t op_upload_config_array(struct bmi3_op *op, struct bmi3_dev *dev)
 {
+    /* Variable to store result of API */
     int8_t rslt;
 
-    struct bmi3_alt_accel_config alt_acc_cfg;
-
-    struct bmi3_alt_gyro_config alt_gyr_cfg;
-
-    rslt = get_alternate_accel_config(&alt_acc_cfg, dev);
+    /* Variable to store the number of bytes written at once */
+    uint16_t len;
 
-    if (rslt == BMI3_OK)
+    if (op->step == 0)
     {
-        alt_acc_cfg.alt_acc_mode = BMI3_DISABLE;
-
-        rslt = set_alternate_accel_config(&alt_acc_cfg, dev);
+        /* First two bytes of config array denotes the base address, set once for the whole array */
+        rslt = bmi3_set_regs(BMI3_REG_FEATURE_DATA_ADDR, op->config_array, 2, dev);
+        op->count = BMI3_CONFIG_ARRAY_DATA_START_ADDR;
+        op->step = 1;
+    }
+    else if (op->count < op->config_size)
+    {
+        len = (uint16_t)(op->config_size - op->count);
 
-        if (rslt == BMI3_OK)
+        if (len > get_upload_burst_len(dev))
         {
-            rslt = get_alternate_gyro_config(&alt_gyr_cfg, dev);
+            len = get_upload_burst_len(dev);
+        }
 
-            if (rslt == BMI3_OK)
-            {
-                alt_gyr_cfg.alt_gyro_mode = BMI3_DISABLE;
+        rslt = bmi3_set_regs(BMI3_REG_FEATURE_DATA_TX, &op->config_array[op->count], len, dev);
+        op->count += len;
+    }
+    else
+    {
+        /* Upload is verified in a step of its own, if enabled */
+        rslt = verify_config_array(op->config_array, op->config_size, dev);
+        op->step = 2;
+    }
 
-                rslt = set_alternate_gyro_config(&alt_gyr_cfg, dev);
-            }
-        }
+    if ((rslt == BMI3_OK) && (op->step == 1) &&
+        ((op->count < op->config_size) || ((dev->upload_cfg != NULL) && (dev->upload_cfg->verify == BMI3_ENABLE))))
+    {
+        /* Yield after each transfer, the bus is given to other users in between */
+        op->wait_us = 0;
+        rslt = BMI3_W_OP_PENDING;
     }
 
     return rslt;
 }
 
 /*!
- * @brief This internal API is used to get the status of gyro self-test and the result of the event.
+ * @brief This internal API runs a step of the resumable accel FOC, polling
+ * the data ready status once.
  */
-static int8_t get_st_status_rslt(uint8_t st_selection, struct bmi3_st_result *st_result_status, struct bmi3_dev *dev)
+static int8_t op_accel_foc(struct bmi3_op *op, struct bmi3_dev *dev)
 {
     /* Variable to store result of API */
     int8_t rslt;
 
-    /* Variable to define data array */
-    uint8_t data_array[2];
-
-    /* Variable to define reg data */
-    uint8_t reg_data[2];
+    /* Variable to store status read from the status register */
+    uint16_t reg_status = 0;
 
-    /* Variable to store the self-test status if it is ongoing or completed */
-    uint8_t st_complete_flag = 0;
+    /* Variable to store the data ready status of the step */
+    uint16_t drdy_mask = BMI3_DRDY_ACC_MASK;
 
-    /* Variable to define index */
-    uint8_t idx;
+    /* Structure to store sensor data */
+    struct bmi3_sensor_data sensor_data = { 0 };
 
-    /* Variable to define the number of iterations */
-    uint8_t limit = 10;
+    /* Structure to store the average of accelerometer data */
+    struct bmi3_sens_axes_data accel_avg = { 0 };
 
-    /* Variable to define feature engine errors */
-    uint8_t feature_engine_err_reg_lsb, feature_engine_err_reg_msb;
+    /* Structure to define the accelerometer configurations */
+    struct bmi3_accel_config acc_cfg = { 0 };
 
-    /* Array to set the base address of self-test feature */
-    uint8_t sc_st_base_addr[2] = { BMI3_BASE_ADDR_ST_RESULT, 0 };
+    /* Position is verified on every data ready status, as by get_average_of_sensor_data */
+    if (op->step == 0)
+    {
+        drdy_mask = UINT16_C(0xFFFF);
+    }
 
-    st_result_status->self_test_err_status = 0;
+    rslt = bmi3_get_sensor_status(&reg_status, dev);
 
-    for (idx = 0; idx < limit; idx++)
+    if ((rslt == BMI3_OK) && (reg_status & drdy_mask))
     {
-        /* A delay of 350ms (35ms * 10(limit)) is required to run self-test for accel and gyro */
-        dev->delay_us(BMI3_ST_DELAY, dev->intf_ptr);
-
-        rslt = bmi3_get_regs(BMI3_REG_FEATURE_IO1, data_array, 2, dev);
+        sensor_data.type = BMI3_ACCEL;
+        rslt = bmi3_get_sensor_data(&sensor_data, 1, dev);
 
         if (rslt == BMI3_OK)
         {
-            st_complete_flag = (data_array[0] & BMI3_SC_ST_STATUS_MASK) >> BMI3_SC_ST_COMPLETE_POS;
-
-            if (st_complete_flag == BMI3_TRUE)
-            {
-                break;
-            }
+            op->foc_sum.x += sensor_data.sens_data.acc.x;
+            op->foc_sum.y += sensor_data.sens_data.acc.y;
+            op->foc_sum.z += sensor_data.sens_data.acc.z;
+            op->tries = BMI3_OP_FOC_TRIES;
+            op->count++;
         }
     }
-
-    rslt = bmi3_get_feature_engine_error_status(&feature_engine_err_reg_lsb, &feature_engine_err_reg_msb, dev);
-    st_result_status->self_test_err_status = feature_engine_err_reg_lsb & BMI3_SET_LOW_NIBBLE;
-
-    if (st_complete_flag == BMI3_TRUE)
+    else if (rslt == BMI3_OK)
     {
-        /* To avoid retaining the values of last iteration , the values are cleared*/
-        st_result_status->acc_sens_x_ok = BMI3_DISABLE;
-        st_result_status->acc_sens_y_ok = BMI3_DISABLE;
-        st_result_status->acc_sens_z_ok = BMI3_DISABLE;
-        st_result_status->gyr_sens_x_ok = BMI3_DISABLE;
-        st_result_status->gyr_sens_y_ok = BMI3_DISABLE;
-        st_result_status->gyr_sens_z_ok = BMI3_DISABLE;
-        st_result_status->gyr_drive_ok = BMI3_DISABLE;
+        op->tries--;
 
-        /*stores the self test result*/
-        st_result_status->self_test_rslt = (data_array[0] & BMI3_ST_RESULT_MASK) >> BMI3_ST_RESULT_POS;
+        if (op->tries == 0)
+        {
+            rslt = (op->step == 0) ? BMI3_E_DATA_RDY_INT_FAILED : BMI3_E_INVALID_STATUS;
+        }
+    }
 
-        rslt = bmi3_set_regs(BMI3_REG_FEATURE_DATA_ADDR, sc_st_base_addr, 2, dev);
+    if ((rslt == BMI3_OK) && (op->count == BMI3_FOC_SAMPLE_LIMIT))
+    {
+        op->foc_sum.x /= BMI3_FOC_SAMPLE_LIMIT;
+        op->foc_sum.y /= BMI3_FOC_SAMPLE_LIMIT;
+        op->foc_sum.z /= BMI3_FOC_SAMPLE_LIMIT;
 
-        if (rslt == BMI3_OK)
+        if (op->step == 0)
         {
-            rslt = bmi3_get_regs(BMI3_REG_FEATURE_DATA_TX, reg_data, 2, dev);
+            rslt = check_foc_position(BMI3_ACCEL, op->accel_g_value, op->foc_sum, dev);
 
             if (rslt == BMI3_OK)
             {
+                /* Get accelerometer configurations, restored once the offset is set */
+                op->acc_cfg.type = BMI3_ACCEL;
+                rslt = bmi3_get_sensor_config(&op->acc_cfg, 1, dev);
+            }
 
-                if (st_selection & BMI3_ST_ACCEL_ONLY)
-                {
-                    st_result_status->acc_sens_x_ok = (reg_data[0] & BMI3_ST_ACC_X_OK_MASK);
-                    st_result_status->acc_sens_y_ok = (reg_data[0] & BMI3_ST_ACC_Y_OK_MASK) >> BMI3_ST_ACC_Y_OK_POS;
-                    st_result_status->acc_sens_z_ok = (reg_data[0] & BMI3_ST_ACC_Z_OK_MASK) >> BMI3_ST_ACC_Z_OK_POS;
-                }
+            op->foc_sum.x = 0;
+            op->foc_sum.y = 0;
+            op->foc_sum.z = 0;
+            op->count = 0;
+            op->step = 1;
+        }
+        else
+        {
+            accel_avg.x = (int16_t)op->foc_sum.x;
+            accel_avg.y = (int16_t)op->foc_sum.y;
+            accel_avg.z = (int16_t)op->foc_sum.z;
 
-                if (st_selection & BMI3_ST_GYRO_ONLY)
-                {
-                    st_result_status->gyr_sens_x_ok = (reg_data[0] & BMI3_ST_GYR_X_OK_MASK) >> BMI3_ST_GYR_X_OK_POS;
-                    st_result_status->gyr_sens_y_ok = (reg_data[0] & BMI3_ST_GYR_Y_OK_MASK) >> BMI3_ST_GYR_Y_OK_POS;
-                    st_result_status->gyr_sens_z_ok = (reg_data[0] & BMI3_ST_GYR_Z_OK_MASK) >> BMI3_ST_GYR_Z_OK_POS;
-                    st_result_status->gyr_drive_ok = (reg_data[0] & BMI3_ST_GYR_DRIVE_OK_MASK) >>
-                                                     BMI3_ST_GYR_DRIVE_OK_POS;
-                }
+            rslt = set_accel_foc_offset(op->accel_g_value, &accel_avg, &acc_cfg, dev);
+
+            if (rslt == BMI3_OK)
+            {
+                rslt = bmi3_set_sensor_config(&op->acc_cfg, 1, dev);
             }
+
+            op->step = 2;
         }
     }
 
+    if ((rslt == BMI3_OK) && (op->step < 2))
+    {
+        /* Samples are polled at 50Hz ODR */
+        op->wait_us = BMI3_OP_FOC_DELAY;
+        rslt = BMI3_W_OP_PENDING;
+    }
+
     return rslt;
 }
 
 /*!
- * @brief This internal API gets and sets the self-calibration mode given
- *  by the user in the self-calibration dma register.
+ * @brief This internal API resets the state of a resumable operation.
  */
-static int8_t get_set_sc_dma(uint8_t sc_selection, uint8_t apply_corr, struct bmi3_dev *dev)
+static void op_init(uint8_t kind, struct bmi3_op *op)
 {
-    /* Variable to store result of API */
-    int8_t rslt;
+    op->kind = kind;
+    op->step = 0;
+    op->wait_us = 0;
+    op->elapsed = 0;
+    op->count = 0;
+    op->tries = BMI3_OP_FOC_TRIES;
+    op->foc_sum.x = 0;
+    op->foc_sum.y = 0;
+    op->foc_sum.z = 0;
+}
 
-    uint8_t reg_data[2];
+/*!
+ * @brief This internal API decides whether a failed transfer is retried and
+ * waits for the backoff delay before the retry.
+ */
+static uint8_t retry_transfer(uint8_t reg_addr, uint8_t is_write, uint8_t attempt, struct bmi3_dev *dev)
+{
+    /* Variable to store whether the transfer is retried */
+    uint8_t retry = BMI3_DISABLE;
 
-    /* Array to set the base address of self-calibration feature */
-    uint8_t sc_base_addr[2] = { BMI3_BASE_ADDR_GYRO_SC_SELECT, 0 };
+    /* Variable to store the backoff delay */
+    uint32_t backoff;
 
-    rslt = bmi3_set_regs(BMI3_REG_FEATURE_DATA_ADDR, sc_base_addr, 2, dev);
+    /* Pointer to the retry policy */
+    const struct bmi3_retry_cfg *cfg = dev->retry_cfg;
 
-    if (rslt == BMI3_OK)
+    if ((cfg != NULL) && (attempt < cfg->max_retries))
     {
-        rslt = bmi3_get_regs(BMI3_REG_FEATURE_DATA_TX, reg_data, 2, dev);
-
-        /* The value of apply correction is appended with the selection given by the user */
-        reg_data[0] = (apply_corr | sc_selection);
-
-        if (rslt == BMI3_OK)
+        if ((is_write == BMI3_ENABLE) && (reg_addr == BMI3_REG_CMD))
         {
-            rslt = bmi3_set_regs(BMI3_REG_FEATURE_DATA_ADDR, sc_base_addr, 2, dev);
-
-            if (rslt == BMI3_OK)
+            /* Commands are not repeated, the sensor may have taken the command before the failure */
+        }
+        else if (reg_addr == BMI3_REG_FEATURE_DATA_TX)
+        {
+            /* Transmission address auto-increments, it is restored from the cache before the retry */
+            if (dev->cache.enable == BMI3_ENABLE)
             {
-                rslt = bmi3_set_regs(BMI3_REG_FEATURE_DATA_TX, reg_data, 2, dev);
+                dev->cache.feature_addr_sync = BMI3_DISABLE;
+                retry = BMI3_ENABLE;
             }
         }
+        else if ((is_write == BMI3_DISABLE) && (reg_addr == BMI3_REG_FIFO_DATA))
+        {
+            /* Frames read completely by the failed transfer are popped, a retry would hide their loss */
+            dev->retry_stats.fifo_lost++;
+        }
+        else if ((is_write == BMI3_DISABLE) &&
+                 ((reg_addr == BMI3_REG_STATUS) ||
+                  ((reg_addr >= BMI3_REG_INT_STATUS_INT1) && (reg_addr <= BMI3_REG_INT_STATUS_IBI))))
+        {
+            /* Status is cleared by the failed transfer, a retry would return it cleared */
+            dev->retry_stats.status_lost++;
+        }
+        else
+        {
+            retry = BMI3_ENABLE;
+        }
     }
 
-    return rslt;
-}
-
-/* This internal API is used to get the status of gyro self-calibration and the result of the event */
-static int8_t get_sc_gyro_rslt(struct bmi3_self_calib_rslt *sc_rslt, struct bmi3_dev *dev)
-{
-    /* Variable to store result of API */
-    int8_t rslt;
-
-    /* Variable to define index */
-    uint8_t idx;
+    if (retry == BMI3_ENABLE)
+    {
+        backoff = cfg->max_backoff_us;
 
-    /* Variable to define limit */
-    uint8_t limit = 10;
-    uint8_t sc_status;
-    uint8_t data_array[2];
-    uint8_t sc_complete_flag = 0;
+        if (attempt < 31)
+        {
+            backoff = cfg->backoff_us << attempt;
 
-    /* Variable to define feature engine errors */
-    uint8_t feature_engine_err_reg_lsb, feature_engine_err_reg_msb;
+            /* Limit the delay, also if the doubling overflows */
+            if (((backoff >> attempt) != cfg->backoff_us) || (backoff > cfg->max_backoff_us))
+            {
+                backoff = cfg->max_backoff_us;
+            }
+        }
 
-    sc_rslt->sc_error_status = 0;
+        if (backoff != 0)
+        {
+            dev->delay_us(backoff, dev->intf_ptr);
+        }
 
-    for (idx = 0; idx < limit; idx++)
+        dev->retry_stats.retries++;
+    }
+    else if (cfg != NULL)
     {
-        /* A delay of 430ms (43ms * 10(limit)) is required to perform self calibration */
-        dev->delay_us(BMI3_SC_DELAY, dev->intf_ptr);
+        dev->retry_stats.failed++;
+    }
 
-        rslt = bmi3_get_regs(BMI3_REG_FEATURE_IO1, data_array, 2, dev);
+    return retry;
+}
 
-        sc_status = (data_array[0] & BMI3_SC_ST_STATUS_MASK) >> BMI3_SC_ST_COMPLETE_POS;
+/*!
+ * @brief This internal API unwraps a 32-bit sensor time against the newest
+ * sample of the clock synchronization.
+ */
+static uint64_t clock_sync_unwrap(uint32_t sensor_time, const struct bmi3_clock_sync *cs)
+{
+    /* Variable to store distance to the newest sample, modulo 2^32 */
+    uint32_t delta = sensor_time - cs->last_raw;
 
-        if ((sc_status == BMI3_TRUE) && (rslt == BMI3_OK))
-        {
-            /*Bail early if the self-calibration is completed * / */
-            sc_complete_flag = BMI3_TRUE;
-            break;
-        }
-    }
+    /* Variable to store unwrapped sensor time */
+    uint64_t ticks = cs->sample[(cs->head + BMI3_CLOCK_SYNC_SAMPLES - 1) % BMI3_CLOCK_SYNC_SAMPLES].ticks;
 
-    if (sc_complete_flag == BMI3_TRUE)
+    if (delta <= (uint32_t)INT32_MAX)
     {
-        sc_rslt->gyro_sc_rslt = (data_array[0] & BMI3_GYRO_SC_RESULT_MASK) >> BMI3_GYRO_SC_RESULT_POS;
-
-        sc_rslt->sc_error_status = data_array[0];
+        ticks += delta;
     }
     else
     {
-        /* If limit elapses returning the error code, error status is returned */
-        rslt = bmi3_get_feature_engine_error_status(&feature_engine_err_reg_lsb, &feature_engine_err_reg_msb, dev);
-        sc_rslt->sc_error_status = feature_engine_err_reg_lsb;
+        ticks -= (uint32_t)(~delta + 1U);
     }
 
-    return rslt;
+    return ticks;
 }
 
 /*!
- * @brief This internal API gets the i3c sync accelerometer data from the register.
+ * @brief This internal API scales a distance in ticks with the rate of the
+ * clock synchronization.
  */
-static int8_t get_i3c_sync_accel_sensor_data(struct bmi3_i3c_sync_data *data, struct bmi3_dev *dev)
+static int64_t clock_sync_scale(int64_t delta, int64_t rate)
 {
-    /* Variable to store result of API */
-    int8_t rslt;
+    /* Division rounds towards zero for both signs */
+    return (delta * rate) / ((int64_t)1 << BMI3_CLOCK_SYNC_RATE_FRAC);
+}
+
+/*!
+ * @brief This internal API estimates the drift and offset of the clock
+ * synchronization from the samples of its window.
+ */
+static void clock_sync_fit(struct bmi3_clock_sync *cs)
+{
+    /* Variable to define loop */
+    uint8_t index;
 
-    /* Array to define data stored in register */
-    uint8_t reg_data[BMI3_NUM_BYTES_I3C_SYNC_ACC] = { 0 };
+    /* Variable to store sum of the residuals against the line through the newest sample */
+    int64_t residual = 0;
 
-    /* Array to set the base address of i3c sync accel data */
-    uint8_t base_addr[2] = { BMI3_BASE_ADDR_I3C_SYNC_ACC, 0 };
+    /* Variables to store span of the window */
+    uint64_t span;
+    uint64_t span_ns;
 
-    if (data != NULL)
-    {
-        /* Set the i3c sync accelerometer base address to feature engine transmission address to start DMA transaction
-         * */
-        rslt = bmi3_set_regs(BMI3_REG_FEATURE_DATA_ADDR, base_addr, 2, dev);
+    /* Pointers to the newest, oldest and current sample */
+    const struct bmi3_clock_sync_sample *newest =
+        &cs->sample[(cs->head + BMI3_CLOCK_SYNC_SAMPLES - 1) % BMI3_CLOCK_SYNC_SAMPLES];
+    const struct bmi3_clock_sync_sample *oldest =
+        &cs->sample[(cs->head + BMI3_CLOCK_SYNC_SAMPLES - cs->count) % BMI3_CLOCK_SYNC_SAMPLES];
+    const struct bmi3_clock_sync_sample *sample;
 
-        if (rslt == BMI3_OK)
-        {
-            /* Get the configuration from the feature engine register where i3c sync accel data resides */
-            rslt = bmi3_get_regs(BMI3_REG_FEATURE_DATA_TX, reg_data, BMI3_NUM_BYTES_I3C_SYNC_ACC, dev);
+    span = newest->ticks - oldest->ticks;
+    span_ns = newest->host_ns - oldest->host_ns;
 
-            data->sync_x = (reg_data[0] | (uint16_t)reg_data[1] << 8);
-            data->sync_y = (reg_data[2] | (uint16_t)reg_data[3] << 8);
-            data->sync_z = (reg_data[4] | (uint16_t)reg_data[5] << 8);
-            data->sync_time = (reg_data[14] | (uint16_t)reg_data[15] << 8);
-        }
+    /* Drift over the longest baseline, too short a window keeps the previous rate */
+    if ((span >= BMI3_CLOCK_SYNC_MIN_SPAN) && (span_ns < BMI3_CLOCK_SYNC_MAX_SPAN_NS))
+    {
+        cs->rate = (int64_t)((span_ns << BMI3_CLOCK_SYNC_RATE_FRAC) / span);
     }
-    else
+
+    /* Offset averaged over the window */
+    for (index = 0; index < cs->count; index++)
     {
-        rslt = BMI3_E_NULL_PTR;
+        sample = &cs->sample[(cs->head + BMI3_CLOCK_SYNC_SAMPLES - 1 - index) % BMI3_CLOCK_SYNC_SAMPLES];
+        residual += ((int64_t)sample->host_ns - (int64_t)newest->host_ns) -
+                    clock_sync_scale((int64_t)sample->ticks - (int64_t)newest->ticks, cs->rate);
     }
 
-    return rslt;
+    cs->ref_ticks = newest->ticks;
+    cs->ref_host_ns = (uint64_t)((int64_t)newest->host_ns + (residual / cs->count));
 }
 
 /*!
- * @brief This internal API gets the i3c sync gyroscope data from the register.
+ * @brief This internal API prepares the next procedure of the plan of a unit.
  */
-static int8_t get_i3c_sync_gyro_sensor_data(struct bmi3_i3c_sync_data *data, struct bmi3_dev *dev)
+static int8_t calib_unit_prep(const struct bmi3_calib_line *line, struct bmi3_calib_unit *unit)
 {
     /* Variable to store result of API */
     int8_t rslt;
 
-    /* Array to define data stored in register */
-    uint8_t reg_data[BMI3_NUM_BYTES_I3C_SYNC_GYR] = { 0 };
+    switch (line->plan[unit->next])
+    {
+        case BMI3_OP_SOFT_RESET:
+            rslt = bmi3_op_soft_reset(&unit->op);
+            break;
 
-    /* Array to set the base address of i3c sync gyro data */
-    uint8_t base_addr[2] = { BMI3_BASE_ADDR_I3C_SYNC_GYR, 0 };
+        case BMI3_OP_SELF_TEST:
+            rslt = bmi3_op_self_test(line->st_selection, &unit->st_result, &unit->op);
+            break;
 
-    if (data != NULL)
-    {
-        /* Set the i3c sync gyroscope base address to feature engine transmission address to start DMA transaction */
-        rslt = bmi3_set_regs(BMI3_REG_FEATURE_DATA_ADDR, base_addr, 2, dev);
+        case BMI3_OP_GYRO_SC:
+            rslt = bmi3_op_gyro_sc(line->sc_selection, line->apply_corr, &unit->sc_rslt, &unit->op);
+            break;
 
-        if (rslt == BMI3_OK)
-        {
-            /* Get the configuration from the feature engine register where i3c sync gyro data resides */
-            rslt = bmi3_get_regs(BMI3_REG_FEATURE_DATA_TX, reg_data, BMI3_NUM_BYTES_I3C_SYNC_GYR, dev);
+        case BMI3_OP_ACCEL_FOC:
+            rslt = bmi3_op_accel_foc(line->accel_g_value, &unit->op);
+            break;
 
-            if (rslt == BMI3_OK)
-            {
-                data->sync_x = (reg_data[0] | (uint16_t)reg_data[1] << 8);
-                data->sync_y = (reg_data[2] | (uint16_t)reg_data[3] << 8);
-                data->sync_z = (reg_data[4] | (uint16_t)reg_data[5] << 8);
-                data->sync_time = (reg_data[8] | (uint16_t)reg_data[9] << 8);
-            }
-        }
-    }
-    else
-    {
-        rslt = BMI3_E_NULL_PTR;
+        default:
+            rslt = BMI3_E_INVALID_INPUT;
+            break;
     }
 
+    unit->next++;
+
     return rslt;
 }
 
 /*!
- * @brief This internal API gets the i3c sync temperature data from the register.
+ * @brief This internal API runs the next step of a unit.
  */
-static int8_t get_i3c_sync_temp_data(struct bmi3_i3c_sync_data *data, struct bmi3_dev *dev)
+static void calib_unit_step(const struct bmi3_calib_line *line, struct bmi3_calib_unit *unit)
 {
     /* Variable to store result of API */
-    int8_t rslt;
-
-    /* Array to define data stored in register */
-    uint8_t reg_data[BMI3_NUM_BYTES_I3C_SYNC_TEMP] = { 0 };
+    int8_t rslt = BMI3_OK;
 
-    /* Array to set the base address of i3c sync temperature data */
-    uint8_t base_addr[2] = { BMI3_BASE_ADDR_I3C_SYNC_TEMP, 0 };
+    /* Procedure to be reported on failure */
+    uint8_t op_kind = BMI3_OP_NONE;
 
-    if (data != NULL)
+    if (unit->op.kind == BMI3_OP_NONE)
     {
-        /* Set the i3c sync temperature base address to feature engine transmission address to start DMA transaction */
-        rslt = bmi3_set_regs(BMI3_REG_FEATURE_DATA_ADDR, base_addr, 2, dev);
-
-        if (rslt == BMI3_OK)
+        if (unit->next < line->n_plan)
         {
-            /* Get the configuration from the feature engine register where i3c sync temperature data resides */
-            rslt = bmi3_get_regs(BMI3_REG_FEATURE_DATA_TX, reg_data, BMI3_NUM_BYTES_I3C_SYNC_TEMP, dev);
-
-            if (rslt == BMI3_OK)
-            {
-                data->sync_temp = (reg_data[0] | (uint16_t)reg_data[1] << 8);
-                data->sync_time = (reg_data[2] | (uint16_t)reg_data[3] << 8);
-            }
+            op_kind = line->plan[unit->next];
+            rslt = calib_unit_prep(line, unit);
+        }
+        else
+        {
+            /* Plan is complete, calibration state is collected */
+            rslt = bmi3_get_calib_blob(&unit->blob, unit->dev);
+            unit->done = BMI3_ENABLE;
         }
     }
     else
     {
-        rslt = BMI3_E_NULL_PTR;
+        op_kind = line->plan[unit->next - 1];
     }
 
-    return rslt;
+    if ((rslt == BMI3_OK) && (unit->done == BMI3_DISABLE))
+    {
+        rslt = bmi3_op_step(&unit->op, unit->dev);
+
+        /* Next procedure is started right away once an operation is complete */
+        unit->wait_us = (rslt == BMI3_W_OP_PENDING) ? unit->op.wait_us : 0;
+    }
+
+    if (rslt < BMI3_OK)
+    {
+        unit->op.kind = BMI3_OP_NONE;
+        unit->rslt = rslt;
+        unit->failed_op = op_kind;
+        unit->done = BMI3_ENABLE;
+    }
 }
 
 /*!
- * @brief This internal API sets alternate accelerometer configurations like ODR,
- * accel mode and average number of samples.
+ * @brief This internal API gets the feature engine words holding the
+ * configuration of a feature.
  */
-static int8_t set_alternate_accel_config(const struct bmi3_alt_accel_config *config, struct bmi3_dev *dev)
+static int8_t get_feature_span(uint8_t type, uint8_t *base_addr, uint8_t *n_words)
 {
     /* Variable to store result of API */
-    int8_t rslt;
-
-    /* Variable to store data */
-    uint8_t reg_data[2] = { 0 };
+    int8_t rslt = BMI3_OK;
 
-    uint16_t alt_acc_odr, alt_acc_avg_num, alt_acc_mode;
+    const struct bmi3_feature_codec *codec = get_feature_codec(type);
 
-    if (config != NULL)
+    if (codec != NULL)
     {
-        /* Set alternate accelerometer ODR */
-        alt_acc_odr = BMI3_SET_BIT_POS0(reg_data[0], BMI3_ALT_ACC_ODR, config->alt_acc_odr);
-
-        /* Set alternate accelerometer average number of samples */
-        alt_acc_avg_num = BMI3_SET_BITS(reg_data[1], BMI3_ALT_ACC_AVG_NUM, config->alt_acc_avg_num);
-
-        /* Set alternate accelerometer mode */
-        alt_acc_mode = BMI3_SET_BITS(reg_data[1], BMI3_ALT_ACC_MODE, config->alt_acc_mode);
-
-        reg_data[0] = (uint8_t)(alt_acc_odr);
-        reg_data[1] = (uint8_t)((alt_acc_avg_num | alt_acc_mode) >> 8);
-
-        /* Set configurations of alternate accel */
-        rslt = bmi3_set_regs(BMI3_REG_ALT_ACC_CONF, reg_data, 2, dev);
+        *base_addr = codec->base_addr;
+        *n_words = codec->n_words;
     }
     else
     {
-        rslt = BMI3_E_NULL_PTR;
+        rslt = BMI3_E_INVALID_SENSOR;
     }
 
     return rslt;
 }
 
 /*!
- * @brief This internal API gets alternate accelerometer configurations like ODR,
- * accel mode and average number of samples.
+ * @brief This internal API decodes the configuration of a feature from the
+ * words of a feature engine image.
  */
-static int8_t get_alternate_accel_config(struct bmi3_alt_accel_config *config, struct bmi3_dev *dev)
+static int8_t unpack_feature_config(const struct bmi3_feature_batch *image, struct bmi3_sens_config *sens_cfg)
 {
     /* Variable to store result of API */
-    int8_t rslt;
+    int8_t rslt = BMI3_OK;
 
-    /* Array to store data */
-    uint8_t data_array[2] = { 0 };
+    /* Words of the feature */
+    uint64_t mask;
 
-    uint16_t reg_data;
+    const struct bmi3_feature_codec *codec = get_feature_codec(sens_cfg->type);
 
-    if (config != NULL)
+    if (codec == NULL)
     {
-        /* Read the sensor configuration details */
-        rslt = bmi3_get_regs(BMI3_REG_ALT_ACC_CONF, data_array, 2, dev);
+        rslt = BMI3_E_INVALID_SENSOR;
+    }
+    else
+    {
+        mask = ((UINT64_C(1) << codec->n_words) - 1) << codec->base_addr;
 
-        if (rslt == BMI3_OK)
+        if ((image->dirty & mask) != mask)
         {
-            reg_data = data_array[0];
-
-            /* Get alternate accelerometer ODR */
-            config->alt_acc_odr = BMI3_GET_BIT_POS0(reg_data, BMI3_ALT_ACC_ODR);
-
-            reg_data = ((uint16_t)data_array[1] << 8);
-
-            /* Get alternate accelerometer average samples */
-            config->alt_acc_avg_num = BMI3_GET_BITS(reg_data, BMI3_ALT_ACC_AVG_NUM);
-
-            /* Get alternate accel mode */
-            config->alt_acc_mode = BMI3_GET_BITS(reg_data, BMI3_ALT_ACC_MODE);
+            rslt = BMI3_E_INVALID_INPUT;
         }
     }
-    else
+
+    if (rslt == BMI3_OK)
     {
-        rslt = BMI3_E_NULL_PTR;
+        unpack_feature_fields(&image->data[codec->base_addr * 2], codec, &sens_cfg->cfg);
     }
 
     return rslt;
 }
 
 /*!
- * @brief This internal API sets alternate gyro configurations like ODR,
- * gyro mode and average number of samples.
+ * @brief This internal API reads the feature engine words of the features in
+ * the list at once.
  */
-static int8_t set_alternate_gyro_config(const struct bmi3_alt_gyro_config *config, struct bmi3_dev *dev)
+static int8_t get_feature_config_words(const struct bmi3_sens_config *sens_cfg,
+                                       uint8_t n_sens,
+                                       struct bmi3_feature_batch *image,
+                                       struct bmi3_dev *dev)
 {
     /* Variable to store result of API */
-    int8_t rslt;
-
-    /* Variable to store data */
-    uint8_t reg_data[2] = { 0 };
-
-    uint16_t alt_gyro_odr, alt_gyro_avg_num, alt_gyro_mode;
+    int8_t rslt = BMI3_OK;
 
-    if (config != NULL)
-    {
-        /* Set alternate gyro ODR */
-        alt_gyro_odr = BMI3_SET_BIT_POS0(reg_data[0], BMI3_ALT_GYR_ODR, config->alt_gyro_odr);
+    /* Variable to define loop */
+    uint8_t loop;
 
-        /* Set alternate gyro average number of samples */
-        alt_gyro_avg_num = BMI3_SET_BITS(reg_data[1], BMI3_ALT_GYR_AVG_NUM, config->alt_gyro_avg_num);
+    /* Number of features in the list */
+    uint8_t n_feat = 0;
 
-        /* Set alternate gyro mode */
-        alt_gyro_mode = BMI3_SET_BITS(reg_data[1], BMI3_ALT_GYR_MODE, config->alt_gyro_mode);
+    /* Words of a feature and span of all features */
+    uint8_t base_addr = 0;
+    uint8_t n_words = 0;
+    uint8_t first = BMI3_FEATURE_BATCH_MAX_WORDS;
+    uint8_t end = 0;
 
-        reg_data[0] = (uint8_t)(alt_gyro_odr);
-        reg_data[1] = (uint8_t)((alt_gyro_avg_num | alt_gyro_mode) >> 8);
+    image->dirty = 0;
 
-        /* Set configurations of alternate gyro */
-        rslt = bmi3_set_regs(BMI3_REG_ALT_GYR_CONF, reg_data, 2, dev);
+    for (loop = 0; loop < n_sens; loop++)
+    {
+        if (get_feature_span(sens_cfg[loop].type, &base_addr, &n_words) == BMI3_OK)
+        {
+            n_feat++;
+            first = (base_addr < first) ? base_addr : first;
+            end = ((base_addr + n_words) > end) ? (uint8_t)(base_addr + n_words) : end;
+        }
     }
-    else
+
+    /* A single feature is read as before, several are read with one transfer of the words in between */
+    if (n_feat > 1)
     {
-        rslt = BMI3_E_NULL_PTR;
+        rslt = get_feature_words(first, &image->data[first * 2], (uint16_t)((end - first) * 2), dev);
+
+        if (rslt == BMI3_OK)
+        {
+            image->dirty = ((UINT64_C(1) << (end - first)) - 1) << first;
+        }
     }
 
     return rslt;
 }
 
 /*!
- * @brief This internal API gets alternate gyro configurations like ODR,
- * gyro mode and average number of samples.
+ * @brief This internal API drops the words of a feature batch which are
+ * unchanged against the words on the sensor.
  */
-static int8_t get_alternate_gyro_config(struct bmi3_alt_gyro_config *config, struct bmi3_dev *dev)
+static void skip_unchanged_words(const struct bmi3_feature_batch *written, struct bmi3_feature_batch *batch)
 {
-    /* Variable to store result of API */
-    int8_t rslt;
+    /* Variable to define loop */
+    uint8_t index;
 
-    /* Array to store data */
-    uint8_t data_array[2] = { 0 };
+    /* Variable to define number of unchanged words after the last changed word, if any */
+    uint8_t gap = 0;
 
-    uint16_t reg_data;
+    /* Variable to store whether a run of changed words is open */
+    uint8_t in_run = BMI3_DISABLE;
 
-    if (config != NULL)
-    {
-        /* Read the sensor configuration details */
-        rslt = bmi3_get_regs(BMI3_REG_ALT_GYR_CONF, data_array, 2, dev);
+    /* Variable to store mask of the unchanged words after the last changed word */
+    uint64_t gap_mask = 0;
 
-        if (rslt == BMI3_OK)
+    for (index = 0; index < BMI3_FEATURE_BATCH_MAX_WORDS; index++)
+    {
+        if ((written != NULL) && (written->dirty & ((uint64_t)1 << index)) &&
+            (written->data[index * 2] == batch->data[index * 2]) &&
+            (written->data[(index * 2) + 1] == batch->data[(index * 2) + 1]))
         {
-            reg_data = data_array[0];
-
-            /* Get alternate gyro ODR */
-            config->alt_gyro_odr = BMI3_GET_BIT_POS0(reg_data, BMI3_ALT_GYR_ODR);
+            batch->dirty &= ~((uint64_t)1 << index);
 
-            reg_data = ((uint16_t)data_array[1] << 8);
-
-            /* Get alternate gyro average samples */
-            config->alt_gyro_avg_num = BMI3_GET_BITS(reg_data, BMI3_ALT_GYR_AVG_NUM);
+            if (in_run == BMI3_ENABLE)
+            {
+                gap_mask |= ((uint64_t)1 << index);
+                gap++;
+            }
+        }
+        else if (batch->dirty & ((uint64_t)1 << index))
+        {
+            /* Short runs of unchanged words between changed words are rewritten */
+            if (gap <= BMI3_FEATURE_IMAGE_MAX_GAP)
+            {
+                batch->dirty |= gap_mask;
+            }
 
-            /* Get alternate gyro mode */
-            config->alt_gyro_mode = BMI3_GET_BITS(reg_data, BMI3_ALT_GYR_MODE);
+            in_run = BMI3_ENABLE;
+            gap = 0;
+            gap_mask = 0;
+        }
+        else
+        {
+            /* Words outside of the batch end the run */
+            in_run = BMI3_DISABLE;
+            gap = 0;
+            gap_mask = 0;
         }
     }
-    else
-    {
-        rslt = BMI3_E_NULL_PTR;
-    }
-
-    return rslt;
 }
 
 /*!
- * @brief This internal API sets alternate auto configurations for feature interrupts.
+ * @brief This internal API encodes the configuration of a feature into a
+ * feature batch.
  */
-static int8_t set_alternate_auto_config(const struct bmi3_auto_config_change *config, struct bmi3_dev *dev)
+static int8_t pack_feature_config(const struct bmi3_sens_config *sens_cfg,
+                                  struct bmi3_feature_batch *batch,
+                                  struct bmi3_dev *dev)
 {
     /* Variable to store result of API */
     int8_t rslt;
 
-    /* Array to define the alternate auto configuration */
-    uint8_t alt_auto_config[2] = { 0 };
-
-    /* Array to set the base address of alternate auto config */
-    uint8_t base_addr[2] = { BMI3_BASE_ADDR_ALT_AUTO_CONFIG, 0 };
+    /* Array to define the feature configuration */
+    uint8_t data[BMI3_FEATURE_CODEC_MAX_WORDS * 2];
 
-    uint8_t alt_switch, user_switch;
+    const struct bmi3_feature_codec *codec = get_feature_codec(sens_cfg->type);
 
-    if (config != NULL)
+    if (codec != NULL)
     {
-        /* Set the alternate auto config base address to feature engine transmission address to start DMA transaction */
-        rslt = bmi3_set_regs(BMI3_REG_FEATURE_DATA_ADDR, base_addr, 2, dev);
+        rslt = check_feature_accel_config(codec, dev);
 
         if (rslt == BMI3_OK)
         {
-            /* Set alternate switch config */
-            alt_switch = BMI3_SET_BIT_POS0(alt_auto_config[0],
-                                           BMI3_ALT_CONF_ALT_SWITCH,
-                                           config->alt_conf_alt_switch_src_select);
-
-            /* Set alternate user config */
-            user_switch = BMI3_SET_BITS(alt_auto_config[0],
-                                        BMI3_ALT_CONF_USER_SWITCH,
-                                        config->alt_conf_user_switch_src_select);
-
-            alt_auto_config[0] = alt_switch | user_switch;
+            pack_feature_fields(&sens_cfg->cfg, codec, data);
 
-            /* Set the configuration back to the feature engine register */
-            rslt = bmi3_set_regs(BMI3_REG_FEATURE_DATA_TX, alt_auto_config, 2, dev);
+            /* Stage the configuration to be written to the feature engine register */
+            rslt = stage_feature_data(codec->base_addr, data, (uint8_t)(codec->n_words * 2), batch);
         }
     }
     else
     {
-        rslt = BMI3_E_NULL_PTR;
+        rslt = BMI3_E_INVALID_SENSOR;
     }
 
     return rslt;
 }
 
 /*!
- * @brief This internal API gets alternate auto configurations for feature interrupts.
+ * @brief This internal API reads an accel, gyro or alternate configuration.
  */
-static int8_t get_alternate_auto_config(struct bmi3_auto_config_change *config, struct bmi3_dev *dev)
+static int8_t get_reg_config(struct bmi3_sens_config *sens_cfg, struct bmi3_dev *dev)
 {
     /* Variable to store result of API */
     int8_t rslt;
 
-    /* Array to define the alternate auto configuration */
-    uint8_t alt_auto_config[2] = { 0 };
-
-    /* Array to set the base address of alternate auto config */
-    uint8_t base_addr[2] = { BMI3_BASE_ADDR_ALT_AUTO_CONFIG, 0 };
-
-    if (config != NULL)
+    switch (sens_cfg->type)
     {
-        /* Set the alternate auto config base address to feature engine transmission address to start DMA transaction */
-        rslt = bmi3_set_regs(BMI3_REG_FEATURE_DATA_ADDR, base_addr, 2, dev);
+        case BMI3_ACCEL:
+            rslt = get_accel_config(&sens_cfg->cfg.acc, dev);
+            break;
 
-        if (rslt == BMI3_OK)
-        {
-            /* Get the configuration from the feature engine register where alternate config feature resides */
-            rslt = bmi3_get_regs(BMI3_REG_FEATURE_DATA_TX, alt_auto_config, 2, dev);
+        case BMI3_GYRO:
+            rslt = get_gyro_config(&sens_cfg->cfg.gyr, dev);
+            break;
 
-            if (rslt == BMI3_OK)
-            {
-                /* Get alternate switch config */
-                config->alt_conf_alt_switch_src_select = alt_auto_config[0] & BMI3_ALT_CONF_ALT_SWITCH_MASK;
+        case BMI3_ALT_ACCEL:
+            rslt = get_alternate_accel_config(&sens_cfg->cfg.alt_acc, dev);
+            break;
 
-                /* Get alternate user config */
-                config->alt_conf_user_switch_src_select = (alt_auto_config[0] & BMI3_ALT_CONF_USER_SWITCH_MASK) >>
-                                                          BMI3_ALT_CONF_USER_SWITCH_POS;
-            }
-        }
-    }
-    else
-    {
-        rslt = BMI3_E_NULL_PTR;
+        case BMI3_ALT_GYRO:
+            rslt = get_alternate_gyro_config(&sens_cfg->cfg.alt_gyr, dev);
+            break;
+
+        default:
+            rslt = BMI3_E_INVALID_SENSOR;
+            break;
     }
 
     return rslt;
 }
 
 /*!
- * @brief This internal API is used to monitor the accel power mode during the axis remap.
+ * @brief This internal API writes an accel, gyro or alternate configuration.
  */
-static int8_t axes_remap_acc_power_mode_status(struct bmi3_sens_config config, struct bmi3_dev *dev)
+static int8_t set_reg_config(struct bmi3_sens_config *sens_cfg, struct bmi3_dev *dev)
 {
     /* Variable to store result of API */
     int8_t rslt;
 
-    uint16_t int_status;
+    switch (sens_cfg->type)
+    {
+        case BMI3_ACCEL:
+            rslt = set_accel_config(&sens_cfg->cfg.acc, dev);
 
-    /* Variable to define feature engine errors */
-    uint8_t feature_engine_err_reg_lsb, feature_engine_err_reg_msb;
+            if (rslt == BMI3_OK)
+            {
+                set_unit_scale(BMI3_ACCEL, sens_cfg->cfg.acc.range, dev);
+            }
 
-    /* Variable to store the accel power mode during axis remap */
-    uint8_t acc_power_mode_status;
+            break;
 
-    /* Variable to loop */
-    uint8_t index;
+        case BMI3_GYRO:
+            rslt = set_gyro_config(&sens_cfg->cfg.gyr, dev);
 
-    /* Variable to store time out value */
-    uint8_t time_out = 20;
+            if (rslt == BMI3_OK)
+            {
+                set_unit_scale(BMI3_GYRO, sens_cfg->cfg.gyr.range, dev);
+            }
 
-    /* Delay to read feature engine error status */
-    uint16_t axis_remap_delay = 5000;
+            break;
 
-    config.type = BMI3_ACCEL;
+        case BMI3_ALT_ACCEL:
+            rslt = set_alternate_accel_config(&sens_cfg->cfg.alt_acc, dev);
+            break;
+
+        case BMI3_ALT_GYRO:
+            rslt = set_alternate_gyro_config(&sens_cfg->cfg.alt_gyr, dev);
+            break;
+
+        default:
+            rslt = BMI3_E_INVALID_SENSOR;
+            break;
+    }
+
+    return rslt;
+}
 
-    rslt = bmi3_get_sensor_config(&config, 1, dev);
+/*!
+ * @brief This internal API compares two accel, gyro or alternate configurations.
+ */
+static uint8_t is_same_reg_config(const struct bmi3_sens_config *cfg1, const struct bmi3_sens_config *cfg2)
+{
+    /* Variable to store result of comparison */
+    uint8_t same = BMI3_DISABLE;
 
-    if ((rslt == BMI3_OK) && (config.cfg.acc.acc_mode != BMI3_ACC_MODE_DISABLE))
+    switch (cfg1->type)
     {
-        acc_power_mode_status = config.cfg.acc.acc_mode;
-
-        config.cfg.acc.acc_mode = BMI3_ACC_MODE_DISABLE;
-
-        rslt = bmi3_set_sensor_config(&config, 1, dev);
+        case BMI3_ACCEL:
+            if ((cfg1->cfg.acc.odr == cfg2->cfg.acc.odr) && (cfg1->cfg.acc.bwp == cfg2->cfg.acc.bwp) &&
+                (cfg1->cfg.acc.acc_mode == cfg2->cfg.acc.acc_mode) && (cfg1->cfg.acc.range == cfg2->cfg.acc.range) &&
+                (cfg1->cfg.acc.avg_num == cfg2->cfg.acc.avg_num))
+            {
+                same = BMI3_ENABLE;
+            }
 
-        if (rslt == BMI3_OK)
-        {
-            /* Axis mapping gets updated */
-            rslt = bmi3_set_command_register(BMI3_CMD_AXIS_MAP_UPDATE, dev);
+            break;
 
-            for (index = 0; index < time_out; index++)
+        case BMI3_GYRO:
+            if ((cfg1->cfg.gyr.odr == cfg2->cfg.gyr.odr) && (cfg1->cfg.gyr.bwp == cfg2->cfg.gyr.bwp) &&
+                (cfg1->cfg.gyr.gyr_mode == cfg2->cfg.gyr.gyr_mode) && (cfg1->cfg.gyr.range == cfg2->cfg.gyr.range) &&
+                (cfg1->cfg.gyr.avg_num == cfg2->cfg.gyr.avg_num))
             {
-                dev->delay_us(axis_remap_delay, dev->intf_ptr);
+                same = BMI3_ENABLE;
+            }
 
-                rslt = bmi3_get_feature_engine_error_status(&feature_engine_err_reg_lsb,
-                                                            &feature_engine_err_reg_msb,
-                                                            dev);
+            break;
 
-                if ((feature_engine_err_reg_lsb & BMI3_NO_ERROR_MASK) &&
-                    (feature_engine_err_reg_msb & (BMI3_AXIS_MAP_COMPLETE_MASK >> 8)))
-                {
-                    break;
-                }
+        case BMI3_ALT_ACCEL:
+            if ((cfg1->cfg.alt_acc.alt_acc_odr == cfg2->cfg.alt_acc.alt_acc_odr) &&
+                (cfg1->cfg.alt_acc.alt_acc_mode == cfg2->cfg.alt_acc.alt_acc_mode) &&
+                (cfg1->cfg.alt_acc.alt_acc_avg_num == cfg2->cfg.alt_acc.alt_acc_avg_num))
+            {
+                same = BMI3_ENABLE;
             }
 
-            config.cfg.acc.acc_mode = acc_power_mode_status;
+            break;
 
-            if (rslt == BMI3_OK)
+        case BMI3_ALT_GYRO:
+            if ((cfg1->cfg.alt_gyr.alt_gyro_odr == cfg2->cfg.alt_gyr.alt_gyro_odr) &&
+                (cfg1->cfg.alt_gyr.alt_gyro_mode == cfg2->cfg.alt_gyr.alt_gyro_mode) &&
+                (cfg1->cfg.alt_gyr.alt_gyro_avg_num == cfg2->cfg.alt_gyr.alt_gyro_avg_num))
             {
-                /* Clearing status registers by reading it, before powering up accelerometer */
-                rslt = bmi3_get_int1_status(&int_status, dev);
-
-                if (rslt == BMI3_OK)
-                {
-                    rslt = bmi3_set_sensor_config(&config, 1, dev);
-                }
+                same = BMI3_ENABLE;
             }
-        }
+
+            break;
+
+        default:
+            break;
     }
-    else if (rslt == BMI3_OK)
+
+    return same;
+}
+
+/*!
+ * @brief This internal API gets the order in which an accel, gyro or
+ * alternate configuration is written.
+ */
+static uint8_t get_reg_config_order(uint8_t type)
+{
+    /* Variable to store the order */
+    uint8_t order;
+
+    switch (type)
     {
-        /* Axis mapping gets updated */
-        rslt = bmi3_set_command_register(BMI3_CMD_AXIS_MAP_UPDATE, dev);
+        case BMI3_ALT_ACCEL:
+        case BMI3_ALT_GYRO:
+            order = 0;
+            break;
+
+        case BMI3_ACCEL:
+        case BMI3_GYRO:
+            order = 1;
+            break;
+
+        default:
+            order = 2;
+            break;
     }
 
-    return rslt;
+    return order;
 }
 
 /*!
- * @brief This internal API verifies and allows only the correct position to do Fast Offset Compensation for
- * accelerometer.
+ * @brief This internal API gets the magnitude of a sample in LSB.
  */
-static int8_t verify_foc_position(uint8_t sens_list,
-                                  const struct bmi3_accel_foc_g_value *accel_g_axis,
-                                  struct bmi3_dev *dev)
+static uint16_t auto_range_abs(int16_t data)
 {
-    /* Variable to store result of API */
-    int8_t rslt;
+    return (data < 0) ? (uint16_t)(-(int32_t)data) : (uint16_t)data;
+}
 
-    /* Structure to define accelerometer sensor axes */
-    struct bmi3_sens_axes_data avg_foc_data = { 0 };
+/*!
+ * @brief This internal API counts a sample to the statistics of the auto-range
+ * governor and decides on a range switch.
+ */
+static void auto_range_sample(int16_t x, int16_t y, int16_t z, uint8_t sat, struct bmi3_auto_range *ar)
+{
+    /* Largest magnitude of the axes */
+    uint16_t peak = auto_range_abs(x);
 
-    /* Structure to store temporary accelerometer values */
-    struct bmi3_foc_temp_value temp_foc_data = { 0 };
+    peak = (auto_range_abs(y) > peak) ? auto_range_abs(y) : peak;
+    peak = (auto_range_abs(z) > peak) ? auto_range_abs(z) : peak;
 
-    rslt = get_average_of_sensor_data(sens_list, &temp_foc_data, dev);
+    if (peak >= BMI3_AUTO_RANGE_SAT_LSB)
+    {
+        sat = BMI3_ENABLE;
+    }
 
-    if (rslt == BMI3_OK)
+    if (sat != 0)
+    {
+        ar->n_sat++;
+    }
+
+    ar->peak = (peak > ar->peak) ? peak : ar->peak;
+
+    /* Samples are not counted once a switch is due */
+    if (ar->next_range == ar->range)
     {
-        if (sens_list == BMI3_ACCEL)
+        if ((sat != 0) || (peak >= ar->target.up_thres))
         {
-            /* Taking modulus to make negative values as positive */
-            if ((accel_g_axis->x == 1) && (accel_g_axis->sign == 1))
+            ar->quiet = 0;
+
+            if (ar->range < ar->target.max_range)
             {
-                temp_foc_data.x = temp_foc_data.x * BMI3_FOC_INVERT_VALUE;
+                ar->next_range = (uint8_t)(ar->range + 1);
             }
-            else if ((accel_g_axis->y == 1) && (accel_g_axis->sign == 1))
+        }
+        else if (peak < ar->target.down_thres)
+        {
+            if (ar->quiet < ar->target.hold_samples)
             {
-                temp_foc_data.y = temp_foc_data.y * BMI3_FOC_INVERT_VALUE;
+                ar->quiet++;
             }
-            else if ((accel_g_axis->z == 1) && (accel_g_axis->sign == 1))
+
+            if ((ar->quiet >= ar->target.hold_samples) && (ar->range > ar->target.min_range))
             {
-                temp_foc_data.z = temp_foc_data.z * BMI3_FOC_INVERT_VALUE;
+                ar->next_range = (uint8_t)(ar->range - 1);
             }
         }
-
-        avg_foc_data.x = (int16_t)(temp_foc_data.x);
-        avg_foc_data.y = (int16_t)(temp_foc_data.y);
-        avg_foc_data.z = (int16_t)(temp_foc_data.z);
-
-        rslt = validate_foc_position(sens_list, accel_g_axis, avg_foc_data, dev);
+        else
+        {
+            ar->quiet = 0;
+        }
     }
-
-    return rslt;
 }
 
 /*!
- * @brief This internal API reads and provides average for 128 samples of sensor data for accel FOC.
+ * @brief This internal API interpolates offset and gain of the thermal
+ * compensation table at a temperature into the axes correction.
  */
-static int8_t get_average_of_sensor_data(uint8_t sens_list,
-                                         struct bmi3_foc_temp_value *temp_foc_data,
-                                         struct bmi3_dev *dev)
+static void interpolate_thermal_comp(int16_t temp, struct bmi3_thermal_comp *comp)
 {
-    /* Variable to store result of API */
-    int8_t rslt;
-
-    /* Structure to store sensor data */
-    struct bmi3_sensor_data sensor_data = { 0 };
+    /* Variable to define loop */
+    uint8_t axis;
 
-    uint8_t sample_count = 0;
-    uint8_t datardy_try_cnt;
-    uint16_t drdy_status = 0;
+    /* Index of the point above the temperature */
+    uint8_t idx = 1;
 
-    /* Assign sensor list to type */
-    sensor_data.type = sens_list;
+    /* Points the temperature lies between */
+    const struct bmi3_thermal_point *lo;
+    const struct bmi3_thermal_point *hi;
 
-    rslt = null_ptr_check(dev);
+    int32_t span;
+    int32_t pos;
 
-    if (rslt == BMI3_OK)
+    while ((idx < (comp->n_points - 1)) && (temp > comp->points[idx].temp))
     {
-        /* Read sensor values before FOC */
-        while (sample_count < BMI3_FOC_SAMPLE_LIMIT)
-        {
-            datardy_try_cnt = 5;
-            do
-            {
-                /* 20ms delay for 50Hz ODR */
-                dev->delay_us(20000, dev->intf_ptr);
-                rslt = bmi3_get_sensor_status(&drdy_status, dev);
-                datardy_try_cnt--;
-            } while ((rslt == BMI3_OK) && (!(drdy_status)) && (datardy_try_cnt));
-
-            if ((rslt != BMI3_OK) || (datardy_try_cnt == 0))
-            {
-                rslt = BMI3_E_DATA_RDY_INT_FAILED;
-                break;
-            }
+        idx++;
+    }
 
-            rslt = bmi3_get_sensor_data(&sensor_data, 1, dev);
+    lo = &comp->points[(comp->n_points > 1) ? (idx - 1) : 0];
+    hi = &comp->points[(comp->n_points > 1) ? idx : 0];
 
-            if (rslt == BMI3_OK)
-            {
-                if (sensor_data.type == BMI3_ACCEL)
-                {
-                    temp_foc_data->x += sensor_data.sens_data.acc.x;
-                    temp_foc_data->y += sensor_data.sens_data.acc.y;
-                    temp_foc_data->z += sensor_data.sens_data.acc.z;
-                }
-                else if (sensor_data.type == BMI3_GYRO)
-                {
-                    temp_foc_data->x += sensor_data.sens_data.gyr.x;
-                    temp_foc_data->y += sensor_data.sens_data.gyr.y;
-                    temp_foc_data->z += sensor_data.sens_data.gyr.z;
-                }
-            }
-            else
-            {
-                break;
-            }
+    /* Temperatures out of the table keep the nearest point */
+    span = (int32_t)hi->temp - lo->temp;
+    pos = (int32_t)temp - lo->temp;
+    pos = (pos < 0) ? 0 : pos;
+    pos = (pos > span) ? span : pos;
 
-            sample_count++;
+    for (axis = 0; axis < 3; axis++)
+    {
+        if (span > 0)
+        {
+            comp->corr->offset[axis] =
+                (int16_t)(lo->offset[axis] + ((((int32_t)hi->offset[axis] - lo->offset[axis]) * pos) / span));
+            comp->corr->gain[axis] =
+                (uint16_t)(lo->gain[axis] + ((((int32_t)hi->gain[axis] - lo->gain[axis]) * pos) / span));
         }
-
-        if (rslt == BMI3_OK)
+        else
         {
-            temp_foc_data->x = (temp_foc_data->x / BMI3_FOC_SAMPLE_LIMIT);
-            temp_foc_data->y = (temp_foc_data->y / BMI3_FOC_SAMPLE_LIMIT);
-            temp_foc_data->z = (temp_foc_data->z / BMI3_FOC_SAMPLE_LIMIT);
+            comp->corr->offset[axis] = (temp <= lo->temp) ? lo->offset[axis] : hi->offset[axis];
+            comp->corr->gain[axis] = (temp <= lo->temp) ? lo->gain[axis] : hi->gain[axis];
         }
     }
 
-    return rslt;
+    comp->temp = temp;
+    comp->valid = BMI3_ENABLE;
 }
 
 /*!
- * @brief This internal API validates accel FOC position as per the range
+ * @brief This internal API sets the FIFO and the mapping of the data-ready and
+ * FIFO water-mark interrupts of a scheduler mode.
  */
-static int8_t validate_foc_position(uint8_t sens_list,
-                                    const struct bmi3_accel_foc_g_value *accel_g_axis,
-                                    struct bmi3_sens_axes_data avg_foc_data,
-                                    struct bmi3_dev *dev)
+static int8_t set_sched_mode(uint8_t mode, uint16_t fifo_wm, const struct bmi3_sched *sched, struct bmi3_dev *dev)
 {
     /* Variable to store result of API */
-    int8_t rslt = BMI3_E_INVALID_INPUT;
+    int8_t rslt;
 
-    if (sens_list == BMI3_ACCEL)
+    /* Array to store the interrupt map 2 register */
+    uint8_t reg_data[2] = { 0 };
+
+    /* Variable to store the interrupt map */
+    uint16_t int_map;
+
+    /* Variables to store the pins of the data interrupts */
+    uint16_t acc_pin = BMI3_INT_NONE;
+    uint16_t gyr_pin = BMI3_INT_NONE;
+    uint16_t fwm_pin = BMI3_INT_NONE;
+
+    if (mode == BMI3_SCHED_FIFO)
     {
-        if (accel_g_axis->x == 1)
+        /* Frames stored before are older than the latency allows */
+        rslt = bmi3_set_fifo_config(sched->fifo_sens, BMI3_ENABLE, dev);
+
+        if (rslt == BMI3_OK)
         {
-            rslt = validate_foc_accel_axis(avg_foc_data.x, dev);
+            rslt = flush_fifo(dev);
         }
-        else if (accel_g_axis->y == 1)
+
+        if (rslt == BMI3_OK)
         {
-            rslt = validate_foc_accel_axis(avg_foc_data.y, dev);
+            rslt = bmi3_set_fifo_wm(fifo_wm, dev);
+        }
+
+        fwm_pin = sched->int_pin;
+    }
+    else
+    {
+        rslt = bmi3_set_fifo_config(sched->fifo_sens, BMI3_DISABLE, dev);
+
+        /* Sensors run at the same ODR, one data-ready interrupt serves both */
+        if (sched->fifo_sens & BMI3_FIFO_ACC_EN)
+        {
+            acc_pin = sched->int_pin;
         }
         else
         {
-            rslt = validate_foc_accel_axis(avg_foc_data.z, dev);
+            gyr_pin = sched->int_pin;
         }
     }
 
+    /* Served without bus access if the shadow register cache is enabled */
+    if (rslt == BMI3_OK)
+    {
+        rslt = bmi3_get_regs(BMI3_REG_INT_MAP2, reg_data, 2, dev);
+    }
+
+    if (rslt == BMI3_OK)
+    {
+        int_map = (uint16_t)(reg_data[0] | ((uint16_t)reg_data[1] << 8));
+        int_map = BMI3_SET_BITS(int_map, BMI3_ACC_DRDY_INT, acc_pin);
+        int_map = BMI3_SET_BITS(int_map, BMI3_GYR_DRDY_INT, gyr_pin);
+        int_map = BMI3_SET_BITS(int_map, BMI3_FIFO_WATERMARK_INT, fwm_pin);
+
+        reg_data[0] = (uint8_t)int_map;
+        reg_data[1] = (uint8_t)(int_map >> 8);
+
+        rslt = bmi3_set_regs(BMI3_REG_INT_MAP2, reg_data, 2, dev);
+    }
+
     return rslt;
 }
 
 /*!
- * @brief This internal API validates accel FOC axis given as input
+ * @brief This internal API reads one sample of the data registers of the
+ * sensors of the scheduler into the sample queues.
  */
-static int8_t validate_foc_accel_axis(int16_t avg_foc_data, struct bmi3_dev *dev)
+static int8_t push_sched_drdy(const struct bmi3_sched *sched,
+                              struct bmi3_sample_queue *accel_queue,
+                              struct bmi3_sample_queue *gyro_queue,
+                              uint16_t *dropped,
+                              struct bmi3_dev *dev)
 {
     /* Variable to store result of API */
-    int8_t rslt;
+    int8_t rslt = BMI3_OK;
 
-    /* Structure to store sensor configurations */
-    struct bmi3_sens_config sens_cfg = { 0 };
+    /* Array to store the samples of accel and gyro */
+    struct bmi3_sensor_data sensor_data[2] = { { 0 } };
 
-    /* Variable to store accel range */
-    uint8_t range;
+    /* Array of the queues of the samples */
+    struct bmi3_sample_queue *queue[2] = { NULL, NULL };
 
-    /* Assign the accel type */
-    sens_cfg.type = BMI3_ACCEL;
+    /* Pointer to the free slots */
+    struct bmi3_fifo_sens_axes_data *slots = NULL;
 
-    /* Get accel configurations */
-    rslt = bmi3_get_sensor_config(&sens_cfg, 1, dev);
+    /* Variable to store the number of free slots */
+    uint16_t free_slots = 0;
 
-    if (rslt == BMI3_OK)
+    uint8_t n_sens = 0;
+    uint8_t idx;
+
+    if (sched->fifo_sens & BMI3_FIFO_ACC_EN)
     {
-        /* Assign accel range to variable */
-        range = sens_cfg.cfg.acc.range;
+        sensor_data[n_sens].type = BMI3_ACCEL;
+        queue[n_sens++] = accel_queue;
+    }
 
-        /* Reference LSB value of 2G */
-        if ((range == BMI3_ACC_RANGE_2G) && (avg_foc_data > BMI3_ACC_2G_MIN_NOISE_LIMIT) &&
-            (avg_foc_data < BMI3_ACC_2G_MAX_NOISE_LIMIT))
-        {
-            rslt = BMI3_OK;
-        }
-        /* Reference LSB value of 4G */
-        else if ((range == BMI3_ACC_RANGE_4G) && (avg_foc_data > BMI3_ACC_4G_MIN_NOISE_LIMIT) &&
-                 (avg_foc_data < BMI3_ACC_4G_MAX_NOISE_LIMIT))
-        {
-            rslt = BMI3_OK;
-        }
-        /* Reference LSB value of 8G */
-        else if ((range == BMI3_ACC_RANGE_8G) && (avg_foc_data > BMI3_ACC_8G_MIN_NOISE_LIMIT) &&
-                 (avg_foc_data < BMI3_ACC_8G_MAX_NOISE_LIMIT))
+    if (sched->fifo_sens & BMI3_FIFO_GYR_EN)
+    {
+        sensor_data[n_sens].type = BMI3_GYRO;
+        queue[n_sens++] = gyro_queue;
+    }
+
+    for (idx = 0; idx < n_sens; idx++)
+    {
+        if (queue[idx] == NULL)
         {
-            rslt = BMI3_OK;
+            rslt = BMI3_E_NULL_PTR;
         }
-        /* Reference LSB value of 16G */
-        else if ((range == BMI3_ACC_RANGE_16G) && (avg_foc_data > BMI3_ACC_16G_MIN_NOISE_LIMIT) &&
-                 (avg_foc_data < BMI3_ACC_16G_MAX_NOISE_LIMIT))
+    }
+
+    if (rslt == BMI3_OK)
+    {
+        rslt = bmi3_get_sensor_data(sensor_data, n_sens, dev);
+    }
+
+    for (idx = 0; (rslt == BMI3_OK) && (idx < n_sens); idx++)
+    {
+        rslt = bmi3_sample_queue_reserve(queue[idx], &slots, &free_slots);
+
+        if ((rslt == BMI3_OK) && (free_slots == 0))
         {
-            rslt = BMI3_OK;
+            (*dropped)++;
         }
-        else
+        else if (rslt == BMI3_OK)
         {
-            rslt = BMI3_E_INVALID_FOC_POSITION;
+            /* Accel and gyro data share the same structure in the union */
+            slots->x = sensor_data[idx].sens_data.acc.x;
+            slots->y = sensor_data[idx].sens_data.acc.y;
+            slots->z = sensor_data[idx].sens_data.acc.z;
+            slots->sensor_time = (uint16_t)sensor_data[idx].sens_data.acc.sens_time;
+
+            rslt = bmi3_sample_queue_produce(queue[idx], 1);
+
+            if (rslt == BMI3_OK)
+            {
+                rslt = bmi3_sample_queue_commit(queue[idx]);
+            }
         }
     }
 
+    if ((rslt == BMI3_OK) && (*dropped != 0))
+    {
+        rslt = BMI3_W_QUEUE_FULL;
+    }
+
     return rslt;
 }
 
 /*!
- * @brief This internal API performs Fast Offset Compensation for accelerometer.
+ * @brief This internal API decodes the error register.
  */
-static int8_t perform_accel_foc(const struct bmi3_accel_foc_g_value *accel_g_value,
-                                struct bmi3_accel_config *acc_cfg,
-                                struct bmi3_dev *dev)
+static void unpack_err_reg(const uint8_t *data, struct bmi3_err_reg *err_reg)
 {
-    /* Variable to store result of API */
-    int8_t rslt = BMI3_E_INVALID_STATUS;
+    uint16_t reg_data;
 
-    /* Variable to define count */
-    uint8_t loop;
+    reg_data = data[0];
 
-    /* Variable to store status read from the status register */
-    uint16_t reg_status = 0;
+    /* Fatal error */
+    err_reg->fatal_err = BMI3_GET_BIT_POS0(reg_data, BMI3_FATAL_ERR);
 
-    /* Array of structure to store accelerometer data */
-    struct bmi3_sensor_data accel_value[BMI3_FOC_SAMPLE_LIMIT] = { { 0 } };
+    /* Interrupt request overrun error */
+    err_reg->feat_eng_ovrld = BMI3_GET_BITS(reg_data, BMI3_FEAT_ENG_OVRLD);
 
-    /* Structure to store accelerometer data temporarily */
-    struct bmi3_foc_temp_value temp = { 0, 0, 0 };
+    /* Indicates watch cell code */
+    err_reg->feat_eng_wd = BMI3_GET_BITS(reg_data, BMI3_FEAT_ENG_WD);
 
-    /* Structure to store the average of accelerometer data */
-    struct bmi3_sens_axes_data accel_avg = { 0 };
+    /* Indicates accel configuration error */
+    err_reg->acc_conf_err = BMI3_GET_BITS(reg_data, BMI3_ACC_CONF_ERR);
 
-    /* Variable to define LSB per g value */
-    uint16_t lsb_per_g = 0;
+    /* Indicates gyro configuration error */
+    err_reg->gyr_conf_err = BMI3_GET_BITS(reg_data, BMI3_GYR_CONF_ERR);
 
-    /* Variable to define range */
-    uint8_t range = 0;
+    reg_data = data[1];
 
-    /* Structure to store accelerometer data deviation from ideal value */
-    struct bmi3_offset_delta delta = { 0, 0, 0 };
+    /* Indicates SDR parity error */
+    err_reg->i3c_error0 = BMI3_GET_BITS(reg_data, BMI3_I3C_ERROR0);
 
-    /* Structure to store accelerometer offset values */
-    struct bmi3_acc_dp_gain_offset offset = { 0 };
+    /* Indicates I3C error */
+    err_reg->i3c_error3 = BMI3_GET_BITS(reg_data, BMI3_I3C_ERROR3);
+}
 
-    /* Variable tries max 5 times for interrupt then generates timeout */
-    uint8_t try_cnt;
+/*!
+ * @brief This internal API gets the faults of a health snapshot.
+ */
+static uint16_t get_health_faults(const struct bmi3_health *health)
+{
+    /* Variable to store the faults */
+    uint16_t faults = 0;
 
-    uint8_t reg_data[BMI3_READ_REG_DATA_LEN] = { 0 };
+    /* Variable to store the error status of the feature engine */
+    uint8_t feat_err = (uint8_t)(health->feature_status & BMI3_ERROR_STATUS_MASK);
 
-    for (loop = 0; loop < BMI3_FOC_SAMPLE_LIMIT; loop++)
+    if (health->err_reg.fatal_err)
     {
-        try_cnt = 5;
-        reg_status = 0; /* Reset the value */
-
-        while (try_cnt && (!(reg_status & BMI3_DRDY_ACC_MASK)))
-        {
-            /* 20ms delay for 50Hz ODR */
-            dev->delay_us(20000, dev->intf_ptr);
-            rslt = bmi3_get_sensor_status(&reg_status, dev);
-            try_cnt--;
-        }
+        faults |= BMI3_HEALTH_FATAL;
+    }
 
-        if (rslt != BMI3_OK)
-        {
-            return rslt;
-        }
+    if (health->err_reg.feat_eng_ovrld || health->err_reg.feat_eng_wd)
+    {
+        faults |= BMI3_HEALTH_FEAT_ENG;
+    }
 
-        if (reg_status & BMI3_DRDY_ACC_MASK)
-        {
-            rslt = bmi3_read_reg_data(reg_data, dev);
-            if (rslt == BMI3_OK)
-            {
-                rslt = get_accel_sensortime_sat_data(&accel_value[loop].sens_data.acc, reg_data);
-            }
-        }
-        else
-        {
-            return BMI3_E_INVALID_STATUS;
-        }
+    if (health->err_reg.acc_conf_err || health->err_reg.gyr_conf_err)
+    {
+        faults |= BMI3_HEALTH_CONF;
+    }
 
-        if (rslt == BMI3_OK)
-        {
-            /* Store the data in a temporary structure */
-            temp.x = temp.x + (int32_t)accel_value[loop].sens_data.acc.x;
-            temp.y = temp.y + (int32_t)accel_value[loop].sens_data.acc.y;
-            temp.z = temp.z + (int32_t)accel_value[loop].sens_data.acc.z;
-        }
-        else
-        {
-            break;
-        }
+    if (health->err_reg.i3c_error0 || health->err_reg.i3c_error3)
+    {
+        faults |= BMI3_HEALTH_I3C;
     }
 
-    if (rslt == BMI3_OK)
+    if (health->status & BMI3_STATUS_POR)
     {
-        /* Take average of x, y and z data for lesser noise */
-        accel_avg.x = (int16_t)(temp.x / BMI3_FOC_SAMPLE_LIMIT);
-        accel_avg.y = (int16_t)(temp.y / BMI3_FOC_SAMPLE_LIMIT);
-        accel_avg.z = (int16_t)(temp.z / BMI3_FOC_SAMPLE_LIMIT);
+        faults |= BMI3_HEALTH_POR;
+    }
 
-        rslt = get_accel_config(acc_cfg, dev);
+    /* Inactive, active and no error are the states without error */
+    if ((feat_err != BMI3_FEAT_ENG_INACT_MASK) && (feat_err != BMI3_FEAT_ENG_ACT_MASK) &&
+        (feat_err != BMI3_NO_ERROR_MASK))
+    {
+        faults |= BMI3_HEALTH_FEAT_ERR;
+    }
 
-        if (rslt == BMI3_OK)
-        {
-            /* Get the exact range value */
-            map_accel_range(acc_cfg->range, &range);
+    return faults;
+}
 
-            /* Get the smallest possible measurable acceleration level given the range and
-             * resolution */
-            lsb_per_g = (uint16_t)(power(2, dev->resolution) / (2 * range));
+#ifdef BMI3_PACKED_BUF
 
-            /* Compensate acceleration data against gravity */
-            comp_for_gravity(lsb_per_g, accel_g_value, &accel_avg, &delta);
+/*!
+ * @brief This internal API sets the saturation flags of a sample in the
+ * saturation side-band of a packed buffer.
+ */
+static void set_packed_sat(uint8_t *sat, uint16_t pos, uint8_t val)
+{
+    /* Variable to store the bit position of the sample, two samples per byte */
+    uint8_t shift = (uint8_t)((pos & 1) * 4);
 
-            /* Scale according to offset register resolution */
-            scale_accel_offset(range, &delta, &offset, dev);
+    sat[pos / 2] = (uint8_t)((sat[pos / 2] & ~(0x0F << shift)) | ((val & 0x0F) << shift));
+}
 
-            /* Invert the accelerometer offset data */
-            invert_accel_offset(&offset);
+/*!
+ * @brief This internal API limits the number of samples to unpack to the
+ * samples of a packed buffer from an index on.
+ */
+static uint16_t unpacked_count(const struct bmi3_packed_buf *buf, uint16_t first, uint16_t count)
+{
+    /* Variable to store the number of samples from the index on */
+    uint16_t avail = (first < buf->count) ? (uint16_t)(buf->count - first) : 0;
 
-            /* Write offset data in the offset compensation register */
-            rslt = bmi3_set_acc_dp_off_dgain(&offset, dev);
+    return (count < avail) ? count : avail;
+}
+#endif
 
-        }
-    }
+#ifdef BMI3_FLIGHT_REC
 
-    return rslt;
+/*!
+ * @brief This internal API unpacks a sample of the ring of a flight recorder.
+ */
+static void unpack_rec_sample(const struct bmi3_packed_axes *axes, uint32_t sens_time, struct bmi3_sens_axes_data *data)
+{
+    data->x = axes->x;
+    data->y = axes->y;
+    data->z = axes->z;
+    data->sens_time = sens_time;
+    data->sat_x = 0;
+    data->sat_y = 0;
+    data->sat_z = 0;
+    data->temp_data = 0;
 }
+#endif
 
 /*!
- * @brief This internal API converts the accelerometer range value into
- * corresponding integer value.
+ * @brief This internal API packs the gyro data path offsets and gains into the
+ * register image of BMI3_REG_GYR_DP_OFF_X to BMI3_REG_GYR_DP_DGAIN_Z.
  */
-static void map_accel_range(uint8_t range_in, uint8_t *range_out)
+static void pack_gyro_dp_off_dgain(const struct bmi3_gyr_dp_gain_offset *gyr_dp_gain_offset, uint8_t *gyr_off_gain)
 {
-    switch (range_in)
-    {
-        case BMI3_ACC_RANGE_2G:
-            *range_out = 2;
-            break;
-        case BMI3_ACC_RANGE_4G:
-            *range_out = 4;
-            break;
-        case BMI3_ACC_RANGE_8G:
-            *range_out = 8;
-            break;
-        case BMI3_ACC_RANGE_16G:
-            *range_out = 16;
-            break;
-        default:
+    uint8_t gyr_dp_gain_x, gyr_dp_gain_y, gyr_dp_gain_z;
 
-            /* By default RANGE 8G is set */
-            *range_out = 8;
-            break;
-    }
+    uint16_t gyr_dp_off_x1, gyr_dp_off_y1, gyr_dp_off_z1;
+
+    uint16_t reg_data[6] = { 0 };
+
+    gyr_dp_off_x1 = BMI3_SET_BIT_POS0(reg_data[0], BMI3_GYR_DP_OFF_X, gyr_dp_gain_offset->gyr_dp_off_x);
+
+    gyr_dp_gain_x = (uint8_t)BMI3_SET_BIT_POS0(reg_data[1], BMI3_GYR_DP_DGAIN_X, gyr_dp_gain_offset->gyr_dp_dgain_x);
+
+    gyr_dp_off_y1 = BMI3_SET_BIT_POS0(reg_data[2], BMI3_GYR_DP_OFF_Y, gyr_dp_gain_offset->gyr_dp_off_y);
+
+    gyr_dp_gain_y = (uint8_t)BMI3_SET_BIT_POS0(reg_data[3], BMI3_GYR_DP_DGAIN_Y, gyr_dp_gain_offset->gyr_dp_dgain_y);
+
+    gyr_dp_off_z1 = BMI3_SET_BIT_POS0(reg_data[4], BMI3_GYR_DP_OFF_Z, gyr_dp_gain_offset->gyr_dp_off_z);
+
+    gyr_dp_gain_z = (uint8_t)BMI3_SET_BIT_POS0(reg_data[5], BMI3_GYR_DP_DGAIN_Z, gyr_dp_gain_offset->gyr_dp_dgain_z);
+
+    gyr_off_gain[0] = (uint8_t)(gyr_dp_off_x1 & BMI3_SET_LOW_BYTE);
+    gyr_off_gain[1] = (gyr_dp_off_x1 & BMI3_SET_HIGH_BYTE) >> 8;
+    gyr_off_gain[2] = gyr_dp_gain_x;
+    gyr_off_gain[3] = 0;
+    gyr_off_gain[4] = (uint8_t)(gyr_dp_off_y1 & BMI3_SET_LOW_BYTE);
+    gyr_off_gain[5] = (gyr_dp_off_y1 & BMI3_SET_HIGH_BYTE) >> 8;
+    gyr_off_gain[6] = gyr_dp_gain_y;
+    gyr_off_gain[7] = 0;
+    gyr_off_gain[8] = (uint8_t)(gyr_dp_off_z1 & BMI3_SET_LOW_BYTE);
+    gyr_off_gain[9] = (gyr_dp_off_z1 & BMI3_SET_HIGH_BYTE) >> 8;
+    gyr_off_gain[10] = gyr_dp_gain_z;
+    gyr_off_gain[11] = 0;
 }
 
 /*!
- * @brief This internal API is used to calculate the power of a value.
+ * @brief This internal API corrects a 10-bit gyro data path offset by the mean
+ * of the accumulated samples of an axis.
  */
-static int32_t power(int16_t base, uint8_t resolution)
+static uint16_t correct_gyro_dp_off(uint16_t off, int32_t sum, const struct bmi3_gyro_bias *bias)
 {
-    /* Initialize loop */
-    uint8_t loop = 1;
+    /* Variable to store the signed offset */
+    int32_t value = (off & 0x0200) ? ((int32_t)off - 0x0400) : (int32_t)off;
 
-    /* Initialize variable to store the power of 2 value */
-    int32_t value = 1;
+    /* Offset steps are of the 2000dps range, a sample of a smaller range is a fraction of a step */
+    int32_t div = (int32_t)bias->n << ((BMI3_GYR_RANGE_2000DPS - bias->range) + bias->gain_shift);
 
-    for (; loop <= resolution; loop++)
-    {
-        value = (int32_t)(value * base);
-    }
+    /* Variable to store the correction, the rounded mean of the samples */
+    int32_t corr = (sum >= 0) ? ((sum + (div / 2)) / div) : -((-sum + (div / 2)) / div);
 
-    return value;
+    value -= corr;
+    value = (value > 511) ? 511 : ((value < -512) ? -512 : value);
+
+    return (uint16_t)value & BMI3_GYR_DP_OFF_X_MASK;
 }
 
 /*!
- * @brief This internal API compensate the accelerometer data against gravity.
+ * @brief This internal API packs an axis remap into the axis remap word of
+ * the feature engine.
  */
-static void comp_for_gravity(uint16_t lsb_per_g,
-                             const struct bmi3_accel_foc_g_value *g_val,
-                             const struct bmi3_sens_axes_data *data,
-                             struct bmi3_offset_delta *comp_data)
+static void pack_remap_word(const struct bmi3_axes_remap *remapped_axis, uint8_t *remap_data)
 {
-    /* Array to store the accelerometer values in LSB */
-    int16_t accel_value_lsb[3] = { 0 };
+    /* Set the value of re-mapped axis */
+    remap_data[0] = BMI3_SET_BIT_POS0(remap_data[0], BMI3_XYZ_AXIS, remapped_axis->axis_map);
 
-    /* Convert g-value to LSB */
-    accel_value_lsb[BMI3_X_AXIS] = (int16_t)(lsb_per_g * g_val->x);
-    accel_value_lsb[BMI3_Y_AXIS] = (int16_t)(lsb_per_g * g_val->y);
-    accel_value_lsb[BMI3_Z_AXIS] = (int16_t)(lsb_per_g * g_val->z);
+    /* Set the value of re-mapped x-axis sign */
+    remap_data[0] |= BMI3_SET_BITS(remap_data[0], BMI3_X_AXIS_SIGN, remapped_axis->invert_x);
 
-    /* Get the compensated values for X, Y and Z axis */
-    comp_data->x = (data->x - accel_value_lsb[BMI3_X_AXIS]);
-    comp_data->y = (data->y - accel_value_lsb[BMI3_Y_AXIS]);
-    comp_data->z = (data->z - accel_value_lsb[BMI3_Z_AXIS]);
+    /* Set the value of re-mapped y-axis sign */
+    remap_data[0] |= BMI3_SET_BITS(remap_data[0], BMI3_Y_AXIS_SIGN, remapped_axis->invert_y);
+
+    /* Set the value of re-mapped z-axis sign */
+    remap_data[0] |= BMI3_SET_BITS(remap_data[0], BMI3_Z_AXIS_SIGN, remapped_axis->invert_z);
 }
 
 /*!
- * @brief This internal API scales the compensated accelerometer data according
- * to the offset register resolution.
- *
- * @note The bit position is always greater than 0 since accelerometer data is
- * 16 bit wide.
+ * @brief This internal API adds an interval without gap to the running
+ * average and the jitter histogram.
  */
-static void scale_accel_offset(uint8_t range,
-                               const struct bmi3_offset_delta *comp_data,
-                               struct bmi3_acc_dp_gain_offset *data,
-                               const struct bmi3_dev *dev)
+static void add_fifo_jitter_interval(uint32_t interval, struct bmi3_fifo_jitter *jitter)
 {
-    uint8_t bit_pos;
-    uint8_t scale_factor;
+    /* Variable to store the interval with fraction bits */
+    uint32_t scaled = interval << BMI3_FIFO_JITTER_FRAC;
 
-    switch (range)
+    /* Variable to store the deviation from the frame period */
+    uint32_t dev = (interval > jitter->period) ? (interval - jitter->period) : (jitter->period - interval);
+
+    /* Variable to store the histogram bin */
+    uint8_t bin = 0;
+
+    /* Unsigned steps, the average moves by 1 / 2^shift of the difference, rounded */
+    if (scaled > jitter->interval_avg)
     {
-        case BMI3_ACC_2G:
-            bit_pos = BMI3_ACC_2G_BIT_POS;
-            break;
-        case BMI3_ACC_4G:
-            bit_pos = BMI3_ACC_4G_BIT_POS;
-            break;
-        case BMI3_ACC_8G:
-            bit_pos = BMI3_ACC_8G_BIT_POS;
-            break;
-        case BMI3_ACC_16G:
-            bit_pos = BMI3_ACC_16G_BIT_POS;
-            break;
-        default:
-            bit_pos = 4;
-            break;
+        jitter->interval_avg += (scaled - jitter->interval_avg + BMI3_FIFO_JITTER_AVG_ROUND) >>
+                                BMI3_FIFO_JITTER_AVG_SHIFT;
+    }
+    else
+    {
+        jitter->interval_avg -= (jitter->interval_avg - scaled + BMI3_FIFO_JITTER_AVG_ROUND) >>
+                                BMI3_FIFO_JITTER_AVG_SHIFT;
     }
 
-    scale_factor = (uint8_t)power(2, bit_pos);
+    while ((bin < (BMI3_FIFO_JITTER_BINS - 1)) && ((dev >> bin) != 0))
+    {
+        bin++;
+    }
 
-    data->acc_dp_off_x = (uint16_t)((comp_data->x * scale_factor) & dev->accel_bit_width);
-    data->acc_dp_off_y = (uint16_t)((comp_data->y * scale_factor) & dev->accel_bit_width);
-    data->acc_dp_off_z = (uint16_t)((comp_data->z * scale_factor) & dev->accel_bit_width);
+    jitter->hist[bin]++;
+
+    if (dev > jitter->max_dev)
+    {
+        jitter->max_dev = (uint16_t)dev;
+    }
 }
 
 /*!
- * @brief This internal API inverts the accelerometer offset data.
+ * @brief This internal API adds an increment of the step counter to the
+ * step cadence.
  */
-static void invert_accel_offset(struct bmi3_acc_dp_gain_offset *offset_data)
+static void add_step_increment(uint32_t step_count, uint32_t sensor_time, struct bmi3_step_cadence *cadence)
 {
-    /* Get the offset data */
-    offset_data->acc_dp_off_x = (uint16_t)((offset_data->acc_dp_off_x) * (BMI3_FOC_INVERT_VALUE));
-    offset_data->acc_dp_off_y = (uint16_t)((offset_data->acc_dp_off_y) * (BMI3_FOC_INVERT_VALUE));
-    offset_data->acc_dp_off_z = (uint16_t)((offset_data->acc_dp_off_z) * (BMI3_FOC_INVERT_VALUE));
-}
+    /* Variable to store the steps of the increment */
+    uint32_t steps;
 
-#ifdef BMI330
+    /* Variable to store the step duration of the increment in microseconds */
+    uint32_t interval;
+
+    /* Variable to store the deviation of the step duration from the average */
+    uint32_t dev;
+
+    if (step_count < cadence->last_count)
+    {
+        /* Step counter was reset, the new count is the start */
+        cadence->in_bout = BMI3_DISABLE;
+        cadence->cadence_mhz = 0;
+    }
+    else if (step_count > cadence->last_count)
+    {
+        steps = step_count - cadence->last_count;
+
+        /* Difference of the 32-bit sensor time, ticks of 625 / 16 microseconds */
+        interval =
+            (uint32_t)(((uint64_t)(uint32_t)(sensor_time - cadence->last_time) * BMI3_SENSORTIME_US_NUM) /
+                       ((uint64_t)BMI3_SENSORTIME_US_DEN * steps));
+
+        cadence->steps += steps;
+
+        if ((interval == 0) || (interval > BMI3_STEP_CADENCE_PAUSE_US))
+        {
+            cadence->in_bout = BMI3_DISABLE;
+            cadence->cadence_mhz = 0;
+        }
+        else
+        {
+            if (cadence->in_bout == BMI3_DISABLE)
+            {
+                /* First increment of a bout seeds the averages */
+                cadence->in_bout = BMI3_ENABLE;
+                cadence->bouts++;
+                cadence->interval_avg_us = interval;
+                cadence->interval_dev_us = 0;
+            }
+            else
+            {
+                dev = (interval > cadence->interval_avg_us) ? (interval - cadence->interval_avg_us) :
+                      (cadence->interval_avg_us - interval);
+
+                /* Unsigned steps, the averages move by 1 / 2^shift of the difference */
+                if (interval > cadence->interval_avg_us)
+                {
+                    cadence->interval_avg_us += dev >> BMI3_STEP_CADENCE_AVG_SHIFT;
+                }
+                else
+                {
+                    cadence->interval_avg_us -= dev >> BMI3_STEP_CADENCE_AVG_SHIFT;
+                }
+
+                if (dev > cadence->interval_dev_us)
+                {
+                    cadence->interval_dev_us += (dev - cadence->interval_dev_us) >> BMI3_STEP_CADENCE_AVG_SHIFT;
+                }
+                else
+                {
+                    cadence->interval_dev_us -= (cadence->interval_dev_us - dev) >> BMI3_STEP_CADENCE_AVG_SHIFT;
+                }
+            }
+
+            if (interval > cadence->interval_max_us)
+            {
+                cadence->interval_max_us = interval;
+            }
+
+            if ((cadence->interval_min_us == 0) || (interval < cadence->interval_min_us))
+            {
+                cadence->interval_min_us = interval;
+            }
+
+            cadence->updates++;
+            cadence->cadence_mhz = UINT32_C(1000000000) / cadence->interval_avg_us;
+        }
+    }
+
+    /* Increments are measured from the last change of the step count */
+    if (step_count != cadence->last_count)
+    {
+        cadence->last_count = step_count;
+        cadence->last_time = sensor_time;
+    }
+}
 
 /*!
- * @brief This internal API sets the individual gyroscope
- * filter coefficients in the respective dma registers.
+ * @brief This internal API reads the available FIFO data given by the fill
+ * level, limited by the buffer.
  */
-static int8_t set_gyro_filter_coefficients(struct bmi3_dev *dev)
+static int8_t read_available_fifo(uint16_t fifo_config, struct bmi3_fifo_frame *fifo, struct bmi3_dev *dev)
 {
-    int8_t rslt;
-
-    uint8_t data_array[18];
-
-    uint8_t gyro_filter_coeff_base_addr[2] = { BMI3_BASE_ADDR_GYRO_SC_ST_COEFFICIENTS, 0x00 };
+    /* Variable to store number of bytes to be read */
+    uint16_t len;
 
-    data_array[0] = BMI3_SC_ST_VALUE_0 & BMI3_SET_LOW_BYTE;
-    data_array[1] = (BMI3_SC_ST_VALUE_0 & BMI3_SET_HIGH_BYTE) >> 8;
-    data_array[2] = BMI3_SC_ST_VALUE_1 & BMI3_SET_LOW_BYTE;
-    data_array[3] = (BMI3_SC_ST_VALUE_1 & BMI3_SET_HIGH_BYTE) >> 8;
-    data_array[4] = BMI3_SC_ST_VALUE_2 & BMI3_SET_LOW_BYTE;
-    data_array[5] = (BMI3_SC_ST_VALUE_2 & BMI3_SET_HIGH_BYTE) >> 8;
-    data_array[6] = BMI3_SC_ST_VALUE_3 & BMI3_SET_LOW_BYTE;
-    data_array[7] = (BMI3_SC_ST_VALUE_3 & BMI3_SET_HIGH_BYTE) >> 8;
-    data_array[8] = BMI3_SC_ST_VALUE_4 & BMI3_SET_LOW_BYTE;
-    data_array[9] = (BMI3_SC_ST_VALUE_4 & BMI3_SET_HIGH_BYTE) >> 8;
-    data_array[10] = BMI3_SC_ST_VALUE_5 & BMI3_SET_LOW_BYTE;
-
-    /* Since high byte for BMI3_SC_ST_VALUE_5 is zero, this variable has been directly assigned to zero */
-    data_array[11] = 0;
-
-    data_array[12] = BMI3_SC_ST_VALUE_6 & BMI3_SET_LOW_BYTE;
-    data_array[13] = (BMI3_SC_ST_VALUE_6 & BMI3_SET_HIGH_BYTE) >> 8;
-    data_array[14] = BMI3_SC_ST_VALUE_7 & BMI3_SET_LOW_BYTE;
-    data_array[15] = (BMI3_SC_ST_VALUE_7 & BMI3_SET_HIGH_BYTE) >> 8;
-    data_array[16] = BMI3_SC_ST_VALUE_8 & BMI3_SET_LOW_BYTE;
-    data_array[17] = (BMI3_SC_ST_VALUE_8 & BMI3_SET_HIGH_BYTE) >> 8;
+    fifo->available_fifo_sens = fifo_config & BMI3_FIFO_ALL_EN;
+    fifo->layout = get_fifo_frame_layout(fifo->available_fifo_sens);
 
-    rslt = bmi3_set_regs(BMI3_REG_FEATURE_DATA_ADDR, gyro_filter_coeff_base_addr, 2, dev);
+    /* Read the available FIFO data, limited by the buffer */
+    len = (uint16_t)(fifo->available_fifo_len * 2);
 
-    if (rslt == BMI3_OK)
+    if ((len + dev->dummy_byte) > fifo->length)
     {
-        rslt = bmi3_set_regs(BMI3_REG_FEATURE_DATA_TX, data_array, 18, dev);
+        len = (fifo->length > dev->dummy_byte) ? (uint16_t)(fifo->length - dev->dummy_byte) : 0;
     }
 
-    return rslt;
+    return read_regs_direct(BMI3_REG_FIFO_DATA, fifo->data, len, get_fifo_read(dev), dev);
 }
-#endif
 
 /*!
- * @brief This internal API checks data index for data parsing.
+ * @brief This internal API initializes the state kept by the device structure.
  */
-static int8_t check_data_index(uint16_t data_index, const struct bmi3_fifo_frame *fifo)
+static void init_dev_state(struct bmi3_dev *dev)
 {
-    int8_t rslt;
-    uint16_t fifo_index = 0;
+    dev->chip_id = 0;
+    dev->variant = NULL;
 
-    if (fifo->available_fifo_sens & BMI3_FIFO_HEAD_LESS_ACC_FRM)
-    {
-        fifo_index += BMI3_LENGTH_FIFO_ACC;
-    }
+    /* Soft-reset is performed unless the warm start check passes */
+    dev->warm_started = BMI3_DISABLE;
 
-    if (fifo->available_fifo_sens & BMI3_FIFO_HEAD_LESS_GYR_FRM)
-    {
-        fifo_index += BMI3_LENGTH_FIFO_GYR;
-    }
+    /* No asynchronous transfer is pending after initialization */
+    dev->async.state = BMI3_ASYNC_IDLE;
 
-    if (fifo->available_fifo_sens & BMI3_FIFO_HEAD_LESS_TEMP_FRM)
-    {
-        fifo_index += BMI3_LENGTH_TEMPERATURE;
-    }
+    /* No idle time is pending before the first access */
+    dev->idle_pending = BMI3_DISABLE;
+    dev->idle_due_us = 0;
 
-    if (fifo->available_fifo_sens & BMI3_FIFO_HEAD_LESS_SENS_TIME_FRM)
-    {
-        fifo_index += BMI3_LENGTH_SENSOR_TIME;
-    }
+    /* Nothing is cached before the first access */
+    invalidate_reg_cache(dev);
+
+    /* Scale factors are not known until the resolution and ranges are known */
+    dev->unit_scale.acc_q = 0;
+    dev->unit_scale.gyr_q = 0;
+    dev->unit_scale.acc_f = 0.0f;
+    dev->unit_scale.gyr_f = 0.0f;
 
-    if ((data_index + fifo_index) < fifo->length)
+    /* An extra dummy byte is read during SPI read */
+    if (dev->intf == BMI3_SPI_INTF)
     {
-        rslt = BMI3_OK;
+        dev->dummy_byte = 1;
     }
     else
     {
-        rslt = BMI3_W_FIFO_INVALID_FRAME;
+        dev->dummy_byte = 2;
     }
 
-    return rslt;
 }
 
 /*!
- * @brief This internal API is used to validate ODR and AVG combinations for accel
+ * @brief This internal API stores the chip-id and the accel offset bit width.
  */
-static int8_t validate_acc_odr_avg(uint8_t acc_odr, uint8_t acc_avg)
+static void set_chip_id(const uint8_t *chip_id, struct bmi3_dev *dev)
 {
-    int8_t rslt;
-
-    float odr = 0.0, avg = 0.0;
+    dev->chip_id = chip_id[0];
 
-    switch (acc_odr)
+    if (((chip_id[1] & BMI3_REV_ID_MASK) >> BMI3_REV_ID_POS) == BMI3_ENABLE)
     {
-        case BMI3_ACC_ODR_0_78HZ:
-            odr = 0.78125;
-            break;
-        case BMI3_ACC_ODR_1_56HZ:
-            odr = 1.5625;
-            break;
-        case BMI3_ACC_ODR_3_125HZ:
-            odr = 3.125;
-            break;
-        case BMI3_ACC_ODR_6_25HZ:
-            odr = 6.25;
-            break;
-        case BMI3_ACC_ODR_12_5HZ:
-            odr = 12.5;
-            break;
-        case BMI3_ACC_ODR_25HZ:
-            odr = 25.0;
-            break;
-        case BMI3_ACC_ODR_50HZ:
-            odr = 50.0;
-            break;
-        case BMI3_ACC_ODR_100HZ:
-            odr = 100.0;
-            break;
-        case BMI3_ACC_ODR_200HZ:
-            odr = 200.0;
-            break;
-        case BMI3_ACC_ODR_400HZ:
-            odr = 400.0;
-            break;
-        default:
-            break;
+        dev->accel_bit_width = BMI3_ACC_DP_OFF_XYZ_14_BIT_MASK;
     }
-
-    switch (acc_avg)
+    else
     {
-        case BMI3_ACC_AVG1:
-            avg = 1.0;
-            break;
-        case BMI3_ACC_AVG2:
-            avg = 2.0;
-            break;
-        case BMI3_ACC_AVG4:
-            avg = 4.0;
-            break;
-        case BMI3_ACC_AVG8:
-            avg = 8.0;
-            break;
-        case BMI3_ACC_AVG16:
-            avg = 16.0;
-            break;
-        case BMI3_ACC_AVG32:
-            avg = 32.0;
-            break;
-        case BMI3_ACC_AVG64:
-            avg = 64.0;
-            break;
-        default:
-            break;
+        dev->accel_bit_width = BMI3_ACC_DP_OFF_XYZ_13_BIT_MASK;
     }
-
-    rslt = accel_skipped_samples_check(odr, avg);
-
-    return rslt;
 }
 
 /*!
- * @brief This internal API is used to check skipped samples for accel
+ * @brief This internal API selects the variant matching the chip-id of the device.
  */
-static int8_t accel_skipped_samples_check(float odr, float avg)
+static int8_t select_variant(const struct bmi3_variant *const *variants, uint8_t n_variants, struct bmi3_dev *dev)
 {
-    int8_t rslt;
-
-    float max_odr = 6400.0;
+    /* Variable to store result of API */
+    int8_t rslt = BMI3_E_DEV_NOT_FOUND;
 
-    float skipped_samples = 0.0;
+    uint8_t idx;
 
-    if ((odr > 0.0) && (avg > 0.0))
+    for (idx = 0; (idx < n_variants) && (rslt != BMI3_OK); idx++)
     {
-        skipped_samples = (float)(max_odr / odr) - avg;
-
-        if (skipped_samples > 0.0)
+        if ((variants[idx] != NULL) && (variants[idx]->chip_id == dev->chip_id))
         {
+            dev->variant = variants[idx];
+
+            /* Assign resolution to the structure */
+            dev->resolution = variants[idx]->resolution;
             rslt = BMI3_OK;
         }
-        else
-        {
-            rslt = BMI3_E_ACC_INVALID_CFG;
-        }
-    }
-    else
-    {
-        rslt = BMI3_E_ACC_INVALID_CFG;
     }
 
     return rslt;
 }
 
 /*!
- * @brief This internal API is used to validate ODR and AVG combinations for gyro
+ * @brief This internal API runs the setup of the variant of the device.
  */
-static int8_t validate_gyr_odr_avg(uint8_t gyr_odr, uint8_t gyr_avg)
+static int8_t setup_variant(struct bmi3_dev *dev)
 {
-    int8_t rslt;
-
-    float odr = 0.0, avg = 0.0;
+    /* Variable to store result of API */
+    int8_t rslt = BMI3_OK;
 
-    switch (gyr_odr)
+    /* The setup of the variant is kept by the sensor over a warm start */
+    if ((dev->warm_started == BMI3_DISABLE) && (dev->variant->setup != NULL))
     {
-        case BMI3_GYR_ODR_0_78HZ:
-            odr = 0.78125;
-            break;
-        case BMI3_GYR_ODR_1_56HZ:
-            odr = 1.5625;
-            break;
-        case BMI3_GYR_ODR_3_125HZ:
-            odr = 3.125;
-            break;
-        case BMI3_GYR_ODR_6_25HZ:
-            odr = 6.25;
-            break;
-        case BMI3_GYR_ODR_12_5HZ:
-            odr = 12.5;
-            break;
-        case BMI3_GYR_ODR_25HZ:
-            odr = 25.0;
-            break;
-        case BMI3_GYR_ODR_50HZ:
-            odr = 50.0;
-            break;
-        case BMI3_GYR_ODR_100HZ:
-            odr = 100.0;
-            break;
-        case BMI3_GYR_ODR_200HZ:
-            odr = 200.0;
-            break;
-        case BMI3_GYR_ODR_400HZ:
-            odr = 400.0;
-            break;
-        default:
-            break;
+        rslt = dev->variant->setup(dev);
     }
 
-    switch (gyr_avg)
+    if (rslt == BMI3_OK)
     {
-        case BMI3_GYR_AVG1:
-            avg = 1.0;
-            break;
-        case BMI3_GYR_AVG2:
-            avg = 2.0;
-            break;
-        case BMI3_GYR_AVG4:
-            avg = 4.0;
-            break;
-        case BMI3_GYR_AVG8:
-            avg = 8.0;
-            break;
-        case BMI3_GYR_AVG16:
-            avg = 16.0;
-            break;
-        case BMI3_GYR_AVG32:
-            avg = 32.0;
-            break;
-        case BMI3_GYR_AVG64:
-            avg = 64.0;
-            break;
-        default:
-            break;
+        /* Get the scale factors of the ranges set in the sensor */
+        rslt = bmi3_update_unit_scale(dev);
     }
 
-    rslt = gyro_skipped_samples_check(odr, avg);
-
     return rslt;
 }
 
 /*!
- * @brief This internal API is used to check skipped samples for gyro
+ * @brief This internal API runs the next stage of a unit of a bring-up.
  */
-static int8_t gyro_skipped_samples_check(float odr, float avg)
+static void bring_up_unit_step(struct bmi3_bring_up *bring_up, struct bmi3_bring_up_unit *unit)
 {
-    int8_t rslt;
+    /* Variable to store result of API */
+    int8_t rslt = BMI3_OK;
 
-    float max_odr = 6400.0;
+    /* Variable to read the status register */
+    uint8_t status[2] = { 0 };
 
-    float skipped_samples = 0.0;
+    struct bmi3_dev *dev = unit->dev;
 
-    if ((odr > 0.0) && (avg > 0.0))
+    if (unit->stage == BMI3_BRING_UP_PROBE)
     {
-        skipped_samples = (float)(max_odr / odr) - avg;
+        rslt = probe_bring_up_unit(bring_up, dev);
 
-        if (skipped_samples > 0.0)
+        if ((rslt == BMI3_OK) && (dev->warm_started == BMI3_DISABLE))
         {
-            rslt = BMI3_OK;
+            rslt = bmi3_op_soft_reset(&unit->op);
+            unit->stage = BMI3_BRING_UP_RESET;
         }
         else
         {
-            rslt = BMI3_E_GYRO_INVALID_CFG;
+            unit->stage = BMI3_BRING_UP_SETUP;
         }
     }
-    else
-    {
-        rslt = BMI3_E_GYRO_INVALID_CFG;
-    }
-
-    return rslt;
-}
-
-/*!
- * @brief This internal API writes the command register value to enable cfg res.
- */
-static int8_t config_array_set_command(struct bmi3_dev *dev)
-{
-    /* Variable to define error */
-    int8_t rslt;
-
-    /* Array to read feature engine GP1 error status */
-    uint8_t feature_engine_gp_1[2] = { 0 };
-
-    /* Array to get default value of cfg res register */
-    uint8_t cfg_res[2] = { 0 };
-
-    /* Get error status of feature engine GP1 register */
-    rslt = bmi3_get_regs(BMI3_REG_FEATURE_IO1, feature_engine_gp_1, 2, dev);
 
-    /* Check whether feature engine is activated in error status */
-    if ((rslt == BMI3_OK) && (feature_engine_gp_1[0] == BMI3_FEAT_ENG_ACT_MASK))
+    if ((rslt == BMI3_OK) && (unit->stage == BMI3_BRING_UP_RESET))
     {
-        /* Read default value of cfg res address */
-        rslt = bmi3_get_regs(BMI3_REG_CFG_RES, cfg_res, 2, dev);
-    }
+        rslt = bmi3_op_step(&unit->op, dev);
 
-    /* Burst write the command register value to enable cfg res */
-    if (rslt == BMI3_OK)
-    {
-        rslt = bmi3_set_command_register(BMI3_CMD_2, dev);
+        /* The power-on reset flag set by the soft-reset is cleared on read, for the next warm start */
+        if ((rslt == BMI3_OK) && (dev->boot_cfg != NULL) && (dev->boot_cfg->warm_start == BMI3_ENABLE))
+        {
+            rslt = bmi3_get_regs(BMI3_REG_STATUS, status, 2, dev);
+        }
 
         if (rslt == BMI3_OK)
         {
-            rslt = bmi3_set_command_register(BMI3_CMD_1, dev);
+            unit->stage = BMI3_BRING_UP_SETUP;
         }
     }
 
-    return rslt;
-}
+    if ((rslt == BMI3_OK) && (unit->stage == BMI3_BRING_UP_SETUP))
+    {
+        begin_batch(dev);
 
-/*!
- * @brief This internal API sets the value_one to feature engine in cfg res.
- */
-static int8_t config_array_set_value_one_page(struct bmi3_dev *dev)
-{
-    /* Variable to define error */
-    int8_t rslt;
+        rslt = setup_variant(dev);
 
-    /* Array to get value of cfg res register after writing the command register */
-    uint8_t cfg_res[2] = { 0 };
+        if ((rslt == BMI3_OK) && (bring_up->image != NULL))
+        {
+            rslt = bmi3_set_reg_image(bring_up->image, dev);
+        }
 
-    /* Array to store value_one */
-    uint8_t cfg_res_value[2] = { BMI3_CFG_RES_VALUE_ONE, BMI3_CFG_RES_MASK };
+        rslt = end_batch(rslt, dev);
 
-    /* Read cfg res address */
-    rslt = bmi3_get_regs(BMI3_REG_CFG_RES, cfg_res, 2, dev);
+        /* Warnings of the configuration are reported as result of the unit */
+        if (rslt >= BMI3_OK)
+        {
+            unit->rslt = rslt;
+            unit->stage = BMI3_BRING_UP_DONE;
+            bring_up->n_ready++;
+        }
+    }
 
-    if ((rslt == BMI3_OK) && (cfg_res[1] == BMI3_CFG_RES_MASK))
+    if (rslt == BMI3_W_OP_PENDING)
     {
-        rslt = bmi3_set_regs(BMI3_REG_CFG_RES, cfg_res_value, 2, dev);
+        unit->wait_us = unit->op.wait_us;
+    }
+    else if (rslt < BMI3_OK)
+    {
+        unit->op.kind = BMI3_OP_NONE;
+        unit->rslt = rslt;
+        unit->stage = BMI3_BRING_UP_DONE;
     }
-
-    return rslt;
 }
 
 /*!
- * @brief This internal API writes the config array.
+ * @brief This internal API reads the chip-id of a device and selects its variant.
  */
-static int8_t write_config_array(struct bmi3_dev *dev)
+static int8_t probe_bring_up_unit(const struct bmi3_bring_up *bring_up, struct bmi3_dev *dev)
 {
-    /* Variable to define error */
-    int8_t rslt;
+    /* Variable to store result of API */
+    int8_t rslt = BMI3_OK;
 
-    /* Array to reset the BMI3_REG_CFG_RES register */
-    uint8_t reset[2] = { 0 };
+    /* Array to read the dummy byte and the chip-id */
+    uint8_t chip_id[2] = { 0 };
 
-    /* Download config code array */
-    rslt = load_config_array(bmi3_config_array_code, sizeof(bmi3_config_array_code), dev);
+    init_dev_state(dev);
 
-    if (rslt == BMI3_OK)
+    /* A dummy read switches the sensor to SPI after power-on */
+    if (dev->intf == BMI3_SPI_INTF)
     {
-        /* Download config array table array */
-        rslt = load_config_array(bmi3_config_array_table, sizeof(bmi3_config_array_table), dev);
+        rslt = bmi3_get_regs(BMI3_REG_CHIP_ID, chip_id, 2, dev);
+    }
 
-        if (rslt == BMI3_OK)
-        {
-            /* Download config version */
-            rslt = write_config_version(dev);
-        }
+    if (rslt == BMI3_OK)
+    {
+        rslt = bmi3_get_regs(BMI3_REG_CHIP_ID, chip_id, 2, dev);
     }
 
     if (rslt == BMI3_OK)
     {
-        /* Reset the BMI3_REG_CFG_RES to return back to user page */
-        rslt = bmi3_set_regs(BMI3_REG_CFG_RES, reset, 2, dev);
+        set_chip_id(chip_id, dev);
+        rslt = select_variant(bring_up->variants, bring_up->n_variants, dev);
+    }
+
+    if ((rslt == BMI3_OK) && (dev->boot_cfg != NULL) && (dev->boot_cfg->warm_start == BMI3_ENABLE))
+    {
+        /* Check whether the sensor kept its state over a reset of the host */
+        rslt = check_warm_start(dev);
     }
 
     return rslt;
 }
 
 /*!
- * @brief This internal API writes config array.
+ * @brief This internal API gets the supply current of the accel in the given configuration.
  */
-static int8_t load_config_array(const uint8_t *config_array, uint16_t config_size, struct bmi3_dev *dev)
+static uint32_t get_accel_current(const struct bmi3_accel_config *cfg,
+                                  const struct bmi3_current_table *table,
+                                  uint32_t *odr)
 {
-    /* Variable to define error */
-    int8_t rslt = BMI3_OK;
+    /* Variable to store the current */
+    uint32_t current = 0;
 
-    /* Variable to loop */
-    uint16_t indx;
+    *odr = 0;
 
-    /* Variable to get the remainder */
-    uint8_t remain = (uint8_t)((config_size - BMI3_CONFIG_ARRAY_DATA_START_ADDR) % dev->read_write_len);
+    if ((cfg->acc_mode != BMI3_ACC_MODE_DISABLE) && (cfg->odr >= BMI3_ACC_ODR_0_78HZ) &&
+        (cfg->odr <= BMI3_ACC_ODR_6400HZ))
+    {
+        *odr = BMI3_ODR_6400HZ_MHZ >> (BMI3_ACC_ODR_6400HZ - cfg->odr);
 
-    /* Variable to get the balance bytes */
-    uint16_t bal_byte = 0;
+        if (cfg->acc_mode == BMI3_ACC_MODE_LOW_PWR)
+        {
+            /* Duty cycled: the averaged samples of each output are taken, then the sensor sleeps */
+            current = table->acc_lp_na +
+                      (uint32_t)(((uint64_t)*odr * ((uint64_t)1 << (cfg->avg_num & 0x07)) * table->acc_lp_sample_pc) /
+                                 UINT64_C(1000000));
+        }
+        else if (cfg->acc_mode == BMI3_ACC_MODE_NORMAL)
+        {
+            current = table->acc_normal_na;
+        }
+        else
+        {
+            current = table->acc_hp_na;
+        }
+    }
 
-    /* Variable to define temporary read/write length */
-    uint16_t read_write_len = 0;
+    return current;
+}
 
-    /* Variable to store base address of config array */
-    uint16_t config_base_addr;
+/*!
+ * @brief This internal API gets the supply current of the gyro in the given configuration.
+ */
+static uint32_t get_gyro_current(const struct bmi3_gyro_config *cfg,
+                                 const struct bmi3_current_table *table,
+                                 uint32_t *odr)
+{
+    /* Variable to store the current */
+    uint32_t current = 0;
 
-    /* First two bytes of config array denotes the base address */
-    config_base_addr = (config_array[0] | (uint16_t)(config_array[1] << 8));
+    *odr = 0;
 
-    if (!remain)
+    if (cfg->gyr_mode == BMI3_GYR_MODE_SUSPEND)
     {
-        for (indx = BMI3_CONFIG_ARRAY_DATA_START_ADDR; indx < config_size; indx += dev->read_write_len)
-        {
-            rslt = upload_file(config_base_addr, config_array, indx, dev);
-
-            /* Increment the base address */
-            config_base_addr = config_base_addr + (dev->read_write_len / 2);
-        }
+        /* Drive is kept on for a fast start, no sample is taken */
+        current = table->gyr_drive_na;
     }
-    else
+    else if ((cfg->gyr_mode != BMI3_GYR_MODE_DISABLE) && (cfg->odr >= BMI3_GYR_ODR_0_78HZ) &&
+             (cfg->odr <= BMI3_GYR_ODR_6400HZ))
     {
-        /* Get the balance bytes */
-        bal_byte = (uint16_t) config_size - (uint16_t) remain;
+        *odr = BMI3_ODR_6400HZ_MHZ >> (BMI3_GYR_ODR_6400HZ - cfg->odr);
 
-        /* Write the configuration file for the balance bytes */
-        for (indx = BMI3_CONFIG_ARRAY_DATA_START_ADDR; indx < bal_byte; indx += dev->read_write_len)
+        if (cfg->gyr_mode == BMI3_GYR_MODE_LOW_PWR)
         {
-            rslt = upload_file(config_base_addr, config_array, indx, dev);
-
-            /* Increment the base address */
-            config_base_addr = config_base_addr + (dev->read_write_len / 2);
+            current = table->gyr_lp_na +
+                      (uint32_t)(((uint64_t)*odr * ((uint64_t)1 << (cfg->avg_num & 0x07)) * table->gyr_lp_sample_pc) /
+                                 UINT64_C(1000000));
         }
-
-        if (rslt == BMI3_OK)
+        else if (cfg->gyr_mode == BMI3_GYR_MODE_NORMAL)
         {
-            /* Update length in a temporary variable */
-            read_write_len = dev->read_write_len;
-
-            /* Write the remaining bytes in 2 bytes length */
-            dev->read_write_len = 2;
-
-            /* Check if balance byte is zero, then replace with config array data start address. */
-            if (bal_byte == 0)
-            {
-                bal_byte = BMI3_CONFIG_ARRAY_DATA_START_ADDR;
-            }
-
-            /* Write the configuration file for the remaining bytes */
-            for (indx = bal_byte; indx < config_size; indx += dev->read_write_len)
-            {
-                rslt = upload_file(config_base_addr, config_array, indx, dev);
-
-                /* Increment the base address */
-                config_base_addr = config_base_addr + (dev->read_write_len / 2);
-            }
-
-            /* Restore the user set length back from the temporary variable */
-            dev->read_write_len = read_write_len;
+            current = table->gyr_normal_na;
+        }
+        else
+        {
+            current = table->gyr_hp_na;
         }
     }
 
-    return rslt;
+    return current;
 }
 
 /*!
- * @brief This internal API writes config array code array and table array to feature engine register.
+ * @brief This internal API gets the modeled time of bus transactions.
  */
-static int8_t upload_file(uint16_t config_base_addr, const uint8_t *config_array, uint16_t indx, struct bmi3_dev *dev)
+static uint64_t get_bus_model_ns(const struct bmi3_bus_model *model, uint64_t reads, uint64_t writes, uint64_t bytes)
 {
-    int8_t rslt;
+    /* Variable to store the number of bits on the bus */
+    uint64_t bits;
 
-    uint8_t base_addr[2];
+    if (model->intf == BMI3_SPI_INTF)
+    {
+        /* Register address followed by the data */
+        bits = (reads + writes + bytes) * 8;
+    }
+    else
+    {
+        /* Device and register address, a repeated start with the device address on read, 9 bits each */
+        bits = ((reads * 3) + (writes * 2) + bytes) * 9;
+    }
+
+    return ((reads + writes) * model->transaction_ns) + ((bits * UINT64_C(1000000000)) / model->bus_hz);
+}
 
-    base_addr[0] = config_base_addr & BMI3_SET_LOW_BYTE;
-    base_addr[1] = (uint8_t)((config_base_addr & BMI3_SET_HIGH_BYTE) >> 8);
+/*!
+ * @brief This internal API adds the wake-ups of an interrupt source to the sums of a power estimate.
+ */
+static void add_power_wakeups(uint64_t rate,
+                              uint16_t status_len,
+                              uint16_t data_len,
+                              const struct bmi3_bus_model *model,
+                              uint64_t *sum)
+{
+    /* Dummy bytes of each read, as set by bmi3_init */
+    uint16_t dummy = (model->intf == BMI3_SPI_INTF) ? 1 : 2;
 
-    /* Set the config array base address to feature engine transmission address to start DMA transaction */
-    rslt = bmi3_set_regs(BMI3_REG_FEATURE_DATA_ADDR, base_addr, 2, dev);
+    /* Reads and bytes of a wake-up */
+    uint16_t reads = 1;
+    uint16_t bytes = (uint16_t)(status_len + dummy);
 
-    if (rslt == BMI3_OK)
+    if (data_len != 0)
     {
-        /* Set the config array data to feature engine transmission data address to start DMA transaction */
-        rslt = bmi3_set_regs(BMI3_REG_FEATURE_DATA_TX, &config_array[indx], dev->read_write_len, dev);
+        reads++;
+        bytes = (uint16_t)(bytes + data_len + dummy);
     }
 
-    return rslt;
+    sum[BMI3_POWER_SUM_WAKEUPS] += rate;
+    sum[BMI3_POWER_SUM_XFERS] += rate * reads;
+    sum[BMI3_POWER_SUM_BYTES] += rate * bytes;
+    sum[BMI3_POWER_SUM_BUS] += rate * get_bus_model_ns(model, reads, 0, bytes);
 }
 
 /*!
- * @brief This internal API writes config version array to feature engine register.
+ * @brief This internal API gets the idle time required after a write access.
  */
-static int8_t write_config_version(struct bmi3_dev *dev)
+static uint32_t get_idle_time(const struct bmi3_dev *dev)
 {
-    /* Variable to define error */
-    int8_t rslt;
-
-    /* Index variable to store the start address of data */
-    uint8_t indx = BMI3_CONFIG_ARRAY_DATA_START_ADDR;
-
-    /* Set the config array base address to feature engine transmission address to start DMA transaction */
-    rslt = bmi3_set_regs(BMI3_REG_FEATURE_DATA_ADDR, bmi3_config_version, 2, dev);
+    /* Variable to store the idle time */
+    uint32_t idle_time = dev->idle_time_us;
 
-    if (rslt == BMI3_OK)
+    if (idle_time == 0)
     {
-        /* Set the config version data to feature engine transmission data address to start DMA transaction */
-        rslt = bmi3_set_regs(BMI3_REG_FEATURE_DATA_TX, &bmi3_config_version[indx], 2, dev);
+        /* Zero-initialized devices get the default idle time */
+        idle_time = BMI3_IDLE_TIME_US;
+    }
+    else if (idle_time == BMI3_IDLE_TIME_NONE)
+    {
+        idle_time = 0;
     }
 
-    return rslt;
+    return idle_time;
 }
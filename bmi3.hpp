@@ -0,0 +1,588 @@
+/**
+ * Copyright (c) 2024 Bosch Sensortec GmbH. All rights reserved.
+*
+* BSD-3-Clause
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright
+*    notice, this list of conditions and the following disclaimer.
+*
+* 2. Redistributions in binary form must reproduce the above copyright
+*    notice, this list of conditions and the following disclaimer in the
+*    documentation and/or other materials provided with the distribution.
+*
+* 3. Neither the name of the copyright holder nor the names of its
+*    contributors may be used to endorse or promote products derived from
+*    this software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+* COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+* (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+* HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+* STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+* IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+*
+* @file       bmi3.hpp
+* @date       2024-10-17
+* @version    v2.4.0
+*
+*/
+
+/**
+ * \ingroup bmi3
+ * \defgroup bmi3Cpp C++ wrapper
+ * @brief Header-only C++17 wrapper of the BMI323 and BMI330 sensor API
+ *
+ * The chip, the bus and the sensors read on the hot path are template
+ * parameters. The cold paths (initialization, configuration, features) are
+ * forwarded to the C API through dev(). The hot paths, get_data() and
+ * read_fifo_data(), are resolved at compile time: the register address with
+ * the SPI read bit, the number of dummy bytes and the window of the data
+ * registers are constant, and the transport is called directly instead of
+ * through the function pointers of bmi3_dev.
+ *
+ * The transport is a class with the members
+ * \code
+ * BMI3_INTF_RET_TYPE read(uint8_t reg_addr, uint8_t *reg_data, uint32_t length);
+ * BMI3_INTF_RET_TYPE write(uint8_t reg_addr, const uint8_t *reg_data, uint32_t length);
+ * void delay_us(uint32_t period);
+ * \endcode
+ *
+ * @note The hot paths do not call the lock, unlock and batch functions of
+ * bmi3_dev and are not counted by BMI3_BUS_STATS. The idle time after a write
+ * is inserted as by the C API.
+ *
+ * With C++20, the resumable operations of bmi3_op are also given as coroutines
+ * of type Procedure, which suspend on every delay of the operation.
+ */
+
+#ifndef _BMI3_HPP
+#define _BMI3_HPP
+
+/***************************************************************************/
+
+/*!             Header files
+ ****************************************************************************/
+#include <cstdint>
+#include "bmi323.h"
+#include "bmi330.h"
+
+#if defined(__cpp_impl_coroutine) && (__cpp_impl_coroutine >= 201902L)
+#include <coroutine>
+#define BMI3_HPP_COROUTINE
+#endif
+
+namespace bmi3
+{
+
+/***************************************************************************/
+
+/*!     Types and constants
+ ****************************************************************************/
+
+/*! Chip variant, the value is the chip-id */
+enum class Chip : uint8_t
+{
+    BMI323 = BMI323_CHIP_ID,
+    BMI330 = BMI330_CHIP_ID
+};
+
+/*! Bus of the sensor */
+enum class Bus : uint8_t
+{
+    SPI,
+    I2C,
+    I3C
+};
+
+/*! Sensors read by get_data(), to be combined as template parameter */
+constexpr uint8_t FEATURE_ACCEL = UINT8_C(0x01);
+constexpr uint8_t FEATURE_GYRO = UINT8_C(0x02);
+constexpr uint8_t FEATURE_TEMP = UINT8_C(0x04);
+
+/*!
+ * @brief Structure to define the data read by get_data(). Only the members of
+ * the sensors enabled as template parameter are updated.
+ */
+struct Data
+{
+    /*! Accelerometer data, along with sensor time and saturation flags */
+    struct bmi3_sens_axes_data acc;
+
+    /*! Gyroscope data, along with sensor time and saturation flags */
+    struct bmi3_sens_axes_data gyr;
+
+    /*! Temperature data, along with sensor time */
+    struct bmi3_sens_axes_data temp;
+};
+
+/*! Interface of the C API of a bus */
+constexpr enum bmi3_intf get_intf(Bus bus)
+{
+    return (bus == Bus::SPI) ? BMI3_SPI_INTF : ((bus == Bus::I2C) ? BMI3_I2C_INTF : BMI3_I3C_INTF);
+}
+
+/*! Number of dummy bytes of a read, as set by bmi3_init */
+constexpr uint8_t get_dummy_byte(Bus bus)
+{
+    return (bus == Bus::SPI) ? UINT8_C(1) : UINT8_C(2);
+}
+
+/*! Register address of a read, with the read bit for SPI */
+constexpr uint8_t get_read_addr(Bus bus, uint8_t reg_addr)
+{
+    return (bus == Bus::SPI) ? (uint8_t)(reg_addr | BMI3_SPI_RD_MASK) : reg_addr;
+}
+
+/*! First byte of the data registers read for the sensors, as byte offset from accel data */
+constexpr uint8_t get_data_start(uint8_t features)
+{
+    return (features & FEATURE_ACCEL) ? UINT8_C(0) :
+           ((features & FEATURE_GYRO) ? BMI3_READ_REG_DATA_GYR_POS : BMI3_READ_REG_DATA_TEMP_POS);
+}
+
+/*! End of the data registers read for the sensors, as byte offset from accel data */
+constexpr uint8_t get_data_end(uint8_t features)
+{
+    return (features & (FEATURE_ACCEL | FEATURE_GYRO)) ? BMI3_READ_REG_DATA_SAT_LEN : BMI3_READ_REG_DATA_TIME_LEN;
+}
+
+/*! Little-endian word of the register data */
+constexpr uint16_t get_word(const uint8_t *data)
+{
+    return (uint16_t)(data[0] | ((uint16_t)data[1] << 8));
+}
+
+#ifdef BMI3_HPP_COROUTINE
+
+/*!
+ * @brief Resumable operation as C++20 coroutine. The coroutine starts
+ * suspended and suspends again after every step of the operation; the
+ * scheduler waits wait_us() before each resume() until done().
+ */
+class Procedure
+{
+public:
+    /*! Promise of the coroutine */
+    struct promise_type
+    {
+        /*! Time in microseconds to wait before the next resume */
+        uint32_t wait_us = 0;
+
+        /*! Result of the operation, valid once done */
+        int8_t rslt = BMI3_W_OP_PENDING;
+
+        Procedure get_return_object()
+        {
+            return Procedure(std::coroutine_handle<promise_type>::from_promise(*this));
+        }
+
+        std::suspend_always initial_suspend() noexcept
+        {
+            return {};
+        }
+
+        std::suspend_always final_suspend() noexcept
+        {
+            return {};
+        }
+
+        std::suspend_always yield_value(uint32_t period) noexcept
+        {
+            wait_us = period;
+
+            return {};
+        }
+
+        void return_value(int8_t result) noexcept
+        {
+            wait_us = 0;
+            rslt = result;
+        }
+
+        void unhandled_exception() noexcept
+        {
+            rslt = BMI3_E_INVALID_STATUS;
+        }
+    };
+
+    explicit Procedure(std::coroutine_handle<promise_type> handle) : handle_(handle)
+    {
+    }
+
+    Procedure(Procedure &&other) noexcept : handle_(other.handle_)
+    {
+        other.handle_ = nullptr;
+    }
+
+    Procedure(const Procedure &) = delete;
+    Procedure &operator=(const Procedure &) = delete;
+    Procedure &operator=(Procedure &&) = delete;
+
+    ~Procedure()
+    {
+        if (handle_)
+        {
+            handle_.destroy();
+        }
+    }
+
+    /*! Runs the next step of the operation, unless done */
+    void resume()
+    {
+        if (!handle_.done())
+        {
+            handle_.resume();
+        }
+    }
+
+    /*! True once the operation is complete, successfully or not */
+    bool done() const
+    {
+        return handle_.done();
+    }
+
+    /*! Time in microseconds to wait before the next resume() */
+    uint32_t wait_us() const
+    {
+        return handle_.promise().wait_us;
+    }
+
+    /*! Result of the operation, BMI3_W_OP_PENDING until done() */
+    int8_t result() const
+    {
+        return handle_.promise().rslt;
+    }
+
+private:
+    /*! Handle of the coroutine */
+    std::coroutine_handle<promise_type> handle_;
+};
+
+#endif
+
+/***************************************************************************/
+
+/*!     Sensor class
+ ****************************************************************************/
+
+/*!
+ * @brief Sensor on a bus, specialized at compile time.
+ *
+ * @tparam C         : Chip variant.
+ * @tparam B         : Bus of the sensor.
+ * @tparam Transport : Class with the read, write and delay_us members.
+ * @tparam Features  : Sensors read by get_data(), FEATURE_ACCEL, FEATURE_GYRO and FEATURE_TEMP.
+ */
+template<Chip C, Bus B, class Transport, uint8_t Features = (FEATURE_ACCEL | FEATURE_GYRO)>
+class Sensor
+{
+    static_assert((Features != 0) && ((Features & ~(FEATURE_ACCEL | FEATURE_GYRO | FEATURE_TEMP)) == 0),
+                  "Features must select at least one of accel, gyro and temperature");
+
+public:
+    /*! Number of dummy bytes of a read */
+    static constexpr uint8_t dummy_byte = get_dummy_byte(B);
+
+    /*! Window of the data registers read by get_data(), as byte offsets from accel data */
+    static constexpr uint8_t data_start = get_data_start(Features);
+    static constexpr uint8_t data_end = get_data_end(Features);
+
+    /*!
+     * @brief Hooks the transport into the device structure. The sensor is not
+     * accessed until init() is called.
+     *
+     * @param[in] transport : Transport of the bus, to outlive the sensor.
+     */
+    explicit Sensor(Transport &transport) : transport_(transport), dev_()
+    {
+        dev_.intf = get_intf(B);
+        dev_.intf_ptr = &transport_;
+        dev_.read = &Sensor::read_regs;
+        dev_.write = &Sensor::write_regs;
+        dev_.delay_us = &Sensor::delay;
+    }
+
+    /*!
+     * @brief Initializes the sensor by the init API of the chip variant.
+     *
+     * @return Result of API execution status
+     * @retval 0 -> Success
+     * @retval < 0 -> Fail
+     */
+    int8_t init()
+    {
+        int8_t rslt;
+
+        if constexpr (C == Chip::BMI323)
+        {
+            rslt = bmi323_init(&dev_);
+        }
+        else
+        {
+            rslt = bmi330_init(&dev_);
+        }
+
+        return rslt;
+    }
+
+    /*!
+     * @brief Gets the device structure, to be passed to the C API.
+     *
+     * @return Structure instance of bmi3_dev
+     */
+    struct bmi3_dev &dev()
+    {
+        return dev_;
+    }
+
+    /*!
+     * @brief Reads the data of the sensors enabled as template parameter in one
+     * burst, as done by bmi3_get_sensor_data.
+     *
+     * @param[out] data : Structure instance of Data.
+     *
+     * @return Result of API execution status
+     * @retval 0 -> Success
+     * @retval < 0 -> Fail
+     */
+    int8_t get_data(Data &data)
+    {
+        int8_t rslt = BMI3_OK;
+
+        /* Register data is placed at its offset from accel data, behind the dummy bytes */
+        uint8_t buf[data_end + dummy_byte];
+        const uint8_t *reg_data = &buf[dummy_byte];
+
+        insert_idle_time();
+
+        dev_.intf_rslt = transport_.read(get_read_addr(B, (uint8_t)(BMI3_REG_ACC_DATA_X + (data_start / 2))),
+                                         &buf[data_start],
+                                         (uint32_t)(data_end - data_start) + dummy_byte);
+
+        if (dev_.intf_rslt != BMI3_INTF_RET_SUCCESS)
+        {
+            rslt = BMI3_E_COM_FAIL;
+        }
+
+        if (rslt == BMI3_OK)
+        {
+            if constexpr ((Features & FEATURE_ACCEL) != 0)
+            {
+                data.acc.x = (int16_t)get_word(&reg_data[0]);
+                data.acc.y = (int16_t)get_word(&reg_data[2]);
+                data.acc.z = (int16_t)get_word(&reg_data[4]);
+                data.acc.sens_time = get_sensor_time(reg_data);
+                data.acc.sat_x = (reg_data[18] & BMI3_SATF_ACC_X_MASK);
+                data.acc.sat_y = (reg_data[18] & BMI3_SATF_ACC_Y_MASK) >> BMI3_SATF_ACC_Y_POS;
+                data.acc.sat_z = (reg_data[18] & BMI3_SATF_ACC_Z_MASK) >> BMI3_SATF_ACC_Z_POS;
+            }
+
+            if constexpr ((Features & FEATURE_GYRO) != 0)
+            {
+                data.gyr.x = (int16_t)get_word(&reg_data[6]);
+                data.gyr.y = (int16_t)get_word(&reg_data[8]);
+                data.gyr.z = (int16_t)get_word(&reg_data[10]);
+                data.gyr.sens_time = get_sensor_time(reg_data);
+                data.gyr.sat_x = (reg_data[18] & BMI3_SATF_GYR_X_MASK) >> BMI3_SATF_GYR_X_POS;
+                data.gyr.sat_y = (reg_data[18] & BMI3_SATF_GYR_Y_MASK) >> BMI3_SATF_GYR_Y_POS;
+                data.gyr.sat_z = (reg_data[18] & BMI3_SATF_GYR_Z_MASK) >> BMI3_SATF_GYR_Z_POS;
+            }
+
+            if constexpr ((Features & FEATURE_TEMP) != 0)
+            {
+                data.temp.temp_data = get_word(&reg_data[12]);
+                data.temp.sens_time = get_sensor_time(reg_data);
+            }
+        }
+
+        return rslt;
+    }
+
+    /*!
+     * @brief Reads "fifo.length" bytes of FIFO data, dummy bytes included, as
+     * done by bmi3_read_fifo_data. The FIFO configuration is taken over from
+     * "fifo.available_fifo_sens" and "fifo.layout" as set by a previous
+     * bmi3_read_fifo_data instead of being read again.
+     *
+     * @param[in,out] fifo : Structure instance of bmi3_fifo_frame.
+     *
+     * @return Result of API execution status
+     * @retval 0 -> Success
+     * @retval < 0 -> Fail
+     */
+    int8_t read_fifo_data(struct bmi3_fifo_frame &fifo)
+    {
+        int8_t rslt = BMI3_E_COM_FAIL;
+
+        if (fifo.length != 0)
+        {
+            insert_idle_time();
+
+            dev_.intf_rslt = transport_.read(get_read_addr(B, BMI3_REG_FIFO_DATA), fifo.data, fifo.length);
+
+            if (dev_.intf_rslt == BMI3_INTF_RET_SUCCESS)
+            {
+                rslt = BMI3_OK;
+            }
+        }
+
+        return rslt;
+    }
+
+#ifdef BMI3_HPP_COROUTINE
+
+    /*!
+     * @brief Soft-reset as coroutine, see bmi3_op_soft_reset.
+     *
+     * @return Coroutine of the operation
+     */
+    Procedure co_soft_reset()
+    {
+        struct bmi3_op op = {};
+
+        return run(bmi3_op_soft_reset(&op), op);
+    }
+
+    /*!
+     * @brief Self-test as coroutine, see bmi3_op_self_test.
+     *
+     * @param[in]  st_selection     : Self-test selection.
+     * @param[out] st_result_status : Result of the self-test, to outlive the coroutine.
+     *
+     * @return Coroutine of the operation
+     */
+    Procedure co_self_test(uint8_t st_selection, struct bmi3_st_result &st_result_status)
+    {
+        struct bmi3_op op = {};
+
+        return run(bmi3_op_self_test(st_selection, &st_result_status, &op), op);
+    }
+
+    /*!
+     * @brief Gyro self-calibration as coroutine, see bmi3_op_gyro_sc.
+     *
+     * @param[in]  sc_selection : Self-calibration selection.
+     * @param[in]  apply_corr   : Apply the correction: BMI3_ENABLE or BMI3_DISABLE.
+     * @param[out] sc_rslt      : Result of the self-calibration, to outlive the coroutine.
+     *
+     * @return Coroutine of the operation
+     */
+    Procedure co_gyro_sc(uint8_t sc_selection, uint8_t apply_corr, struct bmi3_self_calib_rslt &sc_rslt)
+    {
+        struct bmi3_op op = {};
+
+        return run(bmi3_op_gyro_sc(sc_selection, apply_corr, &sc_rslt, &op), op);
+    }
+
+    /*!
+     * @brief Config array upload as coroutine, see bmi3_op_upload_config_array.
+     *
+     * @param[in] config_array : Config array, to outlive the coroutine.
+     * @param[in] config_size  : Size of the config array.
+     *
+     * @return Coroutine of the operation
+     */
+    Procedure co_upload_config_array(const uint8_t *config_array, uint16_t config_size)
+    {
+        struct bmi3_op op = {};
+
+        return run(bmi3_op_upload_config_array(config_array, config_size, &op), op);
+    }
+
+    /*!
+     * @brief Accel FOC as coroutine, see bmi3_op_accel_foc.
+     *
+     * @param[in] accel_g_value : Accel axis and sign of the gravity, to outlive the coroutine.
+     *
+     * @return Coroutine of the operation
+     */
+    Procedure co_accel_foc(const struct bmi3_accel_foc_g_value &accel_g_value)
+    {
+        struct bmi3_op op = {};
+
+        return run(bmi3_op_accel_foc(&accel_g_value, &op), op);
+    }
+
+#endif
+
+private:
+    /*! Transport of the bus */
+    Transport &transport_;
+
+    /*! Device structure of the C API */
+    struct bmi3_dev dev_;
+
+    /*! Inserts the idle time if the previous access of the C API was a write */
+    void insert_idle_time()
+    {
+        if (dev_.idle_pending == BMI3_ENABLE)
+        {
+            if (dev_.idle_due_us != 0)
+            {
+                transport_.delay_us(dev_.idle_due_us);
+            }
+
+            dev_.idle_pending = BMI3_DISABLE;
+        }
+    }
+
+    /*! Sensor time of the register data */
+    static uint32_t get_sensor_time(const uint8_t *reg_data)
+    {
+        return get_word(&reg_data[14]) | ((uint32_t)get_word(&reg_data[16]) << 16);
+    }
+
+    /*! Read function of the C API */
+    static BMI3_INTF_RET_TYPE read_regs(uint8_t reg_addr, uint8_t *reg_data, uint32_t length, void *intf_ptr)
+    {
+        return static_cast<Transport *>(intf_ptr)->read(reg_addr, reg_data, length);
+    }
+
+    /*! Write function of the C API */
+    static BMI3_INTF_RET_TYPE write_regs(uint8_t reg_addr, const uint8_t *reg_data, uint32_t length, void *intf_ptr)
+    {
+        return static_cast<Transport *>(intf_ptr)->write(reg_addr, reg_data, length);
+    }
+
+    /*! Delay function of the C API */
+    static void delay(uint32_t period, void *intf_ptr)
+    {
+        static_cast<Transport *>(intf_ptr)->delay_us(period);
+    }
+
+#ifdef BMI3_HPP_COROUTINE
+
+    /*! Runs the steps of a prepared operation, suspending after each step */
+    Procedure run(int8_t rslt, struct bmi3_op op)
+    {
+        if (rslt == BMI3_OK)
+        {
+            do
+            {
+                rslt = bmi3_op_step(&op, &dev_);
+
+                if (rslt == BMI3_W_OP_PENDING)
+                {
+                    co_yield op.wait_us;
+                }
+            } while (rslt == BMI3_W_OP_PENDING);
+        }
+
+        co_return rslt;
+    }
+
+#endif
+};
+
+} /* namespace bmi3 */
+
+#endif /* _BMI3_HPP */
@@ -41,6 +41,9 @@
 /*!  @name          Header Files                                  */
 /******************************************************************************/
 
+/*! The hot-path APIs are defined as functions here, see BMI3_INLINE_FORWARDERS */
+#define BMI323_SOURCE
+
 #include "bmi323.h"
 #ifdef __KERNEL__
 #include <linux/types.h>
@@ -54,31 +57,48 @@
 /*!              Static Variable
  ****************************************************************************/
 
-/*! Any-motion context parameter set for smart phone, wearable and hearable */
-static uint16_t any_motion_param_set[BMI323_PARAM_LIMIT_CONTEXT][BMI323_PARAM_LIMIT_ANY_MOT] =
-{ { 8, 1, 5, 250, 5 }, { 8, 1, 5, 250, 5 }, { 8, 1, 6, 250, 5 } };
-
-/*! No-motion context parameter set for smart phone, wearable and hearable */
-static uint16_t no_motion_param_set[BMI323_PARAM_LIMIT_CONTEXT][BMI323_PARAM_LIMIT_NO_MOT] =
-{ { 30, 1, 5, 250, 5 }, { 30, 1, 3, 250, 5 }, { 10, 1, 3, 250, 5 } };
-
-/*! Tap context parameter set for smart phone, wearable and hearable */
-static uint16_t tap_param_set[BMI323_PARAM_LIMIT_CONTEXT][BMI323_PARAM_LIMIT_WAKEUP] =
-{ { 2, 1, 6, 1, 143, 25, 4, 6, 8, 6 }, { 2, 1, 6, 2, 250, 25, 4, 6, 8, 6 }, { 2, 1, 6, 1, 750, 25, 4, 6, 8, 6 } };
-
-/*! Step counter context parameter set for smart phone, wearable and hearable */
-static uint16_t step_counter_param_set[BMI323_PARAM_LIMIT_CONTEXT][BMI323_PARAM_LIMIT_STEP_COUNT] =
-{ { 0, 0, 306, 61900, 132, 55608, 60104, 64852, 7, 1, 256, 12, 12, 3, 3900, 74, 160, 0, 0, 0, 0, 0 },
-  { 0, 0, 307, 61932, 80, 55706, 63102, 58982, 4, 1, 256, 15, 14, 3, 3900, 150, 160, 1, 3, 1, 10, 3 },
-  { 0, 0, 307, 61932, 133, 55706, 62260, 58982, 7, 1, 256, 13, 12, 3, 3900, 74, 160, 1, 3, 1, 8, 2 } };
-
-/*! Sig-motion context parameter set for smart phone, wearable and hearable */
-static uint16_t sig_motion_param_set[BMI323_PARAM_LIMIT_CONTEXT][BMI323_PARAM_LIMIT_SIG_MOT] =
-{ { 250, 60, 11, 595, 17 }, { 250, 150, 8, 595, 17 }, { 250, 38, 8, 400, 17 } };
-
-/*! Orientation context parameter set for smart phone, wearable and hearable */
-static uint16_t orientation_param_set[BMI323_PARAM_LIMIT_CONTEXT][BMI323_PARAM_LIMIT_ORIENT] =
-{ { 0, 0, 3, 38, 10, 50, 32 }, { 0, 0, 3, 38, 10, 50, 32 }, { 0, 0, 3, 38, 10, 50, 32 } };
+/*!
+ * Feature engine images of the smart phone, wearable and hearable contexts, as encoded by
+ * "bmi323_get_feature_image". The images are constant, so that devices switching context
+ * concurrently share no state. They are encoded from the following parameter sets, given for
+ * smart phone, wearable and hearable in the order of the members of the feature configuration:
+ *
+ * any_motion   : { 8, 1, 5, 250, 5 }, { 8, 1, 5, 250, 5 }, { 8, 1, 6, 250, 5 }
+ * no_motion    : { 30, 1, 5, 250, 5 }, { 30, 1, 3, 250, 5 }, { 10, 1, 3, 250, 5 }
+ * tap          : { 2, 1, 6, 1, 143, 25, 4, 6, 8, 6 }, { 2, 1, 6, 2, 250, 25, 4, 6, 8, 6 },
+ *                { 2, 1, 6, 1, 750, 25, 4, 6, 8, 6 }
+ * step_counter : { 0, 0, 306, 61900, 132, 55608, 60104, 64852, 7, 1, 256, 12, 12, 3, 3900, 74, 160, 0, 0, 0, 0, 0 },
+ *                { 0, 0, 307, 61932, 80, 55706, 63102, 58982, 4, 1, 256, 15, 14, 3, 3900, 150, 160, 1, 3, 1, 10, 3 },
+ *                { 0, 0, 307, 61932, 133, 55706, 62260, 58982, 7, 1, 256, 13, 12, 3, 3900, 74, 160, 1, 3, 1, 8, 2 }
+ * sig_motion   : { 250, 60, 11, 595, 17 }, { 250, 150, 8, 595, 17 }, { 250, 38, 8, 400, 17 }
+ * orientation  : { 0, 0, 3, 38, 10, 50, 32 } for all contexts
+ */
+static const struct bmi3_feature_batch context_image[BMI323_SEL_MAX] = {
+    /* smart phone */
+    { { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x10,
+        0x05, 0x00, 0xfa, 0xa0, 0x1e, 0x10, 0x05, 0x00, 0xfa, 0xa0, 0x00, 0x00,
+        0x00, 0x00, 0xfa, 0x00, 0x3c, 0x2c, 0x53, 0x46, 0x00, 0x00, 0x32, 0x01,
+        0xcc, 0xf1, 0x84, 0x00, 0x38, 0xd9, 0xc8, 0xea, 0x54, 0xfd, 0x17, 0x20,
+        0x0c, 0x0c, 0xc3, 0xf3, 0x4a, 0xa0, 0x00, 0x00, 0xd8, 0x54, 0x32, 0x20,
+        0x76, 0x00, 0x8f, 0x64, 0x64, 0x68, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+      UINT64_C(0x00000001FFFFE7E0) },
+    /* wearable */
+    { { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x10,
+        0x05, 0x00, 0xfa, 0xa0, 0x1e, 0x10, 0x03, 0x00, 0xfa, 0xa0, 0x00, 0x00,
+        0x00, 0x00, 0xfa, 0x00, 0x96, 0x20, 0x53, 0x46, 0x00, 0x00, 0x33, 0x01,
+        0xec, 0xf1, 0x50, 0x00, 0x9a, 0xd9, 0x7e, 0xf6, 0x66, 0xe6, 0x14, 0x20,
+        0x0f, 0x0e, 0xc3, 0xf3, 0x96, 0xa0, 0x57, 0x01, 0xd8, 0x54, 0x32, 0x20,
+        0xb6, 0x00, 0xfa, 0x64, 0x64, 0x68, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+      UINT64_C(0x00000001FFFFE7E0) },
+    /* hearable */
+    { { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x10,
+        0x06, 0x00, 0xfa, 0xa0, 0x0a, 0x10, 0x03, 0x00, 0xfa, 0xa0, 0x00, 0x00,
+        0x00, 0x00, 0xfa, 0x00, 0x26, 0x20, 0x90, 0x45, 0x00, 0x00, 0x33, 0x01,
+        0xec, 0xf1, 0x85, 0x00, 0x9a, 0xd9, 0x34, 0xf3, 0x66, 0xe6, 0x17, 0x20,
+        0x0d, 0x0c, 0xc3, 0xf3, 0x4a, 0xa0, 0x17, 0x01, 0xd8, 0x54, 0x32, 0x20,
+        0x76, 0x00, 0xee, 0x66, 0x64, 0x68, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+      UINT64_C(0x00000001FFFFE7E0) }
+};
 
 /******************************************************************************/
 
@@ -99,6 +119,42 @@ static uint16_t orientation_param_set[BMI323_PARAM_LIMIT_CONTEXT][BMI323_PARAM_L
  */
 static int8_t null_ptr_check(const struct bmi3_dev *dev);
 
+/*!
+ * @brief This internal API checks that the accel configuration suits the
+ * features of the contexts: in low-power mode, tap detection requires an ODR
+ * of at least 200Hz.
+ *
+ * @param[in] dev : Structure instance of bmi3_dev.
+ *
+ * @return Result of API execution status
+ *
+ * @return 0 -> Success
+ * @return < 0 -> Fail
+ *
+ */
+static int8_t check_context_accel_config(struct bmi3_dev *dev);
+
+/*!
+ * @brief This internal API selects the wearable context, as set by bmi323_init.
+ *
+ * @param[in,out] dev : Structure instance of bmi3_dev.
+ *
+ * @return Result of API execution status
+ *
+ * @return 0 -> Success
+ * @return < 0 -> Fail
+ *
+ */
+static int8_t wearable_context_setup(struct bmi3_dev *dev);
+
+/*! Variant of bmi323, for bmi3_probe_and_init */
+const struct bmi3_variant bmi323_variant = {
+    .chip_id = BMI323_CHIP_ID,
+    .resolution = BMI323_16_BIT_RESOLUTION,
+    .gyro_sc_st_coeff = BMI3_DISABLE,
+    .setup = wearable_context_setup
+};
+
 /******************************************************************************/
 /*!  @name      User Interface Definitions                            */
 /******************************************************************************/
@@ -112,31 +168,16 @@ int8_t bmi323_init(struct bmi3_dev *dev)
     /* Variable to define error */
     int8_t rslt;
 
+    /* The only variant supported by this API */
+    const struct bmi3_variant *const variants[1] = { &bmi323_variant };
+
     /* Null-pointer check */
     rslt = null_ptr_check(dev);
 
     if (rslt == BMI323_OK)
     {
-        rslt = bmi3_init(dev);
-    }
-
-    if (rslt == BMI323_OK)
-    {
-        /* Validate chip-id */
-        if (dev->chip_id == BMI323_CHIP_ID)
-        {
-            /* Assign resolution to the structure */
-            dev->resolution = BMI323_16_BIT_RESOLUTION;
-        }
-        else
-        {
-            rslt = BMI323_E_DEV_NOT_FOUND;
-        }
-    }
-
-    if (rslt == BMI323_OK)
-    {
-        rslt = bmi323_context_switch_selection(BMI323_WEARABLE_SEL, dev);
+        /* Validate chip-id, then set up the sensor as the variant */
+        rslt = bmi3_probe_and_init(variants, 1, dev);
     }
 
     return rslt;
@@ -150,825 +191,2978 @@ int8_t bmi323_init(struct bmi3_dev *dev)
  * exception of a few special registers, which trap the address. For e.g.,
  * Register address - 0x03.
  */
-int8_t bmi323_get_regs(uint8_t reg_addr, uint8_t *data, uint16_t len, struct bmi3_dev *dev)
+int8_t bmi323_get_regs(uint8_t reg_addr, uint8_t *data, uint16_t len, struct bmi3_dev *dev)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    rslt = bmi3_get_regs(reg_addr, data, len, dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API reads the data from the given register address of the sensor
+ * directly into the buffer of the user, along with the dummy bytes.
+ */
+int8_t bmi323_get_regs_direct(uint8_t reg_addr, uint8_t *data, uint16_t len, struct bmi3_dev *dev)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    rslt = bmi3_get_regs_direct(reg_addr, data, len, dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API writes data to the given register address of bmi323 sensor.
+ */
+int8_t bmi323_set_regs(uint8_t reg_addr, const uint8_t *data, uint16_t len, struct bmi3_dev *dev)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    rslt = bmi3_set_regs(reg_addr, data, len, dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API resets bmi323 sensor. All registers are overwritten with
+ * their default values.
+ */
+int8_t bmi323_soft_reset(struct bmi3_dev *dev)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    rslt = bmi3_soft_reset(dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API writes the available sensor specific commands to the sensor.
+ */
+int8_t bmi323_set_command_register(uint16_t command, struct bmi3_dev *dev)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    /* Set the command in the command register */
+    rslt = bmi3_set_command_register(command, dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API gets the interrupt 1 status of both feature and data
+ * interrupts
+ */
+int8_t bmi323_get_int1_status(uint16_t *int_status, struct bmi3_dev *dev)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    /* Get the interrupt status */
+    rslt = bmi3_get_int1_status(int_status, dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API gets the interrupt 2 status of both feature and data
+ * interrupts
+ */
+int8_t bmi323_get_int2_status(uint16_t *int_status, struct bmi3_dev *dev)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    /* Get the interrupt status */
+    rslt = bmi3_get_int2_status(int_status, dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API initializes the interrupt dispatcher with no callback registered.
+ */
+int8_t bmi323_int_dispatch_init(uint8_t sources, void *ctx, struct bmi3_int_dispatcher *disp)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    rslt = bmi3_int_dispatch_init(sources, ctx, disp);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API registers a callback for one or more interrupt status bits.
+ */
+int8_t bmi323_int_dispatch_register(uint16_t int_status,
+                                    bmi3_int_event_fptr_t callback,
+                                    struct bmi3_int_dispatcher *disp)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    rslt = bmi3_int_dispatch_register(int_status, callback, disp);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API reads the interrupt status and payloads, then calls the registered callbacks.
+ */
+int8_t bmi323_int_dispatch(struct bmi3_int_dispatcher *disp, struct bmi3_dev *dev)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    rslt = bmi3_int_dispatch(disp, dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API dispatches an I3C in-band interrupt with the IBI status of its payload.
+ */
+int8_t bmi323_int_dispatch_ibi(uint16_t ibi_status, struct bmi3_int_dispatcher *disp, struct bmi3_dev *dev)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    rslt = bmi3_int_dispatch_ibi(ibi_status, disp, dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API maps the interrupt sources to the data and event pins of a route.
+ */
+int8_t bmi323_set_int_route(const struct bmi3_int_route *route, struct bmi3_dev *dev)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    rslt = bmi3_set_int_route(route, dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API initializes the dispatcher of the event pin of a route.
+ */
+int8_t bmi323_int_route_dispatch_init(const struct bmi3_int_route *route,
+                                      void *ctx,
+                                      struct bmi3_int_dispatcher *disp)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    rslt = bmi3_int_route_dispatch_init(route, ctx, disp);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API services the data pin of a route.
+ */
+int8_t bmi323_int_route_service_data(const struct bmi3_int_route *route,
+                                     uint16_t *int_status,
+                                     struct bmi3_fifo_frame *fifo,
+                                     struct bmi3_dev *dev)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    rslt = bmi3_int_route_service_data(route, int_status, fifo, dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API gets the re-mapped x, y and z axes from the sensor and
+ * updates the values in the device structure.
+ *
+ * @note: XYZ axis denotes x = x, y = y, z = z
+ * Similarly,
+ *    YXZ, x = y, y = x, z = z
+ *
+ */
+int8_t bmi323_get_remap_axes(struct bmi3_axes_remap *remapped_axis, struct bmi3_dev *dev)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    /* Get remapped axes */
+    rslt = bmi3_get_remap_axes(remapped_axis, dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API sets the re-mapped x, y and z axes to the sensor and
+ * updates them in the device structure.
+ */
+int8_t bmi323_set_remap_axes(const struct bmi3_axes_remap remapped_axis, struct bmi3_dev *dev)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    /* Set remapped axes */
+    rslt = bmi3_set_remap_axes(remapped_axis, dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API stages an axis remap.
+ */
+int8_t bmi323_prepare_remap_axes(const struct bmi3_axes_remap *remapped_axis, struct bmi3_remap_stage *stage)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    rslt = bmi3_prepare_remap_axes(remapped_axis, stage);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API applies a staged axis remap with the least disturbance of the accel.
+ */
+int8_t bmi323_apply_remap_axes(const struct bmi3_remap_stage *stage, struct bmi3_dev *dev)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    rslt = bmi3_apply_remap_axes(stage, dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API sets the sensor/feature configuration.
+ */
+int8_t bmi323_set_sensor_config(struct bmi3_sens_config *sens_cfg, uint8_t n_sens, struct bmi3_dev *dev)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    rslt = bmi3_set_sensor_config(sens_cfg, n_sens, dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API gets the sensor/feature configuration.
+ */
+int8_t bmi323_get_sensor_config(struct bmi3_sens_config *sens_cfg, uint8_t n_sens, struct bmi3_dev *dev)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    rslt = bmi3_get_sensor_config(sens_cfg, n_sens, dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API encodes the feature configurations into a feature engine image.
+ */
+int8_t bmi323_get_feature_image(const struct bmi3_sens_config *sens_cfg,
+                                uint8_t n_sens,
+                                struct bmi3_feature_batch *image)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    rslt = bmi3_get_feature_image(sens_cfg, n_sens, image);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API writes a feature engine image, only the words which differ
+ * with the image written before.
+ */
+int8_t bmi323_set_feature_image(const struct bmi3_feature_batch *image, struct bmi3_dev *dev)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    rslt = bmi3_set_feature_image(image, dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API reads the configurations of all features into a feature engine image.
+ */
+int8_t bmi323_read_feature_image(struct bmi3_feature_batch *image, struct bmi3_dev *dev)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    rslt = bmi3_read_feature_image(image, dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API decodes the feature configurations from a feature engine image.
+ */
+int8_t bmi323_decode_feature_image(const struct bmi3_feature_batch *image,
+                                   struct bmi3_sens_config *sens_cfg,
+                                   uint8_t n_sens)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    rslt = bmi3_decode_feature_image(image, sens_cfg, n_sens);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API maps/un-maps data interrupts to that of interrupt pins.
+ */
+int8_t bmi323_map_interrupt(struct bmi3_map_int map_int, struct bmi3_dev *dev)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    /* Read map interrupt data */
+    rslt = bmi3_map_interrupt(map_int, dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API selects the sensors/features to be enabled or disabled.
+ */
+int8_t bmi323_select_sensor(struct bmi3_feature_enable *enable, struct bmi3_dev *dev)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    rslt = bmi3_select_sensor(enable, dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API gets the sensor/feature data for accelerometer, gyroscope,
+ * step counter, high-g, gyroscope user-gain update,
+ * orientation, gyroscope cross sensitivity and error status for NVM and VFRM.
+ */
+int8_t bmi323_get_sensor_data(struct bmi3_sensor_data *sensor_data, uint8_t n_sens, struct bmi3_dev *dev)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    rslt = bmi3_get_sensor_data(sensor_data, n_sens, dev);
+
+    return rslt;
+}
+
+/*!
+ *  @brief This API reads the error status from the sensor.
+ */
+int8_t bmi323_get_error_status(struct bmi3_err_reg *err_reg, struct bmi3_dev *dev)
+{
+    /* Variable to hold execution status */
+    int8_t rslt;
+
+    rslt = bmi3_get_error_status(err_reg, dev);
+
+    return rslt;
+}
+
+/*!
+ *  @brief This API reads the feature engine error status from the sensor.
+ */
+int8_t bmi323_get_feature_engine_error_status(uint8_t *feature_engine_err_reg_lsb,
+                                              uint8_t *feature_engine_err_reg_msb,
+                                              struct bmi3_dev *dev)
+{
+    /* Variable to hold execution status */
+    int8_t rslt;
+
+    /* Read the feature engine error codes */
+    rslt = bmi3_get_feature_engine_error_status(feature_engine_err_reg_lsb, feature_engine_err_reg_msb, dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API sets:
+ *        1) The input output configuration of the selected interrupt pin:
+ *           INT1 or INT2.
+ *        2) The interrupt mode: permanently latched or non-latched.
+ */
+int8_t bmi323_set_int_pin_config(const struct bmi3_int_pin_config *int_cfg, struct bmi3_dev *dev)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    rslt = bmi3_set_int_pin_config(int_cfg, dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API gets:
+ *        1) The input output configuration of the selected interrupt pin:
+ *           INT1 or INT2.
+ *        2) The interrupt mode: permanently latched or non-latched.
+ */
+int8_t bmi323_get_int_pin_config(struct bmi3_int_pin_config *int_cfg, struct bmi3_dev *dev)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    rslt = bmi3_get_int_pin_config(int_cfg, dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API is used to get the sensor time.
+ */
+int8_t bmi323_get_sensor_time(uint32_t *sensor_time, struct bmi3_dev *dev)
+{
+    int8_t rslt;
+
+    rslt = bmi3_get_sensor_time(sensor_time, dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API reads the FIFO data.
+ */
+int8_t bmi323_read_fifo_data(struct bmi3_fifo_frame *fifo, struct bmi3_dev *dev)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    rslt = bmi3_read_fifo_data(fifo, dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API parses and extracts the accelerometer frames from FIFO data
+ * read by the "bmi323_read_fifo_data" API and stores it in the "accel_data"
+ * structure instance.
+ */
+int8_t bmi323_extract_accel(struct bmi3_fifo_sens_axes_data *accel_data,
+                            struct bmi3_fifo_frame *fifo,
+                            const struct bmi3_dev *dev)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    rslt = bmi3_extract_accel(accel_data, fifo, dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API parses and extracts the temperature frames from FIFO data
+ * read by the "bmi323_read_fifo_data" API and stores it in the "temp_data"
+ * structure instance.
+ */
+int8_t bmi323_extract_temperature(struct bmi3_fifo_temperature_data *temp_data,
+                                  struct bmi3_fifo_frame *fifo,
+                                  const struct bmi3_dev *dev)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    rslt = bmi3_extract_temperature(temp_data, fifo, dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API parses and extracts the gyro frames from FIFO data
+ * read by the "bmi323_read_fifo_data" API and stores it in the "gyro_data"
+ * structure instance.
+ */
+int8_t bmi323_extract_gyro(struct bmi3_fifo_sens_axes_data *gyro_data,
+                           struct bmi3_fifo_frame *fifo,
+                           const struct bmi3_dev *dev)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    rslt = bmi3_extract_gyro(gyro_data, fifo, dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API parses and extracts the accelerometer, gyro and temperature
+ * frames from FIFO data read by the "bmi323_read_fifo_data" API in a single pass
+ * and stores them in the "accel_data", "gyro_data" and "temp_data" structure
+ * instances.
+ */
+int8_t bmi323_extract_all(struct bmi3_fifo_sens_axes_data *accel_data,
+                          struct bmi3_fifo_sens_axes_data *gyro_data,
+                          struct bmi3_fifo_temperature_data *temp_data,
+                          struct bmi3_fifo_frame *fifo,
+                          const struct bmi3_dev *dev)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    rslt = bmi3_extract_all(accel_data, gyro_data, temp_data, fifo, dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API parses and extracts the accelerometer, gyro and temperature
+ * frames [first_frame, end_frame) of FIFO data read by the "bmi323_read_fifo_data"
+ * API, without modifying the FIFO frame.
+ */
+int8_t bmi323_extract_range(struct bmi3_fifo_sens_axes_data *accel_data,
+                            struct bmi3_fifo_sens_axes_data *gyro_data,
+                            struct bmi3_fifo_temperature_data *temp_data,
+                            uint16_t first_frame,
+                            uint16_t end_frame,
+                            struct bmi3_fifo_census *count,
+                            const struct bmi3_fifo_frame *fifo,
+                            const struct bmi3_dev *dev)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    rslt = bmi3_extract_range(accel_data, gyro_data, temp_data, first_frame, end_frame, count, fifo, dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API parses and extracts the accelerometer and gyro frames of FIFO
+ * data read by the "bmi323_read_fifo_data" API at their native rates.
+ */
+int8_t bmi323_extract_multi_rate(struct bmi3_fifo_multi_rate *multi_rate,
+                                 struct bmi3_fifo_time *fifo_time,
+                                 const struct bmi3_fifo_frame *fifo,
+                                 const struct bmi3_dev *dev)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    rslt = bmi3_extract_multi_rate(multi_rate, fifo_time, fifo, dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API parses and extracts the accelerometer and gyro frames of FIFO
+ * data read by the "bmi323_read_fifo_data" API into joined 6-DoF samples.
+ */
+int8_t bmi323_extract_6dof(struct bmi3_fifo_6dof_data *data,
+                           struct bmi3_fifo_frame *fifo,
+                           const struct bmi3_dev *dev)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    rslt = bmi3_extract_6dof(data, fifo, dev);
+
+    return rslt;
+}
+
+#ifdef BMI3_SHOCK_DETECT
+
+/*!
+ * @brief This API detects shocks in the accelerometer frames of FIFO data read
+ * by the "bmi323_read_fifo_data" API, without extracting the frames.
+ */
+int8_t bmi323_detect_shock(const struct bmi3_shock_config *config,
+                           struct bmi3_shock_event *events,
+                           uint8_t *n_events,
+                           const struct bmi3_fifo_frame *fifo,
+                           const struct bmi3_dev *dev)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    rslt = bmi3_detect_shock(config, events, n_events, fifo, dev);
+
+    return rslt;
+}
+#endif
+
+/*!
+ * @brief This API parses and extracts the accelerometer frames from FIFO data
+ * read by the "bmi323_read_fifo_data" API and stores them in separate x, y, z and
+ * sensor time arrays of the "accel_planes" structure instance.
+ */
+int8_t bmi323_extract_accel_planes(const struct bmi3_fifo_sens_axes_planes *accel_planes,
+                                   struct bmi3_fifo_frame *fifo,
+                                   const struct bmi3_dev *dev)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    rslt = bmi3_extract_accel_planes(accel_planes, fifo, dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API parses and extracts the gyro frames from FIFO data
+ * read by the "bmi323_read_fifo_data" API and stores them in separate x, y, z and
+ * sensor time arrays of the "gyro_planes" structure instance.
+ */
+int8_t bmi323_extract_gyro_planes(const struct bmi3_fifo_sens_axes_planes *gyro_planes,
+                                  struct bmi3_fifo_frame *fifo,
+                                  const struct bmi3_dev *dev)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    rslt = bmi3_extract_gyro_planes(gyro_planes, fifo, dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API counts the accelerometer, gyro and temperature frames of the
+ * FIFO data from the FIFO length and frame layout, without parsing the data.
+ */
+int8_t bmi323_fifo_census(struct bmi3_fifo_census *census,
+                          uint8_t count_dummy,
+                          const struct bmi3_fifo_frame *fifo,
+                          const struct bmi3_dev *dev)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    rslt = bmi3_fifo_census(census, count_dummy, fifo, dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API sets the FIFO water-mark level in words.
+ */
+int8_t bmi323_set_fifo_wm(uint16_t fifo_wm, struct bmi3_dev *dev)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    rslt = bmi3_set_fifo_wm(fifo_wm, dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API reads the FIFO water-mark level in words.
+ */
+int8_t bmi323_get_fifo_wm(uint16_t *fifo_wm, struct bmi3_dev *dev)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    rslt = bmi3_get_fifo_wm(fifo_wm, dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API sets the FIFO configuration in the sensor.
+ */
+int8_t bmi323_set_fifo_config(uint16_t config, uint8_t enable, struct bmi3_dev *dev)
+{
+    int8_t rslt;
+
+    rslt = bmi3_set_fifo_config(config, enable, dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API reads the FIFO configuration from the sensor.
+ */
+int8_t bmi323_get_fifo_config(uint16_t *fifo_config, struct bmi3_dev *dev)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    rslt = bmi3_get_fifo_config(fifo_config, dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API gets the length of FIFO data available in the sensor in
+ * words.
+ */
+int8_t bmi323_get_fifo_length(uint16_t *fifo_avail_len, struct bmi3_dev *dev)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    rslt = bmi3_get_fifo_length(fifo_avail_len, dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API writes the configurations of context feature for smart phone, wearables and hearables.
+ */
+int8_t bmi323_context_switch_selection(uint8_t context_sel, struct bmi3_dev *dev)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    /* Null-pointer check */
+    rslt = null_ptr_check(dev);
+
+    if ((rslt == BMI323_OK) && (context_sel < BMI323_SEL_MAX))
+    {
+        rslt = check_context_accel_config(dev);
+
+        /* Set the context configurations, only the words which differ with the current context */
+        if (rslt == BMI323_OK)
+        {
+            rslt = bmi323_set_feature_image(&context_image[context_sel], dev);
+        }
+    }
+    else if (rslt == BMI323_OK)
+    {
+        rslt = BMI323_E_INVALID_CONTEXT_SEL;
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This API is used to perform the self-test for either accel or gyro or both.
+ */
+int8_t bmi323_perform_self_test(uint8_t st_selection, struct bmi3_st_result *st_result_status, struct bmi3_dev *dev)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    rslt = bmi3_perform_self_test(st_selection, st_result_status, dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API prepares the self-test and triggers it without waiting
+ * for the result.
+ */
+int8_t bmi323_self_test_start(uint8_t st_selection, struct bmi3_st_ctx *st_ctx, struct bmi3_dev *dev)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    rslt = bmi3_self_test_start(st_selection, st_ctx, dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API reads the self-test status once.
+ */
+int8_t bmi323_self_test_poll(struct bmi3_st_ctx *st_ctx, struct bmi3_dev *dev)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    rslt = bmi3_self_test_poll(st_ctx, dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API reads the self-test result and restores the accel
+ * configuration.
+ */
+int8_t bmi323_self_test_finish(struct bmi3_st_ctx *st_ctx,
+                               struct bmi3_st_result *st_result_status,
+                               struct bmi3_dev *dev)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    rslt = bmi3_self_test_finish(st_ctx, st_result_status, dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API writes the config array and config version in cfg res.
+ */
+int8_t bmi323_configure_enhanced_flexibility(struct bmi3_dev *dev)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    rslt = bmi3_configure_enhanced_flexibility(dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API is used to get the config version.
+ */
+int8_t bmi323_get_config_version(struct bmi3_config_version *config_version, struct bmi3_dev *dev)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    rslt = bmi3_get_config_version(config_version, dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API is used to perform the self-calibration for either sensitivity or offset or both.
+ */
+int8_t bmi323_perform_gyro_sc(uint8_t sc_selection,
+                              uint8_t apply_corr,
+                              struct bmi3_self_calib_rslt *sc_rslt,
+                              struct bmi3_dev *dev)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    rslt = bmi3_perform_gyro_sc(sc_selection, apply_corr, sc_rslt, dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API prepares the gyro self-calibration and triggers it
+ * without waiting for the result.
+ */
+int8_t bmi323_gyro_sc_start(uint8_t sc_selection,
+                            uint8_t apply_corr,
+                            struct bmi3_sc_ctx *sc_ctx,
+                            struct bmi3_dev *dev)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    rslt = bmi3_gyro_sc_start(sc_selection, apply_corr, sc_ctx, dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API reads the gyro self-calibration status once.
+ */
+int8_t bmi323_gyro_sc_poll(struct bmi3_sc_ctx *sc_ctx, struct bmi3_dev *dev)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    rslt = bmi3_gyro_sc_poll(sc_ctx, dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API reads the gyro self-calibration result and restores the
+ * accel configuration.
+ */
+int8_t bmi323_gyro_sc_finish(struct bmi3_sc_ctx *sc_ctx, struct bmi3_self_calib_rslt *sc_rslt, struct bmi3_dev *dev)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    rslt = bmi3_gyro_sc_finish(sc_ctx, sc_rslt, dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API is used to set the data sample rate for i3c sync
+ */
+int8_t bmi323_set_i3c_tc_sync_tph(uint16_t sample_rate, struct bmi3_dev *dev)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    rslt = bmi3_set_i3c_tc_sync_tph(sample_rate, dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API is used to get the data sample rate for i3c sync
+ */
+int8_t bmi323_get_i3c_tc_sync_tph(uint16_t *sample_rate, struct bmi3_dev *dev)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    rslt = bmi3_get_i3c_tc_sync_tph(sample_rate, dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API is used set the TU(time unit) value is used to scale the delay time payload
+ * according to the hosts needs
+ */
+int8_t bmi323_set_i3c_tc_sync_tu(uint8_t delay_time, struct bmi3_dev *dev)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    rslt = bmi3_set_i3c_tc_sync_tu(delay_time, dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API is used get the TU(time unit) value is used to scale the delay time payload
+ * according to the hosts needs
+ */
+int8_t bmi323_get_i3c_tc_sync_tu(uint8_t *delay_time, struct bmi3_dev *dev)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    rslt = bmi3_get_i3c_tc_sync_tu(delay_time, dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API is used to set the i3c sync ODR.
+ */
+int8_t bmi323_set_i3c_tc_sync_odr(uint8_t odr, struct bmi3_dev *dev)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    rslt = bmi3_set_i3c_tc_sync_odr(odr, dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API is used to get the i3c sync ODR.
+ */
+int8_t bmi323_get_i3c_tc_sync_odr(uint8_t *odr, struct bmi3_dev *dev)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    rslt = bmi3_get_i3c_tc_sync_odr(odr, dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This internal API gets i3c sync i3c_tc_res
+ */
+int8_t bmi323_get_i3c_sync_i3c_tc_res(uint8_t *i3c_tc_res, struct bmi3_dev *dev)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    rslt = bmi3_get_i3c_sync_i3c_tc_res(i3c_tc_res, dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This internal API sets i3c sync i3c_tc_res
+ */
+int8_t bmi323_set_i3c_sync_i3c_tc_res(uint8_t i3c_tc_res, struct bmi3_dev *dev)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    rslt = bmi3_set_i3c_sync_i3c_tc_res(i3c_tc_res, dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API is used to enable accel and gyro for alternate configuration
+ */
+int8_t bmi323_alternate_config_ctrl(uint8_t config_en, uint8_t alt_rst_conf, struct bmi3_dev *dev)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    rslt = bmi3_alternate_config_ctrl(config_en, alt_rst_conf, dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API is used to read the status of alternate configuration
+ */
+int8_t bmi323_read_alternate_status(struct bmi3_alt_status *alt_status, struct bmi3_dev *dev)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    rslt = bmi3_read_alternate_status(alt_status, dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API initializes the health monitor.
+ */
+int8_t bmi323_health_init(uint16_t period, struct bmi3_health *health)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    rslt = bmi3_health_init(period, health);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API takes a health snapshot of the device every "period" calls.
+ */
+int8_t bmi323_health_poll(struct bmi3_health *health, struct bmi3_dev *dev)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    rslt = bmi3_health_poll(health, dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API gets offset dgain for the sensor which stores self-calibrated values for accel.
+ */
+int8_t bmi323_get_acc_dp_off_dgain(struct bmi3_acc_dp_gain_offset *acc_dp_gain_offset, struct bmi3_dev *dev)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    rslt = bmi3_get_acc_dp_off_dgain(acc_dp_gain_offset, dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API gets offset dgain for the sensor which stores self-calibrated values for gyro.
+ */
+int8_t bmi323_get_gyro_dp_off_dgain(struct bmi3_gyr_dp_gain_offset *gyr_dp_gain_offset, struct bmi3_dev *dev)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    rslt = bmi3_get_gyro_dp_off_dgain(gyr_dp_gain_offset, dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API sets offset dgain for the sensor which stores self-calibrated values for accel.
+ */
+int8_t bmi323_set_acc_dp_off_dgain(const struct bmi3_acc_dp_gain_offset *acc_dp_gain_offset, struct bmi3_dev *dev)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    rslt = bmi3_set_acc_dp_off_dgain(acc_dp_gain_offset, dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API sets offset dgain for the sensor which stores self-calibrated values for gyro.
+ */
+int8_t bmi323_set_gyro_dp_off_dgain(const struct bmi3_gyr_dp_gain_offset *gyr_dp_gain_offset, struct bmi3_dev *dev)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    rslt = bmi3_set_gyro_dp_off_dgain(gyr_dp_gain_offset, dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API initializes the online gyro bias tracker.
+ */
+int8_t bmi323_gyro_bias_init(uint8_t range,
+                             uint16_t min_samples,
+                             uint8_t gain_shift,
+                             struct bmi3_gyro_bias *bias,
+                             struct bmi3_dev *dev)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    rslt = bmi3_gyro_bias_init(range, min_samples, gain_shift, bias, dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API feeds the gyro bias tracker with a burst of FIFO samples.
+ */
+int8_t bmi323_gyro_bias_update(uint16_t int_status,
+                               const struct bmi3_fifo_sens_axes_data *gyro_data,
+                               uint16_t n_frames,
+                               struct bmi3_gyro_bias *bias,
+                               struct bmi3_dev *dev)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    rslt = bmi3_gyro_bias_update(int_status, gyro_data, n_frames, bias, dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API initializes the step cadence.
+ */
+int8_t bmi323_step_cadence_init(uint16_t watermark_level, struct bmi3_step_cadence *cadence, struct bmi3_dev *dev)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    rslt = bmi3_step_cadence_init(watermark_level, cadence, dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API updates the step cadence on a step interrupt.
+ */
+int8_t bmi323_step_cadence_update(uint16_t int_status, struct bmi3_step_cadence *cadence, struct bmi3_dev *dev)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    rslt = bmi3_step_cadence_update(int_status, cadence, dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API gets user offset dgain for the sensor which stores self-calibrated values for accel.
+ */
+int8_t bmi323_get_user_acc_off_dgain(struct bmi3_acc_usr_gain_offset *acc_usr_gain_offset, struct bmi3_dev *dev)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    rslt = bmi3_get_user_acc_off_dgain(acc_usr_gain_offset, dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API sets user offset dgain for the sensor which stores self-calibrated values for accel.
+ */
+int8_t bmi323_set_user_acc_off_dgain(const struct bmi3_acc_usr_gain_offset *acc_usr_gain_offset, struct bmi3_dev *dev)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    rslt = bmi3_set_user_acc_off_dgain(acc_usr_gain_offset, dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API performs Fast Offset Compensation for accelerometer.
+ */
+int8_t bmi323_perform_accel_foc(const struct bmi3_accel_foc_g_value *accel_g_value, struct bmi3_dev *dev)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    rslt = bmi3_perform_accel_foc(accel_g_value, dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API prepares a resumable soft-reset.
+ */
+int8_t bmi323_op_soft_reset(struct bmi3_op *op)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    rslt = bmi3_op_soft_reset(op);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API prepares a resumable self-test.
+ */
+int8_t bmi323_op_self_test(uint8_t st_selection, struct bmi3_st_result *st_result_status, struct bmi3_op *op)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    rslt = bmi3_op_self_test(st_selection, st_result_status, op);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API prepares a resumable gyro self-calibration.
+ */
+int8_t bmi323_op_gyro_sc(uint8_t sc_selection,
+                         uint8_t apply_corr,
+                         struct bmi3_self_calib_rslt *sc_rslt,
+                         struct bmi3_op *op)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    rslt = bmi3_op_gyro_sc(sc_selection, apply_corr, sc_rslt, op);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API prepares a resumable upload of a config array.
+ */
+int8_t bmi323_op_upload_config_array(const uint8_t *config_array, uint16_t config_size, struct bmi3_op *op)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    rslt = bmi3_op_upload_config_array(config_array, config_size, op);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API prepares a resumable accel FOC.
+ */
+int8_t bmi323_op_accel_foc(const struct bmi3_accel_foc_g_value *accel_g_value, struct bmi3_op *op)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    rslt = bmi3_op_accel_foc(accel_g_value, op);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API runs the next step of a resumable operation.
+ */
+int8_t bmi323_op_step(struct bmi3_op *op, struct bmi3_dev *dev)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    rslt = bmi3_op_step(op, dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API initializes a calibration line over the devices of a group.
+ */
+int8_t bmi323_calib_line_init(const uint8_t *plan,
+                              uint8_t n_plan,
+                              const struct bmi3_accel_foc_g_value *accel_g_value,
+                              const struct bmi3_dev_group *group,
+                              struct bmi3_calib_line *line)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    rslt = bmi3_calib_line_init(plan, n_plan, accel_g_value, group, line);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API runs the next step of the units of a calibration line.
+ */
+int8_t bmi323_calib_line_step(uint32_t elapsed_us, uint32_t *wait_us, struct bmi3_calib_line *line)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    rslt = bmi3_calib_line_step(elapsed_us, wait_us, line);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API runs a calibration line until the plans of all units are complete.
+ */
+int8_t bmi323_calib_line_run(struct bmi3_calib_line *line)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    rslt = bmi3_calib_line_run(line);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API initializes a bring-up over several devices.
+ */
+int8_t bmi323_bring_up_init(const struct bmi3_variant *const *variants,
+                            uint8_t n_variants,
+                            const struct bmi3_reg_image *image,
+                            struct bmi3_dev * const *dev,
+                            uint8_t n_dev,
+                            struct bmi3_bring_up *bring_up)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    rslt = bmi3_bring_up_init(variants, n_variants, image, dev, n_dev, bring_up);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API runs the next step of the units of a bring-up.
+ */
+int8_t bmi323_bring_up_step(uint32_t elapsed_us, uint32_t *wait_us, struct bmi3_bring_up *bring_up)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    rslt = bmi3_bring_up_step(elapsed_us, wait_us, bring_up);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API runs a bring-up until all units are complete.
+ */
+int8_t bmi323_bring_up_run(struct bmi3_bring_up *bring_up)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    rslt = bmi3_bring_up_run(bring_up);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API performs Fast Offset Compensation for accelerometer from a
+ * single burst of accel-only FIFO data.
+ */
+int8_t bmi323_perform_accel_foc_fifo(const struct bmi3_accel_foc_g_value *accel_g_value,
+                                     const struct bmi3_accel_foc_fifo_cfg *foc_cfg,
+                                     struct bmi3_dev *dev)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    rslt = bmi3_perform_accel_foc_fifo(accel_g_value, foc_cfg, dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API gets the data ready status of power on reset, accelerometer, gyroscope
+ * and temperature.
+ */
+int8_t bmi323_get_sensor_status(uint16_t *status, struct bmi3_dev *dev)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    /* Read the status register */
+    rslt = bmi3_get_sensor_status(status, dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API gets the I3C IBI status of both feature and data
+ * interrupts
+ */
+int8_t bmi323_get_i3c_ibi_status(uint16_t *int_status, struct bmi3_dev *dev)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    rslt = bmi3_get_i3c_ibi_status(int_status, dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API gets accel gyro offset gain reset values.
+ */
+int8_t bmi323_get_acc_gyr_off_gain_reset(uint8_t *acc_off_gain_reset, uint8_t *gyr_off_gain_reset, struct bmi3_dev *dev)
+{
+    /* Variable to store result of API */
+    int8_t rslt;
+
+    rslt = bmi3_get_acc_gyr_off_gain_reset(acc_off_gain_reset, gyr_off_gain_reset, dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API sets accel gyro offset gain reset values.
+ */
+int8_t bmi323_set_acc_gyr_off_gain_reset(uint8_t acc_off_gain_reset, uint8_t gyr_off_gain_reset, struct bmi3_dev *dev)
+{
+    /* Variable to store result of API */
+    int8_t rslt;
+
+    rslt = bmi3_set_acc_gyr_off_gain_reset(acc_off_gain_reset, gyr_off_gain_reset, dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API reads the calibration state of the device into a blob.
+ */
+int8_t bmi323_get_calib_blob(struct bmi3_calib_blob *blob, struct bmi3_dev *dev)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    rslt = bmi3_get_calib_blob(blob, dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API restores the calibration state of the device from a blob.
+ */
+int8_t bmi323_set_calib_blob(const struct bmi3_calib_blob *blob, struct bmi3_dev *dev)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    rslt = bmi3_set_calib_blob(blob, dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API captures the complete configuration of the device.
+ */
+int8_t bmi323_get_config_image(struct bmi3_config_image *image, struct bmi3_dev *dev)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    rslt = bmi3_get_config_image(image, dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API applies a configuration image to the device.
+ */
+int8_t bmi323_set_config_image(const struct bmi3_config_image *image, struct bmi3_dev *dev)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    rslt = bmi3_set_config_image(image, dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API applies only the changes between the current and the target configurations.
+ */
+int8_t bmi323_set_sensor_config_diff(const struct bmi3_sens_config *current,
+                                     struct bmi3_sens_config *target,
+                                     uint8_t n_sens,
+                                     struct bmi3_dev *dev)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    rslt = bmi3_set_sensor_config_diff(current, target, n_sens, dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API writes register values built at compile time.
+ */
+int8_t bmi323_set_reg_image(const struct bmi3_reg_image *image, struct bmi3_dev *dev)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    rslt = bmi3_set_reg_image(image, dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API starts a non-blocking read of the FIFO data.
+ */
+int8_t bmi323_async_read_fifo_data(struct bmi3_fifo_frame *fifo, bmi3_async_done_fptr_t done, struct bmi3_dev *dev)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    rslt = bmi3_async_read_fifo_data(fifo, done, dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API starts a non-blocking read of accelerometer, gyro and
+ * temperature data.
+ */
+int8_t bmi323_async_get_sensor_data(struct bmi3_sensor_data *sensor_data,
+                                    uint8_t n_sens,
+                                    bmi3_async_done_fptr_t done,
+                                    struct bmi3_dev *dev)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    rslt = bmi3_async_get_sensor_data(sensor_data, n_sens, done, dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API starts a non-blocking read of the INT1 and INT2 interrupt
+ * status registers.
+ */
+int8_t bmi323_async_get_int_status(uint16_t *int1_status,
+                                   uint16_t *int2_status,
+                                   bmi3_async_done_fptr_t done,
+                                   struct bmi3_dev *dev)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    rslt = bmi3_async_get_int_status(int1_status, int2_status, done, dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API is called by the platform once the transfer started by the
+ * "read_async" function pointer is complete.
+ */
+int8_t bmi323_async_complete(BMI3_INTF_RET_TYPE intf_rslt, struct bmi3_dev *dev)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    rslt = bmi3_async_complete(intf_rslt, dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API starts a non-blocking service of the FIFO interrupts.
+ */
+int8_t bmi323_async_fifo_service(uint16_t *int1_status,
+                                 uint16_t *int2_status,
+                                 struct bmi3_fifo_frame *fifo,
+                                 bmi3_async_done_fptr_t done,
+                                 struct bmi3_dev *dev)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    rslt = bmi3_async_fifo_service(int1_status, int2_status, fifo, done, dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API invalidates the shadow register cache.
+ */
+int8_t bmi323_invalidate_reg_cache(struct bmi3_dev *dev)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    rslt = bmi3_invalidate_reg_cache(dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API gets a snapshot of the statistics of the retry policy.
+ */
+int8_t bmi323_get_retry_stats(struct bmi3_retry_stats *stats, const struct bmi3_dev *dev)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    rslt = bmi3_get_retry_stats(stats, dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API resets the statistics of the retry policy.
+ */
+int8_t bmi323_reset_retry_stats(struct bmi3_dev *dev)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    rslt = bmi3_reset_retry_stats(dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API initializes the FIFO timestamp reconstruction for the
+ * given ODR and anchors it to the sensor time.
+ */
+int8_t bmi323_fifo_time_init(struct bmi3_fifo_time *fifo_time, uint8_t odr, struct bmi3_dev *dev)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    rslt = bmi3_fifo_time_init(fifo_time, odr, dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API anchors the FIFO timestamp reconstruction to the current
+ * sensor time.
+ */
+int8_t bmi323_fifo_time_anchor(struct bmi3_fifo_time *fifo_time, struct bmi3_dev *dev)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    rslt = bmi3_fifo_time_anchor(fifo_time, dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API reconstructs the unwrapped sensor time of each extracted
+ * FIFO sample.
+ */
+int8_t bmi323_fifo_time_update(struct bmi3_fifo_time *fifo_time,
+                               const struct bmi3_fifo_frame *fifo,
+                               const struct bmi3_fifo_sens_axes_data *data,
+                               uint16_t count,
+                               uint64_t *timestamp)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    rslt = bmi3_fifo_time_update(fifo_time, fifo, data, count, timestamp);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API initializes the accounting of the FIFO frames lost by
+ * overflows.
+ */
+int8_t bmi323_fifo_loss_init(uint8_t odr, uint8_t flush_on_full, struct bmi3_fifo_loss *loss)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    rslt = bmi3_fifo_loss_init(odr, flush_on_full, loss);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API counts the FIFO frames lost in front of each extracted
+ * frame from the discontinuities of the sensor time.
+ */
+int8_t bmi323_fifo_loss_update(const struct bmi3_fifo_sens_axes_data *data,
+                               uint16_t n_frames,
+                               struct bmi3_fifo_loss *loss)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    rslt = bmi3_fifo_loss_update(data, n_frames, loss);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API counts a FIFO full interrupt and, if enabled, flushes the
+ * FIFO to resume the stream at a frame boundary.
+ */
+int8_t bmi323_fifo_loss_service(uint16_t int_status,
+                                struct bmi3_fifo_stream *stream,
+                                struct bmi3_fifo_loss *loss,
+                                struct bmi3_dev *dev)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    rslt = bmi3_fifo_loss_service(int_status, stream, loss, dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API initializes the analysis of the FIFO frame intervals.
+ */
+int8_t bmi323_fifo_jitter_init(uint8_t odr, struct bmi3_fifo_jitter *jitter)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    rslt = bmi3_fifo_jitter_init(odr, jitter);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API adds the FIFO frame intervals to the analysis.
+ */
+int8_t bmi323_fifo_jitter_update(const struct bmi3_fifo_sens_axes_data *data,
+                                 uint16_t n_frames,
+                                 struct bmi3_fifo_jitter *jitter)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    rslt = bmi3_fifo_jitter_update(data, n_frames, jitter);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API derives the effective ODR and jitter from the analysis.
+ */
+int8_t bmi323_fifo_jitter_query(const struct bmi3_fifo_jitter *jitter, struct bmi3_fifo_jitter_report *report)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    rslt = bmi3_fifo_jitter_query(jitter, report);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API initializes the synchronization of the sensor time to a host clock.
+ */
+int8_t bmi323_clock_sync_init(uint32_t max_uncertainty_ns, struct bmi3_clock_sync *cs)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    rslt = bmi3_clock_sync_init(max_uncertainty_ns, cs);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API adds a (sensor time, host time) sample to the synchronization.
+ */
+int8_t bmi323_clock_sync_add(uint32_t sensor_time,
+                             uint64_t host_ns,
+                             uint32_t uncertainty_ns,
+                             struct bmi3_clock_sync *cs)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    rslt = bmi3_clock_sync_add(sensor_time, host_ns, uncertainty_ns, cs);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API reads the sensor time and adds it to the synchronization.
+ */
+int8_t bmi323_clock_sync_capture(bmi3_host_time_ns_fptr_t host_time_ns,
+                                 struct bmi3_clock_sync *cs,
+                                 struct bmi3_dev *dev)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    rslt = bmi3_clock_sync_capture(host_time_ns, cs, dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API converts sensor times into host times.
+ */
+int8_t bmi323_clock_sync_to_host(const uint64_t *sensor_time,
+                                 uint16_t count,
+                                 uint64_t *host_ns,
+                                 const struct bmi3_clock_sync *cs)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    rslt = bmi3_clock_sync_to_host(sensor_time, count, host_ns, cs);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API gets the drift of the synchronization.
+ */
+int8_t bmi323_clock_sync_get_drift(const struct bmi3_clock_sync *cs, int32_t *drift_ppb)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    rslt = bmi3_clock_sync_get_drift(cs, drift_ppb);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API initializes a continuous FIFO stream.
+ */
+int8_t bmi323_fifo_stream_init(struct bmi3_fifo_stream *stream,
+                               uint8_t *buf,
+                               uint16_t size,
+                               uint16_t chunk,
+                               struct bmi3_dev *dev)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    rslt = bmi3_fifo_stream_init(stream, buf, size, chunk, dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API reads a chunk of FIFO data into the stream.
+ */
+int8_t bmi323_fifo_stream_read(struct bmi3_fifo_stream *stream, struct bmi3_dev *dev)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    rslt = bmi3_fifo_stream_read(stream, dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API extracts the complete frames of the stream and keeps the
+ * bytes of an incomplete frame for the next read.
+ */
+int8_t bmi323_fifo_stream_extract(struct bmi3_fifo_sens_axes_data *accel_data,
+                                  struct bmi3_fifo_sens_axes_data *gyro_data,
+                                  struct bmi3_fifo_temperature_data *temp_data,
+                                  struct bmi3_fifo_frame *fifo,
+                                  struct bmi3_fifo_stream *stream,
+                                  const struct bmi3_dev *dev)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    rslt = bmi3_fifo_stream_extract(accel_data, gyro_data, temp_data, fifo, stream, dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API initializes a single-producer, single-consumer queue of FIFO samples.
+ */
+int8_t bmi323_sample_queue_init(struct bmi3_sample_queue *queue,
+                                struct bmi3_fifo_sens_axes_data *slots,
+                                uint16_t num_slots)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    rslt = bmi3_sample_queue_init(queue, slots, num_slots);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API gets the contiguous free slots of the queue for the producer.
+ */
+int8_t bmi323_sample_queue_reserve(struct bmi3_sample_queue *queue,
+                                   struct bmi3_fifo_sens_axes_data **slots,
+                                   uint16_t *count)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    rslt = bmi3_sample_queue_reserve(queue, slots, count);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API marks reserved slots as written, without publishing them.
+ */
+int8_t bmi323_sample_queue_produce(struct bmi3_sample_queue *queue, uint16_t count)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    rslt = bmi3_sample_queue_produce(queue, count);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API publishes all slots written by the producer with one store.
+ */
+int8_t bmi323_sample_queue_commit(struct bmi3_sample_queue *queue)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    rslt = bmi3_sample_queue_commit(queue);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API gets the contiguous published slots of the queue for the consumer.
+ */
+int8_t bmi323_sample_queue_peek(struct bmi3_sample_queue *queue,
+                                const struct bmi3_fifo_sens_axes_data **slots,
+                                uint16_t *count)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    rslt = bmi3_sample_queue_peek(queue, slots, count);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API releases slots read by the consumer to the producer.
+ */
+int8_t bmi323_sample_queue_release(struct bmi3_sample_queue *queue, uint16_t count)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    rslt = bmi3_sample_queue_release(queue, count);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API extracts the FIFO frames straight into the free slots of the
+ * accel and gyro queues and publishes them with one store per queue.
+ */
+int8_t bmi323_sample_queue_push_fifo(struct bmi3_sample_queue *accel_queue,
+                                     struct bmi3_sample_queue *gyro_queue,
+                                     uint16_t *dropped,
+                                     const struct bmi3_fifo_frame *fifo,
+                                     const struct bmi3_dev *dev)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    rslt = bmi3_sample_queue_push_fifo(accel_queue, gyro_queue, dropped, fifo, dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API initializes the latest frames of a FIFO stream.
+ */
+int8_t bmi323_latest_init(uint8_t odr, bmi3_host_time_ns_fptr_t host_time_ns, struct bmi3_latest *latest)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    rslt = bmi3_latest_init(odr, host_time_ns, latest);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API keeps the latest frames of a batch read from FIFO.
+ */
+int8_t bmi323_latest_push(const struct bmi3_fifo_6dof_data *data,
+                          uint16_t n_frames,
+                          struct bmi3_latest *latest,
+                          struct bmi3_dev *dev)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    rslt = bmi3_latest_push(data, n_frames, latest, dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API gives the latest frames of the stream.
+ */
+int8_t bmi323_latest_peek(struct bmi3_fifo_6dof_data *data,
+                          uint8_t *count,
+                          struct bmi3_latest *latest,
+                          struct bmi3_dev *dev)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    rslt = bmi3_latest_peek(data, count, latest, dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API initializes a context which owns all buffers of the FIFO
+ * path, carved out of the arena provided by the user.
+ */
+int8_t bmi323_ctx_init(struct bmi3_ctx *ctx,
+                       uint8_t *arena,
+                       uint32_t arena_size,
+                       uint16_t fifo_words,
+                       uint16_t fifo_config,
+                       struct bmi3_dev *dev)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    rslt = bmi3_ctx_init(ctx, arena, arena_size, fifo_words, fifo_config, dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API reads the available FIFO data into the raw FIFO buffer of the
+ * context and extracts it into the output arrays of the context.
+ */
+int8_t bmi323_ctx_read_fifo(struct bmi3_ctx *ctx)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    rslt = bmi3_ctx_read_fifo(ctx);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API services the FIFO interrupts: it reads the interrupt status
+ * and FIFO fill level in one burst, and the FIFO data if a FIFO watermark or
+ * full interrupt is pending.
+ */
+int8_t bmi323_fifo_service(uint16_t *int1_status,
+                           uint16_t *int2_status,
+                           struct bmi3_fifo_frame *fifo,
+                           struct bmi3_dev *dev)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    rslt = bmi3_fifo_service(int1_status, int2_status, fifo, dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API computes the FIFO water-mark level for the given ODRs,
+ * FIFO frames and host budget.
+ */
+int8_t bmi323_compute_fifo_wm(const struct bmi3_fifo_wm_budget *budget,
+                              uint16_t fifo_sens,
+                              uint8_t acc_odr,
+                              uint8_t gyr_odr,
+                              uint16_t *fifo_wm)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    rslt = bmi3_compute_fifo_wm(budget, fifo_sens, acc_odr, gyr_odr, fifo_wm);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API sets the FIFO water-mark level computed for the current
+ * accel, gyro and FIFO configuration and the given host budget.
+ */
+int8_t bmi323_tune_fifo_wm(const struct bmi3_fifo_wm_budget *budget, struct bmi3_dev *dev)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    rslt = bmi3_tune_fifo_wm(budget, dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API estimates the supply current, host wake-ups and bus activity
+ * of a configuration.
+ */
+int8_t bmi323_estimate_power(const struct bmi3_power_cfg *cfg,
+                             const struct bmi3_current_table *table,
+                             const struct bmi3_bus_model *model,
+                             struct bmi3_power_estimate *estimate)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    rslt = bmi3_estimate_power(cfg, table, model, estimate);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API programs the sensor from the targets of the governor.
+ */
+int8_t bmi323_governor_config(const struct bmi3_governor_target *target,
+                              struct bmi3_governor *gov,
+                              struct bmi3_dev *dev)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    rslt = bmi3_governor_config(target, gov, dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API reads which configuration is active and reports the effective sample rate.
+ */
+int8_t bmi323_governor_update(struct bmi3_governor *gov, struct bmi3_fifo_time *fifo_time, struct bmi3_dev *dev)
 {
     /* Variable to define error */
     int8_t rslt;
 
-    rslt = bmi3_get_regs(reg_addr, data, len, dev);
+    rslt = bmi3_governor_update(gov, fifo_time, dev);
 
     return rslt;
 }
 
 /*!
- * @brief This API writes data to the given register address of bmi323 sensor.
+ * @brief This API initializes the auto-range governor from the range set in
+ * the sensor.
  */
-int8_t bmi323_set_regs(uint8_t reg_addr, const uint8_t *data, uint16_t len, struct bmi3_dev *dev)
+int8_t bmi323_auto_range_init(const struct bmi3_auto_range_target *target,
+                              struct bmi3_auto_range *ar,
+                              struct bmi3_dev *dev)
 {
     /* Variable to define error */
     int8_t rslt;
 
-    rslt = bmi3_set_regs(reg_addr, data, len, dev);
+    rslt = bmi3_auto_range_init(target, ar, dev);
 
     return rslt;
 }
 
 /*!
- * @brief This API resets bmi323 sensor. All registers are overwritten with
- * their default values.
+ * @brief This API counts a sample of the data registers to the auto-range
+ * governor.
  */
-int8_t bmi323_soft_reset(struct bmi3_dev *dev)
+int8_t bmi323_auto_range_update(const struct bmi3_sens_axes_data *data, struct bmi3_auto_range *ar)
 {
     /* Variable to define error */
     int8_t rslt;
 
-    rslt = bmi3_soft_reset(dev);
+    rslt = bmi3_auto_range_update(data, ar);
 
     return rslt;
 }
 
 /*!
- * @brief This API writes the available sensor specific commands to the sensor.
+ * @brief This API counts FIFO frames to the auto-range governor and tags each
+ * frame with the scale of the range it was sampled with.
  */
-int8_t bmi323_set_command_register(uint16_t command, struct bmi3_dev *dev)
+int8_t bmi323_auto_range_update_fifo(const struct bmi3_fifo_sens_axes_data *data,
+                                     uint16_t n_frames,
+                                     int32_t *scale_q,
+                                     struct bmi3_auto_range *ar)
 {
     /* Variable to define error */
     int8_t rslt;
 
-    /* Set the command in the command register */
-    rslt = bmi3_set_command_register(command, dev);
+    rslt = bmi3_auto_range_update_fifo(data, n_frames, scale_q, ar);
 
     return rslt;
 }
 
 /*!
- * @brief This API gets the interrupt 1 status of both feature and data
- * interrupts
+ * @brief This API sets the range decided by the auto-range governor and
+ * counts the frames left in the FIFO with the previous range.
  */
-int8_t bmi323_get_int1_status(uint16_t *int_status, struct bmi3_dev *dev)
+int8_t bmi323_auto_range_apply(struct bmi3_auto_range *ar, struct bmi3_dev *dev)
 {
     /* Variable to define error */
     int8_t rslt;
 
-    /* Get the interrupt status */
-    rslt = bmi3_get_int1_status(int_status, dev);
+    rslt = bmi3_auto_range_apply(ar, dev);
 
     return rslt;
 }
 
 /*!
- * @brief This API gets the interrupt 2 status of both feature and data
- * interrupts
+ * @brief This API initializes the scheduler.
  */
-int8_t bmi323_get_int2_status(uint16_t *int_status, struct bmi3_dev *dev)
+int8_t bmi323_sched_init(uint16_t fifo_sens,
+                         uint8_t int_pin,
+                         uint32_t service_us,
+                         uint32_t bus_hz,
+                         struct bmi3_sched *sched)
 {
     /* Variable to define error */
     int8_t rslt;
 
-    /* Get the interrupt status */
-    rslt = bmi3_get_int2_status(int_status, dev);
+    rslt = bmi3_sched_init(fifo_sens, int_pin, service_us, bus_hz, sched);
 
     return rslt;
 }
 
 /*!
- * @brief This API gets the re-mapped x, y and z axes from the sensor and
- * updates the values in the device structure.
- *
- * @note: XYZ axis denotes x = x, y = y, z = z
- * Similarly,
- *    YXZ, x = y, y = x, z = z
- *
+ * @brief This API sets or removes the requirements of a consumer of the
+ * scheduler.
  */
-int8_t bmi323_get_remap_axes(struct bmi3_axes_remap *remapped_axis, struct bmi3_dev *dev)
+int8_t bmi323_sched_set_consumer(uint8_t id, uint32_t latency_us, uint8_t odr, struct bmi3_sched *sched)
 {
     /* Variable to define error */
     int8_t rslt;
 
-    /* Get remapped axes */
-    rslt = bmi3_get_remap_axes(remapped_axis, dev);
+    rslt = bmi3_sched_set_consumer(id, latency_us, odr, sched);
 
     return rslt;
 }
 
 /*!
- * @brief This API sets the re-mapped x, y and z axes to the sensor and
- * updates them in the device structure.
+ * @brief This API decides between data-ready and FIFO mode from the
+ * requirements of the consumers and sets the sensor accordingly.
  */
-int8_t bmi323_set_remap_axes(const struct bmi3_axes_remap remapped_axis, struct bmi3_dev *dev)
+int8_t bmi323_sched_apply(struct bmi3_sched *sched, struct bmi3_dev *dev)
 {
     /* Variable to define error */
     int8_t rslt;
 
-    /* Set remapped axes */
-    rslt = bmi3_set_remap_axes(remapped_axis, dev);
+    rslt = bmi3_sched_apply(sched, dev);
 
     return rslt;
 }
 
 /*!
- * @brief This API sets the sensor/feature configuration.
+ * @brief This API serves the interrupt of the scheduler and pushes the
+ * samples to the sample queues.
  */
-int8_t bmi323_set_sensor_config(struct bmi3_sens_config *sens_cfg, uint8_t n_sens, struct bmi3_dev *dev)
+int8_t bmi323_sched_service(const struct bmi3_sched *sched,
+                            struct bmi3_sample_queue *accel_queue,
+                            struct bmi3_sample_queue *gyro_queue,
+                            uint16_t *dropped,
+                            struct bmi3_fifo_frame *fifo,
+                            struct bmi3_dev *dev)
 {
     /* Variable to define error */
     int8_t rslt;
 
-    rslt = bmi3_set_sensor_config(sens_cfg, n_sens, dev);
+    rslt = bmi3_sched_service(sched, accel_queue, gyro_queue, dropped, fifo, dev);
 
     return rslt;
 }
 
 /*!
- * @brief This API gets the sensor/feature configuration.
+ * @brief This API initializes a group of devices and assigns each device an
+ * equal part of the arena to store its FIFO data.
  */
-int8_t bmi323_get_sensor_config(struct bmi3_sens_config *sens_cfg, uint8_t n_sens, struct bmi3_dev *dev)
+int8_t bmi323_group_init(struct bmi3_dev_group *group,
+                         struct bmi3_dev * const *dev,
+                         uint8_t n_dev,
+                         uint8_t *arena,
+                         uint16_t arena_size)
 {
     /* Variable to define error */
     int8_t rslt;
 
-    rslt = bmi3_get_sensor_config(sens_cfg, n_sens, dev);
+    rslt = bmi3_group_init(group, dev, n_dev, arena, arena_size);
 
     return rslt;
 }
 
 /*!
- * @brief This API maps/un-maps data interrupts to that of interrupt pins.
+ * @brief This API starts the FIFO service of the devices of a group.
  */
-int8_t bmi323_map_interrupt(struct bmi3_map_int map_int, struct bmi3_dev *dev)
+int8_t bmi323_group_start(struct bmi3_dev_group *group)
 {
     /* Variable to define error */
     int8_t rslt;
 
-    /* Read map interrupt data */
-    rslt = bmi3_map_interrupt(map_int, dev);
+    rslt = bmi3_group_start(group);
 
     return rslt;
 }
 
 /*!
- * @brief This API selects the sensors/features to be enabled or disabled.
+ * @brief This API gives the next device of a group of which the FIFO data is
+ * read, after starting the FIFO read of the device following it.
  */
-int8_t bmi323_select_sensor(struct bmi3_feature_enable *enable, struct bmi3_dev *dev)
+int8_t bmi323_group_next(struct bmi3_dev_group *group, uint8_t *index)
 {
     /* Variable to define error */
     int8_t rslt;
 
-    rslt = bmi3_select_sensor(enable, dev);
+    rslt = bmi3_group_next(group, index);
 
     return rslt;
 }
 
 /*!
- * @brief This API gets the sensor/feature data for accelerometer, gyroscope,
- * step counter, high-g, gyroscope user-gain update,
- * orientation, gyroscope cross sensitivity and error status for NVM and VFRM.
+ * @brief This API initializes a ping-pong FIFO acquisition and assigns each
+ * buffer an equal part of the arena.
  */
-int8_t bmi323_get_sensor_data(struct bmi3_sensor_data *sensor_data, uint8_t n_sens, struct bmi3_dev *dev)
+int8_t bmi323_pingpong_init(struct bmi3_fifo_pingpong *pingpong,
+                            uint8_t *arena,
+                            uint16_t arena_size,
+                            uint8_t n_buf,
+                            struct bmi3_dev *dev)
 {
     /* Variable to define error */
     int8_t rslt;
 
-    rslt = bmi3_get_sensor_data(sensor_data, n_sens, dev);
+    rslt = bmi3_pingpong_init(pingpong, arena, arena_size, n_buf, dev);
 
     return rslt;
 }
 
 /*!
- *  @brief This API reads the error status from the sensor.
+ * @brief This API starts the FIFO read of a ping-pong FIFO acquisition into
+ * the next free buffer.
  */
-int8_t bmi323_get_error_status(struct bmi3_err_reg *err_reg, struct bmi3_dev *dev)
+int8_t bmi323_pingpong_start(struct bmi3_fifo_pingpong *pingpong)
 {
-    /* Variable to hold execution status */
+    /* Variable to define error */
     int8_t rslt;
 
-    rslt = bmi3_get_error_status(err_reg, dev);
+    rslt = bmi3_pingpong_start(pingpong);
 
     return rslt;
 }
 
 /*!
- *  @brief This API reads the feature engine error status from the sensor.
+ * @brief This API hands the oldest filled buffer of a ping-pong FIFO
+ * acquisition over to the user.
  */
-int8_t bmi323_get_feature_engine_error_status(uint8_t *feature_engine_err_reg_lsb,
-                                              uint8_t *feature_engine_err_reg_msb,
-                                              struct bmi3_dev *dev)
+int8_t bmi323_pingpong_acquire(struct bmi3_fifo_pingpong *pingpong, uint8_t *index)
 {
-    /* Variable to hold execution status */
+    /* Variable to define error */
     int8_t rslt;
 
-    /* Read the feature engine error codes */
-    rslt = bmi3_get_feature_engine_error_status(feature_engine_err_reg_lsb, feature_engine_err_reg_msb, dev);
+    rslt = bmi3_pingpong_acquire(pingpong, index);
 
     return rslt;
 }
 
 /*!
- * @brief This API sets:
- *        1) The input output configuration of the selected interrupt pin:
- *           INT1 or INT2.
- *        2) The interrupt mode: permanently latched or non-latched.
+ * @brief This API gives a buffer of a ping-pong FIFO acquisition back, to be
+ * filled by a following FIFO read.
  */
-int8_t bmi323_set_int_pin_config(const struct bmi3_int_pin_config *int_cfg, struct bmi3_dev *dev)
+int8_t bmi323_pingpong_release(struct bmi3_fifo_pingpong *pingpong, uint8_t index)
 {
     /* Variable to define error */
     int8_t rslt;
 
-    rslt = bmi3_set_int_pin_config(int_cfg, dev);
+    rslt = bmi3_pingpong_release(pingpong, index);
 
     return rslt;
 }
 
 /*!
- * @brief This API gets:
- *        1) The input output configuration of the selected interrupt pin:
- *           INT1 or INT2.
- *        2) The interrupt mode: permanently latched or non-latched.
+ * @brief This API initializes a group of devices of which the i3c sync data is aligned.
  */
-int8_t bmi323_get_int_pin_config(struct bmi3_int_pin_config *int_cfg, struct bmi3_dev *dev)
+int8_t bmi323_i3c_sync_group_init(struct bmi3_i3c_sync_group *group,
+                                  struct bmi3_dev * const *dev,
+                                  uint8_t n_dev)
 {
     /* Variable to define error */
     int8_t rslt;
 
-    rslt = bmi3_get_int_pin_config(int_cfg, dev);
+    rslt = bmi3_i3c_sync_group_init(group, dev, n_dev);
 
     return rslt;
 }
 
 /*!
- * @brief This API is used to get the sensor time.
+ * @brief This API sets the i3c sync data sample rate, delay time and ODR of all devices of a group.
  */
-int8_t bmi323_get_sensor_time(uint32_t *sensor_time, struct bmi3_dev *dev)
+int8_t bmi323_i3c_sync_group_config(const struct bmi3_i3c_sync_cfg *cfg, const struct bmi3_i3c_sync_group *group)
 {
+    /* Variable to define error */
     int8_t rslt;
 
-    rslt = bmi3_get_sensor_time(sensor_time, dev);
+    rslt = bmi3_i3c_sync_group_config(cfg, group);
 
     return rslt;
 }
 
 /*!
- * @brief This API reads the FIFO data.
+ * @brief This API reads the i3c sync data of all devices of a group aligned to the same sync time.
  */
-int8_t bmi323_read_fifo_data(struct bmi3_fifo_frame *fifo, struct bmi3_dev *dev)
+int8_t bmi323_i3c_sync_group_read(struct bmi3_i3c_sync_frame *frame, const struct bmi3_i3c_sync_group *group)
 {
     /* Variable to define error */
     int8_t rslt;
 
-    rslt = bmi3_read_fifo_data(fifo, dev);
+    rslt = bmi3_i3c_sync_group_read(frame, group);
 
     return rslt;
 }
 
 /*!
- * @brief This API parses and extracts the accelerometer frames from FIFO data
- * read by the "bmi323_read_fifo_data" API and stores it in the "accel_data"
- * structure instance.
+ * @brief This API updates the unit conversion scale factors from the set
+ * accelerometer and gyroscope ranges.
  */
-int8_t bmi323_extract_accel(struct bmi3_fifo_sens_axes_data *accel_data,
-                            struct bmi3_fifo_frame *fifo,
-                            const struct bmi3_dev *dev)
+int8_t bmi323_update_unit_scale(struct bmi3_dev *dev)
 {
     /* Variable to define error */
     int8_t rslt;
 
-    rslt = bmi3_extract_accel(accel_data, fifo, dev);
+    rslt = bmi3_update_unit_scale(dev);
 
     return rslt;
 }
 
 /*!
- * @brief This API parses and extracts the temperature frames from FIFO data
- * read by the "bmi323_read_fifo_data" API and stores it in the "temp_data"
- * structure instance.
+ * @brief This API converts an array of accelerometer, gyroscope or temperature
+ * data to fixed-point g, degree per second or degree celsius.
  */
-int8_t bmi323_extract_temperature(struct bmi3_fifo_temperature_data *temp_data,
-                                  struct bmi3_fifo_frame *fifo,
-                                  const struct bmi3_dev *dev)
+int8_t bmi323_lsb_to_q(const int16_t *lsb,
+                       int32_t *out,
+                       uint16_t count,
+                       uint8_t sens_type,
+                       const struct bmi3_dev *dev)
 {
     /* Variable to define error */
     int8_t rslt;
 
-    rslt = bmi3_extract_temperature(temp_data, fifo, dev);
+    rslt = bmi3_lsb_to_q(lsb, out, count, sens_type, dev);
 
     return rslt;
 }
 
 /*!
- * @brief This API parses and extracts the gyro frames from FIFO data
- * read by the "bmi323_read_fifo_data" API and stores it in the "gyro_data"
- * structure instance.
+ * @brief This API converts an array of accelerometer, gyroscope or temperature
+ * data to g, degree per second or degree celsius in float.
  */
-int8_t bmi323_extract_gyro(struct bmi3_fifo_sens_axes_data *gyro_data,
-                           struct bmi3_fifo_frame *fifo,
+int8_t bmi323_lsb_to_float(const int16_t *lsb,
+                           float *out,
+                           uint16_t count,
+                           uint8_t sens_type,
                            const struct bmi3_dev *dev)
 {
     /* Variable to define error */
     int8_t rslt;
 
-    rslt = bmi3_extract_gyro(gyro_data, fifo, dev);
+    rslt = bmi3_lsb_to_float(lsb, out, count, sens_type, dev);
 
     return rslt;
 }
 
 /*!
- * @brief This API sets the FIFO water-mark level in words.
+ * @brief This API sets the correction of the accelerometer or gyro data from
+ * the axis re-mapping, offset and gain.
  */
-int8_t bmi323_set_fifo_wm(uint16_t fifo_wm, struct bmi3_dev *dev)
+int8_t bmi323_set_axes_correction(struct bmi3_axes_correction *corr,
+                                  const struct bmi3_axes_remap *remap,
+                                  const int16_t *offset,
+                                  const uint16_t *gain)
 {
     /* Variable to define error */
     int8_t rslt;
 
-    rslt = bmi3_set_fifo_wm(fifo_wm, dev);
+    rslt = bmi3_set_axes_correction(corr, remap, offset, gain);
 
     return rslt;
 }
 
 /*!
- * @brief This API reads the FIFO water-mark level in words.
+ * @brief This API sets up the thermal compensation of the offset and gain of
+ * an axes correction from a calibration table.
  */
-int8_t bmi323_get_fifo_wm(uint16_t *fifo_wm, struct bmi3_dev *dev)
+int8_t bmi323_thermal_comp_init(const struct bmi3_thermal_point *points,
+                                uint8_t n_points,
+                                uint16_t min_delta,
+                                struct bmi3_axes_correction *corr,
+                                struct bmi3_thermal_comp *comp)
 {
     /* Variable to define error */
     int8_t rslt;
 
-    rslt = bmi3_get_fifo_wm(fifo_wm, dev);
+    rslt = bmi3_thermal_comp_init(points, n_points, min_delta, corr, comp);
 
     return rslt;
 }
 
 /*!
- * @brief This API sets the FIFO configuration in the sensor.
+ * @brief This API updates offset and gain of the axes correction from the
+ * mean of temperature samples.
  */
-int8_t bmi323_set_fifo_config(uint16_t config, uint8_t enable, struct bmi3_dev *dev)
+int8_t bmi323_thermal_comp_update(const struct bmi3_fifo_temperature_data *temp_data,
+                                  uint16_t n_temp,
+                                  struct bmi3_thermal_comp *comp)
 {
+    /* Variable to define error */
     int8_t rslt;
 
-    rslt = bmi3_set_fifo_config(config, enable, dev);
+    rslt = bmi3_thermal_comp_update(temp_data, n_temp, comp);
 
     return rslt;
 }
 
+#ifdef BMI3_RUNNING_STATS
+
 /*!
- * @brief This API reads the FIFO configuration from the sensor.
+ * @brief This API resets running statistics accumulators.
  */
-int8_t bmi323_get_fifo_config(uint16_t *fifo_config, struct bmi3_dev *dev)
+int8_t bmi323_stats_reset(struct bmi3_axes_stats *stats)
 {
     /* Variable to define error */
     int8_t rslt;
 
-    rslt = bmi3_get_fifo_config(fifo_config, dev);
+    rslt = bmi3_stats_reset(stats);
 
     return rslt;
 }
 
 /*!
- * @brief This API gets the length of FIFO data available in the sensor in
- * words.
+ * @brief This API accumulates the x, y and z samples of separate arrays.
  */
-int8_t bmi323_get_fifo_length(uint16_t *fifo_avail_len, struct bmi3_dev *dev)
+int8_t bmi323_stats_update(const struct bmi3_fifo_sens_axes_planes *planes,
+                           uint16_t count,
+                           struct bmi3_axes_stats *stats)
 {
     /* Variable to define error */
     int8_t rslt;
 
-    rslt = bmi3_get_fifo_length(fifo_avail_len, dev);
+    rslt = bmi3_stats_update(planes, count, stats);
 
     return rslt;
 }
 
 /*!
- * @brief This API writes the configurations of context feature for smart phone, wearables and hearables.
+ * @brief This API accumulates the accelerometer or gyro samples directly from the FIFO data.
  */
-int8_t bmi323_context_switch_selection(uint8_t context_sel, struct bmi3_dev *dev)
+int8_t bmi323_fifo_stats(uint16_t sens_sel,
+                         struct bmi3_axes_stats *stats,
+                         const struct bmi3_fifo_frame *fifo,
+                         const struct bmi3_dev *dev)
 {
     /* Variable to define error */
     int8_t rslt;
 
-    struct bmi3_sens_config sens_cfg[BMI323_MAX_FEATURE];
-
-    uint8_t index = 0;
-
-    if (context_sel < BMI323_SEL_MAX)
-    {
-        /* Set any-motion configuration */
-        sens_cfg[0].type = BMI323_ANY_MOTION;
-        sens_cfg[0].cfg.any_motion.slope_thres = any_motion_param_set[context_sel][index++];
-        sens_cfg[0].cfg.any_motion.acc_ref_up = (uint8_t)(any_motion_param_set[context_sel][index++]);
-        sens_cfg[0].cfg.any_motion.hysteresis = any_motion_param_set[context_sel][index++];
-        sens_cfg[0].cfg.any_motion.duration = any_motion_param_set[context_sel][index++];
-        sens_cfg[0].cfg.any_motion.wait_time = any_motion_param_set[context_sel][index++];
-
-        /* Set no-motion configuration */
-        index = 0;
-        sens_cfg[1].type = BMI323_NO_MOTION;
-        sens_cfg[1].cfg.no_motion.slope_thres = no_motion_param_set[context_sel][index++];
-        sens_cfg[1].cfg.no_motion.acc_ref_up = (uint8_t)(no_motion_param_set[context_sel][index++]);
-        sens_cfg[1].cfg.no_motion.hysteresis = no_motion_param_set[context_sel][index++];
-        sens_cfg[1].cfg.no_motion.duration = no_motion_param_set[context_sel][index++];
-        sens_cfg[1].cfg.no_motion.wait_time = no_motion_param_set[context_sel][index++];
-
-        /* Set tap configuration */
-        index = 0;
-        sens_cfg[2].type = BMI323_TAP;
-        sens_cfg[2].cfg.tap.axis_sel = (uint8_t)tap_param_set[context_sel][index++];
-        sens_cfg[2].cfg.tap.wait_for_timeout = (uint8_t)tap_param_set[context_sel][index++];
-        sens_cfg[2].cfg.tap.max_peaks_for_tap = (uint8_t)tap_param_set[context_sel][index++];
-        sens_cfg[2].cfg.tap.mode = (uint8_t)tap_param_set[context_sel][index++];
-        sens_cfg[2].cfg.tap.tap_peak_thres = tap_param_set[context_sel][index++];
-        sens_cfg[2].cfg.tap.max_gest_dur = (uint8_t)tap_param_set[context_sel][index++];
-        sens_cfg[2].cfg.tap.max_dur_between_peaks = (uint8_t)tap_param_set[context_sel][index++];
-        sens_cfg[2].cfg.tap.tap_shock_settling_dur = (uint8_t)tap_param_set[context_sel][index++];
-        sens_cfg[2].cfg.tap.min_quite_dur_between_taps = (uint8_t)tap_param_set[context_sel][index++];
-        sens_cfg[2].cfg.tap.quite_time_after_gest = (uint8_t)tap_param_set[context_sel][index++];
-
-        /* Set step counter configuration */
-        index = 0;
-        sens_cfg[3].type = BMI323_STEP_COUNTER;
-        sens_cfg[3].cfg.step_counter.watermark_level = step_counter_param_set[context_sel][index++];
-        sens_cfg[3].cfg.step_counter.reset_counter = step_counter_param_set[context_sel][index++];
-        sens_cfg[3].cfg.step_counter.env_min_dist_up = step_counter_param_set[context_sel][index++];
-        sens_cfg[3].cfg.step_counter.env_coef_up = step_counter_param_set[context_sel][index++];
-        sens_cfg[3].cfg.step_counter.env_min_dist_down = step_counter_param_set[context_sel][index++];
-        sens_cfg[3].cfg.step_counter.env_coef_down = step_counter_param_set[context_sel][index++];
-        sens_cfg[3].cfg.step_counter.mean_val_decay = step_counter_param_set[context_sel][index++];
-        sens_cfg[3].cfg.step_counter.mean_step_dur = step_counter_param_set[context_sel][index++];
-        sens_cfg[3].cfg.step_counter.step_buffer_size = step_counter_param_set[context_sel][index++];
-        sens_cfg[3].cfg.step_counter.filter_cascade_enabled = step_counter_param_set[context_sel][index++];
-        sens_cfg[3].cfg.step_counter.step_counter_increment = step_counter_param_set[context_sel][index++];
-        sens_cfg[3].cfg.step_counter.peak_duration_min_walking = step_counter_param_set[context_sel][index++];
-        sens_cfg[3].cfg.step_counter.peak_duration_min_running = step_counter_param_set[context_sel][index++];
-        sens_cfg[3].cfg.step_counter.activity_detection_factor = step_counter_param_set[context_sel][index++];
-        sens_cfg[3].cfg.step_counter.activity_detection_thres = step_counter_param_set[context_sel][index++];
-        sens_cfg[3].cfg.step_counter.step_duration_max = step_counter_param_set[context_sel][index++];
-        sens_cfg[3].cfg.step_counter.step_duration_window = step_counter_param_set[context_sel][index++];
-        sens_cfg[3].cfg.step_counter.step_duration_pp_enabled = step_counter_param_set[context_sel][index++];
-        sens_cfg[3].cfg.step_counter.step_duration_thres = step_counter_param_set[context_sel][index++];
-        sens_cfg[3].cfg.step_counter.mean_crossing_pp_enabled = step_counter_param_set[context_sel][index++];
-        sens_cfg[3].cfg.step_counter.mcr_threshold = step_counter_param_set[context_sel][index++];
-
-        /* Set significant motion configuration */
-        index = 0;
-        sens_cfg[4].type = BMI323_SIG_MOTION;
-        sens_cfg[4].cfg.sig_motion.block_size = sig_motion_param_set[context_sel][index++];
-        sens_cfg[4].cfg.sig_motion.peak_2_peak_min = sig_motion_param_set[context_sel][index++];
-        sens_cfg[4].cfg.sig_motion.mcr_min = (uint8_t)sig_motion_param_set[context_sel][index++];
-        sens_cfg[4].cfg.sig_motion.peak_2_peak_max = sig_motion_param_set[context_sel][index++];
-        sens_cfg[4].cfg.sig_motion.mcr_max = (uint8_t)sig_motion_param_set[context_sel][index++];
-
-        /* Set orientation configuration */
-        index = 0;
-        sens_cfg[5].type = BMI323_ORIENTATION;
-        sens_cfg[5].cfg.orientation.ud_en = (uint8_t)orientation_param_set[context_sel][index++];
-        sens_cfg[5].cfg.orientation.mode = (uint8_t)orientation_param_set[context_sel][index++];
-        sens_cfg[5].cfg.orientation.blocking = (uint8_t)orientation_param_set[context_sel][index++];
-        sens_cfg[5].cfg.orientation.theta = (uint8_t)orientation_param_set[context_sel][index++];
-        sens_cfg[5].cfg.orientation.hold_time = (uint8_t)orientation_param_set[context_sel][index++];
-        sens_cfg[5].cfg.orientation.slope_thres = (uint8_t)orientation_param_set[context_sel][index++];
-        sens_cfg[5].cfg.orientation.hysteresis = (uint8_t)orientation_param_set[context_sel][index++];
-
-        /* Set the context configurations */
-        rslt = bmi323_set_sensor_config(sens_cfg, BMI323_MAX_FEATURE, dev);
-    }
-    else
-    {
-        rslt = BMI323_E_INVALID_CONTEXT_SEL;
-    }
+    rslt = bmi3_fifo_stats(sens_sel, stats, fifo, dev);
 
     return rslt;
 }
 
 /*!
- * @brief This API is used to perform the self-test for either accel or gyro or both.
+ * @brief This API merges running statistics accumulators.
  */
-int8_t bmi323_perform_self_test(uint8_t st_selection, struct bmi3_st_result *st_result_status, struct bmi3_dev *dev)
+int8_t bmi323_stats_merge(const struct bmi3_axes_stats *src, struct bmi3_axes_stats *dst)
 {
     /* Variable to define error */
     int8_t rslt;
 
-    rslt = bmi3_perform_self_test(st_selection, st_result_status, dev);
+    rslt = bmi3_stats_merge(src, dst);
 
     return rslt;
 }
 
 /*!
- * @brief This API writes the config array and config version in cfg res.
+ * @brief This API stores the accumulator of a burst in a rolling window.
  */
-int8_t bmi323_configure_enhanced_flexibility(struct bmi3_dev *dev)
+int8_t bmi323_stats_window_push(const struct bmi3_axes_stats *burst, struct bmi3_stats_window *window)
 {
     /* Variable to define error */
     int8_t rslt;
 
-    rslt = bmi3_configure_enhanced_flexibility(dev);
+    rslt = bmi3_stats_window_push(burst, window);
 
     return rslt;
 }
 
 /*!
- * @brief This API is used to get the config version.
+ * @brief This API merges the accumulators of all bursts of a rolling window.
  */
-int8_t bmi323_get_config_version(struct bmi3_config_version *config_version, struct bmi3_dev *dev)
+int8_t bmi323_stats_window_get(const struct bmi3_stats_window *window, struct bmi3_axes_stats *stats)
 {
     /* Variable to define error */
     int8_t rslt;
 
-    rslt = bmi3_get_config_version(config_version, dev);
+    rslt = bmi3_stats_window_get(window, stats);
 
     return rslt;
 }
 
 /*!
- * @brief This API is used to perform the self-calibration for either sensitivity or offset or both.
+ * @brief This API computes the statistics of x, y and z axis from running statistics accumulators.
  */
-int8_t bmi323_perform_gyro_sc(uint8_t sc_selection,
-                              uint8_t apply_corr,
-                              struct bmi3_self_calib_rslt *sc_rslt,
-                              struct bmi3_dev *dev)
+int8_t bmi323_stats_get_result(const struct bmi3_axes_stats *stats, struct bmi3_axes_stats_result *result)
 {
     /* Variable to define error */
     int8_t rslt;
 
-    rslt = bmi3_perform_gyro_sc(sc_selection, apply_corr, sc_rslt, dev);
+    rslt = bmi3_stats_get_result(stats, result);
 
     return rslt;
 }
+#endif
 
 /*!
- * @brief This API is used to set the data sample rate for i3c sync
+ * @brief This API initializes the delta encoder or decoder of FIFO samples.
  */
-int8_t bmi323_set_i3c_tc_sync_tph(uint16_t sample_rate, struct bmi3_dev *dev)
+int8_t bmi323_delta_init(uint8_t odr, uint16_t sensor_time, struct bmi3_delta_codec *codec)
 {
     /* Variable to define error */
     int8_t rslt;
 
-    rslt = bmi3_set_i3c_tc_sync_tph(sample_rate, dev);
+    rslt = bmi3_delta_init(odr, sensor_time, codec);
 
     return rslt;
 }
 
 /*!
- * @brief This API is used to get the data sample rate for i3c sync
+ * @brief This API encodes FIFO samples into blocks of zigzag-encoded deltas
+ * bit-packed with the bit width of each axis.
  */
-int8_t bmi323_get_i3c_tc_sync_tph(uint16_t *sample_rate, struct bmi3_dev *dev)
+int8_t bmi323_delta_encode(const struct bmi3_fifo_sens_axes_data *data,
+                           uint16_t *count,
+                           uint8_t *buf,
+                           uint16_t *len,
+                           struct bmi3_delta_codec *codec)
 {
     /* Variable to define error */
     int8_t rslt;
 
-    rslt = bmi3_get_i3c_tc_sync_tph(sample_rate, dev);
+    rslt = bmi3_delta_encode(data, count, buf, len, codec);
 
     return rslt;
 }
 
 /*!
- * @brief This API is used set the TU(time unit) value is used to scale the delay time payload
- * according to the hosts needs
+ * @brief This API decodes blocks of the delta-encoded sample format back into
+ * FIFO samples, with the sensor time implied by the ODR.
  */
-int8_t bmi323_set_i3c_tc_sync_tu(uint8_t delay_time, struct bmi3_dev *dev)
+int8_t bmi323_delta_decode(const uint8_t *buf,
+                           uint16_t *len,
+                           struct bmi3_fifo_sens_axes_data *data,
+                           uint16_t *count,
+                           struct bmi3_delta_codec *codec)
 {
     /* Variable to define error */
     int8_t rslt;
 
-    rslt = bmi3_set_i3c_tc_sync_tu(delay_time, dev);
+    rslt = bmi3_delta_decode(buf, len, data, count, codec);
 
     return rslt;
 }
 
+#ifdef BMI3_PACKED_BUF
+
 /*!
- * @brief This API is used get the TU(time unit) value is used to scale the delay time payload
- * according to the hosts needs
+ * @brief This API empties a packed sample buffer and sets its sample period.
  */
-int8_t bmi323_get_i3c_tc_sync_tu(uint8_t *delay_time, struct bmi3_dev *dev)
+int8_t bmi323_packed_init(uint8_t odr, struct bmi3_packed_buf *buf)
 {
     /* Variable to define error */
     int8_t rslt;
 
-    rslt = bmi3_get_i3c_tc_sync_tu(delay_time, dev);
+    rslt = bmi3_packed_init(odr, buf);
 
     return rslt;
 }
 
 /*!
- * @brief This API is used to set the i3c sync ODR.
+ * @brief This API appends samples to a packed sample buffer.
  */
-int8_t bmi323_set_i3c_tc_sync_odr(uint8_t odr, struct bmi3_dev *dev)
+int8_t bmi323_packed_append(const struct bmi3_sens_axes_data *data, uint16_t *count, struct bmi3_packed_buf *buf)
 {
     /* Variable to define error */
     int8_t rslt;
 
-    rslt = bmi3_set_i3c_tc_sync_odr(odr, dev);
+    rslt = bmi3_packed_append(data, count, buf);
 
     return rslt;
 }
 
 /*!
- * @brief This API is used to get the i3c sync ODR.
+ * @brief This API appends FIFO samples to a packed sample buffer.
  */
-int8_t bmi323_get_i3c_tc_sync_odr(uint8_t *odr, struct bmi3_dev *dev)
+int8_t bmi323_packed_append_fifo(const struct bmi3_fifo_sens_axes_data *data,
+                                 uint16_t *count,
+                                 struct bmi3_packed_buf *buf)
 {
     /* Variable to define error */
     int8_t rslt;
 
-    rslt = bmi3_get_i3c_tc_sync_odr(odr, dev);
+    rslt = bmi3_packed_append_fifo(data, count, buf);
 
     return rslt;
 }
 
 /*!
- * @brief This internal API gets i3c sync i3c_tc_res
+ * @brief This API unpacks samples of a packed sample buffer.
  */
-int8_t bmi323_get_i3c_sync_i3c_tc_res(uint8_t *i3c_tc_res, struct bmi3_dev *dev)
+int8_t bmi323_packed_unpack(const struct bmi3_packed_buf *buf,
+                            uint16_t first,
+                            struct bmi3_sens_axes_data *data,
+                            uint16_t *count)
 {
     /* Variable to define error */
     int8_t rslt;
 
-    rslt = bmi3_get_i3c_sync_i3c_tc_res(i3c_tc_res, dev);
+    rslt = bmi3_packed_unpack(buf, first, data, count);
 
     return rslt;
 }
 
 /*!
- * @brief This internal API sets i3c sync i3c_tc_res
+ * @brief This API unpacks samples of a packed sample buffer into FIFO samples.
  */
-int8_t bmi323_set_i3c_sync_i3c_tc_res(uint8_t i3c_tc_res, struct bmi3_dev *dev)
+int8_t bmi323_packed_unpack_fifo(const struct bmi3_packed_buf *buf,
+                                 uint16_t first,
+                                 struct bmi3_fifo_sens_axes_data *data,
+                                 uint16_t *count)
 {
     /* Variable to define error */
     int8_t rslt;
 
-    rslt = bmi3_set_i3c_sync_i3c_tc_res(i3c_tc_res, dev);
+    rslt = bmi3_packed_unpack_fifo(buf, first, data, count);
 
     return rslt;
 }
+#endif
+
+#ifdef BMI3_FLIGHT_REC
 
 /*!
- * @brief This API is used to enable accel and gyro for alternate configuration
+ * @brief This API empties and arms a flight recorder.
  */
-int8_t bmi323_alternate_config_ctrl(uint8_t config_en, uint8_t alt_rst_conf, struct bmi3_dev *dev)
+int8_t bmi323_flight_rec_init(uint8_t odr, uint16_t post, uint16_t trigger_mask, struct bmi3_flight_rec *rec)
 {
     /* Variable to define error */
     int8_t rslt;
 
-    rslt = bmi3_alternate_config_ctrl(config_en, alt_rst_conf, dev);
+    rslt = bmi3_flight_rec_init(odr, post, trigger_mask, rec);
 
     return rslt;
 }
 
 /*!
- * @brief This API is used to read the status of alternate configuration
+ * @brief This API packs samples into the ring of a flight recorder.
  */
-int8_t bmi323_read_alternate_status(struct bmi3_alt_status *alt_status, struct bmi3_dev *dev)
+int8_t bmi323_flight_rec_feed(const struct bmi3_fifo_sens_axes_data *accel_data,
+                              const struct bmi3_fifo_sens_axes_data *gyro_data,
+                              uint16_t n_frames,
+                              struct bmi3_flight_rec *rec)
 {
     /* Variable to define error */
     int8_t rslt;
 
-    rslt = bmi3_read_alternate_status(alt_status, dev);
+    rslt = bmi3_flight_rec_feed(accel_data, gyro_data, n_frames, rec);
 
     return rslt;
 }
 
 /*!
- * @brief This API gets offset dgain for the sensor which stores self-calibrated values for accel.
+ * @brief This API triggers an armed flight recorder on a trigger interrupt.
  */
-int8_t bmi323_get_acc_dp_off_dgain(struct bmi3_acc_dp_gain_offset *acc_dp_gain_offset, struct bmi3_dev *dev)
+int8_t bmi323_flight_rec_trigger(uint16_t int_status, struct bmi3_flight_rec *rec)
 {
     /* Variable to define error */
     int8_t rslt;
 
-    rslt = bmi3_get_acc_dp_off_dgain(acc_dp_gain_offset, dev);
+    rslt = bmi3_flight_rec_trigger(int_status, rec);
 
     return rslt;
 }
 
 /*!
- * @brief This API gets offset dgain for the sensor which stores self-calibrated values for gyro.
+ * @brief This API reads a chunk of a FIFO stream into a flight recorder and triggers it.
  */
-int8_t bmi323_get_gyro_dp_off_dgain(struct bmi3_gyr_dp_gain_offset *gyr_dp_gain_offset, struct bmi3_dev *dev)
+int8_t bmi323_flight_rec_service(uint16_t int_status,
+                                 struct bmi3_fifo_sens_axes_data *accel_data,
+                                 struct bmi3_fifo_sens_axes_data *gyro_data,
+                                 struct bmi3_fifo_frame *fifo,
+                                 struct bmi3_fifo_stream *stream,
+                                 struct bmi3_flight_rec *rec,
+                                 struct bmi3_dev *dev)
 {
     /* Variable to define error */
     int8_t rslt;
 
-    rslt = bmi3_get_gyro_dp_off_dgain(gyr_dp_gain_offset, dev);
+    rslt = bmi3_flight_rec_service(int_status, accel_data, gyro_data, fifo, stream, rec, dev);
 
     return rslt;
 }
 
 /*!
- * @brief This API sets offset dgain for the sensor which stores self-calibrated values for accel.
+ * @brief This API exports samples of the ring of a flight recorder.
  */
-int8_t bmi323_set_acc_dp_off_dgain(const struct bmi3_acc_dp_gain_offset *acc_dp_gain_offset, struct bmi3_dev *dev)
+int8_t bmi323_flight_rec_export(const struct bmi3_flight_rec *rec,
+                                uint16_t first,
+                                struct bmi3_sens_axes_data *accel_data,
+                                struct bmi3_sens_axes_data *gyro_data,
+                                uint16_t *count)
 {
     /* Variable to define error */
     int8_t rslt;
 
-    rslt = bmi3_set_acc_dp_off_dgain(acc_dp_gain_offset, dev);
+    rslt = bmi3_flight_rec_export(rec, first, accel_data, gyro_data, count);
 
     return rslt;
 }
 
 /*!
- * @brief This API sets offset dgain for the sensor which stores self-calibrated values for gyro.
+ * @brief This API arms a flight recorder again.
  */
-int8_t bmi323_set_gyro_dp_off_dgain(const struct bmi3_gyr_dp_gain_offset *gyr_dp_gain_offset, struct bmi3_dev *dev)
+int8_t bmi323_flight_rec_rearm(struct bmi3_flight_rec *rec)
 {
     /* Variable to define error */
     int8_t rslt;
 
-    rslt = bmi3_set_gyro_dp_off_dgain(gyr_dp_gain_offset, dev);
+    rslt = bmi3_flight_rec_rearm(rec);
 
     return rslt;
 }
+#endif
+
+#ifdef BMI3_DECIMATOR
 
 /*!
- * @brief This API gets user offset dgain for the sensor which stores self-calibrated values for accel.
+ * @brief This API initializes a CIC decimator of FIFO samples.
  */
-int8_t bmi323_get_user_acc_off_dgain(struct bmi3_acc_usr_gain_offset *acc_usr_gain_offset, struct bmi3_dev *dev)
+int8_t bmi323_decimator_init(uint8_t in_odr, uint8_t out_odr, uint8_t order, struct bmi3_decimator *dec)
 {
     /* Variable to define error */
     int8_t rslt;
 
-    rslt = bmi3_get_user_acc_off_dgain(acc_usr_gain_offset, dev);
+    rslt = bmi3_decimator_init(in_odr, out_odr, order, dec);
 
     return rslt;
 }
 
 /*!
- * @brief This API sets user offset dgain for the sensor which stores self-calibrated values for accel.
+ * @brief This API decimates FIFO samples by the ratio of the decimator.
  */
-int8_t bmi323_set_user_acc_off_dgain(const struct bmi3_acc_usr_gain_offset *acc_usr_gain_offset, struct bmi3_dev *dev)
+int8_t bmi323_decimate(const struct bmi3_fifo_sens_axes_data *in,
+                       uint16_t in_count,
+                       struct bmi3_fifo_sens_axes_data *out,
+                       uint16_t *out_count,
+                       struct bmi3_decimator *dec)
 {
     /* Variable to define error */
     int8_t rslt;
 
-    rslt = bmi3_set_user_acc_off_dgain(acc_usr_gain_offset, dev);
+    rslt = bmi3_decimate(in, in_count, out, out_count, dec);
 
     return rslt;
 }
+#endif
+
+#ifdef BMI3_SPECTRUM
 
 /*!
- * @brief This API performs Fast Offset Compensation for accelerometer.
+ * @brief This API initializes the spectral summary of FIFO samples.
  */
-int8_t bmi323_perform_accel_foc(const struct bmi3_accel_foc_g_value *accel_g_value, struct bmi3_dev *dev)
+int8_t bmi323_spectrum_init(const uint16_t *bins, uint8_t n_bins, uint16_t block_len, struct bmi3_spectrum *spec)
 {
     /* Variable to define error */
     int8_t rslt;
 
-    rslt = bmi3_perform_accel_foc(accel_g_value, dev);
+    rslt = bmi3_spectrum_init(bins, n_bins, block_len, spec);
 
     return rslt;
 }
 
 /*!
- * @brief This API gets the data ready status of power on reset, accelerometer, gyroscope
- * and temperature.
+ * @brief This API updates the spectral summary by FIFO samples.
  */
-int8_t bmi323_get_sensor_status(uint16_t *status, struct bmi3_dev *dev)
+int8_t bmi323_spectrum_update(const struct bmi3_fifo_sens_axes_planes *planes,
+                              uint16_t count,
+                              struct bmi3_spectrum *spec,
+                              struct bmi3_spectrum_summary *summary)
 {
     /* Variable to define error */
     int8_t rslt;
 
-    /* Read the status register */
-    rslt = bmi3_get_sensor_status(status, dev);
+    rslt = bmi3_spectrum_update(planes, count, spec, summary);
 
     return rslt;
 }
+#endif
+
+#ifdef BMI3_BUS_STATS
 
 /*!
- * @brief This API gets the I3C IBI status of both feature and data
- * interrupts
+ * @brief This API gets a snapshot of the bus statistics.
  */
-int8_t bmi323_get_i3c_ibi_status(uint16_t *int_status, struct bmi3_dev *dev)
+int8_t bmi323_get_bus_stats(struct bmi3_bus_stats *stats, const struct bmi3_dev *dev)
 {
     /* Variable to define error */
     int8_t rslt;
 
-    rslt = bmi3_get_i3c_ibi_status(int_status, dev);
+    rslt = bmi3_get_bus_stats(stats, dev);
 
     return rslt;
 }
 
 /*!
- * @brief This API gets accel gyro offset gain reset values.
+ * @brief This API resets the bus statistics.
  */
-int8_t bmi323_get_acc_gyr_off_gain_reset(uint8_t *acc_off_gain_reset, uint8_t *gyr_off_gain_reset, struct bmi3_dev *dev)
+int8_t bmi323_reset_bus_stats(struct bmi3_dev *dev)
 {
-    /* Variable to store result of API */
+    /* Variable to define error */
     int8_t rslt;
 
-    rslt = bmi3_get_acc_gyr_off_gain_reset(acc_off_gain_reset, gyr_off_gain_reset, dev);
+    rslt = bmi3_reset_bus_stats(dev);
 
     return rslt;
 }
 
 /*!
- * @brief This API sets accel gyro offset gain reset values.
+ * @brief This API calibrates the scale factor of a bus model with the bus statistics.
  */
-int8_t bmi323_set_acc_gyr_off_gain_reset(uint8_t acc_off_gain_reset, uint8_t gyr_off_gain_reset, struct bmi3_dev *dev)
+int8_t bmi323_calibrate_bus_model(const struct bmi3_bus_stats *stats, struct bmi3_bus_model *model)
 {
-    /* Variable to store result of API */
+    /* Variable to define error */
     int8_t rslt;
 
-    rslt = bmi3_set_acc_gyr_off_gain_reset(acc_off_gain_reset, gyr_off_gain_reset, dev);
+    rslt = bmi3_calibrate_bus_model(stats, model);
 
     return rslt;
 }
+#endif
 
 /***************************************************************************/
 
@@ -995,3 +3189,35 @@ static int8_t null_ptr_check(const struct bmi3_dev *dev)
 
     return rslt;
 }
+
+/*!
+ * @brief This internal API checks that the accel configuration suits the
+ * features of the contexts.
+ */
+static int8_t check_context_accel_config(struct bmi3_dev *dev)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    struct bmi3_sens_config acc_cfg = { 0 };
+
+    acc_cfg.type = BMI323_ACCEL;
+
+    rslt = bmi323_get_sensor_config(&acc_cfg, 1, dev);
+
+    if ((rslt == BMI323_OK) && (acc_cfg.cfg.acc.acc_mode == BMI3_ACC_MODE_LOW_PWR) &&
+        (acc_cfg.cfg.acc.odr < BMI3_ACC_ODR_200HZ))
+    {
+        rslt = BMI3_E_ACC_INVALID_CFG;
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This internal API selects the wearable context, as set by bmi323_init.
+ */
+static int8_t wearable_context_setup(struct bmi3_dev *dev)
+{
+    return bmi323_context_switch_selection(BMI323_WEARABLE_SEL, dev);
+}
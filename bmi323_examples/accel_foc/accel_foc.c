@@ -106,7 +106,7 @@ static void calculate_noise(int8_t matched_axis,
 int main(void)
 {
     /* Sensor initialization configuration. */
-    struct bmi3_dev dev;
+    struct bmi3_dev dev = { 0 };
 
     uint8_t try = 0, j;
     int8_t rslt;
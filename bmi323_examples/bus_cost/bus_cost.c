@@ -0,0 +1,293 @@
+/**\
+ * Copyright (c) 2024 Bosch Sensortec GmbH. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ **/
+
+/*
+ * Host-side bus cost report. The driver runs against a simulated register-map
+ * device (bus_sim.c) and the transactions, bytes and modeled wall time of
+ * each API are printed, once without and once with the shadow register cache.
+ *
+ * Usage : bus_cost [spi|i2c] [<bus clock in Hz>]
+ */
+
+/******************************************************************************/
+/*!                 Header Files                                              */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "bmi323.h"
+#include "bus_sim.h"
+
+/******************************************************************************/
+/*!         Macros definition                                                */
+
+/*! Default bus clock in Hz */
+#define BUS_COST_SPI_HZ                  UINT32_C(10000000)
+#define BUS_COST_I2C_HZ                  UINT32_C(400000)
+
+/*! Time in microseconds the FIFO fills before it is read */
+#define BUS_COST_FIFO_FILL_US            UINT32_C(100000)
+
+/*! FIFO water-mark level in words */
+#define BUS_COST_FIFO_WM                 UINT16_C(48)
+
+/*! Size of the FIFO buffer in bytes */
+#define BUS_COST_FIFO_BUF_LEN            ((BMI3_FIFO_SIZE_WORDS * 2) + BMI3_MAX_DUMMY_BYTE)
+
+/*! Maximum number of frames in the FIFO buffer */
+#define BUS_COST_FIFO_FRAMES             (BUS_COST_FIFO_BUF_LEN / BMI3_LENGTH_FIFO_ACC)
+
+/******************************************************************************/
+/*!         Static variable definition                                        */
+
+/*! Simulated device */
+static struct bus_sim sim;
+
+/*! Buffers of the FIFO paths */
+static uint8_t fifo_buf[BUS_COST_FIFO_BUF_LEN];
+static struct bmi3_fifo_sens_axes_data fifo_accel_data[BUS_COST_FIFO_FRAMES];
+static struct bmi3_fifo_sens_axes_data fifo_gyro_data[BUS_COST_FIFO_FRAMES];
+
+/******************************************************************************/
+/*!           Static Function Declaration                                     */
+
+/*!
+ *  @brief This internal API prints the bus cost accumulated since the last
+ *  call and clears it.
+ *
+ *  @param[in] name : Name of the measured API sequence.
+ *  @param[in] rslt : Result of the API sequence.
+ */
+static void report(const char *name, int8_t rslt);
+
+/*!
+ *  @brief This internal API enables accelerometer and gyro at the given output data rate.
+ *
+ *  @param[in] odr : Output data rate of accelerometer and gyro.
+ *  @param[in] dev : Structure instance of bmi3_dev.
+ *
+ *  @return Status of execution
+ */
+static int8_t set_accel_gyro(uint8_t odr, struct bmi3_dev *dev);
+
+/*!
+ *  @brief This internal API measures the APIs of the report.
+ *
+ *  @param[in] dev : Structure instance of bmi3_dev.
+ *
+ *  @return Status of execution
+ */
+static int8_t run_report(struct bmi3_dev *dev);
+
+/******************************************************************************/
+/*!            Functions                                        */
+
+/* This function starts the execution of program. */
+int main(int argc, char *argv[])
+{
+    /* Status of API are returned to this variable. */
+    int8_t rslt;
+
+    /* Sensor initialization configuration. */
+    struct bmi3_dev dev = { 0 };
+
+    enum bmi3_intf intf = BMI3_SPI_INTF;
+    uint32_t bus_hz;
+
+    if ((argc > 1) && (strcmp(argv[1], "i2c") == 0))
+    {
+        intf = BMI3_I2C_INTF;
+    }
+
+    bus_hz = (intf == BMI3_SPI_INTF) ? BUS_COST_SPI_HZ : BUS_COST_I2C_HZ;
+
+    if (argc > 2)
+    {
+        bus_hz = (uint32_t)strtoul(argv[2], NULL, 0);
+    }
+
+    if (bus_hz == 0)
+    {
+        bus_hz = BUS_COST_SPI_HZ;
+    }
+
+    bus_sim_attach(&sim, intf, bus_hz, &dev);
+
+    printf("Interface %s at %lu Hz\n\n", (intf == BMI3_SPI_INTF) ? "SPI" : "I2C", (unsigned long)bus_hz);
+    printf("%-32s %6s %6s %7s %10s %10s %10s %5s\n", "API", "reads", "writes", "bytes", "bus us", "delay us",
+           "total ms", "rslt");
+
+    dev.cache.enable = BMI3_DISABLE;
+    rslt = run_report(&dev);
+
+    if (rslt == BMI323_OK)
+    {
+        printf("\nShadow register cache enabled\n");
+
+        bus_sim_attach(&sim, intf, bus_hz, &dev);
+        dev.cache.enable = BMI3_ENABLE;
+        rslt = run_report(&dev);
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This internal API prints the bus cost accumulated since the last call.
+ */
+static void report(const char *name, int8_t rslt)
+{
+    printf("%-32s %6lu %6lu %7lu %10.1f %10.1f %10.3f %5d\n",
+           name,
+           (unsigned long)sim.cost.reads,
+           (unsigned long)sim.cost.writes,
+           (unsigned long)sim.cost.bytes,
+           (double)sim.cost.bus_ns / 1000.0,
+           (double)sim.cost.delay_ns / 1000.0,
+           (double)(sim.cost.bus_ns + sim.cost.delay_ns) / 1000000.0,
+           rslt);
+
+    bus_sim_clear_cost(&sim);
+}
+
+/*!
+ * @brief This internal API enables accelerometer and gyro at the given output data rate.
+ */
+static int8_t set_accel_gyro(uint8_t odr, struct bmi3_dev *dev)
+{
+    int8_t rslt;
+    struct bmi3_sens_config config[2] = { { 0 } };
+
+    config[0].type = BMI323_ACCEL;
+    config[1].type = BMI323_GYRO;
+
+    rslt = bmi323_get_sensor_config(config, 2, dev);
+
+    if (rslt == BMI323_OK)
+    {
+        config[0].cfg.acc.odr = odr;
+        config[0].cfg.acc.range = BMI3_ACC_RANGE_8G;
+        config[0].cfg.acc.bwp = BMI3_ACC_BW_ODR_QUARTER;
+        config[0].cfg.acc.avg_num = BMI3_ACC_AVG4;
+        config[0].cfg.acc.acc_mode = BMI3_ACC_MODE_NORMAL;
+
+        config[1].cfg.gyr.odr = odr;
+        config[1].cfg.gyr.range = BMI3_GYR_RANGE_2000DPS;
+        config[1].cfg.gyr.bwp = BMI3_GYR_BW_ODR_QUARTER;
+        config[1].cfg.gyr.avg_num = BMI3_GYR_AVG1;
+        config[1].cfg.gyr.gyr_mode = BMI3_GYR_MODE_NORMAL;
+
+        rslt = bmi323_set_sensor_config(config, 2, dev);
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This internal API measures the APIs of the report.
+ */
+static int8_t run_report(struct bmi3_dev *dev)
+{
+    int8_t rslt;
+    struct bmi3_st_result st_result = { 0 };
+    struct bmi3_accel_foc_g_value g_value = { 0 };
+    struct bmi3_accel_foc_fifo_cfg foc_cfg = { BMI3_ACC_ODR_800HZ, BMI3_FOC_SAMPLE_LIMIT };
+    struct bmi3_fifo_frame fifoframe = { 0 };
+    uint16_t int1_status = 0;
+
+    rslt = bmi323_init(dev);
+    report("bmi323_init", rslt);
+
+    if (rslt == BMI323_OK)
+    {
+        rslt = bmi323_context_switch_selection(BMI323_SMART_PHONE_SEL, dev);
+        report("bmi323_context_switch_selection", rslt);
+    }
+
+    if (rslt == BMI323_OK)
+    {
+        rslt = bmi323_perform_self_test(BMI3_ST_BOTH_ACC_GYR, &st_result, dev);
+        report("bmi323_perform_self_test", rslt);
+    }
+
+    if (rslt == BMI323_OK)
+    {
+        rslt = set_accel_gyro(BMI3_ACC_ODR_50HZ, dev);
+        report("bmi323_set_sensor_config", rslt);
+    }
+
+    if (rslt == BMI323_OK)
+    {
+        /* The simulated device lies flat, 1 g on z */
+        g_value.z = 1;
+        g_value.sign = 0;
+
+        rslt = bmi323_perform_accel_foc(&g_value, dev);
+        report("bmi323_perform_accel_foc", rslt);
+    }
+
+    if (rslt == BMI323_OK)
+    {
+        rslt = bmi323_perform_accel_foc_fifo(&g_value, &foc_cfg, dev);
+        report("bmi323_perform_accel_foc_fifo", rslt);
+    }
+
+    if (rslt == BMI323_OK)
+    {
+        rslt = set_accel_gyro(BMI3_ACC_ODR_100HZ, dev);
+
+        if (rslt == BMI323_OK)
+        {
+            rslt = bmi323_set_fifo_wm(BUS_COST_FIFO_WM, dev);
+        }
+
+        if (rslt == BMI323_OK)
+        {
+            rslt = bmi323_set_fifo_config(BMI3_FIFO_ACC_EN | BMI3_FIFO_GYR_EN, BMI323_ENABLE, dev);
+        }
+
+        report("FIFO setup", rslt);
+    }
+
+    if (rslt == BMI323_OK)
+    {
+        bus_sim_advance(&sim, BUS_COST_FIFO_FILL_US);
+
+        fifoframe.data = fifo_buf;
+
+        rslt = bmi323_get_fifo_length(&fifoframe.available_fifo_len, dev);
+
+        if (rslt == BMI323_OK)
+        {
+            fifoframe.length = (uint16_t)((fifoframe.available_fifo_len * 2) + dev->dummy_byte);
+            rslt = bmi323_read_fifo_data(&fifoframe, dev);
+        }
+
+        if (rslt == BMI323_OK)
+        {
+            rslt = bmi323_extract_all(fifo_accel_data, fifo_gyro_data, NULL, &fifoframe, dev);
+        }
+
+        report("FIFO length, read and extract", rslt);
+    }
+
+    if (rslt == BMI323_OK)
+    {
+        bus_sim_advance(&sim, BUS_COST_FIFO_FILL_US);
+
+        fifoframe.length = BUS_COST_FIFO_BUF_LEN;
+
+        rslt = bmi323_fifo_service(&int1_status, NULL, &fifoframe, dev);
+
+        if (rslt == BMI323_OK)
+        {
+            rslt = bmi323_extract_all(fifo_accel_data, fifo_gyro_data, NULL, &fifoframe, dev);
+        }
+
+        report("bmi323_fifo_service and extract", rslt);
+    }
+
+    return rslt;
+}
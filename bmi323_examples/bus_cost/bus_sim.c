@@ -0,0 +1,665 @@
+/**\
+ * Copyright (c) 2024 Bosch Sensortec GmbH. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ **/
+
+/******************************************************************************/
+/*!                 Header Files                                              */
+#include <string.h>
+#include "bus_sim.h"
+
+/******************************************************************************/
+/*!         Macros definition                                                */
+
+/*! Size of the FIFO in words */
+#define BUS_SIM_FIFO_WORDS               BMI3_FIFO_SIZE_WORDS
+
+/*! Chip id of the simulated device */
+#define BUS_SIM_CHIP_ID                  UINT16_C(0x0043)
+
+/*! Power-on reset values of the configuration registers */
+#define BUS_SIM_ACC_CONF_DEFAULT         UINT16_C(0x0028)
+#define BUS_SIM_GYR_CONF_DEFAULT         UINT16_C(0x0048)
+#define BUS_SIM_STATUS_DEFAULT           UINT16_C(0x0001)
+
+/*! Status of feature engine words holding the self-test result, all axes ok */
+#define BUS_SIM_ST_RESULT_ALL_OK         UINT16_C(0x007F)
+
+/*! Sensor indices of the status samples */
+#define BUS_SIM_ACC                      UINT8_C(0)
+#define BUS_SIM_GYR                      UINT8_C(1)
+
+/*! Maximum length of a FIFO frame in bytes */
+#define BUS_SIM_MAX_FRAME_LEN            UINT8_C(16)
+
+/******************************************************************************/
+/*!           Static Function Declaration                                     */
+
+/*!
+ * @brief This internal API returns the output data rate in mHz of a sensor
+ * configuration register, 0 if the sensor is disabled.
+ */
+static uint32_t get_odr_mhz(uint16_t conf);
+
+/*!
+ * @brief This internal API returns the index of the current sample at the
+ * given output data rate.
+ */
+static uint64_t get_sample(const struct bus_sim *sim, uint32_t odr_mhz);
+
+/*!
+ * @brief This internal API returns the output data rate in mHz at which
+ * frames are pushed to the FIFO, 0 if no frames are pushed.
+ */
+static uint32_t get_fifo_odr_mhz(const struct bus_sim *sim);
+
+/*!
+ * @brief This internal API returns the length of a FIFO frame in bytes.
+ */
+static uint8_t get_frame_len(const struct bus_sim *sim);
+
+/*!
+ * @brief This internal API pushes the frames sampled since the last update to
+ * the FIFO and updates the FIFO interrupt status.
+ */
+static void update_fifo(struct bus_sim *sim);
+
+/*!
+ * @brief This internal API restarts the sample counting after a change of the
+ * sensor or FIFO configuration.
+ */
+static void rebase_samples(struct bus_sim *sim);
+
+/*!
+ * @brief This internal API builds the FIFO frame of the given index.
+ */
+static void build_frame(const struct bus_sim *sim, uint32_t frame, uint8_t *frame_data);
+
+/*!
+ * @brief This internal API pops one byte from the FIFO.
+ */
+static uint8_t read_fifo_byte(struct bus_sim *sim);
+
+/*!
+ * @brief This internal API returns the word of a register, applying the
+ * read side effects of the register.
+ */
+static uint16_t read_word(struct bus_sim *sim, uint8_t reg_addr);
+
+/*!
+ * @brief This internal API executes a command written to the command register.
+ */
+static void write_command(struct bus_sim *sim, uint16_t cmd);
+
+/*!
+ * @brief This internal API writes the word of a register, applying the
+ * write side effects of the register.
+ */
+static void write_word(struct bus_sim *sim, uint8_t reg_addr, uint16_t word);
+
+/*!
+ * @brief This internal API accounts a bus transaction of "len" bytes of data.
+ */
+static void add_transaction(struct bus_sim *sim, uint8_t read, uint32_t len);
+
+/*!
+ * @brief This internal API is the read function of the simulated bus.
+ */
+static BMI3_INTF_RET_TYPE bus_sim_read(uint8_t reg_addr, uint8_t *reg_data, uint32_t len, void *intf_ptr);
+
+/*!
+ * @brief This internal API is the write function of the simulated bus.
+ */
+static BMI3_INTF_RET_TYPE bus_sim_write(uint8_t reg_addr, const uint8_t *reg_data, uint32_t len, void *intf_ptr);
+
+/*!
+ * @brief This internal API is the delay function of the simulated bus.
+ */
+static void bus_sim_delay_us(uint32_t period, void *intf_ptr);
+
+/******************************************************************************/
+/*!            Functions                                        */
+
+/*!
+ *  @brief This function resets the simulated device and hooks it into the
+ *  device structure in place of the bus functions.
+ */
+void bus_sim_attach(struct bus_sim *sim, enum bmi3_intf intf, uint32_t bus_hz, struct bmi3_dev *dev)
+{
+    memset(sim, 0, sizeof(*sim));
+
+    sim->intf = intf;
+    sim->bus_hz = bus_hz;
+    bus_sim_reset(sim);
+
+    dev->intf = intf;
+    dev->intf_ptr = sim;
+    dev->read = bus_sim_read;
+    dev->write = bus_sim_write;
+    dev->delay_us = bus_sim_delay_us;
+    dev->read_write_len = 32;
+}
+
+/*!
+ *  @brief This function puts the simulated device into its power-on reset state.
+ */
+void bus_sim_reset(struct bus_sim *sim)
+{
+    memset(sim->regs, 0, sizeof(sim->regs));
+    memset(sim->feature, 0, sizeof(sim->feature));
+
+    sim->regs[BMI3_REG_CHIP_ID] = BUS_SIM_CHIP_ID;
+    sim->regs[BMI3_REG_STATUS] = BUS_SIM_STATUS_DEFAULT;
+    sim->regs[BMI3_REG_ACC_CONF] = BUS_SIM_ACC_CONF_DEFAULT;
+    sim->regs[BMI3_REG_GYR_CONF] = BUS_SIM_GYR_CONF_DEFAULT;
+
+    sim->feature_addr = 0;
+    sim->fifo_words = 0;
+    sim->fifo_frame_pos = 0;
+    sim->fifo_read_frame = 0;
+
+    rebase_samples(sim);
+}
+
+/*!
+ *  @brief This function clears the accumulated bus cost.
+ */
+void bus_sim_clear_cost(struct bus_sim *sim)
+{
+    memset(&sim->cost, 0, sizeof(sim->cost));
+}
+
+/*!
+ *  @brief This function advances the simulated time without bus access.
+ */
+void bus_sim_advance(struct bus_sim *sim, uint32_t period_us)
+{
+    sim->time_ns += (uint64_t)period_us * 1000u;
+}
+
+/*!
+ * @brief This internal API returns the output data rate in mHz of a sensor
+ * configuration register.
+ */
+static uint32_t get_odr_mhz(uint16_t conf)
+{
+    uint32_t odr_mhz = 0;
+    uint8_t odr = (uint8_t)(conf & BMI3_ACC_ODR_MASK);
+
+    /* ODR code 8 is 100 Hz, each code doubles the rate */
+    if ((conf & BMI3_ACC_MODE_MASK) && (odr >= BMI3_ACC_ODR_0_78HZ) && (odr <= BMI3_ACC_ODR_6400HZ))
+    {
+        odr_mhz = (UINT32_C(100000) << odr) >> 8;
+    }
+
+    return odr_mhz;
+}
+
+/*!
+ * @brief This internal API returns the index of the current sample at the
+ * given output data rate.
+ */
+static uint64_t get_sample(const struct bus_sim *sim, uint32_t odr_mhz)
+{
+    return (sim->time_ns * odr_mhz) / UINT64_C(1000000000000);
+}
+
+/*!
+ * @brief This internal API returns the output data rate in mHz at which
+ * frames are pushed to the FIFO.
+ */
+static uint32_t get_fifo_odr_mhz(const struct bus_sim *sim)
+{
+    uint32_t odr_mhz = 0;
+    uint32_t gyr_odr_mhz = 0;
+    uint16_t fifo_conf = sim->regs[BMI3_REG_FIFO_CONF];
+
+    if (fifo_conf & BMI3_FIFO_ACC_EN)
+    {
+        odr_mhz = get_odr_mhz(sim->regs[BMI3_REG_ACC_CONF]);
+    }
+
+    if (fifo_conf & BMI3_FIFO_GYR_EN)
+    {
+        gyr_odr_mhz = get_odr_mhz(sim->regs[BMI3_REG_GYR_CONF]);
+    }
+
+    /* The frame rate follows the fastest sensor in the FIFO */
+    if (gyr_odr_mhz > odr_mhz)
+    {
+        odr_mhz = gyr_odr_mhz;
+    }
+
+    return odr_mhz;
+}
+
+/*!
+ * @brief This internal API returns the length of a FIFO frame in bytes.
+ */
+static uint8_t get_frame_len(const struct bus_sim *sim)
+{
+    uint8_t frame_len = 0;
+    uint16_t fifo_conf = sim->regs[BMI3_REG_FIFO_CONF];
+
+    if (fifo_conf & BMI3_FIFO_ACC_EN)
+    {
+        frame_len += BMI3_LENGTH_FIFO_ACC;
+    }
+
+    if (fifo_conf & BMI3_FIFO_GYR_EN)
+    {
+        frame_len += BMI3_LENGTH_FIFO_GYR;
+    }
+
+    if (fifo_conf & BMI3_FIFO_TEMP_EN)
+    {
+        frame_len += BMI3_LENGTH_TEMPERATURE;
+    }
+
+    if (fifo_conf & BMI3_FIFO_TIME_EN)
+    {
+        frame_len += BMI3_LENGTH_SENSOR_TIME;
+    }
+
+    return frame_len;
+}
+
+/*!
+ * @brief This internal API pushes the frames sampled since the last update to
+ * the FIFO and updates the FIFO interrupt status.
+ */
+static void update_fifo(struct bus_sim *sim)
+{
+    uint32_t odr_mhz = get_fifo_odr_mhz(sim);
+    uint64_t sample = get_sample(sim, odr_mhz);
+    uint16_t frame_words = (uint16_t)(get_frame_len(sim) / 2);
+    uint16_t wm = sim->regs[BMI3_REG_FIFO_WATERMARK];
+
+    if ((odr_mhz != 0) && (frame_words != 0))
+    {
+        for (; sim->fifo_sample < sample; sim->fifo_sample++)
+        {
+            /* Frames are dropped when the FIFO is full */
+            if ((sim->fifo_words + frame_words) <= BUS_SIM_FIFO_WORDS)
+            {
+                sim->fifo_words += frame_words;
+            }
+            else
+            {
+                sim->regs[BMI3_REG_INT_STATUS_INT1] |= BMI3_INT_STATUS_FFULL;
+            }
+        }
+
+        if ((wm != 0) && (sim->fifo_words >= wm))
+        {
+            sim->regs[BMI3_REG_INT_STATUS_INT1] |= BMI3_INT_STATUS_FWM;
+        }
+    }
+
+    sim->fifo_sample = sample;
+}
+
+/*!
+ * @brief This internal API restarts the sample counting after a change of the
+ * sensor or FIFO configuration.
+ */
+static void rebase_samples(struct bus_sim *sim)
+{
+    sim->fifo_sample = get_sample(sim, get_fifo_odr_mhz(sim));
+    sim->status_sample[BUS_SIM_ACC] = get_sample(sim, get_odr_mhz(sim->regs[BMI3_REG_ACC_CONF]));
+    sim->status_sample[BUS_SIM_GYR] = get_sample(sim, get_odr_mhz(sim->regs[BMI3_REG_GYR_CONF]));
+}
+
+/*!
+ * @brief This internal API builds the FIFO frame of the given index.
+ */
+static void build_frame(const struct bus_sim *sim, uint32_t frame, uint8_t *frame_data)
+{
+    uint16_t fifo_conf = sim->regs[BMI3_REG_FIFO_CONF];
+    uint8_t range = (uint8_t)((sim->regs[BMI3_REG_ACC_CONF] & BMI3_ACC_RANGE_MASK) >> BMI3_ACC_RANGE_POS);
+    uint16_t one_g = (uint16_t)(UINT16_C(16384) >> range);
+    uint8_t *ptr = frame_data;
+
+    memset(frame_data, 0, BUS_SIM_MAX_FRAME_LEN);
+
+    /* The device lies flat: 1 g on z, no rotation */
+    if (fifo_conf & BMI3_FIFO_ACC_EN)
+    {
+        ptr[4] = (uint8_t)(one_g & 0xFF);
+        ptr[5] = (uint8_t)(one_g >> 8);
+        ptr += BMI3_LENGTH_FIFO_ACC;
+    }
+
+    if (fifo_conf & BMI3_FIFO_GYR_EN)
+    {
+        ptr += BMI3_LENGTH_FIFO_GYR;
+    }
+
+    if (fifo_conf & BMI3_FIFO_TEMP_EN)
+    {
+        ptr += BMI3_LENGTH_TEMPERATURE;
+    }
+
+    if (fifo_conf & BMI3_FIFO_TIME_EN)
+    {
+        ptr[0] = (uint8_t)(frame & 0xFF);
+        ptr[1] = (uint8_t)((frame >> 8) & 0xFF);
+    }
+}
+
+/*!
+ * @brief This internal API pops one byte from the FIFO.
+ */
+static uint8_t read_fifo_byte(struct bus_sim *sim)
+{
+    uint8_t frame_data[BUS_SIM_MAX_FRAME_LEN];
+    uint8_t frame_len = get_frame_len(sim);
+    uint8_t byte = 0;
+
+    if ((sim->fifo_words != 0) && (frame_len != 0))
+    {
+        build_frame(sim, sim->fifo_read_frame, frame_data);
+        byte = frame_data[sim->fifo_frame_pos];
+
+        sim->fifo_frame_pos++;
+
+        if ((sim->fifo_frame_pos % 2) == 0)
+        {
+            sim->fifo_words--;
+        }
+
+        if (sim->fifo_frame_pos >= frame_len)
+        {
+            sim->fifo_frame_pos = 0;
+            sim->fifo_read_frame++;
+        }
+    }
+
+    return byte;
+}
+
+/*!
+ * @brief This internal API returns the word of a register, applying the
+ * read side effects of the register.
+ */
+static uint16_t read_word(struct bus_sim *sim, uint8_t reg_addr)
+{
+    uint16_t word = 0;
+    uint64_t sample;
+    uint8_t range;
+
+    if (reg_addr < BUS_SIM_REG_COUNT)
+    {
+        word = sim->regs[reg_addr];
+    }
+
+    switch (reg_addr)
+    {
+        case BMI3_REG_STATUS:
+
+            /* Data ready flags are set by a new sample and cleared on read */
+            sample = get_sample(sim, get_odr_mhz(sim->regs[BMI3_REG_ACC_CONF]));
+
+            if (sample > sim->status_sample[BUS_SIM_ACC])
+            {
+                word |= BMI3_STATUS_DRDY_ACC | BMI3_STATUS_DRDY_TEMP;
+                sim->status_sample[BUS_SIM_ACC] = sample;
+            }
+
+            sample = get_sample(sim, get_odr_mhz(sim->regs[BMI3_REG_GYR_CONF]));
+
+            if (sample > sim->status_sample[BUS_SIM_GYR])
+            {
+                word |= BMI3_STATUS_DRDY_GYR;
+                sim->status_sample[BUS_SIM_GYR] = sample;
+            }
+
+            sim->regs[BMI3_REG_STATUS] = 0;
+            break;
+
+        case BMI3_REG_ACC_DATA_X + 2:
+            range = (uint8_t)((sim->regs[BMI3_REG_ACC_CONF] & BMI3_ACC_RANGE_MASK) >> BMI3_ACC_RANGE_POS);
+            word = (uint16_t)(UINT16_C(16384) >> range);
+            break;
+
+        case BMI3_REG_SENSOR_TIME_0:
+
+            /* Sensor time ticks every 39.0625 us */
+            word = (uint16_t)(((sim->time_ns * 16u) / 625000u) & 0xFFFF);
+            break;
+
+        case BMI3_REG_SENSOR_TIME_0 + 1:
+            word = (uint16_t)((((sim->time_ns * 16u) / 625000u) >> 16) & 0xFFFF);
+            break;
+
+        case BMI3_REG_INT_STATUS_INT1:
+        case BMI3_REG_INT_STATUS_INT1 + 1:
+
+            /* Interrupt status is cleared on read */
+            sim->regs[reg_addr] = 0;
+            break;
+
+        case BMI3_REG_FIFO_FILL_LEVEL:
+            word = sim->fifo_words;
+            break;
+
+        case BMI3_REG_FEATURE_DATA_TX:
+            word = sim->feature[sim->feature_addr % BUS_SIM_FEATURE_WORDS];
+            sim->feature_addr++;
+            break;
+
+        default:
+            break;
+    }
+
+    return word;
+}
+
+/*!
+ * @brief This internal API executes a command written to the command register.
+ */
+static void write_command(struct bus_sim *sim, uint16_t cmd)
+{
+    switch (cmd)
+    {
+        case BMI3_CMD_SOFT_RESET:
+            bus_sim_reset(sim);
+            break;
+
+        case BMI3_CMD_SELF_TEST_TRIGGER:
+
+            /* Self-test completes with all axes ok */
+            sim->feature[BMI3_BASE_ADDR_ST_RESULT] = BUS_SIM_ST_RESULT_ALL_OK;
+            sim->regs[BMI3_REG_FEATURE_IO1] |= BMI3_SC_ST_STATUS_MASK | BMI3_ST_RESULT_MASK;
+            break;
+
+        case BMI3_CMD_SELF_CALIB_TRIGGER:
+
+            /* Self-calibration completes successfully */
+            sim->regs[BMI3_REG_FEATURE_IO1] |= BMI3_SC_ST_STATUS_MASK | BMI3_GYRO_SC_RESULT_MASK;
+            break;
+
+        default:
+            break;
+    }
+}
+
+/*!
+ * @brief This internal API writes the word of a register, applying the
+ * write side effects of the register.
+ */
+static void write_word(struct bus_sim *sim, uint8_t reg_addr, uint16_t word)
+{
+    switch (reg_addr)
+    {
+        case BMI3_REG_CMD:
+            write_command(sim, word);
+            break;
+
+        case BMI3_REG_FEATURE_CTRL:
+            sim->regs[reg_addr] = word;
+
+            /* Feature engine reports activation */
+            if (word & BMI3_ENABLE)
+            {
+                sim->regs[BMI3_REG_FEATURE_IO1] |= BMI3_FEATURE_ENGINE_ENABLE_MASK;
+            }
+
+            break;
+
+        case BMI3_REG_FEATURE_DATA_ADDR:
+            sim->feature_addr = (uint16_t)(word % BUS_SIM_FEATURE_WORDS);
+            break;
+
+        case BMI3_REG_FEATURE_DATA_TX:
+            sim->feature[sim->feature_addr % BUS_SIM_FEATURE_WORDS] = word;
+            sim->feature_addr++;
+            break;
+
+        case BMI3_REG_FIFO_CTRL:
+
+            /* FIFO flush */
+            if (word & BMI3_ENABLE)
+            {
+                sim->fifo_words = 0;
+                sim->fifo_frame_pos = 0;
+            }
+
+            break;
+
+        case BMI3_REG_ACC_CONF:
+        case BMI3_REG_GYR_CONF:
+        case BMI3_REG_FIFO_CONF:
+            sim->regs[reg_addr] = word;
+
+            /* Samples are counted at the new rate from now on */
+            rebase_samples(sim);
+            break;
+
+        default:
+            if (reg_addr < BUS_SIM_REG_COUNT)
+            {
+                sim->regs[reg_addr] = word;
+            }
+
+            break;
+    }
+}
+
+/*!
+ * @brief This internal API accounts a bus transaction of "len" bytes of data.
+ */
+static void add_transaction(struct bus_sim *sim, uint8_t read, uint32_t len)
+{
+    uint32_t bits;
+    uint64_t bus_ns;
+
+    if (sim->intf == BMI3_SPI_INTF)
+    {
+        /* Address byte followed by the data */
+        bits = (1 + len) * 8;
+    }
+    else if (read)
+    {
+        /* Device address, register address, repeated start with device address and data, 9 bits each */
+        bits = (3 + len) * 9;
+    }
+    else
+    {
+        bits = (2 + len) * 9;
+    }
+
+    bus_ns = BUS_SIM_TRANSACTION_NS + (((uint64_t)bits * 1000000000u) / sim->bus_hz);
+
+    if (read)
+    {
+        sim->cost.reads++;
+    }
+    else
+    {
+        sim->cost.writes++;
+    }
+
+    sim->cost.bytes += len;
+    sim->cost.bus_ns += bus_ns;
+    sim->time_ns += bus_ns;
+}
+
+/*!
+ * @brief This internal API is the read function of the simulated bus.
+ */
+static BMI3_INTF_RET_TYPE bus_sim_read(uint8_t reg_addr, uint8_t *reg_data, uint32_t len, void *intf_ptr)
+{
+    struct bus_sim *sim = (struct bus_sim *)intf_ptr;
+    uint32_t dummy = (sim->intf == BMI3_SPI_INTF) ? 1 : 2;
+    uint32_t index;
+    uint16_t word = 0;
+    uint8_t addr = (uint8_t)(reg_addr & (uint8_t)~BMI3_SPI_RD_MASK);
+
+    add_transaction(sim, BMI3_ENABLE, len);
+    update_fifo(sim);
+
+    memset(reg_data, 0, len);
+
+    for (index = dummy; index < len; index++)
+    {
+        if (addr == BMI3_REG_FIFO_DATA)
+        {
+            reg_data[index] = read_fifo_byte(sim);
+        }
+        else if (((index - dummy) % 2) == 0)
+        {
+            word = read_word(sim, addr);
+            reg_data[index] = (uint8_t)(word & 0xFF);
+        }
+        else
+        {
+            reg_data[index] = (uint8_t)(word >> 8);
+
+            /* Data port registers trap the address */
+            if (addr != BMI3_REG_FEATURE_DATA_TX)
+            {
+                addr++;
+            }
+        }
+    }
+
+    return BMI3_INTF_RET_SUCCESS;
+}
+
+/*!
+ * @brief This internal API is the write function of the simulated bus.
+ */
+static BMI3_INTF_RET_TYPE bus_sim_write(uint8_t reg_addr, const uint8_t *reg_data, uint32_t len, void *intf_ptr)
+{
+    struct bus_sim *sim = (struct bus_sim *)intf_ptr;
+    uint32_t index;
+    uint8_t addr = reg_addr;
+
+    add_transaction(sim, BMI3_DISABLE, len);
+    update_fifo(sim);
+
+    for (index = 0; (index + 1) < len; index += 2)
+    {
+        write_word(sim, addr, (uint16_t)(reg_data[index] | ((uint16_t)reg_data[index + 1] << 8)));
+
+        if (addr != BMI3_REG_FEATURE_DATA_TX)
+        {
+            addr++;
+        }
+    }
+
+    return BMI3_INTF_RET_SUCCESS;
+}
+
+/*!
+ * @brief This internal API is the delay function of the simulated bus.
+ */
+static void bus_sim_delay_us(uint32_t period, void *intf_ptr)
+{
+    struct bus_sim *sim = (struct bus_sim *)intf_ptr;
+
+    sim->cost.delay_ns += (uint64_t)period * 1000u;
+    bus_sim_advance(sim, period);
+}
@@ -0,0 +1,137 @@
+/**\
+ * Copyright (c) 2024 Bosch Sensortec GmbH. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ **/
+
+#ifndef _BUS_SIM_H
+#define _BUS_SIM_H
+
+/*! CPP guard */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/******************************************************************************/
+/*!                 Header Files                                              */
+#include "bmi3.h"
+
+/******************************************************************************/
+/*!         Macros definition                                                */
+
+/*! Number of 16-bit registers of the simulated device */
+#define BUS_SIM_REG_COUNT                UINT8_C(128)
+
+/*! Number of 16-bit words of the simulated feature engine memory */
+#define BUS_SIM_FEATURE_WORDS            UINT16_C(2048)
+
+/*! Fixed cost of a bus transaction in nanoseconds, e.g. chip select and driver overhead */
+#define BUS_SIM_TRANSACTION_NS           UINT32_C(2000)
+
+/******************************************************************************/
+/*!         Structure definition                                              */
+
+/*!
+ * @brief Structure to define the bus cost of a sequence of API calls
+ */
+struct bus_sim_cost
+{
+    /*! Number of read transactions */
+    uint32_t reads;
+
+    /*! Number of write transactions */
+    uint32_t writes;
+
+    /*! Number of bytes transferred, including SPI dummy bytes */
+    uint32_t bytes;
+
+    /*! Modeled bus time in nanoseconds */
+    uint64_t bus_ns;
+
+    /*! Time requested by the driver through delay_us in nanoseconds */
+    uint64_t delay_ns;
+};
+
+/*!
+ * @brief Structure to define the simulated device
+ */
+struct bus_sim
+{
+    /*! Register map */
+    uint16_t regs[BUS_SIM_REG_COUNT];
+
+    /*! Feature engine memory, accessed through FEATURE_DATA_ADDR and FEATURE_DATA_TX */
+    uint16_t feature[BUS_SIM_FEATURE_WORDS];
+
+    /*! Feature engine memory address of the next FEATURE_DATA_TX access */
+    uint16_t feature_addr;
+
+    /*! Interface of the device: BMI3_SPI_INTF or BMI3_I2C_INTF */
+    enum bmi3_intf intf;
+
+    /*! Bus clock in Hz */
+    uint32_t bus_hz;
+
+    /*! Simulated time in nanoseconds */
+    uint64_t time_ns;
+
+    /*! Number of words in the FIFO */
+    uint16_t fifo_words;
+
+    /*! Number of FIFO bytes read from the current frame */
+    uint16_t fifo_frame_pos;
+
+    /*! Number of frames read from the FIFO since reset */
+    uint32_t fifo_read_frame;
+
+    /*! Sample index of the FIFO rate at the last FIFO update */
+    uint64_t fifo_sample;
+
+    /*! Sample indices of accelerometer and gyro at the last status read */
+    uint64_t status_sample[2];
+
+    /*! Accumulated bus cost */
+    struct bus_sim_cost cost;
+};
+
+/******************************************************************************/
+/*!         Functions                                                         */
+
+/*!
+ *  @brief This function resets the simulated device and hooks it into the
+ *  device structure in place of the bus functions.
+ *
+ *  @param[out] sim : Structure instance of bus_sim.
+ *  @param[in] intf : Interface of the device, BMI3_SPI_INTF or BMI3_I2C_INTF.
+ *  @param[in] bus_hz : Bus clock in Hz.
+ *  @param[out] dev : Structure instance of bmi3_dev.
+ */
+void bus_sim_attach(struct bus_sim *sim, enum bmi3_intf intf, uint32_t bus_hz, struct bmi3_dev *dev);
+
+/*!
+ *  @brief This function puts the simulated device into its power-on reset state.
+ *
+ *  @param[out] sim : Structure instance of bus_sim.
+ */
+void bus_sim_reset(struct bus_sim *sim);
+
+/*!
+ *  @brief This function clears the accumulated bus cost.
+ *
+ *  @param[out] sim : Structure instance of bus_sim.
+ */
+void bus_sim_clear_cost(struct bus_sim *sim);
+
+/*!
+ *  @brief This function advances the simulated time without bus access.
+ *
+ *  @param[in,out] sim : Structure instance of bus_sim.
+ *  @param[in] period_us : Time in microseconds.
+ */
+void bus_sim_advance(struct bus_sim *sim, uint32_t period_us);
+
+#ifdef __cplusplus
+}
+#endif /* End of CPP guard */
+
+#endif /* _BUS_SIM_H */
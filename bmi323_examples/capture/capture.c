@@ -0,0 +1,559 @@
+/**\
+ * Copyright (c) 2024 Bosch Sensortec GmbH. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ **/
+
+/******************************************************************************/
+/*!                 Header Files                                              */
+#define _POSIX_C_SOURCE 200809L
+#define _FILE_OFFSET_BITS 64
+
+#include <fcntl.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "capture.h"
+
+/******************************************************************************/
+/*!         Macros definition                                                */
+
+/*! Initial number of entries of the index of the writer */
+#define CAPTURE_INDEX_INITIAL            UINT32_C(1024)
+
+/******************************************************************************/
+/*!           Static Function Declaration                                     */
+
+/*!
+ * @brief This internal API gets the length of a chunk in the file, padding included.
+ *
+ * @param[in] data_len : Number of FIFO data bytes of the chunk.
+ *
+ * @return Length of the chunk in bytes
+ */
+static uint64_t get_chunk_len(uint32_t data_len);
+
+/*!
+ * @brief This internal API writes zero bytes to pad a chunk.
+ *
+ * @param[in] file : File being written.
+ * @param[in] len  : Number of bytes.
+ *
+ * @return 0 on success, -1 on failure
+ */
+static int write_padding(FILE *file, uint32_t len);
+
+/*!
+ * @brief This internal API gets the smallest and largest value of each axis of the frames.
+ *
+ * @param[in]  data  : Frames.
+ * @param[in]  count : Number of frames.
+ * @param[out] min   : Smallest value of x, y and z axis.
+ * @param[out] max   : Largest value of x, y and z axis.
+ */
+static void get_summary(const struct bmi3_fifo_sens_axes_data *data, uint16_t count, int16_t *min, int16_t *max);
+
+/*!
+ * @brief This internal API rebuilds the index of a file which was not closed.
+ *
+ * @param[in,out] r : Structure instance of capture_reader.
+ *
+ * @return 0 on success, -1 on failure
+ */
+static int rebuild_index(struct capture_reader *r);
+
+/*!
+ * @brief This internal API is the read function of the decoding device, which has no bus.
+ */
+static BMI3_INTF_RET_TYPE no_bus_read(uint8_t reg_addr, uint8_t *reg_data, uint32_t len, void *intf_ptr);
+
+/*!
+ * @brief This internal API is the write function of the decoding device, which has no bus.
+ */
+static BMI3_INTF_RET_TYPE no_bus_write(uint8_t reg_addr, const uint8_t *reg_data, uint32_t len, void *intf_ptr);
+
+/*!
+ * @brief This internal API is the delay function of the decoding device.
+ */
+static void no_bus_delay_us(uint32_t period, void *intf_ptr);
+
+/******************************************************************************/
+/*!            Functions                                        */
+
+/*!
+ *  @brief This function creates a capture file.
+ */
+int capture_writer_open(struct capture_writer *w, const char *path, uint8_t odr, struct bmi3_dev *dev)
+{
+    int ret = -1;
+    struct capture_file_hdr hdr = { 0 };
+
+    w->chunk_count = 0;
+    w->index_size = CAPTURE_INDEX_INITIAL;
+    w->index = (struct capture_index_entry *)malloc(w->index_size * sizeof(struct capture_index_entry));
+    w->file = (w->index != NULL) ? fopen(path, "wb") : NULL;
+
+    if ((w->file != NULL) && (bmi3_fifo_time_init(&w->fifo_time, odr, dev) == BMI3_OK))
+    {
+        /* Chunk count and index are written on close, a file left open is indexed by scanning */
+        hdr.magic = CAPTURE_MAGIC;
+        hdr.version = CAPTURE_VERSION;
+        hdr.period = w->fifo_time.period;
+
+        if (fwrite(&hdr, sizeof(hdr), 1, w->file) == 1)
+        {
+            w->offset = sizeof(hdr);
+            ret = 0;
+        }
+    }
+
+    if ((ret != 0) && (w->file != NULL))
+    {
+        (void)fclose(w->file);
+        w->file = NULL;
+    }
+
+    if (ret != 0)
+    {
+        free(w->index);
+        w->index = NULL;
+    }
+
+    return ret;
+}
+
+/*!
+ *  @brief This function appends the FIFO data as a chunk.
+ */
+int capture_writer_add(struct capture_writer *w, struct bmi3_fifo_frame *fifo, const struct bmi3_dev *dev)
+{
+    int ret = -1;
+    int8_t rslt;
+    struct capture_chunk_hdr hdr = { 0 };
+    struct capture_index_entry *index;
+    const struct bmi3_fifo_sens_axes_data *base;
+    uint32_t data_end;
+    uint16_t count;
+
+    data_end = (uint32_t)dev->dummy_byte + ((uint32_t)fifo->available_fifo_len * 2);
+
+    if (data_end > fifo->length)
+    {
+        data_end = fifo->length;
+    }
+
+    if ((w->file != NULL) && (data_end >= dev->dummy_byte))
+    {
+        hdr.magic = CAPTURE_CHUNK_MAGIC;
+        hdr.data_len = data_end - dev->dummy_byte;
+        hdr.fifo_sens = fifo->available_fifo_sens;
+
+        rslt = (fifo->available_fifo_sens & BMI3_FIFO_ACC_EN) ? bmi3_extract_accel(w->accel, fifo, dev) : BMI3_OK;
+        hdr.accel_frames = (fifo->available_fifo_sens & BMI3_FIFO_ACC_EN) ? fifo->avail_fifo_accel_frames : 0;
+
+        if ((rslt >= BMI3_OK) && (fifo->available_fifo_sens & BMI3_FIFO_GYR_EN))
+        {
+            rslt = bmi3_extract_gyro(w->gyro, fifo, dev);
+            hdr.gyro_frames = fifo->avail_fifo_gyro_frames;
+        }
+
+        /* Time of the chunk given by the accelerometer frames, by the gyro frames without accelerometer */
+        base = (hdr.accel_frames != 0) ? w->accel : w->gyro;
+        count = (hdr.accel_frames != 0) ? hdr.accel_frames : hdr.gyro_frames;
+
+        if ((rslt >= BMI3_OK) && (count == 0))
+        {
+            /* Nothing to index */
+            ret = 0;
+        }
+        else if ((rslt >= BMI3_OK) &&
+                 (bmi3_fifo_time_update(&w->fifo_time, fifo, base, count, w->time) == BMI3_OK))
+        {
+            hdr.t_first = w->time[0];
+            hdr.t_last = w->time[count - 1];
+            get_summary(w->accel, hdr.accel_frames, hdr.acc_min, hdr.acc_max);
+            get_summary(w->gyro, hdr.gyro_frames, hdr.gyr_min, hdr.gyr_max);
+
+            if (w->chunk_count == w->index_size)
+            {
+                index = (struct capture_index_entry *)realloc(w->index,
+                                                              2 * w->index_size * sizeof(struct capture_index_entry));
+
+                if (index != NULL)
+                {
+                    w->index = index;
+                    w->index_size *= 2;
+                }
+            }
+
+            if ((w->chunk_count < w->index_size) && (fwrite(&hdr, sizeof(hdr), 1, w->file) == 1) &&
+                (fwrite(&fifo->data[dev->dummy_byte], 1, hdr.data_len, w->file) == hdr.data_len) &&
+                (write_padding(w->file, (uint32_t)(get_chunk_len(hdr.data_len) - sizeof(hdr) - hdr.data_len)) == 0))
+            {
+                w->index[w->chunk_count].t_first = hdr.t_first;
+                w->index[w->chunk_count].t_last = hdr.t_last;
+                w->index[w->chunk_count].offset = w->offset;
+                w->chunk_count++;
+                w->offset += get_chunk_len(hdr.data_len);
+                ret = 0;
+            }
+        }
+    }
+
+    return ret;
+}
+
+/*!
+ *  @brief This function writes the sensor time index and closes the file.
+ */
+int capture_writer_close(struct capture_writer *w)
+{
+    int ret = -1;
+    struct capture_file_hdr hdr = { 0 };
+
+    if (w->file != NULL)
+    {
+        hdr.magic = CAPTURE_MAGIC;
+        hdr.version = CAPTURE_VERSION;
+        hdr.chunk_count = w->chunk_count;
+        hdr.index_offset = w->offset;
+        hdr.period = w->fifo_time.period;
+
+        if ((fwrite(w->index, sizeof(struct capture_index_entry), w->chunk_count, w->file) == w->chunk_count) &&
+            (fflush(w->file) == 0) && (fseeko(w->file, 0, SEEK_SET) == 0) &&
+            (fwrite(&hdr, sizeof(hdr), 1, w->file) == 1))
+        {
+            ret = 0;
+        }
+
+        if (fclose(w->file) != 0)
+        {
+            ret = -1;
+        }
+
+        w->file = NULL;
+    }
+
+    free(w->index);
+    w->index = NULL;
+
+    return ret;
+}
+
+/*!
+ *  @brief This function maps a capture file.
+ */
+int capture_reader_open(struct capture_reader *r, const char *path)
+{
+    int ret = -1;
+    int fd;
+    struct stat st;
+    const struct capture_file_hdr *hdr;
+
+    memset(r, 0, sizeof(*r));
+
+    fd = open(path, O_RDONLY);
+
+    if ((fd >= 0) && (fstat(fd, &st) == 0) && ((uint64_t)st.st_size >= sizeof(struct capture_file_hdr)))
+    {
+        /* Private writable mapping: the decoding takes non-const FIFO data, the file stays unchanged */
+        r->map_len = (size_t)st.st_size;
+        r->map = (uint8_t *)mmap(NULL, r->map_len, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+
+        if (r->map == MAP_FAILED)
+        {
+            r->map = NULL;
+        }
+    }
+
+    if (fd >= 0)
+    {
+        (void)close(fd);
+    }
+
+    if (r->map != NULL)
+    {
+        hdr = (const struct capture_file_hdr *)(const void *)r->map;
+
+        if ((hdr->magic == CAPTURE_MAGIC) && (hdr->version == CAPTURE_VERSION))
+        {
+            if ((hdr->index_offset != 0) &&
+                (hdr->index_offset + ((uint64_t)hdr->chunk_count * sizeof(struct capture_index_entry)) <= r->map_len))
+            {
+                r->index = (const struct capture_index_entry *)(const void *)&r->map[hdr->index_offset];
+                r->chunk_count = hdr->chunk_count;
+                ret = 0;
+            }
+            else
+            {
+                ret = rebuild_index(r);
+            }
+        }
+    }
+
+    if (ret == 0)
+    {
+        /* FIFO data of the chunks is stored without dummy bytes */
+        r->dev.read = no_bus_read;
+        r->dev.write = no_bus_write;
+        r->dev.delay_us = no_bus_delay_us;
+        r->dev.dummy_byte = 0;
+    }
+    else
+    {
+        capture_reader_close(r);
+    }
+
+    return ret;
+}
+
+/*!
+ *  @brief This function unmaps a capture file.
+ */
+void capture_reader_close(struct capture_reader *r)
+{
+    if (r->map != NULL)
+    {
+        (void)munmap(r->map, r->map_len);
+    }
+
+    free(r->own_index);
+
+    r->map = NULL;
+    r->own_index = NULL;
+    r->index = NULL;
+    r->chunk_count = 0;
+}
+
+/*!
+ *  @brief This function gets the header of a chunk.
+ */
+const struct capture_chunk_hdr *capture_reader_chunk(const struct capture_reader *r, uint32_t chunk)
+{
+    const struct capture_chunk_hdr *hdr = NULL;
+
+    if (chunk < r->chunk_count)
+    {
+        hdr = (const struct capture_chunk_hdr *)(const void *)&r->map[r->index[chunk].offset];
+    }
+
+    return hdr;
+}
+
+/*!
+ *  @brief This function finds the first chunk ending at or after the given sensor time.
+ */
+uint32_t capture_reader_seek(const struct capture_reader *r, uint64_t t)
+{
+    uint32_t low = 0;
+    uint32_t high = r->chunk_count;
+    uint32_t mid;
+
+    while (low < high)
+    {
+        mid = low + ((high - low) / 2);
+
+        if (r->index[mid].t_last < t)
+        {
+            low = mid + 1;
+        }
+        else
+        {
+            high = mid;
+        }
+    }
+
+    return low;
+}
+
+/*!
+ *  @brief This function decodes the frames of a chunk.
+ */
+int8_t capture_reader_decode(struct capture_reader *r,
+                             uint32_t chunk,
+                             struct bmi3_fifo_sens_axes_data *accel,
+                             struct bmi3_fifo_sens_axes_data *gyro,
+                             uint64_t *time,
+                             uint16_t *frames)
+{
+    int8_t rslt = BMI3_OK;
+    const struct capture_chunk_hdr *hdr = capture_reader_chunk(r, chunk);
+    struct bmi3_fifo_frame fifo = { 0 };
+    uint16_t count;
+    uint16_t index;
+
+    if ((hdr != NULL) && (frames != NULL))
+    {
+        fifo.data = &r->map[r->index[chunk].offset + sizeof(struct capture_chunk_hdr)];
+        fifo.length = (uint16_t)hdr->data_len;
+        fifo.available_fifo_len = (uint16_t)(hdr->data_len / 2);
+        fifo.available_fifo_sens = hdr->fifo_sens;
+
+        if ((accel != NULL) && (hdr->accel_frames != 0))
+        {
+            rslt = bmi3_extract_accel(accel, &fifo, &r->dev);
+        }
+
+        if ((rslt >= BMI3_OK) && (gyro != NULL) && (hdr->gyro_frames != 0))
+        {
+            rslt = bmi3_extract_gyro(gyro, &fifo, &r->dev);
+        }
+
+        count = (hdr->accel_frames != 0) ? hdr->accel_frames : hdr->gyro_frames;
+
+        if (time != NULL)
+        {
+            /* Frames are evenly spaced within a chunk */
+            for (index = 0; index < count; index++)
+            {
+                time[index] = hdr->t_first +
+                              ((count > 1) ? (((hdr->t_last - hdr->t_first) * index) / (uint64_t)(count - 1)) : 0);
+            }
+        }
+
+        *frames = count;
+    }
+    else
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This internal API gets the length of a chunk in the file.
+ */
+static uint64_t get_chunk_len(uint32_t data_len)
+{
+    return (sizeof(struct capture_chunk_hdr) + (uint64_t)data_len + CAPTURE_ALIGN - 1) & ~(uint64_t)(CAPTURE_ALIGN - 1);
+}
+
+/*!
+ * @brief This internal API writes zero bytes to pad a chunk.
+ */
+static int write_padding(FILE *file, uint32_t len)
+{
+    static const uint8_t zero[CAPTURE_ALIGN] = { 0 };
+
+    return (fwrite(zero, 1, len, file) == len) ? 0 : -1;
+}
+
+/*!
+ * @brief This internal API gets the smallest and largest value of each axis.
+ */
+static void get_summary(const struct bmi3_fifo_sens_axes_data *data, uint16_t count, int16_t *min, int16_t *max)
+{
+    uint16_t index;
+    uint8_t axis;
+    int16_t value[3];
+
+    for (axis = 0; axis < 3; axis++)
+    {
+        min[axis] = (count != 0) ? INT16_MAX : 0;
+        max[axis] = (count != 0) ? INT16_MIN : 0;
+    }
+
+    for (index = 0; index < count; index++)
+    {
+        value[0] = data[index].x;
+        value[1] = data[index].y;
+        value[2] = data[index].z;
+
+        for (axis = 0; axis < 3; axis++)
+        {
+            min[axis] = (value[axis] < min[axis]) ? value[axis] : min[axis];
+            max[axis] = (value[axis] > max[axis]) ? value[axis] : max[axis];
+        }
+    }
+}
+
+/*!
+ * @brief This internal API rebuilds the index of a file which was not closed.
+ */
+static int rebuild_index(struct capture_reader *r)
+{
+    int ret = 0;
+    uint64_t pos = sizeof(struct capture_file_hdr);
+    uint32_t size = 0;
+    struct capture_index_entry *index;
+    const struct capture_chunk_hdr *hdr;
+
+    r->chunk_count = 0;
+
+    /* Complete chunks only, a chunk cut by the end of the file is dropped */
+    while ((ret == 0) && ((pos + sizeof(struct capture_chunk_hdr)) <= r->map_len))
+    {
+        hdr = (const struct capture_chunk_hdr *)(const void *)&r->map[pos];
+
+        if ((hdr->magic != CAPTURE_CHUNK_MAGIC) || ((pos + get_chunk_len(hdr->data_len)) > r->map_len))
+        {
+            break;
+        }
+
+        if (r->chunk_count == size)
+        {
+            size = (size != 0) ? (2 * size) : CAPTURE_INDEX_INITIAL;
+            index = (struct capture_index_entry *)realloc(r->own_index, size * sizeof(struct capture_index_entry));
+
+            if (index != NULL)
+            {
+                r->own_index = index;
+            }
+            else
+            {
+                ret = -1;
+            }
+        }
+
+        if (ret == 0)
+        {
+            r->own_index[r->chunk_count].t_first = hdr->t_first;
+            r->own_index[r->chunk_count].t_last = hdr->t_last;
+            r->own_index[r->chunk_count].offset = pos;
+            r->chunk_count++;
+            pos += get_chunk_len(hdr->data_len);
+        }
+    }
+
+    r->index = r->own_index;
+
+    return ret;
+}
+
+/*!
+ * @brief This internal API is the read function of the decoding device.
+ */
+static BMI3_INTF_RET_TYPE no_bus_read(uint8_t reg_addr, uint8_t *reg_data, uint32_t len, void *intf_ptr)
+{
+    (void)reg_addr;
+    (void)reg_data;
+    (void)len;
+    (void)intf_ptr;
+
+    return (BMI3_INTF_RET_TYPE)-1;
+}
+
+/*!
+ * @brief This internal API is the write function of the decoding device.
+ */
+static BMI3_INTF_RET_TYPE no_bus_write(uint8_t reg_addr, const uint8_t *reg_data, uint32_t len, void *intf_ptr)
+{
+    (void)reg_addr;
+    (void)reg_data;
+    (void)len;
+    (void)intf_ptr;
+
+    return (BMI3_INTF_RET_TYPE)-1;
+}
+
+/*!
+ * @brief This internal API is the delay function of the decoding device.
+ */
+static void no_bus_delay_us(uint32_t period, void *intf_ptr)
+{
+    (void)period;
+    (void)intf_ptr;
+}
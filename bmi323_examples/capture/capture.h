@@ -0,0 +1,277 @@
+/**\
+ * Copyright (c) 2024 Bosch Sensortec GmbH. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ **/
+
+#ifndef _CAPTURE_H
+#define _CAPTURE_H
+
+/*! CPP guard */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/******************************************************************************/
+/*!                 Header Files                                              */
+#include <stddef.h>
+#include <stdio.h>
+#include "bmi3.h"
+
+/******************************************************************************/
+/*!         Macros definition                                                */
+
+/*! Magic number of the file header, "BMI3CAP" */
+#define CAPTURE_MAGIC                    UINT64_C(0x0050414333494D42)
+
+/*! Magic number of a chunk header, "CHNK" */
+#define CAPTURE_CHUNK_MAGIC              UINT32_C(0x4B4E4843)
+
+/*! Version of the file layout */
+#define CAPTURE_VERSION                  UINT32_C(1)
+
+/*! Alignment of the chunks in the file, so that the headers are used in place in the mapping */
+#define CAPTURE_ALIGN                    UINT32_C(8)
+
+/*! Largest number of frames of a chunk, a whole FIFO */
+#define CAPTURE_MAX_FRAMES               ((BMI3_FIFO_SIZE_WORDS * 2) / BMI3_LENGTH_FIFO_ACC)
+
+/******************************************************************************/
+/*!         Structure definition                                              */
+
+/*!
+ * @brief Structure to define the header at the start of the file
+ */
+struct capture_file_hdr
+{
+    /*! CAPTURE_MAGIC */
+    uint64_t magic;
+
+    /*! CAPTURE_VERSION */
+    uint32_t version;
+
+    /*! Number of chunks, written on close. 0 if the file was not closed */
+    uint32_t chunk_count;
+
+    /*! Offset of the index, written on close. 0 if the file was not closed */
+    uint64_t index_offset;
+
+    /*! Sample period of the FIFO frames in sensor time ticks */
+    uint32_t period;
+
+    /*! Reserved */
+    uint32_t reserved;
+};
+
+/*!
+ * @brief Structure to define the header of a chunk, one FIFO burst, followed by
+ * its raw FIFO data padded to CAPTURE_ALIGN
+ */
+struct capture_chunk_hdr
+{
+    /*! CAPTURE_CHUNK_MAGIC */
+    uint32_t magic;
+
+    /*! Number of FIFO data bytes, without dummy bytes and padding */
+    uint32_t data_len;
+
+    /*! Unwrapped sensor time of the first frame in ticks of BMI3_SENSORTIME_RESOLUTION */
+    uint64_t t_first;
+
+    /*! Unwrapped sensor time of the last frame */
+    uint64_t t_last;
+
+    /*! Sensor enable status of the FIFO data, "available_fifo_sens" of bmi3_fifo_frame */
+    uint16_t fifo_sens;
+
+    /*! Number of accelerometer frames */
+    uint16_t accel_frames;
+
+    /*! Number of gyro frames */
+    uint16_t gyro_frames;
+
+    /*! Reserved */
+    uint16_t reserved;
+
+    /*! Smallest and largest value of the x, y and z axis of the accelerometer frames */
+    int16_t acc_min[3];
+    int16_t acc_max[3];
+
+    /*! Smallest and largest value of the x, y and z axis of the gyro frames */
+    int16_t gyr_min[3];
+    int16_t gyr_max[3];
+};
+
+/*!
+ * @brief Structure to define an entry of the sensor time index at the end of the file
+ */
+struct capture_index_entry
+{
+    /*! Sensor time of the first frame of the chunk */
+    uint64_t t_first;
+
+    /*! Sensor time of the last frame of the chunk */
+    uint64_t t_last;
+
+    /*! Offset of the chunk header in the file */
+    uint64_t offset;
+};
+
+/*!
+ * @brief Structure to define the writer of a capture file
+ */
+struct capture_writer
+{
+    /*! File being written */
+    FILE *file;
+
+    /*! Offset of the next chunk */
+    uint64_t offset;
+
+    /*! Number of chunks written */
+    uint32_t chunk_count;
+
+    /*! Number of entries the index can take */
+    uint32_t index_size;
+
+    /*! Index of the chunks written, kept in memory until close */
+    struct capture_index_entry *index;
+
+    /*! FIFO timestamp reconstruction of the chunks */
+    struct bmi3_fifo_time fifo_time;
+
+    /*! Frames of the chunk being written, to get its summary */
+    struct bmi3_fifo_sens_axes_data accel[CAPTURE_MAX_FRAMES];
+    struct bmi3_fifo_sens_axes_data gyro[CAPTURE_MAX_FRAMES];
+
+    /*! Timestamps of the frames of the chunk being written */
+    uint64_t time[CAPTURE_MAX_FRAMES];
+};
+
+/*!
+ * @brief Structure to define the reader of a capture file, mapped into memory
+ */
+struct capture_reader
+{
+    /*! Mapping of the file */
+    uint8_t *map;
+
+    /*! Length of the mapping */
+    size_t map_len;
+
+    /*! Index of the chunks, in the mapping or rebuilt if the file was not closed */
+    const struct capture_index_entry *index;
+
+    /*! Index rebuilt by scanning the chunks, NULL if the index of the file is used */
+    struct capture_index_entry *own_index;
+
+    /*! Number of chunks */
+    uint32_t chunk_count;
+
+    /*! Device structure of the decoding, without bus */
+    struct bmi3_dev dev;
+};
+
+/******************************************************************************/
+/*!         Functions                                                         */
+
+/*!
+ *  @brief This function creates a capture file. The timestamps of the chunks
+ *  are reconstructed from the sensor time of the device and the ODR of the FIFO.
+ *
+ *  @param[out] w      : Structure instance of capture_writer.
+ *  @param[in]  path   : Path of the file.
+ *  @param[in]  odr    : ODR of the FIFO frames, same values as BMI3_ACC_ODR_*.
+ *  @param[in]  dev    : Structure instance of bmi3_dev.
+ *
+ *  @return 0 on success, -1 on failure
+ */
+int capture_writer_open(struct capture_writer *w, const char *path, uint8_t odr, struct bmi3_dev *dev);
+
+/*!
+ *  @brief This function appends the FIFO data read by bmi3_read_fifo_data as a
+ *  chunk, along with its frame layout, time range and summary. No frames must
+ *  be lost in between the chunks, else the writer is to be re-opened.
+ *
+ *  @param[in,out] w    : Structure instance of capture_writer.
+ *  @param[in,out] fifo : Structure instance of bmi3_fifo_frame.
+ *  @param[in]     dev  : Structure instance of bmi3_dev.
+ *
+ *  @return 0 on success, -1 on failure
+ */
+int capture_writer_add(struct capture_writer *w, struct bmi3_fifo_frame *fifo, const struct bmi3_dev *dev);
+
+/*!
+ *  @brief This function writes the sensor time index and closes the file.
+ *
+ *  @param[in,out] w : Structure instance of capture_writer.
+ *
+ *  @return 0 on success, -1 on failure
+ */
+int capture_writer_close(struct capture_writer *w);
+
+/*!
+ *  @brief This function maps a capture file. A file which was not closed, e.g.
+ *  after a power loss, is indexed by scanning its complete chunks.
+ *
+ *  @param[out] r    : Structure instance of capture_reader.
+ *  @param[in]  path : Path of the file.
+ *
+ *  @return 0 on success, -1 on failure
+ */
+int capture_reader_open(struct capture_reader *r, const char *path);
+
+/*!
+ *  @brief This function unmaps a capture file.
+ *
+ *  @param[in,out] r : Structure instance of capture_reader.
+ */
+void capture_reader_close(struct capture_reader *r);
+
+/*!
+ *  @brief This function gets the header of a chunk, in place in the mapping.
+ *
+ *  @param[in] r     : Structure instance of capture_reader.
+ *  @param[in] chunk : Index of the chunk.
+ *
+ *  @return Header of the chunk, NULL if out of range
+ */
+const struct capture_chunk_hdr *capture_reader_chunk(const struct capture_reader *r, uint32_t chunk);
+
+/*!
+ *  @brief This function finds the first chunk ending at or after the given
+ *  sensor time, by binary search of the index.
+ *
+ *  @param[in] r : Structure instance of capture_reader.
+ *  @param[in] t : Unwrapped sensor time in ticks of BMI3_SENSORTIME_RESOLUTION.
+ *
+ *  @return Index of the chunk, chunk_count if the capture ends before the time
+ */
+uint32_t capture_reader_seek(const struct capture_reader *r, uint64_t t);
+
+/*!
+ *  @brief This function decodes the frames of a chunk with bmi3_extract_accel
+ *  and bmi3_extract_gyro, along with their sensor times interpolated over the
+ *  time range of the chunk.
+ *
+ *  @param[in,out] r      : Structure instance of capture_reader.
+ *  @param[in]  chunk     : Index of the chunk.
+ *  @param[out] accel     : Accelerometer frames, CAPTURE_MAX_FRAMES entries, NULL if not required.
+ *  @param[out] gyro      : Gyro frames, CAPTURE_MAX_FRAMES entries, NULL if not required.
+ *  @param[out] time      : Sensor time of each frame, CAPTURE_MAX_FRAMES entries, NULL if not required.
+ *  @param[out] frames    : Number of frames.
+ *
+ *  @return Result of the extraction, BMI3_OK on success
+ */
+int8_t capture_reader_decode(struct capture_reader *r,
+                             uint32_t chunk,
+                             struct bmi3_fifo_sens_axes_data *accel,
+                             struct bmi3_fifo_sens_axes_data *gyro,
+                             uint64_t *time,
+                             uint16_t *frames);
+
+#ifdef __cplusplus
+}
+#endif /* End of CPP guard */
+
+#endif /* _CAPTURE_H */
@@ -0,0 +1,293 @@
+/**\
+ * Copyright (c) 2024 Bosch Sensortec GmbH. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ **/
+
+/*
+ * Indexed capture files of FIFO sessions. The recorder appends each FIFO read
+ * as a chunk of raw FIFO data along with its frame layout, time range and
+ * min/max summary, and writes a sensor time index on close. The query maps the
+ * file, finds the first chunk of a time range by binary search of the index,
+ * and decodes only the chunks overlapping the range. The session is recorded
+ * from the simulated device of bus_cost; on a target, capture_writer_add is
+ * called after each bmi3_read_fifo_data.
+ *
+ * Usage : capture_tool                                  record 10 minutes and query 2 seconds of it
+ *         capture_tool record <file> [<seconds>]        record a session
+ *         capture_tool query <file> <from s> <to s>     decode the frames of a time range
+ */
+
+/******************************************************************************/
+/*!                 Header Files                                              */
+#define _POSIX_C_SOURCE 199309L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "bmi323.h"
+#include "bus_sim.h"
+#include "capture.h"
+
+/******************************************************************************/
+/*!         Macros definition                                                */
+
+/*! Default file and length of the session */
+#define CAPTURE_TOOL_FILE                "capture.bin"
+#define CAPTURE_TOOL_SECONDS             UINT32_C(600)
+
+/*! Time in microseconds the FIFO fills in between the reads */
+#define CAPTURE_TOOL_FILL_US             UINT32_C(50000)
+
+/*! Size of the FIFO buffer in bytes */
+#define CAPTURE_TOOL_FIFO_BUF_LEN        ((BMI3_FIFO_SIZE_WORDS * 2) + BMI3_MAX_DUMMY_BYTE)
+
+/******************************************************************************/
+/*!         Static variable definition                                        */
+
+/*! Simulated device */
+static struct bus_sim sim;
+
+/*! Writer and reader, holding the frames of a chunk */
+static struct capture_writer writer;
+static struct capture_reader reader;
+
+/*! FIFO buffer and decoded frames */
+static uint8_t fifo_buf[CAPTURE_TOOL_FIFO_BUF_LEN];
+static struct bmi3_fifo_sens_axes_data accel[CAPTURE_MAX_FRAMES];
+static struct bmi3_fifo_sens_axes_data gyro[CAPTURE_MAX_FRAMES];
+static uint64_t frame_time[CAPTURE_MAX_FRAMES];
+
+/******************************************************************************/
+/*!           Static Function Declaration                                     */
+
+/*!
+ *  @brief This internal API records a session of accelerometer and gyro FIFO data at 800 Hz.
+ *
+ *  @param[in] path    : Path of the capture file.
+ *  @param[in] seconds : Length of the session in seconds.
+ *
+ *  @return Status of execution
+ */
+static int8_t record(const char *path, uint32_t seconds);
+
+/*!
+ *  @brief This internal API decodes the frames of a time range.
+ *
+ *  @param[in] path : Path of the capture file.
+ *  @param[in] from : Start of the range in seconds since the start of the session.
+ *  @param[in] to   : End of the range in seconds.
+ *
+ *  @return Status of execution
+ */
+static int8_t query(const char *path, double from, double to);
+
+/*!
+ *  @brief This internal API returns a monotonic time stamp in nanoseconds.
+ *
+ *  @return Time stamp in nanoseconds
+ */
+static uint64_t get_time_ns(void);
+
+/******************************************************************************/
+/*!            Functions                                        */
+
+/* This function starts the execution of program. */
+int main(int argc, char *argv[])
+{
+    int8_t rslt;
+
+    if ((argc > 2) && (strcmp(argv[1], "record") == 0))
+    {
+        rslt = record(argv[2], (argc > 3) ? (uint32_t)strtoul(argv[3], NULL, 0) : CAPTURE_TOOL_SECONDS);
+    }
+    else if ((argc > 4) && (strcmp(argv[1], "query") == 0))
+    {
+        rslt = query(argv[2], strtod(argv[3], NULL), strtod(argv[4], NULL));
+    }
+    else
+    {
+        rslt = record(CAPTURE_TOOL_FILE, CAPTURE_TOOL_SECONDS);
+
+        if (rslt == BMI323_OK)
+        {
+            rslt = query(CAPTURE_TOOL_FILE, 300.0, 302.0);
+        }
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This internal API records a session.
+ */
+static int8_t record(const char *path, uint32_t seconds)
+{
+    int8_t rslt;
+    struct bmi3_dev dev = { 0 };
+    struct bmi3_sens_config config[2] = { { 0 } };
+    struct bmi3_fifo_frame fifoframe = { 0 };
+    uint32_t reads = (uint32_t)(((uint64_t)seconds * 1000000) / CAPTURE_TOOL_FILL_US);
+    uint32_t index;
+
+    bus_sim_attach(&sim, BMI3_SPI_INTF, UINT32_C(10000000), &dev);
+
+    rslt = bmi323_init(&dev);
+
+    if (rslt == BMI323_OK)
+    {
+        config[0].type = BMI323_ACCEL;
+        config[1].type = BMI323_GYRO;
+
+        rslt = bmi323_get_sensor_config(config, 2, &dev);
+    }
+
+    if (rslt == BMI323_OK)
+    {
+        config[0].cfg.acc.odr = BMI3_ACC_ODR_800HZ;
+        config[0].cfg.acc.range = BMI3_ACC_RANGE_8G;
+        config[0].cfg.acc.bwp = BMI3_ACC_BW_ODR_QUARTER;
+        config[0].cfg.acc.avg_num = BMI3_ACC_AVG1;
+        config[0].cfg.acc.acc_mode = BMI3_ACC_MODE_HIGH_PERF;
+
+        config[1].cfg.gyr.odr = BMI3_GYR_ODR_800HZ;
+        config[1].cfg.gyr.range = BMI3_GYR_RANGE_2000DPS;
+        config[1].cfg.gyr.bwp = BMI3_GYR_BW_ODR_QUARTER;
+        config[1].cfg.gyr.avg_num = BMI3_GYR_AVG1;
+        config[1].cfg.gyr.gyr_mode = BMI3_GYR_MODE_HIGH_PERF;
+
+        rslt = bmi323_set_sensor_config(config, 2, &dev);
+    }
+
+    if (rslt == BMI323_OK)
+    {
+        rslt = bmi323_set_fifo_config(BMI3_FIFO_ACC_EN | BMI3_FIFO_GYR_EN, BMI323_ENABLE, &dev);
+    }
+
+    if ((rslt == BMI323_OK) && (capture_writer_open(&writer, path, BMI3_ACC_ODR_800HZ, &dev) != 0))
+    {
+        printf("Cannot create %s\n", path);
+        rslt = BMI3_E_INVALID_INPUT;
+    }
+
+    fifoframe.data = fifo_buf;
+
+    for (index = 0; (rslt == BMI323_OK) && (index < reads); index++)
+    {
+        bus_sim_advance(&sim, CAPTURE_TOOL_FILL_US);
+
+        rslt = bmi323_get_fifo_length(&fifoframe.available_fifo_len, &dev);
+
+        if (rslt == BMI323_OK)
+        {
+            fifoframe.length = (uint16_t)((fifoframe.available_fifo_len * 2) + dev.dummy_byte);
+            rslt = bmi323_read_fifo_data(&fifoframe, &dev);
+        }
+
+        if ((rslt == BMI323_OK) && (capture_writer_add(&writer, &fifoframe, &dev) != 0))
+        {
+            rslt = BMI3_E_INVALID_INPUT;
+        }
+    }
+
+    if (writer.file != NULL)
+    {
+        printf("Recorded %lu chunks, %llu bytes into %s\n",
+               (unsigned long)writer.chunk_count,
+               (unsigned long long)writer.offset,
+               path);
+
+        if ((capture_writer_close(&writer) != 0) && (rslt == BMI323_OK))
+        {
+            rslt = BMI3_E_INVALID_INPUT;
+        }
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This internal API decodes the frames of a time range.
+ */
+static int8_t query(const char *path, double from, double to)
+{
+    int8_t rslt = BMI323_OK;
+    const struct capture_chunk_hdr *first_hdr;
+    const struct capture_chunk_hdr *hdr;
+    uint64_t t_from;
+    uint64_t t_to;
+    uint64_t start;
+    uint64_t elapsed;
+    uint32_t chunk;
+    uint32_t decoded = 0;
+    uint32_t frames = 0;
+    uint16_t count = 0;
+    uint16_t index;
+    int16_t acc_min_z = INT16_MAX;
+    int16_t acc_max_z = INT16_MIN;
+
+    if (capture_reader_open(&reader, path) != 0)
+    {
+        printf("Cannot map %s\n", path);
+        rslt = BMI3_E_INVALID_INPUT;
+    }
+    else
+    {
+        start = get_time_ns();
+
+        /* Range in sensor time relative to the first frame of the session */
+        first_hdr = capture_reader_chunk(&reader, 0);
+        t_from = ((first_hdr != NULL) ? first_hdr->t_first : 0) + (uint64_t)(from * BMI3_SENSORTIME_TICKS_PER_S);
+        t_to = ((first_hdr != NULL) ? first_hdr->t_first : 0) + (uint64_t)(to * BMI3_SENSORTIME_TICKS_PER_S);
+
+        for (chunk = capture_reader_seek(&reader, t_from);
+             (rslt >= BMI323_OK) && ((hdr = capture_reader_chunk(&reader, chunk)) != NULL) && (hdr->t_first <= t_to);
+             chunk++)
+        {
+            /* Summaries tell the range of each chunk without decoding it */
+            acc_min_z = (hdr->acc_min[2] < acc_min_z) ? hdr->acc_min[2] : acc_min_z;
+            acc_max_z = (hdr->acc_max[2] > acc_max_z) ? hdr->acc_max[2] : acc_max_z;
+
+            rslt = capture_reader_decode(&reader, chunk, accel, gyro, frame_time, &count);
+            decoded++;
+
+            for (index = 0; index < count; index++)
+            {
+                if ((frame_time[index] >= t_from) && (frame_time[index] <= t_to))
+                {
+                    frames++;
+                }
+            }
+        }
+
+        elapsed = get_time_ns() - start;
+
+        printf("%lu chunks in the file, %lu decoded for %.3f s to %.3f s: %lu frames in range, "
+               "accel z %d to %d, %.1f us\n",
+               (unsigned long)reader.chunk_count,
+               (unsigned long)decoded,
+               from,
+               to,
+               (unsigned long)frames,
+               acc_min_z,
+               acc_max_z,
+               (double)elapsed / 1000.0);
+
+        capture_reader_close(&reader);
+    }
+
+    return (rslt < BMI323_OK) ? rslt : BMI323_OK;
+}
+
+/*!
+ * @brief This internal API returns a monotonic time stamp in nanoseconds.
+ */
+static uint64_t get_time_ns(void)
+{
+    struct timespec now;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return ((uint64_t)now.tv_sec * 1000000000u) + (uint64_t)now.tv_nsec;
+}
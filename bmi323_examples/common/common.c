@@ -10,17 +10,13 @@
 
 #include "bmi3.h"
 #include "coines.h"
-
-/******************************************************************************/
-/*!                Macro definition                                           */
-
-#define READ_WRITE_LEN  UINT8_C(8)
+#include "common.h"
 
 /******************************************************************************/
 /*!                Static variable definition                                 */
 
-/*! Variable that holds the I2C device address or SPI chip selection */
-static uint8_t dev_addr;
+/*! Bus of the sensor of bmi3_interface_init */
+static struct bmi3_coines_intf default_bus;
 
 /******************************************************************************/
 /*!                Static function definition                                 */
@@ -196,6 +192,18 @@ void bmi3_error_codes_print_result(const char api_name[], int8_t rslt)
                 rslt);
             break;
 
+        case BMI3_E_CONFIG_VERIFY:
+            printf("%s\t", api_name);
+            printf("Error [%d] : Config verify error. It occurs when the uploaded config array does not read back\r\n",
+                   rslt);
+            break;
+
+        case BMI3_E_CALIB_BLOB:
+            printf("%s\t", api_name);
+            printf("Error [%d] : Calibration blob error. It occurs when version, chip-id or CRC do not match\r\n",
+                   rslt);
+            break;
+
         default:
             printf("%s\t", api_name);
             printf("Error [%d] : Unknown error code\r\n", rslt);
@@ -204,63 +212,198 @@ void bmi3_error_codes_print_result(const char api_name[], int8_t rslt)
 }
 
 /*!
- * @brief This function is to select the interface between SPI and I2C.
+ * @brief This function opens the communication with the application board.
  */
-int8_t bmi3_interface_init(struct bmi3_dev *dev, int8_t intf)
+int8_t bmi3_coines_open(void)
 {
-    int8_t rslt = BMI3_OK;
+    int16_t result = coines_open_comm_intf(COINES_COMM_INTF_USB, NULL);
 
-    if (dev != NULL)
+    if (result < COINES_SUCCESS)
     {
-        int16_t result = coines_open_comm_intf(COINES_COMM_INTF_USB, NULL);
+        printf(
+            "\n Unable to connect with Application Board ! \n " "1. Check if the board is connected and powered on. \n " "2. Check if Application Board USB driver is installed. \n "
+            "3. Check if board is in use by another application. (Insufficient permissions to access USB) \n");
+        exit(result);
+    }
 
-        if (result < COINES_SUCCESS)
-        {
-            printf(
-                "\n Unable to connect with Application Board ! \n " "1. Check if the board is connected and powered on. \n " "2. Check if Application Board USB driver is installed. \n "
-                "3. Check if board is in use by another application. (Insufficient permissions to access USB) \n");
-            exit(result);
-        }
+    (void)coines_set_shuttleboard_vdd_vddio_config(0, 0);
+    coines_delay_msec(100);
+
+    return BMI3_OK;
+}
+
+/*!
+ * @brief This function switches the supply of the shuttle board on.
+ */
+void bmi3_coines_power_on(void)
+{
+    (void)coines_set_shuttleboard_vdd_vddio_config(3300, 3300);
+    coines_delay_msec(100);
+}
+
+/*!
+ * @brief This function sets the default bus of the interface.
+ */
+void bmi3_coines_intf_default(struct bmi3_coines_intf *bus, enum bmi3_intf intf)
+{
+    if (bus != NULL)
+    {
+        bus->intf = intf;
+        bus->i2c_bus = COINES_I2C_BUS_0;
+        bus->spi_bus = COINES_SPI_BUS_0;
+        bus->dev_addr = (intf == BMI3_I2C_INTF) ? BMI3_ADDR_I2C_PRIM : (uint8_t)COINES_MINI_SHUTTLE_PIN_2_1;
+        bus->i2c_mode = COINES_I2C_STANDARD_MODE;
+        bus->spi_speed = COINES_SPI_SPEED_10_MHZ;
+        bus->spi_mode = COINES_SPI_MODE0;
+        bus->read_write_len = BMI3_COINES_READ_WRITE_LEN;
+        bus->bulk_len = 0;
+        bus->bulk_read = NULL;
+        bus->bulk_write = NULL;
+        bus->bulk_ctx = NULL;
+    }
+}
 
-        (void)coines_set_shuttleboard_vdd_vddio_config(0, 0);
-        coines_delay_msec(100);
+/*!
+ * @brief This function configures the bus of a sensor and hooks it into the
+ * device structure.
+ */
+int8_t bmi3_coines_intf_init(struct bmi3_dev *dev, struct bmi3_coines_intf *bus)
+{
+    int8_t rslt = BMI3_OK;
 
+    if ((dev != NULL) && (bus != NULL))
+    {
         /* Bus configuration : I2C */
-        if (intf == BMI3_I2C_INTF)
+        if (bus->intf == BMI3_I2C_INTF)
         {
-            printf("Interface: I2C\n");
-            dev_addr = BMI3_ADDR_I2C_PRIM;
             dev->read = bmi3_i2c_read;
             dev->write = bmi3_i2c_write;
             dev->intf = BMI3_I2C_INTF;
 
-            /* SDO pin is made low */
-            (void)coines_set_pin_config(COINES_SHUTTLE_PIN_SDO, COINES_PIN_DIRECTION_OUT, COINES_PIN_VALUE_LOW);
+            /* SDO pin is made low for the primary address, high for the secondary one */
+            (void)coines_set_pin_config(COINES_SHUTTLE_PIN_SDO,
+                                        COINES_PIN_DIRECTION_OUT,
+                                        (bus->dev_addr == BMI3_ADDR_I2C_SEC) ? COINES_PIN_VALUE_HIGH :
+                                        COINES_PIN_VALUE_LOW);
 
-            (void)coines_config_i2c_bus(COINES_I2C_BUS_0, COINES_I2C_STANDARD_MODE);
+            (void)coines_config_i2c_bus(bus->i2c_bus, bus->i2c_mode);
         }
         /* Bus configuration : SPI */
-        else if (intf == BMI3_SPI_INTF)
+        else if (bus->intf == BMI3_SPI_INTF)
         {
-            printf("Interface: SPI\n");
-            dev_addr = COINES_MINI_SHUTTLE_PIN_2_1;
             dev->read = bmi3_spi_read;
             dev->write = bmi3_spi_write;
             dev->intf = BMI3_SPI_INTF;
-            (void)coines_config_spi_bus(COINES_SPI_BUS_0, COINES_SPI_SPEED_10_MHZ, COINES_SPI_MODE0);
+            (void)coines_config_spi_bus(bus->spi_bus, bus->spi_speed, bus->spi_mode);
         }
+        else
+        {
+            rslt = BMI3_E_INVALID_INPUT;
+        }
+    }
+    else
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
 
-        (void)coines_set_shuttleboard_vdd_vddio_config(3300, 3300);
-        coines_delay_msec(100);
-
+    if (rslt == BMI3_OK)
+    {
         /* Configure delay in microseconds */
         dev->delay_us = bmi3_delay_us;
 
-        /* Assign device address to interface pointer */
-        dev->intf_ptr = &dev_addr;
+        /* Each sensor carries its own bus as interface pointer */
+        dev->intf_ptr = bus;
+
+        /* Configure max read/write length (in bytes) */
+        dev->read_write_len = bus->read_write_len;
+
+        /* Use the portable FIFO unpack implementation of the driver */
+        dev->fifo_unpack_axes = NULL;
+        dev->fifo_unpack_frames = NULL;
+
+        /* Non-blocking read is not used */
+        dev->read_async = NULL;
+
+        /* FIFO data is read with the read function */
+        dev->read_hdr = NULL;
+
+        /* Idle time required after a write access, BMI3_IDLE_TIME_US */
+        dev->idle_time_us = 0;
+
+        /* Use the default boot configuration */
+        dev->boot_cfg = NULL;
+
+        /* Config array is uploaded in bursts of read_write_len, without verification */
+        dev->upload_cfg = NULL;
+
+        /* Shadow register cache is not used */
+        dev->cache.enable = BMI3_DISABLE;
+
+        /* FIFO water-mark level is set by the examples */
+        dev->fifo_wm_budget = NULL;
+
+        /* Failed transfers are reported, not retried */
+        dev->retry_cfg = NULL;
+        (void)bmi3_reset_retry_stats(dev);
 
-        /* Configure max read/write length (in bytes) ( Supported length depends on target machine) */
-        dev->read_write_len = READ_WRITE_LEN;
+        /* Device is used by a single task */
+        dev->lock = NULL;
+        dev->unlock = NULL;
+
+        /* Bus operations are submitted one by one */
+        dev->batch_begin = NULL;
+        dev->batch_end = NULL;
+        dev->batch_depth = 0;
+
+        /* FIFO data is not corrected by the driver */
+        dev->acc_corr = NULL;
+        dev->gyr_corr = NULL;
+
+#ifdef BMI3_BUS_STATS
+
+        /* Transactions are counted, but not timed */
+        dev->timestamp_us = NULL;
+        (void)bmi3_reset_bus_stats(dev);
+#endif
+#ifdef BMI3_DEV_SCRATCH
+
+        /* Register reads use the scratch buffer of the bus until a context provides one */
+        dev->scratch = bus->scratch;
+#endif
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This function is to select the interface between SPI and I2C.
+ */
+int8_t bmi3_interface_init(struct bmi3_dev *dev, int8_t intf)
+{
+    int8_t rslt = BMI3_OK;
+
+    if (dev != NULL)
+    {
+        rslt = bmi3_coines_open();
+
+        if (intf == BMI3_I2C_INTF)
+        {
+            printf("Interface: I2C\n");
+        }
+        else if (intf == BMI3_SPI_INTF)
+        {
+            printf("Interface: SPI\n");
+        }
+
+        /* Single sensor on bus 0 */
+        bmi3_coines_intf_default(&default_bus, (enum bmi3_intf)intf);
+
+        if (rslt == BMI3_OK)
+        {
+            rslt = bmi3_coines_intf_init(dev, &default_bus);
+        }
+
+        bmi3_coines_power_on();
     }
     else
     {
@@ -294,11 +437,19 @@ void bmi3_coines_deinit(void)
  */
 static BMI3_INTF_RET_TYPE bmi3_i2c_read(uint8_t reg_addr, uint8_t *reg_data, uint32_t len, void *intf_ptr)
 {
-    uint8_t device_addr = *(uint8_t*)intf_ptr;
+    struct bmi3_coines_intf *bus = (struct bmi3_coines_intf *)intf_ptr;
+    BMI3_INTF_RET_TYPE rslt;
 
-    (void)intf_ptr;
+    if ((bus->bulk_read != NULL) && (len >= bus->bulk_len))
+    {
+        rslt = bus->bulk_read(reg_addr, reg_data, len, bus);
+    }
+    else
+    {
+        rslt = coines_read_i2c(bus->i2c_bus, bus->dev_addr, reg_addr, reg_data, (uint16_t)len);
+    }
 
-    return coines_read_i2c(COINES_I2C_BUS_0, device_addr, reg_addr, reg_data, (uint16_t)len);
+    return rslt;
 }
 
 /*!
@@ -306,11 +457,19 @@ static BMI3_INTF_RET_TYPE bmi3_i2c_read(uint8_t reg_addr, uint8_t *reg_data, uin
  */
 static BMI3_INTF_RET_TYPE bmi3_i2c_write(uint8_t reg_addr, const uint8_t *reg_data, uint32_t len, void *intf_ptr)
 {
-    uint8_t device_addr = *(uint8_t*)intf_ptr;
+    struct bmi3_coines_intf *bus = (struct bmi3_coines_intf *)intf_ptr;
+    BMI3_INTF_RET_TYPE rslt;
 
-    (void)intf_ptr;
+    if ((bus->bulk_write != NULL) && (len >= bus->bulk_len))
+    {
+        rslt = bus->bulk_write(reg_addr, reg_data, len, bus);
+    }
+    else
+    {
+        rslt = coines_write_i2c(bus->i2c_bus, bus->dev_addr, reg_addr, (uint8_t *)reg_data, (uint16_t)len);
+    }
 
-    return coines_write_i2c(COINES_I2C_BUS_0, device_addr, reg_addr, (uint8_t *)reg_data, (uint16_t)len);
+    return rslt;
 }
 
 /*!
@@ -318,11 +477,19 @@ static BMI3_INTF_RET_TYPE bmi3_i2c_write(uint8_t reg_addr, const uint8_t *reg_da
  */
 static BMI3_INTF_RET_TYPE bmi3_spi_read(uint8_t reg_addr, uint8_t *reg_data, uint32_t len, void *intf_ptr)
 {
-    uint8_t device_addr = *(uint8_t*)intf_ptr;
+    struct bmi3_coines_intf *bus = (struct bmi3_coines_intf *)intf_ptr;
+    BMI3_INTF_RET_TYPE rslt;
 
-    (void)intf_ptr;
+    if ((bus->bulk_read != NULL) && (len >= bus->bulk_len))
+    {
+        rslt = bus->bulk_read(reg_addr, reg_data, len, bus);
+    }
+    else
+    {
+        rslt = coines_read_spi(bus->spi_bus, bus->dev_addr, reg_addr, reg_data, (uint16_t)len);
+    }
 
-    return coines_read_spi(COINES_SPI_BUS_0, device_addr, reg_addr, reg_data, (uint16_t)len);
+    return rslt;
 }
 
 /*!
@@ -330,11 +497,19 @@ static BMI3_INTF_RET_TYPE bmi3_spi_read(uint8_t reg_addr, uint8_t *reg_data, uin
  */
 static BMI3_INTF_RET_TYPE bmi3_spi_write(uint8_t reg_addr, const uint8_t *reg_data, uint32_t len, void *intf_ptr)
 {
-    uint8_t device_addr = *(uint8_t*)intf_ptr;
+    struct bmi3_coines_intf *bus = (struct bmi3_coines_intf *)intf_ptr;
+    BMI3_INTF_RET_TYPE rslt;
 
-    (void)intf_ptr;
+    if ((bus->bulk_write != NULL) && (len >= bus->bulk_len))
+    {
+        rslt = bus->bulk_write(reg_addr, reg_data, len, bus);
+    }
+    else
+    {
+        rslt = coines_write_spi(bus->spi_bus, bus->dev_addr, reg_addr, (uint8_t *)reg_data, (uint16_t)len);
+    }
 
-    return coines_write_spi(COINES_SPI_BUS_0, device_addr, reg_addr, (uint8_t *)reg_data, (uint16_t)len);
+    return rslt;
 }
 
 /*!
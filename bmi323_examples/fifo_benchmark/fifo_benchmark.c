@@ -0,0 +1,1065 @@
+/**\
+ * Copyright (c) 2024 Bosch Sensortec GmbH. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ **/
+
+/*
+ * Host-side benchmark of the FIFO read and parse path. No sensor is needed: a
+ * mock bus replays a captured or synthetic FIFO dump through
+ * bmi323_read_fifo_data and the bmi323_extract_* APIs.
+ *
+ * Usage : fifo_benchmark [<dump file> <FIFO_CONF value>]
+ *
+ * Without arguments every FIFO_CONF sensor combination is benchmarked with
+ * synthetic frames, including dummy frames and a partial frame at the tail.
+ * A dump file holds the raw FIFO_DATA bytes (without SPI dummy byte) and is
+ * replayed with the given FIFO_CONF value, e.g. 0x0F00.
+ *
+ * The frames extracted from the synthetic frames, by the single pass and by
+ * the per-sensor extraction, are checked against the values written to the
+ * dump. Every case is also run with the FIFO unpack functions of
+ * bmi3_fifo_simd.h, whose output is checked against the portable
+ * implementation of the driver. The program exits with a non-zero status if a
+ * case fails.
+ */
+
+/******************************************************************************/
+/*!                 Header Files                                              */
+#define _POSIX_C_SOURCE 199309L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "bmi323.h"
+#include "bmi3_fifo_simd.h"
+
+/******************************************************************************/
+/*!         Macros definition                                                */
+
+/*! Size of the FIFO in bytes */
+#define FIFO_SIZE_BYTES                  (BMI3_FIFO_SIZE_WORDS * 2)
+
+/*! Every n-th synthetic frame is a dummy frame */
+#define DUMMY_FRAME_INTERVAL             UINT8_C(16)
+
+/*! Number of FIFO bytes parsed per benchmark case */
+#define BENCH_TOTAL_BYTES                UINT32_C(64 * 1024 * 1024)
+
+/*! Maximum number of frames in a FIFO dump, shortest frame is 2 bytes */
+#define MAX_FRAME_COUNT                  (FIFO_SIZE_BYTES / 2)
+
+/*! Result of a case whose output differs from the expected output */
+#define BENCH_E_MISMATCH                 INT8_C(-100)
+
+/******************************************************************************/
+/*!         Structure definition                                              */
+
+/*! Structure to define a benchmark case */
+struct bench_case
+{
+    /*! FIFO_CONF sensor enable value */
+    uint16_t fifo_conf;
+
+    /*! Name of the case */
+    const char *name;
+};
+
+/******************************************************************************/
+/*!         Static variable definition                                        */
+
+/*! Replayed FIFO data, the first byte is the SPI dummy byte */
+static uint8_t fifo_dump[FIFO_SIZE_BYTES + BMI3_MAX_DUMMY_BYTE];
+
+/*! Buffer the FIFO data is read into */
+static uint8_t fifo_buf[FIFO_SIZE_BYTES + BMI3_MAX_DUMMY_BYTE];
+
+/*! Number of valid FIFO data bytes in the dump */
+static uint16_t fifo_dump_len;
+
+/*! FIFO_CONF value returned by the mock bus */
+static uint16_t fifo_conf_reg;
+
+/*! Buffers to store the parsed frames */
+static struct bmi3_fifo_sens_axes_data accel_data[MAX_FRAME_COUNT];
+static struct bmi3_fifo_sens_axes_data gyro_data[MAX_FRAME_COUNT];
+static struct bmi3_fifo_temperature_data temp_data[MAX_FRAME_COUNT];
+
+/*! Buffers to store the frames parsed by the portable implementation, the reference of the SIMD backend */
+static struct bmi3_fifo_sens_axes_data ref_accel_data[MAX_FRAME_COUNT];
+static struct bmi3_fifo_sens_axes_data ref_gyro_data[MAX_FRAME_COUNT];
+
+/*! Arrays of the planes extracted by the SIMD backend and by the portable implementation */
+static int16_t plane_x[2][MAX_FRAME_COUNT];
+static int16_t plane_y[2][MAX_FRAME_COUNT];
+static int16_t plane_z[2][MAX_FRAME_COUNT];
+static uint32_t plane_time[2][MAX_FRAME_COUNT];
+
+/*! Sensor combinations of FIFO_CONF which carry sensor data */
+static const struct bench_case bench_cases[] = {
+    { BMI3_FIFO_ACC_EN, "acc" },
+    { BMI3_FIFO_GYR_EN, "gyr" },
+    { BMI3_FIFO_TEMP_EN, "temp" },
+    { BMI3_FIFO_ACC_EN | BMI3_FIFO_GYR_EN, "acc+gyr" },
+    { BMI3_FIFO_ACC_EN | BMI3_FIFO_TEMP_EN, "acc+temp" },
+    { BMI3_FIFO_GYR_EN | BMI3_FIFO_TEMP_EN, "gyr+temp" },
+    { BMI3_FIFO_ACC_EN | BMI3_FIFO_GYR_EN | BMI3_FIFO_TEMP_EN, "acc+gyr+temp" },
+    { BMI3_FIFO_ACC_EN | BMI3_FIFO_TIME_EN, "acc+time" },
+    { BMI3_FIFO_GYR_EN | BMI3_FIFO_TIME_EN, "gyr+time" },
+    { BMI3_FIFO_TEMP_EN | BMI3_FIFO_TIME_EN, "temp+time" },
+    { BMI3_FIFO_ACC_EN | BMI3_FIFO_GYR_EN | BMI3_FIFO_TIME_EN, "acc+gyr+time" },
+    { BMI3_FIFO_ACC_EN | BMI3_FIFO_TEMP_EN | BMI3_FIFO_TIME_EN, "acc+temp+time" },
+    { BMI3_FIFO_GYR_EN | BMI3_FIFO_TEMP_EN | BMI3_FIFO_TIME_EN, "gyr+temp+time" },
+    { BMI3_FIFO_ALL_EN, "all" }
+};
+
+/******************************************************************************/
+/*!           Static Function Declaration                                     */
+
+/*!
+ *  @brief This internal API replays the FIFO configuration and FIFO data registers.
+ *
+ *  @param[in] reg_addr : Register address.
+ *  @param[out] reg_data : Buffer for the read data.
+ *  @param[in] len : Number of bytes to read.
+ *  @param[in] intf_ptr : Interface pointer.
+ *
+ *  @return Status of execution
+ */
+static BMI3_INTF_RET_TYPE mock_read(uint8_t reg_addr, uint8_t *reg_data, uint32_t len, void *intf_ptr);
+
+/*!
+ *  @brief This internal API ignores register writes.
+ *
+ *  @param[in] reg_addr : Register address.
+ *  @param[in] reg_data : Data to be written.
+ *  @param[in] len : Number of bytes to write.
+ *  @param[in] intf_ptr : Interface pointer.
+ *
+ *  @return Status of execution
+ */
+static BMI3_INTF_RET_TYPE mock_write(uint8_t reg_addr, const uint8_t *reg_data, uint32_t len, void *intf_ptr);
+
+/*!
+ *  @brief This internal API ignores delays.
+ *
+ *  @param[in] period : Delay in microseconds.
+ *  @param[in] intf_ptr : Interface pointer.
+ */
+static void mock_delay_us(uint32_t period, void *intf_ptr);
+
+/*!
+ *  @brief This internal API returns the frame length of a FIFO configuration.
+ *
+ *  @param[in] fifo_conf : FIFO_CONF sensor enable value.
+ *
+ *  @return Frame length in bytes
+ */
+static uint8_t get_frame_len(uint16_t fifo_conf);
+
+/*!
+ *  @brief This internal API fills the FIFO dump with synthetic frames, every
+ *  DUMMY_FRAME_INTERVAL-th frame being a dummy frame and the last frame being
+ *  cut in half.
+ *
+ *  @param[in] fifo_conf : FIFO_CONF sensor enable value.
+ */
+static void fill_synthetic_dump(uint16_t fifo_conf);
+
+/*!
+ *  @brief This internal API tells whether a synthetic frame is a dummy frame.
+ *
+ *  @param[in] frame : Index of the frame.
+ *
+ *  @return 1 for a dummy frame, 0 otherwise
+ */
+static uint8_t is_dummy_frame(uint16_t frame);
+
+/*!
+ *  @brief This internal API returns the accelerometer or gyro data of a
+ *  synthetic frame which is not a dummy frame.
+ *
+ *  @param[in]  sens_sel : BMI3_FIFO_ACC_EN or BMI3_FIFO_GYR_EN.
+ *  @param[in]  frame    : Index of the frame.
+ *  @param[out] axes     : Data of the frame, with the sensor time of the frame.
+ */
+static void get_synthetic_axes(uint16_t sens_sel, uint16_t frame, struct bmi3_fifo_sens_axes_data *axes);
+
+/*!
+ *  @brief This internal API returns the sensor time of a synthetic frame.
+ *
+ *  @param[in] frame : Index of the frame.
+ *
+ *  @return Sensor time
+ */
+static uint16_t get_synthetic_time(uint16_t frame);
+
+/*!
+ *  @brief This internal API stores a word in little-endian order.
+ *
+ *  @param[out] ptr  : Buffer of 2 bytes.
+ *  @param[in]  word : Word to be stored.
+ */
+static void put_word(uint8_t *ptr, uint16_t word);
+
+/*!
+ *  @brief This internal API returns the byte offset of a sensor in the frame
+ *  of a FIFO configuration.
+ *
+ *  @param[in] fifo_conf : FIFO_CONF sensor enable value.
+ *  @param[in] sens_sel  : BMI3_FIFO_ACC_EN, BMI3_FIFO_GYR_EN, BMI3_FIFO_TEMP_EN or BMI3_FIFO_TIME_EN.
+ *
+ *  @return Byte offset
+ */
+static uint8_t get_sensor_offset(uint16_t fifo_conf, uint16_t sens_sel);
+
+/*!
+ *  @brief This internal API returns the sensor time the driver reports for a
+ *  synthetic frame, 0 if the sensor time is not enabled or cut off.
+ *
+ *  @param[in] frame : Index of the frame.
+ *
+ *  @return Sensor time
+ */
+static uint16_t get_expected_time(uint16_t frame);
+
+/*!
+ *  @brief This internal API checks the accelerometer or gyro frames extracted
+ *  from the synthetic dump against the values written to it. Dummy frames and
+ *  the incomplete frame at the end must be dropped.
+ *
+ *  @param[in] sens_sel : BMI3_FIFO_ACC_EN or BMI3_FIFO_GYR_EN.
+ *  @param[in] data     : Extracted frames.
+ *  @param[in] count    : Number of extracted frames.
+ *
+ *  @return 0 -> Success, BENCH_E_MISMATCH -> Fail
+ */
+static int8_t check_synthetic_axes(uint16_t sens_sel, const struct bmi3_fifo_sens_axes_data *data, uint16_t count);
+
+/*!
+ *  @brief This internal API checks the temperature frames extracted from the
+ *  synthetic dump against the values written to it.
+ *
+ *  @param[in] data  : Extracted frames.
+ *  @param[in] count : Number of extracted frames.
+ *
+ *  @return 0 -> Success, BENCH_E_MISMATCH -> Fail
+ */
+static int8_t check_synthetic_temp(const struct bmi3_fifo_temperature_data *data, uint16_t count);
+
+/*!
+ *  @brief This internal API checks the frames extracted from the synthetic
+ *  dump for all sensors of the FIFO configuration.
+ *
+ *  @param[in] pass      : Name of the extraction.
+ *  @param[in] fifoframe : Structure instance of bmi3_fifo_frame.
+ *
+ *  @return 0 -> Success, BENCH_E_MISMATCH -> Fail
+ */
+static int8_t check_synthetic(const char *pass, const struct bmi3_fifo_frame *fifoframe);
+
+/*!
+ *  @brief This internal API loads a raw FIFO dump from a file.
+ *
+ *  @param[in] file_name : Name of the dump file.
+ *
+ *  @return 0 -> Success, < 0 -> Fail
+ */
+static int8_t load_dump(const char *file_name);
+
+/*!
+ *  @brief This internal API returns a monotonic time stamp in nanoseconds.
+ *
+ *  @return Time stamp in nanoseconds
+ */
+static uint64_t get_time_ns(void);
+
+/*!
+ *  @brief This internal API times the single pass extraction of all sensors.
+ *
+ *  @param[in,out] fifoframe  : Structure instance of bmi3_fifo_frame.
+ *  @param[in]     iterations : Number of times the dump is read and parsed.
+ *  @param[out]    time_ns    : Time in nanoseconds of all iterations.
+ *  @param[in]     dev        : Structure instance of bmi3_dev.
+ *
+ *  @return 0 -> Success, < 0 -> Fail
+ */
+static int8_t time_extract_all(struct bmi3_fifo_frame *fifoframe,
+                               uint32_t iterations,
+                               uint64_t *time_ns,
+                               struct bmi3_dev *dev);
+
+/*!
+ *  @brief This internal API compares two arrays of parsed accelerometer or gyro frames.
+ *
+ *  @param[in] data  : Frames to be checked.
+ *  @param[in] ref   : Expected frames.
+ *  @param[in] count : Number of frames.
+ *
+ *  @return 0 if the frames are equal, BENCH_E_MISMATCH otherwise
+ */
+static int8_t compare_axes(const struct bmi3_fifo_sens_axes_data *data,
+                           const struct bmi3_fifo_sens_axes_data *ref,
+                           uint16_t count);
+
+/*!
+ *  @brief This internal API checks the planes extracted by the SIMD backend
+ *  against the portable implementation.
+ *
+ *  @param[in] sens_sel : BMI3_FIFO_ACC_EN or BMI3_FIFO_GYR_EN.
+ *  @param[in] dev      : Structure instance of bmi3_dev.
+ *
+ *  @return 0 -> Success, < 0 -> Fail
+ */
+static int8_t check_simd_planes(uint16_t sens_sel, struct bmi3_dev *dev);
+
+/*!
+ *  @brief This internal API checks the structure output of the SIMD backend
+ *  against the portable implementation.
+ *
+ *  @param[in] ref_frame : FIFO frame parsed by the portable implementation.
+ *  @param[in] fifoframe : FIFO frame parsed by the SIMD backend.
+ *
+ *  @return 0 -> Success, < 0 -> Fail
+ */
+static int8_t check_simd_frames(const struct bmi3_fifo_frame *ref_frame, const struct bmi3_fifo_frame *fifoframe);
+
+/*!
+ *  @brief This internal API benchmarks the FIFO read and parse path of the
+ *  dump for the single pass and the per-sensor extraction.
+ *
+ *  @param[in] name      : Name of the benchmark case.
+ *  @param[in] synthetic : 1 if the dump holds synthetic frames, whose values are checked.
+ *  @param[in] dev       : Structure instance of bmi3_dev.
+ *
+ *  @return 0 -> Success, < 0 -> Fail
+ */
+static int8_t run_benchmark(const char *name, uint8_t synthetic, struct bmi3_dev *dev);
+
+/******************************************************************************/
+/*!            Functions                                        */
+
+/* This function starts the execution of program. */
+int main(int argc, char *argv[])
+{
+    /* Status of API are returned to this variable. */
+    int8_t rslt = BMI323_OK;
+
+    /* Sensor initialization configuration. */
+    struct bmi3_dev dev = { 0 };
+
+    uint8_t index;
+
+    /* The mock bus stands in for a sensor which is already initialized */
+    dev.intf = BMI3_SPI_INTF;
+    dev.dummy_byte = 1;
+    dev.read = mock_read;
+    dev.write = mock_write;
+    dev.delay_us = mock_delay_us;
+    dev.read_write_len = 32;
+    dev.acc_corr = NULL;
+    dev.gyr_corr = NULL;
+
+    printf("FIFO SIMD backend : %s\n", bmi3_fifo_simd_backend());
+    printf("%-14s %6s %8s %8s %12s %12s %12s %10s\n", "case", "bytes", "frames", "dummy", "all ns/frm", "each ns/frm",
+           "simd ns/frm", "all MB/s");
+
+    if (argc == 3)
+    {
+        fifo_conf_reg = (uint16_t)(strtoul(argv[2], NULL, 0) & BMI3_FIFO_ALL_EN);
+
+        rslt = load_dump(argv[1]);
+
+        if (rslt == BMI323_OK)
+        {
+            rslt = run_benchmark(argv[1], 0, &dev);
+        }
+    }
+    else if (argc == 1)
+    {
+        for (index = 0; (index < (sizeof(bench_cases) / sizeof(bench_cases[0]))) && (rslt == BMI323_OK); index++)
+        {
+            fifo_conf_reg = bench_cases[index].fifo_conf;
+            fill_synthetic_dump(fifo_conf_reg);
+
+            rslt = run_benchmark(bench_cases[index].name, 1, &dev);
+        }
+    }
+    else
+    {
+        printf("Usage : %s [<dump file> <FIFO_CONF value>]\n", argv[0]);
+        rslt = BMI3_E_INVALID_INPUT;
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This internal API replays the FIFO configuration and FIFO data registers.
+ */
+static BMI3_INTF_RET_TYPE mock_read(uint8_t reg_addr, uint8_t *reg_data, uint32_t len, void *intf_ptr)
+{
+    (void)intf_ptr;
+
+    memset(reg_data, 0, len);
+
+    switch (reg_addr & (uint8_t)~BMI3_SPI_RD_MASK)
+    {
+        case BMI3_REG_FIFO_CONF:
+            if (len >= 3)
+            {
+                reg_data[1] = (uint8_t)(fifo_conf_reg & 0xFF);
+                reg_data[2] = (uint8_t)(fifo_conf_reg >> 8);
+            }
+
+            break;
+
+        case BMI3_REG_FIFO_DATA:
+            if (len > sizeof(fifo_dump))
+            {
+                len = sizeof(fifo_dump);
+            }
+
+            memcpy(reg_data, fifo_dump, len);
+            break;
+
+        default:
+            break;
+    }
+
+    return BMI3_INTF_RET_SUCCESS;
+}
+
+/*!
+ * @brief This internal API ignores register writes.
+ */
+static BMI3_INTF_RET_TYPE mock_write(uint8_t reg_addr, const uint8_t *reg_data, uint32_t len, void *intf_ptr)
+{
+    (void)reg_addr;
+    (void)reg_data;
+    (void)len;
+    (void)intf_ptr;
+
+    return BMI3_INTF_RET_SUCCESS;
+}
+
+/*!
+ * @brief This internal API ignores delays.
+ */
+static void mock_delay_us(uint32_t period, void *intf_ptr)
+{
+    (void)period;
+    (void)intf_ptr;
+}
+
+/*!
+ * @brief This internal API returns the frame length of a FIFO configuration.
+ */
+static uint8_t get_frame_len(uint16_t fifo_conf)
+{
+    uint8_t frame_len = 0;
+
+    if (fifo_conf & BMI3_FIFO_ACC_EN)
+    {
+        frame_len += BMI3_LENGTH_FIFO_ACC;
+    }
+
+    if (fifo_conf & BMI3_FIFO_GYR_EN)
+    {
+        frame_len += BMI3_LENGTH_FIFO_GYR;
+    }
+
+    if (fifo_conf & BMI3_FIFO_TEMP_EN)
+    {
+        frame_len += BMI3_LENGTH_TEMPERATURE;
+    }
+
+    if (fifo_conf & BMI3_FIFO_TIME_EN)
+    {
+        frame_len += BMI3_LENGTH_SENSOR_TIME;
+    }
+
+    return frame_len;
+}
+
+/*!
+ * @brief This internal API fills the FIFO dump with synthetic frames.
+ */
+static void fill_synthetic_dump(uint16_t fifo_conf)
+{
+    uint8_t frame_len = get_frame_len(fifo_conf);
+    uint16_t frame_count = (uint16_t)(FIFO_SIZE_BYTES / frame_len);
+    uint16_t frame;
+    uint8_t *ptr = &fifo_dump[1];
+    uint8_t dummy;
+    struct bmi3_fifo_sens_axes_data axes;
+
+    for (frame = 0; frame < frame_count; frame++)
+    {
+        dummy = is_dummy_frame(frame);
+
+        if (fifo_conf & BMI3_FIFO_ACC_EN)
+        {
+            get_synthetic_axes(BMI3_FIFO_ACC_EN, frame, &axes);
+            put_word(&ptr[0], dummy ? BMI3_FIFO_ACCEL_DUMMY_FRAME : (uint16_t)axes.x);
+            put_word(&ptr[2], (uint16_t)axes.y);
+            put_word(&ptr[4], (uint16_t)axes.z);
+            ptr += BMI3_LENGTH_FIFO_ACC;
+        }
+
+        if (fifo_conf & BMI3_FIFO_GYR_EN)
+        {
+            get_synthetic_axes(BMI3_FIFO_GYR_EN, frame, &axes);
+            put_word(&ptr[0], dummy ? BMI3_FIFO_GYRO_DUMMY_FRAME : (uint16_t)axes.x);
+            put_word(&ptr[2], (uint16_t)axes.y);
+            put_word(&ptr[4], (uint16_t)axes.z);
+            ptr += BMI3_LENGTH_FIFO_GYR;
+        }
+
+        if (fifo_conf & BMI3_FIFO_TEMP_EN)
+        {
+            put_word(ptr, dummy ? BMI3_FIFO_TEMP_DUMMY_FRAME : (uint16_t)(0x0200 + frame));
+            ptr += BMI3_LENGTH_TEMPERATURE;
+        }
+
+        if (fifo_conf & BMI3_FIFO_TIME_EN)
+        {
+            put_word(ptr, get_synthetic_time(frame));
+            ptr += BMI3_LENGTH_SENSOR_TIME;
+        }
+    }
+
+    /* Cut the last frame in half, as when the FIFO is read while being filled */
+    fifo_dump_len = (uint16_t)((frame_count * frame_len) - ((frame_len / 4) * 2));
+}
+
+/*!
+ * @brief This internal API tells whether a synthetic frame is a dummy frame.
+ */
+static uint8_t is_dummy_frame(uint16_t frame)
+{
+    return (uint8_t)((frame % DUMMY_FRAME_INTERVAL) == (DUMMY_FRAME_INTERVAL - 1));
+}
+
+/*!
+ * @brief This internal API returns the accelerometer or gyro data of a synthetic frame.
+ */
+static void get_synthetic_axes(uint16_t sens_sel, uint16_t frame, struct bmi3_fifo_sens_axes_data *axes)
+{
+    if (sens_sel == BMI3_FIFO_ACC_EN)
+    {
+        axes->x = (int16_t)(uint16_t)(frame * 3);
+        axes->y = (int16_t)(0x1000 | (frame & 0xFF));
+        axes->z = (int16_t)0x4000;
+    }
+    else
+    {
+        axes->x = (int16_t)(uint16_t)(frame * 5);
+        axes->y = (int16_t)(uint16_t)(((frame & 0xFF) << 8) | 0x20);
+        axes->z = (int16_t)(uint16_t)0xFF01;
+    }
+
+    axes->sensor_time = get_synthetic_time(frame);
+}
+
+/*!
+ * @brief This internal API returns the sensor time of a synthetic frame.
+ */
+static uint16_t get_synthetic_time(uint16_t frame)
+{
+    return (uint16_t)(frame * 40);
+}
+
+/*!
+ * @brief This internal API stores a word in little-endian order.
+ */
+static void put_word(uint8_t *ptr, uint16_t word)
+{
+    ptr[0] = (uint8_t)(word & 0xFF);
+    ptr[1] = (uint8_t)(word >> 8);
+}
+
+/*!
+ * @brief This internal API returns the byte offset of a sensor in the frame.
+ */
+static uint8_t get_sensor_offset(uint16_t fifo_conf, uint16_t sens_sel)
+{
+    /* Sensors are stored in the order accelerometer, gyro, temperature, sensor time */
+    uint16_t preceding = (uint16_t)(BMI3_FIFO_ALL_EN & ~BMI3_FIFO_TIME_EN);
+
+    if (sens_sel != BMI3_FIFO_TIME_EN)
+    {
+        preceding &= (uint16_t)(sens_sel - 1);
+    }
+
+    return get_frame_len(fifo_conf & preceding);
+}
+
+/*!
+ * @brief This internal API returns the sensor time the driver reports for a synthetic frame.
+ */
+static uint16_t get_expected_time(uint16_t frame)
+{
+    uint16_t sensor_time = 0;
+    uint32_t time_end = ((uint32_t)frame * get_frame_len(fifo_conf_reg)) +
+                        get_sensor_offset(fifo_conf_reg, BMI3_FIFO_TIME_EN) + BMI3_LENGTH_SENSOR_TIME;
+
+    if ((fifo_conf_reg & BMI3_FIFO_TIME_EN) && (time_end <= fifo_dump_len))
+    {
+        sensor_time = get_synthetic_time(frame);
+    }
+
+    return sensor_time;
+}
+
+/*!
+ * @brief This internal API checks the accelerometer or gyro frames extracted
+ * from the synthetic dump.
+ */
+static int8_t check_synthetic_axes(uint16_t sens_sel, const struct bmi3_fifo_sens_axes_data *data, uint16_t count)
+{
+    int8_t rslt = BMI323_OK;
+    uint8_t frame_len = get_frame_len(fifo_conf_reg);
+    uint8_t offset = get_sensor_offset(fifo_conf_reg, sens_sel);
+    uint16_t frame;
+    uint16_t index = 0;
+    struct bmi3_fifo_sens_axes_data axes;
+
+    /* Data of the incomplete frame at the end is reported if it is complete for the sensor */
+    for (frame = 0;
+         (rslt == BMI323_OK) && ((((uint32_t)frame * frame_len) + offset + BMI3_LENGTH_FIFO_ACC) <= fifo_dump_len);
+         frame++)
+    {
+        if (!is_dummy_frame(frame))
+        {
+            get_synthetic_axes(sens_sel, frame, &axes);
+            axes.sensor_time = get_expected_time(frame);
+
+            if ((index >= count) || (data[index].x != axes.x) || (data[index].y != axes.y) ||
+                (data[index].z != axes.z) || (data[index].sensor_time != axes.sensor_time))
+            {
+                printf("%s frame %u is not extracted as written\n",
+                       (sens_sel == BMI3_FIFO_ACC_EN) ? "accel" : "gyro",
+                       (unsigned int)frame);
+                rslt = BENCH_E_MISMATCH;
+            }
+
+            index++;
+        }
+    }
+
+    if ((rslt == BMI323_OK) && (index != count))
+    {
+        printf("%u %s frames instead of %u\n",
+               (unsigned int)count,
+               (sens_sel == BMI3_FIFO_ACC_EN) ? "accel" : "gyro",
+               (unsigned int)index);
+        rslt = BENCH_E_MISMATCH;
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This internal API checks the temperature frames extracted from the
+ * synthetic dump.
+ */
+static int8_t check_synthetic_temp(const struct bmi3_fifo_temperature_data *data, uint16_t count)
+{
+    int8_t rslt = BMI323_OK;
+    uint8_t frame_len = get_frame_len(fifo_conf_reg);
+    uint8_t offset = get_sensor_offset(fifo_conf_reg, BMI3_FIFO_TEMP_EN);
+    uint16_t frame;
+    uint16_t index = 0;
+
+    for (frame = 0;
+         (rslt == BMI323_OK) && ((((uint32_t)frame * frame_len) + offset + BMI3_LENGTH_TEMPERATURE) <= fifo_dump_len);
+         frame++)
+    {
+        if (!is_dummy_frame(frame))
+        {
+            if ((index >= count) || (data[index].temp_data != (uint16_t)(0x0200 + frame)) ||
+                (data[index].sensor_time != get_expected_time(frame)))
+            {
+                printf("temperature frame %u is not extracted as written\n", (unsigned int)frame);
+                rslt = BENCH_E_MISMATCH;
+            }
+
+            index++;
+        }
+    }
+
+    if ((rslt == BMI323_OK) && (index != count))
+    {
+        printf("%u temperature frames instead of %u\n", (unsigned int)count, (unsigned int)index);
+        rslt = BENCH_E_MISMATCH;
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This internal API checks the frames extracted from the synthetic dump
+ * for all sensors of the FIFO configuration.
+ */
+static int8_t check_synthetic(const char *pass, const struct bmi3_fifo_frame *fifoframe)
+{
+    int8_t rslt = BMI323_OK;
+
+    if (fifo_conf_reg & BMI3_FIFO_ACC_EN)
+    {
+        rslt = check_synthetic_axes(BMI3_FIFO_ACC_EN, accel_data, fifoframe->avail_fifo_accel_frames);
+    }
+
+    if ((rslt == BMI323_OK) && (fifo_conf_reg & BMI3_FIFO_GYR_EN))
+    {
+        rslt = check_synthetic_axes(BMI3_FIFO_GYR_EN, gyro_data, fifoframe->avail_fifo_gyro_frames);
+    }
+
+    if ((rslt == BMI323_OK) && (fifo_conf_reg & BMI3_FIFO_TEMP_EN))
+    {
+        rslt = check_synthetic_temp(temp_data, fifoframe->avail_fifo_temp_frames);
+    }
+
+    if (rslt != BMI323_OK)
+    {
+        printf("%s extraction differs from the synthetic frames\n", pass);
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This internal API loads a raw FIFO dump from a file.
+ */
+static int8_t load_dump(const char *file_name)
+{
+    int8_t rslt = BMI323_OK;
+    FILE *file = fopen(file_name, "rb");
+
+    if (file != NULL)
+    {
+        fifo_dump_len = (uint16_t)fread(&fifo_dump[1], 1, FIFO_SIZE_BYTES, file);
+        fclose(file);
+
+        /* FIFO length is counted in words */
+        fifo_dump_len &= (uint16_t)~1u;
+
+        if (fifo_dump_len == 0)
+        {
+            rslt = BMI3_E_INVALID_INPUT;
+        }
+    }
+    else
+    {
+        printf("Cannot open %s\n", file_name);
+        rslt = BMI3_E_INVALID_INPUT;
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This internal API returns a monotonic time stamp in nanoseconds.
+ */
+static uint64_t get_time_ns(void)
+{
+    struct timespec now;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return ((uint64_t)now.tv_sec * 1000000000u) + (uint64_t)now.tv_nsec;
+}
+
+/*!
+ * @brief This internal API times the single pass extraction of all sensors.
+ */
+static int8_t time_extract_all(struct bmi3_fifo_frame *fifoframe,
+                               uint32_t iterations,
+                               uint64_t *time_ns,
+                               struct bmi3_dev *dev)
+{
+    int8_t rslt = BMI323_OK;
+    int8_t parse_rslt;
+    uint32_t loop;
+    uint64_t start = get_time_ns();
+
+    for (loop = 0; (loop < iterations) && (rslt == BMI323_OK); loop++)
+    {
+        fifoframe->available_fifo_len = (uint16_t)(fifo_dump_len / 2);
+        fifoframe->length = (uint16_t)(fifo_dump_len + dev->dummy_byte);
+
+        rslt = bmi323_read_fifo_data(fifoframe, dev);
+
+        if (rslt == BMI323_OK)
+        {
+            parse_rslt = bmi323_extract_all(accel_data, gyro_data, temp_data, fifoframe, dev);
+
+            /* Warnings report dummy frames and the partial tail */
+            if (parse_rslt < BMI323_OK)
+            {
+                rslt = parse_rslt;
+            }
+        }
+    }
+
+    *time_ns = get_time_ns() - start;
+
+    return rslt;
+}
+
+/*!
+ * @brief This internal API compares two arrays of parsed accelerometer or gyro frames.
+ */
+static int8_t compare_axes(const struct bmi3_fifo_sens_axes_data *data,
+                           const struct bmi3_fifo_sens_axes_data *ref,
+                           uint16_t count)
+{
+    int8_t rslt = BMI323_OK;
+    uint16_t index;
+
+    for (index = 0; (index < count) && (rslt == BMI323_OK); index++)
+    {
+        if ((data[index].x != ref[index].x) || (data[index].y != ref[index].y) || (data[index].z != ref[index].z) ||
+            (data[index].sensor_time != ref[index].sensor_time))
+        {
+            printf("frame %u differs\n", (unsigned int)index);
+            rslt = BENCH_E_MISMATCH;
+        }
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This internal API checks the planes extracted by the SIMD backend
+ * against the portable implementation.
+ */
+static int8_t check_simd_planes(uint16_t sens_sel, struct bmi3_dev *dev)
+{
+    int8_t rslt = BMI323_OK;
+    struct bmi3_fifo_frame fifoframe[2] = { { 0 } };
+    struct bmi3_fifo_sens_axes_planes planes;
+    uint16_t count[2];
+    uint16_t index;
+    uint8_t pass;
+
+    /* Pass 0 with the SIMD backend, pass 1 with the portable implementation */
+    for (pass = 0; (pass < 2) && (rslt == BMI323_OK); pass++)
+    {
+        dev->fifo_unpack_axes = (pass == 0) ? bmi3_fifo_simd_unpack_axes : NULL;
+
+        planes.x = plane_x[pass];
+        planes.y = plane_y[pass];
+        planes.z = plane_z[pass];
+        planes.sensor_time = plane_time[pass];
+
+        fifoframe[pass].data = fifo_buf;
+        fifoframe[pass].available_fifo_len = (uint16_t)(fifo_dump_len / 2);
+        fifoframe[pass].length = (uint16_t)(fifo_dump_len + dev->dummy_byte);
+
+        rslt = bmi323_read_fifo_data(&fifoframe[pass], dev);
+
+        if ((rslt == BMI323_OK) && (sens_sel == BMI3_FIFO_ACC_EN))
+        {
+            rslt = bmi323_extract_accel_planes(&planes, &fifoframe[pass], dev);
+            count[pass] = fifoframe[pass].avail_fifo_accel_frames;
+        }
+        else if (rslt == BMI323_OK)
+        {
+            rslt = bmi323_extract_gyro_planes(&planes, &fifoframe[pass], dev);
+            count[pass] = fifoframe[pass].avail_fifo_gyro_frames;
+        }
+
+        rslt = (rslt < BMI323_OK) ? rslt : BMI323_OK;
+    }
+
+    dev->fifo_unpack_axes = NULL;
+
+    if ((rslt == BMI323_OK) && (count[0] != count[1]))
+    {
+        printf("%u planes frames instead of %u\n", (unsigned int)count[0], (unsigned int)count[1]);
+        rslt = BENCH_E_MISMATCH;
+    }
+
+    for (index = 0; (rslt == BMI323_OK) && (index < count[0]); index++)
+    {
+        if ((plane_x[0][index] != plane_x[1][index]) || (plane_y[0][index] != plane_y[1][index]) ||
+            (plane_z[0][index] != plane_z[1][index]) || (plane_time[0][index] != plane_time[1][index]))
+        {
+            printf("planes frame %u differs\n", (unsigned int)index);
+            rslt = BENCH_E_MISMATCH;
+        }
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This internal API checks the structure output of the SIMD backend
+ * against the portable implementation.
+ */
+static int8_t check_simd_frames(const struct bmi3_fifo_frame *ref_frame, const struct bmi3_fifo_frame *fifoframe)
+{
+    int8_t rslt = BMI323_OK;
+
+    if ((fifoframe->avail_fifo_accel_frames != ref_frame->avail_fifo_accel_frames) ||
+        (fifoframe->avail_fifo_gyro_frames != ref_frame->avail_fifo_gyro_frames))
+    {
+        printf("%u/%u frames instead of %u/%u\n",
+               (unsigned int)fifoframe->avail_fifo_accel_frames,
+               (unsigned int)fifoframe->avail_fifo_gyro_frames,
+               (unsigned int)ref_frame->avail_fifo_accel_frames,
+               (unsigned int)ref_frame->avail_fifo_gyro_frames);
+        rslt = BENCH_E_MISMATCH;
+    }
+
+    if ((rslt == BMI323_OK) && (fifo_conf_reg & BMI3_FIFO_ACC_EN))
+    {
+        rslt = compare_axes(accel_data, ref_accel_data, fifoframe->avail_fifo_accel_frames);
+    }
+
+    if ((rslt == BMI323_OK) && (fifo_conf_reg & BMI3_FIFO_GYR_EN))
+    {
+        rslt = compare_axes(gyro_data, ref_gyro_data, fifoframe->avail_fifo_gyro_frames);
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This internal API benchmarks the FIFO read and parse path of the dump.
+ */
+static int8_t run_benchmark(const char *name, uint8_t synthetic, struct bmi3_dev *dev)
+{
+    int8_t rslt;
+    int8_t parse_rslt;
+    struct bmi3_fifo_frame fifoframe = { 0 };
+    struct bmi3_fifo_frame ref_frame;
+    uint32_t iterations = BENCH_TOTAL_BYTES / fifo_dump_len;
+    uint32_t loop;
+    uint32_t frames;
+    uint32_t dummy_frames;
+    uint32_t parsed = 0;
+    uint64_t start;
+    uint64_t all_ns;
+    uint64_t each_ns = 0;
+    uint64_t simd_ns = 0;
+
+    fifoframe.data = fifo_buf;
+
+    /* Single pass extraction of all sensors */
+    rslt = time_extract_all(&fifoframe, iterations, &all_ns, dev);
+
+    if ((rslt == BMI323_OK) && synthetic)
+    {
+        rslt = check_synthetic("single pass", &fifoframe);
+    }
+
+    /* Output of the portable implementation is the reference of the SIMD backend */
+    ref_frame = fifoframe;
+    memcpy(ref_accel_data, accel_data, sizeof(accel_data));
+    memcpy(ref_gyro_data, gyro_data, sizeof(gyro_data));
+
+    /* Extraction sensor by sensor */
+    start = get_time_ns();
+
+    for (loop = 0; (loop < iterations) && (rslt == BMI323_OK); loop++)
+    {
+        fifoframe.available_fifo_len = (uint16_t)(fifo_dump_len / 2);
+        fifoframe.length = (uint16_t)(fifo_dump_len + dev->dummy_byte);
+
+        rslt = bmi323_read_fifo_data(&fifoframe, dev);
+
+        if ((rslt == BMI323_OK) && (fifo_conf_reg & BMI3_FIFO_ACC_EN))
+        {
+            parse_rslt = bmi323_extract_accel(accel_data, &fifoframe, dev);
+            rslt = (parse_rslt < BMI323_OK) ? parse_rslt : BMI323_OK;
+        }
+
+        if ((rslt == BMI323_OK) && (fifo_conf_reg & BMI3_FIFO_GYR_EN))
+        {
+            parse_rslt = bmi323_extract_gyro(gyro_data, &fifoframe, dev);
+            rslt = (parse_rslt < BMI323_OK) ? parse_rslt : BMI323_OK;
+        }
+
+        if ((rslt == BMI323_OK) && (fifo_conf_reg & BMI3_FIFO_TEMP_EN))
+        {
+            parse_rslt = bmi323_extract_temperature(temp_data, &fifoframe, dev);
+            rslt = (parse_rslt < BMI323_OK) ? parse_rslt : BMI323_OK;
+        }
+    }
+
+    each_ns = get_time_ns() - start;
+
+    if ((rslt == BMI323_OK) && synthetic)
+    {
+        rslt = check_synthetic("per-sensor", &fifoframe);
+    }
+
+    /* Single pass extraction of all sensors with the SIMD backend */
+    if (rslt == BMI323_OK)
+    {
+        bmi3_fifo_simd_attach(dev);
+
+        rslt = time_extract_all(&fifoframe, iterations, &simd_ns, dev);
+
+        dev->fifo_unpack_axes = NULL;
+        dev->fifo_unpack_frames = NULL;
+    }
+
+    if (rslt == BMI323_OK)
+    {
+        rslt = check_simd_frames(&ref_frame, &fifoframe);
+    }
+
+    if ((rslt == BMI323_OK) && (fifo_conf_reg & BMI3_FIFO_ACC_EN))
+    {
+        rslt = check_simd_planes(BMI3_FIFO_ACC_EN, dev);
+    }
+
+    if ((rslt == BMI323_OK) && (fifo_conf_reg & BMI3_FIFO_GYR_EN))
+    {
+        rslt = check_simd_planes(BMI3_FIFO_GYR_EN, dev);
+    }
+
+    if (rslt == BMI323_OK)
+    {
+        /* Complete frames in the dump, dummy frames are dropped from the output */
+        frames = fifo_dump_len / get_frame_len(fifo_conf_reg);
+
+        if (fifoframe.avail_fifo_accel_frames > parsed)
+        {
+            parsed = fifoframe.avail_fifo_accel_frames;
+        }
+
+        if (fifoframe.avail_fifo_gyro_frames > parsed)
+        {
+            parsed = fifoframe.avail_fifo_gyro_frames;
+        }
+
+        if (fifoframe.avail_fifo_temp_frames > parsed)
+        {
+            parsed = fifoframe.avail_fifo_temp_frames;
+        }
+
+        dummy_frames = frames - parsed;
+
+        printf("%-14s %6u %8lu %8lu %12.1f %12.1f %12.1f %10.1f\n",
+               name,
+               (unsigned int)fifo_dump_len,
+               (unsigned long)frames,
+               (unsigned long)dummy_frames,
+               (double)all_ns / ((double)frames * iterations),
+               (double)each_ns / ((double)frames * iterations),
+               (double)simd_ns / ((double)frames * iterations),
+               ((double)fifo_dump_len * iterations * 1000.0) / (double)all_ns);
+    }
+    else
+    {
+        printf("%-14s failed with %d\n", name, rslt);
+    }
+
+    return rslt;
+}
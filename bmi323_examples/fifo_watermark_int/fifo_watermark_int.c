@@ -82,7 +82,7 @@ static float lsb_to_dps(int16_t val, float dps, uint8_t bit_width);
 int main(void)
 {
     /* Sensor initialization configuration. */
-    struct bmi3_dev dev;
+    struct bmi3_dev dev = { 0 };
 
     /* Status of API are returned to this variable. */
     int8_t rslt;
@@ -0,0 +1,452 @@
+/**\
+ * Copyright (c) 2024 Bosch Sensortec GmbH. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ **/
+
+/******************************************************************************/
+/*!                 Header Files                                              */
+#define _POSIX_C_SOURCE 200809L
+
+#include <errno.h>
+#include <fcntl.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/ioctl.h>
+#include <linux/i2c-dev.h>
+#include "linux_bus.h"
+
+/******************************************************************************/
+/*!         Macros definition                                                */
+
+/*! Maximum delay of a queued SPI transfer in microseconds */
+#define LINUX_BUS_MAX_XFER_DELAY_US      UINT32_C(0xFFFF)
+
+/******************************************************************************/
+/*!           Static Function Declaration                                     */
+
+/*!
+ * @brief This internal API submits the queued transfers in one ioctl.
+ *
+ * @param[in,out] bus : Structure instance of linux_bus.
+ *
+ * @return 0 on success, -1 on failure
+ */
+static BMI3_INTF_RET_TYPE submit(struct linux_bus *bus);
+
+/*!
+ * @brief This internal API makes room for the given number of transfers and
+ * bytes of the write buffer, submitting the queued transfers if required.
+ *
+ * @param[in,out] bus    : Structure instance of linux_bus.
+ * @param[in]     n_xfer : Number of transfers.
+ * @param[in]     len    : Number of bytes of the write buffer.
+ *
+ * @return 0 on success, -1 on failure
+ */
+static BMI3_INTF_RET_TYPE reserve(struct linux_bus *bus, uint8_t n_xfer, uint32_t len);
+
+/*!
+ * @brief This internal API queues an SPI transfer or I2C message.
+ *
+ * @param[in,out] bus     : Structure instance of linux_bus.
+ * @param[in]     tx      : Data to be sent, NULL to receive.
+ * @param[out]    rx      : Data received, NULL to send.
+ * @param[in]     len     : Length of the transfer.
+ * @param[in]     end     : Non-zero for the last transfer of a bus transaction.
+ */
+static void queue(struct linux_bus *bus, const uint8_t *tx, uint8_t *rx, uint32_t len, uint8_t end);
+
+/*!
+ * @brief This internal API reads data from the sensor.
+ *
+ * @param[in]     reg_addr : 8bit register address of the sensor
+ * @param[out]    reg_data : Data from the specified address
+ * @param[in]     len      : Length of the reg_data array
+ * @param[in,out] intf_ptr : Structure instance of linux_bus.
+ *
+ * @return Status of execution.
+ */
+static BMI3_INTF_RET_TYPE linux_bus_read(uint8_t reg_addr, uint8_t *reg_data, uint32_t len, void *intf_ptr);
+
+/*!
+ * @brief This internal API writes data to the sensor, or queues the write
+ * during a batch.
+ *
+ * @param[in]     reg_addr : 8bit register address of the sensor
+ * @param[in]     reg_data : Data to the specified address
+ * @param[in]     len      : Length of the reg_data array
+ * @param[in,out] intf_ptr : Structure instance of linux_bus.
+ *
+ * @return Status of execution.
+ */
+static BMI3_INTF_RET_TYPE linux_bus_write(uint8_t reg_addr, const uint8_t *reg_data, uint32_t len, void *intf_ptr);
+
+/*!
+ * @brief This internal API waits for the given time. During an SPI batch the
+ * delay is added to the last queued transfer.
+ *
+ * @param[in]     period   : The time period in microseconds
+ * @param[in,out] intf_ptr : Structure instance of linux_bus.
+ */
+static void linux_bus_delay_us(uint32_t period, void *intf_ptr);
+
+/*!
+ * @brief This internal API starts a batch on request of the driver.
+ *
+ * @param[in,out] intf_ptr : Structure instance of linux_bus.
+ */
+static void linux_bus_batch_begin_cb(void *intf_ptr);
+
+/*!
+ * @brief This internal API ends a batch on request of the driver.
+ *
+ * @param[in,out] intf_ptr : Structure instance of linux_bus.
+ *
+ * @return Status of execution.
+ */
+static BMI3_INTF_RET_TYPE linux_bus_batch_end_cb(void *intf_ptr);
+
+/******************************************************************************/
+/*!               User interface functions                                    */
+
+/*!
+ * @brief This function opens a spidev or i2c-dev bus and hooks it into the
+ * device structure.
+ */
+int8_t linux_bus_open(struct linux_bus *bus,
+                      const char *path,
+                      enum bmi3_intf intf,
+                      uint32_t speed_hz,
+                      uint16_t i2c_addr,
+                      struct bmi3_dev *dev)
+{
+    int8_t rslt = BMI3_OK;
+    uint8_t mode = SPI_MODE_0;
+    uint8_t bits = 8;
+
+    if ((bus == NULL) || (path == NULL) || (dev == NULL))
+    {
+        return BMI3_E_NULL_PTR;
+    }
+
+    memset(bus, 0, sizeof(*bus));
+    bus->intf = intf;
+    bus->speed_hz = (speed_hz != 0) ? speed_hz : LINUX_BUS_SPI_HZ;
+    bus->i2c_addr = i2c_addr;
+    bus->fd = open(path, O_RDWR);
+
+    if (bus->fd < 0)
+    {
+        rslt = BMI3_E_COM_FAIL;
+    }
+    else if (intf == BMI3_SPI_INTF)
+    {
+        if ((ioctl(bus->fd, SPI_IOC_WR_MODE, &mode) < 0) || (ioctl(bus->fd, SPI_IOC_WR_BITS_PER_WORD, &bits) < 0) ||
+            (ioctl(bus->fd, SPI_IOC_WR_MAX_SPEED_HZ, &bus->speed_hz) < 0))
+        {
+            rslt = BMI3_E_COM_FAIL;
+        }
+    }
+    else if (intf != BMI3_I2C_INTF)
+    {
+        rslt = BMI3_E_INVALID_INPUT;
+    }
+
+    if (rslt == BMI3_OK)
+    {
+        dev->intf = intf;
+        dev->read = linux_bus_read;
+        dev->write = linux_bus_write;
+        dev->delay_us = linux_bus_delay_us;
+        dev->intf_ptr = bus;
+
+        /* Writes of the config array upload have to fit the write buffer on I2C */
+        dev->read_write_len = (intf == BMI3_SPI_INTF) ? LINUX_BUS_READ_WRITE_LEN : (LINUX_BUS_WBUF_LEN / 2);
+
+        dev->fifo_unpack_axes = NULL;
+        dev->fifo_unpack_frames = NULL;
+        dev->read_async = NULL;
+        dev->read_hdr = NULL;
+        dev->idle_time_us = 0;
+        dev->boot_cfg = NULL;
+        dev->upload_cfg = NULL;
+        dev->cache.enable = BMI3_DISABLE;
+        dev->fifo_wm_budget = NULL;
+        dev->lock = NULL;
+        dev->unlock = NULL;
+        dev->batch_begin = linux_bus_batch_begin_cb;
+        dev->batch_end = linux_bus_batch_end_cb;
+        dev->batch_depth = 0;
+        dev->acc_corr = NULL;
+        dev->gyr_corr = NULL;
+    }
+    else if (bus->fd >= 0)
+    {
+        (void)close(bus->fd);
+        bus->fd = -1;
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This function closes the bus.
+ */
+void linux_bus_close(struct linux_bus *bus)
+{
+    if ((bus != NULL) && (bus->fd >= 0))
+    {
+        bus->batch = 0;
+        (void)submit(bus);
+        (void)close(bus->fd);
+        bus->fd = -1;
+    }
+}
+
+/*!
+ * @brief This function starts a batch of writes.
+ */
+void linux_bus_batch_begin(struct linux_bus *bus)
+{
+    bus->batch++;
+}
+
+/*!
+ * @brief This function submits the queued writes and ends the batch.
+ */
+int8_t linux_bus_batch_end(struct linux_bus *bus)
+{
+    int8_t rslt = BMI3_OK;
+
+    if (bus->batch != 0)
+    {
+        bus->batch--;
+    }
+
+    /* Only the outermost batch submits, the driver batches within the batches of the application */
+    if ((bus->batch == 0) && (submit(bus) != BMI3_INTF_RET_SUCCESS))
+    {
+        rslt = BMI3_E_COM_FAIL;
+    }
+
+    return rslt;
+}
+
+/******************************************************************************/
+/*!               Static functions                                            */
+
+/*!
+ * @brief This internal API submits the queued transfers in one ioctl.
+ */
+static BMI3_INTF_RET_TYPE submit(struct linux_bus *bus)
+{
+    BMI3_INTF_RET_TYPE rslt = BMI3_INTF_RET_SUCCESS;
+    struct i2c_rdwr_ioctl_data rdwr;
+    int ret;
+
+    if (bus->n_xfer != 0)
+    {
+        if (bus->intf == BMI3_SPI_INTF)
+        {
+            /* Chip select is released at the end of the message */
+            bus->xfer[bus->n_xfer - 1].cs_change = 0;
+
+            ret = ioctl(bus->fd, SPI_IOC_MESSAGE(bus->n_xfer), bus->xfer);
+        }
+        else
+        {
+            rdwr.msgs = bus->msg;
+            rdwr.nmsgs = bus->n_xfer;
+
+            ret = ioctl(bus->fd, I2C_RDWR, &rdwr);
+        }
+
+        bus->ioctls++;
+
+        if (ret < 0)
+        {
+            rslt = -1;
+        }
+
+        bus->n_xfer = 0;
+        bus->wbuf_len = 0;
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This internal API makes room for the given number of transfers and
+ * bytes of the write buffer.
+ */
+static BMI3_INTF_RET_TYPE reserve(struct linux_bus *bus, uint8_t n_xfer, uint32_t len)
+{
+    BMI3_INTF_RET_TYPE rslt = BMI3_INTF_RET_SUCCESS;
+
+    if (((bus->n_xfer + n_xfer) > LINUX_BUS_MAX_XFER) || ((bus->wbuf_len + len) > LINUX_BUS_WBUF_LEN))
+    {
+        rslt = submit(bus);
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This internal API queues an SPI transfer or I2C message.
+ */
+static void queue(struct linux_bus *bus, const uint8_t *tx, uint8_t *rx, uint32_t len, uint8_t end)
+{
+    struct spi_ioc_transfer *xfer = &bus->xfer[bus->n_xfer];
+    struct i2c_msg *msg = &bus->msg[bus->n_xfer];
+
+    if (bus->intf == BMI3_SPI_INTF)
+    {
+        memset(xfer, 0, sizeof(*xfer));
+        xfer->tx_buf = (unsigned long)tx;
+        xfer->rx_buf = (unsigned long)rx;
+        xfer->len = len;
+        xfer->speed_hz = bus->speed_hz;
+        xfer->bits_per_word = 8;
+
+        /* Chip select is released between the bus transactions of a message */
+        xfer->cs_change = end ? 1 : 0;
+    }
+    else
+    {
+        msg->addr = bus->i2c_addr;
+        msg->flags = (rx != NULL) ? I2C_M_RD : 0;
+        msg->len = (uint16_t)len;
+        msg->buf = (rx != NULL) ? rx : (uint8_t *)tx;
+    }
+
+    bus->n_xfer++;
+}
+
+/*!
+ * @brief This internal API reads data from the sensor.
+ */
+static BMI3_INTF_RET_TYPE linux_bus_read(uint8_t reg_addr, uint8_t *reg_data, uint32_t len, void *intf_ptr)
+{
+    struct linux_bus *bus = (struct linux_bus *)intf_ptr;
+    BMI3_INTF_RET_TYPE rslt;
+
+    /* Queued writes are submitted along with the read, which is needed at once */
+    rslt = reserve(bus, 2, 1);
+
+    if (rslt == BMI3_INTF_RET_SUCCESS)
+    {
+        bus->wbuf[bus->wbuf_len] = reg_addr;
+        queue(bus, &bus->wbuf[bus->wbuf_len], NULL, 1, 0);
+        bus->wbuf_len++;
+
+        /* FIFO data is received in place, without a copy */
+        queue(bus, NULL, reg_data, len, 1);
+
+        rslt = submit(bus);
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This internal API writes data to the sensor, or queues the write
+ * during a batch.
+ */
+static BMI3_INTF_RET_TYPE linux_bus_write(uint8_t reg_addr, const uint8_t *reg_data, uint32_t len, void *intf_ptr)
+{
+    struct linux_bus *bus = (struct linux_bus *)intf_ptr;
+    BMI3_INTF_RET_TYPE rslt = BMI3_INTF_RET_SUCCESS;
+
+    if ((len + 1) <= LINUX_BUS_WBUF_LEN)
+    {
+        /* Address and data are copied, the buffer of the driver is gone once the batch is submitted */
+        rslt = reserve(bus, 1, len + 1);
+
+        if (rslt == BMI3_INTF_RET_SUCCESS)
+        {
+            bus->wbuf[bus->wbuf_len] = reg_addr;
+            memcpy(&bus->wbuf[bus->wbuf_len + 1], reg_data, len);
+            queue(bus, &bus->wbuf[bus->wbuf_len], NULL, len + 1, 1);
+            bus->wbuf_len = (uint16_t)(bus->wbuf_len + len + 1);
+
+            if (!bus->batch)
+            {
+                rslt = submit(bus);
+            }
+        }
+    }
+    else if (bus->intf == BMI3_SPI_INTF)
+    {
+        /* Long writes are sent from the buffer of the driver at once */
+        rslt = reserve(bus, 2, 1);
+
+        if (rslt == BMI3_INTF_RET_SUCCESS)
+        {
+            bus->wbuf[bus->wbuf_len] = reg_addr;
+            queue(bus, &bus->wbuf[bus->wbuf_len], NULL, 1, 0);
+            bus->wbuf_len++;
+            queue(bus, reg_data, NULL, len, 1);
+
+            rslt = submit(bus);
+        }
+    }
+    else
+    {
+        /* I2C message of a write has to hold the address and data */
+        rslt = -1;
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This internal API waits for the given time.
+ */
+static void linux_bus_delay_us(uint32_t period, void *intf_ptr)
+{
+    struct linux_bus *bus = (struct linux_bus *)intf_ptr;
+    struct spi_ioc_transfer *last;
+    struct timespec ts;
+
+    if ((bus->intf == BMI3_SPI_INTF) && bus->batch && (bus->n_xfer != 0))
+    {
+        last = &bus->xfer[bus->n_xfer - 1];
+
+        /* Delay is inserted by the SPI controller after the last queued transfer */
+        if ((last->delay_usecs + period) <= LINUX_BUS_MAX_XFER_DELAY_US)
+        {
+            last->delay_usecs = (uint16_t)(last->delay_usecs + period);
+            period = 0;
+        }
+    }
+
+    if (period != 0)
+    {
+        (void)submit(bus);
+
+        ts.tv_sec = (time_t)(period / 1000000);
+        ts.tv_nsec = (long)(period % 1000000) * 1000;
+
+        while ((nanosleep(&ts, &ts) != 0) && (errno == EINTR))
+        {
+        }
+    }
+}
+
+/*!
+ * @brief This internal API starts a batch on request of the driver.
+ */
+static void linux_bus_batch_begin_cb(void *intf_ptr)
+{
+    linux_bus_batch_begin((struct linux_bus *)intf_ptr);
+}
+
+/*!
+ * @brief This internal API ends a batch on request of the driver.
+ */
+static BMI3_INTF_RET_TYPE linux_bus_batch_end_cb(void *intf_ptr)
+{
+    return (linux_bus_batch_end((struct linux_bus *)intf_ptr) == BMI3_OK) ? BMI3_INTF_RET_SUCCESS : -1;
+}
@@ -0,0 +1,138 @@
+/**\
+ * Copyright (c) 2024 Bosch Sensortec GmbH. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ **/
+
+#ifndef _LINUX_BUS_H
+#define _LINUX_BUS_H
+
+/*! CPP guard */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/******************************************************************************/
+/*!                 Header Files                                              */
+#include <linux/spi/spidev.h>
+#include <linux/i2c.h>
+#include "bmi3.h"
+
+/******************************************************************************/
+/*!         Macros definition                                                */
+
+/*! Maximum number of transfers submitted at once, limited by I2C_RDWR_IOCTL_MAX_MSGS */
+#define LINUX_BUS_MAX_XFER               UINT8_C(32)
+
+/*! Size of the buffer holding the register addresses and data of the queued writes */
+#define LINUX_BUS_WBUF_LEN               UINT16_C(512)
+
+/*! Maximum length of a read or write, limited by the default buffer size of spidev */
+#define LINUX_BUS_READ_WRITE_LEN         UINT16_C(4096)
+
+/*! Default SPI clock in Hz */
+#define LINUX_BUS_SPI_HZ                 UINT32_C(10000000)
+
+/******************************************************************************/
+/*!         Structure definition                                              */
+
+/*!
+ * @brief Structure to define a spidev or i2c-dev bus, passed as interface
+ * pointer to the driver
+ */
+struct linux_bus
+{
+    /*! File descriptor of the bus device */
+    int fd;
+
+    /*! Interface of the bus: BMI3_SPI_INTF or BMI3_I2C_INTF */
+    enum bmi3_intf intf;
+
+    /*! SPI clock in Hz */
+    uint32_t speed_hz;
+
+    /*! I2C address of the sensor */
+    uint16_t i2c_addr;
+
+    /*! Nesting depth of the batches. Writes are queued and submitted with the next read
+     *  or at the end of the outermost batch
+     */
+    uint8_t batch;
+
+    /*! Number of queued SPI transfers or I2C messages */
+    uint8_t n_xfer;
+
+    /*! Number of bytes used of the write buffer */
+    uint16_t wbuf_len;
+
+    /*! Queued SPI transfers */
+    struct spi_ioc_transfer xfer[LINUX_BUS_MAX_XFER];
+
+    /*! Queued I2C messages */
+    struct i2c_msg msg[LINUX_BUS_MAX_XFER];
+
+    /*! Register addresses and data of the queued writes */
+    uint8_t wbuf[LINUX_BUS_WBUF_LEN];
+
+    /*! Number of ioctl calls, to measure the effect of batching */
+    uint32_t ioctls;
+};
+
+/******************************************************************************/
+/*!         Functions                                                         */
+
+/*!
+ *  @brief This function opens a spidev or i2c-dev bus and hooks it into the
+ *  device structure as read, write and delay functions.
+ *
+ *  @param[out] bus      : Structure instance of linux_bus.
+ *  @param[in]  path     : Path of the bus device, e.g. /dev/spidev0.0 or /dev/i2c-1.
+ *  @param[in]  intf     : Interface of the bus, BMI3_SPI_INTF or BMI3_I2C_INTF.
+ *  @param[in]  speed_hz : SPI clock in Hz, unused for I2C.
+ *  @param[in]  i2c_addr : I2C address of the sensor, unused for SPI.
+ *  @param[out] dev      : Structure instance of bmi3_dev.
+ *
+ *  @return Status of execution
+ *  @retval 0 -> Success
+ *  @retval < 0 -> Failure Info
+ */
+int8_t linux_bus_open(struct linux_bus *bus,
+                      const char *path,
+                      enum bmi3_intf intf,
+                      uint32_t speed_hz,
+                      uint16_t i2c_addr,
+                      struct bmi3_dev *dev);
+
+/*!
+ *  @brief This function closes the bus.
+ *
+ *  @param[in,out] bus : Structure instance of linux_bus.
+ */
+void linux_bus_close(struct linux_bus *bus);
+
+/*!
+ *  @brief This function starts a batch: writes and delays are queued and
+ *  submitted in one SPI_IOC_MESSAGE or I2C_RDWR ioctl, together with the next
+ *  read or at the end of the batch.
+ *
+ *  @param[in,out] bus : Structure instance of linux_bus.
+ */
+void linux_bus_batch_begin(struct linux_bus *bus);
+
+/*!
+ *  @brief This function ends the batch. The queued writes are submitted at the
+ *  end of the outermost batch, batches may be nested.
+ *
+ *  @param[in,out] bus : Structure instance of linux_bus.
+ *
+ *  @return Status of execution
+ *  @retval 0 -> Success
+ *  @retval < 0 -> Failure Info
+ */
+int8_t linux_bus_batch_end(struct linux_bus *bus);
+
+#ifdef __cplusplus
+}
+#endif /* End of CPP guard */
+
+#endif /* _LINUX_BUS_H */
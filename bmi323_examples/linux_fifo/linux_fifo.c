@@ -0,0 +1,409 @@
+/**\
+ * Copyright (c) 2024 Bosch Sensortec GmbH. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ **/
+
+/*
+ * Linux FIFO fan-out. The producer reads the FIFO over spidev or i2c-dev
+ * straight into the slots of a shared-memory ring; any number of consumer
+ * processes parse the slots in place, without copies.
+ *
+ * Usage : linux_fifo produce <bus device> [spi|i2c] [ring name]
+ *         linux_fifo consume [ring name]
+ */
+
+/******************************************************************************/
+/*!                 Header Files                                              */
+#define _POSIX_C_SOURCE 200809L
+
+#include <signal.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include "bmi323.h"
+#include "linux_bus.h"
+#include "linux_ring.h"
+
+/******************************************************************************/
+/*!         Macros definition                                                */
+
+/*! Default name of the shared-memory ring */
+#define LINUX_FIFO_RING_NAME             "/bmi3_fifo"
+
+/*! Number of slots of the ring */
+#define LINUX_FIFO_SLOTS                 UINT32_C(64)
+
+/*! Number of FIFO data bytes of a slot, the whole FIFO along with the dummy bytes */
+#define LINUX_FIFO_SLOT_SIZE             ((BMI3_FIFO_SIZE_WORDS * 2) + BMI3_MAX_DUMMY_BYTE)
+
+/*! FIFO water-mark level in words */
+#define LINUX_FIFO_WM                    UINT16_C(120)
+
+/*! Poll period in microseconds */
+#define LINUX_FIFO_POLL_US               UINT32_C(10000)
+
+/*! Maximum number of frames of a slot */
+#define LINUX_FIFO_FRAMES                (LINUX_FIFO_SLOT_SIZE / BMI3_LENGTH_FIFO_ACC)
+
+/******************************************************************************/
+/*!         Static variable definition                                        */
+
+/*! Set by SIGINT to stop */
+static volatile sig_atomic_t stop;
+
+/*! Buffers of the consumer */
+static struct bmi3_fifo_sens_axes_data accel_data[LINUX_FIFO_FRAMES];
+static struct bmi3_fifo_sens_axes_data gyro_data[LINUX_FIFO_FRAMES];
+
+/******************************************************************************/
+/*!           Static Function Declaration                                     */
+
+/*!
+ *  @brief This internal API reads the FIFO into the ring until stopped.
+ *
+ *  @param[in] path      : Path of the bus device.
+ *  @param[in] intf      : Interface of the bus.
+ *  @param[in] ring_name : Name of the ring.
+ *
+ *  @return Status of execution
+ */
+static int8_t produce(const char *path, enum bmi3_intf intf, const char *ring_name);
+
+/*!
+ *  @brief This internal API parses the slots of the ring until stopped.
+ *
+ *  @param[in] ring_name : Name of the ring.
+ *
+ *  @return Status of execution
+ */
+static int8_t consume(const char *ring_name);
+
+/*!
+ *  @brief This internal API enables accelerometer, gyro and their FIFO, with
+ *  the writes batched into few bus transfers.
+ *
+ *  @param[in] bus : Structure instance of linux_bus.
+ *  @param[in] dev : Structure instance of bmi3_dev.
+ *
+ *  @return Status of execution
+ */
+static int8_t set_fifo_stream(struct linux_bus *bus, struct bmi3_dev *dev);
+
+/*!
+ *  @brief This internal API is the read stub of the consumer, which has no bus access.
+ */
+static BMI3_INTF_RET_TYPE no_bus_read(uint8_t reg_addr, uint8_t *reg_data, uint32_t len, void *intf_ptr);
+
+/*!
+ *  @brief This internal API is the write stub of the consumer.
+ */
+static BMI3_INTF_RET_TYPE no_bus_write(uint8_t reg_addr, const uint8_t *reg_data, uint32_t len, void *intf_ptr);
+
+/*!
+ *  @brief This internal API is the delay stub of the consumer.
+ */
+static void no_bus_delay_us(uint32_t period, void *intf_ptr);
+
+/*!
+ *  @brief This internal API handles SIGINT.
+ */
+static void on_sigint(int sig);
+
+/*!
+ *  @brief This internal API gets the time of CLOCK_MONOTONIC in nanoseconds.
+ */
+static uint64_t get_time_ns(void);
+
+/******************************************************************************/
+/*!            Functions                                        */
+
+/* This function starts the execution of program. */
+int main(int argc, char *argv[])
+{
+    int8_t rslt = BMI3_E_INVALID_INPUT;
+    enum bmi3_intf intf = BMI3_SPI_INTF;
+
+    (void)signal(SIGINT, on_sigint);
+
+    if ((argc > 2) && (strcmp(argv[1], "produce") == 0))
+    {
+        if ((argc > 3) && (strcmp(argv[3], "i2c") == 0))
+        {
+            intf = BMI3_I2C_INTF;
+        }
+
+        rslt = produce(argv[2], intf, (argc > 4) ? argv[4] : LINUX_FIFO_RING_NAME);
+    }
+    else if ((argc > 1) && (strcmp(argv[1], "consume") == 0))
+    {
+        rslt = consume((argc > 2) ? argv[2] : LINUX_FIFO_RING_NAME);
+    }
+    else
+    {
+        printf("Usage : %s produce <bus device> [spi|i2c] [ring name]\n", argv[0]);
+        printf("        %s consume [ring name]\n", argv[0]);
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This internal API reads the FIFO into the ring until stopped.
+ */
+static int8_t produce(const char *path, enum bmi3_intf intf, const char *ring_name)
+{
+    int8_t rslt;
+    struct bmi3_dev dev = { 0 };
+    struct linux_bus bus;
+    struct linux_ring ring;
+    struct linux_ring_slot *slot;
+    struct bmi3_fifo_frame fifoframe = { 0 };
+    struct timespec poll = { 0, (long)LINUX_FIFO_POLL_US * 1000 };
+
+    rslt = linux_bus_open(&bus, path, intf, LINUX_BUS_SPI_HZ, BMI3_ADDR_I2C_PRIM, &dev);
+
+    if (rslt == BMI323_OK)
+    {
+        rslt = bmi323_init(&dev);
+    }
+
+    if (rslt == BMI323_OK)
+    {
+        rslt = set_fifo_stream(&bus, &dev);
+    }
+
+    if ((rslt == BMI323_OK) && (linux_ring_create(&ring, ring_name, LINUX_FIFO_SLOTS, LINUX_FIFO_SLOT_SIZE) != 0))
+    {
+        rslt = BMI3_E_COM_FAIL;
+    }
+
+    if (rslt == BMI323_OK)
+    {
+        printf("Producing into %s, %lu slots\n", ring_name, (unsigned long)LINUX_FIFO_SLOTS);
+
+        while (!stop && (rslt == BMI323_OK))
+        {
+            rslt = bmi323_get_fifo_length(&fifoframe.available_fifo_len, &dev);
+
+            if ((rslt == BMI323_OK) && (fifoframe.available_fifo_len >= LINUX_FIFO_WM))
+            {
+                /* FIFO data is read straight into the slot */
+                slot = linux_ring_acquire(&ring);
+
+                fifoframe.data = slot->data;
+                fifoframe.length = (uint16_t)((fifoframe.available_fifo_len * 2) + dev.dummy_byte);
+
+                rslt = bmi323_read_fifo_data(&fifoframe, &dev);
+
+                slot->timestamp_ns = get_time_ns();
+                slot->length = fifoframe.length;
+                slot->available_fifo_len = fifoframe.available_fifo_len;
+                slot->available_fifo_sens = fifoframe.available_fifo_sens;
+                slot->dummy_byte = dev.dummy_byte;
+
+                if (rslt == BMI323_OK)
+                {
+                    linux_ring_commit(&ring, slot);
+                }
+            }
+
+            (void)nanosleep(&poll, NULL);
+        }
+
+        printf("%lu slots, %lu ioctls\n", (unsigned long)ring.hdr->head, (unsigned long)bus.ioctls);
+        linux_ring_close(&ring);
+    }
+
+    linux_bus_close(&bus);
+
+    if (rslt != BMI323_OK)
+    {
+        printf("produce : error %d\n", rslt);
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This internal API parses the slots of the ring until stopped.
+ */
+static int8_t consume(const char *ring_name)
+{
+    int8_t rslt = BMI323_OK;
+    struct bmi3_dev dev = { 0 };
+    struct linux_ring ring;
+    const struct linux_ring_slot *slot;
+    struct bmi3_fifo_frame fifoframe = { 0 };
+    struct timespec poll = { 0, (long)LINUX_FIFO_POLL_US * 1000 };
+    uint64_t cursor = 0;
+    uint64_t lost = 0;
+
+    if (linux_ring_open(&ring, ring_name) != 0)
+    {
+        printf("Ring %s not found\n", ring_name);
+
+        return BMI3_E_COM_FAIL;
+    }
+
+    dev.read = no_bus_read;
+    dev.write = no_bus_write;
+    dev.delay_us = no_bus_delay_us;
+
+    while (!stop)
+    {
+        slot = linux_ring_peek(&ring, &cursor, &lost);
+
+        if (slot == NULL)
+        {
+            (void)nanosleep(&poll, NULL);
+            continue;
+        }
+
+        /* Slot is parsed in place; the parser only reads the FIFO data */
+        dev.dummy_byte = slot->dummy_byte;
+        fifoframe.data = (uint8_t *)(uintptr_t)slot->data;
+        fifoframe.length = slot->length;
+        fifoframe.available_fifo_len = slot->available_fifo_len;
+        fifoframe.available_fifo_sens = slot->available_fifo_sens;
+        fifoframe.layout = NULL;
+
+        if (fifoframe.available_fifo_sens & BMI3_FIFO_ACC_EN)
+        {
+            rslt = bmi323_extract_accel(accel_data, &fifoframe, &dev);
+        }
+
+        if (fifoframe.available_fifo_sens & BMI3_FIFO_GYR_EN)
+        {
+            rslt = bmi323_extract_gyro(gyro_data, &fifoframe, &dev);
+        }
+
+        /* Result is dropped if the producer overwrote the slot meanwhile */
+        if (linux_ring_release(&ring, slot, &cursor) == 0)
+        {
+            printf("Slot %lu : %u accel, %u gyro frames, first accel %d %d %d, lost %lu\n",
+                   (unsigned long)(cursor - 1),
+                   fifoframe.avail_fifo_accel_frames,
+                   fifoframe.avail_fifo_gyro_frames,
+                   (fifoframe.avail_fifo_accel_frames != 0) ? accel_data[0].x : 0,
+                   (fifoframe.avail_fifo_accel_frames != 0) ? accel_data[0].y : 0,
+                   (fifoframe.avail_fifo_accel_frames != 0) ? accel_data[0].z : 0,
+                   (unsigned long)lost);
+        }
+        else
+        {
+            lost++;
+        }
+    }
+
+    linux_ring_close(&ring);
+
+    return rslt;
+}
+
+/*!
+ * @brief This internal API enables accelerometer, gyro and their FIFO.
+ */
+static int8_t set_fifo_stream(struct linux_bus *bus, struct bmi3_dev *dev)
+{
+    int8_t rslt;
+    struct bmi3_sens_config config[2] = { { 0 } };
+
+    config[0].type = BMI323_ACCEL;
+    config[1].type = BMI323_GYRO;
+
+    /* Writes up to the next read go out in one SPI_IOC_MESSAGE or I2C_RDWR */
+    linux_bus_batch_begin(bus);
+
+    rslt = bmi323_get_sensor_config(config, 2, dev);
+
+    if (rslt == BMI323_OK)
+    {
+        config[0].cfg.acc.odr = BMI3_ACC_ODR_200HZ;
+        config[0].cfg.acc.range = BMI3_ACC_RANGE_8G;
+        config[0].cfg.acc.bwp = BMI3_ACC_BW_ODR_QUARTER;
+        config[0].cfg.acc.avg_num = BMI3_ACC_AVG1;
+        config[0].cfg.acc.acc_mode = BMI3_ACC_MODE_HIGH_PERF;
+
+        config[1].cfg.gyr.odr = BMI3_GYR_ODR_200HZ;
+        config[1].cfg.gyr.range = BMI3_GYR_RANGE_2000DPS;
+        config[1].cfg.gyr.bwp = BMI3_GYR_BW_ODR_QUARTER;
+        config[1].cfg.gyr.avg_num = BMI3_GYR_AVG1;
+        config[1].cfg.gyr.gyr_mode = BMI3_GYR_MODE_HIGH_PERF;
+
+        rslt = bmi323_set_sensor_config(config, 2, dev);
+    }
+
+    if (rslt == BMI323_OK)
+    {
+        rslt = bmi323_set_fifo_wm(LINUX_FIFO_WM, dev);
+    }
+
+    if (rslt == BMI323_OK)
+    {
+        rslt = bmi323_set_fifo_config(BMI3_FIFO_ACC_EN | BMI3_FIFO_GYR_EN, BMI323_ENABLE, dev);
+    }
+
+    if (linux_bus_batch_end(bus) != BMI3_OK)
+    {
+        rslt = BMI3_E_COM_FAIL;
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This internal API is the read stub of the consumer.
+ */
+static BMI3_INTF_RET_TYPE no_bus_read(uint8_t reg_addr, uint8_t *reg_data, uint32_t len, void *intf_ptr)
+{
+    (void)reg_addr;
+    (void)reg_data;
+    (void)len;
+    (void)intf_ptr;
+
+    return -1;
+}
+
+/*!
+ * @brief This internal API is the write stub of the consumer.
+ */
+static BMI3_INTF_RET_TYPE no_bus_write(uint8_t reg_addr, const uint8_t *reg_data, uint32_t len, void *intf_ptr)
+{
+    (void)reg_addr;
+    (void)reg_data;
+    (void)len;
+    (void)intf_ptr;
+
+    return -1;
+}
+
+/*!
+ * @brief This internal API is the delay stub of the consumer.
+ */
+static void no_bus_delay_us(uint32_t period, void *intf_ptr)
+{
+    (void)period;
+    (void)intf_ptr;
+}
+
+/*!
+ * @brief This internal API handles SIGINT.
+ */
+static void on_sigint(int sig)
+{
+    (void)sig;
+    stop = 1;
+}
+
+/*!
+ * @brief This internal API gets the time of CLOCK_MONOTONIC in nanoseconds.
+ */
+static uint64_t get_time_ns(void)
+{
+    struct timespec ts;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return ((uint64_t)ts.tv_sec * 1000000000ULL) + (uint64_t)ts.tv_nsec;
+}
@@ -0,0 +1,252 @@
+/**\
+ * Copyright (c) 2024 Bosch Sensortec GmbH. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ **/
+
+/******************************************************************************/
+/*!                 Header Files                                              */
+#define _POSIX_C_SOURCE 200809L
+
+#include <fcntl.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "linux_ring.h"
+
+/******************************************************************************/
+/*!           Static Function Declaration                                     */
+
+/*!
+ * @brief This internal API gets the slot of the given index.
+ *
+ * @param[in] ring  : Structure instance of linux_ring.
+ * @param[in] index : Index of the slot since creation of the ring.
+ *
+ * @return Slot
+ */
+static struct linux_ring_slot *get_slot(const struct linux_ring *ring, uint64_t index);
+
+/*!
+ * @brief This internal API gets the distance of the slots in bytes.
+ *
+ * @param[in] slot_size : Number of FIFO data bytes of a slot.
+ *
+ * @return Distance of the slots
+ */
+static size_t get_stride(uint32_t slot_size);
+
+/******************************************************************************/
+/*!               User interface functions                                    */
+
+/*!
+ * @brief This function creates the shared-memory ring of the producer.
+ */
+int linux_ring_create(struct linux_ring *ring, const char *name, uint32_t slot_count, uint32_t slot_size)
+{
+    int fd;
+    int rslt = -1;
+
+    if ((ring != NULL) && (name != NULL) && (slot_count != 0))
+    {
+        memset(ring, 0, sizeof(*ring));
+        ring->name = name;
+        ring->producer = 1;
+        ring->stride = get_stride(slot_size);
+        ring->map_len = sizeof(struct linux_ring_hdr) + ((size_t)slot_count * ring->stride);
+
+        fd = shm_open(name, O_CREAT | O_RDWR, 0644);
+
+        if (fd >= 0)
+        {
+            if (ftruncate(fd, (off_t)ring->map_len) == 0)
+            {
+                ring->hdr = mmap(NULL, ring->map_len, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+
+                if (ring->hdr != MAP_FAILED)
+                {
+                    memset(ring->hdr, 0, ring->map_len);
+                    ring->hdr->version = LINUX_RING_VERSION;
+                    ring->hdr->slot_count = slot_count;
+                    ring->hdr->slot_size = slot_size;
+
+                    /* Consumers check the magic number last */
+                    __atomic_store_n(&ring->hdr->magic, LINUX_RING_MAGIC, __ATOMIC_RELEASE);
+                    rslt = 0;
+                }
+                else
+                {
+                    ring->hdr = NULL;
+                }
+            }
+
+            (void)close(fd);
+        }
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This function maps the shared-memory ring of a consumer, read-only.
+ */
+int linux_ring_open(struct linux_ring *ring, const char *name)
+{
+    int fd;
+    int rslt = -1;
+    struct stat st;
+
+    if ((ring != NULL) && (name != NULL))
+    {
+        memset(ring, 0, sizeof(*ring));
+        ring->name = name;
+
+        fd = shm_open(name, O_RDONLY, 0);
+
+        if (fd >= 0)
+        {
+            if ((fstat(fd, &st) == 0) && ((size_t)st.st_size >= sizeof(struct linux_ring_hdr)))
+            {
+                ring->map_len = (size_t)st.st_size;
+                ring->hdr = mmap(NULL, ring->map_len, PROT_READ, MAP_SHARED, fd, 0);
+
+                if (ring->hdr == MAP_FAILED)
+                {
+                    ring->hdr = NULL;
+                }
+                else if ((__atomic_load_n(&ring->hdr->magic, __ATOMIC_ACQUIRE) == LINUX_RING_MAGIC) &&
+                         (ring->hdr->version == LINUX_RING_VERSION) &&
+                         ((sizeof(struct linux_ring_hdr) +
+                           ((size_t)ring->hdr->slot_count * get_stride(ring->hdr->slot_size))) <= ring->map_len))
+                {
+                    ring->stride = get_stride(ring->hdr->slot_size);
+                    rslt = 0;
+                }
+                else
+                {
+                    (void)munmap(ring->hdr, ring->map_len);
+                    ring->hdr = NULL;
+                }
+            }
+
+            (void)close(fd);
+        }
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This function unmaps the ring; the producer also removes it.
+ */
+void linux_ring_close(struct linux_ring *ring)
+{
+    if ((ring != NULL) && (ring->hdr != NULL))
+    {
+        (void)munmap(ring->hdr, ring->map_len);
+        ring->hdr = NULL;
+
+        if (ring->producer)
+        {
+            (void)shm_unlink(ring->name);
+        }
+    }
+}
+
+/*!
+ * @brief This function gets the next slot of the producer.
+ */
+struct linux_ring_slot *linux_ring_acquire(struct linux_ring *ring)
+{
+    uint64_t head = ring->hdr->head;
+    struct linux_ring_slot *slot = get_slot(ring, head);
+
+    /* Consumers which read the slot meanwhile see the odd sequence and drop it */
+    __atomic_store_n(&slot->seq, (head * 2) + 1, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+
+    return slot;
+}
+
+/*!
+ * @brief This function publishes the slot of the producer to the consumers.
+ */
+void linux_ring_commit(struct linux_ring *ring, struct linux_ring_slot *slot)
+{
+    uint64_t head = ring->hdr->head;
+
+    __atomic_store_n(&slot->seq, (head + 1) * 2, __ATOMIC_RELEASE);
+    __atomic_store_n(&ring->hdr->head, head + 1, __ATOMIC_RELEASE);
+}
+
+/*!
+ * @brief This function gets the next committed slot of a consumer.
+ */
+const struct linux_ring_slot *linux_ring_peek(const struct linux_ring *ring, uint64_t *cursor, uint64_t *lost)
+{
+    const struct linux_ring_slot *slot = NULL;
+    uint64_t head = __atomic_load_n(&ring->hdr->head, __ATOMIC_ACQUIRE);
+    uint64_t count = ring->hdr->slot_count;
+
+    while ((slot == NULL) && (*cursor < head))
+    {
+        /* Slots older than the ring length are overwritten */
+        if ((head - *cursor) > count)
+        {
+            *lost += (head - count) - *cursor;
+            *cursor = head - count;
+        }
+
+        slot = get_slot(ring, *cursor);
+
+        if (__atomic_load_n(&slot->seq, __ATOMIC_ACQUIRE) != ((*cursor + 1) * 2))
+        {
+            /* Slot is being overwritten */
+            slot = NULL;
+            (*lost)++;
+            (*cursor)++;
+        }
+    }
+
+    return slot;
+}
+
+/*!
+ * @brief This function ends the use of a slot returned by linux_ring_peek.
+ */
+int linux_ring_release(const struct linux_ring *ring, const struct linux_ring_slot *slot, uint64_t *cursor)
+{
+    int rslt;
+
+    (void)ring;
+
+    /* Loads of the slot data are done before the sequence is checked again */
+    __atomic_thread_fence(__ATOMIC_ACQUIRE);
+
+    rslt = (__atomic_load_n(&slot->seq, __ATOMIC_RELAXED) == ((*cursor + 1) * 2)) ? 0 : -1;
+    (*cursor)++;
+
+    return rslt;
+}
+
+/******************************************************************************/
+/*!               Static functions                                            */
+
+/*!
+ * @brief This internal API gets the slot of the given index.
+ */
+static struct linux_ring_slot *get_slot(const struct linux_ring *ring, uint64_t index)
+{
+    uint8_t *base = (uint8_t *)ring->hdr + sizeof(struct linux_ring_hdr);
+
+    return (struct linux_ring_slot *)(void *)(base + ((size_t)(index % ring->hdr->slot_count) * ring->stride));
+}
+
+/*!
+ * @brief This internal API gets the distance of the slots in bytes.
+ */
+static size_t get_stride(uint32_t slot_size)
+{
+    return (offsetof(struct linux_ring_slot, data) + slot_size + 7) & ~(size_t)7;
+}
@@ -0,0 +1,182 @@
+/**\
+ * Copyright (c) 2024 Bosch Sensortec GmbH. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ **/
+
+#ifndef _LINUX_RING_H
+#define _LINUX_RING_H
+
+/*! CPP guard */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/******************************************************************************/
+/*!                 Header Files                                              */
+#include <stddef.h>
+#include "bmi3.h"
+
+/******************************************************************************/
+/*!         Macros definition                                                */
+
+/*! Magic number of the ring header */
+#define LINUX_RING_MAGIC                 UINT32_C(0x424D4933)
+
+/*! Version of the ring layout */
+#define LINUX_RING_VERSION               UINT32_C(1)
+
+/******************************************************************************/
+/*!         Structure definition                                              */
+
+/*!
+ * @brief Structure to define the header of the shared-memory ring
+ */
+struct linux_ring_hdr
+{
+    /*! LINUX_RING_MAGIC */
+    uint32_t magic;
+
+    /*! LINUX_RING_VERSION */
+    uint32_t version;
+
+    /*! Number of slots */
+    uint32_t slot_count;
+
+    /*! Number of FIFO data bytes of a slot */
+    uint32_t slot_size;
+
+    /*! Number of slots committed by the producer since creation */
+    uint64_t head;
+};
+
+/*!
+ * @brief Structure to define a slot of the ring, holding one FIFO read
+ */
+struct linux_ring_slot
+{
+    /*! Sequence: odd while the producer writes the slot, 2 * (index + 1) once committed */
+    uint64_t seq;
+
+    /*! Time of the FIFO read in nanoseconds, CLOCK_MONOTONIC */
+    uint64_t timestamp_ns;
+
+    /*! Number of bytes read, including the dummy bytes */
+    uint16_t length;
+
+    /*! Number of FIFO words read */
+    uint16_t available_fifo_len;
+
+    /*! Sensor enable status of the FIFO data */
+    uint16_t available_fifo_sens;
+
+    /*! Number of dummy bytes in front of the FIFO data */
+    uint8_t dummy_byte;
+
+    /*! Reserved */
+    uint8_t reserved;
+
+    /*! FIFO data as read by bmi3_read_fifo_data, slot_size bytes */
+    uint8_t data[];
+};
+
+/*!
+ * @brief Structure to define the mapping of the ring in a process
+ */
+struct linux_ring
+{
+    /*! Header at the start of the mapping */
+    struct linux_ring_hdr *hdr;
+
+    /*! Length of the mapping */
+    size_t map_len;
+
+    /*! Distance of the slots in bytes */
+    size_t stride;
+
+    /*! Name of the shared-memory object */
+    const char *name;
+
+    /*! Non-zero in the producer process */
+    uint8_t producer;
+};
+
+/******************************************************************************/
+/*!         Functions                                                         */
+
+/*!
+ *  @brief This function creates the shared-memory ring of the producer.
+ *
+ *  @param[out] ring       : Structure instance of linux_ring.
+ *  @param[in]  name       : Name of the shared-memory object, e.g. "/bmi3_fifo".
+ *  @param[in]  slot_count : Number of slots.
+ *  @param[in]  slot_size  : Number of FIFO data bytes of a slot.
+ *
+ *  @return 0 on success, -1 on failure
+ */
+int linux_ring_create(struct linux_ring *ring, const char *name, uint32_t slot_count, uint32_t slot_size);
+
+/*!
+ *  @brief This function maps the shared-memory ring of a consumer, read-only.
+ *
+ *  @param[out] ring : Structure instance of linux_ring.
+ *  @param[in]  name : Name of the shared-memory object.
+ *
+ *  @return 0 on success, -1 on failure
+ */
+int linux_ring_open(struct linux_ring *ring, const char *name);
+
+/*!
+ *  @brief This function unmaps the ring; the producer also removes it.
+ *
+ *  @param[in,out] ring : Structure instance of linux_ring.
+ */
+void linux_ring_close(struct linux_ring *ring);
+
+/*!
+ *  @brief This function gets the next slot of the producer, to read the FIFO
+ *  data into.
+ *
+ *  @param[in,out] ring : Structure instance of linux_ring.
+ *
+ *  @return Slot, marked as being written
+ */
+struct linux_ring_slot *linux_ring_acquire(struct linux_ring *ring);
+
+/*!
+ *  @brief This function publishes the slot of the producer to the consumers.
+ *
+ *  @param[in,out] ring : Structure instance of linux_ring.
+ *  @param[in,out] slot : Slot returned by linux_ring_acquire.
+ */
+void linux_ring_commit(struct linux_ring *ring, struct linux_ring_slot *slot);
+
+/*!
+ *  @brief This function gets the next committed slot of a consumer, in place
+ *  in the shared memory. Slots overwritten before they are read are skipped.
+ *
+ *  @param[in]     ring   : Structure instance of linux_ring.
+ *  @param[in,out] cursor : Index of the next slot of the consumer, 0 to start with the oldest slot.
+ *  @param[in,out] lost   : Number of slots skipped.
+ *
+ *  @return Slot, NULL if no new slot is committed
+ */
+const struct linux_ring_slot *linux_ring_peek(const struct linux_ring *ring, uint64_t *cursor, uint64_t *lost);
+
+/*!
+ *  @brief This function ends the use of a slot returned by linux_ring_peek
+ *  and advances the cursor.
+ *
+ *  @param[in]     ring   : Structure instance of linux_ring.
+ *  @param[in]     slot   : Slot returned by linux_ring_peek.
+ *  @param[in,out] cursor : Index of the next slot of the consumer.
+ *
+ *  @return 0 if the slot was not overwritten while in use, -1 otherwise
+ */
+int linux_ring_release(const struct linux_ring *ring, const struct linux_ring_slot *slot, uint64_t *cursor);
+
+#ifdef __cplusplus
+}
+#endif /* End of CPP guard */
+
+#endif /* _LINUX_RING_H */
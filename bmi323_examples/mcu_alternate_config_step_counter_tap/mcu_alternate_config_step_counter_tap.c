@@ -16,7 +16,7 @@
 
 volatile uint8_t feat_int_status = 0;
 
-struct bmi3_dev dev;
+struct bmi3_dev dev = { 0 };
 
 /* Structure to define the type of sensor and its configurations. */
 struct bmi3_sens_config config[7];
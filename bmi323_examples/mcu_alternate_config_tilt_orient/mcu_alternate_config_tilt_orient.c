@@ -16,7 +16,7 @@
 
 volatile uint8_t feat_int_status = 0;
 
-struct bmi3_dev dev;
+struct bmi3_dev dev = { 0 };
 
 /*********************************************************************/
 /*          Function declaration                                     */
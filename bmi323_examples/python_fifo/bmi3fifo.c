@@ -0,0 +1,566 @@
+/**\
+ * Copyright (c) 2024 Bosch Sensortec GmbH. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ **/
+
+/*
+ * CPython extension _bmi3fifo, the decoder of bmi3fifo.py. Raw FIFO bytes of
+ * any buffer-protocol object are parsed in place by bmi3_extract_range, which
+ * stores the frames directly in the bytearrays returned, so NumPy views them
+ * without a copy. The capture is split into FIFO frames of at most 64 KiB at
+ * frame boundaries, and large captures are parsed by several threads, each
+ * extracting a disjoint range of chunks with the GIL released.
+ */
+
+/******************************************************************************/
+/*!                 Header Files                                              */
+#define PY_SSIZE_T_CLEAN
+#include <Python.h>
+#include <pthread.h>
+#include <string.h>
+#include <unistd.h>
+#include "bmi3.h"
+
+/******************************************************************************/
+/*!         Macros definition                                                */
+
+/*! Largest number of bytes of a chunk, the FIFO frame length being 16-bit */
+#define BMI3FIFO_CHUNK_MAX_LEN           UINT32_C(65534)
+
+/*! Largest number of threads */
+#define BMI3FIFO_MAX_THREADS             64
+
+/*! Smallest number of chunks per thread, smaller captures are parsed by the calling thread */
+#define BMI3FIFO_CHUNKS_PER_THREAD       4
+
+/******************************************************************************/
+/*!         Structure definition                                              */
+
+/*!
+ * @brief Structure to define the output of the decoding of a capture
+ */
+struct bmi3fifo_out
+{
+    /*! Accelerometer, gyro and temperature frames, NULL if not enabled */
+    struct bmi3_fifo_sens_axes_data *accel;
+    struct bmi3_fifo_sens_axes_data *gyro;
+    struct bmi3_fifo_temperature_data *temp;
+
+    /*! Number of frames extracted by each chunk */
+    struct bmi3_fifo_census *count;
+};
+
+/*!
+ * @brief Structure to define the range of chunks parsed by a thread
+ */
+struct bmi3fifo_job
+{
+    /*! Raw FIFO bytes of the capture */
+    const uint8_t *data;
+
+    /*! Output of the decoding */
+    const struct bmi3fifo_out *out;
+
+    /*! Sensor enable status of the FIFO */
+    uint16_t fifo_sens;
+
+    /*! Number of frames of a chunk and length of a frame in bytes */
+    uint16_t chunk_frames;
+    uint8_t frame_len;
+
+    /*! Number of frames of the capture */
+    Py_ssize_t frames;
+
+    /*! Range of chunks [first, end) */
+    Py_ssize_t first;
+    Py_ssize_t end;
+
+    /*! Result of the first failed extraction, BMI3_OK if none */
+    int8_t rslt;
+};
+
+/******************************************************************************/
+/*!           Static Function Declaration                                     */
+
+/*!
+ *  @brief This internal API extracts the chunks of a job.
+ *
+ *  @param[in,out] arg : Structure instance of bmi3fifo_job.
+ *
+ *  @return NULL
+ */
+static void *run_job(void *arg);
+
+/*!
+ *  @brief This internal API closes the gaps left by the dummy frames of each
+ *  chunk, so the frames of each sensor are contiguous.
+ *
+ *  @param[in]  base       : Frames of the sensor.
+ *  @param[in]  size       : Size of a frame of the sensor in bytes.
+ *  @param[in]  count      : Number of frames extracted by each chunk.
+ *  @param[in]  n_chunks   : Number of chunks.
+ *  @param[in]  chunk_frames : Number of frames of a chunk.
+ *  @param[in]  sens_sel   : 0 for accel, 1 for gyro, 2 for temperature.
+ *
+ *  @return Number of frames of the sensor
+ */
+static Py_ssize_t compact(uint8_t *base,
+                          size_t size,
+                          const struct bmi3_fifo_census *count,
+                          Py_ssize_t n_chunks,
+                          uint16_t chunk_frames,
+                          uint8_t sens_sel);
+
+/*!
+ *  @brief This internal API unwraps the 16-bit sensor time of the frames of
+ *  a sensor into a bytearray of 64-bit ticks, the first frame at its own time.
+ *
+ *  @param[in] base  : Frames of the sensor.
+ *  @param[in] size  : Size of a frame of the sensor in bytes.
+ *  @param[in] time_offset : Byte offset of the sensor time in a frame.
+ *  @param[in] n     : Number of frames.
+ *
+ *  @return New bytearray, NULL on failure
+ */
+static PyObject *unwrap_time(const uint8_t *base, size_t size, size_t time_offset, Py_ssize_t n);
+
+/*!
+ *  @brief This internal API is the read function of the decoding device, which has no bus.
+ */
+static BMI3_INTF_RET_TYPE no_bus_read(uint8_t reg_addr, uint8_t *reg_data, uint32_t len, void *intf_ptr);
+
+/*!
+ *  @brief This internal API is the write function of the decoding device, which has no bus.
+ */
+static BMI3_INTF_RET_TYPE no_bus_write(uint8_t reg_addr, const uint8_t *reg_data, uint32_t len, void *intf_ptr);
+
+/*!
+ *  @brief This internal API is the delay function of the decoding device.
+ */
+static void no_bus_delay_us(uint32_t period, void *intf_ptr);
+
+/*!
+ *  @brief This internal API is decode() of the module.
+ */
+static PyObject *bmi3fifo_decode(PyObject *self, PyObject *args, PyObject *kwargs);
+
+/******************************************************************************/
+/*!         Static variable definition                                        */
+
+/*! Decoding device, read-only once initialized, shared by the threads */
+static struct bmi3_dev decode_dev;
+
+/*! Methods of the module */
+static PyMethodDef bmi3fifo_methods[] = {
+    { "decode", (PyCFunction)(void (*)(void))bmi3fifo_decode, METH_VARARGS | METH_KEYWORDS,
+      "decode(data, available_fifo_sens, threads=0) -> dict\n\n"
+      "Decodes raw headerless FIFO bytes without dummy bytes. The dict holds bytearrays of\n"
+      "struct bmi3_fifo_sens_axes_data for 'accel' and 'gyro', of struct\n"
+      "bmi3_fifo_temperature_data for 'temp', and of unwrapped uint64 sensor time ticks\n"
+      "for '<sensor>_time' if sensor time is enabled; entries of disabled sensors are None.\n"
+      "threads=0 uses one thread per CPU on large captures, 1 parses in the calling thread." },
+    { NULL, NULL, 0, NULL }
+};
+
+/*! Definition of the module */
+static struct PyModuleDef bmi3fifo_module = {
+    PyModuleDef_HEAD_INIT, "_bmi3fifo", "Decoding of BMI3 FIFO captures by the BMI3 Sensor API.", -1,
+    bmi3fifo_methods, NULL, NULL, NULL, NULL
+};
+
+/******************************************************************************/
+/*!            Functions                                        */
+
+/*!
+ *  @brief This function initializes the module.
+ */
+PyMODINIT_FUNC PyInit__bmi3fifo(void)
+{
+    PyObject *module = PyModule_Create(&bmi3fifo_module);
+
+    decode_dev.read = no_bus_read;
+    decode_dev.write = no_bus_write;
+    decode_dev.delay_us = no_bus_delay_us;
+    decode_dev.dummy_byte = 0;
+
+    if ((module != NULL) &&
+        ((PyModule_AddIntConstant(module, "FIFO_TIME_EN", BMI3_FIFO_TIME_EN) < 0) ||
+         (PyModule_AddIntConstant(module, "FIFO_ACC_EN", BMI3_FIFO_ACC_EN) < 0) ||
+         (PyModule_AddIntConstant(module, "FIFO_GYR_EN", BMI3_FIFO_GYR_EN) < 0) ||
+         (PyModule_AddIntConstant(module, "FIFO_TEMP_EN", BMI3_FIFO_TEMP_EN) < 0)))
+    {
+        Py_DECREF(module);
+        module = NULL;
+    }
+
+    return module;
+}
+
+/*!
+ * @brief This internal API is decode() of the module.
+ */
+static PyObject *bmi3fifo_decode(PyObject *self, PyObject *args, PyObject *kwargs)
+{
+    static char *kwlist[] = { "data", "available_fifo_sens", "threads", NULL };
+    Py_buffer view;
+    unsigned int fifo_sens = 0;
+    int threads = 0;
+    PyObject *result = NULL;
+    PyObject *accel_buf = NULL;
+    PyObject *gyro_buf = NULL;
+    PyObject *temp_buf = NULL;
+    PyObject *item;
+    struct bmi3fifo_out out = { NULL, NULL, NULL, NULL };
+    struct bmi3fifo_job job[BMI3FIFO_MAX_THREADS];
+    pthread_t thread[BMI3FIFO_MAX_THREADS];
+    uint8_t frame_len = 0;
+    uint16_t chunk_frames;
+    Py_ssize_t frames;
+    Py_ssize_t n_chunks;
+    Py_ssize_t n;
+    Py_ssize_t per_job;
+    int n_jobs;
+    int idx;
+    int8_t rslt = BMI3_OK;
+
+    (void)self;
+
+    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "y*I|i", kwlist, &view, &fifo_sens, &threads))
+    {
+        return NULL;
+    }
+
+    fifo_sens &= BMI3_FIFO_ALL_EN;
+    frame_len = (uint8_t)(((fifo_sens & BMI3_FIFO_ACC_EN) ? BMI3_LENGTH_FIFO_ACC : 0) +
+                          ((fifo_sens & BMI3_FIFO_GYR_EN) ? BMI3_LENGTH_FIFO_GYR : 0) +
+                          ((fifo_sens & BMI3_FIFO_TEMP_EN) ? BMI3_LENGTH_TEMPERATURE : 0) +
+                          ((fifo_sens & BMI3_FIFO_TIME_EN) ? BMI3_LENGTH_SENSOR_TIME : 0));
+
+    if (frame_len == 0)
+    {
+        PyBuffer_Release(&view);
+        PyErr_SetString(PyExc_ValueError, "no sensor enabled in available_fifo_sens");
+
+        return NULL;
+    }
+
+    /* A trailing incomplete frame is dropped */
+    frames = view.len / frame_len;
+    chunk_frames = (uint16_t)(BMI3FIFO_CHUNK_MAX_LEN / frame_len);
+    n_chunks = (frames + chunk_frames - 1) / chunk_frames;
+
+    /* Outputs are sized for all frames, the dummy frames are dropped by compaction */
+    accel_buf = PyByteArray_FromStringAndSize(NULL,
+                                              (fifo_sens & BMI3_FIFO_ACC_EN) ?
+                                              frames * (Py_ssize_t)sizeof(struct bmi3_fifo_sens_axes_data) : 0);
+    gyro_buf = PyByteArray_FromStringAndSize(NULL,
+                                             (fifo_sens & BMI3_FIFO_GYR_EN) ?
+                                             frames * (Py_ssize_t)sizeof(struct bmi3_fifo_sens_axes_data) : 0);
+    temp_buf = PyByteArray_FromStringAndSize(NULL,
+                                             (fifo_sens & BMI3_FIFO_TEMP_EN) ?
+                                             frames * (Py_ssize_t)sizeof(struct bmi3_fifo_temperature_data) : 0);
+    out.count = (struct bmi3_fifo_census *)PyMem_Calloc((size_t)n_chunks + 1, sizeof(struct bmi3_fifo_census));
+
+    if ((accel_buf == NULL) || (gyro_buf == NULL) || (temp_buf == NULL) || (out.count == NULL))
+    {
+        PyErr_NoMemory();
+        rslt = BMI3_E_NULL_PTR;
+    }
+
+    if (rslt == BMI3_OK)
+    {
+        if (fifo_sens & BMI3_FIFO_ACC_EN)
+        {
+            out.accel = (struct bmi3_fifo_sens_axes_data *)(void *)PyByteArray_AS_STRING(accel_buf);
+        }
+
+        if (fifo_sens & BMI3_FIFO_GYR_EN)
+        {
+            out.gyro = (struct bmi3_fifo_sens_axes_data *)(void *)PyByteArray_AS_STRING(gyro_buf);
+        }
+
+        if (fifo_sens & BMI3_FIFO_TEMP_EN)
+        {
+            out.temp = (struct bmi3_fifo_temperature_data *)(void *)PyByteArray_AS_STRING(temp_buf);
+        }
+
+        if (threads <= 0)
+        {
+            threads = (int)sysconf(_SC_NPROCESSORS_ONLN);
+        }
+
+        n_jobs = (int)((n_chunks + BMI3FIFO_CHUNKS_PER_THREAD - 1) / BMI3FIFO_CHUNKS_PER_THREAD);
+        n_jobs = (n_jobs < threads) ? n_jobs : threads;
+        n_jobs = (n_jobs < BMI3FIFO_MAX_THREADS) ? n_jobs : BMI3FIFO_MAX_THREADS;
+        n_jobs = (n_jobs > 0) ? n_jobs : 1;
+        per_job = (n_chunks + n_jobs - 1) / n_jobs;
+
+        for (idx = 0; idx < n_jobs; idx++)
+        {
+            job[idx].data = (const uint8_t *)view.buf;
+            job[idx].out = &out;
+            job[idx].fifo_sens = (uint16_t)fifo_sens;
+            job[idx].chunk_frames = chunk_frames;
+            job[idx].frame_len = frame_len;
+            job[idx].frames = frames;
+            job[idx].first = (idx * per_job < n_chunks) ? (idx * per_job) : n_chunks;
+            job[idx].end = ((idx + 1) * per_job < n_chunks) ? ((idx + 1) * per_job) : n_chunks;
+            job[idx].rslt = BMI3_OK;
+        }
+
+        Py_BEGIN_ALLOW_THREADS
+
+        /* The first job runs on the calling thread, the others on threads of their own */
+        for (idx = 1; idx < n_jobs; idx++)
+        {
+            if (pthread_create(&thread[idx], NULL, run_job, &job[idx]) != 0)
+            {
+                (void)run_job(&job[idx]);
+                thread[idx] = pthread_self();
+            }
+        }
+
+        (void)run_job(&job[0]);
+
+        for (idx = 1; idx < n_jobs; idx++)
+        {
+            if (!pthread_equal(thread[idx], pthread_self()))
+            {
+                (void)pthread_join(thread[idx], NULL);
+            }
+        }
+
+        Py_END_ALLOW_THREADS
+
+        for (idx = 0; (idx < n_jobs) && (rslt == BMI3_OK); idx++)
+        {
+            rslt = (job[idx].rslt < BMI3_OK) ? job[idx].rslt : BMI3_OK;
+        }
+
+        if (rslt != BMI3_OK)
+        {
+            PyErr_Format(PyExc_RuntimeError, "bmi3_extract_range failed: %d", rslt);
+        }
+    }
+
+    if (rslt == BMI3_OK)
+    {
+        /* Disabled sensors and the sensor time without TIME_EN stay None */
+        result = Py_BuildValue("{s:O,s:O,s:O,s:O,s:O,s:O}",
+                               "accel", Py_None, "gyro", Py_None, "temp", Py_None,
+                               "accel_time", Py_None, "gyro_time", Py_None, "temp_time", Py_None);
+        rslt = (result != NULL) ? BMI3_OK : BMI3_E_NULL_PTR;
+    }
+
+    /* Frames are compacted in place, then the bytearrays are shrunk to them */
+    if ((rslt == BMI3_OK) && (fifo_sens & BMI3_FIFO_ACC_EN))
+    {
+        n = compact((uint8_t *)out.accel, sizeof(*out.accel), out.count, n_chunks, chunk_frames, 0);
+        rslt = (PyByteArray_Resize(accel_buf, n * (Py_ssize_t)sizeof(*out.accel)) == 0) ? BMI3_OK : BMI3_E_NULL_PTR;
+
+        if ((rslt == BMI3_OK) && (fifo_sens & BMI3_FIFO_TIME_EN))
+        {
+            item = unwrap_time((const uint8_t *)PyByteArray_AS_STRING(accel_buf),
+                               sizeof(*out.accel),
+                               offsetof(struct bmi3_fifo_sens_axes_data, sensor_time),
+                               n);
+            rslt = ((item != NULL) && (PyDict_SetItemString(result, "accel_time", item) == 0)) ? BMI3_OK :
+                   BMI3_E_NULL_PTR;
+            Py_XDECREF(item);
+        }
+    }
+
+    if ((rslt == BMI3_OK) && (fifo_sens & BMI3_FIFO_GYR_EN))
+    {
+        n = compact((uint8_t *)out.gyro, sizeof(*out.gyro), out.count, n_chunks, chunk_frames, 1);
+        rslt = (PyByteArray_Resize(gyro_buf, n * (Py_ssize_t)sizeof(*out.gyro)) == 0) ? BMI3_OK : BMI3_E_NULL_PTR;
+
+        if ((rslt == BMI3_OK) && (fifo_sens & BMI3_FIFO_TIME_EN))
+        {
+            item = unwrap_time((const uint8_t *)PyByteArray_AS_STRING(gyro_buf),
+                               sizeof(*out.gyro),
+                               offsetof(struct bmi3_fifo_sens_axes_data, sensor_time),
+                               n);
+            rslt = ((item != NULL) && (PyDict_SetItemString(result, "gyro_time", item) == 0)) ? BMI3_OK :
+                   BMI3_E_NULL_PTR;
+            Py_XDECREF(item);
+        }
+    }
+
+    if ((rslt == BMI3_OK) && (fifo_sens & BMI3_FIFO_TEMP_EN))
+    {
+        n = compact((uint8_t *)out.temp, sizeof(*out.temp), out.count, n_chunks, chunk_frames, 2);
+        rslt = (PyByteArray_Resize(temp_buf, n * (Py_ssize_t)sizeof(*out.temp)) == 0) ? BMI3_OK : BMI3_E_NULL_PTR;
+
+        if ((rslt == BMI3_OK) && (fifo_sens & BMI3_FIFO_TIME_EN))
+        {
+            item = unwrap_time((const uint8_t *)PyByteArray_AS_STRING(temp_buf),
+                               sizeof(*out.temp),
+                               offsetof(struct bmi3_fifo_temperature_data, sensor_time),
+                               n);
+            rslt = ((item != NULL) && (PyDict_SetItemString(result, "temp_time", item) == 0)) ? BMI3_OK :
+                   BMI3_E_NULL_PTR;
+            Py_XDECREF(item);
+        }
+    }
+
+    if ((rslt == BMI3_OK) &&
+        (((fifo_sens & BMI3_FIFO_ACC_EN) && (PyDict_SetItemString(result, "accel", accel_buf) != 0)) ||
+         ((fifo_sens & BMI3_FIFO_GYR_EN) && (PyDict_SetItemString(result, "gyro", gyro_buf) != 0)) ||
+         ((fifo_sens & BMI3_FIFO_TEMP_EN) && (PyDict_SetItemString(result, "temp", temp_buf) != 0))))
+    {
+        rslt = BMI3_E_NULL_PTR;
+    }
+
+    if ((rslt != BMI3_OK) && (result != NULL))
+    {
+        Py_CLEAR(result);
+    }
+
+    PyMem_Free(out.count);
+    Py_XDECREF(accel_buf);
+    Py_XDECREF(gyro_buf);
+    Py_XDECREF(temp_buf);
+    PyBuffer_Release(&view);
+
+    return result;
+}
+
+/*!
+ * @brief This internal API extracts the chunks of a job.
+ */
+static void *run_job(void *arg)
+{
+    struct bmi3fifo_job *job = (struct bmi3fifo_job *)arg;
+    struct bmi3_fifo_frame fifo = { 0 };
+    Py_ssize_t chunk;
+    Py_ssize_t first_frame;
+    Py_ssize_t n_frames;
+    int8_t rslt;
+
+    fifo.available_fifo_sens = job->fifo_sens;
+
+    /* Each chunk is a FIFO frame of its own pointing into the capture, as read by bmi3_read_fifo_data */
+    for (chunk = job->first; (chunk < job->end) && (job->rslt == BMI3_OK); chunk++)
+    {
+        first_frame = chunk * job->chunk_frames;
+        n_frames = job->frames - first_frame;
+        n_frames = (n_frames < job->chunk_frames) ? n_frames : job->chunk_frames;
+
+        fifo.data = (uint8_t *)(uintptr_t)(job->data + (first_frame * job->frame_len));
+        fifo.length = (uint16_t)(n_frames * job->frame_len);
+        fifo.available_fifo_len = (uint16_t)(fifo.length / 2);
+
+        rslt = bmi3_extract_range((job->out->accel != NULL) ? &job->out->accel[first_frame] : NULL,
+                                  (job->out->gyro != NULL) ? &job->out->gyro[first_frame] : NULL,
+                                  (job->out->temp != NULL) ? &job->out->temp[first_frame] : NULL,
+                                  0,
+                                  (uint16_t)n_frames,
+                                  &job->out->count[chunk],
+                                  &fifo,
+                                  &decode_dev);
+
+        if (rslt < BMI3_OK)
+        {
+            job->rslt = rslt;
+        }
+    }
+
+    return NULL;
+}
+
+/*!
+ * @brief This internal API closes the gaps left by the dummy frames of each chunk.
+ */
+static Py_ssize_t compact(uint8_t *base,
+                          size_t size,
+                          const struct bmi3_fifo_census *count,
+                          Py_ssize_t n_chunks,
+                          uint16_t chunk_frames,
+                          uint8_t sens_sel)
+{
+    Py_ssize_t n = 0;
+    Py_ssize_t chunk;
+    uint16_t extracted;
+
+    for (chunk = 0; chunk < n_chunks; chunk++)
+    {
+        extracted = (sens_sel == 0) ? count[chunk].accel_frames :
+                    (sens_sel == 1) ? count[chunk].gyro_frames : count[chunk].temp_frames;
+
+        if (n != (chunk * chunk_frames))
+        {
+            (void)memmove(base + ((size_t)n * size), base + ((size_t)chunk * chunk_frames * size), extracted * size);
+        }
+
+        n += extracted;
+    }
+
+    return n;
+}
+
+/*!
+ * @brief This internal API unwraps the 16-bit sensor time of the frames of a sensor.
+ */
+static PyObject *unwrap_time(const uint8_t *base, size_t size, size_t time_offset, Py_ssize_t n)
+{
+    PyObject *buf = PyByteArray_FromStringAndSize(NULL, n * (Py_ssize_t)sizeof(uint64_t));
+    uint64_t *ticks;
+    uint64_t now = 0;
+    uint16_t last = 0;
+    uint16_t sensor_time;
+    Py_ssize_t idx;
+
+    if (buf != NULL)
+    {
+        ticks = (uint64_t *)(void *)PyByteArray_AS_STRING(buf);
+
+        for (idx = 0; idx < n; idx++)
+        {
+            (void)memcpy(&sensor_time, base + ((size_t)idx * size) + time_offset, sizeof(sensor_time));
+
+            /* Differences are taken modulo 2^16, a gap of 65536 ticks or more is not seen */
+            now = (idx == 0) ? sensor_time : (now + (uint16_t)(sensor_time - last));
+            last = sensor_time;
+            ticks[idx] = now;
+        }
+    }
+
+    return buf;
+}
+
+/*!
+ * @brief This internal API is the read function of the decoding device.
+ */
+static BMI3_INTF_RET_TYPE no_bus_read(uint8_t reg_addr, uint8_t *reg_data, uint32_t len, void *intf_ptr)
+{
+    (void)reg_addr;
+    (void)reg_data;
+    (void)len;
+    (void)intf_ptr;
+
+    return (BMI3_INTF_RET_TYPE)-1;
+}
+
+/*!
+ * @brief This internal API is the write function of the decoding device.
+ */
+static BMI3_INTF_RET_TYPE no_bus_write(uint8_t reg_addr, const uint8_t *reg_data, uint32_t len, void *intf_ptr)
+{
+    (void)reg_addr;
+    (void)reg_data;
+    (void)len;
+    (void)intf_ptr;
+
+    return (BMI3_INTF_RET_TYPE)-1;
+}
+
+/*!
+ * @brief This internal API is the delay function of the decoding device.
+ */
+static void no_bus_delay_us(uint32_t period, void *intf_ptr)
+{
+    (void)period;
+    (void)intf_ptr;
+}
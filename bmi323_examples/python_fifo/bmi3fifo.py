@@ -0,0 +1,94 @@
+# Copyright (c) 2024 Bosch Sensortec GmbH. All rights reserved.
+#
+# SPDX-License-Identifier: BSD-3-Clause
+
+"""NumPy views of BMI3 FIFO captures decoded by the BMI3 Sensor API.
+
+The FIFO bytes are parsed by bmi3_extract_range in the _bmi3fifo extension,
+directly into the buffers the arrays returned here are views of, so no frame
+is copied after parsing. Large captures are parsed by one thread per CPU.
+
+Usage : python3 bmi3fifo.py <capture> <available_fifo_sens>
+"""
+
+import sys
+
+import numpy as np
+
+import _bmi3fifo
+
+FIFO_TIME_EN = _bmi3fifo.FIFO_TIME_EN
+FIFO_ACC_EN = _bmi3fifo.FIFO_ACC_EN
+FIFO_GYR_EN = _bmi3fifo.FIFO_GYR_EN
+FIFO_TEMP_EN = _bmi3fifo.FIFO_TEMP_EN
+
+# Sensor time resolution in seconds, as BMI3_SENSORTIME_RESOLUTION
+SENSORTIME_RESOLUTION = 0.0000390625
+
+# Size of struct bmi3_fifo_sens_axes_data and struct bmi3_fifo_temperature_data
+_AXES_SIZE = 8
+_TEMP_SIZE = 4
+
+
+def _axes(buf):
+    """(n, 3) int16 view of x, y and z of struct bmi3_fifo_sens_axes_data."""
+    n = len(buf) // _AXES_SIZE
+    return np.ndarray((n, 3), dtype=np.int16, buffer=buf, strides=(_AXES_SIZE, 2))
+
+
+def _temp(buf):
+    """(n,) int16 view of temp_data of struct bmi3_fifo_temperature_data."""
+    n = len(buf) // _TEMP_SIZE
+    return np.ndarray((n,), dtype=np.int16, buffer=buf, strides=(_TEMP_SIZE,))
+
+
+def decode(data, available_fifo_sens, threads=0):
+    """Decodes raw headerless FIFO bytes, without dummy bytes.
+
+    data                : Any buffer-protocol object, e.g. bytes, mmap or a uint8 array.
+    available_fifo_sens : FIFO_*_EN bits the FIFO data was recorded with.
+    threads             : 0 for one thread per CPU on large captures, 1 for the calling thread only.
+
+    Returns a dict of arrays: "accel" and "gyro" (n, 3) int16 LSB, "temp" (n,)
+    int16 LSB, and "<sensor>_time" (n,) uint64 sensor time ticks, unwrapped from
+    the first frame. Entries of sensors not enabled, and the times without
+    FIFO_TIME_EN, are None. Dummy frames are dropped.
+    """
+    raw = _bmi3fifo.decode(data, available_fifo_sens, threads)
+    out = {}
+
+    for name in ("accel", "gyro"):
+        out[name] = _axes(raw[name]) if raw[name] is not None else None
+
+    out["temp"] = _temp(raw["temp"]) if raw["temp"] is not None else None
+
+    for name in ("accel_time", "gyro_time", "temp_time"):
+        out[name] = np.frombuffer(raw[name], dtype=np.uint64) if raw[name] is not None else None
+
+    return out
+
+
+def main(argv):
+    """Prints the number of frames and time span of each sensor of a capture."""
+    if len(argv) != 3:
+        print(__doc__.strip().splitlines()[-1])
+        return 1
+
+    with open(argv[1], "rb") as capture:
+        frames = decode(capture.read(), int(argv[2], 0))
+
+    for name in ("accel", "gyro", "temp"):
+        if frames[name] is not None:
+            span = ""
+
+            if (frames[name + "_time"] is not None) and (len(frames[name + "_time"]) > 1):
+                ticks = frames[name + "_time"]
+                span = " over %.3f s" % ((ticks[-1] - ticks[0]) * SENSORTIME_RESOLUTION)
+
+            print("%s: %d frames%s" % (name, len(frames[name]), span))
+
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv))
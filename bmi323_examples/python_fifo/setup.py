@@ -0,0 +1,22 @@
+# Build of the _bmi3fifo extension against the sources of the BMI3 Sensor API:
+#   python3 setup.py build_ext --inplace
+
+from setuptools import Extension, setup
+
+API_LOCATION = "../.."
+
+setup(
+    name="bmi3fifo",
+    version="1.0.0",
+    description="Decoding of BMI3 FIFO captures by the BMI3 Sensor API",
+    py_modules=["bmi3fifo"],
+    ext_modules=[
+        Extension(
+            "_bmi3fifo",
+            sources=["bmi3fifo.c", API_LOCATION + "/bmi3.c"],
+            include_dirs=[API_LOCATION],
+            extra_compile_args=["-std=c99", "-O2"],
+            extra_link_args=["-pthread"],
+        )
+    ],
+)
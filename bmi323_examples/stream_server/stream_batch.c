@@ -0,0 +1,633 @@
+/**\
+ * Copyright (c) 2024 Bosch Sensortec GmbH. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ **/
+
+/******************************************************************************/
+/*!                 Header Files                                              */
+#define _POSIX_C_SOURCE 200809L
+
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <string.h>
+#include <unistd.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <sys/uio.h>
+#include "stream_batch.h"
+
+/******************************************************************************/
+/*!           Static Function Declaration                                     */
+
+/*!
+ * @brief This internal API stores a 16-bit value in little-endian order.
+ */
+static void put_le16(uint8_t *buf, uint16_t value);
+
+/*!
+ * @brief This internal API stores a 32-bit value in little-endian order.
+ */
+static void put_le32(uint8_t *buf, uint32_t value);
+
+/*!
+ * @brief This internal API stores a 64-bit value in little-endian order.
+ */
+static void put_le64(uint8_t *buf, uint64_t value);
+
+/*!
+ * @brief This internal API loads a 16-bit value in little-endian order.
+ */
+static uint16_t get_le16(const uint8_t *buf);
+
+/*!
+ * @brief This internal API loads a 32-bit value in little-endian order.
+ */
+static uint32_t get_le32(const uint8_t *buf);
+
+/*!
+ * @brief This internal API loads a 64-bit value in little-endian order.
+ */
+static uint64_t get_le64(const uint8_t *buf);
+
+/*!
+ * @brief This internal API gets a batch which is neither filling nor queued.
+ *
+ * @param[in] srv : Structure instance of stream_server.
+ *
+ * @return Index of the batch, STREAM_BATCH_SLOTS if all batches are in flight
+ */
+static uint8_t get_free_batch(const struct stream_server *srv);
+
+/*!
+ * @brief This internal API accepts the pending connections.
+ *
+ * @param[in,out] srv : Structure instance of stream_server.
+ */
+static void accept_clients(struct stream_server *srv);
+
+/*!
+ * @brief This internal API sends the queued batches of a client with a single
+ * non-blocking sendmsg, and releases the batches sent completely.
+ *
+ * @param[in,out] srv    : Structure instance of stream_server.
+ * @param[in,out] client : Structure instance of stream_client.
+ *
+ * @return 0 on success or if the socket is full, -1 if the client is gone
+ */
+static int send_client(struct stream_server *srv, struct stream_client *client);
+
+/*!
+ * @brief This internal API closes a client and releases its queued batches.
+ *
+ * @param[in,out] srv    : Structure instance of stream_server.
+ * @param[in,out] client : Structure instance of stream_client.
+ */
+static void drop_client(struct stream_server *srv, struct stream_client *client);
+
+/*!
+ * @brief This internal API drops the clients of which the oldest queued batch
+ * is unsent since STREAM_STALL_NS, if all batches are in flight.
+ *
+ * @param[in,out] srv    : Structure instance of stream_server.
+ * @param[in]     now_ns : Host time in nanoseconds.
+ */
+static void drop_stalled_clients(struct stream_server *srv, uint64_t now_ns);
+
+/******************************************************************************/
+/*!               User interface functions                                    */
+
+/*!
+ * @brief This function opens the listening socket of the server.
+ */
+int stream_server_open(struct stream_server *srv, uint16_t port)
+{
+    int rslt = -1;
+    int one = 1;
+    uint8_t idx;
+    struct sockaddr_in addr;
+
+    if (srv != NULL)
+    {
+        srv->fill = STREAM_BATCH_SLOTS;
+        srv->seq = 0;
+        srv->sends = 0;
+        srv->bytes = 0;
+        srv->dropped = 0;
+
+        for (idx = 0; idx < STREAM_BATCH_SLOTS; idx++)
+        {
+            srv->batch[idx].len = 0;
+            srv->batch[idx].n_records = 0;
+            srv->batch[idx].refs = 0;
+            srv->batch[idx].filling = 0;
+        }
+
+        for (idx = 0; idx < STREAM_MAX_CLIENTS; idx++)
+        {
+            srv->client[idx].fd = -1;
+            srv->client[idx].head = 0;
+            srv->client[idx].count = 0;
+            srv->client[idx].offset = 0;
+        }
+
+        memset(&addr, 0, sizeof(addr));
+        addr.sin_family = AF_INET;
+        addr.sin_addr.s_addr = htonl(INADDR_ANY);
+        addr.sin_port = htons(port);
+
+        srv->listen_fd = socket(AF_INET, SOCK_STREAM, 0);
+
+        if ((srv->listen_fd >= 0) &&
+            (setsockopt(srv->listen_fd, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one)) == 0) &&
+            (bind(srv->listen_fd, (const struct sockaddr *)&addr, sizeof(addr)) == 0) &&
+            (listen(srv->listen_fd, STREAM_MAX_CLIENTS) == 0) &&
+            (fcntl(srv->listen_fd, F_SETFL, O_NONBLOCK) == 0))
+        {
+            rslt = 0;
+        }
+        else if (srv->listen_fd >= 0)
+        {
+            (void)close(srv->listen_fd);
+            srv->listen_fd = -1;
+        }
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This function closes the listening socket and all clients.
+ */
+void stream_server_close(struct stream_server *srv)
+{
+    uint8_t idx;
+
+    if (srv != NULL)
+    {
+        for (idx = 0; idx < STREAM_MAX_CLIENTS; idx++)
+        {
+            if (srv->client[idx].fd >= 0)
+            {
+                drop_client(srv, &srv->client[idx]);
+            }
+        }
+
+        if (srv->listen_fd >= 0)
+        {
+            (void)close(srv->listen_fd);
+            srv->listen_fd = -1;
+        }
+    }
+}
+
+/*!
+ * @brief This function reserves room for a record in the batch being filled.
+ */
+uint8_t *stream_server_reserve(struct stream_server *srv, uint32_t len, uint64_t now_ns)
+{
+    uint8_t *rec = NULL;
+    struct stream_batch *batch;
+
+    if ((srv != NULL) && (len <= (STREAM_BATCH_SIZE - STREAM_BATCH_HDR_LEN)))
+    {
+        if ((srv->fill < STREAM_BATCH_SLOTS) && ((srv->batch[srv->fill].len + len) > STREAM_BATCH_SIZE))
+        {
+            /* Batch is full, send it and continue in the next one */
+            stream_server_flush(srv, 0, now_ns);
+        }
+
+        if (srv->fill >= STREAM_BATCH_SLOTS)
+        {
+            srv->fill = get_free_batch(srv);
+
+            if (srv->fill < STREAM_BATCH_SLOTS)
+            {
+                batch = &srv->batch[srv->fill];
+                batch->len = STREAM_BATCH_HDR_LEN;
+                batch->n_records = 0;
+                batch->filling = 1;
+                batch->time_ns = now_ns;
+            }
+        }
+
+        if (srv->fill < STREAM_BATCH_SLOTS)
+        {
+            rec = &srv->batch[srv->fill].data[srv->batch[srv->fill].len];
+        }
+    }
+
+    return rec;
+}
+
+/*!
+ * @brief This function adds the record encoded at the reserved room to the batch.
+ */
+void stream_server_commit(struct stream_server *srv, const struct stream_record *rec)
+{
+    struct stream_batch *batch;
+
+    if ((srv != NULL) && (rec != NULL) && (srv->fill < STREAM_BATCH_SLOTS))
+    {
+        batch = &srv->batch[srv->fill];
+
+        stream_pack_record(rec, &batch->data[batch->len]);
+        batch->len += STREAM_RECORD_HDR_LEN + rec->len;
+        batch->n_records++;
+    }
+}
+
+/*!
+ * @brief This function tells whether records of the given length can be reserved.
+ */
+int stream_server_ready(const struct stream_server *srv, uint32_t len)
+{
+    int ready = 0;
+
+    if ((srv != NULL) && (len <= (STREAM_BATCH_SIZE - STREAM_BATCH_HDR_LEN)))
+    {
+        if ((srv->fill < STREAM_BATCH_SLOTS) && ((srv->batch[srv->fill].len + len) <= STREAM_BATCH_SIZE))
+        {
+            ready = 1;
+        }
+        else if (get_free_batch(srv) < STREAM_BATCH_SLOTS)
+        {
+            ready = 1;
+        }
+    }
+
+    return ready;
+}
+
+/*!
+ * @brief This function closes the batch being filled and queues it to all clients.
+ */
+void stream_server_flush(struct stream_server *srv, uint64_t max_age_ns, uint64_t now_ns)
+{
+    uint8_t idx;
+    struct stream_batch *batch;
+    struct stream_client *client;
+
+    if ((srv != NULL) && (srv->fill < STREAM_BATCH_SLOTS))
+    {
+        batch = &srv->batch[srv->fill];
+
+        if ((batch->n_records != 0) && ((now_ns - batch->time_ns) >= max_age_ns))
+        {
+            put_le32(&batch->data[0], STREAM_BATCH_MAGIC);
+            batch->data[4] = STREAM_BATCH_VERSION;
+            batch->data[5] = 0;
+            put_le16(&batch->data[6], batch->n_records);
+            put_le32(&batch->data[8], srv->seq);
+            put_le32(&batch->data[12], batch->len);
+
+            batch->filling = 0;
+            batch->time_ns = now_ns;
+            srv->seq++;
+
+            /* Shared by the clients; without clients the batch is free right away */
+            for (idx = 0; idx < STREAM_MAX_CLIENTS; idx++)
+            {
+                client = &srv->client[idx];
+
+                if (client->fd >= 0)
+                {
+                    client->queue[(client->head + client->count) % STREAM_BATCH_SLOTS] = srv->fill;
+                    client->count++;
+                    batch->refs++;
+                }
+            }
+
+            srv->fill = STREAM_BATCH_SLOTS;
+        }
+    }
+}
+
+/*!
+ * @brief This function waits for the sockets, accepts clients and sends the queued batches.
+ */
+int stream_server_poll(struct stream_server *srv, int timeout_ms, uint64_t now_ns)
+{
+    int rslt = -1;
+    uint8_t idx;
+    nfds_t n_fds = 1;
+    struct pollfd fds[STREAM_MAX_CLIENTS + 1];
+    uint8_t client_idx[STREAM_MAX_CLIENTS + 1];
+    uint8_t discard[64];
+    ssize_t n;
+    struct stream_client *client;
+
+    if (srv != NULL)
+    {
+        drop_stalled_clients(srv, now_ns);
+
+        fds[0].fd = srv->listen_fd;
+        fds[0].events = POLLIN;
+
+        for (idx = 0; idx < STREAM_MAX_CLIENTS; idx++)
+        {
+            if (srv->client[idx].fd >= 0)
+            {
+                fds[n_fds].fd = srv->client[idx].fd;
+                fds[n_fds].events = (short)((srv->client[idx].count != 0) ? (POLLIN | POLLOUT) : POLLIN);
+                client_idx[n_fds] = idx;
+                n_fds++;
+            }
+        }
+
+        if ((poll(fds, n_fds, timeout_ms) >= 0) || (errno == EINTR))
+        {
+            rslt = 0;
+        }
+
+        for (idx = 1; (rslt == 0) && (idx < n_fds); idx++)
+        {
+            client = &srv->client[client_idx[idx]];
+
+            if (fds[idx].revents & (POLLERR | POLLHUP))
+            {
+                drop_client(srv, client);
+            }
+            else
+            {
+                if (fds[idx].revents & POLLIN)
+                {
+                    /* Clients do not send anything, a read tells whether they are gone */
+                    n = recv(client->fd, discard, sizeof(discard), MSG_DONTWAIT);
+
+                    if ((n == 0) || ((n < 0) && (errno != EAGAIN) && (errno != EWOULDBLOCK) && (errno != EINTR)))
+                    {
+                        drop_client(srv, client);
+                    }
+                }
+
+                if ((client->fd >= 0) && (fds[idx].revents & POLLOUT) && (send_client(srv, client) != 0))
+                {
+                    drop_client(srv, client);
+                }
+            }
+        }
+
+        if ((rslt == 0) && (fds[0].revents & POLLIN))
+        {
+            accept_clients(srv);
+        }
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This function packs a record header to the wire format.
+ */
+void stream_pack_record(const struct stream_record *rec, uint8_t *buf)
+{
+    buf[0] = rec->dev_id;
+    buf[1] = rec->sensor;
+    buf[2] = rec->odr;
+    buf[3] = 0;
+    put_le16(&buf[4], rec->count);
+    put_le16(&buf[6], rec->len);
+    put_le64(&buf[8], rec->first_ns);
+    put_le64(&buf[16], rec->last_ns);
+}
+
+/*!
+ * @brief This function unpacks a record header from the wire format.
+ */
+void stream_unpack_record(const uint8_t *buf, struct stream_record *rec)
+{
+    rec->dev_id = buf[0];
+    rec->sensor = buf[1];
+    rec->odr = buf[2];
+    rec->count = get_le16(&buf[4]);
+    rec->len = get_le16(&buf[6]);
+    rec->first_ns = get_le64(&buf[8]);
+    rec->last_ns = get_le64(&buf[16]);
+}
+
+/*!
+ * @brief This function unpacks a batch header from the wire format.
+ */
+int stream_unpack_batch(const uint8_t *buf, struct stream_batch_hdr *hdr)
+{
+    hdr->magic = get_le32(&buf[0]);
+    hdr->version = buf[4];
+    hdr->n_records = get_le16(&buf[6]);
+    hdr->seq = get_le32(&buf[8]);
+    hdr->len = get_le32(&buf[12]);
+
+    return ((hdr->magic == STREAM_BATCH_MAGIC) && (hdr->version == STREAM_BATCH_VERSION) &&
+            (hdr->len >= STREAM_BATCH_HDR_LEN) && (hdr->len <= STREAM_BATCH_SIZE)) ? 0 : -1;
+}
+
+/*********************** Static function definitions **************************/
+
+/*!
+ * @brief This internal API stores a 16-bit value in little-endian order.
+ */
+static void put_le16(uint8_t *buf, uint16_t value)
+{
+    buf[0] = (uint8_t)value;
+    buf[1] = (uint8_t)(value >> 8);
+}
+
+/*!
+ * @brief This internal API stores a 32-bit value in little-endian order.
+ */
+static void put_le32(uint8_t *buf, uint32_t value)
+{
+    put_le16(&buf[0], (uint16_t)value);
+    put_le16(&buf[2], (uint16_t)(value >> 16));
+}
+
+/*!
+ * @brief This internal API stores a 64-bit value in little-endian order.
+ */
+static void put_le64(uint8_t *buf, uint64_t value)
+{
+    put_le32(&buf[0], (uint32_t)value);
+    put_le32(&buf[4], (uint32_t)(value >> 32));
+}
+
+/*!
+ * @brief This internal API loads a 16-bit value in little-endian order.
+ */
+static uint16_t get_le16(const uint8_t *buf)
+{
+    return (uint16_t)(buf[0] | ((uint16_t)buf[1] << 8));
+}
+
+/*!
+ * @brief This internal API loads a 32-bit value in little-endian order.
+ */
+static uint32_t get_le32(const uint8_t *buf)
+{
+    return get_le16(&buf[0]) | ((uint32_t)get_le16(&buf[2]) << 16);
+}
+
+/*!
+ * @brief This internal API loads a 64-bit value in little-endian order.
+ */
+static uint64_t get_le64(const uint8_t *buf)
+{
+    return get_le32(&buf[0]) | ((uint64_t)get_le32(&buf[4]) << 32);
+}
+
+/*!
+ * @brief This internal API gets a batch which is neither filling nor queued.
+ */
+static uint8_t get_free_batch(const struct stream_server *srv)
+{
+    uint8_t idx;
+
+    for (idx = 0; idx < STREAM_BATCH_SLOTS; idx++)
+    {
+        if ((srv->batch[idx].filling == 0) && (srv->batch[idx].refs == 0))
+        {
+            break;
+        }
+    }
+
+    return idx;
+}
+
+/*!
+ * @brief This internal API accepts the pending connections.
+ */
+static void accept_clients(struct stream_server *srv)
+{
+    int fd;
+    uint8_t idx;
+
+    while ((fd = accept(srv->listen_fd, NULL, NULL)) >= 0)
+    {
+        for (idx = 0; (idx < STREAM_MAX_CLIENTS) && (srv->client[idx].fd >= 0); idx++)
+        {
+        }
+
+        if ((idx < STREAM_MAX_CLIENTS) && (fcntl(fd, F_SETFL, O_NONBLOCK) == 0))
+        {
+            /* Client starts with the next batch closed; records are self-contained */
+            srv->client[idx].fd = fd;
+            srv->client[idx].head = 0;
+            srv->client[idx].count = 0;
+            srv->client[idx].offset = 0;
+        }
+        else
+        {
+            (void)close(fd);
+        }
+    }
+}
+
+/*!
+ * @brief This internal API sends the queued batches of a client with a single sendmsg.
+ */
+static int send_client(struct stream_server *srv, struct stream_client *client)
+{
+    int rslt = 0;
+    uint8_t idx;
+    struct iovec iov[STREAM_BATCH_SLOTS];
+    struct msghdr msg;
+    struct stream_batch *batch;
+    ssize_t n;
+    size_t sent;
+    uint32_t left;
+
+    if (client->count != 0)
+    {
+        /* Gathered straight from the shared batch buffers, no copy per client */
+        for (idx = 0; idx < client->count; idx++)
+        {
+            batch = &srv->batch[client->queue[(client->head + idx) % STREAM_BATCH_SLOTS]];
+            iov[idx].iov_base = &batch->data[(idx == 0) ? client->offset : 0];
+            iov[idx].iov_len = batch->len - ((idx == 0) ? client->offset : 0);
+        }
+
+        memset(&msg, 0, sizeof(msg));
+        msg.msg_iov = iov;
+        msg.msg_iovlen = client->count;
+
+        n = sendmsg(client->fd, &msg, MSG_DONTWAIT | MSG_NOSIGNAL);
+        srv->sends++;
+
+        if (n < 0)
+        {
+            if ((errno != EAGAIN) && (errno != EWOULDBLOCK) && (errno != EINTR))
+            {
+                rslt = -1;
+            }
+        }
+        else
+        {
+            sent = (size_t)n;
+            srv->bytes += sent;
+
+            /* Partial writes resume at the offset of the oldest batch */
+            while ((sent != 0) && (client->count != 0))
+            {
+                batch = &srv->batch[client->queue[client->head]];
+                left = batch->len - client->offset;
+
+                if (sent >= left)
+                {
+                    sent -= left;
+                    client->offset = 0;
+                    client->head = (uint8_t)((client->head + 1) % STREAM_BATCH_SLOTS);
+                    client->count--;
+                    batch->refs--;
+                }
+                else
+                {
+                    client->offset += (uint32_t)sent;
+                    sent = 0;
+                }
+            }
+        }
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This internal API closes a client and releases its queued batches.
+ */
+static void drop_client(struct stream_server *srv, struct stream_client *client)
+{
+    while (client->count != 0)
+    {
+        srv->batch[client->queue[client->head]].refs--;
+        client->head = (uint8_t)((client->head + 1) % STREAM_BATCH_SLOTS);
+        client->count--;
+    }
+
+    (void)close(client->fd);
+    client->fd = -1;
+    client->offset = 0;
+}
+
+/*!
+ * @brief This internal API drops the clients stalling the batches.
+ */
+static void drop_stalled_clients(struct stream_server *srv, uint64_t now_ns)
+{
+    uint8_t idx;
+    struct stream_client *client;
+
+    if (get_free_batch(srv) >= STREAM_BATCH_SLOTS)
+    {
+        for (idx = 0; idx < STREAM_MAX_CLIENTS; idx++)
+        {
+            client = &srv->client[idx];
+
+            if ((client->fd >= 0) && (client->count != 0) &&
+                ((now_ns - srv->batch[client->queue[client->head]].time_ns) > STREAM_STALL_NS))
+            {
+                drop_client(srv, client);
+                srv->dropped++;
+            }
+        }
+    }
+}
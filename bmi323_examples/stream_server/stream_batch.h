@@ -0,0 +1,273 @@
+/**\
+ * Copyright (c) 2024 Bosch Sensortec GmbH. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ **/
+
+#ifndef _STREAM_BATCH_H
+#define _STREAM_BATCH_H
+
+/*! CPP guard */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/******************************************************************************/
+/*!                 Header Files                                              */
+#include <stddef.h>
+#include "bmi3.h"
+
+/******************************************************************************/
+/*!         Macros definition                                                */
+
+/*! Magic number of the batch header ("B3SB" in little-endian order) */
+#define STREAM_BATCH_MAGIC               UINT32_C(0x42533342)
+
+/*! Version of the wire format */
+#define STREAM_BATCH_VERSION             UINT8_C(1)
+
+/*! Length of the batch header on the wire */
+#define STREAM_BATCH_HDR_LEN             UINT32_C(16)
+
+/*! Length of the record header on the wire */
+#define STREAM_RECORD_HDR_LEN            UINT32_C(24)
+
+/*! Size of a batch, header and records */
+#define STREAM_BATCH_SIZE                UINT32_C(65536)
+
+/*! Number of batches, closed or filling. Bounds the data queued for slow clients */
+#define STREAM_BATCH_SLOTS               UINT8_C(8)
+
+/*! Maximum number of clients */
+#define STREAM_MAX_CLIENTS               UINT8_C(8)
+
+/*! Time in nanoseconds a batch may stay unsent before the clients holding it are dropped */
+#define STREAM_STALL_NS                  UINT64_C(500000000)
+
+/*! Sensor of a record */
+#define STREAM_SENSOR_ACCEL              UINT8_C(0)
+#define STREAM_SENSOR_GYRO               UINT8_C(1)
+
+/******************************************************************************/
+/*!         Structure definition                                              */
+
+/*!
+ * @brief Structure to define the header of a batch: all records of the
+ * devices collected over one flush period
+ */
+struct stream_batch_hdr
+{
+    /*! STREAM_BATCH_MAGIC */
+    uint32_t magic;
+
+    /*! STREAM_BATCH_VERSION */
+    uint8_t version;
+
+    /*! Number of records */
+    uint16_t n_records;
+
+    /*! Sequence number of the batch, consecutive per server */
+    uint32_t seq;
+
+    /*! Length of the batch in bytes, header included */
+    uint32_t len;
+};
+
+/*!
+ * @brief Structure to define the header of a record: the samples of one sensor
+ * of one device from one FIFO read, delta encoded by bmi3_delta_encode
+ */
+struct stream_record
+{
+    /*! Index of the device */
+    uint8_t dev_id;
+
+    /*! STREAM_SENSOR_ACCEL or STREAM_SENSOR_GYRO */
+    uint8_t sensor;
+
+    /*! Output data rate of the samples, BMI3_ACC_ODR_* */
+    uint8_t odr;
+
+    /*! Number of samples */
+    uint16_t count;
+
+    /*! Length of the encoded samples following the header */
+    uint16_t len;
+
+    /*! Host time in nanoseconds of the first sample */
+    uint64_t first_ns;
+
+    /*! Host time in nanoseconds of the last sample */
+    uint64_t last_ns;
+};
+
+/*!
+ * @brief Structure to define a batch buffer, shared by all clients it is
+ * queued to
+ */
+struct stream_batch
+{
+    /*! Header and records */
+    uint8_t data[STREAM_BATCH_SIZE];
+
+    /*! Number of bytes used */
+    uint32_t len;
+
+    /*! Number of records */
+    uint16_t n_records;
+
+    /*! Number of clients still sending the batch; the batch is free at 0 unless filling */
+    uint8_t refs;
+
+    /*! 1 while records are added */
+    uint8_t filling;
+
+    /*! Host time in nanoseconds the batch was opened or closed */
+    uint64_t time_ns;
+};
+
+/*!
+ * @brief Structure to define a connected client
+ */
+struct stream_client
+{
+    /*! Socket, -1 if the entry is unused */
+    int fd;
+
+    /*! Indexes of the batches queued, oldest first */
+    uint8_t queue[STREAM_BATCH_SLOTS];
+
+    /*! Index of the oldest entry of the queue */
+    uint8_t head;
+
+    /*! Number of entries of the queue */
+    uint8_t count;
+
+    /*! Number of bytes of the oldest batch already sent */
+    uint32_t offset;
+};
+
+/*!
+ * @brief Structure to define the server: listening socket, clients and the
+ * batches in flight
+ */
+struct stream_server
+{
+    /*! Listening socket */
+    int listen_fd;
+
+    /*! Index of the batch records are added to, STREAM_BATCH_SLOTS if none */
+    uint8_t fill;
+
+    /*! Sequence number of the next batch */
+    uint32_t seq;
+
+    /*! Batches */
+    struct stream_batch batch[STREAM_BATCH_SLOTS];
+
+    /*! Clients */
+    struct stream_client client[STREAM_MAX_CLIENTS];
+
+    /*! Number of sendmsg calls, to measure the effect of batching */
+    uint32_t sends;
+
+    /*! Number of bytes sent to all clients */
+    uint64_t bytes;
+
+    /*! Number of clients dropped for stalling the batches */
+    uint32_t dropped;
+};
+
+/******************************************************************************/
+/*!         Functions                                                         */
+
+/*!
+ *  @brief This function opens the listening socket of the server.
+ *  @param[out] srv  : Structure instance of stream_server.
+ *  @param[in]  port : TCP port.
+ *  @return 0 on success, -1 otherwise
+ */
+int stream_server_open(struct stream_server *srv, uint16_t port);
+
+/*!
+ *  @brief This function closes the listening socket and all clients.
+ *  @param[in,out] srv : Structure instance of stream_server.
+ */
+void stream_server_close(struct stream_server *srv);
+
+/*!
+ *  @brief This function reserves room for a record in the batch being filled,
+ *  opening a batch if needed. The record is encoded in place, right where it
+ *  is sent from.
+ *  @param[in,out] srv    : Structure instance of stream_server.
+ *  @param[in]     len    : Maximum length of the record, header included.
+ *  @param[in]     now_ns : Host time in nanoseconds.
+ *  @return Start of the record, NULL if all batches are in flight
+ */
+uint8_t *stream_server_reserve(struct stream_server *srv, uint32_t len, uint64_t now_ns);
+
+/*!
+ *  @brief This function adds the record encoded at the reserved room to the
+ *  batch being filled.
+ *  @param[in,out] srv : Structure instance of stream_server.
+ *  @param[in]     rec : Header of the record, of which "len" bytes follow.
+ */
+void stream_server_commit(struct stream_server *srv, const struct stream_record *rec);
+
+/*!
+ *  @brief This function tells whether records of the given length can be
+ *  reserved without blocking, so that a read from the sensors can be skipped
+ *  while the clients catch up and the data is kept in the sensor FIFOs.
+ *  @param[in] srv : Structure instance of stream_server.
+ *  @param[in] len : Total length of the records.
+ *  @return 1 if there is room, 0 otherwise
+ */
+int stream_server_ready(const struct stream_server *srv, uint32_t len);
+
+/*!
+ *  @brief This function closes the batch being filled, if it holds records
+ *  and is at least "max_age_ns" old, and queues it to all clients.
+ *  @param[in,out] srv        : Structure instance of stream_server.
+ *  @param[in]     max_age_ns : Age in nanoseconds, 0 to close regardless of the age.
+ *  @param[in]     now_ns     : Host time in nanoseconds.
+ */
+void stream_server_flush(struct stream_server *srv, uint64_t max_age_ns, uint64_t now_ns);
+
+/*!
+ *  @brief This function waits for the sockets, accepts clients and sends the
+ *  queued batches. Each client is sent all of its queued batches with one
+ *  non-blocking sendmsg, gathered straight from the batch buffers.
+ *  @param[in,out] srv        : Structure instance of stream_server.
+ *  @param[in]     timeout_ms : Timeout of the wait in milliseconds.
+ *  @param[in]     now_ns     : Host time in nanoseconds.
+ *  @return 0 on success, -1 otherwise
+ */
+int stream_server_poll(struct stream_server *srv, int timeout_ms, uint64_t now_ns);
+
+/*!
+ *  @brief This function packs a record header to the wire format.
+ *  @param[in]  rec : Header of the record.
+ *  @param[out] buf : STREAM_RECORD_HDR_LEN bytes.
+ */
+void stream_pack_record(const struct stream_record *rec, uint8_t *buf);
+
+/*!
+ *  @brief This function unpacks a record header from the wire format.
+ *  @param[in]  buf : STREAM_RECORD_HDR_LEN bytes.
+ *  @param[out] rec : Header of the record.
+ */
+void stream_unpack_record(const uint8_t *buf, struct stream_record *rec);
+
+/*!
+ *  @brief This function unpacks a batch header from the wire format.
+ *  @param[in]  buf : STREAM_BATCH_HDR_LEN bytes.
+ *  @param[out] hdr : Header of the batch.
+ *  @return 0 if the magic, version and length are valid, -1 otherwise
+ */
+int stream_unpack_batch(const uint8_t *buf, struct stream_batch_hdr *hdr);
+
+#ifdef __cplusplus
+}
+#endif /* End of CPP guard */
+
+#endif /* _STREAM_BATCH_H */
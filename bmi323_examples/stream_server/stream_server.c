@@ -0,0 +1,734 @@
+/**\
+ * Copyright (c) 2024 Bosch Sensortec GmbH. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ **/
+
+/*
+ * Stream server. The FIFOs of several sensors are read in turn by the group
+ * engine, each burst is delta encoded straight into a shared batch buffer with
+ * the host times of its first and last sample, and the batches are sent to any
+ * number of TCP clients, gathered from the batch buffers with one sendmsg per
+ * client. While slow clients hold all batches, the sensors are not read and
+ * the data waits in their FIFOs; a client stalling for STREAM_STALL_NS is dropped.
+ *
+ * Usage : stream_server serve <port> <bus device>[@i2c address] [<bus device>[@i2c address] ...]
+ *         stream_server receive <host> <port>
+ */
+
+/******************************************************************************/
+/*!                 Header Files                                              */
+#define _POSIX_C_SOURCE 200809L
+
+#include <errno.h>
+#include <netdb.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include "bmi323.h"
+#include "linux_bus.h"
+#include "stream_batch.h"
+
+/******************************************************************************/
+/*!         Macros definition                                                */
+
+/*! Number of FIFO data bytes read per device, the whole FIFO along with the dummy bytes */
+#define STREAM_SLOT_SIZE                 ((BMI3_FIFO_SIZE_WORDS * 2) + BMI3_MAX_DUMMY_BYTE)
+
+/*! Maximum number of frames of a sensor per FIFO read */
+#define STREAM_FRAMES                    (STREAM_SLOT_SIZE / BMI3_LENGTH_FIFO_ACC)
+
+/*! Maximum length of a record, header and delta encoded blocks */
+#define STREAM_RECORD_MAX_LEN \
+    (STREAM_RECORD_HDR_LEN + \
+     (((STREAM_FRAMES + BMI3_DELTA_BLOCK_SAMPLES - 1) / BMI3_DELTA_BLOCK_SAMPLES) * BMI3_DELTA_BLOCK_MAX_LEN))
+
+/*! Output data rate of accel and gyro */
+#define STREAM_ODR                       BMI3_ACC_ODR_200HZ
+
+/*! FIFO water-mark level in words */
+#define STREAM_FIFO_WM                   UINT16_C(120)
+
+/*! Period of the FIFO service of the group in nanoseconds */
+#define STREAM_SERVICE_NS                UINT64_C(10000000)
+
+/*! Age in nanoseconds at which a batch is sent, unless it is full before */
+#define STREAM_BATCH_AGE_NS              UINT64_C(50000000)
+
+/*! Period of the clock synchronization in nanoseconds */
+#define STREAM_SYNC_NS                   UINT64_C(1000000000)
+
+/*! Largest uncertainty in nanoseconds of a clock synchronization sample */
+#define STREAM_SYNC_UNCERTAINTY_NS       UINT32_C(200000)
+
+/******************************************************************************/
+/*!         Structure definition                                              */
+
+/*!
+ * @brief Structure to define a sensor of the server
+ */
+struct stream_dev
+{
+    /*! Bus of the sensor */
+    struct linux_bus bus;
+
+    /*! Device of the sensor */
+    struct bmi3_dev dev;
+
+    /*! FIFO timestamp reconstruction of accel and gyro */
+    struct bmi3_fifo_time fifo_time[2];
+
+    /*! Synchronization of the sensor time to CLOCK_MONOTONIC */
+    struct bmi3_clock_sync clock_sync;
+};
+
+/******************************************************************************/
+/*!         Static variable definition                                        */
+
+/*! Set by SIGINT to stop */
+static volatile sig_atomic_t stop;
+
+/*! Sensors */
+static struct stream_dev sensors[BMI3_GROUP_MAX_DEV];
+
+/*! Server, batches and clients */
+static struct stream_server server;
+
+/*! FIFO data of the sensors, shared by the group */
+static uint8_t arena[BMI3_GROUP_MAX_DEV * STREAM_SLOT_SIZE];
+
+/*! Frames of a sensor, extracted or decoded */
+static struct bmi3_fifo_sens_axes_data frames[STREAM_FRAMES];
+
+/*! Unwrapped sensor time of the frames */
+static uint64_t ticks[STREAM_FRAMES];
+
+/*! Batch received */
+static uint8_t rx_batch[STREAM_BATCH_SIZE];
+
+/******************************************************************************/
+/*!           Static Function Declaration                                     */
+
+/*!
+ *  @brief This internal API streams the FIFO data of the sensors until stopped.
+ *
+ *  @param[in] port  : TCP port.
+ *  @param[in] paths : Bus devices of the sensors, with the I2C address after '@'.
+ *  @param[in] n_dev : Number of sensors.
+ *
+ *  @return Status of execution
+ */
+static int8_t serve(uint16_t port, char * const *paths, uint8_t n_dev);
+
+/*!
+ *  @brief This internal API receives batches and prints a summary of each.
+ *
+ *  @param[in] host : Host of the server.
+ *  @param[in] port : TCP port of the server.
+ *
+ *  @return Status of execution
+ */
+static int8_t receive(const char *host, const char *port);
+
+/*!
+ *  @brief This internal API opens and sets up a sensor.
+ *
+ *  @param[in]  path : Bus device, with the I2C address after '@'.
+ *  @param[out] sd   : Structure instance of stream_dev.
+ *
+ *  @return Status of execution
+ */
+static int8_t open_sensor(const char *path, struct stream_dev *sd);
+
+/*!
+ *  @brief This internal API enables accelerometer, gyro, their FIFO and the
+ *  FIFO water-mark interrupt, in one register image.
+ *
+ *  @param[in] bus : Structure instance of linux_bus.
+ *  @param[in] dev : Structure instance of bmi3_dev.
+ *
+ *  @return Status of execution
+ */
+static int8_t set_fifo_stream(struct linux_bus *bus, struct bmi3_dev *dev);
+
+/*!
+ *  @brief This internal API reads the FIFOs of the group and adds a record of
+ *  each sensor to the batch.
+ *
+ *  @param[in,out] group  : Structure instance of bmi3_dev_group.
+ *  @param[in]     now_ns : Host time in nanoseconds.
+ */
+static void service_group(struct bmi3_dev_group *group, uint64_t now_ns);
+
+/*!
+ *  @brief This internal API timestamps and delta encodes the frames of one
+ *  sensor into a record of the batch.
+ *
+ *  @param[in]     dev_id : Index of the device.
+ *  @param[in]     sensor : STREAM_SENSOR_ACCEL or STREAM_SENSOR_GYRO.
+ *  @param[in]     fifo   : FIFO frame the frames are extracted from.
+ *  @param[in]     count  : Number of frames.
+ *  @param[in]     now_ns : Host time in nanoseconds.
+ *
+ *  @return Status of execution
+ */
+static int8_t add_record(uint8_t dev_id,
+                         uint8_t sensor,
+                         const struct bmi3_fifo_frame *fifo,
+                         uint16_t count,
+                         uint64_t now_ns);
+
+/*!
+ *  @brief This internal API reads exactly the given number of bytes from a socket.
+ *
+ *  @return 0 on success, -1 on error or end of stream
+ */
+static int read_full(int fd, uint8_t *buf, size_t len);
+
+/*!
+ *  @brief This internal API handles SIGINT.
+ */
+static void on_sigint(int sig);
+
+/*!
+ *  @brief This internal API gets the time of CLOCK_MONOTONIC in nanoseconds.
+ */
+static uint64_t get_time_ns(void);
+
+/*!
+ *  @brief This internal API is the host time function of the clock synchronization.
+ */
+static uint64_t host_time_ns(void *intf_ptr);
+
+/******************************************************************************/
+/*!            Functions                                        */
+
+/* This function starts the execution of program. */
+int main(int argc, char *argv[])
+{
+    int8_t rslt = BMI3_E_INVALID_INPUT;
+
+    (void)signal(SIGINT, on_sigint);
+
+    if ((argc > 3) && (argc <= (3 + BMI3_GROUP_MAX_DEV)) && (strcmp(argv[1], "serve") == 0))
+    {
+        rslt = serve((uint16_t)strtoul(argv[2], NULL, 0), &argv[3], (uint8_t)(argc - 3));
+    }
+    else if ((argc > 3) && (strcmp(argv[1], "receive") == 0))
+    {
+        rslt = receive(argv[2], argv[3]);
+    }
+    else
+    {
+        printf("Usage : %s serve <port> <bus device>[@i2c address] [<bus device>[@i2c address] ...]\n", argv[0]);
+        printf("        %s receive <host> <port>\n", argv[0]);
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This internal API streams the FIFO data of the sensors until stopped.
+ */
+static int8_t serve(uint16_t port, char * const *paths, uint8_t n_dev)
+{
+    int8_t rslt = BMI323_OK;
+    uint8_t idx;
+    uint8_t n_open = 0;
+    struct bmi3_dev *devs[BMI3_GROUP_MAX_DEV];
+    struct bmi3_dev_group group;
+    uint64_t now;
+    uint64_t next_service;
+    uint64_t next_sync;
+    uint32_t stalls = 0;
+    int timeout_ms;
+
+    for (idx = 0; (idx < n_dev) && (rslt == BMI323_OK); idx++)
+    {
+        rslt = open_sensor(paths[idx], &sensors[idx]);
+        devs[idx] = &sensors[idx].dev;
+
+        if (rslt == BMI323_OK)
+        {
+            n_open++;
+        }
+        else
+        {
+            printf("%s : error %d\n", paths[idx], rslt);
+        }
+    }
+
+    if (rslt == BMI323_OK)
+    {
+        rslt = bmi323_group_init(&group, devs, n_dev, arena, (uint16_t)(n_dev * STREAM_SLOT_SIZE));
+    }
+
+    if ((rslt == BMI323_OK) && (stream_server_open(&server, port) != 0))
+    {
+        printf("Port %u not available\n", port);
+        rslt = BMI3_E_COM_FAIL;
+    }
+
+    if (rslt == BMI323_OK)
+    {
+        printf("Serving %u sensors on port %u\n", n_dev, port);
+
+        now = get_time_ns();
+        next_service = now;
+        next_sync = now + STREAM_SYNC_NS;
+
+        while (!stop)
+        {
+            now = get_time_ns();
+
+            if (now >= next_service)
+            {
+                next_service = ((now - next_service) < STREAM_SERVICE_NS) ? (next_service + STREAM_SERVICE_NS) :
+                               (now + STREAM_SERVICE_NS);
+
+                /* Backpressure: without room for a record of each sensor the data stays in the FIFOs */
+                if (stream_server_ready(&server, (uint32_t)n_dev * 2 * STREAM_RECORD_MAX_LEN))
+                {
+                    service_group(&group, now);
+                }
+                else
+                {
+                    stalls++;
+                }
+            }
+
+            if (now >= next_sync)
+            {
+                next_sync += STREAM_SYNC_NS;
+
+                for (idx = 0; idx < n_dev; idx++)
+                {
+                    (void)bmi323_clock_sync_capture(host_time_ns, &sensors[idx].clock_sync, &sensors[idx].dev);
+                }
+            }
+
+            stream_server_flush(&server, STREAM_BATCH_AGE_NS, now);
+
+            timeout_ms = (next_service > now) ? (int)((next_service - now) / 1000000) : 0;
+
+            if (stream_server_poll(&server, timeout_ms, get_time_ns()) != 0)
+            {
+                rslt = BMI3_E_COM_FAIL;
+                break;
+            }
+        }
+
+        printf("%lu batches, %lu sendmsg calls, %llu bytes, %lu stalls, %lu clients dropped\n",
+               (unsigned long)server.seq,
+               (unsigned long)server.sends,
+               (unsigned long long)server.bytes,
+               (unsigned long)stalls,
+               (unsigned long)server.dropped);
+
+        stream_server_close(&server);
+    }
+
+    for (idx = 0; idx < n_open; idx++)
+    {
+        linux_bus_close(&sensors[idx].bus);
+    }
+
+    if (rslt != BMI323_OK)
+    {
+        printf("serve : error %d\n", rslt);
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This internal API receives batches and prints a summary of each.
+ */
+static int8_t receive(const char *host, const char *port)
+{
+    int8_t rslt = BMI323_OK;
+    int fd = -1;
+    struct addrinfo hints;
+    struct addrinfo *res = NULL;
+    struct stream_batch_hdr hdr;
+    struct stream_record rec;
+    struct bmi3_delta_codec codec;
+    uint32_t offset;
+    uint32_t samples;
+    uint32_t expected_seq = 0;
+    uint16_t idx;
+    uint16_t count;
+    uint16_t len;
+
+    memset(&hints, 0, sizeof(hints));
+    hints.ai_family = AF_UNSPEC;
+    hints.ai_socktype = SOCK_STREAM;
+
+    if (getaddrinfo(host, port, &hints, &res) == 0)
+    {
+        fd = socket(res->ai_family, res->ai_socktype, res->ai_protocol);
+
+        if ((fd >= 0) && (connect(fd, res->ai_addr, res->ai_addrlen) != 0))
+        {
+            (void)close(fd);
+            fd = -1;
+        }
+
+        freeaddrinfo(res);
+    }
+
+    if (fd < 0)
+    {
+        printf("%s:%s not reachable\n", host, port);
+
+        return BMI3_E_COM_FAIL;
+    }
+
+    while (!stop && (rslt == BMI323_OK))
+    {
+        if ((read_full(fd, rx_batch, STREAM_BATCH_HDR_LEN) != 0) ||
+            (stream_unpack_batch(rx_batch, &hdr) != 0) ||
+            (read_full(fd, &rx_batch[STREAM_BATCH_HDR_LEN], hdr.len - STREAM_BATCH_HDR_LEN) != 0))
+        {
+            rslt = BMI3_E_COM_FAIL;
+            break;
+        }
+
+        offset = STREAM_BATCH_HDR_LEN;
+        samples = 0;
+
+        for (idx = 0; (idx < hdr.n_records) && ((offset + STREAM_RECORD_HDR_LEN) <= hdr.len); idx++)
+        {
+            stream_unpack_record(&rx_batch[offset], &rec);
+            offset += STREAM_RECORD_HDR_LEN;
+
+            if ((offset + rec.len) > hdr.len)
+            {
+                break;
+            }
+
+            /* Each record is encoded from zero, so it decodes on its own */
+            count = (rec.count < STREAM_FRAMES) ? rec.count : STREAM_FRAMES;
+            len = rec.len;
+            rslt = bmi323_delta_init(rec.odr, 0, &codec);
+
+            if (rslt == BMI323_OK)
+            {
+                rslt = bmi323_delta_decode(&rx_batch[offset], &len, frames, &count, &codec);
+            }
+
+            if ((rslt == BMI323_OK) && (idx == 0) && (count != 0))
+            {
+                printf("Batch %lu : dev %u %s %u samples %llu..%llu ns, first %d %d %d\n",
+                       (unsigned long)hdr.seq,
+                       rec.dev_id,
+                       (rec.sensor == STREAM_SENSOR_ACCEL) ? "accel" : "gyro",
+                       count,
+                       (unsigned long long)rec.first_ns,
+                       (unsigned long long)rec.last_ns,
+                       frames[0].x,
+                       frames[0].y,
+                       frames[0].z);
+            }
+
+            samples += count;
+            offset += rec.len;
+        }
+
+        printf("Batch %lu : %u records, %lu samples, %lu bytes%s\n",
+               (unsigned long)hdr.seq,
+               hdr.n_records,
+               (unsigned long)samples,
+               (unsigned long)hdr.len,
+               ((expected_seq != 0) && (hdr.seq != expected_seq)) ? ", batches skipped" : "");
+
+        expected_seq = hdr.seq + 1;
+    }
+
+    (void)close(fd);
+
+    return stop ? BMI323_OK : rslt;
+}
+
+/*!
+ * @brief This internal API opens and sets up a sensor.
+ */
+static int8_t open_sensor(const char *path, struct stream_dev *sd)
+{
+    int8_t rslt;
+    char dev_path[64];
+    char *at;
+    enum bmi3_intf intf = BMI3_SPI_INTF;
+    uint16_t i2c_addr = BMI3_ADDR_I2C_PRIM;
+    uint8_t sensor;
+    int bus_open;
+
+    (void)snprintf(dev_path, sizeof(dev_path), "%s", path);
+    at = strchr(dev_path, '@');
+
+    if (at != NULL)
+    {
+        *at = '\0';
+        i2c_addr = (uint16_t)strtoul(at + 1, NULL, 0);
+    }
+
+    if (strncmp(dev_path, "/dev/i2c", 8) == 0)
+    {
+        intf = BMI3_I2C_INTF;
+    }
+
+    memset(&sd->dev, 0, sizeof(sd->dev));
+
+    rslt = linux_bus_open(&sd->bus, dev_path, intf, LINUX_BUS_SPI_HZ, i2c_addr, &sd->dev);
+    bus_open = (rslt == BMI323_OK);
+
+    if (rslt == BMI323_OK)
+    {
+        rslt = bmi323_init(&sd->dev);
+    }
+
+    if (rslt == BMI323_OK)
+    {
+        rslt = set_fifo_stream(&sd->bus, &sd->dev);
+    }
+
+    if (rslt == BMI323_OK)
+    {
+        rslt = bmi323_clock_sync_init(STREAM_SYNC_UNCERTAINTY_NS, &sd->clock_sync);
+    }
+
+    if (rslt == BMI323_OK)
+    {
+        rslt = bmi323_clock_sync_capture(host_time_ns, &sd->clock_sync, &sd->dev);
+    }
+
+    for (sensor = STREAM_SENSOR_ACCEL; (sensor <= STREAM_SENSOR_GYRO) && (rslt >= BMI323_OK); sensor++)
+    {
+        rslt = bmi323_fifo_time_init(&sd->fifo_time[sensor], STREAM_ODR, &sd->dev);
+    }
+
+    if ((rslt != BMI323_OK) && bus_open)
+    {
+        linux_bus_close(&sd->bus);
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This internal API enables accelerometer, gyro, their FIFO and the FIFO water-mark interrupt.
+ */
+static int8_t set_fifo_stream(struct linux_bus *bus, struct bmi3_dev *dev)
+{
+    int8_t rslt;
+
+    /* FIFO time is not enabled, the sample times are interpolated from the ODR */
+    const struct bmi3_reg_image image = {
+        .acc_conf = BMI3_ACC_CONF_IMAGE(STREAM_ODR,
+                                        BMI3_ACC_RANGE_8G,
+                                        BMI3_ACC_BW_ODR_QUARTER,
+                                        BMI3_ACC_AVG1,
+                                        BMI3_ACC_MODE_HIGH_PERF),
+        .gyr_conf = BMI3_GYR_CONF_IMAGE(BMI3_GYR_ODR_200HZ,
+                                        BMI3_GYR_RANGE_2000DPS,
+                                        BMI3_GYR_BW_ODR_QUARTER,
+                                        BMI3_GYR_AVG1,
+                                        BMI3_GYR_MODE_HIGH_PERF),
+        .fifo_watermark = STREAM_FIFO_WM,
+        .fifo_conf = BMI3_FIFO_CONF_IMAGE(BMI3_FIFO_ACC_EN | BMI3_FIFO_GYR_EN, BMI3_DISABLE),
+        .io_int_ctrl = BMI3_INT1_LVL_MASK | BMI3_INT1_OUTPUT_EN_MASK,
+        .int_conf = 0,
+        .int_map1 = 0,
+        .int_map2 = BMI3_INT_MAP2_IMAGE(BMI3_INT_NONE,
+                                        BMI3_INT_NONE,
+                                        BMI3_INT_NONE,
+                                        BMI3_INT_NONE,
+                                        BMI3_INT_NONE,
+                                        BMI3_INT_NONE,
+                                        BMI3_INT1,
+                                        BMI3_INT_NONE)
+    };
+
+    /* Writes go out in one SPI_IOC_MESSAGE or I2C_RDWR */
+    linux_bus_batch_begin(bus);
+
+    rslt = bmi323_set_reg_image(&image, dev);
+
+    if (linux_bus_batch_end(bus) != BMI3_OK)
+    {
+        rslt = BMI3_E_COM_FAIL;
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This internal API reads the FIFOs of the group and adds a record of each sensor to the batch.
+ */
+static void service_group(struct bmi3_dev_group *group, uint64_t now_ns)
+{
+    int8_t rslt;
+    uint8_t idx = BMI3_GROUP_DONE;
+    struct bmi3_fifo_frame *fifo;
+
+    rslt = bmi323_group_start(group);
+
+    if (rslt == BMI323_OK)
+    {
+        do
+        {
+            idx = BMI3_GROUP_DONE;
+            rslt = bmi323_group_next(group, &idx);
+
+            /* A failed read of one sensor does not stop the others */
+            if ((rslt >= BMI323_OK) && (idx != BMI3_GROUP_DONE) && (group->fifo[idx].available_fifo_len != 0))
+            {
+                fifo = &group->fifo[idx];
+
+                if ((fifo->available_fifo_sens & BMI3_FIFO_ACC_EN) &&
+                    (bmi323_extract_accel(frames, fifo, group->dev[idx]) >= BMI323_OK))
+                {
+                    (void)add_record(idx, STREAM_SENSOR_ACCEL, fifo, fifo->avail_fifo_accel_frames, now_ns);
+                }
+
+                if ((fifo->available_fifo_sens & BMI3_FIFO_GYR_EN) &&
+                    (bmi323_extract_gyro(frames, fifo, group->dev[idx]) >= BMI323_OK))
+                {
+                    (void)add_record(idx, STREAM_SENSOR_GYRO, fifo, fifo->avail_fifo_gyro_frames, now_ns);
+                }
+            }
+        } while (idx != BMI3_GROUP_DONE);
+    }
+}
+
+/*!
+ * @brief This internal API timestamps and delta encodes the frames of one sensor into a record of the batch.
+ */
+static int8_t add_record(uint8_t dev_id,
+                         uint8_t sensor,
+                         const struct bmi3_fifo_frame *fifo,
+                         uint16_t count,
+                         uint64_t now_ns)
+{
+    int8_t rslt = (count != 0) ? BMI323_OK : BMI3_W_FIFO_EMPTY;
+    struct stream_dev *sd = &sensors[dev_id];
+    struct stream_record rec;
+    struct bmi3_delta_codec codec;
+    uint64_t span[2];
+    uint8_t *buf;
+    uint16_t encoded = count;
+    uint16_t len = (uint16_t)(STREAM_RECORD_MAX_LEN - STREAM_RECORD_HDR_LEN);
+
+    if ((rslt == BMI323_OK) && (sd->fifo_time[sensor].last_valid == BMI3_DISABLE))
+    {
+        /* First read: the last frame is taken as sampled now. The read of the next
+         * sensor of the group in between is short against the sample period
+         */
+        rslt = bmi323_fifo_time_anchor(&sd->fifo_time[sensor], &sd->dev);
+    }
+
+    if (rslt == BMI323_OK)
+    {
+        rslt = bmi323_fifo_time_update(&sd->fifo_time[sensor], fifo, frames, count, ticks);
+    }
+
+    if (rslt == BMI323_OK)
+    {
+        span[0] = ticks[0];
+        span[1] = ticks[count - 1];
+        rslt = bmi323_clock_sync_to_host(span, 2, span, &sd->clock_sync);
+    }
+
+    if (rslt == BMI323_OK)
+    {
+        /* Room is checked by stream_server_ready before the group is read */
+        buf = stream_server_reserve(&server, STREAM_RECORD_MAX_LEN, now_ns);
+        rslt = (buf != NULL) ? bmi323_delta_init(STREAM_ODR, (uint16_t)ticks[0], &codec) : BMI3_E_BUSY;
+    }
+
+    if (rslt == BMI323_OK)
+    {
+        /* Encoded in place, the batch buffer is what the clients are sent */
+        rslt = bmi323_delta_encode(frames, &encoded, &buf[STREAM_RECORD_HDR_LEN], &len, &codec);
+    }
+
+    if (rslt == BMI323_OK)
+    {
+        rec.dev_id = dev_id;
+        rec.sensor = sensor;
+        rec.odr = STREAM_ODR;
+        rec.count = encoded;
+        rec.len = len;
+        rec.first_ns = span[0];
+        rec.last_ns = span[1];
+
+        stream_server_commit(&server, &rec);
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This internal API reads exactly the given number of bytes from a socket.
+ */
+static int read_full(int fd, uint8_t *buf, size_t len)
+{
+    int rslt = 0;
+    ssize_t n;
+
+    while ((len != 0) && (rslt == 0))
+    {
+        n = recv(fd, buf, len, 0);
+
+        if (n > 0)
+        {
+            buf += n;
+            len -= (size_t)n;
+        }
+        else if ((n < 0) && (errno == EINTR) && !stop)
+        {
+            continue;
+        }
+        else
+        {
+            rslt = -1;
+        }
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This internal API handles SIGINT.
+ */
+static void on_sigint(int sig)
+{
+    (void)sig;
+    stop = 1;
+}
+
+/*!
+ * @brief This internal API gets the time of CLOCK_MONOTONIC in nanoseconds.
+ */
+static uint64_t get_time_ns(void)
+{
+    struct timespec ts;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return ((uint64_t)ts.tv_sec * 1000000000ULL) + (uint64_t)ts.tv_nsec;
+}
+
+/*!
+ * @brief This internal API is the host time function of the clock synchronization.
+ */
+static uint64_t host_time_ns(void *intf_ptr)
+{
+    (void)intf_ptr;
+
+    return get_time_ns();
+}
@@ -0,0 +1,448 @@
+/**\
+ * Copyright (c) 2024 Bosch Sensortec GmbH. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ **/
+
+/******************************************************************************/
+/*!                 Header Files                                              */
+#include <string.h>
+#include "bus_trace.h"
+
+/******************************************************************************/
+/*!         Macros definition                                                */
+
+/*! Offsets of the fields of the header of a record */
+#define BUS_TRACE_OFS_SIZE               UINT8_C(0)
+#define BUS_TRACE_OFS_TYPE               UINT8_C(2)
+#define BUS_TRACE_OFS_REG                UINT8_C(3)
+#define BUS_TRACE_OFS_RSLT               UINT8_C(4)
+#define BUS_TRACE_OFS_LEN                UINT8_C(5)
+#define BUS_TRACE_OFS_TIME               UINT8_C(7)
+
+/*! Result returned by the replayed bus functions once the replay stopped following the trace */
+#define BUS_TRACE_REPLAY_FAIL            ((BMI3_INTF_RET_TYPE)-1)
+
+/******************************************************************************/
+/*!           Static Function Declaration                                     */
+
+/*!
+ * @brief This internal API encodes a record and passes it to the sink.
+ */
+static void put_record(struct bus_trace_rec *rec,
+                       uint8_t type,
+                       uint8_t reg_addr,
+                       BMI3_INTF_RET_TYPE rslt,
+                       const uint8_t *payload,
+                       uint32_t len);
+
+/*!
+ * @brief This internal API is the read function of the recorder.
+ */
+static BMI3_INTF_RET_TYPE rec_read(uint8_t reg_addr, uint8_t *reg_data, uint32_t len, void *intf_ptr);
+
+/*!
+ * @brief This internal API is the write function of the recorder.
+ */
+static BMI3_INTF_RET_TYPE rec_write(uint8_t reg_addr, const uint8_t *reg_data, uint32_t len, void *intf_ptr);
+
+/*!
+ * @brief This internal API is the delay function of the recorder.
+ */
+static void rec_delay_us(uint32_t period, void *intf_ptr);
+
+/*!
+ * @brief This internal API gets the next record of the replay, if it is of the
+ * given type, register and length.
+ */
+static const uint8_t *next_record(struct bus_trace_replay *rp, uint8_t type, uint8_t reg_addr, uint32_t len);
+
+/*!
+ * @brief This internal API is the read function of the replay.
+ */
+static BMI3_INTF_RET_TYPE replay_read(uint8_t reg_addr, uint8_t *reg_data, uint32_t len, void *intf_ptr);
+
+/*!
+ * @brief This internal API is the write function of the replay.
+ */
+static BMI3_INTF_RET_TYPE replay_write(uint8_t reg_addr, const uint8_t *reg_data, uint32_t len, void *intf_ptr);
+
+/*!
+ * @brief This internal API is the delay function of the replay.
+ */
+static void replay_delay_us(uint32_t period, void *intf_ptr);
+
+/*!
+ * @brief This internal API gets a little endian value of the given number of bytes.
+ */
+static uint32_t get_le(const uint8_t *data, uint8_t bytes);
+
+/*!
+ * @brief This internal API puts a little endian value of the given number of bytes.
+ */
+static void put_le(uint8_t *data, uint32_t value, uint8_t bytes);
+
+/******************************************************************************/
+/*!            Functions                                        */
+
+/*!
+ *  @brief This function hooks the recorder in place of the bus functions.
+ */
+void bus_trace_rec_attach(struct bus_trace_rec *rec,
+                          bus_trace_sink_fptr_t sink,
+                          void *ctx,
+                          bus_trace_time_us_fptr_t time_us,
+                          struct bmi3_dev *dev)
+{
+    uint8_t header[BUS_TRACE_MAGIC_LEN + 2];
+
+    rec->read = dev->read;
+    rec->write = dev->write;
+    rec->delay_us = dev->delay_us;
+    rec->intf_ptr = dev->intf_ptr;
+    rec->read_async = dev->read_async;
+    rec->read_hdr = dev->read_hdr;
+    rec->sink = sink;
+    rec->ctx = ctx;
+    rec->time_us = time_us;
+    rec->delay_us_total = 0;
+    rec->last_us = (time_us != NULL) ? time_us(ctx) : 0;
+    rec->records = 0;
+    rec->bytes = 0;
+
+    dev->read = rec_read;
+    dev->write = rec_write;
+    dev->delay_us = rec_delay_us;
+    dev->intf_ptr = rec;
+    dev->read_async = NULL;
+    dev->read_hdr = NULL;
+
+    memcpy(header, BUS_TRACE_MAGIC, BUS_TRACE_MAGIC_LEN);
+    header[BUS_TRACE_MAGIC_LEN] = BUS_TRACE_VERSION;
+    header[BUS_TRACE_MAGIC_LEN + 1] = (uint8_t)dev->intf;
+    put_record(rec, BUS_TRACE_HEADER, 0, 0, header, sizeof(header));
+}
+
+/*!
+ *  @brief This function restores the bus functions of the device.
+ */
+void bus_trace_rec_detach(const struct bus_trace_rec *rec, struct bmi3_dev *dev)
+{
+    dev->read = rec->read;
+    dev->write = rec->write;
+    dev->delay_us = rec->delay_us;
+    dev->intf_ptr = rec->intf_ptr;
+    dev->read_async = rec->read_async;
+    dev->read_hdr = rec->read_hdr;
+}
+
+/*!
+ *  @brief This function initializes a ring buffer sink.
+ */
+void bus_trace_ring_init(struct bus_trace_ring *ring, uint8_t *buf, uint32_t size)
+{
+    ring->buf = buf;
+    ring->size = size;
+    ring->tail = 0;
+    ring->used = 0;
+    ring->dropped = 0;
+}
+
+/*!
+ *  @brief This function is the sink of a ring buffer.
+ */
+void bus_trace_ring_sink(const uint8_t *rec, uint16_t len, void *ctx)
+{
+    struct bus_trace_ring *ring = (struct bus_trace_ring *)ctx;
+    uint32_t old_len;
+    uint32_t head;
+    uint32_t index;
+
+    if (len <= ring->size)
+    {
+        /* Make room by dropping the oldest whole records, their size is found at the tail */
+        while ((ring->size - ring->used) < len)
+        {
+            old_len = ring->buf[ring->tail] | ((uint32_t)ring->buf[(ring->tail + 1) % ring->size] << 8);
+            ring->tail = (ring->tail + old_len) % ring->size;
+            ring->used -= old_len;
+            ring->dropped++;
+        }
+
+        head = (ring->tail + ring->used) % ring->size;
+
+        for (index = 0; index < len; index++)
+        {
+            ring->buf[(head + index) % ring->size] = rec[index];
+        }
+
+        ring->used += len;
+    }
+    else
+    {
+        ring->dropped++;
+    }
+}
+
+/*!
+ *  @brief This function copies the records of the ring, oldest first.
+ */
+uint32_t bus_trace_ring_copy(const struct bus_trace_ring *ring, uint8_t *out, uint32_t size)
+{
+    uint32_t copied = 0;
+    uint32_t rec_len;
+    uint32_t index;
+    uint32_t pos = ring->tail;
+
+    while (copied < ring->used)
+    {
+        rec_len = ring->buf[pos] | ((uint32_t)ring->buf[(pos + 1) % ring->size] << 8);
+
+        if ((copied + rec_len) > size)
+        {
+            break;
+        }
+
+        for (index = 0; index < rec_len; index++)
+        {
+            out[copied + index] = ring->buf[(pos + index) % ring->size];
+        }
+
+        copied += rec_len;
+        pos = (pos + rec_len) % ring->size;
+    }
+
+    return copied;
+}
+
+/*!
+ *  @brief This function hooks the replay backend in place of the bus functions.
+ */
+void bus_trace_replay_attach(struct bus_trace_replay *rp, const uint8_t *trace, uint32_t len, struct bmi3_dev *dev)
+{
+    rp->trace = trace;
+    rp->len = len;
+    rp->pos = 0;
+    rp->records = 0;
+    rp->write_diffs = 0;
+    rp->time_us = 0;
+    rp->status = BUS_TRACE_REPLAY_OK;
+
+    /* Interface as recorded, which gives the dummy bytes of the reads */
+    if ((len >= (BUS_TRACE_REC_HDR_LEN + BUS_TRACE_MAGIC_LEN + 2)) &&
+        (trace[BUS_TRACE_OFS_TYPE] == BUS_TRACE_HEADER) &&
+        (memcmp(&trace[BUS_TRACE_REC_HDR_LEN], BUS_TRACE_MAGIC, BUS_TRACE_MAGIC_LEN) == 0))
+    {
+        dev->intf = (enum bmi3_intf)trace[BUS_TRACE_REC_HDR_LEN + BUS_TRACE_MAGIC_LEN + 1];
+        rp->pos = get_le(&trace[BUS_TRACE_OFS_SIZE], 2);
+    }
+
+    dev->read = replay_read;
+    dev->write = replay_write;
+    dev->delay_us = replay_delay_us;
+    dev->intf_ptr = rp;
+    dev->read_async = NULL;
+    dev->read_hdr = NULL;
+}
+
+/*!
+ * @brief This internal API encodes a record and passes it to the sink.
+ */
+static void put_record(struct bus_trace_rec *rec,
+                       uint8_t type,
+                       uint8_t reg_addr,
+                       BMI3_INTF_RET_TYPE rslt,
+                       const uint8_t *payload,
+                       uint32_t len)
+{
+    uint64_t now = (rec->time_us != NULL) ? rec->time_us(rec->ctx) : rec->delay_us_total;
+    uint64_t elapsed = now - rec->last_us;
+    uint32_t stored = (len > BUS_TRACE_MAX_PAYLOAD) ? BUS_TRACE_MAX_PAYLOAD : len;
+    uint16_t rec_len = (uint16_t)(BUS_TRACE_REC_HDR_LEN + stored);
+
+    rec->last_us = now;
+
+    put_le(&rec->rec[BUS_TRACE_OFS_SIZE], rec_len, 2);
+    rec->rec[BUS_TRACE_OFS_TYPE] = type;
+    rec->rec[BUS_TRACE_OFS_REG] = reg_addr;
+    rec->rec[BUS_TRACE_OFS_RSLT] = (uint8_t)rslt;
+    put_le(&rec->rec[BUS_TRACE_OFS_LEN], (len > UINT16_MAX) ? UINT16_MAX : len, 2);
+    put_le(&rec->rec[BUS_TRACE_OFS_TIME], (elapsed > UINT32_MAX) ? UINT32_MAX : (uint32_t)elapsed, 4);
+
+    if ((payload != NULL) && (stored != 0))
+    {
+        memcpy(&rec->rec[BUS_TRACE_REC_HDR_LEN], payload, stored);
+    }
+
+    rec->records++;
+    rec->bytes += rec_len;
+    rec->sink(rec->rec, rec_len, rec->ctx);
+}
+
+/*!
+ * @brief This internal API is the read function of the recorder.
+ */
+static BMI3_INTF_RET_TYPE rec_read(uint8_t reg_addr, uint8_t *reg_data, uint32_t len, void *intf_ptr)
+{
+    struct bus_trace_rec *rec = (struct bus_trace_rec *)intf_ptr;
+    BMI3_INTF_RET_TYPE rslt = rec->read(reg_addr, reg_data, len, rec->intf_ptr);
+
+    put_record(rec, BUS_TRACE_READ, reg_addr, rslt, reg_data, len);
+
+    return rslt;
+}
+
+/*!
+ * @brief This internal API is the write function of the recorder.
+ */
+static BMI3_INTF_RET_TYPE rec_write(uint8_t reg_addr, const uint8_t *reg_data, uint32_t len, void *intf_ptr)
+{
+    struct bus_trace_rec *rec = (struct bus_trace_rec *)intf_ptr;
+    BMI3_INTF_RET_TYPE rslt = rec->write(reg_addr, reg_data, len, rec->intf_ptr);
+
+    put_record(rec, BUS_TRACE_WRITE, reg_addr, rslt, reg_data, len);
+
+    return rslt;
+}
+
+/*!
+ * @brief This internal API is the delay function of the recorder.
+ */
+static void rec_delay_us(uint32_t period, void *intf_ptr)
+{
+    struct bus_trace_rec *rec = (struct bus_trace_rec *)intf_ptr;
+    uint8_t payload[4];
+
+    rec->delay_us(period, rec->intf_ptr);
+    rec->delay_us_total += period;
+
+    put_le(payload, period, 4);
+    put_record(rec, BUS_TRACE_DELAY, 0, 0, payload, sizeof(payload));
+}
+
+/*!
+ * @brief This internal API gets the next record of the replay.
+ */
+static const uint8_t *next_record(struct bus_trace_replay *rp, uint8_t type, uint8_t reg_addr, uint32_t len)
+{
+    const uint8_t *rec = NULL;
+    uint32_t rec_len;
+
+    if (rp->status == BUS_TRACE_REPLAY_OK)
+    {
+        if ((rp->pos + BUS_TRACE_REC_HDR_LEN) > rp->len)
+        {
+            rp->status = BUS_TRACE_REPLAY_END;
+        }
+        else
+        {
+            rec = &rp->trace[rp->pos];
+            rec_len = get_le(&rec[BUS_TRACE_OFS_SIZE], 2);
+
+            if ((rec_len < BUS_TRACE_REC_HDR_LEN) || ((rp->pos + rec_len) > rp->len))
+            {
+                rp->status = BUS_TRACE_REPLAY_END;
+                rec = NULL;
+            }
+            else if ((rec[BUS_TRACE_OFS_TYPE] != type) || (rec[BUS_TRACE_OFS_REG] != reg_addr) ||
+                     (get_le(&rec[BUS_TRACE_OFS_LEN], 2) != len) ||
+                     ((rec_len - BUS_TRACE_REC_HDR_LEN) < ((len > BUS_TRACE_MAX_PAYLOAD) ? BUS_TRACE_MAX_PAYLOAD : len)))
+            {
+                /* Driver left the recorded sequence of transfers */
+                rp->status = BUS_TRACE_REPLAY_MISMATCH;
+                rec = NULL;
+            }
+            else
+            {
+                rp->pos += rec_len;
+                rp->records++;
+                rp->time_us += get_le(&rec[BUS_TRACE_OFS_TIME], 4);
+            }
+        }
+    }
+
+    return rec;
+}
+
+/*!
+ * @brief This internal API is the read function of the replay.
+ */
+static BMI3_INTF_RET_TYPE replay_read(uint8_t reg_addr, uint8_t *reg_data, uint32_t len, void *intf_ptr)
+{
+    struct bus_trace_replay *rp = (struct bus_trace_replay *)intf_ptr;
+    const uint8_t *rec = next_record(rp, BUS_TRACE_READ, reg_addr, len);
+    BMI3_INTF_RET_TYPE rslt = BUS_TRACE_REPLAY_FAIL;
+
+    if (rec != NULL)
+    {
+        memcpy(reg_data, &rec[BUS_TRACE_REC_HDR_LEN], (len > BUS_TRACE_MAX_PAYLOAD) ? BUS_TRACE_MAX_PAYLOAD : len);
+        rslt = (BMI3_INTF_RET_TYPE)(int8_t)rec[BUS_TRACE_OFS_RSLT];
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This internal API is the write function of the replay.
+ */
+static BMI3_INTF_RET_TYPE replay_write(uint8_t reg_addr, const uint8_t *reg_data, uint32_t len, void *intf_ptr)
+{
+    struct bus_trace_replay *rp = (struct bus_trace_replay *)intf_ptr;
+    const uint8_t *rec = next_record(rp, BUS_TRACE_WRITE, reg_addr, len);
+    BMI3_INTF_RET_TYPE rslt = BUS_TRACE_REPLAY_FAIL;
+
+    if (rec != NULL)
+    {
+        if (memcmp(reg_data, &rec[BUS_TRACE_REC_HDR_LEN],
+                   (len > BUS_TRACE_MAX_PAYLOAD) ? BUS_TRACE_MAX_PAYLOAD : len) != 0)
+        {
+            rp->write_diffs++;
+        }
+
+        rslt = (BMI3_INTF_RET_TYPE)(int8_t)rec[BUS_TRACE_OFS_RSLT];
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This internal API is the delay function of the replay.
+ */
+static void replay_delay_us(uint32_t period, void *intf_ptr)
+{
+    struct bus_trace_replay *rp = (struct bus_trace_replay *)intf_ptr;
+
+    (void)period;
+
+    /* Replay runs at full speed, the recorded delay only advances the recorded time */
+    (void)next_record(rp, BUS_TRACE_DELAY, 0, 4);
+}
+
+/*!
+ * @brief This internal API gets a little endian value.
+ */
+static uint32_t get_le(const uint8_t *data, uint8_t bytes)
+{
+    uint32_t value = 0;
+    uint8_t index;
+
+    for (index = bytes; index > 0; index--)
+    {
+        value = (value << 8) | data[index - 1];
+    }
+
+    return value;
+}
+
+/*!
+ * @brief This internal API puts a little endian value.
+ */
+static void put_le(uint8_t *data, uint32_t value, uint8_t bytes)
+{
+    uint8_t index;
+
+    for (index = 0; index < bytes; index++)
+    {
+        data[index] = (uint8_t)(value >> (8 * index));
+    }
+}
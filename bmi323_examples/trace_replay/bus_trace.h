@@ -0,0 +1,237 @@
+/**\
+ * Copyright (c) 2024 Bosch Sensortec GmbH. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ **/
+
+#ifndef _BUS_TRACE_H
+#define _BUS_TRACE_H
+
+/*! CPP guard */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/******************************************************************************/
+/*!                 Header Files                                              */
+#include "bmi3.h"
+
+/******************************************************************************/
+/*!         Macros definition                                                */
+
+/*! Record types, the bus functions of bmi3_dev */
+#define BUS_TRACE_READ                   UINT8_C(0)
+#define BUS_TRACE_WRITE                  UINT8_C(1)
+#define BUS_TRACE_DELAY                  UINT8_C(2)
+
+/*! Record type of the header of a trace, payload is BUS_TRACE_MAGIC and the interface */
+#define BUS_TRACE_HEADER                 UINT8_C(3)
+
+/*! Identification of a trace, followed by the version of the format */
+#define BUS_TRACE_MAGIC                  "BMI3TRC"
+#define BUS_TRACE_MAGIC_LEN              UINT8_C(7)
+#define BUS_TRACE_VERSION                UINT8_C(1)
+
+/*!
+ * Length of the header of a record in bytes, little endian:
+ * size (2), type (1), register (1), result (1), length (2), time since the previous record in us (4)
+ */
+#define BUS_TRACE_REC_HDR_LEN            UINT8_C(11)
+
+/*! Largest payload of a record in bytes, longer transfers are recorded along with a truncated payload */
+#define BUS_TRACE_MAX_PAYLOAD            UINT16_C(4096)
+
+/*! Results of the replay */
+#define BUS_TRACE_REPLAY_OK              INT8_C(0)
+#define BUS_TRACE_REPLAY_END             INT8_C(-1)
+#define BUS_TRACE_REPLAY_MISMATCH        INT8_C(-2)
+
+/******************************************************************************/
+/*!         Structure definition                                              */
+
+/*!
+ * @brief Sink function pointer of the recorder, called with each encoded record
+ *
+ * @param[in] rec     : Encoded record.
+ * @param[in] len     : Length of the record in bytes.
+ * @param[in,out] ctx : Context of the sink.
+ */
+typedef void (*bus_trace_sink_fptr_t)(const uint8_t *rec, uint16_t len, void *ctx);
+
+/*!
+ * @brief Time function pointer of the recorder
+ *
+ * @param[in,out] ctx : Context of the sink.
+ *
+ * @return Time in microseconds
+ */
+typedef uint64_t (*bus_trace_time_us_fptr_t)(void *ctx);
+
+/*!
+ * @brief Structure to define a ring buffer sink, which keeps the latest whole records
+ */
+struct bus_trace_ring
+{
+    /*! Buffer of the ring */
+    uint8_t *buf;
+
+    /*! Size of the buffer in bytes */
+    uint32_t size;
+
+    /*! Position of the oldest record */
+    uint32_t tail;
+
+    /*! Number of bytes in use */
+    uint32_t used;
+
+    /*! Number of oldest records dropped to make room */
+    uint32_t dropped;
+};
+
+/*!
+ * @brief Structure to define the recorder, hooked between the driver and the bus functions
+ */
+struct bus_trace_rec
+{
+    /*! Bus functions, interface pointer and asynchronous reads of the device, restored on detach */
+    bmi3_read_fptr_t read;
+    bmi3_write_fptr_t write;
+    bmi3_delay_us_fptr_t delay_us;
+    void *intf_ptr;
+    bmi3_read_fptr_t read_async;
+    bmi3_read_fptr_t read_hdr;
+
+    /*! Sink of the records */
+    bus_trace_sink_fptr_t sink;
+
+    /*! Context of the sink and of the time function */
+    void *ctx;
+
+    /*! Time function, NULL to count the time of the delays only */
+    bus_trace_time_us_fptr_t time_us;
+
+    /*! Time of the previous record in microseconds */
+    uint64_t last_us;
+
+    /*! Time counted by the delays in microseconds */
+    uint64_t delay_us_total;
+
+    /*! Number of records */
+    uint32_t records;
+
+    /*! Number of bytes of the records */
+    uint64_t bytes;
+
+    /*! Record being encoded */
+    uint8_t rec[BUS_TRACE_REC_HDR_LEN + BUS_TRACE_MAX_PAYLOAD];
+};
+
+/*!
+ * @brief Structure to define the replay backend, which serves the bus functions from a trace
+ */
+struct bus_trace_replay
+{
+    /*! Trace */
+    const uint8_t *trace;
+
+    /*! Length of the trace in bytes */
+    uint32_t len;
+
+    /*! Position of the next record */
+    uint32_t pos;
+
+    /*! Number of records replayed */
+    uint32_t records;
+
+    /*! Number of writes differing from the trace in their payload */
+    uint32_t write_diffs;
+
+    /*! Recorded time of the replayed records in microseconds */
+    uint64_t time_us;
+
+    /*! BUS_TRACE_REPLAY_OK, or why the replay stopped following the trace */
+    int8_t status;
+};
+
+/******************************************************************************/
+/*!         Functions                                                         */
+
+/*!
+ *  @brief This function hooks the recorder in place of the bus functions of
+ *  the device and writes the header of the trace to the sink. Asynchronous
+ *  and HDR reads are disabled while recording, so that each transfer passes
+ *  the recorder.
+ *
+ *  @note Callbacks of bmi3_dev other than read, write and delay_us receive the
+ *  recorder as interface pointer; the interface pointer of the device is kept
+ *  in "intf_ptr" of the recorder.
+ *
+ *  @param[out] rec     : Structure instance of bus_trace_rec.
+ *  @param[in]  sink    : Sink of the records.
+ *  @param[in]  ctx     : Context of the sink and of the time function.
+ *  @param[in]  time_us : Time function, NULL to count the time of the delays only.
+ *  @param[in,out] dev  : Structure instance of bmi3_dev.
+ */
+void bus_trace_rec_attach(struct bus_trace_rec *rec,
+                          bus_trace_sink_fptr_t sink,
+                          void *ctx,
+                          bus_trace_time_us_fptr_t time_us,
+                          struct bmi3_dev *dev);
+
+/*!
+ *  @brief This function restores the bus functions of the device.
+ *
+ *  @param[in] rec      : Structure instance of bus_trace_rec.
+ *  @param[in,out] dev  : Structure instance of bmi3_dev.
+ */
+void bus_trace_rec_detach(const struct bus_trace_rec *rec, struct bmi3_dev *dev);
+
+/*!
+ *  @brief This function initializes a ring buffer sink.
+ *
+ *  @param[out] ring : Structure instance of bus_trace_ring.
+ *  @param[in]  buf  : Buffer of the ring.
+ *  @param[in]  size : Size of the buffer in bytes.
+ */
+void bus_trace_ring_init(struct bus_trace_ring *ring, uint8_t *buf, uint32_t size);
+
+/*!
+ *  @brief This function is the sink of a ring buffer, with the ring as context.
+ *  The oldest whole records are dropped to make room for a record.
+ *
+ *  @param[in] rec     : Encoded record.
+ *  @param[in] len     : Length of the record in bytes.
+ *  @param[in,out] ctx : Structure instance of bus_trace_ring.
+ */
+void bus_trace_ring_sink(const uint8_t *rec, uint16_t len, void *ctx);
+
+/*!
+ *  @brief This function copies the records of the ring, oldest first, into a
+ *  linear trace for a file or the replay.
+ *
+ *  @param[in]  ring : Structure instance of bus_trace_ring.
+ *  @param[out] out  : Linear trace.
+ *  @param[in]  size : Size of the linear trace in bytes.
+ *
+ *  @return Number of bytes copied, whole records only
+ */
+uint32_t bus_trace_ring_copy(const struct bus_trace_ring *ring, uint8_t *out, uint32_t size);
+
+/*!
+ *  @brief This function hooks the replay backend in place of the bus functions
+ *  of the device. Reads return the recorded data and result, writes are
+ *  compared with the recorded payload and delays return at once. The
+ *  interface of the device is taken from the header of the trace, if present.
+ *
+ *  @param[out] rp     : Structure instance of bus_trace_replay.
+ *  @param[in]  trace  : Linear trace, starting at a record.
+ *  @param[in]  len    : Length of the trace in bytes.
+ *  @param[in,out] dev : Structure instance of bmi3_dev.
+ */
+void bus_trace_replay_attach(struct bus_trace_replay *rp, const uint8_t *trace, uint32_t len, struct bmi3_dev *dev);
+
+#ifdef __cplusplus
+}
+#endif /* End of CPP guard */
+
+#endif /* _BUS_TRACE_H */
@@ -0,0 +1,443 @@
+/**\
+ * Copyright (c) 2024 Bosch Sensortec GmbH. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ **/
+
+/*
+ * Bus transaction trace and deterministic replay. A FIFO workload runs against
+ * the simulated device of bus_cost through the recorder (bus_trace.c), which
+ * logs every read, write and delay of the driver. The trace is then fed back to
+ * the same workload through the replay backend, with no device and no delays,
+ * so that a recorded production workload is profiled at full speed.
+ *
+ * Usage : trace_replay                          record into a ring buffer, replay and compare
+ *         trace_replay record <file> [<reads>]  record the workload into a file
+ *         trace_replay replay <file> [<runs>]   replay a trace file, e.g. recorded on the target
+ */
+
+/******************************************************************************/
+/*!                 Header Files                                              */
+#define _POSIX_C_SOURCE 199309L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "bmi323.h"
+#include "bus_sim.h"
+#include "bus_trace.h"
+
+/******************************************************************************/
+/*!         Macros definition                                                */
+
+/*! Default number of FIFO reads of the workload */
+#define TRACE_REPLAY_READS               UINT32_C(1000)
+
+/*! Time in microseconds the FIFO fills in between the reads */
+#define TRACE_REPLAY_FILL_US             UINT32_C(20000)
+
+/*! FIFO water-mark level in words */
+#define TRACE_REPLAY_FIFO_WM             UINT16_C(96)
+
+/*! Size of the ring buffer in bytes, holding the latest records of the workload */
+#define TRACE_REPLAY_RING_SIZE           UINT32_C(4 * 1024 * 1024)
+
+/*! Size of the FIFO buffer in bytes */
+#define TRACE_REPLAY_FIFO_BUF_LEN        ((BMI3_FIFO_SIZE_WORDS * 2) + BMI3_MAX_DUMMY_BYTE)
+
+/*! Maximum number of frames in the FIFO buffer */
+#define TRACE_REPLAY_FIFO_FRAMES         (TRACE_REPLAY_FIFO_BUF_LEN / BMI3_LENGTH_FIFO_ACC)
+
+/******************************************************************************/
+/*!         Structure definition                                              */
+
+/*!
+ * @brief Structure to define the destination of the records and the clock of the recorder
+ */
+struct trace_out
+{
+    /*! File of the trace, NULL if not used */
+    FILE *file;
+
+    /*! Ring of the trace, NULL if not used */
+    struct bus_trace_ring *ring;
+
+    /*! Simulated device, giving the time of the records */
+    struct bus_sim *sim;
+};
+
+/*!
+ * @brief Structure to define the outcome of the workload
+ */
+struct workload_result
+{
+    /*! Number of accelerometer and gyro frames extracted */
+    uint32_t frames;
+
+    /*! Checksum of the extracted samples */
+    uint32_t checksum;
+};
+
+/******************************************************************************/
+/*!         Static variable definition                                        */
+
+/*! Simulated device */
+static struct bus_sim sim;
+
+/*! Recorder */
+static struct bus_trace_rec rec;
+
+/*! Buffers of the FIFO path */
+static uint8_t fifo_buf[TRACE_REPLAY_FIFO_BUF_LEN];
+static struct bmi3_fifo_sens_axes_data fifo_accel_data[TRACE_REPLAY_FIFO_FRAMES];
+static struct bmi3_fifo_sens_axes_data fifo_gyro_data[TRACE_REPLAY_FIFO_FRAMES];
+
+/******************************************************************************/
+/*!           Static Function Declaration                                     */
+
+/*!
+ *  @brief This internal API is the sink of the recorder, writing to the file or the ring.
+ *
+ *  @param[in] data    : Encoded record.
+ *  @param[in] len     : Length of the record in bytes.
+ *  @param[in,out] ctx : Structure instance of trace_out.
+ */
+static void trace_sink(const uint8_t *data, uint16_t len, void *ctx);
+
+/*!
+ *  @brief This internal API is the clock of the recorder, the time of the simulated device.
+ *
+ *  @param[in] ctx : Structure instance of trace_out.
+ *
+ *  @return Time in microseconds
+ */
+static uint64_t trace_time_us(void *ctx);
+
+/*!
+ *  @brief This internal API runs the workload: init, FIFO setup and a number of
+ *  FIFO reads, each followed by the extraction of the frames.
+ *
+ *  @param[in] reads       : Number of FIFO reads, 0 to read until the driver reports an error.
+ *  @param[in,out] fill    : Simulated device to fill the FIFO in between the reads, NULL on replay.
+ *  @param[out] result     : Outcome of the workload.
+ *  @param[in,out] dev     : Structure instance of bmi3_dev.
+ *
+ *  @return Status of execution
+ */
+static int8_t run_workload(uint32_t reads, struct bus_sim *fill, struct workload_result *result, struct bmi3_dev *dev);
+
+/*!
+ *  @brief This internal API replays a trace and prints the outcome and the speed.
+ *
+ *  @param[in] trace  : Linear trace.
+ *  @param[in] len    : Length of the trace in bytes.
+ *  @param[in] runs   : Number of replays.
+ *  @param[out] result : Outcome of the workload of the last replay.
+ *
+ *  @return Status of execution
+ */
+static int8_t replay(const uint8_t *trace, uint32_t len, uint32_t runs, struct workload_result *result);
+
+/*!
+ *  @brief This internal API returns a monotonic time stamp in nanoseconds.
+ *
+ *  @return Time stamp in nanoseconds
+ */
+static uint64_t get_time_ns(void);
+
+/******************************************************************************/
+/*!            Functions                                        */
+
+/* This function starts the execution of program. */
+int main(int argc, char *argv[])
+{
+    int8_t rslt = BMI323_OK;
+    struct bmi3_dev dev = { 0 };
+    struct trace_out out = { NULL, NULL, &sim };
+    struct bus_trace_ring ring;
+    struct workload_result recorded = { 0 };
+    struct workload_result replayed = { 0 };
+    uint8_t *buf = NULL;
+    uint8_t *trace = NULL;
+    uint32_t len = 0;
+    uint32_t count = 0;
+    long file_len;
+
+    if ((argc > 2) && (strcmp(argv[1], "record") == 0))
+    {
+        count = (argc > 3) ? (uint32_t)strtoul(argv[3], NULL, 0) : TRACE_REPLAY_READS;
+        out.file = fopen(argv[2], "wb");
+
+        if (out.file != NULL)
+        {
+            bus_sim_attach(&sim, BMI3_SPI_INTF, UINT32_C(10000000), &dev);
+            bus_trace_rec_attach(&rec, trace_sink, &out, trace_time_us, &dev);
+            rslt = run_workload(count, &sim, &recorded, &dev);
+            bus_trace_rec_detach(&rec, &dev);
+            (void)fclose(out.file);
+
+            printf("Recorded %lu records, %lu bytes, %lu frames into %s, rslt %d\n",
+                   (unsigned long)rec.records,
+                   (unsigned long)rec.bytes,
+                   (unsigned long)recorded.frames,
+                   argv[2],
+                   rslt);
+        }
+        else
+        {
+            printf("Cannot open %s\n", argv[2]);
+            rslt = BMI3_E_INVALID_INPUT;
+        }
+    }
+    else if ((argc > 2) && (strcmp(argv[1], "replay") == 0))
+    {
+        count = (argc > 3) ? (uint32_t)strtoul(argv[3], NULL, 0) : 1;
+        out.file = fopen(argv[2], "rb");
+        rslt = BMI3_E_INVALID_INPUT;
+
+        if (out.file != NULL)
+        {
+            if ((fseek(out.file, 0, SEEK_END) == 0) && ((file_len = ftell(out.file)) > 0) &&
+                (fseek(out.file, 0, SEEK_SET) == 0))
+            {
+                trace = (uint8_t *)malloc((size_t)file_len);
+
+                if ((trace != NULL) && (fread(trace, 1, (size_t)file_len, out.file) == (size_t)file_len))
+                {
+                    rslt = replay(trace, (uint32_t)file_len, count, &replayed);
+                }
+            }
+
+            (void)fclose(out.file);
+        }
+
+        if (rslt == BMI3_E_INVALID_INPUT)
+        {
+            printf("Cannot read %s\n", argv[2]);
+        }
+    }
+    else
+    {
+        buf = (uint8_t *)malloc(TRACE_REPLAY_RING_SIZE);
+        trace = (uint8_t *)malloc(TRACE_REPLAY_RING_SIZE);
+
+        if ((buf != NULL) && (trace != NULL))
+        {
+            bus_trace_ring_init(&ring, buf, TRACE_REPLAY_RING_SIZE);
+            out.ring = &ring;
+
+            bus_sim_attach(&sim, BMI3_SPI_INTF, UINT32_C(10000000), &dev);
+            bus_trace_rec_attach(&rec, trace_sink, &out, trace_time_us, &dev);
+            rslt = run_workload(TRACE_REPLAY_READS, &sim, &recorded, &dev);
+            bus_trace_rec_detach(&rec, &dev);
+
+            printf("Recorded %lu records, %lu bytes, %lu dropped by the ring, rslt %d\n",
+                   (unsigned long)rec.records,
+                   (unsigned long)rec.bytes,
+                   (unsigned long)ring.dropped,
+                   rslt);
+
+            if ((rslt == BMI323_OK) && (ring.dropped == 0))
+            {
+                len = bus_trace_ring_copy(&ring, trace, TRACE_REPLAY_RING_SIZE);
+                rslt = replay(trace, len, 10, &replayed);
+
+                printf("Recorded %lu frames, checksum 0x%08lx; replayed %lu frames, checksum 0x%08lx: %s\n",
+                       (unsigned long)recorded.frames,
+                       (unsigned long)recorded.checksum,
+                       (unsigned long)replayed.frames,
+                       (unsigned long)replayed.checksum,
+                       ((recorded.frames == replayed.frames) &&
+                        (recorded.checksum == replayed.checksum)) ? "identical" : "DIFFERENT");
+
+                if ((recorded.frames != replayed.frames) || (recorded.checksum != replayed.checksum))
+                {
+                    rslt = BMI3_E_INVALID_STATUS;
+                }
+            }
+        }
+    }
+
+    free(buf);
+    free(trace);
+
+    return rslt;
+}
+
+/*!
+ * @brief This internal API is the sink of the recorder.
+ */
+static void trace_sink(const uint8_t *data, uint16_t len, void *ctx)
+{
+    struct trace_out *out = (struct trace_out *)ctx;
+
+    if (out->file != NULL)
+    {
+        (void)fwrite(data, 1, len, out->file);
+    }
+
+    if (out->ring != NULL)
+    {
+        bus_trace_ring_sink(data, len, out->ring);
+    }
+}
+
+/*!
+ * @brief This internal API is the clock of the recorder.
+ */
+static uint64_t trace_time_us(void *ctx)
+{
+    const struct trace_out *out = (const struct trace_out *)ctx;
+
+    return out->sim->time_ns / 1000;
+}
+
+/*!
+ * @brief This internal API runs the workload.
+ */
+static int8_t run_workload(uint32_t reads, struct bus_sim *fill, struct workload_result *result, struct bmi3_dev *dev)
+{
+    int8_t rslt;
+    struct bmi3_sens_config config[2] = { { 0 } };
+    struct bmi3_fifo_frame fifoframe = { 0 };
+    uint32_t index;
+    uint16_t frame;
+
+    result->frames = 0;
+    result->checksum = 0;
+
+    rslt = bmi323_init(dev);
+
+    if (rslt == BMI323_OK)
+    {
+        config[0].type = BMI323_ACCEL;
+        config[1].type = BMI323_GYRO;
+
+        rslt = bmi323_get_sensor_config(config, 2, dev);
+    }
+
+    if (rslt == BMI323_OK)
+    {
+        config[0].cfg.acc.odr = BMI3_ACC_ODR_800HZ;
+        config[0].cfg.acc.range = BMI3_ACC_RANGE_8G;
+        config[0].cfg.acc.bwp = BMI3_ACC_BW_ODR_QUARTER;
+        config[0].cfg.acc.avg_num = BMI3_ACC_AVG1;
+        config[0].cfg.acc.acc_mode = BMI3_ACC_MODE_HIGH_PERF;
+
+        config[1].cfg.gyr.odr = BMI3_GYR_ODR_800HZ;
+        config[1].cfg.gyr.range = BMI3_GYR_RANGE_2000DPS;
+        config[1].cfg.gyr.bwp = BMI3_GYR_BW_ODR_QUARTER;
+        config[1].cfg.gyr.avg_num = BMI3_GYR_AVG1;
+        config[1].cfg.gyr.gyr_mode = BMI3_GYR_MODE_HIGH_PERF;
+
+        rslt = bmi323_set_sensor_config(config, 2, dev);
+    }
+
+    if (rslt == BMI323_OK)
+    {
+        rslt = bmi323_set_fifo_wm(TRACE_REPLAY_FIFO_WM, dev);
+    }
+
+    if (rslt == BMI323_OK)
+    {
+        rslt = bmi323_set_fifo_config(BMI3_FIFO_ACC_EN | BMI3_FIFO_GYR_EN, BMI323_ENABLE, dev);
+    }
+
+    fifoframe.data = fifo_buf;
+
+    for (index = 0; (rslt == BMI323_OK) && ((reads == 0) || (index < reads)); index++)
+    {
+        if (fill != NULL)
+        {
+            bus_sim_advance(fill, TRACE_REPLAY_FILL_US);
+        }
+
+        rslt = bmi323_get_fifo_length(&fifoframe.available_fifo_len, dev);
+
+        if (rslt == BMI323_OK)
+        {
+            fifoframe.length = (uint16_t)((fifoframe.available_fifo_len * 2) + dev->dummy_byte);
+            rslt = bmi323_read_fifo_data(&fifoframe, dev);
+        }
+
+        if (rslt == BMI323_OK)
+        {
+            rslt = bmi323_extract_all(fifo_accel_data, fifo_gyro_data, NULL, &fifoframe, dev);
+        }
+
+        if (rslt == BMI323_OK)
+        {
+            for (frame = 0; frame < fifoframe.avail_fifo_accel_frames; frame++)
+            {
+                result->checksum = (result->checksum * 31u) + (uint16_t)fifo_accel_data[frame].x +
+                                   (uint16_t)fifo_accel_data[frame].y + (uint16_t)fifo_accel_data[frame].z;
+            }
+
+            for (frame = 0; frame < fifoframe.avail_fifo_gyro_frames; frame++)
+            {
+                result->checksum = (result->checksum * 31u) + (uint16_t)fifo_gyro_data[frame].x +
+                                   (uint16_t)fifo_gyro_data[frame].y + (uint16_t)fifo_gyro_data[frame].z;
+            }
+
+            result->frames += fifoframe.avail_fifo_accel_frames + fifoframe.avail_fifo_gyro_frames;
+        }
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This internal API replays a trace and prints the outcome and the speed.
+ */
+static int8_t replay(const uint8_t *trace, uint32_t len, uint32_t runs, struct workload_result *result)
+{
+    int8_t rslt = BMI323_OK;
+    struct bmi3_dev dev = { 0 };
+    struct bus_trace_replay rp;
+    uint64_t start;
+    uint64_t elapsed;
+    uint32_t run;
+
+    start = get_time_ns();
+
+    for (run = 0; run < runs; run++)
+    {
+        memset(&dev, 0, sizeof(dev));
+        dev.read_write_len = 32;
+
+        bus_trace_replay_attach(&rp, trace, len, &dev);
+
+        /* Trace of a workload with unknown length is replayed to its end */
+        (void)run_workload(0, NULL, result, &dev);
+    }
+
+    elapsed = get_time_ns() - start;
+
+    if (rp.status == BUS_TRACE_REPLAY_MISMATCH)
+    {
+        rslt = BMI3_E_INVALID_STATUS;
+    }
+
+    printf("Replayed %lu records of %lu recorded ms in %.3f ms per run (%.0fx), %lu write diffs, %s\n",
+           (unsigned long)rp.records,
+           (unsigned long)(rp.time_us / 1000),
+           (double)elapsed / 1000000.0 / (double)((runs != 0) ? runs : 1),
+           (elapsed != 0) ? ((double)rp.time_us * 1000.0 * (double)runs / (double)elapsed) : 0.0,
+           (unsigned long)rp.write_diffs,
+           (rp.status == BUS_TRACE_REPLAY_END) ? "end of trace" : "driver left the trace");
+
+    return rslt;
+}
+
+/*!
+ * @brief This internal API returns a monotonic time stamp in nanoseconds.
+ */
+static uint64_t get_time_ns(void)
+{
+    struct timespec now;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return ((uint64_t)now.tv_sec * 1000000000u) + (uint64_t)now.tv_nsec;
+}
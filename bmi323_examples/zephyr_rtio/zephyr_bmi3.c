@@ -0,0 +1,1026 @@
+/**\
+ * Copyright (c) 2024 Bosch Sensortec GmbH. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ **/
+
+/******************************************************************************/
+/*!                 Header Files                                              */
+#include <errno.h>
+#include <zephyr/drivers/sensor_data_types.h>
+#include "zephyr_bmi3.h"
+
+/******************************************************************************/
+/*!         Macros definition                                                */
+
+/*! Temperature offset of 23 degree Celsius in q31 of the given shift */
+#define ZEPHYR_BMI3_TEMP_OFFSET_Q31(shift) ((q31_t)(INT64_C(23) << (31 - (shift))))
+
+/******************************************************************************/
+/*!           Static Function Declaration                                     */
+
+/*!
+ * @brief This internal API is the blocking read of the driver, a register address
+ * write and a read in one RTIO transaction.
+ */
+static BMI3_INTF_RET_TYPE zephyr_bmi3_read(uint8_t reg_addr, uint8_t *reg_data, uint32_t len, void *intf_ptr);
+
+/*!
+ * @brief This internal API is the blocking write of the driver.
+ */
+static BMI3_INTF_RET_TYPE zephyr_bmi3_write(uint8_t reg_addr, const uint8_t *reg_data, uint32_t len, void *intf_ptr);
+
+/*!
+ * @brief This internal API is the delay of the driver.
+ */
+static void zephyr_bmi3_delay_us(uint32_t period, void *intf_ptr);
+
+/*!
+ * @brief This internal API submits the blocking transaction queued in the
+ * synchronous context and consumes its completions.
+ *
+ * @param[in] zb    : Structure instance of zephyr_bmi3.
+ * @param[in] count : Number of submissions queued.
+ *
+ * @return 0 on success, negative error of the first failed submission otherwise
+ */
+static int sync_submit(struct zephyr_bmi3 *zb, uint8_t count);
+
+/*!
+ * @brief This internal API queues a register read, chained to a callback, in the
+ * asynchronous context and submits it without waiting.
+ *
+ * @param[in] zb       : Structure instance of zephyr_bmi3.
+ * @param[in] reg_addr : Register address.
+ * @param[in] buf      : Buffer of the data, along with the dummy bytes.
+ * @param[in] len      : Number of bytes to read, along with the dummy bytes.
+ * @param[in] done     : Callback run once the read is done.
+ *
+ * @return 0 on success, -ENOMEM if the context is full
+ */
+static int async_read(struct zephyr_bmi3 *zb, uint8_t reg_addr, uint8_t *buf, uint32_t len, rtio_callback_t done);
+
+/*!
+ * @brief This internal API consumes the completions of the asynchronous context.
+ *
+ * @param[in] zb : Structure instance of zephyr_bmi3.
+ *
+ * @return 0 if no read failed, negative error of the first failed read otherwise
+ */
+static int drain(struct zephyr_bmi3 *zb);
+
+/*!
+ * @brief This internal API ends the submission in flight.
+ *
+ * @param[in] zb  : Structure instance of zephyr_bmi3.
+ * @param[in] err : 0 on success, negative error otherwise.
+ */
+static void finish(struct zephyr_bmi3 *zb, int err);
+
+/*!
+ * @brief This internal API starts the FIFO read of a pending interrupt if a
+ * multishot submission is pending and no read is in flight.
+ *
+ * @param[in] zb : Structure instance of zephyr_bmi3.
+ */
+static void start_fifo_read(struct zephyr_bmi3 *zb);
+
+/*!
+ * @brief This internal API is the callback of the fill level read, which
+ * chains the FIFO data read straight into the buffer of the submission.
+ */
+static void fill_done(struct rtio *r, const struct rtio_sqe *sqe, void *arg0);
+
+/*!
+ * @brief This internal API is the callback of the FIFO data and data register
+ * reads, which completes the submission.
+ */
+static void read_done(struct rtio *r, const struct rtio_sqe *sqe, void *arg0);
+
+/*!
+ * @brief This internal API is the submit function of the iodev of the sensor.
+ * Multishot submissions are completed on each FIFO water-mark interrupt, other
+ * submissions by a data register read.
+ */
+static void zephyr_bmi3_submit(struct rtio_iodev_sqe *iodev_sqe);
+
+/*!
+ * @brief This internal API fills the FIFO frame and device structure of the
+ * decoder from a buffer.
+ *
+ * @param[out] fifo   : Structure instance of bmi3_fifo_frame.
+ * @param[out] dev    : Structure instance of bmi3_dev.
+ * @param[in]  buffer : Buffer completed by the iodev of the sensor.
+ */
+static void decoder_frame(struct bmi3_fifo_frame *fifo, struct bmi3_dev *dev, const uint8_t *buffer);
+
+/*!
+ * @brief This internal API gets the number of frames of a channel in a buffer.
+ */
+static int decoder_get_frame_count(const uint8_t *buffer, struct sensor_chan_spec chan_spec, uint16_t *frame_count);
+
+/*!
+ * @brief This internal API gets the size of the decoded data of a channel.
+ */
+static int decoder_get_size_info(struct sensor_chan_spec chan_spec, size_t *base_size, size_t *frame_size);
+
+/*!
+ * @brief This internal API decodes the frames of a channel from a buffer, from
+ * the frame iterator on.
+ */
+static int decoder_decode(const uint8_t *buffer,
+                          struct sensor_chan_spec chan_spec,
+                          uint32_t *fit,
+                          uint16_t max_count,
+                          void *data_out);
+
+/*!
+ * @brief This internal API tells if a buffer was read on a trigger.
+ */
+static bool decoder_has_trigger(const uint8_t *buffer, enum sensor_trigger_type trigger);
+
+/*!
+ * @brief This internal API gets the q31 scale of a channel: the shift of the
+ * full scale range and the factor of the raw data in SI units with
+ * BMI3_UNIT_Q_FRAC_BITS fraction bits.
+ *
+ * @param[in]  chan  : Channel, SENSOR_CHAN_ACCEL_XYZ, SENSOR_CHAN_GYRO_XYZ or SENSOR_CHAN_DIE_TEMP.
+ * @param[in]  hdr   : Header of the buffer.
+ * @param[out] shift : Shift of the q31 data.
+ * @param[out] num   : Numerator of the factor.
+ * @param[out] den   : Denominator of the factor.
+ *
+ * @return 0 on success, -ENODATA if the range is not known
+ */
+static int decoder_scale(enum sensor_channel chan,
+                         const struct zephyr_bmi3_hdr *hdr,
+                         int8_t *shift,
+                         int64_t *num,
+                         int64_t *den);
+
+/*!
+ * @brief This internal API converts raw data to q31.
+ */
+static q31_t to_q31(int16_t raw, int8_t shift, int64_t num, int64_t den);
+
+/*!
+ * @brief This internal API is the bus stub of the device structure of the decoder.
+ */
+static BMI3_INTF_RET_TYPE no_bus_read(uint8_t reg_addr, uint8_t *reg_data, uint32_t len, void *intf_ptr);
+
+/*!
+ * @brief This internal API is the bus stub of the device structure of the decoder.
+ */
+static BMI3_INTF_RET_TYPE no_bus_write(uint8_t reg_addr, const uint8_t *reg_data, uint32_t len, void *intf_ptr);
+
+/*!
+ * @brief This internal API is the delay stub of the device structure of the decoder.
+ */
+static void no_bus_delay_us(uint32_t period, void *intf_ptr);
+
+/******************************************************************************/
+/*!         Global variables                                                  */
+
+/*! RTIO iodev API of the sensor */
+const struct rtio_iodev_api zephyr_bmi3_iodev_api = {
+    .submit = zephyr_bmi3_submit,
+};
+
+/*! Sensor decoder of the buffers completed by the iodev of the sensor */
+const struct sensor_decoder_api zephyr_bmi3_decoder = {
+    .get_frame_count = decoder_get_frame_count,
+    .get_size_info = decoder_get_size_info,
+    .decode = decoder_decode,
+    .has_trigger = decoder_has_trigger,
+};
+
+/******************************************************************************/
+/*!               User interface functions                                    */
+
+/*!
+ * @brief This function hooks the RTIO contexts of the bus into the device structure.
+ */
+int8_t zephyr_bmi3_init(struct zephyr_bmi3 *zb,
+                        const struct rtio_iodev *bus,
+                        enum bmi3_intf intf,
+                        struct rtio *sync_ctx,
+                        struct rtio *ctx)
+{
+    int8_t rslt = BMI3_E_NULL_PTR;
+
+    if ((zb != NULL) && (bus != NULL) && (sync_ctx != NULL) && (ctx != NULL))
+    {
+        *zb = (struct zephyr_bmi3) { 0 };
+        zb->bus = bus;
+        zb->sync_ctx = sync_ctx;
+        zb->ctx = ctx;
+
+        zb->dev.intf = intf;
+        zb->dev.intf_ptr = zb;
+        zb->dev.read = zephyr_bmi3_read;
+        zb->dev.write = zephyr_bmi3_write;
+        zb->dev.delay_us = zephyr_bmi3_delay_us;
+        zb->dev.read_write_len = (BMI3_FIFO_SIZE_WORDS * 2) + BMI3_MAX_DUMMY_BYTE;
+
+        rslt = ((intf == BMI3_SPI_INTF) || (intf == BMI3_I2C_INTF)) ? BMI3_OK : BMI3_E_INVALID_INPUT;
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This function reads the FIFO and sensor configuration.
+ */
+int8_t zephyr_bmi3_update_stream_config(struct zephyr_bmi3 *zb)
+{
+    int8_t rslt;
+    uint8_t fifo_conf[2];
+    uint8_t sens_conf[4];
+    uint8_t odr = 0;
+    uint16_t acc_conf;
+    uint16_t gyr_conf;
+
+    rslt = bmi3_get_regs(BMI3_REG_FIFO_CONF, fifo_conf, 2, &zb->dev);
+
+    if (rslt == BMI3_OK)
+    {
+        rslt = bmi3_get_regs(BMI3_REG_ACC_CONF, sens_conf, 4, &zb->dev);
+    }
+
+    if (rslt == BMI3_OK)
+    {
+        acc_conf = (uint16_t)(sens_conf[0] | ((uint16_t)sens_conf[1] << 8));
+        gyr_conf = (uint16_t)(sens_conf[2] | ((uint16_t)sens_conf[3] << 8));
+
+        /* The frames follow the faster of the sensors in the FIFO */
+        zb->fifo_sens = (uint16_t)(((uint16_t)fifo_conf[1] << 8) & BMI3_FIFO_ALL_EN);
+
+        if ((zb->fifo_sens & BMI3_FIFO_ACC_EN) && (acc_conf & BMI3_ACC_MODE_MASK))
+        {
+            odr = (uint8_t)(acc_conf & BMI3_ACC_ODR_MASK);
+        }
+
+        if ((zb->fifo_sens & BMI3_FIFO_GYR_EN) && (gyr_conf & BMI3_GYR_MODE_MASK) &&
+            ((gyr_conf & BMI3_GYR_ODR_MASK) > odr))
+        {
+            odr = (uint8_t)(gyr_conf & BMI3_GYR_ODR_MASK);
+        }
+
+        /* ODR code 1 is 0.78125 Hz, each code doubles the rate */
+        zb->period_ns = (odr != 0) ? (UINT32_C(1280000000) >> (odr - 1)) : 0;
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This function serves the FIFO water-mark interrupt.
+ */
+void zephyr_bmi3_int_handler(struct zephyr_bmi3 *zb)
+{
+    k_spinlock_key_t key = k_spin_lock(&zb->lock);
+
+    zb->timestamp_ns = k_ticks_to_ns_floor64(k_uptime_ticks());
+    zb->pending = 1;
+    k_spin_unlock(&zb->lock, key);
+
+    start_fifo_read(zb);
+}
+
+/******************************************************************************/
+/*!               Static functions                                            */
+
+/*!
+ * @brief This internal API is the blocking read of the driver.
+ */
+static BMI3_INTF_RET_TYPE zephyr_bmi3_read(uint8_t reg_addr, uint8_t *reg_data, uint32_t len, void *intf_ptr)
+{
+    struct zephyr_bmi3 *zb = intf_ptr;
+    struct rtio_sqe *wr = rtio_sqe_acquire(zb->sync_ctx);
+    struct rtio_sqe *rd = rtio_sqe_acquire(zb->sync_ctx);
+    BMI3_INTF_RET_TYPE rslt = -ENOMEM;
+
+    if ((wr != NULL) && (rd != NULL))
+    {
+        rtio_sqe_prep_tiny_write(wr, zb->bus, RTIO_PRIO_NORM, &reg_addr, 1, NULL);
+        wr->flags |= RTIO_SQE_TRANSACTION;
+        rtio_sqe_prep_read(rd, zb->bus, RTIO_PRIO_NORM, reg_data, len, NULL);
+
+        if (zb->dev.intf == BMI3_I2C_INTF)
+        {
+            rd->iodev_flags |= RTIO_IODEV_I2C_STOP | RTIO_IODEV_I2C_RESTART;
+        }
+
+        rslt = sync_submit(zb, 2);
+    }
+    else
+    {
+        rtio_sqe_drop_all(zb->sync_ctx);
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This internal API is the blocking write of the driver.
+ */
+static BMI3_INTF_RET_TYPE zephyr_bmi3_write(uint8_t reg_addr, const uint8_t *reg_data, uint32_t len, void *intf_ptr)
+{
+    struct zephyr_bmi3 *zb = intf_ptr;
+    struct rtio_sqe *wr = rtio_sqe_acquire(zb->sync_ctx);
+    struct rtio_sqe *data = rtio_sqe_acquire(zb->sync_ctx);
+    BMI3_INTF_RET_TYPE rslt = -ENOMEM;
+
+    if ((wr != NULL) && (data != NULL))
+    {
+        rtio_sqe_prep_tiny_write(wr, zb->bus, RTIO_PRIO_NORM, &reg_addr, 1, NULL);
+        wr->flags |= RTIO_SQE_TRANSACTION;
+        rtio_sqe_prep_write(data, zb->bus, RTIO_PRIO_NORM, reg_data, len, NULL);
+
+        if (zb->dev.intf == BMI3_I2C_INTF)
+        {
+            data->iodev_flags |= RTIO_IODEV_I2C_STOP;
+        }
+
+        rslt = sync_submit(zb, 2);
+    }
+    else
+    {
+        rtio_sqe_drop_all(zb->sync_ctx);
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This internal API is the delay of the driver.
+ */
+static void zephyr_bmi3_delay_us(uint32_t period, void *intf_ptr)
+{
+    (void)intf_ptr;
+
+    /* Long delays, e.g. of the soft-reset, let other threads run */
+    if (period >= 1000)
+    {
+        k_usleep((int32_t)period);
+    }
+    else
+    {
+        k_busy_wait(period);
+    }
+}
+
+/*!
+ * @brief This internal API submits the blocking transaction of the synchronous context.
+ */
+static int sync_submit(struct zephyr_bmi3 *zb, uint8_t count)
+{
+    struct rtio_cqe *cqe;
+    int submitted = rtio_submit(zb->sync_ctx, count);
+    int rslt = submitted;
+
+    /* Each submission gives a completion, also when cancelled by an error of the transaction */
+    while ((submitted == 0) && (count > 0))
+    {
+        cqe = rtio_cqe_consume_block(zb->sync_ctx);
+
+        if ((cqe->result < 0) && (rslt == 0))
+        {
+            rslt = cqe->result;
+        }
+
+        rtio_cqe_release(zb->sync_ctx, cqe);
+        count--;
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This internal API queues a register read chained to a callback.
+ */
+static int async_read(struct zephyr_bmi3 *zb, uint8_t reg_addr, uint8_t *buf, uint32_t len, rtio_callback_t done)
+{
+    struct rtio_sqe *wr = rtio_sqe_acquire(zb->ctx);
+    struct rtio_sqe *rd = rtio_sqe_acquire(zb->ctx);
+    struct rtio_sqe *cb = rtio_sqe_acquire(zb->ctx);
+    int rslt = -ENOMEM;
+
+    if ((wr != NULL) && (rd != NULL) && (cb != NULL))
+    {
+        if (zb->dev.intf == BMI3_SPI_INTF)
+        {
+            reg_addr |= BMI3_SPI_RD_MASK;
+        }
+
+        rtio_sqe_prep_tiny_write(wr, zb->bus, RTIO_PRIO_HIGH, &reg_addr, 1, NULL);
+        wr->flags |= RTIO_SQE_TRANSACTION;
+        rtio_sqe_prep_read(rd, zb->bus, RTIO_PRIO_HIGH, buf, len, NULL);
+        rd->flags |= RTIO_SQE_CHAINED;
+
+        if (zb->dev.intf == BMI3_I2C_INTF)
+        {
+            rd->iodev_flags |= RTIO_IODEV_I2C_STOP | RTIO_IODEV_I2C_RESTART;
+        }
+
+        /* A failed read cancels the callback, the error is seen by drain */
+        rtio_sqe_prep_callback(cb, done, zb, NULL);
+        rslt = rtio_submit(zb->ctx, 0);
+    }
+    else
+    {
+        rtio_sqe_drop_all(zb->ctx);
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This internal API consumes the completions of the asynchronous context.
+ */
+static int drain(struct zephyr_bmi3 *zb)
+{
+    struct rtio_cqe *cqe;
+    int rslt = 0;
+
+    cqe = rtio_cqe_consume(zb->ctx);
+
+    while (cqe != NULL)
+    {
+        if ((cqe->result < 0) && (rslt == 0))
+        {
+            rslt = cqe->result;
+        }
+
+        rtio_cqe_release(zb->ctx, cqe);
+        cqe = rtio_cqe_consume(zb->ctx);
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This internal API ends the submission in flight.
+ */
+static void finish(struct zephyr_bmi3 *zb, int err)
+{
+    struct rtio_iodev_sqe *iodev_sqe;
+    k_spinlock_key_t key = k_spin_lock(&zb->lock);
+
+    iodev_sqe = zb->busy_sqe;
+    zb->busy_sqe = NULL;
+    k_spin_unlock(&zb->lock, key);
+
+    if (iodev_sqe != NULL)
+    {
+        /* A multishot submission comes back through zephyr_bmi3_submit on success */
+        if (err == 0)
+        {
+            rtio_iodev_sqe_ok(iodev_sqe, 0);
+        }
+        else
+        {
+            rtio_iodev_sqe_err(iodev_sqe, err);
+        }
+    }
+}
+
+/*!
+ * @brief This internal API starts the FIFO read of a pending interrupt.
+ */
+static void start_fifo_read(struct zephyr_bmi3 *zb)
+{
+    int err = drain(zb);
+    uint8_t start = 0;
+    k_spinlock_key_t key;
+
+    /* A read which failed before its callback is ended here */
+    if (err != 0)
+    {
+        finish(zb, err);
+    }
+
+    key = k_spin_lock(&zb->lock);
+
+    if (zb->pending && (zb->stream_sqe != NULL) && (zb->busy_sqe == NULL))
+    {
+        zb->busy_sqe = zb->stream_sqe;
+        zb->stream_sqe = NULL;
+        zb->pending = 0;
+        start = 1;
+    }
+
+    k_spin_unlock(&zb->lock, key);
+
+    if (start)
+    {
+        err = async_read(zb, BMI3_REG_FIFO_FILL_LEVEL, zb->fill, 2 + zb->dev.dummy_byte, fill_done);
+
+        if (err != 0)
+        {
+            finish(zb, err);
+        }
+    }
+}
+
+/*!
+ * @brief This internal API is the callback of the fill level read.
+ */
+static void fill_done(struct rtio *r, const struct rtio_sqe *sqe, void *arg0)
+{
+    struct zephyr_bmi3 *zb = arg0;
+    struct zephyr_bmi3_hdr *hdr;
+    uint8_t *buf;
+    uint32_t buf_len;
+    uint32_t min_len = sizeof(struct zephyr_bmi3_hdr) + zb->dev.dummy_byte;
+    uint16_t words = (uint16_t)(zb->fill[zb->dev.dummy_byte] | ((uint16_t)zb->fill[zb->dev.dummy_byte + 1] << 8));
+    int err;
+
+    (void)r;
+    (void)sqe;
+
+    words &= BMI3_FIFO_FILL_LEVEL_MASK;
+    err = drain(zb);
+
+    if (err == 0)
+    {
+        /* The FIFO is read straight into the buffer of the consumer, a smaller buffer gets the oldest data */
+        err = rtio_sqe_rx_buf(zb->busy_sqe, min_len, min_len + ((uint32_t)words * 2), &buf, &buf_len);
+    }
+
+    if (err == 0)
+    {
+        hdr = (struct zephyr_bmi3_hdr *)(void *)buf;
+        hdr->timestamp_ns = zb->timestamp_ns;
+        hdr->period_ns = zb->period_ns;
+        hdr->acc_q = zb->dev.unit_scale.acc_q;
+        hdr->gyr_q = zb->dev.unit_scale.gyr_q;
+        hdr->data_len = (uint16_t)(MIN(buf_len, min_len + ((uint32_t)words * 2)) - sizeof(struct zephyr_bmi3_hdr));
+        hdr->available_fifo_len = words;
+        hdr->fifo_sens = zb->fifo_sens;
+        hdr->dummy_byte = zb->dev.dummy_byte;
+        hdr->kind = ZEPHYR_BMI3_KIND_FIFO;
+
+        if (hdr->data_len > zb->dev.dummy_byte)
+        {
+            err = async_read(zb, BMI3_REG_FIFO_DATA, buf + sizeof(struct zephyr_bmi3_hdr), hdr->data_len, read_done);
+        }
+        else
+        {
+            finish(zb, 0);
+        }
+    }
+
+    if (err != 0)
+    {
+        finish(zb, err);
+    }
+}
+
+/*!
+ * @brief This internal API is the callback of the FIFO data and data register reads.
+ */
+static void read_done(struct rtio *r, const struct rtio_sqe *sqe, void *arg0)
+{
+    struct zephyr_bmi3 *zb = arg0;
+
+    (void)r;
+    (void)sqe;
+
+    finish(zb, drain(zb));
+
+    /* An interrupt while the read was in flight is served now */
+    start_fifo_read(zb);
+}
+
+/*!
+ * @brief This internal API is the submit function of the iodev of the sensor.
+ */
+static void zephyr_bmi3_submit(struct rtio_iodev_sqe *iodev_sqe)
+{
+    struct zephyr_bmi3 *zb = iodev_sqe->sqe.iodev->data;
+    struct zephyr_bmi3_hdr *hdr;
+    uint8_t *buf;
+    uint32_t buf_len;
+    uint32_t len = sizeof(struct zephyr_bmi3_hdr) + zb->dev.dummy_byte + ZEPHYR_BMI3_DATA_LEN;
+    int err = 0;
+    k_spinlock_key_t key = k_spin_lock(&zb->lock);
+
+    if (iodev_sqe->sqe.flags & RTIO_SQE_MULTISHOT)
+    {
+        if (zb->stream_sqe == NULL)
+        {
+            zb->stream_sqe = iodev_sqe;
+        }
+        else
+        {
+            err = -EBUSY;
+        }
+
+        k_spin_unlock(&zb->lock, key);
+
+        if (err == 0)
+        {
+            start_fifo_read(zb);
+        }
+    }
+    else
+    {
+        if (zb->busy_sqe == NULL)
+        {
+            zb->busy_sqe = iodev_sqe;
+        }
+        else
+        {
+            err = -EBUSY;
+        }
+
+        k_spin_unlock(&zb->lock, key);
+
+        if (err == 0)
+        {
+            err = rtio_sqe_rx_buf(iodev_sqe, len, len, &buf, &buf_len);
+
+            if (err == 0)
+            {
+                hdr = (struct zephyr_bmi3_hdr *)(void *)buf;
+                hdr->timestamp_ns = k_ticks_to_ns_floor64(k_uptime_ticks());
+                hdr->period_ns = 0;
+                hdr->acc_q = zb->dev.unit_scale.acc_q;
+                hdr->gyr_q = zb->dev.unit_scale.gyr_q;
+                hdr->data_len = (uint16_t)(len - sizeof(struct zephyr_bmi3_hdr));
+                hdr->available_fifo_len = 0;
+                hdr->fifo_sens = 0;
+                hdr->dummy_byte = zb->dev.dummy_byte;
+                hdr->kind = ZEPHYR_BMI3_KIND_DATA;
+
+                err = async_read(zb,
+                                 BMI3_REG_ACC_DATA_X,
+                                 buf + sizeof(struct zephyr_bmi3_hdr),
+                                 hdr->data_len,
+                                 read_done);
+            }
+
+            if (err != 0)
+            {
+                finish(zb, err);
+            }
+        }
+    }
+
+    if (err == -EBUSY)
+    {
+        rtio_iodev_sqe_err(iodev_sqe, err);
+    }
+}
+
+/*!
+ * @brief This internal API fills the FIFO frame and device structure of the decoder.
+ */
+static void decoder_frame(struct bmi3_fifo_frame *fifo, struct bmi3_dev *dev, const uint8_t *buffer)
+{
+    const struct zephyr_bmi3_hdr *hdr = (const struct zephyr_bmi3_hdr *)(const void *)buffer;
+
+    *fifo = (struct bmi3_fifo_frame) { 0 };
+    fifo->data = (uint8_t *)(uintptr_t)(buffer + sizeof(struct zephyr_bmi3_hdr));
+    fifo->length = hdr->data_len;
+    fifo->available_fifo_len = hdr->available_fifo_len;
+    fifo->available_fifo_sens = hdr->fifo_sens;
+
+    *dev = (struct bmi3_dev) { 0 };
+    dev->dummy_byte = hdr->dummy_byte;
+    dev->read = no_bus_read;
+    dev->write = no_bus_write;
+    dev->delay_us = no_bus_delay_us;
+}
+
+/*!
+ * @brief This internal API gets the number of frames of a channel in a buffer.
+ */
+static int decoder_get_frame_count(const uint8_t *buffer, struct sensor_chan_spec chan_spec, uint16_t *frame_count)
+{
+    const struct zephyr_bmi3_hdr *hdr = (const struct zephyr_bmi3_hdr *)(const void *)buffer;
+    struct bmi3_fifo_frame fifo;
+    struct bmi3_fifo_census census;
+    struct bmi3_dev dev = { 0 };
+    int rslt = 0;
+
+    if (chan_spec.chan_idx != 0)
+    {
+        rslt = -ENOTSUP;
+    }
+    else if (hdr->kind == ZEPHYR_BMI3_KIND_DATA)
+    {
+        *frame_count = 1;
+    }
+    else
+    {
+        decoder_frame(&fifo, &dev, buffer);
+
+        if (bmi3_fifo_census(&census, BMI3_ENABLE, &fifo, &dev) != BMI3_OK)
+        {
+            rslt = -EINVAL;
+        }
+        else if (chan_spec.chan_type == SENSOR_CHAN_ACCEL_XYZ)
+        {
+            *frame_count = census.accel_frames;
+        }
+        else if (chan_spec.chan_type == SENSOR_CHAN_GYRO_XYZ)
+        {
+            *frame_count = census.gyro_frames;
+        }
+        else if (chan_spec.chan_type == SENSOR_CHAN_DIE_TEMP)
+        {
+            *frame_count = census.temp_frames;
+        }
+        else
+        {
+            rslt = -ENOTSUP;
+        }
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This internal API gets the size of the decoded data of a channel.
+ */
+static int decoder_get_size_info(struct sensor_chan_spec chan_spec, size_t *base_size, size_t *frame_size)
+{
+    int rslt = 0;
+
+    if ((chan_spec.chan_type == SENSOR_CHAN_ACCEL_XYZ) || (chan_spec.chan_type == SENSOR_CHAN_GYRO_XYZ))
+    {
+        *base_size = sizeof(struct sensor_three_axis_data);
+        *frame_size = sizeof(struct sensor_three_axis_sample_data);
+    }
+    else if (chan_spec.chan_type == SENSOR_CHAN_DIE_TEMP)
+    {
+        *base_size = sizeof(struct sensor_q31_data);
+        *frame_size = sizeof(struct sensor_q31_sample_data);
+    }
+    else
+    {
+        rslt = -ENOTSUP;
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This internal API decodes the frames of a channel from a buffer.
+ */
+static int decoder_decode(const uint8_t *buffer,
+                          struct sensor_chan_spec chan_spec,
+                          uint32_t *fit,
+                          uint16_t max_count,
+                          void *data_out)
+{
+    const struct zephyr_bmi3_hdr *hdr = (const struct zephyr_bmi3_hdr *)(const void *)buffer;
+    const uint8_t *data = buffer + sizeof(struct zephyr_bmi3_hdr) + hdr->dummy_byte;
+    struct sensor_three_axis_data *axes = data_out;
+    struct sensor_q31_data *temp = data_out;
+    struct bmi3_fifo_sens_axes_data acc[ZEPHYR_BMI3_DECODE_CHUNK];
+    struct bmi3_fifo_sens_axes_data gyr[ZEPHYR_BMI3_DECODE_CHUNK];
+    struct bmi3_fifo_temperature_data tmp[ZEPHYR_BMI3_DECODE_CHUNK];
+    const struct bmi3_fifo_sens_axes_data *frames;
+    struct bmi3_fifo_frame fifo;
+    struct bmi3_fifo_census census;
+    struct bmi3_dev dev = { 0 };
+    uint16_t total = 1;
+    uint16_t end;
+    uint16_t count;
+    uint16_t decoded = 0;
+    uint16_t idx;
+    uint32_t delta;
+    int8_t shift = 0;
+    int64_t num = 0;
+    int64_t den = 1;
+    int rslt;
+
+    rslt = (chan_spec.chan_idx == 0) ? decoder_scale(chan_spec.chan_type, hdr, &shift, &num, &den) : -ENOTSUP;
+
+    if ((rslt == 0) && (hdr->kind == ZEPHYR_BMI3_KIND_FIFO))
+    {
+        decoder_frame(&fifo, &dev, buffer);
+        rslt = (bmi3_fifo_census(&census, BMI3_DISABLE, &fifo, &dev) == BMI3_OK) ? 0 : -EINVAL;
+        total = census.frames;
+    }
+
+    if ((rslt == 0) && (*fit < total) && (max_count > 0))
+    {
+        if (hdr->kind == ZEPHYR_BMI3_KIND_DATA)
+        {
+            count = (chan_spec.chan_type == SENSOR_CHAN_GYRO_XYZ) ? BMI3_READ_REG_DATA_GYR_POS : 0;
+
+            if (chan_spec.chan_type == SENSOR_CHAN_DIE_TEMP)
+            {
+                temp->readings[0].timestamp_delta = 0;
+                temp->readings[0].temperature =
+                    to_q31((int16_t)(data[BMI3_READ_REG_DATA_TEMP_POS] |
+                                     ((uint16_t)data[BMI3_READ_REG_DATA_TEMP_POS + 1] << 8)), shift, num, den) +
+                    ZEPHYR_BMI3_TEMP_OFFSET_Q31(shift);
+            }
+            else
+            {
+                axes->readings[0].timestamp_delta = 0;
+
+                for (idx = 0; idx < 3; idx++)
+                {
+                    axes->readings[0].values[idx] =
+                        to_q31((int16_t)(data[count + (idx * 2)] | ((uint16_t)data[count + (idx * 2) + 1] << 8)),
+                               shift,
+                               num,
+                               den);
+                }
+            }
+
+            decoded = 1;
+            *fit = 1;
+        }
+
+        frames = (chan_spec.chan_type == SENSOR_CHAN_GYRO_XYZ) ? gyr : acc;
+
+        /* Frames are extracted in chunks straight from the buffer, dummy frames are skipped */
+        while ((rslt == 0) && (*fit < total) && (decoded < max_count))
+        {
+            count = (uint16_t)(max_count - decoded);
+            count = (count < ZEPHYR_BMI3_DECODE_CHUNK) ? count : ZEPHYR_BMI3_DECODE_CHUNK;
+            end = (uint16_t)(*fit + count);
+            end = (end < total) ? end : total;
+
+            rslt = (bmi3_extract_range(acc, gyr, tmp, (uint16_t)*fit, end, &census, &fifo, &dev) == BMI3_OK) ? 0 :
+                   -EINVAL;
+
+            if (chan_spec.chan_type == SENSOR_CHAN_DIE_TEMP)
+            {
+                count = census.temp_frames;
+            }
+            else
+            {
+                count = (frames == gyr) ? census.gyro_frames : census.accel_frames;
+            }
+
+            for (idx = 0; (rslt == 0) && (idx < count); idx++)
+            {
+                /* Frames following a skipped dummy frame of the chunk are stamped one period early */
+                delta = (uint32_t)((uint64_t)(*fit + idx) * hdr->period_ns);
+
+                if (chan_spec.chan_type == SENSOR_CHAN_DIE_TEMP)
+                {
+                    temp->readings[decoded].timestamp_delta = delta;
+                    temp->readings[decoded].temperature = to_q31((int16_t)tmp[idx].temp_data, shift, num, den) +
+                                                          ZEPHYR_BMI3_TEMP_OFFSET_Q31(shift);
+                }
+                else
+                {
+                    axes->readings[decoded].timestamp_delta = delta;
+                    axes->readings[decoded].x = to_q31(frames[idx].x, shift, num, den);
+                    axes->readings[decoded].y = to_q31(frames[idx].y, shift, num, den);
+                    axes->readings[decoded].z = to_q31(frames[idx].z, shift, num, den);
+                }
+
+                decoded++;
+            }
+
+            *fit = end;
+        }
+
+        /* The interrupt is taken at the newest frame */
+        if (chan_spec.chan_type == SENSOR_CHAN_DIE_TEMP)
+        {
+            temp->header.base_timestamp_ns = hdr->timestamp_ns - ((uint64_t)(total - 1) * hdr->period_ns);
+            temp->header.reading_count = decoded;
+            temp->shift = shift;
+        }
+        else
+        {
+            axes->header.base_timestamp_ns = hdr->timestamp_ns - ((uint64_t)(total - 1) * hdr->period_ns);
+            axes->header.reading_count = decoded;
+            axes->shift = shift;
+        }
+    }
+
+    return (rslt == 0) ? decoded : rslt;
+}
+
+/*!
+ * @brief This internal API tells if a buffer was read on a trigger.
+ */
+static bool decoder_has_trigger(const uint8_t *buffer, enum sensor_trigger_type trigger)
+{
+    const struct zephyr_bmi3_hdr *hdr = (const struct zephyr_bmi3_hdr *)(const void *)buffer;
+
+    return (hdr->kind == ZEPHYR_BMI3_KIND_FIFO) && (trigger == SENSOR_TRIG_FIFO_WATERMARK);
+}
+
+/*!
+ * @brief This internal API gets the q31 scale of a channel.
+ */
+static int decoder_scale(enum sensor_channel chan,
+                         const struct zephyr_bmi3_hdr *hdr,
+                         int8_t *shift,
+                         int64_t *num,
+                         int64_t *den)
+{
+    int64_t full_scale;
+    int rslt = 0;
+
+    if (chan == SENSOR_CHAN_ACCEL_XYZ)
+    {
+        /* m/s^2: g per LSB times SENSOR_G in micro m/s^2 */
+        *num = (int64_t)hdr->acc_q * SENSOR_G;
+        *den = 1000000;
+    }
+    else if (chan == SENSOR_CHAN_GYRO_XYZ)
+    {
+        /* rad/s: dps per LSB times SENSOR_PI in micro rad per 180 degree */
+        *num = (int64_t)hdr->gyr_q * SENSOR_PI;
+        *den = 180 * 1000000;
+    }
+    else if (chan == SENSOR_CHAN_DIE_TEMP)
+    {
+        /* Celsius: 1 / 512 per LSB, offset by ZEPHYR_BMI3_TEMP_OFFSET_Q31 */
+        *num = INT64_C(1) << (BMI3_UNIT_Q_FRAC_BITS - 9);
+        *den = 1;
+    }
+    else
+    {
+        rslt = -ENOTSUP;
+    }
+
+    if ((rslt == 0) && (*num == 0))
+    {
+        rslt = -ENODATA;
+    }
+
+    if (rslt == 0)
+    {
+        full_scale = (chan == SENSOR_CHAN_DIE_TEMP) ? (INT64_C(87) << BMI3_UNIT_Q_FRAC_BITS) : ((32768 * *num) /
+                                                                                                 *den);
+
+        *shift = 0;
+
+        while ((*shift < 31) && ((INT64_C(1) << (BMI3_UNIT_Q_FRAC_BITS + *shift)) < full_scale))
+        {
+            (*shift)++;
+        }
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This internal API converts raw data to q31.
+ */
+static q31_t to_q31(int16_t raw, int8_t shift, int64_t num, int64_t den)
+{
+    int64_t value = ((int64_t)raw * num) / den;
+
+    /* BMI3_UNIT_Q_FRAC_BITS fraction bits to 31 - shift fraction bits */
+    if (shift <= 15)
+    {
+        value *= INT64_C(1) << (15 - shift);
+    }
+    else
+    {
+        value /= INT64_C(1) << (shift - 15);
+    }
+
+    return (q31_t)CLAMP(value, INT32_MIN, INT32_MAX);
+}
+
+/*!
+ * @brief This internal API is the bus stub of the device structure of the decoder.
+ */
+static BMI3_INTF_RET_TYPE no_bus_read(uint8_t reg_addr, uint8_t *reg_data, uint32_t len, void *intf_ptr)
+{
+    (void)reg_addr;
+    (void)reg_data;
+    (void)len;
+    (void)intf_ptr;
+
+    return -EIO;
+}
+
+/*!
+ * @brief This internal API is the bus stub of the device structure of the decoder.
+ */
+static BMI3_INTF_RET_TYPE no_bus_write(uint8_t reg_addr, const uint8_t *reg_data, uint32_t len, void *intf_ptr)
+{
+    (void)reg_addr;
+    (void)reg_data;
+    (void)len;
+    (void)intf_ptr;
+
+    return -EIO;
+}
+
+/*!
+ * @brief This internal API is the delay stub of the device structure of the decoder.
+ */
+static void no_bus_delay_us(uint32_t period, void *intf_ptr)
+{
+    (void)period;
+    (void)intf_ptr;
+}
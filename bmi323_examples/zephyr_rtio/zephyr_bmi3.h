@@ -0,0 +1,183 @@
+/**\
+ * Copyright (c) 2024 Bosch Sensortec GmbH. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ **/
+
+#ifndef _ZEPHYR_BMI3_H
+#define _ZEPHYR_BMI3_H
+
+/*! CPP guard */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/******************************************************************************/
+/*!                 Header Files                                              */
+#include <zephyr/kernel.h>
+#include <zephyr/rtio/rtio.h>
+#include <zephyr/drivers/sensor.h>
+#include "bmi3.h"
+
+/******************************************************************************/
+/*!         Macros definition                                                */
+
+/*! Kind of a read: data registers, one sample of accel, gyro and temperature */
+#define ZEPHYR_BMI3_KIND_DATA            UINT8_C(0)
+
+/*! Kind of a read: FIFO data, read on the FIFO water-mark interrupt */
+#define ZEPHYR_BMI3_KIND_FIFO            UINT8_C(1)
+
+/*! Number of bytes of a data register read, accel, gyro, temperature and sensor time */
+#define ZEPHYR_BMI3_DATA_LEN             BMI3_READ_REG_DATA_TIME_LEN
+
+/*! Size of a buffer holding a data register read */
+#define ZEPHYR_BMI3_DATA_BUF_SIZE        (sizeof(struct zephyr_bmi3_hdr) + ZEPHYR_BMI3_DATA_LEN + BMI3_MAX_DUMMY_BYTE)
+
+/*! Size of a buffer holding the whole FIFO */
+#define ZEPHYR_BMI3_FIFO_BUF_SIZE \
+    (sizeof(struct zephyr_bmi3_hdr) + (BMI3_FIFO_SIZE_WORDS * 2) + BMI3_MAX_DUMMY_BYTE)
+
+/*! Number of FIFO frames extracted at once by the decoder */
+#define ZEPHYR_BMI3_DECODE_CHUNK         UINT16_C(16)
+
+/******************************************************************************/
+/*!         Structure definition                                              */
+
+/*!
+ * @brief Structure to define the header in front of the data of each completed
+ * read, which makes the buffer self-contained for the decoder
+ */
+struct zephyr_bmi3_hdr
+{
+    /*! Time of the interrupt or of the data register read in nanoseconds */
+    uint64_t timestamp_ns;
+
+    /*! Distance of the FIFO frames in nanoseconds, 0 for data register reads */
+    uint32_t period_ns;
+
+    /*! Accel scale of bmi3_unit_scale at the time of the read */
+    int32_t acc_q;
+
+    /*! Gyro scale of bmi3_unit_scale at the time of the read */
+    int32_t gyr_q;
+
+    /*! Number of bytes of data following the header, including the dummy bytes */
+    uint16_t data_len;
+
+    /*! Number of FIFO words given by the fill level */
+    uint16_t available_fifo_len;
+
+    /*! Sensor enable status of the FIFO data */
+    uint16_t fifo_sens;
+
+    /*! Number of dummy bytes in front of the data */
+    uint8_t dummy_byte;
+
+    /*! ZEPHYR_BMI3_KIND_DATA or ZEPHYR_BMI3_KIND_FIFO */
+    uint8_t kind;
+};
+
+/*!
+ * @brief Structure to define the RTIO binding of a sensor. The structure is the
+ * interface pointer of the driver and the data of the RTIO iodev of the sensor
+ */
+struct zephyr_bmi3
+{
+    /*! Device structure, hooked to the blocking bus functions */
+    struct bmi3_dev dev;
+
+    /*! SPI or I2C RTIO iodev of the bus */
+    const struct rtio_iodev *bus;
+
+    /*! RTIO context of the blocking reads and writes of the driver APIs */
+    struct rtio *sync_ctx;
+
+    /*! RTIO context of the chained reads started by interrupts and submissions */
+    struct rtio *ctx;
+
+    /*! Lock of the submissions */
+    struct k_spinlock lock;
+
+    /*! Pending multishot submission, completed on the next FIFO water-mark interrupt */
+    struct rtio_iodev_sqe *stream_sqe;
+
+    /*! Submission of the chained reads in flight, NULL if idle */
+    struct rtio_iodev_sqe *busy_sqe;
+
+    /*! Time of the last FIFO water-mark interrupt in nanoseconds */
+    uint64_t timestamp_ns;
+
+    /*! Distance of the FIFO frames in nanoseconds */
+    uint32_t period_ns;
+
+    /*! Sensor enable status of the FIFO */
+    uint16_t fifo_sens;
+
+    /*! Non-zero if a FIFO water-mark interrupt is not yet served */
+    uint8_t pending;
+
+    /*! FIFO fill level along with the dummy bytes */
+    uint8_t fill[2 + BMI3_MAX_DUMMY_BYTE];
+};
+
+/******************************************************************************/
+/*!         Global variables                                                  */
+
+/*! RTIO iodev API of the sensor, the iodev data being a zephyr_bmi3 structure */
+extern const struct rtio_iodev_api zephyr_bmi3_iodev_api;
+
+/*! Sensor decoder of the buffers completed by the iodev of the sensor */
+extern const struct sensor_decoder_api zephyr_bmi3_decoder;
+
+/******************************************************************************/
+/*!         Functions                                                         */
+
+/*!
+ *  @brief This function hooks the RTIO contexts of the bus into the device
+ *  structure as read, write and delay functions.
+ *
+ *  @param[out] zb       : Structure instance of zephyr_bmi3.
+ *  @param[in]  bus      : SPI or I2C RTIO iodev of the sensor.
+ *  @param[in]  intf     : Interface of the bus, BMI3_SPI_INTF or BMI3_I2C_INTF.
+ *  @param[in]  sync_ctx : RTIO context of the blocking reads and writes.
+ *  @param[in]  ctx      : RTIO context of the chained reads, used by no one else.
+ *
+ *  @return Status of execution
+ *  @retval 0 -> Success
+ *  @retval < 0 -> Failure Info
+ */
+int8_t zephyr_bmi3_init(struct zephyr_bmi3 *zb,
+                        const struct rtio_iodev *bus,
+                        enum bmi3_intf intf,
+                        struct rtio *sync_ctx,
+                        struct rtio *ctx);
+
+/*!
+ *  @brief This function reads the FIFO and sensor configuration, to tag the
+ *  FIFO reads with the sensor enable status and frame period. To be called
+ *  after each change of the configuration.
+ *
+ *  @param[in,out] zb : Structure instance of zephyr_bmi3.
+ *
+ *  @return Status of execution
+ *  @retval 0 -> Success
+ *  @retval < 0 -> Failure Info
+ */
+int8_t zephyr_bmi3_update_stream_config(struct zephyr_bmi3 *zb);
+
+/*!
+ *  @brief This function serves the FIFO water-mark interrupt: it takes the
+ *  timestamp and starts the chained fill level and FIFO data reads into the
+ *  buffer of the pending multishot submission. To be called from the GPIO
+ *  callback.
+ *
+ *  @param[in,out] zb : Structure instance of zephyr_bmi3.
+ */
+void zephyr_bmi3_int_handler(struct zephyr_bmi3 *zb);
+
+#ifdef __cplusplus
+}
+#endif /* End of CPP guard */
+
+#endif /* _ZEPHYR_BMI3_H */
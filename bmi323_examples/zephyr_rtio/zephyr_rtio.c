@@ -0,0 +1,305 @@
+/**\
+ * Copyright (c) 2024 Bosch Sensortec GmbH. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ **/
+
+/*
+ * Zephyr RTIO streaming. The FIFO water-mark interrupt starts chained fill
+ * level and FIFO data reads on the RTIO context of the sensor, with no thread
+ * in between; the FIFO data lands in a buffer of the memory pool of the
+ * application, which decodes it in place through the sensor decoder API.
+ *
+ * The sensor is the devicetree node with the alias imu0, on SPI or I2C, with
+ * the INT1 pin given by its int-gpios property. The in-tree sensor driver of
+ * the node is disabled in prj.conf.
+ */
+
+/******************************************************************************/
+/*!                 Header Files                                              */
+#include <zephyr/kernel.h>
+#include <zephyr/devicetree.h>
+#include <zephyr/drivers/gpio.h>
+#include <zephyr/drivers/i2c.h>
+#include <zephyr/drivers/sensor_data_types.h>
+#include <zephyr/drivers/spi.h>
+#include <zephyr/sys/printk.h>
+#include "bmi323.h"
+#include "zephyr_bmi3.h"
+
+/******************************************************************************/
+/*!         Macros definition                                                */
+
+/*! Devicetree node of the sensor */
+#define ZEPHYR_RTIO_NODE                 DT_ALIAS(imu0)
+
+/*! FIFO water-mark level in words */
+#define ZEPHYR_RTIO_FIFO_WM              UINT16_C(240)
+
+/*! Number of blocks of the memory pool of the application */
+#define ZEPHYR_RTIO_BLOCKS               64
+
+/*! Size of a block of the memory pool of the application */
+#define ZEPHYR_RTIO_BLOCK_SIZE           128
+
+/*! Number of frames decoded at once */
+#define ZEPHYR_RTIO_FRAMES               UINT16_C(16)
+
+/*! Size of the decoded data of ZEPHYR_RTIO_FRAMES frames */
+#define ZEPHYR_RTIO_DECODED_SIZE \
+    (sizeof(struct sensor_three_axis_data) + ((ZEPHYR_RTIO_FRAMES - 1) * sizeof(struct sensor_three_axis_sample_data)))
+
+/******************************************************************************/
+/*!         Global variables                                                  */
+
+#if DT_ON_BUS(ZEPHYR_RTIO_NODE, spi)
+SPI_DT_IODEV_DEFINE(bmi3_bus, ZEPHYR_RTIO_NODE, SPI_WORD_SET(8) | SPI_TRANSFER_MSB | SPI_OP_MODE_MASTER, 0U);
+#define ZEPHYR_RTIO_INTF                 BMI3_SPI_INTF
+#else
+I2C_DT_IODEV_DEFINE(bmi3_bus, ZEPHYR_RTIO_NODE);
+#define ZEPHYR_RTIO_INTF                 BMI3_I2C_INTF
+#endif
+
+/*! RTIO context of the blocking reads and writes of the driver */
+RTIO_DEFINE(bmi3_sync_ctx, 4, 4);
+
+/*! RTIO context of the chained reads started by the interrupt */
+RTIO_DEFINE(bmi3_ctx, 8, 8);
+
+/*! RTIO context of the application, FIFO data is completed into its memory pool */
+RTIO_DEFINE_WITH_MEMPOOL(app_ctx, 4, 4, ZEPHYR_RTIO_BLOCKS, ZEPHYR_RTIO_BLOCK_SIZE, sizeof(uint64_t));
+
+/*! RTIO binding of the sensor */
+static struct zephyr_bmi3 bmi3;
+
+/*! RTIO iodev of the sensor, submissions are served by the interrupt */
+RTIO_IODEV_DEFINE(bmi3_stream, &zephyr_bmi3_iodev_api, &bmi3);
+
+/*! INT1 pin of the sensor */
+static const struct gpio_dt_spec int1 = GPIO_DT_SPEC_GET(ZEPHYR_RTIO_NODE, int_gpios);
+
+/*! GPIO callback of INT1 */
+static struct gpio_callback int1_cb;
+
+/*! Decoded accel frames, sized as given by get_size_info */
+static uint8_t accel_buf[ZEPHYR_RTIO_DECODED_SIZE] __aligned(8);
+
+/*! Decoded gyro frames */
+static uint8_t gyro_buf[ZEPHYR_RTIO_DECODED_SIZE] __aligned(8);
+
+/******************************************************************************/
+/*!           Static Function Declaration                                     */
+
+/*!
+ *  @brief This internal API configures accel and gyro at 400 Hz, the FIFO
+ *  water-mark interrupt on INT1 and the FIFO in one register image.
+ *
+ *  @param[in,out] dev : Structure instance of bmi3_dev.
+ *
+ *  @return Status of execution
+ *  @retval 0 -> Success
+ *  @retval < 0 -> Failure Info
+ */
+static int8_t set_fifo_stream(struct bmi3_dev *dev);
+
+/*!
+ *  @brief This internal API sets up INT1 as GPIO interrupt.
+ *
+ *  @return 0 on success, negative error otherwise
+ */
+static int set_int1(void);
+
+/*!
+ *  @brief This internal API is the GPIO callback of INT1.
+ */
+static void on_int1(const struct device *port, struct gpio_callback *cb, gpio_port_pins_t pins);
+
+/*!
+ *  @brief This internal API decodes and prints a completed FIFO read.
+ *
+ *  @param[in] buf : Buffer of the completed read.
+ */
+static void print_fifo(const uint8_t *buf);
+
+/******************************************************************************/
+/*!            Functions                                        */
+
+/* This function starts the execution of program. */
+int main(void)
+{
+    int8_t rslt;
+    int err = 0;
+    struct rtio_sqe *sqe;
+    struct rtio_cqe *cqe;
+    uint8_t *buf;
+    uint32_t buf_len;
+
+    rslt = zephyr_bmi3_init(&bmi3, &bmi3_bus, ZEPHYR_RTIO_INTF, &bmi3_sync_ctx, &bmi3_ctx);
+
+    if (rslt == BMI323_OK)
+    {
+        rslt = bmi323_init(&bmi3.dev);
+    }
+
+    if (rslt == BMI323_OK)
+    {
+        rslt = set_fifo_stream(&bmi3.dev);
+    }
+
+    if (rslt == BMI323_OK)
+    {
+        rslt = zephyr_bmi3_update_stream_config(&bmi3);
+    }
+
+    if (rslt == BMI323_OK)
+    {
+        err = set_int1();
+    }
+
+    if ((rslt == BMI323_OK) && (err == 0))
+    {
+        /* One multishot read: each water-mark interrupt completes a buffer of the pool */
+        sqe = rtio_sqe_acquire(&app_ctx);
+        rtio_sqe_prep_read_with_pool(sqe, &bmi3_stream, RTIO_PRIO_NORM, NULL);
+        sqe->flags |= RTIO_SQE_MULTISHOT;
+        (void)rtio_submit(&app_ctx, 0);
+
+        printk("Streaming FIFO at %u ns per frame\n", bmi3.period_ns);
+
+        for (;;)
+        {
+            cqe = rtio_cqe_consume_block(&app_ctx);
+
+            if (cqe->result < 0)
+            {
+                printk("FIFO read failed: %d\n", cqe->result);
+            }
+            else if (rtio_cqe_get_mempool_buffer(&app_ctx, cqe, &buf, &buf_len) == 0)
+            {
+                print_fifo(buf);
+                rtio_release_buffer(&app_ctx, buf, buf_len);
+            }
+
+            rtio_cqe_release(&app_ctx, cqe);
+        }
+    }
+
+    printk("Setup failed: %d %d\n", rslt, err);
+
+    return rslt;
+}
+
+/*!
+ * @brief This internal API configures the sensor, FIFO and INT1.
+ */
+static int8_t set_fifo_stream(struct bmi3_dev *dev)
+{
+    /* Invalid combinations fail to compile */
+    const struct bmi3_reg_image image = {
+        .acc_conf = BMI3_ACC_CONF_IMAGE(BMI3_ACC_ODR_400HZ,
+                                        BMI3_ACC_RANGE_8G,
+                                        BMI3_ACC_BW_ODR_QUARTER,
+                                        BMI3_ACC_AVG1,
+                                        BMI3_ACC_MODE_HIGH_PERF),
+        .gyr_conf = BMI3_GYR_CONF_IMAGE(BMI3_GYR_ODR_400HZ,
+                                        BMI3_GYR_RANGE_2000DPS,
+                                        BMI3_GYR_BW_ODR_QUARTER,
+                                        BMI3_GYR_AVG1,
+                                        BMI3_GYR_MODE_HIGH_PERF),
+        .fifo_watermark = ZEPHYR_RTIO_FIFO_WM,
+        .fifo_conf = BMI3_FIFO_CONF_IMAGE(BMI3_FIFO_ACC_EN | BMI3_FIFO_GYR_EN, BMI3_DISABLE),
+        .io_int_ctrl = BMI3_INT1_LVL_MASK | BMI3_INT1_OUTPUT_EN_MASK,
+        .int_conf = 0,
+        .int_map1 = 0,
+        .int_map2 = BMI3_INT_MAP2_IMAGE(BMI3_INT_NONE,
+                                        BMI3_INT_NONE,
+                                        BMI3_INT_NONE,
+                                        BMI3_INT_NONE,
+                                        BMI3_INT_NONE,
+                                        BMI3_INT_NONE,
+                                        BMI3_INT1,
+                                        BMI3_INT_NONE)
+    };
+
+    return bmi323_set_reg_image(&image, dev);
+}
+
+/*!
+ * @brief This internal API sets up INT1 as GPIO interrupt.
+ */
+static int set_int1(void)
+{
+    int err = gpio_is_ready_dt(&int1) ? 0 : -ENODEV;
+
+    if (err == 0)
+    {
+        err = gpio_pin_configure_dt(&int1, GPIO_INPUT);
+    }
+
+    if (err == 0)
+    {
+        gpio_init_callback(&int1_cb, on_int1, BIT(int1.pin));
+        err = gpio_add_callback(int1.port, &int1_cb);
+    }
+
+    if (err == 0)
+    {
+        err = gpio_pin_interrupt_configure_dt(&int1, GPIO_INT_EDGE_TO_ACTIVE);
+    }
+
+    return err;
+}
+
+/*!
+ * @brief This internal API is the GPIO callback of INT1.
+ */
+static void on_int1(const struct device *port, struct gpio_callback *cb, gpio_port_pins_t pins)
+{
+    (void)port;
+    (void)cb;
+    (void)pins;
+
+    zephyr_bmi3_int_handler(&bmi3);
+}
+
+/*!
+ * @brief This internal API decodes and prints a completed FIFO read.
+ */
+static void print_fifo(const uint8_t *buf)
+{
+    const struct sensor_chan_spec acc_chan = { SENSOR_CHAN_ACCEL_XYZ, 0 };
+    const struct sensor_chan_spec gyr_chan = { SENSOR_CHAN_GYRO_XYZ, 0 };
+    uint32_t acc_fit = 0;
+    uint32_t gyr_fit = 0;
+    const struct sensor_three_axis_data *accel = (const struct sensor_three_axis_data *)(const void *)accel_buf;
+    const struct sensor_three_axis_data *gyro = (const struct sensor_three_axis_data *)(const void *)gyro_buf;
+    uint16_t frames = 0;
+    int n_acc;
+    int n_gyr;
+    int idx;
+
+    (void)zephyr_bmi3_decoder.get_frame_count(buf, acc_chan, &frames);
+
+    /* Decoded in chunks, the buffer is parsed in place */
+    do
+    {
+        n_acc = zephyr_bmi3_decoder.decode(buf, acc_chan, &acc_fit, ZEPHYR_RTIO_FRAMES, accel_buf);
+        n_gyr = zephyr_bmi3_decoder.decode(buf, gyr_chan, &gyr_fit, ZEPHYR_RTIO_FRAMES, gyro_buf);
+
+        for (idx = 0; (idx < n_acc) && (idx < n_gyr); idx++)
+        {
+            printk("%llu ns acc %d %d %d gyr %d %d %d (q31, shift %d / %d)\n",
+                   (unsigned long long)(accel->header.base_timestamp_ns + accel->readings[idx].timestamp_delta),
+                   accel->readings[idx].x,
+                   accel->readings[idx].y,
+                   accel->readings[idx].z,
+                   gyro->readings[idx].x,
+                   gyro->readings[idx].y,
+                   gyro->readings[idx].z,
+                   accel->shift,
+                   gyro->shift);
+        }
+    } while ((n_acc > 0) && (n_gyr > 0));
+
+    printk("%u accel frames\n", frames);
+}
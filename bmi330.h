@@ -81,6 +81,13 @@ extern "C" {
  * @details This API is the entry point for bmi330 sensor. It also reads the chip-id of
  * the sensor.
  *
+ * @note The device structure has to be zero-initialized, e.g. "struct bmi3_dev dev = { 0 };",
+ * before "intf", "read", "write", "delay_us" and "intf_ptr" are set. The optional function
+ * pointers and configurations of bmi3_dev are used whenever they are not NULL.
+ *
+ * @note If "warm_start" of "dev->boot_cfg" is enabled and the sensor kept its state
+ * over a reset of the host, the soft-reset and the RAM patch upload are skipped.
+ *
  * @param[in,out] dev  : Structure instance of bmi3_dev.
  *
  *  @return Result of API execution status
@@ -90,6 +97,13 @@ extern "C" {
  */
 int8_t bmi330_init(struct bmi3_dev *dev);
 
+/*!
+ * \ingroup bmi330ApiInit
+ * @brief Variant of bmi330 to be given to bmi3_probe_and_init, by an application
+ * supporting other variants as well. The sensor is then set up as by bmi330_init.
+ */
+extern const struct bmi3_variant bmi330_variant;
+
 /**
  * \ingroup bmi330
  * \defgroup bmi330ApiRegs Registers
@@ -141,6 +155,33 @@ int8_t bmi330_set_regs(uint8_t reg_addr, const uint8_t *data, uint16_t len, stru
  */
 int8_t bmi330_get_regs(uint8_t reg_addr, uint8_t *data, uint16_t len, struct bmi3_dev *dev);
 
+/*!
+ * \ingroup bmi330ApiRegs
+ * \page bmi330_api_bmi330_get_regs_direct bmi330_get_regs_direct
+ * \code
+ * int8_t bmi330_get_regs_direct(uint8_t reg_addr, uint8_t *data, uint16_t len, struct bmi3_dev *dev);
+ * \endcode
+ * @details This API reads the data from the given register address of the sensor
+ * directly into the buffer of the user. Unlike "bmi330_get_regs", no temporary buffer
+ * and copy are used: the dummy bytes are kept at the start of the buffer and the
+ * data follows them at offset dev->dummy_byte (at most BMI3_MAX_DUMMY_BYTE).
+ * The length is therefore not limited by BMI3_MAX_LEN.
+ *
+ * @param[in]  reg_addr : Register address from which data is read.
+ * @param[out] data     : Pointer to data buffer of at least
+ *                        (len + dev->dummy_byte) bytes. Read data
+ *                        starts at data[dev->dummy_byte].
+ * @param[in]  len      : No. of bytes of data to be read.
+ * @param[in]  dev      : Structure instance of bmi3_dev.
+ *
+ * @return Result of API execution status
+ *
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ *
+ */
+int8_t bmi330_get_regs_direct(uint8_t reg_addr, uint8_t *data, uint16_t len, struct bmi3_dev *dev);
+
 /**
  * \ingroup bmi330
  * \defgroup bmi330ContextSel Context switch
@@ -184,6 +225,10 @@ int8_t bmi330_context_switch_selection(struct bmi3_dev *dev);
  * @note If selected interface is SPI, an extra dummy byte is read to bring the
  * interface back to SPI from default, after the soft-reset command.
  *
+ * @note The feature engine status is polled as per "boot_cfg" of bmi3_dev. A short
+ * poll interval reduces the boot time. If "boot_cfg" is NULL, the status is polled
+ * every BMI3_FEATURE_ENGINE_POLL_DELAY for up to BMI3_FEATURE_ENGINE_TIMEOUT.
+ *
  * @param[in] dev : Structure instance of bmi3_dev.
  *
  *  @return Result of API execution status
@@ -321,6 +366,213 @@ int8_t bmi330_get_int1_status(uint16_t *int_status, struct bmi3_dev *dev);
  */
 int8_t bmi330_get_int2_status(uint16_t *int_status, struct bmi3_dev *dev);
 
+/**
+ * \ingroup bmi330
+ * \defgroup bmi330Apiintdispatch intdispatch
+ * @brief Interrupt event dispatcher
+ */
+
+/*!
+ * \ingroup bmi330Apiintdispatch
+ * \page bmi330_api_bmi330_int_dispatch_init bmi330_int_dispatch_init
+ * \code
+ * int8_t bmi330_int_dispatch_init(uint8_t sources, void *ctx, struct bmi3_int_dispatcher *disp);
+ * \endcode
+ * @details This API initializes the interrupt dispatcher with no callback registered.
+ * The interrupt status registers from the first to the last selected source are
+ * read in one burst, registers in between included.
+ *
+ * @param[in]  sources : Interrupt status registers to be read:
+ *                       BMI3_INT_SRC_INT1, BMI3_INT_SRC_INT2 and/or BMI3_INT_SRC_IBI.
+ * @param[in]  ctx     : User context passed to the callbacks.
+ * @param[out] disp    : Structure instance of bmi3_int_dispatcher.
+ *
+ * @return Result of API execution status
+ *
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ *
+ */
+int8_t bmi330_int_dispatch_init(uint8_t sources, void *ctx, struct bmi3_int_dispatcher *disp);
+
+/*!
+ * \ingroup bmi330Apiintdispatch
+ * \page bmi330_api_bmi330_int_dispatch_register bmi330_int_dispatch_register
+ * \code
+ * int8_t bmi330_int_dispatch_register(uint16_t int_status,
+ *                                     bmi3_int_event_fptr_t callback,
+ *                                     struct bmi3_int_dispatcher *disp);
+ * \endcode
+ * @details This API registers a callback for one or more interrupt status bits. The
+ * callback decides which payload the dispatcher reads:
+ * ACC_DRDY, GYR_DRDY and TEMP_DRDY extend the status burst to the data registers,
+ * STEP_COUNTER extends it to the step count, ORIENTATION and TAP read the feature
+ * event register and ERR the error register once the interrupt fired.
+ *
+ * @param[in]     int_status : Interrupt status bits, BMI3_INT_STATUS_* values.
+ * @param[in]     callback   : Callback to be called, NULL to unregister.
+ * @param[in,out] disp       : Structure instance of bmi3_int_dispatcher.
+ *
+ * @return Result of API execution status
+ *
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ *
+ */
+int8_t bmi330_int_dispatch_register(uint16_t int_status,
+                                    bmi3_int_event_fptr_t callback,
+                                    struct bmi3_int_dispatcher *disp);
+
+/*!
+ * \ingroup bmi330Apiintdispatch
+ * \page bmi330_api_bmi330_int_dispatch bmi330_int_dispatch
+ * \code
+ * int8_t bmi330_int_dispatch(struct bmi3_int_dispatcher *disp, struct bmi3_dev *dev);
+ * \endcode
+ * @details This API reads the interrupt status registers and the payloads of the
+ * registered callbacks, preceding data registers and following step count
+ * included, in one burst. Payloads of other registers are read only if their
+ * interrupt fired. Then the callback of each interrupt status bit that fired on
+ * any of the sources is called once, in ascending bit order, without the device
+ * lock held.
+ *
+ * @note Reading the interrupt status clears it, as with bmi330_get_int1_status.
+ *
+ * @param[in,out] disp  : Structure instance of bmi3_int_dispatcher.
+ * @param[in,out] dev   : Structure instance of bmi3_dev.
+ *
+ * @return Result of API execution status
+ *
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ *
+ */
+int8_t bmi330_int_dispatch(struct bmi3_int_dispatcher *disp, struct bmi3_dev *dev);
+
+/*!
+ * \ingroup bmi330Apiintdispatch
+ * \page bmi330_api_bmi330_int_dispatch_ibi bmi330_int_dispatch_ibi
+ * \code
+ * int8_t bmi330_int_dispatch_ibi(uint16_t ibi_status, struct bmi3_int_dispatcher *disp, struct bmi3_dev *dev);
+ * \endcode
+ * @details This API dispatches an I3C in-band interrupt whose IBI status is delivered
+ * by the host controller in the IBI payload, so no status register is read.
+ * Only the payloads of the registered callbacks whose interrupt fired are read,
+ * the data registers up to the saturation flags in one burst. Then the
+ * callbacks are called as with bmi330_int_dispatch.
+ *
+ * @param[in]     ibi_status : IBI status from the in-band interrupt payload, BMI3_IBI_STATUS_* bits.
+ * @param[in,out] disp       : Structure instance of bmi3_int_dispatcher.
+ * @param[in,out] dev        : Structure instance of bmi3_dev.
+ *
+ * @return Result of API execution status
+ *
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ *
+ */
+int8_t bmi330_int_dispatch_ibi(uint16_t ibi_status, struct bmi3_int_dispatcher *disp, struct bmi3_dev *dev);
+
+/**
+ * \ingroup bmi330
+ * \defgroup bmi330Apiintroute introute
+ * @brief Split of the interrupt sources on a fast data path and a deferred event path
+ */
+
+/*!
+ * \ingroup bmi330Apiintroute
+ * \page bmi330_api_bmi330_set_int_route bmi330_set_int_route
+ * \code
+ * int8_t bmi330_set_int_route(const struct bmi3_int_route *route, struct bmi3_dev *dev);
+ * \endcode
+ * @details This API maps the data sources of the route to the data pin and the
+ * feature events to the event pin with one write of INT_MAP1 and INT_MAP2,
+ * sources of neither set are disabled, and sets the latch mode. The latch mode
+ * is a single setting of the sensor for all pins: latched, the fast path reads
+ * the status of the data pin to release it; non-latched, the fast path reads
+ * the FIFO only.
+ *
+ * @note The pin configuration, e.g. by "bmi330_set_int_pin_config", is kept, but
+ * that API also sets the latch mode.
+ *
+ * @param[in]     route : Structure instance of bmi3_int_route.
+ * @param[in,out] dev   : Structure instance of bmi3_dev.
+ *
+ * @return Result of API execution status
+ *
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ * @retval BMI3_E_INVALID_INPUT -> Pins not distinct or sources not of their path
+ *
+ */
+int8_t bmi330_set_int_route(const struct bmi3_int_route *route, struct bmi3_dev *dev);
+
+/*!
+ * \ingroup bmi330Apiintroute
+ * \page bmi330_api_bmi330_int_route_dispatch_init bmi330_int_route_dispatch_init
+ * \code
+ * int8_t bmi330_int_route_dispatch_init(const struct bmi3_int_route *route,
+ *                                       void *ctx,
+ *                                       struct bmi3_int_dispatcher *disp);
+ * \endcode
+ * @details This API initializes the interrupt dispatcher of the deferred path,
+ * reading the interrupt status of the event pin only, so the status of the
+ * data pin is left to the fast path. Callbacks of the feature events are then
+ * registered with "bmi330_int_dispatch_register", and the dispatcher is run by
+ * "bmi330_int_dispatch", or "bmi330_int_dispatch_ibi" if the event pin is
+ * BMI3_I3C_INT, out of the interrupt context.
+ *
+ * @param[in]  route : Structure instance of bmi3_int_route.
+ * @param[in]  ctx   : User context passed to the callbacks.
+ * @param[out] disp  : Structure instance of bmi3_int_dispatcher.
+ *
+ * @return Result of API execution status
+ *
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ * @retval BMI3_E_INVALID_INPUT -> Invalid event pin
+ *
+ */
+int8_t bmi330_int_route_dispatch_init(const struct bmi3_int_route *route,
+                                      void *ctx,
+                                      struct bmi3_int_dispatcher *disp);
+
+/*!
+ * \ingroup bmi330Apiintroute
+ * \page bmi330_api_bmi330_int_route_service_data bmi330_int_route_service_data
+ * \code
+ * int8_t bmi330_int_route_service_data(const struct bmi3_int_route *route,
+ *                                      uint16_t *int_status,
+ *                                      struct bmi3_fifo_frame *fifo,
+ *                                      struct bmi3_dev *dev);
+ * \endcode
+ * @details This API is the fast path of the data pin. Latched, the interrupt status
+ * of the data pin only is read, which releases the pin; non-latched, no status
+ * is read. If a FIFO source is routed and, latched, pending, the fill level
+ * and the available FIFO data, limited by fifo->length, are read. The status
+ * of the event pin and feature outputs are never read. The frames can then be
+ * extracted as after "bmi330_read_fifo_data".
+ *
+ * @note Data ready sources routed to the data pin release it, latched, but
+ * their data registers are read by the caller.
+ *
+ * @param[in]     route      : Structure instance of bmi3_int_route.
+ * @param[out]    int_status : Interrupt status of the data pin, 0 if not read.
+ * @param[in,out] fifo       : Structure instance of bmi3_fifo_frame.
+ * @param[in,out] dev        : Structure instance of bmi3_dev.
+ *
+ * @return Result of API execution status
+ *
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ * @retval > 0 -> Warning
+ *
+ */
+int8_t bmi330_int_route_service_data(const struct bmi3_int_route *route,
+                                     uint16_t *int_status,
+                                     struct bmi3_fifo_frame *fifo,
+                                     struct bmi3_dev *dev);
+
 /**
  * \ingroup bmi330
  * \defgroup bmi330ApiRemap Remap Axes
@@ -365,6 +617,57 @@ int8_t bmi330_get_remap_axes(struct bmi3_axes_remap *remapped_axis, struct bmi3_
  */
 int8_t bmi330_set_remap_axes(const struct bmi3_axes_remap remapped_axis, struct bmi3_dev *dev);
 
+/*!
+ * \ingroup bmi330ApiRemap
+ * \page bmi330_api_bmi330_prepare_remap_axes bmi330_prepare_remap_axes
+ * \code
+ * int8_t bmi330_prepare_remap_axes(const struct bmi3_axes_remap *remapped_axis, struct bmi3_remap_stage *stage);
+ * \endcode
+ * @details This API stages an axis remap: the feature engine word is computed once, so that
+ * the remap can later be applied by "bmi330_apply_remap_axes" without any computation.
+ * No bus access is done.
+ *
+ * @param[in]  remapped_axis : Structure that stores re-mapped axes.
+ * @param[out] stage         : Structure instance of bmi3_remap_stage.
+ *
+ * @return Result of API execution status
+ *
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ *
+ */
+int8_t bmi330_prepare_remap_axes(const struct bmi3_axes_remap *remapped_axis, struct bmi3_remap_stage *stage);
+
+/*!
+ * \ingroup bmi330ApiRemap
+ * \page bmi330_api_bmi330_apply_remap_axes bmi330_apply_remap_axes
+ * \code
+ * int8_t bmi330_apply_remap_axes(const struct bmi3_remap_stage *stage, struct bmi3_dev *dev);
+ * \endcode
+ * @details This API applies a staged axis remap with the least disturbance of the accel.
+ * Nothing is written if the sensor already has the remap. Otherwise the remap word,
+ * the disabling of the accel and the axis map update command are sent in one batch;
+ * the accel configuration register is written back as it was once the update
+ * completed. Unlike "bmi330_set_remap_axes", the accel configuration register is read once,
+ * from the shadow register cache if it is enabled, instead of through the sensor
+ * configuration APIs, and the update is polled every millisecond.
+ *
+ * @note To avoid touching the sensor at all, e.g. for frequent changes, pass
+ * "remap" of the staged remap to "bmi330_set_axes_correction" instead, with
+ * the axis remap of the sensor left at BMI3_MAP_XYZ_AXIS: the FIFO data is
+ * then remapped while it is parsed.
+ *
+ * @param[in] stage : Structure instance of bmi3_remap_stage.
+ * @param[in] dev   : Structure instance of bmi3_dev.
+ *
+ * @return Result of API execution status
+ *
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ *
+ */
+int8_t bmi330_apply_remap_axes(const struct bmi3_remap_stage *stage, struct bmi3_dev *dev);
+
 /**
  * \ingroup bmi330
  * \defgroup bmi330ApiErrorStatus Error Status
@@ -546,6 +849,122 @@ int8_t bmi330_set_sensor_config(struct bmi3_sens_config *sens_cfg, uint8_t n_sen
  */
 int8_t bmi330_get_sensor_config(struct bmi3_sens_config *sens_cfg, uint8_t n_sens, struct bmi3_dev *dev);
 
+/**
+ * \ingroup bmi330
+ * \defgroup bmi330ApiFeatureImage FeatureImage
+ * @brief Precomputed feature engine images
+ */
+
+/*!
+ * \ingroup bmi330ApiFeatureImage
+ * \page bmi330_api_bmi330_get_feature_image bmi330_get_feature_image
+ * \code
+ * int8_t bmi330_get_feature_image(const struct bmi3_sens_config *sens_cfg,
+ *                                 uint8_t n_sens,
+ *                                 struct bmi3_feature_batch *image);
+ * \endcode
+ * @details This API encodes the configurations of the features into a
+ * feature engine image, without any access to the sensor. The image can be
+ * computed once, e.g. per use case, and written with "bmi330_set_feature_image".
+ * Supported types are the features configured through the feature engine:
+ * any-motion, no-motion, sig-motion, flat, tilt, orientation, step counter,
+ * tap and alternate auto configuration.
+ *
+ * @note Unlike "bmi330_set_sensor_config", the configurations are not checked
+ * against the accel configuration, which is not known when the image is encoded.
+ *
+ * @param[in]  sens_cfg : Structure instance of bmi3_sens_config.
+ * @param[in]  n_sens   : Number of sensors/features to be encoded.
+ * @param[out] image    : Structure instance of bmi3_feature_batch.
+ *
+ * @return Result of API execution status
+ *
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ *
+ */
+int8_t bmi330_get_feature_image(const struct bmi3_sens_config *sens_cfg,
+                                uint8_t n_sens,
+                                struct bmi3_feature_batch *image);
+
+/*!
+ * \ingroup bmi330ApiFeatureImage
+ * \page bmi330_api_bmi330_set_feature_image bmi330_set_feature_image
+ * \code
+ * int8_t bmi330_set_feature_image(const struct bmi3_feature_batch *image, struct bmi3_dev *dev);
+ * \endcode
+ * @details This API writes a feature engine image encoded by
+ * "bmi330_get_feature_image". If the image written before by this API is
+ * still on the sensor, only the words which differ are written, each run of
+ * consecutive words with one transfer. The image is referenced by the device
+ * until the next image is written, so it has to stay unchanged in memory,
+ * e.g. as static or constant data.
+ *
+ * @note Any other write to the feature engine, e.g. "bmi330_set_sensor_config",
+ * and commands like soft-reset make the next image to be written completely.
+ *
+ * @param[in]     image : Structure instance of bmi3_feature_batch.
+ * @param[in,out] dev   : Structure instance of bmi3_dev.
+ *
+ * @return Result of API execution status
+ *
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ *
+ */
+int8_t bmi330_set_feature_image(const struct bmi3_feature_batch *image, struct bmi3_dev *dev);
+
+/*!
+ * \ingroup bmi330ApiFeatureImage
+ * \page bmi330_api_bmi330_read_feature_image bmi330_read_feature_image
+ * \code
+ * int8_t bmi330_read_feature_image(struct bmi3_feature_batch *image, struct bmi3_dev *dev);
+ * \endcode
+ * @details This API reads the configurations of all features, from axis remap to
+ * alternate auto configuration, with one transfer into a feature engine image.
+ * The features are decoded from the image by "bmi330_decode_feature_image",
+ * without further access to the sensor, e.g. for a diagnostics dump.
+ *
+ * @param[out]    image : Structure instance of bmi3_feature_batch.
+ * @param[in,out] dev   : Structure instance of bmi3_dev.
+ *
+ * @return Result of API execution status
+ *
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ *
+ */
+int8_t bmi330_read_feature_image(struct bmi3_feature_batch *image, struct bmi3_dev *dev);
+
+/*!
+ * \ingroup bmi330ApiFeatureImage
+ * \page bmi330_api_bmi330_decode_feature_image bmi330_decode_feature_image
+ * \code
+ * int8_t bmi330_decode_feature_image(const struct bmi3_feature_batch *image,
+ *                                    struct bmi3_sens_config *sens_cfg,
+ *                                    uint8_t n_sens);
+ * \endcode
+ * @details This API decodes the configurations of the features from a feature
+ * engine image read by "bmi330_read_feature_image" or encoded by
+ * "bmi330_get_feature_image". Supported types are the ones of
+ * "bmi330_get_feature_image".
+ *
+ * @param[in]     image    : Structure instance of bmi3_feature_batch.
+ * @param[in,out] sens_cfg : Structure instance of bmi3_sens_config, of which
+ *                           the types select the features.
+ * @param[in]     n_sens   : Number of features to be decoded.
+ *
+ * @return Result of API execution status
+ *
+ * @retval 0 -> Success
+ * @retval BMI3_E_INVALID_INPUT -> Words of a feature not held by the image
+ * @retval < 0 -> Fail
+ *
+ */
+int8_t bmi330_decode_feature_image(const struct bmi3_feature_batch *image,
+                                   struct bmi3_sens_config *sens_cfg,
+                                   uint8_t n_sens);
+
 /**
  * \ingroup bmi330
  * \defgroup bmi330ApiSensorD Sensor Data
@@ -581,6 +1000,13 @@ int8_t bmi330_get_sensor_config(struct bmi3_sens_config *sens_cfg, uint8_t n_sen
  * BMI330_I3C_SYNC_TEMP       |   16
  *@endverbatim
  *
+ * @note The registers of all the requested sensors are read in as few bursts as
+ * possible: accel, gyro and temperature in one, and all i3c sync data in one
+ * feature engine read. The burst covers the data registers of the requested
+ * sensors only, along with sensor time and saturation flags, e.g. 20 bytes for
+ * accel only. It ends ahead of the interrupt status registers, which are cleared
+ * on read, so step counter is read in a burst of its own.
+ *
  *  @return Result of API execution status
  *
  *  @retval 0 -> Success
@@ -797,20 +1223,35 @@ int8_t bmi330_extract_temperature(struct bmi3_fifo_temperature_data *temp_data,
 
 /**
  * \ingroup bmi330
- * \defgroup bmi330Apisetfifowatermark fifowatermark
+ * \defgroup bmi330Apiextractall extractall
  * @brief Read fifo data
  */
 
 /*!
  * \ingroup bmi330ApiFIFO
- * \page bmi330_api_bmi330_set_fifo_wm bmi330_set_fifo_wm
+ * \page bmi330_api_bmi330_extract_all bmi330_extract_all
  * \code
- * int8_t bmi330_set_fifo_wm(uint16_t fifo_wm, struct bmi3_dev *dev);
+ * int8_t bmi330_extract_all(struct bmi3_fifo_sens_axes_data *accel_data,
+ *                           struct bmi3_fifo_sens_axes_data *gyro_data,
+ *                           struct bmi3_fifo_temperature_data *temp_data,
+ *                           struct bmi3_fifo_frame *fifo,
+ *                           const struct bmi3_dev *dev)
  * \endcode
- * @details This API sets the FIFO water-mark level in words.
+ * @details This API parses and extracts the accelerometer, gyro and temperature
+ * frames from FIFO data read by the "bmi330_read_fifo_data" API in a single pass
+ * over the FIFO buffer. The frame length is derived once from the FIFO
+ * configuration, so enabling all sensors costs one scan instead of three.
  *
- * @param[in] fifo_wm          : Variable to set FIFO water-mark level in words.
- * @param[in] dev              : Structure instance of bmi3_dev.
+ * @note Output structure of a sensor which is not enabled in FIFO may be NULL.
+ *
+ * @param[out]    accel_data  : Structure instance of bmi3_fifo_sens_axes_data
+ *                              where the parsed accelerometer frames are stored.
+ * @param[out]    gyro_data   : Structure instance of bmi3_fifo_sens_axes_data
+ *                              where the parsed gyro frames are stored.
+ * @param[out]    temp_data   : Structure instance of bmi3_fifo_temperature_data
+ *                              where the parsed temperature frames are stored.
+ * @param[in,out] fifo        : Structure instance of bmi3_fifo_frame.
+ * @param[in]     dev         : Structure instance of bmi3_dev
  *
  * @return Result of API execution status
  *
@@ -818,57 +1259,104 @@ int8_t bmi330_extract_temperature(struct bmi3_fifo_temperature_data *temp_data,
  * @retval < 0 -> Fail
  *
  */
-int8_t bmi330_set_fifo_wm(uint16_t fifo_wm, struct bmi3_dev *dev);
+int8_t bmi330_extract_all(struct bmi3_fifo_sens_axes_data *accel_data,
+                          struct bmi3_fifo_sens_axes_data *gyro_data,
+                          struct bmi3_fifo_temperature_data *temp_data,
+                          struct bmi3_fifo_frame *fifo,
+                          const struct bmi3_dev *dev);
 
 /**
  * \ingroup bmi330
- * \defgroup bmi330Apisetfifowatermark fifowatermark
- * @brief Read fifo data
+ * \defgroup bmi330ApiFifoRange FifoRange
+ * @brief Extraction of a range of FIFO frames
  */
 
 /*!
- * \ingroup bmi330ApiFIFO
- * \page bmi330_api_bmi330_get_fifo_wm bmi330_get_fifo_wm
+ * \ingroup bmi330ApiFifoRange
+ * \page bmi330_api_bmi330_extract_range bmi330_extract_range
  * \code
- * int8_t bmi330_get_fifo_wm(uint16_t *fifo_wm, struct bmi3_dev *dev);
+ * int8_t bmi330_extract_range(struct bmi3_fifo_sens_axes_data *accel_data,
+ *                             struct bmi3_fifo_sens_axes_data *gyro_data,
+ *                             struct bmi3_fifo_temperature_data *temp_data,
+ *                             uint16_t first_frame,
+ *                             uint16_t end_frame,
+ *                             struct bmi3_fifo_census *count,
+ *                             const struct bmi3_fifo_frame *fifo,
+ *                             const struct bmi3_dev *dev);
  * \endcode
- * @details This API reads the FIFO water-mark level set in words.
- *
- * @param[out] fifo_wm         : Variable to get FIFO water-mark level in words.
- * @param[in] dev              : Structure instance of bmi3_dev.
+ * @details This API parses and extracts the accelerometer, gyro and temperature frames
+ * [first_frame, end_frame) of the FIFO data read by the "bmi330_read_fifo_data" API.
+ * The frames of the range are stored from index 0 of the output structures. The
+ * FIFO frame and device are not modified, so disjoint ranges of the same FIFO
+ * data can be extracted from several threads at once and merged in order.
+ *
+ * The range is limited by the valid FIFO data, so an end_frame beyond the last
+ * frame, e.g. the number of frames of bmi330_fifo_census plus one, also extracts
+ * the incomplete frame at the end. As dummy frames are skipped, a range may give
+ * fewer frames than its length; accel_frames, gyro_frames and temp_frames of
+ * "count" give the number of frames extracted.
+ *
+ * @param[out] accel_data  : Structure instance of bmi3_fifo_sens_axes_data
+ *                           where the accelerometer frames of the range are stored.
+ * @param[out] gyro_data   : Structure instance of bmi3_fifo_sens_axes_data
+ *                           where the gyro frames of the range are stored.
+ * @param[out] temp_data   : Structure instance of bmi3_fifo_temperature_data
+ *                           where the temperature frames of the range are stored.
+ * @param[in]  first_frame : Index of the first frame of the range.
+ * @param[in]  end_frame   : Index of the frame following the range.
+ * @param[out] count       : Number of frames of the range and of the frames extracted.
+ * @param[in]  fifo        : Structure instance of bmi3_fifo_frame.
+ * @param[in]  dev         : Structure instance of bmi3_dev.
  *
  * @return Result of API execution status
  *
  * @retval 0 -> Success
+ * @retval > 0 -> Warning
  * @retval < 0 -> Fail
  *
  */
-int8_t bmi330_get_fifo_wm(uint16_t *fifo_wm, struct bmi3_dev *dev);
+int8_t bmi330_extract_range(struct bmi3_fifo_sens_axes_data *accel_data,
+                            struct bmi3_fifo_sens_axes_data *gyro_data,
+                            struct bmi3_fifo_temperature_data *temp_data,
+                            uint16_t first_frame,
+                            uint16_t end_frame,
+                            struct bmi3_fifo_census *count,
+                            const struct bmi3_fifo_frame *fifo,
+                            const struct bmi3_dev *dev);
 
 /**
  * \ingroup bmi330
- * \defgroup bmi330ApiFIFO FIFO
- * @brief FIFO operations of the sensor
+ * \defgroup bmi330ApiMultiRate MultiRate
+ * @brief Extract FIFO data of accel and gyro running at different ODRs
  */
 
 /*!
- * \ingroup bmi330ApiFIFO
- * \page bmi330_api_bmi330_set_fifo_config bmi330_set_fifo_config
+ * \ingroup bmi330ApiMultiRate
+ * \page bmi330_api_bmi330_extract_multi_rate bmi330_extract_multi_rate
  * \code
- * int8_t bmi330_set_fifo_config(uint16_t config, uint8_t enable, struct bmi3_dev *dev);
+ * int8_t bmi330_extract_multi_rate(struct bmi3_fifo_multi_rate *multi_rate,
+ *                                  struct bmi3_fifo_time *fifo_time,
+ *                                  const struct bmi3_fifo_frame *fifo,
+ *                                  const struct bmi3_dev *dev);
  * \endcode
- * @details This API sets the FIFO configuration in the sensor.
+ * @details This API parses and extracts the accelerometer and gyro frames of FIFO
+ * data read by the "bmi330_read_fifo_data" API, with accel and gyro running at
+ * different ODRs. The FIFO holds one frame per sample of the faster sensor,
+ * the slower sensor fills the frames in between with dummy frames.
  *
- * @param[in] config        : FIFO configurations to be enabled/disabled.
- * @param[in] enable        : Enable/Disable FIFO configurations.
- * @param[in] dev           : Structure instance of bmi3_dev.
+ * Each sensor is extracted at its native rate. The timestamp of a sample is
+ * the time of its frame, so that samples of both sensors taken at the same
+ * time have the same timestamp. "accel_pair" joins each accelerometer sample
+ * with the gyro sample of the same frame, giving time-aligned 6-DoF pairs.
  *
- *@verbatim
- *  enable        |  Description
- * ---------------|---------------
- * BMI330_DISABLE | Disables FIFO configuration.
- * BMI330_ENABLE  | Enables FIFO configuration.
- *@endverbatim
+ * @note The arrays of "multi_rate" have to hold the number of frames of the
+ * FIFO data, like the output of bmi330_extract_all.
+ *
+ * @param[out]    multi_rate : Structure instance of bmi3_fifo_multi_rate.
+ * @param[in,out] fifo_time  : Structure instance of bmi3_fifo_time initialized with the ODR of the
+ *                             faster sensor, i.e. the FIFO frame rate. NULL if no timestamps are required.
+ * @param[in]     fifo       : Structure instance of bmi3_fifo_frame.
+ * @param[in]     dev        : Structure instance of bmi3_dev.
  *
  * @return Result of API execution status
  *
@@ -876,51 +1364,338 @@ int8_t bmi330_get_fifo_wm(uint16_t *fifo_wm, struct bmi3_dev *dev);
  * @retval < 0 -> Fail
  *
  */
-int8_t bmi330_set_fifo_config(uint16_t config, uint8_t enable, struct bmi3_dev *dev);
+int8_t bmi330_extract_multi_rate(struct bmi3_fifo_multi_rate *multi_rate,
+                                 struct bmi3_fifo_time *fifo_time,
+                                 const struct bmi3_fifo_frame *fifo,
+                                 const struct bmi3_dev *dev);
 
 /**
  * \ingroup bmi330
- * \defgroup bmi330ApiFIFO FIFO
- * @brief FIFO operations of the sensor
+ * \defgroup bmi330ApiSixDof SixDof
+ * @brief Extract joined accelerometer and gyro samples
  */
 
 /*!
- * \ingroup bmi330ApiFIFO
- * \page bmi330_api_bmi330_get_fifo_config bmi330_get_fifo_config
+ * \ingroup bmi330ApiSixDof
+ * \page bmi330_api_bmi330_extract_6dof bmi330_extract_6dof
  * \code
- * int8_t bmi330_get_fifo_config(uint16_t *fifo_config, struct bmi3_dev *dev);
+ * int8_t bmi330_extract_6dof(struct bmi3_fifo_6dof_data *data,
+ *                            struct bmi3_fifo_frame *fifo,
+ *                            const struct bmi3_dev *dev);
  * \endcode
- * @details This API sets the FIFO configuration in the sensor.
+ * @details This API parses and extracts the accelerometer and gyro frames of FIFO
+ * data read by the "bmi330_read_fifo_data" API in a single pass and stores them
+ * as joined 6-DoF samples, each with the sensor time of its frame. Frames
+ * holding a dummy frame of either sensor are skipped, see
+ * bmi330_extract_multi_rate for accel and gyro running at different ODRs.
  *
- * @param[out] fifo_config  : Get FIFO configurations to be enabled/disabled.
- * @param[in] dev           : Structure instance of bmi3_dev.
+ * The number of joined samples is stored in both "avail_fifo_accel_frames"
+ * and "avail_fifo_gyro_frames" of "fifo".
+ *
+ * @param[out]    data : Structure instance of bmi3_fifo_6dof_data where the joined samples are stored.
+ * @param[in,out] fifo : Structure instance of bmi3_fifo_frame.
+ * @param[in]     dev  : Structure instance of bmi3_dev.
  *
  * @return Result of API execution status
  *
  * @retval 0 -> Success
+ * @retval BMI3_E_INVALID_INPUT -> Accel or gyro is not enabled in FIFO
  * @retval < 0 -> Fail
  *
  */
-int8_t bmi330_get_fifo_config(uint16_t *fifo_config, struct bmi3_dev *dev);
+int8_t bmi330_extract_6dof(struct bmi3_fifo_6dof_data *data,
+                           struct bmi3_fifo_frame *fifo,
+                           const struct bmi3_dev *dev);
+
+#ifdef BMI3_SHOCK_DETECT
 
 /**
  * \ingroup bmi330
- * \defgroup bmi330Apigetfifolen getfifolength
- * @brief FIFO operations of the sensor
+ * \defgroup bmi330ApiShock Shock
+ * @brief Detect shocks in the FIFO data
  */
 
 /*!
- * \ingroup bmi330ApiFIFO
- * \page bmi330_api_bmi330_get_fifo_length bmi330_get_fifo_length
+ * \ingroup bmi330ApiShock
+ * \page bmi330_api_bmi330_detect_shock bmi330_detect_shock
  * \code
- * int8_t bmi330_get_fifo_length(uint16_t *fifo_avail_len, struct bmi3_dev *dev);
+ * int8_t bmi330_detect_shock(const struct bmi3_shock_config *config,
+ *                            struct bmi3_shock_event *events,
+ *                            uint8_t *n_events,
+ *                            const struct bmi3_fifo_frame *fifo,
+ *                            const struct bmi3_dev *dev);
  * \endcode
- * @details This API gets the length of FIFO data available in the sensor in
- * words.
+ * @details This API detects shocks in the accelerometer frames of FIFO data read by
+ * the "bmi330_read_fifo_data" API: frames of which an axis exceeds the threshold
+ * in absolute value. The frames are scanned in place, without extracting them.
  *
- * @param[out] fifo_avail_len  : Pointer variable to store the value of FIFO byte
- *                               counter.
- * @param[in]  dev             : Structure instance of bmi3_dev.
+ * Frames above the threshold within the context window of a shock belong to
+ * the same shock. For each shock, the sample of the highest absolute axis
+ * value and the frame range of the context window are stored. The context
+ * window is extracted by bmi330_extract_range if required, FIFO reads without
+ * a shock need no further processing.
+ *
+ * @note Shocks beyond the number of elements of "events" are dropped. The
+ * context window is limited to the frames of the FIFO data.
+ *
+ * @note Available only if the driver is compiled with BMI3_SHOCK_DETECT defined.
+ *
+ * @param[in]     config   : Structure instance of bmi3_shock_config.
+ * @param[out]    events   : Structure instance of bmi3_shock_event where the shocks are stored.
+ * @param[in,out] n_events : Number of elements of "events" as input, number of shocks detected as output.
+ * @param[in]     fifo     : Structure instance of bmi3_fifo_frame.
+ * @param[in]     dev      : Structure instance of bmi3_dev.
+ *
+ * @return Result of API execution status
+ *
+ * @retval 0 -> Success
+ * @retval BMI3_E_INVALID_INPUT -> Accel is not enabled in FIFO or accel range is not known
+ * @retval < 0 -> Fail
+ *
+ */
+int8_t bmi330_detect_shock(const struct bmi3_shock_config *config,
+                           struct bmi3_shock_event *events,
+                           uint8_t *n_events,
+                           const struct bmi3_fifo_frame *fifo,
+                           const struct bmi3_dev *dev);
+#endif
+
+/**
+ * \ingroup bmi330
+ * \defgroup bmi330Apiextractaccelplanes extractaccelplanes
+ * @brief Read fifo data
+ */
+
+/*!
+ * \ingroup bmi330ApiFIFO
+ * \page bmi330_api_bmi330_extract_accel_planes bmi330_extract_accel_planes
+ * \code
+ * int8_t bmi330_extract_accel_planes(const struct bmi3_fifo_sens_axes_planes *accel_planes,
+ *                                    struct bmi3_fifo_frame *fifo,
+ *                                    const struct bmi3_dev *dev);
+ * \endcode
+ * @details This API parses and extracts the accelerometer frames from FIFO data read by
+ * the "bmi330_read_fifo_data" API and stores them in separate x, y, z and sensor time
+ * arrays (structure of arrays) of the "accel_planes" structure instance, so that
+ * the data can be passed directly to vector/DSP routines.
+ * Each array must hold as many elements as accelerometer frames in the FIFO data.
+ *
+ * @param[out]    accel_planes : Structure instance of bmi3_fifo_sens_axes_planes
+ *                               where the parsed accelerometer data is stored.
+ * @param[in,out] fifo         : Structure instance of bmi3_fifo_frame.
+ * @param[in]     dev          : Structure instance of bmi3_dev
+ *
+ * @return Result of API execution status
+ *
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ *
+ */
+int8_t bmi330_extract_accel_planes(const struct bmi3_fifo_sens_axes_planes *accel_planes,
+                                   struct bmi3_fifo_frame *fifo,
+                                   const struct bmi3_dev *dev);
+
+/**
+ * \ingroup bmi330
+ * \defgroup bmi330Apiextractgyroplanes extractgyroplanes
+ * @brief Read fifo data
+ */
+
+/*!
+ * \ingroup bmi330ApiFIFO
+ * \page bmi330_api_bmi330_extract_gyro_planes bmi330_extract_gyro_planes
+ * \code
+ * int8_t bmi330_extract_gyro_planes(const struct bmi3_fifo_sens_axes_planes *gyro_planes,
+ *                                   struct bmi3_fifo_frame *fifo,
+ *                                   const struct bmi3_dev *dev);
+ * \endcode
+ * @details This API parses and extracts the gyro frames from FIFO data read by
+ * the "bmi330_read_fifo_data" API and stores them in separate x, y, z and sensor time
+ * arrays (structure of arrays) of the "gyro_planes" structure instance.
+ * Each array must hold as many elements as gyro frames in the FIFO data.
+ *
+ * @param[out]    gyro_planes : Structure instance of bmi3_fifo_sens_axes_planes
+ *                              where the parsed gyro data is stored.
+ * @param[in,out] fifo        : Structure instance of bmi3_fifo_frame.
+ * @param[in]     dev         : Structure instance of bmi3_dev
+ *
+ * @return Result of API execution status
+ *
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ *
+ */
+int8_t bmi330_extract_gyro_planes(const struct bmi3_fifo_sens_axes_planes *gyro_planes,
+                                  struct bmi3_fifo_frame *fifo,
+                                  const struct bmi3_dev *dev);
+
+/**
+ * \ingroup bmi330
+ * \defgroup bmi330ApiFifoCensus FifoCensus
+ * @brief Number of FIFO frames without parsing
+ */
+
+/*!
+ * \ingroup bmi330ApiFifoCensus
+ * \page bmi330_api_bmi330_fifo_census bmi330_fifo_census
+ * \code
+ * int8_t bmi330_fifo_census(struct bmi3_fifo_census *census,
+ *                           uint8_t count_dummy,
+ *                           const struct bmi3_fifo_frame *fifo,
+ *                           const struct bmi3_dev *dev);
+ * \endcode
+ * @details This API counts the accelerometer, gyro and temperature frames of the FIFO
+ * data in constant time from available_fifo_len, length and the sensor enable
+ * status of the FIFO frame, as headerless frames have a fixed length. It can be
+ * called before the FIFO data is read, e.g. after bmi330_get_fifo_length, to size
+ * the output arrays and queues. The counts match avail_fifo_accel_frames,
+ * avail_fifo_gyro_frames and avail_fifo_temp_frames set by bmi330_extract_all.
+ *
+ * With count_dummy enabled, the first word of each frame of each sensor is
+ * checked for the dummy frame value, which requires the FIFO data to be read.
+ *
+ * @param[out] census      : Structure instance of bmi3_fifo_census.
+ * @param[in]  count_dummy : BMI3_ENABLE to count the dummy frames, BMI3_DISABLE otherwise.
+ * @param[in]  fifo        : Structure instance of bmi3_fifo_frame.
+ * @param[in]  dev         : Structure instance of bmi3_dev.
+ *
+ * @return Result of API execution status
+ *
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ *
+ */
+int8_t bmi330_fifo_census(struct bmi3_fifo_census *census,
+                          uint8_t count_dummy,
+                          const struct bmi3_fifo_frame *fifo,
+                          const struct bmi3_dev *dev);
+
+/**
+ * \ingroup bmi330
+ * \defgroup bmi330Apisetfifowatermark fifowatermark
+ * @brief Read fifo data
+ */
+
+/*!
+ * \ingroup bmi330ApiFIFO
+ * \page bmi330_api_bmi330_set_fifo_wm bmi330_set_fifo_wm
+ * \code
+ * int8_t bmi330_set_fifo_wm(uint16_t fifo_wm, struct bmi3_dev *dev);
+ * \endcode
+ * @details This API sets the FIFO water-mark level in words.
+ *
+ * @param[in] fifo_wm          : Variable to set FIFO water-mark level in words.
+ * @param[in] dev              : Structure instance of bmi3_dev.
+ *
+ * @return Result of API execution status
+ *
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ *
+ */
+int8_t bmi330_set_fifo_wm(uint16_t fifo_wm, struct bmi3_dev *dev);
+
+/**
+ * \ingroup bmi330
+ * \defgroup bmi330Apisetfifowatermark fifowatermark
+ * @brief Read fifo data
+ */
+
+/*!
+ * \ingroup bmi330ApiFIFO
+ * \page bmi330_api_bmi330_get_fifo_wm bmi330_get_fifo_wm
+ * \code
+ * int8_t bmi330_get_fifo_wm(uint16_t *fifo_wm, struct bmi3_dev *dev);
+ * \endcode
+ * @details This API reads the FIFO water-mark level set in words.
+ *
+ * @param[out] fifo_wm         : Variable to get FIFO water-mark level in words.
+ * @param[in] dev              : Structure instance of bmi3_dev.
+ *
+ * @return Result of API execution status
+ *
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ *
+ */
+int8_t bmi330_get_fifo_wm(uint16_t *fifo_wm, struct bmi3_dev *dev);
+
+/**
+ * \ingroup bmi330
+ * \defgroup bmi330ApiFIFO FIFO
+ * @brief FIFO operations of the sensor
+ */
+
+/*!
+ * \ingroup bmi330ApiFIFO
+ * \page bmi330_api_bmi330_set_fifo_config bmi330_set_fifo_config
+ * \code
+ * int8_t bmi330_set_fifo_config(uint16_t config, uint8_t enable, struct bmi3_dev *dev);
+ * \endcode
+ * @details This API sets the FIFO configuration in the sensor.
+ *
+ * @param[in] config        : FIFO configurations to be enabled/disabled.
+ * @param[in] enable        : Enable/Disable FIFO configurations.
+ * @param[in] dev           : Structure instance of bmi3_dev.
+ *
+ *@verbatim
+ *  enable        |  Description
+ * ---------------|---------------
+ * BMI330_DISABLE | Disables FIFO configuration.
+ * BMI330_ENABLE  | Enables FIFO configuration.
+ *@endverbatim
+ *
+ * @return Result of API execution status
+ *
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ *
+ */
+int8_t bmi330_set_fifo_config(uint16_t config, uint8_t enable, struct bmi3_dev *dev);
+
+/**
+ * \ingroup bmi330
+ * \defgroup bmi330ApiFIFO FIFO
+ * @brief FIFO operations of the sensor
+ */
+
+/*!
+ * \ingroup bmi330ApiFIFO
+ * \page bmi330_api_bmi330_get_fifo_config bmi330_get_fifo_config
+ * \code
+ * int8_t bmi330_get_fifo_config(uint16_t *fifo_config, struct bmi3_dev *dev);
+ * \endcode
+ * @details This API sets the FIFO configuration in the sensor.
+ *
+ * @param[out] fifo_config  : Get FIFO configurations to be enabled/disabled.
+ * @param[in] dev           : Structure instance of bmi3_dev.
+ *
+ * @return Result of API execution status
+ *
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ *
+ */
+int8_t bmi330_get_fifo_config(uint16_t *fifo_config, struct bmi3_dev *dev);
+
+/**
+ * \ingroup bmi330
+ * \defgroup bmi330Apigetfifolen getfifolength
+ * @brief FIFO operations of the sensor
+ */
+
+/*!
+ * \ingroup bmi330ApiFIFO
+ * \page bmi330_api_bmi330_get_fifo_length bmi330_get_fifo_length
+ * \code
+ * int8_t bmi330_get_fifo_length(uint16_t *fifo_avail_len, struct bmi3_dev *dev);
+ * \endcode
+ * @details This API gets the length of FIFO data available in the sensor in
+ * words.
+ *
+ * @param[out] fifo_avail_len  : Pointer variable to store the value of FIFO byte
+ *                               counter.
+ * @param[in]  dev             : Structure instance of bmi3_dev.
  *
  * @note The word counter is updated each time a complete frame was read or
  * written.
@@ -966,6 +1741,82 @@ int8_t bmi330_get_fifo_length(uint16_t *fifo_avail_len, struct bmi3_dev *dev);
  */
 int8_t bmi330_perform_self_test(uint8_t st_selection, struct bmi3_st_result *st_result_status, struct bmi3_dev *dev);
 
+/*!
+ * \ingroup bmi330Apiselftest
+ * \page bmi330_api_bmi330_self_test_start bmi330_self_test_start
+ * \code
+ * int8_t bmi330_self_test_start(uint8_t st_selection, struct bmi3_st_ctx *st_ctx, struct bmi3_dev *dev);
+ * \endcode
+ * @details This API prepares the self-test as "bmi330_perform_self_test" does,
+ * saves the accel configuration and triggers the self-test. It returns without
+ * waiting for the result, the self-test is advanced by "bmi330_self_test_poll"
+ * and completed by "bmi330_self_test_finish".
+ *
+ * @note The accel and gyro configuration must not be changed until
+ * "bmi330_self_test_finish" is called.
+ *
+ * @param[in]     st_selection : Self-test selection, as of "bmi330_perform_self_test".
+ * @param[out]    st_ctx       : Structure instance of bmi3_st_ctx, kept by the caller
+ *                               until "bmi330_self_test_finish".
+ * @param[in,out] dev          : Structure instance of bmi3_dev.
+ *
+ * @return Result of API execution status
+ *
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ *
+ */
+int8_t bmi330_self_test_start(uint8_t st_selection, struct bmi3_st_ctx *st_ctx, struct bmi3_dev *dev);
+
+/*!
+ * \ingroup bmi330Apiselftest
+ * \page bmi330_api_bmi330_self_test_poll bmi330_self_test_poll
+ * \code
+ * int8_t bmi330_self_test_poll(struct bmi3_st_ctx *st_ctx, struct bmi3_dev *dev);
+ * \endcode
+ * @details This API reads the self-test status once, without delay, e.g.
+ * from a timer every BMI3_ST_DELAY. The self-test times out after
+ * BMI3_ST_POLL_LIMIT polls without completion. "state" of "st_ctx" is updated.
+ *
+ * @param[in,out] st_ctx  : Structure instance of bmi3_st_ctx.
+ * @param[in,out] dev     : Structure instance of bmi3_dev.
+ *
+ * @return Result of API execution status
+ *
+ * @retval 0 -> Success, self-test complete or timed out
+ * @retval BMI3_W_ST_ONGOING -> Self-test is still running
+ * @retval < 0 -> Fail
+ *
+ */
+int8_t bmi330_self_test_poll(struct bmi3_st_ctx *st_ctx, struct bmi3_dev *dev);
+
+/*!
+ * \ingroup bmi330Apiselftest
+ * \page bmi330_api_bmi330_self_test_finish bmi330_self_test_finish
+ * \code
+ * int8_t bmi330_self_test_finish(struct bmi3_st_ctx *st_ctx,
+ *                                struct bmi3_st_result *st_result_status,
+ *                                struct bmi3_dev *dev);
+ * \endcode
+ * @details This API reads the feature engine error status and, if the
+ * self-test is complete, the result of the self-test. The accel configuration
+ * saved by "bmi330_self_test_start" is restored, also if the self-test timed out
+ * or is aborted before completion.
+ *
+ * @param[in,out] st_ctx            : Structure instance of bmi3_st_ctx.
+ * @param[out]    st_result_status  : Structure instance of bmi3_st_result.
+ * @param[in,out] dev               : Structure instance of bmi3_dev.
+ *
+ * @return Result of API execution status
+ *
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ *
+ */
+int8_t bmi330_self_test_finish(struct bmi3_st_ctx *st_ctx,
+                               struct bmi3_st_result *st_result_status,
+                               struct bmi3_dev *dev);
+
 /**
  * \ingroup bmi330
  * \defgroup bmi330ApiFeatEngErrStatus Read Feature engine error status
@@ -1050,24 +1901,95 @@ int8_t bmi330_get_feature_engine_error_status(uint8_t *feature_engine_err_reg_ls
  */
 int8_t bmi330_configure_enhanced_flexibility(struct bmi3_dev *dev);
 
-/**
- * \ingroup bmi330
- * \defgroup bmi330ConfigVersion Config version
- * @brief This API is used to get the config file version of bmi330
- */
-
 /*!
- * \ingroup bmi330ConfigVersion
- * \page bmi330_api_bmi330_get_config_version bmi330_get_config_version
+ * \ingroup bmi330WriteConfigArray
+ * \page bmi330_api_bmi330_upload_config_array bmi330_upload_config_array
  * \code
- * int8_t bmi330_get_config_version(struct bmi3_config_version *version, struct bmi3_dev *dev);
+ * int8_t bmi330_upload_config_array(const uint8_t *config_array, uint16_t config_size, struct bmi3_dev *dev);
  * \endcode
- * @details This API is used to get the config file version of bmi330
+ * @details This API uploads a config array to the feature engine. The base
+ * address is set once and the data is written in bursts, relying on the
+ * auto-increment of the feature engine transmission address. The burst length
+ * is "max_burst_len" of "dev->upload_cfg", or "read_write_len" if not set, and
+ * the remaining bytes are written in a single transfer.
+ *
+ * @note The config page has to be selected before, as done by
+ * "bmi330_configure_enhanced_flexibility". If "verify" of "dev->upload_cfg" is
+ * enabled, the data is read back in chunks of BMI3_UPLOAD_VERIFY_LEN bytes
+ * and compared with the config array.
+ *
+ * @param[in]     config_array : Config array, the first two bytes hold the feature
+ *                               engine base address of the data.
+ * @param[in]     config_size  : Size of the config array in bytes.
+ * @param[in,out] dev          : Structure instance of bmi3_dev.
  *
- * @param[in,out] version  : Structure instance of bmi3_config_version.
- * @param[in] dev          : Structure instance of bmi3_dev.
+ * @return Result of API execution status
  *
- *  @return Result of API execution status
+ * @retval 0 -> Success
+ * @retval BMI3_E_CONFIG_VERIFY -> Data read back does not match
+ * @retval < 0 -> Fail
+ *
+ */
+int8_t bmi330_upload_config_array(const uint8_t *config_array, uint16_t config_size, struct bmi3_dev *dev);
+
+/*!
+ * \ingroup bmi330WriteConfigArray
+ * \page bmi330_api_bmi330_check_config_array bmi330_check_config_array
+ * \code
+ * int8_t bmi330_check_config_array(const uint8_t *config_version,
+ *                                  const uint8_t *config_array,
+ *                                  uint16_t config_size,
+ *                                  uint8_t *loaded,
+ *                                  struct bmi3_dev *dev);
+ * \endcode
+ * @details This API checks whether a config array is already loaded in the
+ * feature engine, e.g. after a reset of the host while the sensor kept its
+ * power. The config version word is read from the base address of
+ * "config_version" and the last BMI3_UPLOAD_VERIFY_LEN bytes of "config_array"
+ * are read back, both are compared with the given arrays.
+ *
+ * @note The config page has to be selected before, as done by
+ * "bmi330_configure_enhanced_flexibility", which skips the upload if the
+ * config array is already loaded.
+ *
+ * @param[in]     config_version : Config version array, the first two bytes hold the feature
+ *                                 engine base address of the version.
+ * @param[in]     config_array   : Config array, the first two bytes hold the feature
+ *                                 engine base address of the data.
+ * @param[in]     config_size    : Size of the config array in bytes.
+ * @param[out]    loaded         : BMI3_ENABLE if version and data match, else BMI3_DISABLE.
+ * @param[in,out] dev            : Structure instance of bmi3_dev.
+ *
+ * @return Result of API execution status
+ *
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ *
+ */
+int8_t bmi330_check_config_array(const uint8_t *config_version,
+                                 const uint8_t *config_array,
+                                 uint16_t config_size,
+                                 uint8_t *loaded,
+                                 struct bmi3_dev *dev);
+
+/**
+ * \ingroup bmi330
+ * \defgroup bmi330ConfigVersion Config version
+ * @brief This API is used to get the config file version of bmi330
+ */
+
+/*!
+ * \ingroup bmi330ConfigVersion
+ * \page bmi330_api_bmi330_get_config_version bmi330_get_config_version
+ * \code
+ * int8_t bmi330_get_config_version(struct bmi3_config_version *version, struct bmi3_dev *dev);
+ * \endcode
+ * @details This API is used to get the config file version of bmi330
+ *
+ * @param[in,out] version  : Structure instance of bmi3_config_version.
+ * @param[in] dev          : Structure instance of bmi3_dev.
+ *
+ *  @return Result of API execution status
  *
  *  @retval 0 -> Success
  *  @retval < 0 -> Fail
@@ -1113,6 +2035,86 @@ int8_t bmi330_perform_gyro_sc(uint8_t sc_selection,
                               struct bmi3_self_calib_rslt *sc_rslt,
                               struct bmi3_dev *dev);
 
+/*!
+ * \ingroup bmi330Apiselfcalibration
+ * \page bmi330_api_bmi330_gyro_sc_start bmi330_gyro_sc_start
+ * \code
+ * int8_t bmi330_gyro_sc_start(uint8_t sc_selection,
+ *                             uint8_t apply_corr,
+ *                             struct bmi3_sc_ctx *sc_ctx,
+ *                             struct bmi3_dev *dev);
+ * \endcode
+ * @details This API saves the accel configuration, sets the preconditions of the
+ * gyro self-calibration as "bmi330_perform_gyro_sc" does and triggers it. It returns
+ * without waiting for the result, the self-calibration is advanced by
+ * "bmi330_gyro_sc_poll" and completed by "bmi330_gyro_sc_finish".
+ *
+ * @note The accel and gyro configuration must not be changed until
+ * "bmi330_gyro_sc_finish" is called.
+ *
+ * @param[in]     sc_selection : Self-calibration selection, as of "bmi330_perform_gyro_sc".
+ * @param[in]     apply_corr   : Apply the correction, as of "bmi330_perform_gyro_sc".
+ * @param[out]    sc_ctx       : Structure instance of bmi3_sc_ctx, kept by the caller
+ *                               until "bmi330_gyro_sc_finish".
+ * @param[in,out] dev          : Structure instance of bmi3_dev.
+ *
+ * @return Result of API execution status
+ *
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ *
+ */
+int8_t bmi330_gyro_sc_start(uint8_t sc_selection,
+                            uint8_t apply_corr,
+                            struct bmi3_sc_ctx *sc_ctx,
+                            struct bmi3_dev *dev);
+
+/*!
+ * \ingroup bmi330Apiselfcalibration
+ * \page bmi330_api_bmi330_gyro_sc_poll bmi330_gyro_sc_poll
+ * \code
+ * int8_t bmi330_gyro_sc_poll(struct bmi3_sc_ctx *sc_ctx, struct bmi3_dev *dev);
+ * \endcode
+ * @details This API reads the self-calibration status once, without delay, e.g.
+ * from a timer every BMI3_SC_DELAY. The self-calibration times out after
+ * BMI3_SC_POLL_LIMIT polls without completion. "state" of "sc_ctx" is updated.
+ *
+ * @param[in,out] sc_ctx  : Structure instance of bmi3_sc_ctx.
+ * @param[in,out] dev     : Structure instance of bmi3_dev.
+ *
+ * @return Result of API execution status
+ *
+ * @retval 0 -> Success, self-calibration complete or timed out
+ * @retval BMI3_W_SC_ONGOING -> Self-calibration is still running
+ * @retval < 0 -> Fail
+ *
+ */
+int8_t bmi330_gyro_sc_poll(struct bmi3_sc_ctx *sc_ctx, struct bmi3_dev *dev);
+
+/*!
+ * \ingroup bmi330Apiselfcalibration
+ * \page bmi330_api_bmi330_gyro_sc_finish bmi330_gyro_sc_finish
+ * \code
+ * int8_t bmi330_gyro_sc_finish(struct bmi3_sc_ctx *sc_ctx, struct bmi3_self_calib_rslt *sc_rslt, struct bmi3_dev *dev);
+ * \endcode
+ * @details This API reads the result of the self-calibration, or the feature
+ * engine error status if it timed out. The accel configuration saved by
+ * "bmi330_gyro_sc_start" is restored, also if the self-calibration timed out or
+ * is aborted before completion. If requested by "apply_corr", the correction
+ * is applied by the feature engine on completion.
+ *
+ * @param[in,out] sc_ctx   : Structure instance of bmi3_sc_ctx.
+ * @param[out]    sc_rslt  : Structure instance of bmi3_self_calib_rslt.
+ * @param[in,out] dev      : Structure instance of bmi3_dev.
+ *
+ * @return Result of API execution status
+ *
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ *
+ */
+int8_t bmi330_gyro_sc_finish(struct bmi3_sc_ctx *sc_ctx, struct bmi3_self_calib_rslt *sc_rslt, struct bmi3_dev *dev);
+
 /**
  * \ingroup bmi330
  * \defgroup bmi330Apii3c_sync i3c_sync
@@ -1352,6 +2354,66 @@ int8_t bmi330_alternate_config_ctrl(uint8_t config_en, uint8_t alt_rst_conf, str
  */
 int8_t bmi330_read_alternate_status(struct bmi3_alt_status *alt_status, struct bmi3_dev *dev);
 
+/**
+ * \ingroup bmi330
+ * \defgroup bmi330ApiHealth Health
+ * @brief Device health monitor
+ */
+
+/*!
+ * \ingroup bmi330ApiHealth
+ * \page bmi330_api_bmi330_health_init bmi330_health_init
+ * \code
+ * int8_t bmi330_health_init(uint16_t period, struct bmi3_health *health);
+ * \endcode
+ * @details This API initializes the health monitor. The first snapshot is taken
+ * by the next call of "bmi330_health_poll", then every "period" calls, e.g. along
+ * with every Nth FIFO service. No bus access is done.
+ *
+ * @param[in]  period : Number of calls of "bmi330_health_poll" per snapshot, at least 1.
+ * @param[out] health : Structure instance of bmi3_health.
+ *
+ * @return Result of API execution status
+ *
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ * @retval BMI3_E_INVALID_INPUT -> Period is 0
+ *
+ */
+int8_t bmi330_health_init(uint16_t period, struct bmi3_health *health);
+
+/*!
+ * \ingroup bmi330ApiHealth
+ * \page bmi330_api_bmi330_health_poll bmi330_health_poll
+ * \code
+ * int8_t bmi330_health_poll(struct bmi3_health *health, struct bmi3_dev *dev);
+ * \endcode
+ * @details This API takes a health snapshot every "period" calls, nothing is
+ * accessed in between. The error and sensor status registers are read in one
+ * burst, and the feature engine error status in a second one; the alternate
+ * configuration status is read only if switching is enabled, which is served
+ * by the shadow register cache if enabled. The registers are decoded into the
+ * structure, as by "bmi330_get_error_status", "bmi330_get_sensor_status",
+ * "bmi330_get_feature_engine_error_status" and "bmi330_read_alternate_status", and
+ * summarized in "faults". On BMI3_HEALTH_POR the sensor was reset, the shadow
+ * register cache is invalidated and the sensor has to be configured again.
+ *
+ * @note The feature engine overload and watchdog and the i3c_error3 bits of
+ * the error register and the POR bit of the sensor status are clear-on-read,
+ * they are reported by one snapshot only. The first snapshot after power-up
+ * reports BMI3_HEALTH_POR if the sensor status was not read before.
+ *
+ * @param[in,out] health : Structure instance of bmi3_health.
+ * @param[in,out] dev    : Structure instance of bmi3_dev.
+ *
+ * @return Result of API execution status
+ *
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ *
+ */
+int8_t bmi330_health_poll(struct bmi3_health *health, struct bmi3_dev *dev);
+
 /**
  * \ingroup bmi330
  * \defgroup bmi330ApiAccGyrOffsetGain Perform accel gyro offset dgain
@@ -1430,6 +2492,150 @@ int8_t bmi330_set_acc_dp_off_dgain(const struct bmi3_acc_dp_gain_offset *acc_dp_
  */
 int8_t bmi330_set_gyro_dp_off_dgain(const struct bmi3_gyr_dp_gain_offset *gyr_dp_gain_offset, struct bmi3_dev *dev);
 
+/**
+ * \ingroup bmi330
+ * \defgroup bmi330ApiGyroBias GyroBias
+ * @brief Online gyro bias tracking during no-motion intervals
+ */
+
+/*!
+ * \ingroup bmi330ApiGyroBias
+ * \page bmi330_api_bmi330_gyro_bias_init bmi330_gyro_bias_init
+ * \code
+ * int8_t bmi330_gyro_bias_init(uint8_t range,
+ *                              uint16_t min_samples,
+ *                              uint8_t gain_shift,
+ *                              struct bmi3_gyro_bias *bias,
+ *                              struct bmi3_dev *dev);
+ * \endcode
+ * @details This API initializes the online gyro bias tracker. The data path offset and
+ * gain of gyro are read once; the tracker keeps the image and later only writes the
+ * offsets it changes.
+ *
+ * @param[in]  range       : Gyro range of the samples, BMI3_GYR_RANGE_*.
+ * @param[in]  min_samples : Number of samples of an estimate.
+ * @param[in]  gain_shift  : Right shift of the correction of an estimate up to 7, 0
+ *                           applies the full correction.
+ * @param[out] bias        : Structure instance of bmi3_gyro_bias.
+ * @param[in]  dev         : Structure instance of bmi3_dev.
+ *
+ * @return Result of API execution status
+ *
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ * @retval BMI3_E_INVALID_INPUT -> Invalid range or number of samples
+ *
+ */
+int8_t bmi330_gyro_bias_init(uint8_t range,
+                             uint16_t min_samples,
+                             uint8_t gain_shift,
+                             struct bmi3_gyro_bias *bias,
+                             struct bmi3_dev *dev);
+
+/*!
+ * \ingroup bmi330ApiGyroBias
+ * \page bmi330_api_bmi330_gyro_bias_update bmi330_gyro_bias_update
+ * \code
+ * int8_t bmi330_gyro_bias_update(uint16_t int_status,
+ *                                const struct bmi3_fifo_sens_axes_data *gyro_data,
+ *                                uint16_t n_frames,
+ *                                struct bmi3_gyro_bias *bias,
+ *                                struct bmi3_dev *dev);
+ * \endcode
+ * @details This API feeds the gyro bias tracker with a burst of FIFO samples. The device
+ * is still from a no-motion interrupt until an any-motion interrupt, see
+ * BMI3_INT_STATUS_NO_MOTION and BMI3_INT_STATUS_ANY_MOTION; samples are accumulated
+ * only while it is still, and the accumulation restarts on motion. Once min_samples
+ * samples are accumulated, their mean is the residual bias of the output data, and
+ * the data path offsets are corrected by it. Only the offset registers which change
+ * are written, in one write.
+ *
+ * @note The data path offset is added to the gyro data in steps of the
+ * 2000dps range and saturates at 10 bits. The no-motion and any-motion
+ * features have to be enabled and mapped, the samples have to be read
+ * at the range given to "bmi330_gyro_bias_init".
+ *
+ * @param[in]     int_status : Interrupt status, e.g. from bmi3_get_int1_status.
+ * @param[in]     gyro_data  : Gyro samples, e.g. from bmi3_extract_gyro.
+ * @param[in]     n_frames   : Number of samples.
+ * @param[in,out] bias       : Structure instance of bmi3_gyro_bias.
+ * @param[in]     dev        : Structure instance of bmi3_dev.
+ *
+ * @return Result of API execution status
+ *
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ *
+ */
+int8_t bmi330_gyro_bias_update(uint16_t int_status,
+                               const struct bmi3_fifo_sens_axes_data *gyro_data,
+                               uint16_t n_frames,
+                               struct bmi3_gyro_bias *bias,
+                               struct bmi3_dev *dev);
+
+/**
+ * \ingroup bmi330
+ * \defgroup bmi330ApiStepCadence StepCadence
+ * @brief Step cadence from the step counter interrupts
+ */
+
+/*!
+ * \ingroup bmi330ApiStepCadence
+ * \page bmi330_api_bmi330_step_cadence_init bmi330_step_cadence_init
+ * \code
+ * int8_t bmi330_step_cadence_init(uint16_t watermark_level, struct bmi3_step_cadence *cadence, struct bmi3_dev *dev);
+ * \endcode
+ * @details This API programs the water-mark level of the step counter, keeping the
+ * other step counter settings, and takes the current step count and sensor
+ * time as start of the cadence. The step counter interrupt then fires each
+ * watermark_level * 20 steps, so the host wakes on progress only instead of
+ * polling the step count.
+ *
+ * @note The step counter has to be enabled and its interrupt mapped with
+ * "step_counter_out" by the caller. The step detector interrupt gives an
+ * increment per step at the cost of a wake-up per step.
+ *
+ * @param[in]     watermark_level : Water-mark level of the step counter, up to
+ *                                  BMI3_STEP_WATERMARK_MASK.
+ * @param[out]    cadence         : Structure instance of bmi3_step_cadence.
+ * @param[in,out] dev             : Structure instance of bmi3_dev.
+ *
+ * @return Result of API execution status
+ *
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ * @retval BMI3_E_INVALID_INPUT -> Invalid water-mark level
+ *
+ */
+int8_t bmi330_step_cadence_init(uint16_t watermark_level, struct bmi3_step_cadence *cadence, struct bmi3_dev *dev);
+
+/*!
+ * \ingroup bmi330ApiStepCadence
+ * \page bmi330_api_bmi330_step_cadence_update bmi330_step_cadence_update
+ * \code
+ * int8_t bmi330_step_cadence_update(uint16_t int_status, struct bmi3_step_cadence *cadence, struct bmi3_dev *dev);
+ * \endcode
+ * @details This API updates the cadence on a step counter or step detector interrupt
+ * of the status given: the sensor time and the step count are read, and the
+ * steps of the increment and its time since the last one give the average
+ * step duration. An increment whose step duration exceeds
+ * BMI3_STEP_CADENCE_PAUSE_US ends the bout, the next one starts a new bout
+ * with fresh averages. A decrease of the step count, e.g. by a reset of the
+ * counter, restarts from the new count. Nothing is accessed if none of the
+ * step interrupts is set.
+ *
+ * @param[in]     int_status : Interrupt status of INT1 and INT2.
+ * @param[in,out] cadence    : Structure instance of bmi3_step_cadence.
+ * @param[in,out] dev        : Structure instance of bmi3_dev.
+ *
+ * @return Result of API execution status
+ *
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ *
+ */
+int8_t bmi330_step_cadence_update(uint16_t int_status, struct bmi3_step_cadence *cadence, struct bmi3_dev *dev);
+
 /**
  * \ingroup bmi330
  * \defgroup bmi330ApiUserOffset Perform user offset dgain
@@ -1505,124 +2711,3644 @@ int8_t bmi330_perform_accel_foc(const struct bmi3_accel_foc_g_value *accel_g_val
 
 /**
  * \ingroup bmi330
- * \defgroup bmi330ApiStatus Sensor Status
- * @brief Get sensor status
+ * \defgroup bmi330ApiOp Op
+ * @brief Resumable operations
  */
 
 /*!
- * \ingroup bmi330ApiStatus
- * \page bmi330_api_bmi330_get_sensor_status bmi330_get_sensor_status
+ * \ingroup bmi330ApiOp
+ * \page bmi330_api_bmi330_op_soft_reset bmi330_op_soft_reset
  * \code
- * int8_t bmi330_get_sensor_status(uint8_t *status, struct bmi3_dev *dev);
+ * int8_t bmi330_op_soft_reset(struct bmi3_op *op);
  * \endcode
- * @details This API gets the data ready status of power on reset, accelerometer, gyroscope,
- * and temperature
+ * @details This API prepares a resumable soft-reset, which runs the steps of "bmi330_soft_reset"
+ * on each call of "bmi330_op_step" and yields on each delay, so that a cooperative
+ * scheduler runs other tasks while the sensor boots.
  *
- * @param[out] status     : Pointer variable to the status.
- * @param[in]  dev        : Structure instance of bmi3_dev.
+ * @note The operation is not run in a batch of bus operations of "batch_begin" and
+ * "batch_end", since the delays are waited by the caller.
  *
- *@verbatim
- * Value    |  Status
- * ---------|---------------------
- * 0x01     |  BMI3_STATUS_POR
- * 0x20     |  BMI3_STATUS_DRDY_TEMP
- * 0x40     |  BMI3_STATUS_DRDY_GYR
- * 0x80     |  BMI3_STATUS_DRDY_ACC
- *@endverbatim
+ * @param[out] op : Structure instance of bmi3_op.
  *
- *  @return Result of API execution status
+ * @return Result of API execution status
+ *
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
  *
- *  @retval 0 -> Success
- *  @retval < 0 -> Fail
  */
-int8_t bmi330_get_sensor_status(uint16_t *status, struct bmi3_dev *dev);
+int8_t bmi330_op_soft_reset(struct bmi3_op *op);
 
 /*!
- * \ingroup bmi330ApiInt
- * \page bmi330_api_bmi330_get_i3c_ibi_status bmi330_get_i3c_ibi_status
+ * \ingroup bmi330ApiOp
+ * \page bmi330_api_bmi330_op_self_test bmi330_op_self_test
  * \code
- * int8_t bmi330_get_i3c_ibi_status(uint16_t *int_status, struct bmi3_dev *dev);
+ * int8_t bmi330_op_self_test(uint8_t st_selection, struct bmi3_st_result *st_result_status, struct bmi3_op *op);
  * \endcode
- * @details This API gets the i3c ibi status of both feature and data
- * interrupts.
+ * @details This API prepares a resumable self-test, which runs "bmi330_self_test_start",
+ * "bmi330_self_test_poll" and "bmi330_self_test_finish" on the calls of "bmi330_op_step"
+ * and yields for BMI3_ST_DELAY between the polls.
  *
- * @param[out] int_status    : Pointer to get the status of the interrupts.
- * @param[in]  dev           : Structure instance of bmi3_dev.
+ * @param[in]  st_selection     : Self-test selection: BMI3_ST_ACCEL_ONLY,
+ *                                BMI3_ST_GYRO_ONLY or BMI3_ST_BOTH_ACC_GYR.
+ * @param[out] st_result_status : Structure instance of bmi3_st_result,
+ *                                updated once the operation is complete.
+ * @param[out] op               : Structure instance of bmi3_op.
  *
- *@verbatim
- * int_status   |  Status
- * -------------|------------
- * 0x0001       |  BMI3_IBI_STATUS_NO_MOTION
- * 0x0002       |  BMI3_IBI_STATUS_ANY_MOTION
- * 0x0004       |  BMI3_IBI_STATUS_FLAT
- * 0x0008       |  BMI3_IBI_STATUS_ORIENTATION
- * 0x0010       |  BMI3_IBI_STATUS_STEP_DETECTOR
- * 0x0020       |  BMI3_IBI_STATUS_STEP_COUNTER
- * 0x0040       |  BMI3_IBI_STATUS_SIG_MOTION
- * 0x0080       |  BMI3_IBI_STATUS_TILT
- * 0x0100       |  BMI3_IBI_STATUS_TAP
- * 0x0200       |  BMI3_IBI_STATUS_I3C
- * 0x0400       |  BMI3_IBI_STATUS_ERR_STATUS
- * 0x0800       |  BMI3_IBI_STATUS_TEMP_DRDY
- * 0x1000       |  BMI3_IBI_STATUS_GYR_DRDY
- * 0x2000       |  BMI3_IBI_STATUS_ACC_DRDY
- * 0x4000       |  BMI3_IBI_STATUS_FWM
- * 0x8000       |  BMI3_IBI_FFULL
- *@endverbatim
+ * @return Result of API execution status
  *
- *  @return Result of API execution status
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
  *
- *  @retval 0 -> Success
- *  @retval < 0 -> Fail
  */
-int8_t bmi330_get_i3c_ibi_status(uint16_t *int_status, struct bmi3_dev *dev);
+int8_t bmi330_op_self_test(uint8_t st_selection, struct bmi3_st_result *st_result_status, struct bmi3_op *op);
 
-/**
- * \ingroup bmi330
- * \defgroup bmi330AccGyrUsrGainOff Accel and gyro user gain and offset
- * @brief Accel and gyro user gain and offset
+/*!
+ * \ingroup bmi330ApiOp
+ * \page bmi330_api_bmi330_op_gyro_sc bmi330_op_gyro_sc
+ * \code
+ * int8_t bmi330_op_gyro_sc(uint8_t sc_selection,
+ *                          uint8_t apply_corr,
+ *                          struct bmi3_self_calib_rslt *sc_rslt,
+ *                          struct bmi3_op *op);
+ * \endcode
+ * @details This API prepares a resumable gyro self-calibration, which runs "bmi330_gyro_sc_start",
+ * "bmi330_gyro_sc_poll" and "bmi330_gyro_sc_finish" on the calls of "bmi330_op_step" and
+ * yields for BMI3_SC_DELAY between the polls.
+ *
+ * @param[in]  sc_selection : Self-calibration selection.
+ * @param[in]  apply_corr   : Apply the correction: BMI3_ENABLE or BMI3_DISABLE.
+ * @param[out] sc_rslt      : Structure instance of bmi3_self_calib_rslt,
+ *                            updated once the operation is complete.
+ * @param[out] op           : Structure instance of bmi3_op.
+ *
+ * @return Result of API execution status
+ *
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ *
  */
+int8_t bmi330_op_gyro_sc(uint8_t sc_selection,
+                         uint8_t apply_corr,
+                         struct bmi3_self_calib_rslt *sc_rslt,
+                         struct bmi3_op *op);
 
 /*!
- * \ingroup bmi330AccGyrUsrGainOff
- * \page bmi330_api_bmi330_get_acc_gyr_off_gain_reset bmi330_get_acc_gyr_off_gain_reset
+ * \ingroup bmi330ApiOp
+ * \page bmi330_api_bmi330_op_upload_config_array bmi330_op_upload_config_array
  * \code
- * int8_t bmi330_get_acc_gyr_off_gain_reset(uint8_t *acc_off_gain_reset, uint8_t *gyr_off_gain_reset, struct bmi3_dev *dev);
+ * int8_t bmi330_op_upload_config_array(const uint8_t *config_array, uint16_t config_size, struct bmi3_op *op);
  * \endcode
- * @details This API gets accel gyro offset gain reset values.
+ * @details This API prepares a resumable upload of a config array, which writes one burst
+ * of "bmi330_upload_config_array" on each call of "bmi330_op_step" and yields in between,
+ * so that the bus is given to other users during the upload.
  *
- * @param[out] acc_off_gain_reset     : Pointer variable to store accel offset gain reset value.
- * @param[out] gyr_off_gain_reset     : Pointer variable to store gyro offset gain reset value.
- * @param[in]  dev                    : Structure instance of bmi3_dev.
+ * @param[in]  config_array : Config array, to outlive the operation.
+ * @param[in]  config_size  : Size of the config array.
+ * @param[out] op           : Structure instance of bmi3_op.
  *
+ * @return Result of API execution status
  *
- *  @return Result of API execution status
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
  *
- *  @retval 0 -> Success
- *  @retval < 0 -> Fail
  */
-int8_t bmi330_get_acc_gyr_off_gain_reset(uint8_t *acc_off_gain_reset, uint8_t *gyr_off_gain_reset,
-                                         struct bmi3_dev *dev);
+int8_t bmi330_op_upload_config_array(const uint8_t *config_array, uint16_t config_size, struct bmi3_op *op);
 
 /*!
- * \ingroup bmi330AccGyrUsrGainOff
- * \page bmi330_api_bmi330_set_acc_gyr_off_gain_reset bmi330_set_acc_gyr_off_gain_reset
+ * \ingroup bmi330ApiOp
+ * \page bmi330_api_bmi330_op_accel_foc bmi330_op_accel_foc
  * \code
- * int8_t bmi330_set_acc_gyr_off_gain_reset(uint8_t acc_off_gain_reset, uint8_t gyr_off_gain_reset, struct bmi3_dev *dev);
+ * int8_t bmi330_op_accel_foc(const struct bmi3_accel_foc_g_value *accel_g_value, struct bmi3_op *op);
  * \endcode
- * @details This API sets accel gyro offset gain reset values.
+ * @details This API prepares a resumable accel FOC, which verifies the position and
+ * computes the offset as "bmi330_perform_accel_foc" from BMI3_FOC_SAMPLE_LIMIT samples
+ * each, polling the data ready status once on each call of "bmi330_op_step" and
+ * yielding for BMI3_OP_FOC_DELAY in between.
  *
- * @param[out] acc_off_gain_reset     : Variable to store accel offset gain reset value.
- * @param[out] gyr_off_gain_reset     : Variable to store gyro offset gain reset value.
- * @param[in]  dev                    : Structure instance of bmi3_dev.
+ * @param[in]  accel_g_value : Accel axis and sign of the gravity,
+ *                             to outlive the operation.
+ * @param[out] op            : Structure instance of bmi3_op.
  *
+ * @return Result of API execution status
  *
- *  @return Result of API execution status
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
  *
- *  @retval 0 -> Success
- *  @retval < 0 -> Fail
  */
-int8_t bmi330_set_acc_gyr_off_gain_reset(uint8_t acc_off_gain_reset, uint8_t gyr_off_gain_reset, struct bmi3_dev *dev);
+int8_t bmi330_op_accel_foc(const struct bmi3_accel_foc_g_value *accel_g_value, struct bmi3_op *op);
+
+/*!
+ * \ingroup bmi330ApiOp
+ * \page bmi330_api_bmi330_op_step bmi330_op_step
+ * \code
+ * int8_t bmi330_op_step(struct bmi3_op *op, struct bmi3_dev *dev);
+ * \endcode
+ * @details This API runs the next step of a resumable operation prepared by "bmi330_op_soft_reset",
+ * "bmi330_op_self_test", "bmi330_op_gyro_sc", "bmi330_op_upload_config_array" or
+ * "bmi330_op_accel_foc". A step does not wait: while the operation continues,
+ * BMI3_W_OP_PENDING is returned along with the time in "wait_us" of the operation
+ * to pass before the next step, so that data acquisition is interleaved with the
+ * operation on the same core.
+ *
+ * @note The lock of the device is held for a step only. The configuration of the
+ * sensor must not be changed by other users while the operation is running.
+ *
+ * @param[in,out] op  : Structure instance of bmi3_op.
+ * @param[in,out] dev : Structure instance of bmi3_dev.
+ *
+ * @return Result of API execution status
+ *
+ * @retval 0 -> Success, the operation is complete
+ * @retval BMI3_W_OP_PENDING -> Operation continues after "wait_us" of the operation
+ * @retval < 0 -> Fail, the operation is aborted
+ *
+ */
+int8_t bmi330_op_step(struct bmi3_op *op, struct bmi3_dev *dev);
+
+/**
+ * \ingroup bmi330
+ * \defgroup bmi330ApiCalibLine CalibLine
+ * @brief Concurrent calibration of the devices of a group
+ */
+
+/*!
+ * \ingroup bmi330ApiCalibLine
+ * \page bmi330_api_bmi330_calib_line_init bmi330_calib_line_init
+ * \code
+ * int8_t bmi330_calib_line_init(const uint8_t *plan,
+ *                               uint8_t n_plan,
+ *                               const struct bmi3_accel_foc_g_value *accel_g_value,
+ *                               const struct bmi3_dev_group *group,
+ *                               struct bmi3_calib_line *line);
+ * \endcode
+ * @details This API initializes a calibration line, which runs a plan of self-test,
+ * gyro self-calibration and accel FOC on all devices of a group at once. The
+ * procedures are run as resumable operations of "bmi330_op_step", so that the bus
+ * transactions of one unit are done during the waits of the others, and the
+ * time of the line is the time of the slowest unit instead of the sum of all
+ * units. The selections of self-test and self-calibration may be changed in the
+ * line before the first call of "bmi330_calib_line_step".
+ *
+ * @note The devices of the group must not be used by other users while the line
+ * is running. Units sharing a bus are served one after the other by the same core.
+ *
+ * @param[in]  plan          : Procedures to be run in order on each unit:
+ *                             BMI3_OP_SOFT_RESET, BMI3_OP_SELF_TEST, BMI3_OP_GYRO_SC
+ *                             or BMI3_OP_ACCEL_FOC.
+ * @param[in]  n_plan        : Number of procedures, up to BMI3_CALIB_PLAN_MAX.
+ * @param[in]  accel_g_value : Accel axis and sign of the gravity, to outlive
+ *                             the line. May be NULL without BMI3_OP_ACCEL_FOC.
+ * @param[in]  group         : Structure instance of bmi3_dev_group, of which
+ *                             each device is a unit of the line.
+ * @param[out] line          : Structure instance of bmi3_calib_line.
+ *
+ * @return Result of API execution status
+ *
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ *
+ */
+int8_t bmi330_calib_line_init(const uint8_t *plan,
+                              uint8_t n_plan,
+                              const struct bmi3_accel_foc_g_value *accel_g_value,
+                              const struct bmi3_dev_group *group,
+                              struct bmi3_calib_line *line);
+
+/*!
+ * \ingroup bmi330ApiCalibLine
+ * \page bmi330_api_bmi330_calib_line_step bmi330_calib_line_step
+ * \code
+ * int8_t bmi330_calib_line_step(uint32_t elapsed_us, uint32_t *wait_us, struct bmi3_calib_line *line);
+ * \endcode
+ * @details This API runs the next step of each unit of which the wait has passed.
+ * Once the plan of a unit is complete, its calibration state is read into the
+ * blob of the unit, to be stored by the station and restored by
+ * "bmi330_set_calib_blob". A failed procedure aborts the plan of its unit only,
+ * the other units go on.
+ *
+ * @param[in]     elapsed_us : Time in microseconds passed since the previous call.
+ * @param[out]    wait_us    : Time in microseconds to pass before the next call.
+ * @param[in,out] line       : Structure instance of bmi3_calib_line.
+ *
+ * @return Result of API execution status
+ *
+ * @retval 0 -> Success, the plans of all units are complete, see "rslt" of each unit
+ * @retval BMI3_W_OP_PENDING -> Units are running, call again after "wait_us"
+ * @retval < 0 -> Fail
+ *
+ */
+int8_t bmi330_calib_line_step(uint32_t elapsed_us, uint32_t *wait_us, struct bmi3_calib_line *line);
+
+/*!
+ * \ingroup bmi330ApiCalibLine
+ * \page bmi330_api_bmi330_calib_line_run bmi330_calib_line_run
+ * \code
+ * int8_t bmi330_calib_line_run(struct bmi3_calib_line *line);
+ * \endcode
+ * @details This API runs a calibration line until the plans of all units are
+ * complete, waiting in between with the delay function of the first device.
+ *
+ * @param[in,out] line : Structure instance of bmi3_calib_line.
+ *
+ * @return Result of API execution status
+ *
+ * @retval 0 -> Success, the plans of all units are complete, see "rslt" of each unit
+ * @retval < 0 -> Fail
+ *
+ */
+int8_t bmi330_calib_line_run(struct bmi3_calib_line *line);
+
+/**
+ * \ingroup bmi330
+ * \defgroup bmi330ApiBringUp BringUp
+ * @brief Concurrent start-up of several sensors
+ */
+
+/*!
+ * \ingroup bmi330ApiBringUp
+ * \page bmi330_api_bmi330_bring_up_init bmi330_bring_up_init
+ * \code
+ * int8_t bmi330_bring_up_init(const struct bmi3_variant *const *variants,
+ *                             uint8_t n_variants,
+ *                             const struct bmi3_reg_image *image,
+ *                             struct bmi3_dev * const *dev,
+ *                             uint8_t n_dev,
+ *                             struct bmi3_bring_up *bring_up);
+ * \endcode
+ * @details This API initializes a bring-up, which starts several sensors at once
+ * instead of one bmi330_init after the other. Each device is probed by reading its
+ * chip-id, the soft-resets of the sensors found are issued back-to-back, the
+ * feature engine of all sensors is polled in one loop, and each sensor is then set
+ * up as by "bmi3_probe_and_init" and configured with the register image in one
+ * batch. The start-up time is about the time of a single sensor, whatever the
+ * number of sensors.
+ *
+ * @note The devices must not be used by other users while the bring-up is
+ * running. A device of which "warm_start" of the boot configuration is enabled is
+ * not soft-reset if the sensor kept its state, as with bmi330_init.
+ *
+ * @param[in]  variants   : Array of pointers to the variants of the sensors which
+ *                          may be mounted, to outlive the bring-up.
+ * @param[in]  n_variants : Number of variants.
+ * @param[in]  image      : Register image written to each sensor found, to outlive
+ *                          the bring-up. NULL to keep the configuration.
+ * @param[in]  dev        : Array of pointers to the devices, one per I2C address or
+ *                          chip-select where a sensor may be mounted, with the
+ *                          interface set up.
+ * @param[in]  n_dev      : Number of devices, up to BMI3_GROUP_MAX_DEV.
+ * @param[out] bring_up   : Structure instance of bmi3_bring_up.
+ *
+ * @return Result of API execution status
+ *
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ *
+ */
+int8_t bmi330_bring_up_init(const struct bmi3_variant *const *variants,
+                            uint8_t n_variants,
+                            const struct bmi3_reg_image *image,
+                            struct bmi3_dev * const *dev,
+                            uint8_t n_dev,
+                            struct bmi3_bring_up *bring_up);
+
+/*!
+ * \ingroup bmi330ApiBringUp
+ * \page bmi330_api_bmi330_bring_up_step bmi330_bring_up_step
+ * \code
+ * int8_t bmi330_bring_up_step(uint32_t elapsed_us, uint32_t *wait_us, struct bmi3_bring_up *bring_up);
+ * \endcode
+ * @details This API runs the next stage of each unit of which the wait has passed.
+ * A unit which fails, e.g. as no sensor answered with a known chip-id, is left
+ * behind, the other units go on.
+ *
+ * @param[in]     elapsed_us : Time in microseconds passed since the previous call.
+ * @param[out]    wait_us    : Time in microseconds to pass before the next call.
+ * @param[in,out] bring_up   : Structure instance of bmi3_bring_up.
+ *
+ * @return Result of API execution status
+ *
+ * @retval 0 -> Success, all units are complete, see "rslt" of each unit and "n_ready"
+ * @retval BMI3_W_OP_PENDING -> Units are running, call again after "wait_us"
+ * @retval < 0 -> Fail
+ *
+ */
+int8_t bmi330_bring_up_step(uint32_t elapsed_us, uint32_t *wait_us, struct bmi3_bring_up *bring_up);
+
+/*!
+ * \ingroup bmi330ApiBringUp
+ * \page bmi330_api_bmi330_bring_up_run bmi330_bring_up_run
+ * \code
+ * int8_t bmi330_bring_up_run(struct bmi3_bring_up *bring_up);
+ * \endcode
+ * @details This API runs a bring-up until all units are complete, waiting in
+ * between with the delay function of the first device.
+ *
+ * @param[in,out] bring_up : Structure instance of bmi3_bring_up.
+ *
+ * @return Result of API execution status
+ *
+ * @retval 0 -> Success, all units are complete, see "rslt" of each unit and "n_ready"
+ * @retval < 0 -> Fail
+ *
+ */
+int8_t bmi330_bring_up_run(struct bmi3_bring_up *bring_up);
+
+/*!
+ * \ingroup bmi330ApiFOC
+ * \page bmi330_api_bmi330_perform_accel_foc_fifo bmi330_perform_accel_foc_fifo
+ * \code
+ * int8_t bmi330_perform_accel_foc_fifo(const struct bmi3_accel_foc_g_value *accel_g_value,
+ *                                      const struct bmi3_accel_foc_fifo_cfg *foc_cfg,
+ *                                      struct bmi3_dev *dev);
+ * \endcode
+ * @details This API performs Fast Offset Compensation for accelerometer from the
+ * FIFO. The accel output data rate is set as per "foc_cfg", the FIFO stores
+ * accel-only frames and, after a single wait for "sample_count" samples, the
+ * frames are read in bursts of BMI3_FOC_FIFO_CHUNK_FRAMES frames and averaged.
+ * The same average is used to verify the position and to compute the offset.
+ *
+ * @note The accel configuration, the FIFO configuration and the FIFO content
+ * are restored and flushed respectively at the end, also if FOC fails. The
+ * axes correction of "dev->acc_corr" is not applied to the averaged data.
+ *
+ * @param[in]     accel_g_value  : Accel FOC axis and sign, as of
+ *                                 "bmi330_perform_accel_foc".
+ * @param[in]     foc_cfg        : Output data rate and number of samples of FOC.
+ * @param[in,out] dev            : Structure instance of bmi3_dev.
+ *
+ * @return Result of API execution status
+ *
+ * @retval 0 -> Success
+ * @retval BMI3_E_DATA_RDY_INT_FAILED -> The FIFO did not fill in time
+ * @retval < 0 -> Fail
+ *
+ */
+int8_t bmi330_perform_accel_foc_fifo(const struct bmi3_accel_foc_g_value *accel_g_value,
+                                     const struct bmi3_accel_foc_fifo_cfg *foc_cfg,
+                                     struct bmi3_dev *dev);
+
+/**
+ * \ingroup bmi330
+ * \defgroup bmi330ApiStatus Sensor Status
+ * @brief Get sensor status
+ */
+
+/*!
+ * \ingroup bmi330ApiStatus
+ * \page bmi330_api_bmi330_get_sensor_status bmi330_get_sensor_status
+ * \code
+ * int8_t bmi330_get_sensor_status(uint8_t *status, struct bmi3_dev *dev);
+ * \endcode
+ * @details This API gets the data ready status of power on reset, accelerometer, gyroscope,
+ * and temperature
+ *
+ * @param[out] status     : Pointer variable to the status.
+ * @param[in]  dev        : Structure instance of bmi3_dev.
+ *
+ *@verbatim
+ * Value    |  Status
+ * ---------|---------------------
+ * 0x01     |  BMI3_STATUS_POR
+ * 0x20     |  BMI3_STATUS_DRDY_TEMP
+ * 0x40     |  BMI3_STATUS_DRDY_GYR
+ * 0x80     |  BMI3_STATUS_DRDY_ACC
+ *@endverbatim
+ *
+ *  @return Result of API execution status
+ *
+ *  @retval 0 -> Success
+ *  @retval < 0 -> Fail
+ */
+int8_t bmi330_get_sensor_status(uint16_t *status, struct bmi3_dev *dev);
+
+/*!
+ * \ingroup bmi330ApiInt
+ * \page bmi330_api_bmi330_get_i3c_ibi_status bmi330_get_i3c_ibi_status
+ * \code
+ * int8_t bmi330_get_i3c_ibi_status(uint16_t *int_status, struct bmi3_dev *dev);
+ * \endcode
+ * @details This API gets the i3c ibi status of both feature and data
+ * interrupts.
+ *
+ * @param[out] int_status    : Pointer to get the status of the interrupts.
+ * @param[in]  dev           : Structure instance of bmi3_dev.
+ *
+ *@verbatim
+ * int_status   |  Status
+ * -------------|------------
+ * 0x0001       |  BMI3_IBI_STATUS_NO_MOTION
+ * 0x0002       |  BMI3_IBI_STATUS_ANY_MOTION
+ * 0x0004       |  BMI3_IBI_STATUS_FLAT
+ * 0x0008       |  BMI3_IBI_STATUS_ORIENTATION
+ * 0x0010       |  BMI3_IBI_STATUS_STEP_DETECTOR
+ * 0x0020       |  BMI3_IBI_STATUS_STEP_COUNTER
+ * 0x0040       |  BMI3_IBI_STATUS_SIG_MOTION
+ * 0x0080       |  BMI3_IBI_STATUS_TILT
+ * 0x0100       |  BMI3_IBI_STATUS_TAP
+ * 0x0200       |  BMI3_IBI_STATUS_I3C
+ * 0x0400       |  BMI3_IBI_STATUS_ERR_STATUS
+ * 0x0800       |  BMI3_IBI_STATUS_TEMP_DRDY
+ * 0x1000       |  BMI3_IBI_STATUS_GYR_DRDY
+ * 0x2000       |  BMI3_IBI_STATUS_ACC_DRDY
+ * 0x4000       |  BMI3_IBI_STATUS_FWM
+ * 0x8000       |  BMI3_IBI_FFULL
+ *@endverbatim
+ *
+ *  @return Result of API execution status
+ *
+ *  @retval 0 -> Success
+ *  @retval < 0 -> Fail
+ */
+int8_t bmi330_get_i3c_ibi_status(uint16_t *int_status, struct bmi3_dev *dev);
+
+/**
+ * \ingroup bmi330
+ * \defgroup bmi330AccGyrUsrGainOff Accel and gyro user gain and offset
+ * @brief Accel and gyro user gain and offset
+ */
+
+/*!
+ * \ingroup bmi330AccGyrUsrGainOff
+ * \page bmi330_api_bmi330_get_acc_gyr_off_gain_reset bmi330_get_acc_gyr_off_gain_reset
+ * \code
+ * int8_t bmi330_get_acc_gyr_off_gain_reset(uint8_t *acc_off_gain_reset, uint8_t *gyr_off_gain_reset, struct bmi3_dev *dev);
+ * \endcode
+ * @details This API gets accel gyro offset gain reset values.
+ *
+ * @param[out] acc_off_gain_reset     : Pointer variable to store accel offset gain reset value.
+ * @param[out] gyr_off_gain_reset     : Pointer variable to store gyro offset gain reset value.
+ * @param[in]  dev                    : Structure instance of bmi3_dev.
+ *
+ *
+ *  @return Result of API execution status
+ *
+ *  @retval 0 -> Success
+ *  @retval < 0 -> Fail
+ */
+int8_t bmi330_get_acc_gyr_off_gain_reset(uint8_t *acc_off_gain_reset, uint8_t *gyr_off_gain_reset,
+                                         struct bmi3_dev *dev);
+
+/*!
+ * \ingroup bmi330AccGyrUsrGainOff
+ * \page bmi330_api_bmi330_set_acc_gyr_off_gain_reset bmi330_set_acc_gyr_off_gain_reset
+ * \code
+ * int8_t bmi330_set_acc_gyr_off_gain_reset(uint8_t acc_off_gain_reset, uint8_t gyr_off_gain_reset, struct bmi3_dev *dev);
+ * \endcode
+ * @details This API sets accel gyro offset gain reset values.
+ *
+ * @param[out] acc_off_gain_reset     : Variable to store accel offset gain reset value.
+ * @param[out] gyr_off_gain_reset     : Variable to store gyro offset gain reset value.
+ * @param[in]  dev                    : Structure instance of bmi3_dev.
+ *
+ *
+ *  @return Result of API execution status
+ *
+ *  @retval 0 -> Success
+ *  @retval < 0 -> Fail
+ */
+int8_t bmi330_set_acc_gyr_off_gain_reset(uint8_t acc_off_gain_reset, uint8_t gyr_off_gain_reset, struct bmi3_dev *dev);
+
+/**
+ * \ingroup bmi330
+ * \defgroup bmi330ApiCalibBlob CalibBlob
+ * @brief Calibration state snapshot and restore
+ */
+
+/*!
+ * \ingroup bmi330ApiCalibBlob
+ * \page bmi330_api_bmi330_get_calib_blob bmi330_get_calib_blob
+ * \code
+ * int8_t bmi330_get_calib_blob(struct bmi3_calib_blob *blob, struct bmi3_dev *dev);
+ * \endcode
+ * @details This API reads the calibration state of the device into an
+ * opaque blob: the accel and gyro dp offset and gain registers, the accel and gyro
+ * user offset and gain of the feature engine along with their reset word, and the
+ * axis remap. The blob is read with three bursts and protected by a CRC-16, so that
+ * the host can store it, e.g. in flash, and restore it by "bmi330_set_calib_blob"
+ * after each power cycle.
+ *
+ * @param[out] blob : Structure instance of bmi3_calib_blob.
+ * @param[in]  dev  : Structure instance of bmi3_dev.
+ *
+ * @return Result of API execution status
+ *
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ *
+ */
+int8_t bmi330_get_calib_blob(struct bmi3_calib_blob *blob, struct bmi3_dev *dev);
+
+/*!
+ * \ingroup bmi330ApiCalibBlob
+ * \page bmi330_api_bmi330_set_calib_blob bmi330_set_calib_blob
+ * \code
+ * int8_t bmi330_set_calib_blob(const struct bmi3_calib_blob *blob, struct bmi3_dev *dev);
+ * \endcode
+ * @details This API restores the calibration state of the device from a
+ * blob read by "bmi330_get_calib_blob". The dp registers and the feature engine words
+ * are written with one burst each, as one batch if batch functions are set. The
+ * axis remap update sequence is only run if the axis remap of the blob differs from
+ * the one of the sensor.
+ *
+ * @param[in]     blob : Structure instance of bmi3_calib_blob.
+ * @param[in,out] dev  : Structure instance of bmi3_dev.
+ *
+ * @return Result of API execution status
+ *
+ * @retval 0 -> Success
+ * @retval BMI3_E_CALIB_BLOB -> Version, chip-id or CRC of the blob do not match
+ * @retval < 0 -> Fail
+ *
+ */
+int8_t bmi330_set_calib_blob(const struct bmi3_calib_blob *blob, struct bmi3_dev *dev);
+
+/**
+ * \ingroup bmi330
+ * \defgroup bmi330ApiConfigImage ConfigImage
+ * @brief Capture and apply the complete sensor configuration
+ */
+
+/*!
+ * \ingroup bmi330ApiConfigImage
+ * \page bmi330_api_bmi330_get_config_image bmi330_get_config_image
+ * \code
+ * int8_t bmi330_get_config_image(struct bmi3_config_image *image, struct bmi3_dev *dev);
+ * \endcode
+ * @details This API captures the complete configuration of the device: the feature
+ * engine configuration words, the feature enable register, the accel, gyro
+ * and alternate configurations and the FIFO and interrupt configuration.
+ * The image is taken once, e.g. after the device is configured, and applied
+ * by bmi330_set_config_image after each power-up instead of repeating the
+ * individual configuration calls.
+ *
+ * @note Calibration is not part of the image, see bmi330_get_calib_blob.
+ *
+ * @param[out] image : Structure instance of bmi3_config_image.
+ * @param[in]  dev   : Structure instance of bmi3_dev.
+ *
+ * @return Result of API execution status
+ *
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ *
+ */
+int8_t bmi330_get_config_image(struct bmi3_config_image *image, struct bmi3_dev *dev);
+
+/*!
+ * \ingroup bmi330ApiConfigImage
+ * \page bmi330_api_bmi330_set_config_image bmi330_set_config_image
+ * \code
+ * int8_t bmi330_set_config_image(const struct bmi3_config_image *image, struct bmi3_dev *dev);
+ * \endcode
+ * @details This API applies a configuration image taken by bmi330_get_config_image.
+ * The feature engine words are written in bursts, followed by the axis remap
+ * update, the feature enable, the FIFO and interrupt configuration and the
+ * alternate configuration. The accel and gyro configurations are written
+ * last, as they enable the sensors. All writes are submitted as one batch
+ * if batch hooks are set.
+ *
+ * @note The image is meant to be applied after bmi330_init, with the sensors
+ * disabled, as the axis remap is only taken over while the accel is disabled.
+ *
+ * @param[in] image : Structure instance of bmi3_config_image.
+ * @param[in] dev   : Structure instance of bmi3_dev.
+ *
+ * @return Result of API execution status
+ *
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ *
+ */
+int8_t bmi330_set_config_image(const struct bmi3_config_image *image, struct bmi3_dev *dev);
+
+/**
+ * \ingroup bmi330
+ * \defgroup bmi330ApiConfigDiff ConfigDiff
+ * @brief Apply only the changes between two configurations
+ */
+
+/*!
+ * \ingroup bmi330ApiConfigDiff
+ * \page bmi330_api_bmi330_set_sensor_config_diff bmi330_set_sensor_config_diff
+ * \code
+ * int8_t bmi330_set_sensor_config_diff(const struct bmi3_sens_config *current,
+ *                                      struct bmi3_sens_config *target,
+ *                                      uint8_t n_sens,
+ *                                      struct bmi3_dev *dev);
+ * \endcode
+ * @details This API applies only the changes between the current and the target
+ * configurations, e.g. on a switch between use cases. The feature
+ * configurations are compared as feature engine words and only the words
+ * which differ are written, each run of words with one transfer. Accel, gyro
+ * and alternate configurations are written only if they differ. The feature
+ * engine words are written first, then the alternate configurations and last
+ * the accel and gyro configurations, as they enable the sensors. All writes
+ * are submitted as one batch if batch hooks are set.
+ *
+ * Without "current", the configurations on the sensor are read: the feature
+ * engine words of the target features with one transfer and the registers of
+ * the accel, gyro and alternate configurations, all of which are served by the
+ * shadow register cache if enabled.
+ *
+ * @note As for "bmi330_get_feature_image", the feature configurations are not
+ * checked against the accel configuration, which may change in the same call.
+ * The feature enable is not part of the configurations, see "bmi330_select_sensor".
+ *
+ * @param[in]     current : Configurations on the sensor, of the same types
+ *                          as "target", NULL to read them from the sensor.
+ * @param[in]     target  : Configurations to be applied.
+ * @param[in]     n_sens  : Number of configurations.
+ * @param[in,out] dev     : Structure instance of bmi3_dev.
+ *
+ * @return Result of API execution status
+ *
+ * @retval 0 -> Success
+ * @retval BMI3_E_INVALID_INPUT -> Types of "current" and "target" differ
+ * @retval < 0 -> Fail
+ *
+ */
+int8_t bmi330_set_sensor_config_diff(const struct bmi3_sens_config *current,
+                                     struct bmi3_sens_config *target,
+                                     uint8_t n_sens,
+                                     struct bmi3_dev *dev);
+
+/*!
+ * \ingroup bmi330ApiConfigImage
+ * \page bmi330_api_bmi330_set_reg_image bmi330_set_reg_image
+ * \code
+ * int8_t bmi330_set_reg_image(const struct bmi3_reg_image *image, struct bmi3_dev *dev);
+ * \endcode
+ * @details This API writes register values built at compile time by the
+ * BMI3_ACC_CONF_IMAGE, BMI3_GYR_CONF_IMAGE, BMI3_FIFO_CONF_IMAGE,
+ * BMI3_INT_MAP1_IMAGE and BMI3_INT_MAP2_IMAGE macros, which reject invalid
+ * combinations at compile time. The values are written as they are, without
+ * validation: the FIFO and interrupt configuration in one burst, followed by
+ * the accel and gyro configurations, which enable the sensors. All writes are
+ * submitted as one batch if batch hooks are set.
+ *
+ * @note With a fixed configuration, bmi330_init followed by this API is all that is
+ * needed to start the sensors, and the validation of bmi330_set_sensor_config
+ * is not linked in.
+ *
+ * @param[in] image : Structure instance of bmi3_reg_image.
+ * @param[in] dev   : Structure instance of bmi3_dev.
+ *
+ * @return Result of API execution status
+ *
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ *
+ */
+int8_t bmi330_set_reg_image(const struct bmi3_reg_image *image, struct bmi3_dev *dev);
+
+/**
+ * \ingroup bmi330
+ * \defgroup bmi330ApiAsync Async
+ * @brief Non-blocking data transfer
+ */
+
+/*!
+ * \ingroup bmi330ApiAsync
+ * \page bmi330_api_bmi330_async_read_fifo_data bmi330_async_read_fifo_data
+ * \code
+ * int8_t bmi330_async_read_fifo_data(struct bmi3_fifo_frame *fifo, bmi3_async_done_fptr_t done, struct bmi3_dev *dev);
+ * \endcode
+ * @details This API starts a non-blocking read of the FIFO data using the "read_async"
+ * function pointer of bmi3_dev. The FIFO configuration is read first and the FIFO
+ * data of fifo->length bytes is read into fifo->data on its completion, so that
+ * the data can be parsed from the completion function.
+ *
+ * @note "bmi330_async_complete" has to be called by the platform on completion of each
+ * transfer, e.g. from the DMA-complete interrupt.
+ *
+ * @param[in,out] fifo : Structure instance of bmi3_fifo_frame.
+ * @param[in]     done : Function called once the request is complete,
+ *                       can be NULL.
+ * @param[in,out] dev  : Structure instance of bmi3_dev.
+ *
+ * @return Result of API execution status
+ *
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ *
+ */
+int8_t bmi330_async_read_fifo_data(struct bmi3_fifo_frame *fifo, bmi3_async_done_fptr_t done, struct bmi3_dev *dev);
+
+/*!
+ * \ingroup bmi330ApiAsync
+ * \page bmi330_api_bmi330_async_get_sensor_data bmi330_async_get_sensor_data
+ * \code
+ * int8_t bmi330_async_get_sensor_data(struct bmi3_sensor_data *sensor_data,
+ *                                     uint8_t n_sens,
+ *                                     bmi3_async_done_fptr_t done,
+ *                                     struct bmi3_dev *dev);
+ * \endcode
+ * @details This API starts a non-blocking read of the accelerometer, gyro and temperature
+ * data along with the sensor time using the "read_async" function pointer of
+ * bmi3_dev. The data is parsed into "sensor_data" before the completion function
+ * is called.
+ *
+ * @param[in,out] sensor_data : Structure instance of bmi3_sensor_data.
+ *                              Only BMI3_ACCEL, BMI3_GYRO and BMI3_TEMP
+ *                              types are supported.
+ * @param[in]     n_sens      : Number of sensors selected.
+ * @param[in]     done        : Function called once the request is complete,
+ *                              can be NULL.
+ * @param[in,out] dev         : Structure instance of bmi3_dev.
+ *
+ * @return Result of API execution status
+ *
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ *
+ */
+int8_t bmi330_async_get_sensor_data(struct bmi3_sensor_data *sensor_data,
+                                    uint8_t n_sens,
+                                    bmi3_async_done_fptr_t done,
+                                    struct bmi3_dev *dev);
+
+/*!
+ * \ingroup bmi330ApiAsync
+ * \page bmi330_api_bmi330_async_get_int_status bmi330_async_get_int_status
+ * \code
+ * int8_t bmi330_async_get_int_status(uint16_t *int1_status,
+ *                                    uint16_t *int2_status,
+ *                                    bmi3_async_done_fptr_t done,
+ *                                    struct bmi3_dev *dev);
+ * \endcode
+ * @details This API starts a non-blocking read of the INT1 and INT2 interrupt status
+ * registers using the "read_async" function pointer of bmi3_dev.
+ *
+ * @param[out]    int1_status : Interrupt status of INT1.
+ * @param[out]    int2_status : Interrupt status of INT2.
+ * @param[in]     done        : Function called once the request is complete,
+ *                              can be NULL.
+ * @param[in,out] dev         : Structure instance of bmi3_dev.
+ *
+ * @return Result of API execution status
+ *
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ *
+ */
+int8_t bmi330_async_get_int_status(uint16_t *int1_status,
+                                   uint16_t *int2_status,
+                                   bmi3_async_done_fptr_t done,
+                                   struct bmi3_dev *dev);
+
+/*!
+ * \ingroup bmi330ApiAsync
+ * \page bmi330_api_bmi330_async_complete bmi330_async_complete
+ * \code
+ * int8_t bmi330_async_complete(BMI3_INTF_RET_TYPE intf_rslt, struct bmi3_dev *dev);
+ * \endcode
+ * @details This API is called by the platform once the transfer started by the
+ * "read_async" function pointer is complete, e.g. from the DMA-complete interrupt.
+ * It parses the data, starts the next transfer of the request if any, or calls the
+ * completion function of the request.
+ *
+ * @param[in]     intf_rslt : Result of the completed transfer.
+ * @param[in,out] dev       : Structure instance of bmi3_dev.
+ *
+ * @return Result of API execution status
+ *
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ *
+ */
+int8_t bmi330_async_complete(BMI3_INTF_RET_TYPE intf_rslt, struct bmi3_dev *dev);
+
+/*!
+ * \ingroup bmi330ApiAsync
+ * \page bmi330_api_bmi330_async_fifo_service bmi330_async_fifo_service
+ * \code
+ * int8_t bmi330_async_fifo_service(uint16_t *int1_status,
+ *                                  uint16_t *int2_status,
+ *                                  struct bmi3_fifo_frame *fifo,
+ *                                  bmi3_async_done_fptr_t done,
+ *                                  struct bmi3_dev *dev);
+ * \endcode
+ * @details This API starts a non-blocking service of the FIFO interrupts, the
+ * asynchronous counterpart of "bmi330_fifo_service". The interrupt status and FIFO fill
+ * level are read in one transfer and, if a FIFO water-mark or full interrupt is
+ * pending, the set FIFO configuration and the available FIFO data limited by
+ * "length" of bmi3_fifo_frame.
+ *
+ * @note "available_fifo_len" of bmi3_fifo_frame is 0 if no FIFO interrupt is pending.
+ *
+ * @param[out]    int1_status : Interrupt status of INT1.
+ * @param[out]    int2_status : Interrupt status of INT2.
+ * @param[in,out] fifo        : Structure instance of bmi3_fifo_frame.
+ * @param[in]     done        : Function called once the request is complete. Can be NULL.
+ * @param[in]     dev         : Structure instance of bmi3_dev.
+ *
+ * @return Result of API execution status
+ *
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ *
+ */
+int8_t bmi330_async_fifo_service(uint16_t *int1_status,
+                                 uint16_t *int2_status,
+                                 struct bmi3_fifo_frame *fifo,
+                                 bmi3_async_done_fptr_t done,
+                                 struct bmi3_dev *dev);
+
+/**
+ * \ingroup bmi330
+ * \defgroup bmi330ApiRegCache RegCache
+ * @brief Shadow register cache
+ */
+
+/*!
+ * \ingroup bmi330ApiRegCache
+ * \page bmi330_api_bmi330_invalidate_reg_cache bmi330_invalidate_reg_cache
+ * \code
+ * int8_t bmi330_invalidate_reg_cache(struct bmi3_dev *dev);
+ * \endcode
+ * @details This API invalidates the shadow register cache, so that the following reads
+ * are served from the sensor. The cache is invalidated on any command, including
+ * soft-reset, by the driver itself. This API has to be called if the sensor lost its
+ * configuration otherwise, e.g. on a brown-out or a reset outside the driver, such
+ * as a reset pin or a soft-reset written with the write function directly. The
+ * feature engine image last written by "bmi330_set_feature_image" is forgotten as
+ * well, so that the next image, e.g. of a context switch, is written in full.
+ *
+ * @note The cache is enabled with "cache.enable" of bmi3_dev. Configuration registers
+ * and feature engine configuration words are then written through to the cache and
+ * read back from it without bus access.
+ *
+ * @param[in,out] dev : Structure instance of bmi3_dev.
+ *
+ * @return Result of API execution status
+ *
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ *
+ */
+int8_t bmi330_invalidate_reg_cache(struct bmi3_dev *dev);
+
+/**
+ * \ingroup bmi330
+ * \defgroup bmi330ApiRetryStats RetryStats
+ * @brief Retry policy of failed bus transfers
+ */
+
+/*!
+ * \ingroup bmi330ApiRetryStats
+ * \page bmi330_api_bmi330_get_retry_stats bmi330_get_retry_stats
+ * \code
+ * int8_t bmi330_get_retry_stats(struct bmi3_retry_stats *stats, const struct bmi3_dev *dev);
+ * \endcode
+ * @details This API gets a snapshot of the statistics of the retry policy set by "retry_cfg"
+ * of bmi3_dev. A failed transfer is retried up to "max_retries" times, after a
+ * backoff delay doubled on each retry, as per the register accessed:
+ * - Reads and writes of configuration and data registers are repeated as they are.
+ * - FIFO data reads are not repeated; the frames read completely by the failed
+ *   transfer are popped from the FIFO and lost. BMI3_E_COM_FAIL is returned and
+ *   the failure is counted in "fifo_lost", so that the caller can resynchronize,
+ *   e.g. with the loss accounting of "bmi330_fifo_loss_update".
+ * - Reads of the clear-on-read status registers are not repeated; the status
+ *   cleared by the failed transfer would be lost. BMI3_E_COM_FAIL is returned and
+ *   the failure is counted in "status_lost", so that the caller can recover the
+ *   state, e.g. by reading the FIFO fill level and the feature outputs.
+ * - Transfers of feature engine data are repeated after the transmission address
+ *   is restored, only if the register cache is enabled to track the address.
+ * - Commands are not repeated.
+ *
+ * @note Asynchronous transfers started with "read_async" are not retried.
+ *
+ * @param[out] stats : Structure instance of bmi3_retry_stats.
+ * @param[in]  dev   : Structure instance of bmi3_dev.
+ *
+ * @return Result of API execution status
+ *
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ *
+ */
+int8_t bmi330_get_retry_stats(struct bmi3_retry_stats *stats, const struct bmi3_dev *dev);
+
+/*!
+ * \ingroup bmi330ApiRetryStats
+ * \page bmi330_api_bmi330_reset_retry_stats bmi330_reset_retry_stats
+ * \code
+ * int8_t bmi330_reset_retry_stats(struct bmi3_dev *dev);
+ * \endcode
+ * @details This API resets the statistics of the retry policy.
+ *
+ * @param[in,out] dev : Structure instance of bmi3_dev.
+ *
+ * @return Result of API execution status
+ *
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ *
+ */
+int8_t bmi330_reset_retry_stats(struct bmi3_dev *dev);
+
+/**
+ * \ingroup bmi330
+ * \defgroup bmi330ApiFifoTime FifoTime
+ * @brief FIFO timestamp reconstruction
+ */
+
+/*!
+ * \ingroup bmi330ApiFifoTime
+ * \page bmi330_api_bmi330_fifo_time_init bmi330_fifo_time_init
+ * \code
+ * int8_t bmi330_fifo_time_init(struct bmi3_fifo_time *fifo_time, uint8_t odr, struct bmi3_dev *dev);
+ * \endcode
+ * @details This API initializes the FIFO timestamp reconstruction for the given ODR and
+ * anchors it to the 32-bit sensor time read by "bmi330_get_sensor_time".
+ *
+ * @param[in,out] fifo_time : Structure instance of bmi3_fifo_time.
+ * @param[in]     odr       : ODR of the FIFO samples, same values as
+ *                            BMI3_ACC_ODR_* and BMI3_GYR_ODR_*.
+ * @param[in]     dev       : Structure instance of bmi3_dev.
+ *
+ * @return Result of API execution status
+ *
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ *
+ */
+int8_t bmi330_fifo_time_init(struct bmi3_fifo_time *fifo_time, uint8_t odr, struct bmi3_dev *dev);
+
+/*!
+ * \ingroup bmi330ApiFifoTime
+ * \page bmi330_api_bmi330_fifo_time_anchor bmi330_fifo_time_anchor
+ * \code
+ * int8_t bmi330_fifo_time_anchor(struct bmi3_fifo_time *fifo_time, struct bmi3_dev *dev);
+ * \endcode
+ * @details This API anchors the FIFO timestamp reconstruction to the current sensor time.
+ * It has to be called right after reading the FIFO data if sensor time is not enabled
+ * in the FIFO and no sample time is known yet, e.g. after init, a FIFO flush or an
+ * overflow, since the last sample read is then assumed to be taken at the anchor.
+ *
+ * @param[in,out] fifo_time : Structure instance of bmi3_fifo_time.
+ * @param[in]     dev       : Structure instance of bmi3_dev.
+ *
+ * @return Result of API execution status
+ *
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ *
+ */
+int8_t bmi330_fifo_time_anchor(struct bmi3_fifo_time *fifo_time, struct bmi3_dev *dev);
+
+/*!
+ * \ingroup bmi330ApiFifoTime
+ * \page bmi330_api_bmi330_fifo_time_update bmi330_fifo_time_update
+ * \code
+ * int8_t bmi330_fifo_time_update(struct bmi3_fifo_time *fifo_time,
+ *                                const struct bmi3_fifo_frame *fifo,
+ *                                const struct bmi3_fifo_sens_axes_data *data,
+ *                                uint16_t count,
+ *                                uint64_t *timestamp);
+ * \endcode
+ * @details This API reconstructs the unwrapped sensor time of each extracted FIFO sample,
+ * keeping its state across reads. If sensor time is enabled in the FIFO, the 16-bit
+ * sensor time of the samples is unwrapped to a monotonic 64-bit counter. Otherwise
+ * the time is interpolated with the sample period of the ODR, which allows disabling
+ * sensor time in the FIFO to save FIFO bandwidth.
+ *
+ * @note Samples have to be of the ODR given to "bmi330_fifo_time_init" and no
+ * samples must be lost in between reads, else "bmi330_fifo_time_anchor" has to be
+ * called again.
+ *
+ * @param[in,out] fifo_time : Structure instance of bmi3_fifo_time.
+ * @param[in]     fifo      : Structure instance of bmi3_fifo_frame.
+ * @param[in]     data      : Extracted FIFO samples.
+ * @param[in]     count     : Number of extracted FIFO samples.
+ * @param[out]    timestamp : Unwrapped sensor time of each sample in
+ *                            ticks of BMI3_SENSORTIME_RESOLUTION.
+ *
+ * @return Result of API execution status
+ *
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ *
+ */
+int8_t bmi330_fifo_time_update(struct bmi3_fifo_time *fifo_time,
+                               const struct bmi3_fifo_frame *fifo,
+                               const struct bmi3_fifo_sens_axes_data *data,
+                               uint16_t count,
+                               uint64_t *timestamp);
+
+/**
+ * \ingroup bmi330
+ * \defgroup bmi330ApiFifoLoss FifoLoss
+ * @brief Accounting of the FIFO frames lost by overflows
+ */
+
+/*!
+ * \ingroup bmi330ApiFifoLoss
+ * \page bmi330_api_bmi330_fifo_loss_init bmi330_fifo_loss_init
+ * \code
+ * int8_t bmi330_fifo_loss_init(uint8_t odr, uint8_t flush_on_full, struct bmi3_fifo_loss *loss);
+ * \endcode
+ * @details This API initializes the accounting of the FIFO frames lost by
+ * overflows, either by a full FIFO which stops on full or by frames which are
+ * overwritten. No bus access is done.
+ *
+ * @param[in]  odr           : ODR of the FIFO frames, same values as
+ *                             BMI3_ACC_ODR_* and BMI3_GYR_ODR_*.
+ * @param[in]  flush_on_full : BMI3_ENABLE to flush the FIFO on FIFO full.
+ * @param[out] loss          : Structure instance of bmi3_fifo_loss.
+ *
+ * @return Result of API execution status
+ *
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ * @retval BMI3_E_INVALID_INPUT -> Invalid ODR
+ *
+ */
+int8_t bmi330_fifo_loss_init(uint8_t odr, uint8_t flush_on_full, struct bmi3_fifo_loss *loss);
+
+/*!
+ * \ingroup bmi330ApiFifoLoss
+ * \page bmi330_api_bmi330_fifo_loss_update bmi330_fifo_loss_update
+ * \code
+ * int8_t bmi330_fifo_loss_update(const struct bmi3_fifo_sens_axes_data *data,
+ *                                uint16_t n_frames,
+ *                                struct bmi3_fifo_loss *loss);
+ * \endcode
+ * @details This API counts the frames lost in front of each extracted frame
+ * from the discontinuities of its sensor time, across reads. A difference of
+ * more than one frame period, rounded to the period, is a gap. Frames lost
+ * while the FIFO is full or flushed are counted by the next frame read.
+ *
+ * @note Sensor time has to be enabled in the FIFO with BMI3_FIFO_TIME_EN. The
+ * 16-bit sensor time wraps after 65536 ticks of BMI3_SENSORTIME_RESOLUTION, a
+ * gap is counted modulo this time.
+ *
+ * @param[in]     data     : Extracted FIFO frames, in FIFO order.
+ * @param[in]     n_frames : Number of extracted FIFO frames.
+ * @param[in,out] loss     : Structure instance of bmi3_fifo_loss.
+ *
+ * @return Result of API execution status
+ *
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ * @retval BMI3_W_FIFO_GAP -> Frames were lost in front of the frames given
+ *
+ */
+int8_t bmi330_fifo_loss_update(const struct bmi3_fifo_sens_axes_data *data,
+                               uint16_t n_frames,
+                               struct bmi3_fifo_loss *loss);
+
+/*!
+ * \ingroup bmi330ApiFifoLoss
+ * \page bmi330_api_bmi330_fifo_loss_service bmi330_fifo_loss_service
+ * \code
+ * int8_t bmi330_fifo_loss_service(uint16_t int_status,
+ *                                 struct bmi3_fifo_stream *stream,
+ *                                 struct bmi3_fifo_loss *loss,
+ *                                 struct bmi3_dev *dev);
+ * \endcode
+ * @details This API counts a FIFO full interrupt of the status given. If
+ * "flush_on_full" is enabled, the FIFO is flushed with a single write, and the
+ * bytes of an incomplete frame of the stream are dropped, so the stream
+ * resumes at a frame boundary without a new configuration. To be called after
+ * the FIFO data is read; nothing is accessed if FIFO full is not set.
+ *
+ * @param[in]     int_status : Interrupt status of INT1 and INT2, e.g. given by
+ *                             "bmi330_fifo_service".
+ * @param[in,out] stream     : Structure instance of bmi3_fifo_stream, NULL if not used.
+ * @param[in,out] loss       : Structure instance of bmi3_fifo_loss.
+ * @param[in,out] dev        : Structure instance of bmi3_dev.
+ *
+ * @return Result of API execution status
+ *
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ *
+ */
+int8_t bmi330_fifo_loss_service(uint16_t int_status,
+                                struct bmi3_fifo_stream *stream,
+                                struct bmi3_fifo_loss *loss,
+                                struct bmi3_dev *dev);
+
+/**
+ * \ingroup bmi330
+ * \defgroup bmi330ApiFifoJitter FifoJitter
+ * @brief Effective ODR and jitter of the FIFO frames
+ */
+
+/*!
+ * \ingroup bmi330ApiFifoJitter
+ * \page bmi330_api_bmi330_fifo_jitter_init bmi330_fifo_jitter_init
+ * \code
+ * int8_t bmi330_fifo_jitter_init(uint8_t odr, struct bmi3_fifo_jitter *jitter);
+ * \endcode
+ * @details This API initializes the analysis of the intervals of the FIFO frames
+ * of one sensor. It is also to be called after each change of the ODR, the
+ * intervals of the former ODR are dropped. No bus access is done.
+ *
+ * @param[in]  odr    : ODR of the FIFO frames, same values as
+ *                      BMI3_ACC_ODR_* and BMI3_GYR_ODR_*.
+ * @param[out] jitter : Structure instance of bmi3_fifo_jitter.
+ *
+ * @return Result of API execution status
+ *
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ * @retval BMI3_E_INVALID_INPUT -> Invalid ODR
+ *
+ */
+int8_t bmi330_fifo_jitter_init(uint8_t odr, struct bmi3_fifo_jitter *jitter);
+
+/*!
+ * \ingroup bmi330ApiFifoJitter
+ * \page bmi330_api_bmi330_fifo_jitter_update bmi330_fifo_jitter_update
+ * \code
+ * int8_t bmi330_fifo_jitter_update(const struct bmi3_fifo_sens_axes_data *data,
+ *                                  uint16_t n_frames,
+ *                                  struct bmi3_fifo_jitter *jitter);
+ * \endcode
+ * @details This API adds the intervals of the sensor time of the frames given to
+ * the analysis, across reads, with a few integer operations per frame. An
+ * interval of more than one frame period, rounded to the period, is a gap and
+ * is only counted in the rate of the delivered frames; an interval of less than
+ * half a period is counted as short, e.g. after a switch to a faster alternate
+ * configuration. The other intervals update the running average and the jitter
+ * histogram.
+ *
+ * @note Sensor time has to be enabled in the FIFO with BMI3_FIFO_TIME_EN. The
+ * 16-bit sensor time wraps after 65536 ticks of BMI3_SENSORTIME_RESOLUTION, an
+ * interval is measured modulo this time.
+ *
+ * @param[in]     data     : Extracted FIFO frames of the sensor, in FIFO order.
+ * @param[in]     n_frames : Number of extracted FIFO frames.
+ * @param[in,out] jitter   : Structure instance of bmi3_fifo_jitter.
+ *
+ * @return Result of API execution status
+ *
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ * @retval BMI3_W_FIFO_GAP -> Frames were lost in front of the frames given
+ *
+ */
+int8_t bmi330_fifo_jitter_update(const struct bmi3_fifo_sens_axes_data *data,
+                                 uint16_t n_frames,
+                                 struct bmi3_fifo_jitter *jitter);
+
+/*!
+ * \ingroup bmi330ApiFifoJitter
+ * \page bmi330_api_bmi330_fifo_jitter_query bmi330_fifo_jitter_query
+ * \code
+ * int8_t bmi330_fifo_jitter_query(const struct bmi3_fifo_jitter *jitter, struct bmi3_fifo_jitter_report *report);
+ * \endcode
+ * @details This API derives the effective ODR, the rate of the delivered frames,
+ * the ODR error and the 99th percentile of the jitter from the analysis. The
+ * counters of frames, gaps and short intervals are read from "jitter". Rates
+ * are 0 while no interval is counted.
+ *
+ * @param[in]  jitter : Structure instance of bmi3_fifo_jitter.
+ * @param[out] report : Structure instance of bmi3_fifo_jitter_report.
+ *
+ * @return Result of API execution status
+ *
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ *
+ */
+int8_t bmi330_fifo_jitter_query(const struct bmi3_fifo_jitter *jitter, struct bmi3_fifo_jitter_report *report);
+
+/**
+ * \ingroup bmi330
+ * \defgroup bmi330ApiClockSync ClockSync
+ * @brief Synchronization of the sensor time to a host clock
+ */
+
+/*!
+ * \ingroup bmi330ApiClockSync
+ * \page bmi330_api_bmi330_clock_sync_init bmi330_clock_sync_init
+ * \code
+ * int8_t bmi330_clock_sync_init(uint32_t max_uncertainty_ns, struct bmi3_clock_sync *cs);
+ * \endcode
+ * @details This API initializes the synchronization of the sensor time to a host
+ * clock at the nominal rate of 39.0625 microseconds per tick.
+ *
+ * @param[in]  max_uncertainty_ns : Largest uncertainty in nanoseconds of an accepted
+ *                                  sample, 0 for no limit.
+ * @param[out] cs                 : Structure instance of bmi3_clock_sync.
+ *
+ * @return Result of API execution status
+ *
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ *
+ */
+int8_t bmi330_clock_sync_init(uint32_t max_uncertainty_ns, struct bmi3_clock_sync *cs);
+
+/*!
+ * \ingroup bmi330ApiClockSync
+ * \page bmi330_api_bmi330_clock_sync_add bmi330_clock_sync_add
+ * \code
+ * int8_t bmi330_clock_sync_add(uint32_t sensor_time,
+ *                              uint64_t host_ns,
+ *                              uint32_t uncertainty_ns,
+ *                              struct bmi3_clock_sync *cs);
+ * \endcode
+ * @details This API adds a (sensor time, host time) sample to the window of the
+ * synchronization and updates the estimate: the drift is the slope between the
+ * oldest and the newest sample, once they are BMI3_CLOCK_SYNC_MIN_SPAN ticks
+ * apart, and the offset is the mean of all samples of the window. Samples are
+ * typically piggy-backed on the FIFO reads, e.g. the sensor time of the last
+ * FIFO frame along with the host time of its data-ready or water-mark interrupt.
+ *
+ * @note The window restarts if the sensor time or the host time goes
+ * backwards, e.g. after a soft reset of the sensor.
+ *
+ * @param[in]     sensor_time    : Sensor time in ticks of 39.0625 microseconds.
+ * @param[in]     host_ns        : Host time in nanoseconds taken along with the sensor time.
+ * @param[in]     uncertainty_ns : Uncertainty of the host time in nanoseconds, e.g.
+ *                                 the duration of the sensor time read.
+ * @param[in,out] cs             : Structure instance of bmi3_clock_sync.
+ *
+ * @return Result of API execution status
+ *
+ * @retval 0 -> Success
+ * @retval BMI3_W_SAMPLE_REJECTED -> Uncertainty above "max_uncertainty_ns"
+ * @retval < 0 -> Fail
+ *
+ */
+int8_t bmi330_clock_sync_add(uint32_t sensor_time,
+                             uint64_t host_ns,
+                             uint32_t uncertainty_ns,
+                             struct bmi3_clock_sync *cs);
+
+/*!
+ * \ingroup bmi330ApiClockSync
+ * \page bmi330_api_bmi330_clock_sync_capture bmi330_clock_sync_capture
+ * \code
+ * int8_t bmi330_clock_sync_capture(bmi3_host_time_ns_fptr_t host_time_ns,
+ *                                  struct bmi3_clock_sync *cs,
+ *                                  struct bmi3_dev *dev);
+ * \endcode
+ * @details This API reads the sensor time and adds it to the synchronization along
+ * with the middle of the host times taken right before and after the read. The
+ * duration of the read is the uncertainty of the sample.
+ *
+ * @param[in]     host_time_ns : Host time function, called with the interface
+ *                               pointer right before and after the read.
+ * @param[in,out] cs           : Structure instance of bmi3_clock_sync.
+ * @param[in]     dev          : Structure instance of bmi3_dev.
+ *
+ * @return Result of API execution status
+ *
+ * @retval 0 -> Success
+ * @retval BMI3_W_SAMPLE_REJECTED -> Read took longer than "max_uncertainty_ns"
+ * @retval < 0 -> Fail
+ *
+ */
+int8_t bmi330_clock_sync_capture(bmi3_host_time_ns_fptr_t host_time_ns,
+                                 struct bmi3_clock_sync *cs,
+                                 struct bmi3_dev *dev);
+
+/*!
+ * \ingroup bmi330ApiClockSync
+ * \page bmi330_api_bmi330_clock_sync_to_host bmi330_clock_sync_to_host
+ * \code
+ * int8_t bmi330_clock_sync_to_host(const uint64_t *sensor_time,
+ *                                  uint16_t count,
+ *                                  uint64_t *host_ns,
+ *                                  const struct bmi3_clock_sync *cs);
+ * \endcode
+ * @details This API converts sensor times into host times with the estimate of the
+ * synchronization. Only the lower 32 bits of the sensor times are used, which
+ * are unwrapped against the last sample, hence sensor times have to be within
+ * 23 hours of the last sample.
+ *
+ * @param[in]  sensor_time : Sensor times in ticks of BMI3_SENSORTIME_RESOLUTION,
+ *                           e.g. the timestamps of "bmi330_fifo_time_update".
+ * @param[in]  count       : Number of sensor times.
+ * @param[out] host_ns     : Host times in nanoseconds, may be the array of the
+ *                           sensor times.
+ * @param[in]  cs          : Structure instance of bmi3_clock_sync.
+ *
+ * @return Result of API execution status
+ *
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail, BMI3_E_INVALID_STATUS if no sample is added yet
+ *
+ */
+int8_t bmi330_clock_sync_to_host(const uint64_t *sensor_time,
+                                 uint16_t count,
+                                 uint64_t *host_ns,
+                                 const struct bmi3_clock_sync *cs);
+
+/*!
+ * \ingroup bmi330ApiClockSync
+ * \page bmi330_api_bmi330_clock_sync_get_drift bmi330_clock_sync_get_drift
+ * \code
+ * int8_t bmi330_clock_sync_get_drift(const struct bmi3_clock_sync *cs, int32_t *drift_ppb);
+ * \endcode
+ * @details This API gets the drift of the estimate of the synchronization.
+ *
+ * @param[in]  cs        : Structure instance of bmi3_clock_sync.
+ * @param[out] drift_ppb : Drift of the sensor clock against the host clock in
+ *                         parts per billion, positive if the sensor clock is slow.
+ *
+ * @return Result of API execution status
+ *
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ *
+ */
+int8_t bmi330_clock_sync_get_drift(const struct bmi3_clock_sync *cs, int32_t *drift_ppb);
+
+/**
+ * \ingroup bmi330
+ * \defgroup bmi330ApiFifoStream FifoStream
+ * @brief Continuous FIFO stream
+ */
+
+/*!
+ * \ingroup bmi330ApiFifoStream
+ * \page bmi330_api_bmi330_fifo_stream_init bmi330_fifo_stream_init
+ * \code
+ * int8_t bmi330_fifo_stream_init(struct bmi3_fifo_stream *stream,
+ *                                uint8_t *buf,
+ *                                uint16_t size,
+ *                                uint16_t chunk,
+ *                                struct bmi3_dev *dev);
+ * \endcode
+ * @details This API initializes a continuous FIFO stream, which reads fixed size chunks of
+ * FIFO data without reading the FIFO fill level, and keeps the bytes of a frame split
+ * between two reads for the next read, so that no frame is lost. The FIFO
+ * configuration is read once, "bmi330_fifo_stream_init" has to be called again if it is
+ * changed.
+ *
+ * @param[in,out] stream : Structure instance of bmi3_fifo_stream.
+ * @param[in]     buf    : Buffer of the stream.
+ * @param[in]     size   : Size of the buffer in bytes, at least
+ *                         chunk + BMI3_MAX_DUMMY_BYTE.
+ * @param[in]     chunk  : Number of bytes to be read from FIFO at once.
+ * @param[in]     dev    : Structure instance of bmi3_dev.
+ *
+ * @return Result of API execution status
+ *
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ *
+ */
+int8_t bmi330_fifo_stream_init(struct bmi3_fifo_stream *stream,
+                               uint8_t *buf,
+                               uint16_t size,
+                               uint16_t chunk,
+                               struct bmi3_dev *dev);
+
+/*!
+ * \ingroup bmi330ApiFifoStream
+ * \page bmi330_api_bmi330_fifo_stream_read bmi330_fifo_stream_read
+ * \code
+ * int8_t bmi330_fifo_stream_read(struct bmi3_fifo_stream *stream, struct bmi3_dev *dev);
+ * \endcode
+ * @details This API reads a chunk of FIFO data into the stream, limited by the free space of
+ * the buffer, with a single read of the FIFO data register. Data following the last
+ * frame of the FIFO is discarded, detected by BMI3_FIFO_EMPTY_WORD at the start of a
+ * frame.
+ *
+ * @param[in,out] stream : Structure instance of bmi3_fifo_stream.
+ * @param[in]     dev    : Structure instance of bmi3_dev.
+ *
+ * @return Result of API execution status
+ *
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ *
+ */
+int8_t bmi330_fifo_stream_read(struct bmi3_fifo_stream *stream, struct bmi3_dev *dev);
+
+/*!
+ * \ingroup bmi330ApiFifoStream
+ * \page bmi330_api_bmi330_fifo_stream_extract bmi330_fifo_stream_extract
+ * \code
+ * int8_t bmi330_fifo_stream_extract(struct bmi3_fifo_sens_axes_data *accel_data,
+ *                                   struct bmi3_fifo_sens_axes_data *gyro_data,
+ *                                   struct bmi3_fifo_temperature_data *temp_data,
+ *                                   struct bmi3_fifo_frame *fifo,
+ *                                   struct bmi3_fifo_stream *stream,
+ *                                   const struct bmi3_dev *dev);
+ * \endcode
+ * @details This API extracts the complete frames of the stream as "bmi330_extract_all" does, and
+ * keeps the bytes of an incomplete frame for the next read. The arrays have to hold
+ * the frames of the stream buffer.
+ *
+ * @param[out]    accel_data : Accelerometer frames, can be NULL.
+ * @param[out]    gyro_data  : Gyro frames, can be NULL.
+ * @param[out]    temp_data  : Temperature frames, can be NULL.
+ * @param[out]    fifo       : Structure instance of bmi3_fifo_frame
+ *                             which stores the number of extracted frames.
+ * @param[in,out] stream     : Structure instance of bmi3_fifo_stream.
+ * @param[in]     dev        : Structure instance of bmi3_dev.
+ *
+ * @return Result of API execution status
+ *
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ *
+ */
+int8_t bmi330_fifo_stream_extract(struct bmi3_fifo_sens_axes_data *accel_data,
+                                  struct bmi3_fifo_sens_axes_data *gyro_data,
+                                  struct bmi3_fifo_temperature_data *temp_data,
+                                  struct bmi3_fifo_frame *fifo,
+                                  struct bmi3_fifo_stream *stream,
+                                  const struct bmi3_dev *dev);
+
+/**
+ * \ingroup bmi330
+ * \defgroup bmi330ApiSampleQueue SampleQueue
+ * @brief Lock-free single-producer, single-consumer queue of FIFO samples
+ */
+
+/*!
+ * \ingroup bmi330ApiSampleQueue
+ * \page bmi330_api_bmi330_sample_queue_init bmi330_sample_queue_init
+ * \code
+ * int8_t bmi330_sample_queue_init(struct bmi3_sample_queue *queue,
+ *                                 struct bmi3_fifo_sens_axes_data *slots,
+ *                                 uint16_t num_slots);
+ * \endcode
+ * @details This API initializes a lock-free single-producer, single-consumer queue of
+ * FIFO samples, e.g. between the FIFO water-mark interrupt parsing the FIFO data
+ * and a lower priority task processing the samples. The producer and the
+ * consumer each write their own index, on separate cache lines; slots are
+ * published in batches with one release store of the producer index, so neither
+ * side ever waits for the other.
+ *
+ * @note The queue is aligned to BMI3_CACHE_LINE_SIZE. For compilers other than GCC and Clang,
+ * BMI3_LOAD_ACQUIRE and BMI3_STORE_RELEASE have to be given in BMI3_CONFIG_FILE on
+ * multi-core targets or targets with a data cache.
+ *
+ * @param[out] queue     : Structure instance of bmi3_sample_queue.
+ * @param[in]  slots     : Slots of the queue.
+ * @param[in]  num_slots : Number of slots, a power of two.
+ *
+ * @return Result of API execution status
+ *
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ *
+ */
+int8_t bmi330_sample_queue_init(struct bmi3_sample_queue *queue,
+                                struct bmi3_fifo_sens_axes_data *slots,
+                                uint16_t num_slots);
+
+/*!
+ * \ingroup bmi330ApiSampleQueue
+ * \page bmi330_api_bmi330_sample_queue_reserve bmi330_sample_queue_reserve
+ * \code
+ * int8_t bmi330_sample_queue_reserve(struct bmi3_sample_queue *queue,
+ *                                    struct bmi3_fifo_sens_axes_data **slots,
+ *                                    uint16_t *count);
+ * \endcode
+ * @details This API gets the contiguous free slots of the queue, from the next slot to
+ * be written by the producer up to the end of the slot buffer at most. The index
+ * of the consumer is loaded only if the free slots known to the producer do not
+ * reach the end of the buffer. To be called by the producer only.
+ *
+ * @param[in,out] queue : Structure instance of bmi3_sample_queue.
+ * @param[out]    slots : First free slot.
+ * @param[out]    count : Number of contiguous free slots.
+ *
+ * @return Result of API execution status
+ *
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ *
+ */
+int8_t bmi330_sample_queue_reserve(struct bmi3_sample_queue *queue,
+                                   struct bmi3_fifo_sens_axes_data **slots,
+                                   uint16_t *count);
+
+/*!
+ * \ingroup bmi330ApiSampleQueue
+ * \page bmi330_api_bmi330_sample_queue_produce bmi330_sample_queue_produce
+ * \code
+ * int8_t bmi330_sample_queue_produce(struct bmi3_sample_queue *queue, uint16_t count);
+ * \endcode
+ * @details This API marks the given number of reserved slots as written. The slots are
+ * not visible to the consumer before "bmi330_sample_queue_commit", so several bursts
+ * can be written and published at once. To be called by the producer only.
+ *
+ * @param[in,out] queue : Structure instance of bmi3_sample_queue.
+ * @param[in]     count : Number of slots written.
+ *
+ * @return Result of API execution status
+ *
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ *
+ */
+int8_t bmi330_sample_queue_produce(struct bmi3_sample_queue *queue, uint16_t count);
+
+/*!
+ * \ingroup bmi330ApiSampleQueue
+ * \page bmi330_api_bmi330_sample_queue_commit bmi330_sample_queue_commit
+ * \code
+ * int8_t bmi330_sample_queue_commit(struct bmi3_sample_queue *queue);
+ * \endcode
+ * @details This API publishes all slots written by the producer to the consumer with
+ * one store of the producer index, with release ordering. To be called by the
+ * producer only.
+ *
+ * @param[in,out] queue : Structure instance of bmi3_sample_queue.
+ *
+ * @return Result of API execution status
+ *
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ *
+ */
+int8_t bmi330_sample_queue_commit(struct bmi3_sample_queue *queue);
+
+/*!
+ * \ingroup bmi330ApiSampleQueue
+ * \page bmi330_api_bmi330_sample_queue_peek bmi330_sample_queue_peek
+ * \code
+ * int8_t bmi330_sample_queue_peek(struct bmi3_sample_queue *queue,
+ *                                 const struct bmi3_fifo_sens_axes_data **slots,
+ *                                 uint16_t *count);
+ * \endcode
+ * @details This API gets the contiguous published slots of the queue, from the next slot
+ * to be read by the consumer up to the end of the slot buffer at most. The slots
+ * are read in place. The index of the producer is loaded only if the slots known
+ * to the consumer do not reach the end of the buffer. To be called by the
+ * consumer only.
+ *
+ * @param[in,out] queue : Structure instance of bmi3_sample_queue.
+ * @param[out]    slots : First published slot.
+ * @param[out]    count : Number of contiguous published slots.
+ *
+ * @return Result of API execution status
+ *
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ *
+ */
+int8_t bmi330_sample_queue_peek(struct bmi3_sample_queue *queue,
+                                const struct bmi3_fifo_sens_axes_data **slots,
+                                uint16_t *count);
+
+/*!
+ * \ingroup bmi330ApiSampleQueue
+ * \page bmi330_api_bmi330_sample_queue_release bmi330_sample_queue_release
+ * \code
+ * int8_t bmi330_sample_queue_release(struct bmi3_sample_queue *queue, uint16_t count);
+ * \endcode
+ * @details This API releases the given number of slots read by the consumer to the
+ * producer with one store of the consumer index, with release ordering. To be
+ * called by the consumer only.
+ *
+ * @param[in,out] queue : Structure instance of bmi3_sample_queue.
+ * @param[in]     count : Number of slots read.
+ *
+ * @return Result of API execution status
+ *
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ *
+ */
+int8_t bmi330_sample_queue_release(struct bmi3_sample_queue *queue, uint16_t count);
+
+/*!
+ * \ingroup bmi330ApiSampleQueue
+ * \page bmi330_api_bmi330_sample_queue_push_fifo bmi330_sample_queue_push_fifo
+ * \code
+ * int8_t bmi330_sample_queue_push_fifo(struct bmi3_sample_queue *accel_queue,
+ *                                      struct bmi3_sample_queue *gyro_queue,
+ *                                      uint16_t *dropped,
+ *                                      const struct bmi3_fifo_frame *fifo,
+ *                                      const struct bmi3_dev *dev);
+ * \endcode
+ * @details This API extracts the complete frames of the FIFO data read by the
+ * "bmi330_read_fifo_data" API straight into the free slots of the accel and gyro
+ * queues, and publishes them with one store per queue. A queue is required for
+ * each of accel and gyro stored in FIFO; temperature frames are dropped. Frames
+ * which do not fit into the free slots are dropped, the newest first, as the
+ * queued samples are never overwritten. To be called by the producer only, e.g.
+ * from the FIFO water-mark interrupt.
+ *
+ * @param[in,out] accel_queue : Structure instance of bmi3_sample_queue of the accel samples.
+ * @param[in,out] gyro_queue  : Structure instance of bmi3_sample_queue of the gyro samples.
+ * @param[out]    dropped     : Number of frames not pushed as the queues are full. Can be NULL.
+ * @param[in]     fifo        : Structure instance of bmi3_fifo_frame.
+ * @param[in]     dev         : Structure instance of bmi3_dev.
+ *
+ * @return Result of API execution status
+ *
+ * @retval 0 -> Success
+ * @retval > 0 -> Warning, BMI3_W_QUEUE_FULL if frames are dropped
+ * @retval < 0 -> Fail
+ *
+ */
+int8_t bmi330_sample_queue_push_fifo(struct bmi3_sample_queue *accel_queue,
+                                     struct bmi3_sample_queue *gyro_queue,
+                                     uint16_t *dropped,
+                                     const struct bmi3_fifo_frame *fifo,
+                                     const struct bmi3_dev *dev);
+
+/**
+ * \ingroup bmi330
+ * \defgroup bmi330ApiLatest Latest
+ * @brief Latest frames of a shared FIFO stream for low-latency consumers
+ */
+
+/*!
+ * \ingroup bmi330ApiLatest
+ * \page bmi330_api_bmi330_latest_init bmi330_latest_init
+ * \code
+ * int8_t bmi330_latest_init(uint8_t odr, bmi3_host_time_ns_fptr_t host_time_ns, struct bmi3_latest *latest);
+ * \endcode
+ * @details This API initializes the latest frames of a FIFO stream. The consumer which
+ * drains the FIFO pushes each batch of extracted frames, so that low-latency
+ * consumers can peek the latest frames without reading the FIFO themselves.
+ *
+ * @param[in]  odr          : Output data rate of the stream, BMI3_ACC_ODR_*.
+ * @param[in]  host_time_ns : Host time function, called with the interface
+ *                            pointer of the device.
+ * @param[out] latest       : Structure instance of bmi3_latest.
+ *
+ * @return Result of API execution status
+ *
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ * @retval BMI3_E_INVALID_INPUT -> Invalid output data rate
+ *
+ */
+int8_t bmi330_latest_init(uint8_t odr, bmi3_host_time_ns_fptr_t host_time_ns, struct bmi3_latest *latest);
+
+/*!
+ * \ingroup bmi330ApiLatest
+ * \page bmi330_api_bmi330_latest_push bmi330_latest_push
+ * \code
+ * int8_t bmi330_latest_push(const struct bmi3_fifo_6dof_data *data,
+ *                           uint16_t n_frames,
+ *                           struct bmi3_latest *latest,
+ *                           struct bmi3_dev *dev);
+ * \endcode
+ * @details This API keeps the latest BMI3_LATEST_MAX_FRAMES frames of a batch read from
+ * FIFO, along with the host time of the push. No bus access is done.
+ *
+ * @param[in]     data     : Joined frames, e.g. from bmi3_extract_6dof, oldest first.
+ * @param[in]     n_frames : Number of frames.
+ * @param[in,out] latest   : Structure instance of bmi3_latest.
+ * @param[in]     dev      : Structure instance of bmi3_dev.
+ *
+ * @return Result of API execution status
+ *
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ *
+ */
+int8_t bmi330_latest_push(const struct bmi3_fifo_6dof_data *data,
+                          uint16_t n_frames,
+                          struct bmi3_latest *latest,
+                          struct bmi3_dev *dev);
+
+/*!
+ * \ingroup bmi330ApiLatest
+ * \page bmi330_api_bmi330_latest_peek bmi330_latest_peek
+ * \code
+ * int8_t bmi330_latest_peek(struct bmi3_fifo_6dof_data *data,
+ *                           uint8_t *count,
+ *                           struct bmi3_latest *latest,
+ *                           struct bmi3_dev *dev);
+ * \endcode
+ * @details This API gives the latest frames of the stream, newest first. Within a sample
+ * period of the last push, the frames of the last push are given without bus access.
+ * After that, the data registers hold a newer sample: they are read in one burst
+ * and the sample is given first, followed by the frames of the last push.
+ *
+ * @note The sensor time of the sample of the data registers is the low word
+ * of the sensor time; frames still in FIFO may lie between it and the
+ * frames of the last push. bmi330_latest_push and bmi330_latest_peek may be
+ * called from different contexts if the device has a lock.
+ *
+ * @param[out]    data   : Latest frames, newest first.
+ * @param[in,out] count  : Number of frames requested, number of frames given.
+ * @param[in,out] latest : Structure instance of bmi3_latest.
+ * @param[in]     dev    : Structure instance of bmi3_dev.
+ *
+ * @return Result of API execution status
+ *
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ *
+ */
+int8_t bmi330_latest_peek(struct bmi3_fifo_6dof_data *data,
+                          uint8_t *count,
+                          struct bmi3_latest *latest,
+                          struct bmi3_dev *dev);
+
+/**
+ * \ingroup bmi330
+ * \defgroup bmi330ApiCtx Ctx
+ * @brief Context which owns all buffers of the FIFO path in an arena provided by the user
+ */
+
+/*!
+ * \ingroup bmi330ApiCtx
+ * \page bmi330_api_bmi330_ctx_init bmi330_ctx_init
+ * \code
+ * int8_t bmi330_ctx_init(struct bmi3_ctx *ctx,
+ *                        uint8_t *arena,
+ *                        uint32_t arena_size,
+ *                        uint16_t fifo_words,
+ *                        uint16_t fifo_config,
+ *                        struct bmi3_dev *dev);
+ * \endcode
+ * @details This API initializes a context which owns the raw FIFO buffer and the
+ * output arrays of the sensors enabled in FIFO, all carved out of the arena
+ * provided by the user. The arena is sized at compile time with
+ * BMI3_CTX_ARENA_SIZE, so no buffer of the FIFO path is sized by the user or kept
+ * on the stack.
+ *
+ * If the driver is compiled with BMI3_DEV_SCRATCH defined, the arena also holds
+ * the scratch buffer used by bmi330_get_regs in place of its stack buffer.
+ *
+ * @note The FIFO frame content configuration is not written to the sensor;
+ * it is set with bmi330_set_fifo_config.
+ *
+ * @param[out]    ctx         : Structure instance of bmi3_ctx.
+ * @param[in]     arena       : Arena of at least BMI3_CTX_ARENA_SIZE(fifo_words, fifo_config) bytes.
+ * @param[in]     arena_size  : Size of the arena in bytes.
+ * @param[in]     fifo_words  : Number of FIFO words to be read at once, at most BMI3_FIFO_SIZE_WORDS.
+ * @param[in]     fifo_config : FIFO frame content configuration, BMI3_FIFO_*_EN.
+ * @param[in,out] dev         : Structure instance of bmi3_dev.
+ *
+ * @return Result of API execution status
+ *
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ *
+ */
+int8_t bmi330_ctx_init(struct bmi3_ctx *ctx,
+                       uint8_t *arena,
+                       uint32_t arena_size,
+                       uint16_t fifo_words,
+                       uint16_t fifo_config,
+                       struct bmi3_dev *dev);
+
+/*!
+ * \ingroup bmi330ApiCtx
+ * \page bmi330_api_bmi330_ctx_read_fifo bmi330_ctx_read_fifo
+ * \code
+ * int8_t bmi330_ctx_read_fifo(struct bmi3_ctx *ctx);
+ * \endcode
+ * @details This API reads the available FIFO data, limited by the raw FIFO buffer of
+ * the context, and extracts it into the output arrays of the context. The number
+ * of frames extracted is given by avail_fifo_accel_frames, avail_fifo_gyro_frames
+ * and avail_fifo_temp_frames of the FIFO frame of the context.
+ *
+ * @param[in,out] ctx : Structure instance of bmi3_ctx.
+ *
+ * @return Result of API execution status
+ *
+ * @retval 0 -> Success
+ * @retval > 0 -> Warning
+ * @retval < 0 -> Fail
+ * @retval BMI3_E_INVALID_STATUS -> FIFO configuration of the sensor differs from the context
+ *
+ */
+int8_t bmi330_ctx_read_fifo(struct bmi3_ctx *ctx);
+
+/*!
+ * \ingroup bmi330ApiFIFO
+ * \page bmi330_api_bmi330_fifo_service bmi330_fifo_service
+ * \code
+ * int8_t bmi330_fifo_service(uint16_t *int1_status,
+ *                            uint16_t *int2_status,
+ *                            struct bmi3_fifo_frame *fifo,
+ *                            struct bmi3_dev *dev);
+ * \endcode
+ * @details This API services the FIFO interrupts. The interrupt status of INT1 and INT2 and
+ * the FIFO fill level are read in one burst. If a FIFO watermark or FIFO full
+ * interrupt is pending, the available FIFO data, limited by fifo->length, is read with
+ * a single read. The frames can then be extracted as after "bmi330_read_fifo_data".
+ *
+ * @note The burst also reads the feature IO registers, and clears the interrupt
+ * status of INT2 along with INT1. The FIFO configuration is read from the shadow
+ * register cache if it is enabled, else from the sensor.
+ *
+ * @param[out]    int1_status : Interrupt status of INT1.
+ * @param[out]    int2_status : Interrupt status of INT2, can be NULL.
+ * @param[in,out] fifo        : Structure instance of bmi3_fifo_frame.
+ * @param[in]     dev         : Structure instance of bmi3_dev.
+ *
+ * @return Result of API execution status
+ *
+ * @retval 0 -> Success
+ * @retval > 0 -> Warning
+ * @retval < 0 -> Fail
+ *
+ */
+int8_t bmi330_fifo_service(uint16_t *int1_status,
+                           uint16_t *int2_status,
+                           struct bmi3_fifo_frame *fifo,
+                           struct bmi3_dev *dev);
+
+/**
+ * \ingroup bmi330
+ * \defgroup bmi330ApiFifoWm FifoWm
+ * @brief FIFO water-mark tuning
+ */
+
+/*!
+ * \ingroup bmi330ApiFifoWm
+ * \page bmi330_api_bmi330_compute_fifo_wm bmi330_compute_fifo_wm
+ * \code
+ * int8_t bmi330_compute_fifo_wm(const struct bmi3_fifo_wm_budget *budget,
+ *                               uint16_t fifo_sens,
+ *                               uint8_t acc_odr,
+ *                               uint8_t gyr_odr,
+ *                               uint16_t *fifo_wm);
+ * \endcode
+ * @details This API computes the FIFO water-mark level for the given ODRs, FIFO frames and
+ * host budget. The level is the highest multiple of the frame length, for fewest
+ * wake-ups, of which the oldest sample is not older than the latency budget and for
+ * which the FIFO does not overflow while the host services the interrupt and reads
+ * the data over the bus.
+ *
+ * @param[in]  budget    : Structure instance of bmi3_fifo_wm_budget.
+ * @param[in]  fifo_sens : Sensors enabled in FIFO, BMI3_FIFO_*_EN.
+ * @param[in]  acc_odr   : Accel ODR, BMI3_ACC_ODR_*.
+ * @param[in]  gyr_odr   : Gyro ODR, BMI3_GYR_ODR_*.
+ * @param[out] fifo_wm   : FIFO water-mark level in words.
+ *
+ * @return Result of API execution status
+ *
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail, BMI3_E_INVALID_INPUT if overflow cannot be avoided
+ *
+ */
+int8_t bmi330_compute_fifo_wm(const struct bmi3_fifo_wm_budget *budget,
+                              uint16_t fifo_sens,
+                              uint8_t acc_odr,
+                              uint8_t gyr_odr,
+                              uint16_t *fifo_wm);
+
+/*!
+ * \ingroup bmi330ApiFifoWm
+ * \page bmi330_api_bmi330_tune_fifo_wm bmi330_tune_fifo_wm
+ * \code
+ * int8_t bmi330_tune_fifo_wm(const struct bmi3_fifo_wm_budget *budget, struct bmi3_dev *dev);
+ * \endcode
+ * @details This API sets the FIFO water-mark level computed by "bmi330_compute_fifo_wm" for
+ * the current accel, gyro and FIFO configuration and the given host budget.
+ *
+ * @note If "fifo_wm_budget" of bmi3_dev is set, the level is tuned again by the driver
+ * whenever accel, gyro or FIFO configuration is set.
+ *
+ * @param[in] budget : Structure instance of bmi3_fifo_wm_budget.
+ * @param[in] dev    : Structure instance of bmi3_dev.
+ *
+ * @return Result of API execution status
+ *
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ *
+ */
+int8_t bmi330_tune_fifo_wm(const struct bmi3_fifo_wm_budget *budget, struct bmi3_dev *dev);
+
+/**
+ * \ingroup bmi330
+ * \defgroup bmi330ApiPowerModel PowerModel
+ * @brief Power estimate of a configuration
+ */
+
+/*!
+ * \ingroup bmi330ApiPowerModel
+ * \page bmi330_api_bmi330_estimate_power bmi330_estimate_power
+ * \code
+ * int8_t bmi330_estimate_power(const struct bmi3_power_cfg *cfg,
+ *                              const struct bmi3_current_table *table,
+ *                              const struct bmi3_bus_model *model,
+ *                              struct bmi3_power_estimate *estimate);
+ * \endcode
+ * @details This API estimates the supply current of the sensor, the host wake-ups and
+ * the bus activity of a configuration, without access to the sensor, so that
+ * configurations can be compared before one is set.
+ * The current is the sum of the currents of the table for the power modes of
+ * accel and gyro. In low-power mode, the charge of each averaged sample is added
+ * at the ODR. A host wake-up is counted for each FIFO water-mark interrupt, or
+ * FIFO full interrupt without water-mark, for each data ready interrupt of accel
+ * and gyro mapped to a pin, and for each feature interrupt expected. Each wake-up
+ * reads the interrupt status and the data (bmi330_fifo_service on FIFO
+ * interrupts). The bus time of these reads is modeled as "model" describes.
+ *
+ * @note The typical values of the default table are coarse, the datasheet of the
+ * sensor gives the values to be used for the supply in use. Data ready interrupts of
+ * accel and gyro are counted as separate wake-ups.
+ *
+ * @param[in]  cfg      : Structure instance of bmi3_power_cfg.
+ * @param[in]  table    : Supply currents of the sensor, NULL for the typical
+ *                        values BMI3_CURRENT_* and BMI3_CHARGE_*.
+ * @param[in]  model    : Structure instance of bmi3_bus_model.
+ * @param[out] estimate : Structure instance of bmi3_power_estimate.
+ *
+ * @return Result of API execution status
+ *
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ *
+ */
+int8_t bmi330_estimate_power(const struct bmi3_power_cfg *cfg,
+                             const struct bmi3_current_table *table,
+                             const struct bmi3_bus_model *model,
+                             struct bmi3_power_estimate *estimate);
+
+/**
+ * \ingroup bmi330
+ * \defgroup bmi330Apigovernor governor
+ * @brief ODR and power governor
+ */
+
+/*!
+ * \ingroup bmi330Apigovernor
+ * \page bmi330_api_bmi330_governor_config bmi330_governor_config
+ * \code
+ * int8_t bmi330_governor_config(const struct bmi3_governor_target *target,
+ *                               struct bmi3_governor *gov,
+ *                               struct bmi3_dev *dev);
+ * \endcode
+ * @details This API programs the sensor from data-quality and latency targets, so that
+ * it switches between a motion and a rest configuration without host intervention:
+ *  - User configuration: accel and gyro at the active ODR and mode, range,
+ *    bandwidth and averaging kept as set.
+ *  - Alternate configuration: accel in low-power mode at the idle ODR with the
+ *    given averaging, gyro suspended.
+ *  - Switch sources: no-motion to the alternate, any-motion to the user
+ *    configuration. Both features are enabled, their thresholds are kept as set.
+ *  - FIFO water-mark level: the smaller of the levels computed by
+ *    bmi330_compute_fifo_wm for rest (latency) and motion (overflow).
+ *
+ * @param[in]     target  : Structure instance of bmi3_governor_target.
+ * @param[out]    gov     : Structure instance of bmi3_governor.
+ * @param[in,out] dev     : Structure instance of bmi3_dev.
+ *
+ * @return Result of API execution status
+ *
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ *
+ */
+int8_t bmi330_governor_config(const struct bmi3_governor_target *target,
+                              struct bmi3_governor *gov,
+                              struct bmi3_dev *dev);
+
+/*!
+ * \ingroup bmi330Apigovernor
+ * \page bmi330_api_bmi330_governor_update bmi330_governor_update
+ * \code
+ * int8_t bmi330_governor_update(struct bmi3_governor *gov, struct bmi3_fifo_time *fifo_time, struct bmi3_dev *dev);
+ * \endcode
+ * @details This API reads which configuration is active and sets the effective ODR
+ * of the governor. The sample period of the FIFO timestamp reconstruction is
+ * updated accordingly. It is to be called on the any-motion and no-motion
+ * interrupts, or before the FIFO data is parsed.
+ *
+ * @param[in,out] gov        : Structure instance of bmi3_governor.
+ * @param[in,out] fifo_time  : Structure instance of bmi3_fifo_time, NULL if not used.
+ * @param[in,out] dev        : Structure instance of bmi3_dev.
+ *
+ * @return Result of API execution status
+ *
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ *
+ */
+int8_t bmi330_governor_update(struct bmi3_governor *gov, struct bmi3_fifo_time *fifo_time, struct bmi3_dev *dev);
+
+/**
+ * \ingroup bmi330
+ * \defgroup bmi330Apiautorange autorange
+ * @brief Saturation-aware automatic range governor
+ */
+
+/*!
+ * \ingroup bmi330ApiAutoRange
+ * \page bmi330_api_bmi330_auto_range_init bmi330_auto_range_init
+ * \code
+ * int8_t bmi330_auto_range_init(const struct bmi3_auto_range_target *target,
+ *                               struct bmi3_auto_range *ar,
+ *                               struct bmi3_dev *dev);
+ * \endcode
+ * @details This API initializes the auto-range governor of accel or gyro
+ * from the range set in the sensor. The governor runs the finest range of the
+ * targets which does not clip: a sample reaching up_thres or saturating sets the
+ * next coarser range, hold_samples samples below down_thres the next finer one.
+ * A range outside of the targets is corrected by the next bmi330_auto_range_apply.
+ *
+ * @param[in]     target : Structure instance of bmi3_auto_range_target.
+ * @param[out]    ar     : Structure instance of bmi3_auto_range.
+ * @param[in,out] dev    : Structure instance of bmi3_dev.
+ *
+ * @return Result of API execution status
+ *
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ * @retval BMI3_E_INVALID_INPUT -> Invalid targets
+ *
+ */
+int8_t bmi330_auto_range_init(const struct bmi3_auto_range_target *target,
+                              struct bmi3_auto_range *ar,
+                              struct bmi3_dev *dev);
+
+/*!
+ * \ingroup bmi330ApiAutoRange
+ * \page bmi330_api_bmi330_auto_range_update bmi330_auto_range_update
+ * \code
+ * int8_t bmi330_auto_range_update(const struct bmi3_sens_axes_data *data, struct bmi3_auto_range *ar);
+ * \endcode
+ * @details This API counts a sample of the data registers, along with its
+ * saturation flags, to the statistics of the auto-range governor. No bus
+ * access is done, a range switch due is set by bmi330_auto_range_apply.
+ *
+ * @param[in]     data : Sample of the data registers.
+ * @param[in,out] ar   : Structure instance of bmi3_auto_range.
+ *
+ * @return Result of API execution status
+ *
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ *
+ */
+int8_t bmi330_auto_range_update(const struct bmi3_sens_axes_data *data, struct bmi3_auto_range *ar);
+
+/*!
+ * \ingroup bmi330ApiAutoRange
+ * \page bmi330_api_bmi330_auto_range_update_fifo bmi330_auto_range_update_fifo
+ * \code
+ * int8_t bmi330_auto_range_update_fifo(const struct bmi3_fifo_sens_axes_data *data,
+ *                                      uint16_t n_frames,
+ *                                      int32_t *scale_q,
+ *                                      struct bmi3_auto_range *ar);
+ * \endcode
+ * @details This API counts FIFO frames to the statistics of the auto-range
+ * governor and tags each frame with the scale of the range it was sampled with.
+ * The frames which were in the FIFO at the last switch get the previous scale
+ * and are not counted. Frames are to be passed in FIFO order.
+ *
+ * @param[in]     data     : FIFO frames of the sensor.
+ * @param[in]     n_frames : Number of frames.
+ * @param[out]    scale_q  : Scale of each frame as in bmi3_unit_scale, NULL if not needed.
+ * @param[in,out] ar       : Structure instance of bmi3_auto_range.
+ *
+ * @return Result of API execution status
+ *
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ *
+ */
+int8_t bmi330_auto_range_update_fifo(const struct bmi3_fifo_sens_axes_data *data,
+                                     uint16_t n_frames,
+                                     int32_t *scale_q,
+                                     struct bmi3_auto_range *ar);
+
+/*!
+ * \ingroup bmi330ApiAutoRange
+ * \page bmi330_api_bmi330_auto_range_apply bmi330_auto_range_apply
+ * \code
+ * int8_t bmi330_auto_range_apply(struct bmi3_auto_range *ar, struct bmi3_dev *dev);
+ * \endcode
+ * @details This API sets the range decided by the auto-range governor, if a
+ * switch is due, and updates the unit scale of the device. Only the range field
+ * of the sensor configuration register is written; the FIFO fill level read
+ * right before gives the number of frames still in the FIFO with the previous
+ * range. To be called after a FIFO read, where the FIFO holds the least frames.
+ * Nothing is accessed if no switch is due.
+ *
+ * @param[in,out] ar  : Structure instance of bmi3_auto_range.
+ * @param[in,out] dev : Structure instance of bmi3_dev.
+ *
+ * @return Result of API execution status
+ *
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ *
+ */
+int8_t bmi330_auto_range_apply(struct bmi3_auto_range *ar, struct bmi3_dev *dev);
+
+/**
+ * \ingroup bmi330
+ * \defgroup bmi330ApiSched Sched
+ * @brief Scheduler of data-ready reads and FIFO batches
+ */
+
+/*!
+ * \ingroup bmi330ApiSched
+ * \page bmi330_api_bmi330_sched_init bmi330_sched_init
+ * \code
+ * int8_t bmi330_sched_init(uint16_t fifo_sens,
+ *                          uint8_t int_pin,
+ *                          uint32_t service_us,
+ *                          uint32_t bus_hz,
+ *                          struct bmi3_sched *sched);
+ * \endcode
+ * @details This API initializes the scheduler, with no consumer registered.
+ * Samples of the sensors given are delivered to the sample queues either on the
+ * data-ready interrupt or in FIFO batches on the FIFO water-mark interrupt,
+ * whichever meets the latency of all consumers with the least interrupts. No
+ * bus access is done; the sensor is set by bmi330_sched_apply.
+ *
+ * @param[in]  fifo_sens  : Sensors delivered, BMI3_FIFO_ACC_EN and/or BMI3_FIFO_GYR_EN.
+ * @param[in]  int_pin    : Interrupt pin, BMI3_INT1, BMI3_INT2 or BMI3_I3C_INT.
+ * @param[in]  service_us : Worst case time in microseconds from an interrupt until the read starts.
+ * @param[in]  bus_hz     : Bus speed in bits per second.
+ * @param[out] sched      : Structure instance of bmi3_sched.
+ *
+ * @return Result of API execution status
+ *
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ * @retval BMI3_E_INVALID_INPUT -> Invalid sensors, pin or bus speed
+ *
+ */
+int8_t bmi330_sched_init(uint16_t fifo_sens,
+                         uint8_t int_pin,
+                         uint32_t service_us,
+                         uint32_t bus_hz,
+                         struct bmi3_sched *sched);
+
+/*!
+ * \ingroup bmi330ApiSched
+ * \page bmi330_api_bmi330_sched_set_consumer bmi330_sched_set_consumer
+ * \code
+ * int8_t bmi330_sched_set_consumer(uint8_t id, uint32_t latency_us, uint8_t odr, struct bmi3_sched *sched);
+ * \endcode
+ * @details This API sets the requirements of a consumer of the scheduler, or
+ * removes the consumer if the latency is 0. No bus access is done; the changed
+ * requirements take effect on the next bmi330_sched_apply.
+ *
+ * @param[in]     id         : Index of the consumer, below BMI3_SCHED_MAX_CONSUMERS.
+ * @param[in]     latency_us : Maximum age in microseconds of a sample when delivered, 0 to remove.
+ * @param[in]     odr        : Minimum output data rate, BMI3_ACC_ODR_*.
+ * @param[in,out] sched      : Structure instance of bmi3_sched.
+ *
+ * @return Result of API execution status
+ *
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ * @retval BMI3_E_INVALID_INPUT -> Invalid consumer or ODR
+ *
+ */
+int8_t bmi330_sched_set_consumer(uint8_t id, uint32_t latency_us, uint8_t odr, struct bmi3_sched *sched);
+
+/*!
+ * \ingroup bmi330ApiSched
+ * \page bmi330_api_bmi330_sched_apply bmi330_sched_apply
+ * \code
+ * int8_t bmi330_sched_apply(struct bmi3_sched *sched, struct bmi3_dev *dev);
+ * \endcode
+ * @details This API decides the mode of the scheduler from the consumers. The
+ * sensors are set to the highest ODR of the consumers, and the FIFO water-mark
+ * level is computed as by bmi330_compute_fifo_wm for the tightest latency. FIFO
+ * mode is taken if the level holds at least two frames, else data-ready mode,
+ * with one interrupt per sample. The FIFO, water-mark level and the data-ready
+ * and FIFO water-mark interrupt mapping are set accordingly; other interrupts
+ * of the mapping are kept. The FIFO is flushed when FIFO mode is entered.
+ * Nothing is written if the ODR, mode and water-mark level are kept, so the
+ * API can be called on each change of the consumers.
+ *
+ * @param[in,out] sched : Structure instance of bmi3_sched.
+ * @param[in,out] dev   : Structure instance of bmi3_dev.
+ *
+ * @return Result of API execution status
+ *
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ * @retval BMI3_E_INVALID_INPUT -> No consumer registered
+ *
+ */
+int8_t bmi330_sched_apply(struct bmi3_sched *sched, struct bmi3_dev *dev);
+
+/*!
+ * \ingroup bmi330ApiSched
+ * \page bmi330_api_bmi330_sched_service bmi330_sched_service
+ * \code
+ * int8_t bmi330_sched_service(const struct bmi3_sched *sched,
+ *                             struct bmi3_sample_queue *accel_queue,
+ *                             struct bmi3_sample_queue *gyro_queue,
+ *                             uint16_t *dropped,
+ *                             struct bmi3_fifo_frame *fifo,
+ *                             struct bmi3_dev *dev);
+ * \endcode
+ * @details This API serves the interrupt of the scheduler. In data-ready mode
+ * one sample of each sensor is read from the data registers, in FIFO mode the
+ * FIFO is read as by bmi330_fifo_service. The samples are pushed to the same
+ * sample queues in both modes, so the consumers do not see the mode switches.
+ *
+ * @param[in]     sched       : Structure instance of bmi3_sched.
+ * @param[in,out] accel_queue : Queue of the accel samples, NULL if accel is not delivered.
+ * @param[in,out] gyro_queue  : Queue of the gyro samples, NULL if gyro is not delivered.
+ * @param[out]    dropped     : Number of samples not pushed as a queue is full, NULL if not needed.
+ * @param[in,out] fifo        : FIFO buffer, used in FIFO mode only.
+ * @param[in,out] dev         : Structure instance of bmi3_dev.
+ *
+ * @return Result of API execution status
+ *
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ * @retval BMI3_W_QUEUE_FULL -> Samples were dropped
+ *
+ */
+int8_t bmi330_sched_service(const struct bmi3_sched *sched,
+                            struct bmi3_sample_queue *accel_queue,
+                            struct bmi3_sample_queue *gyro_queue,
+                            uint16_t *dropped,
+                            struct bmi3_fifo_frame *fifo,
+                            struct bmi3_dev *dev);
+
+/**
+ * \ingroup bmi330
+ * \defgroup bmi330ApiGroup Group
+ * @brief Device group
+ */
+
+/*!
+ * \ingroup bmi330ApiGroup
+ * \page bmi330_api_bmi330_group_init bmi330_group_init
+ * \code
+ * int8_t bmi330_group_init(struct bmi3_dev_group *group,
+ *                          struct bmi3_dev * const *dev,
+ *                          uint8_t n_dev,
+ *                          uint8_t *arena,
+ *                          uint16_t arena_size);
+ * \endcode
+ * @details This API initializes a group of devices which share a bus, and assigns each
+ * device an equal, word aligned part of the arena to store its FIFO data. Each
+ * device has to be initialized before, with its chip-select or I2C address held by
+ * its "intf_ptr".
+ *
+ * @param[in,out] group      : Structure instance of bmi3_dev_group.
+ * @param[in]     dev        : Array of devices of the group.
+ * @param[in]     n_dev      : Number of devices, up to BMI3_GROUP_MAX_DEV.
+ * @param[in]     arena      : Buffer shared by the devices to store FIFO data.
+ * @param[in]     arena_size : Size of the arena in bytes.
+ *
+ * @return Result of API execution status
+ *
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ *
+ */
+int8_t bmi330_group_init(struct bmi3_dev_group *group,
+                         struct bmi3_dev * const *dev,
+                         uint8_t n_dev,
+                         uint8_t *arena,
+                         uint16_t arena_size);
+
+/*!
+ * \ingroup bmi330ApiGroup
+ * \page bmi330_api_bmi330_group_start bmi330_group_start
+ * \code
+ * int8_t bmi330_group_start(struct bmi3_dev_group *group);
+ * \endcode
+ * @details This API starts the FIFO service of the devices of a group, by starting the
+ * FIFO read of the first device. The devices are then serviced in their order in
+ * the group by "bmi330_group_next".
+ *
+ * @param[in,out] group : Structure instance of bmi3_dev_group.
+ *
+ * @return Result of API execution status
+ *
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail, BMI3_E_BUSY if the previous service is not complete
+ *
+ */
+int8_t bmi330_group_start(struct bmi3_dev_group *group);
+
+/*!
+ * \ingroup bmi330ApiGroup
+ * \page bmi330_api_bmi330_group_next bmi330_group_next
+ * \code
+ * int8_t bmi330_group_next(struct bmi3_dev_group *group, uint8_t *index);
+ * \endcode
+ * @details This API gives the next device of a group of which the interrupt status and
+ * FIFO data are read, in "int1_status", "int2_status" and "fifo" of the group at
+ * "index". Before returning, the FIFO read of the following device is started, so
+ * that its transfer runs while the data of this device is parsed, if the device
+ * supports asynchronous reads with "read_async". Devices without "read_async" are
+ * read with "bmi330_fifo_service" at this point.
+ *
+ * @note The FIFO data of the device is parsed with "bmi330_extract_accel", "bmi330_extract_gyro"
+ * and "bmi330_extract_temperature" on "fifo" of the group at "index". BMI3_E_BUSY is
+ * returned while the FIFO read of the device is in progress.
+ *
+ * @param[in,out] group : Structure instance of bmi3_dev_group.
+ * @param[out]    index : Index of the device of which the FIFO data is read,
+ *                        BMI3_GROUP_DONE once all devices are serviced.
+ *
+ * @return Result of API execution status
+ *
+ * @retval 0 -> Success
+ * @retval > 0 -> Warning
+ * @retval < 0 -> Fail
+ *
+ */
+int8_t bmi330_group_next(struct bmi3_dev_group *group, uint8_t *index);
+
+/**
+ * \ingroup bmi330
+ * \defgroup bmi330ApiPingPong PingPong
+ * @brief Double-buffered FIFO acquisition
+ */
+
+/*!
+ * \ingroup bmi330ApiPingPong
+ * \page bmi330_api_bmi330_pingpong_init bmi330_pingpong_init
+ * \code
+ * int8_t bmi330_pingpong_init(struct bmi3_fifo_pingpong *pingpong,
+ *                             uint8_t *arena,
+ *                             uint16_t arena_size,
+ *                             uint8_t n_buf,
+ *                             struct bmi3_dev *dev);
+ * \endcode
+ * @details This API initializes a ping-pong FIFO acquisition of the device. The arena is
+ * split in "n_buf" word aligned buffers of equal size. Each FIFO water-mark
+ * interrupt fills the next free buffer with "bmi330_pingpong_start", while the
+ * buffers filled before are parsed by the user, which takes and gives back the
+ * ownership of a buffer with "bmi330_pingpong_acquire" and "bmi330_pingpong_release".
+ *
+ * @param[out] pingpong   : Structure instance of bmi3_fifo_pingpong.
+ * @param[in]  arena      : Buffer shared by the buffers of the acquisition.
+ * @param[in]  arena_size : Size of the arena in bytes.
+ * @param[in]  n_buf      : Number of buffers, 2 to BMI3_PINGPONG_MAX_BUF.
+ * @param[in]  dev        : Structure instance of bmi3_dev.
+ *
+ * @return Result of API execution status
+ *
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ *
+ */
+int8_t bmi330_pingpong_init(struct bmi3_fifo_pingpong *pingpong,
+                            uint8_t *arena,
+                            uint16_t arena_size,
+                            uint8_t n_buf,
+                            struct bmi3_dev *dev);
+
+/*!
+ * \ingroup bmi330ApiPingPong
+ * \page bmi330_api_bmi330_pingpong_start bmi330_pingpong_start
+ * \code
+ * int8_t bmi330_pingpong_start(struct bmi3_fifo_pingpong *pingpong);
+ * \endcode
+ * @details This API starts the FIFO service of the device into the next free buffer of the
+ * acquisition, typically from the FIFO water-mark interrupt. Interrupt status and
+ * FIFO data are read with "bmi330_async_fifo_service" if the device supports
+ * asynchronous reads with "read_async", else with "bmi330_fifo_service" at once.
+ * The buffer is handed to the user side on success, while the buffers filled
+ * before may still be parsed.
+ *
+ * @note Each FIFO read skipped with BMI3_W_QUEUE_FULL is counted in "overruns" of
+ * the acquisition. Samples are lost only once the FIFO of the sensor is full.
+ *
+ * @param[in,out] pingpong : Structure instance of bmi3_fifo_pingpong.
+ *
+ * @return Result of API execution status
+ *
+ * @retval 0 -> Success
+ * @retval BMI3_W_QUEUE_FULL -> All buffers are owned by the user, the FIFO data is read later
+ * @retval < 0 -> Fail, BMI3_E_BUSY if the previous FIFO read is in progress
+ *
+ */
+int8_t bmi330_pingpong_start(struct bmi3_fifo_pingpong *pingpong);
+
+/*!
+ * \ingroup bmi330ApiPingPong
+ * \page bmi330_api_bmi330_pingpong_acquire bmi330_pingpong_acquire
+ * \code
+ * int8_t bmi330_pingpong_acquire(struct bmi3_fifo_pingpong *pingpong, uint8_t *index);
+ * \endcode
+ * @details This API hands the oldest filled buffer of the acquisition over to the user,
+ * which owns "fifo", "int1_status" and "int2_status" of the acquisition at
+ * "index" until the buffer is given back with "bmi330_pingpong_release". The FIFO
+ * data is parsed with "bmi330_extract_accel", "bmi330_extract_gyro" and
+ * "bmi330_extract_temperature" on "fifo" of the acquisition at "index".
+ *
+ * @note Buffers are owned by a single user context, while "bmi330_pingpong_start" may run
+ * in interrupt context.
+ *
+ * @param[in,out] pingpong : Structure instance of bmi3_fifo_pingpong.
+ * @param[out]    index    : Index of the buffer handed over, BMI3_PINGPONG_NONE
+ *                           if no buffer is filled.
+ *
+ * @return Result of API execution status
+ *
+ * @retval 0 -> Success
+ * @retval > 0 -> Warning of the FIFO read of the buffer
+ * @retval < 0 -> Fail, BMI3_E_BUSY if the FIFO read of the oldest buffer is in progress
+ *
+ */
+int8_t bmi330_pingpong_acquire(struct bmi3_fifo_pingpong *pingpong, uint8_t *index);
+
+/*!
+ * \ingroup bmi330ApiPingPong
+ * \page bmi330_api_bmi330_pingpong_release bmi330_pingpong_release
+ * \code
+ * int8_t bmi330_pingpong_release(struct bmi3_fifo_pingpong *pingpong, uint8_t index);
+ * \endcode
+ * @details This API gives a buffer of the acquisition back, to be filled by a following
+ * FIFO read. Buffers are given back in the order they are handed over.
+ *
+ * @param[in,out] pingpong : Structure instance of bmi3_fifo_pingpong.
+ * @param[in]     index    : Index of the buffer given by "bmi330_pingpong_acquire".
+ *
+ * @return Result of API execution status
+ *
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail, BMI3_E_INVALID_INPUT if the buffer is not the oldest owned
+ *
+ */
+int8_t bmi330_pingpong_release(struct bmi3_fifo_pingpong *pingpong, uint8_t index);
+
+/**
+ * \ingroup bmi330
+ * \defgroup bmi330Apii3csyncgroup i3csyncgroup
+ * @brief I3C sync group of devices
+ */
+
+/*!
+ * \ingroup bmi330Apii3csyncgroup
+ * \page bmi330_api_bmi330_i3c_sync_group_init bmi330_i3c_sync_group_init
+ * \code
+ * int8_t bmi330_i3c_sync_group_init(struct bmi3_i3c_sync_group *group,
+ *                                   struct bmi3_dev * const *dev,
+ *                                   uint8_t n_dev);
+ * \endcode
+ * @details This API initializes a group of devices on one i3c bus of which the i3c sync data is aligned.
+ *
+ * @param[out] group  : Structure instance of bmi3_i3c_sync_group.
+ * @param[in]  dev    : Array of pointers to the devices, initialized with bmi330_init.
+ * @param[in]  n_dev  : Number of devices, up to BMI3_GROUP_MAX_DEV.
+ *
+ * @return Result of API execution status
+ *
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ *
+ */
+int8_t bmi330_i3c_sync_group_init(struct bmi3_i3c_sync_group *group,
+                                  struct bmi3_dev * const *dev,
+                                  uint8_t n_dev);
+
+/*!
+ * \ingroup bmi330Apii3csyncgroup
+ * \page bmi330_api_bmi330_i3c_sync_group_config bmi330_i3c_sync_group_config
+ * \code
+ * int8_t bmi330_i3c_sync_group_config(const struct bmi3_i3c_sync_cfg *cfg, const struct bmi3_i3c_sync_group *group);
+ * \endcode
+ * @details This API sets the i3c sync data sample rate (TPH), delay time (TU) and ODR of
+ * all devices of a group, so that they sample at the same time-controlled sync
+ * events. The adjacent registers are updated in one read and one write per device.
+ *
+ * @param[in] cfg    : Structure instance of bmi3_i3c_sync_cfg.
+ * @param[in] group  : Structure instance of bmi3_i3c_sync_group.
+ *
+ * @return Result of API execution status
+ *
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ *
+ */
+int8_t bmi330_i3c_sync_group_config(const struct bmi3_i3c_sync_cfg *cfg, const struct bmi3_i3c_sync_group *group);
+
+/*!
+ * \ingroup bmi330Apii3csyncgroup
+ * \page bmi330_api_bmi330_i3c_sync_group_read bmi330_i3c_sync_group_read
+ * \code
+ * int8_t bmi330_i3c_sync_group_read(struct bmi3_i3c_sync_frame *frame, const struct bmi3_i3c_sync_group *group);
+ * \endcode
+ * @details This API reads the i3c sync accel, gyro, temperature and time data of each
+ * device of a group in one burst per device. Devices whose sync time is behind
+ * the newest one, due to a sync event between the reads, are read again up to
+ * BMI3_I3C_SYNC_READ_RETRY times. "aligned" of the frame tells whether all
+ * devices finally have the same sync time.
+ *
+ * @param[out] frame  : Structure instance of bmi3_i3c_sync_frame.
+ * @param[in]  group  : Structure instance of bmi3_i3c_sync_group.
+ *
+ * @return Result of API execution status
+ *
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ *
+ */
+int8_t bmi330_i3c_sync_group_read(struct bmi3_i3c_sync_frame *frame, const struct bmi3_i3c_sync_group *group);
+
+/**
+ * \ingroup bmi330
+ * \defgroup bmi330ApiUnitConv UnitConv
+ * @brief Unit conversion
+ */
+
+/*!
+ * \ingroup bmi330ApiUnitConv
+ * \page bmi330_api_bmi330_update_unit_scale bmi330_update_unit_scale
+ * \code
+ * int8_t bmi330_update_unit_scale(struct bmi3_dev *dev);
+ * \endcode
+ * @details This API updates the unit conversion scale factors in "unit_scale" of
+ * bmi3_dev from the accelerometer and gyroscope ranges set in the sensor.
+ *
+ * @note The scale factors are also updated by "bmi330_init" and whenever the
+ * accel or gyro configuration is set with "bmi330_set_sensor_config".
+ *
+ * @param[in,out] dev : Structure instance of bmi3_dev.
+ *
+ * @return Result of API execution status
+ *
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ *
+ */
+int8_t bmi330_update_unit_scale(struct bmi3_dev *dev);
+
+/*!
+ * \ingroup bmi330ApiUnitConv
+ * \page bmi330_api_bmi330_lsb_to_q bmi330_lsb_to_q
+ * \code
+ * int8_t bmi330_lsb_to_q(const int16_t *lsb,
+ *                        int32_t *out,
+ *                        uint16_t count,
+ *                        uint8_t sens_type,
+ *                        const struct bmi3_dev *dev);
+ * \endcode
+ * @details This API converts an array of accelerometer, gyroscope or temperature data
+ * to g, degree per second or degree celsius in fixed-point, with
+ * BMI3_UNIT_Q_FRAC_BITS fraction bits, using the scale factors of bmi3_dev. No
+ * floating-point arithmetic is used.
+ *
+ * @param[in]  lsb       : Array of accel, gyro or temperature data in LSB,
+ *                         e.g. an array of bmi3_fifo_sens_axes_planes.
+ * @param[out] out       : Array to store g, dps or degree celsius, with
+ *                         BMI3_UNIT_Q_FRAC_BITS fraction bits.
+ * @param[in]  count     : Number of elements in the arrays.
+ * @param[in]  sens_type : BMI3_ACCEL, BMI3_GYRO or BMI3_TEMP.
+ * @param[in]  dev       : Structure instance of bmi3_dev.
+ *
+ * @return Result of API execution status
+ *
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail, BMI3_E_INVALID_INPUT if the range is not known
+ *
+ */
+int8_t bmi330_lsb_to_q(const int16_t *lsb,
+                       int32_t *out,
+                       uint16_t count,
+                       uint8_t sens_type,
+                       const struct bmi3_dev *dev);
+
+/*!
+ * \ingroup bmi330ApiUnitConv
+ * \page bmi330_api_bmi330_lsb_to_float bmi330_lsb_to_float
+ * \code
+ * int8_t bmi330_lsb_to_float(const int16_t *lsb,
+ *                            float *out,
+ *                            uint16_t count,
+ *                            uint8_t sens_type,
+ *                            const struct bmi3_dev *dev);
+ * \endcode
+ * @details This API converts an array of accelerometer, gyroscope or temperature data
+ * to g, degree per second or degree celsius in float, using the scale factors of
+ * bmi3_dev.
+ *
+ * @param[in]  lsb       : Array of accel, gyro or temperature data in LSB,
+ *                         e.g. an array of bmi3_fifo_sens_axes_planes.
+ * @param[out] out       : Array to store g, dps or degree celsius.
+ * @param[in]  count     : Number of elements in the arrays.
+ * @param[in]  sens_type : BMI3_ACCEL, BMI3_GYRO or BMI3_TEMP.
+ * @param[in]  dev       : Structure instance of bmi3_dev.
+ *
+ * @return Result of API execution status
+ *
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail, BMI3_E_INVALID_INPUT if the range is not known
+ *
+ */
+int8_t bmi330_lsb_to_float(const int16_t *lsb,
+                           float *out,
+                           uint16_t count,
+                           uint8_t sens_type,
+                           const struct bmi3_dev *dev);
+
+/**
+ * \ingroup bmi330
+ * \defgroup bmi330ApiAxesCorr AxesCorr
+ * @brief FIFO axes correction
+ */
+
+/*!
+ * \ingroup bmi330ApiAxesCorr
+ * \page bmi330_api_bmi330_set_axes_correction bmi330_set_axes_correction
+ * \code
+ * int8_t bmi330_set_axes_correction(struct bmi3_axes_correction *corr,
+ *                                   const struct bmi3_axes_remap *remap,
+ *                                   const int16_t *offset,
+ *                                   const uint16_t *gain);
+ * \endcode
+ * @details This API sets the correction of accelerometer or gyro data from the axis
+ * re-mapping, offset and gain. Once assigned to "acc_corr" or "gyr_corr" of bmi3_dev,
+ * the correction is applied to every frame while the FIFO data is parsed by
+ * "bmi330_extract_accel", "bmi330_extract_gyro", "bmi330_extract_all" and the plane
+ * extractors, so that the data is touched only once.
+ *
+ * @note The data path offset and gain of "bmi330_set_acc_dp_off_dgain" and
+ * "bmi330_set_gyro_dp_off_dgain" are applied by the sensor itself. Offset and gain of
+ * the correction are meant for the residual error remaining after them.
+ *
+ * @param[out] corr   : Structure instance of bmi3_axes_correction.
+ * @param[in]  remap  : Structure instance of bmi3_axes_remap, e.g. the board
+ *                      orientation or as read by "bmi330_get_remap_axes".
+ * @param[in]  offset : Offset of x, y and z axis in LSB, NULL for no offset.
+ * @param[in]  gain   : Gain of x, y and z axis with BMI3_AXES_CORR_GAIN_FRAC_BITS
+ *                      fraction bits, NULL for unity gain.
+ *
+ * @return Result of API execution status
+ *
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ *
+ */
+int8_t bmi330_set_axes_correction(struct bmi3_axes_correction *corr,
+                                  const struct bmi3_axes_remap *remap,
+                                  const int16_t *offset,
+                                  const uint16_t *gain);
+
+/**
+ * \ingroup bmi330
+ * \defgroup bmi330ApiThermalComp ThermalComp
+ * @brief Thermal compensation of the FIFO axes correction
+ */
+
+/*!
+ * \ingroup bmi330ApiThermalComp
+ * \page bmi330_api_bmi330_thermal_comp_init bmi330_thermal_comp_init
+ * \code
+ * int8_t bmi330_thermal_comp_init(const struct bmi3_thermal_point *points,
+ *                                 uint8_t n_points,
+ *                                 uint16_t min_delta,
+ *                                 struct bmi3_axes_correction *corr,
+ *                                 struct bmi3_thermal_comp *comp);
+ * \endcode
+ * @details This API sets up the thermal compensation of the offset and gain of
+ * an axes correction from a per-axis calibration table. Offset and gain are
+ * interpolated piecewise-linearly between the points; temperatures out of the
+ * table keep the nearest point. The rotation of the correction is not touched.
+ *
+ * @param[in]     points    : Points of the calibration table, in ascending order
+ *                            of temperature. Kept by reference.
+ * @param[in]     n_points  : Number of points, 1 to BMI3_THERMAL_MAX_POINTS.
+ * @param[in]     min_delta : Change of the temperature in LSB from which offset
+ *                            and gain are interpolated again, e.g. 512 for 1 degree celsius.
+ * @param[in,out] corr      : Axes correction assigned to "acc_corr" or "gyr_corr"
+ *                            of bmi3_dev.
+ * @param[out]    comp      : Structure instance of bmi3_thermal_comp.
+ *
+ * @return Result of API execution status
+ *
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ * @retval BMI3_E_INVALID_INPUT -> Points not in ascending order of temperature
+ *
+ */
+int8_t bmi330_thermal_comp_init(const struct bmi3_thermal_point *points,
+                                uint8_t n_points,
+                                uint16_t min_delta,
+                                struct bmi3_axes_correction *corr,
+                                struct bmi3_thermal_comp *comp);
+
+/*!
+ * \ingroup bmi330ApiThermalComp
+ * \page bmi330_api_bmi330_thermal_comp_update bmi330_thermal_comp_update
+ * \code
+ * int8_t bmi330_thermal_comp_update(const struct bmi3_fifo_temperature_data *temp_data,
+ *                                   uint16_t n_temp,
+ *                                   struct bmi3_thermal_comp *comp);
+ * \endcode
+ * @details This API updates offset and gain of the axes correction from the
+ * mean of temperature samples, e.g. those extracted by "bmi330_extract_temperature".
+ * They are interpolated only once the temperature moved by "min_delta", so
+ * that the table is looked up at a low rate. The correction is then applied
+ * to every frame in integer math while the FIFO data is parsed, as set by
+ * "bmi330_set_axes_correction". To be called before the accel and gyro frames of
+ * the same FIFO read are extracted.
+ *
+ * @param[in]     temp_data : Temperature samples of the FIFO or data registers.
+ * @param[in]     n_temp    : Number of samples.
+ * @param[in,out] comp      : Structure instance of bmi3_thermal_comp.
+ *
+ * @return Result of API execution status
+ *
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ * @retval BMI3_W_FIFO_EMPTY -> No valid temperature sample
+ *
+ */
+int8_t bmi330_thermal_comp_update(const struct bmi3_fifo_temperature_data *temp_data,
+                                  uint16_t n_temp,
+                                  struct bmi3_thermal_comp *comp);
+
+#ifdef BMI3_RUNNING_STATS
+
+/**
+ * \ingroup bmi330
+ * \defgroup bmi330Apistats stats
+ * @brief Running statistics of FIFO bursts
+ */
+
+/*!
+ * \ingroup bmi330Apistats
+ * \page bmi330_api_bmi330_stats_reset bmi330_stats_reset
+ * \code
+ * int8_t bmi330_stats_reset(struct bmi3_axes_stats *stats);
+ * \endcode
+ * @details This API resets running statistics accumulators, so that the next samples
+ * start a new burst.
+ *
+ * @note Available only if the driver is compiled with BMI3_RUNNING_STATS defined.
+ *
+ * @param[out] stats  : Structure instance of bmi3_axes_stats.
+ *
+ * @return Result of API execution status
+ *
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ *
+ */
+int8_t bmi330_stats_reset(struct bmi3_axes_stats *stats);
+
+/*!
+ * \ingroup bmi330Apistats
+ * \page bmi330_api_bmi330_stats_update bmi330_stats_update
+ * \code
+ * int8_t bmi330_stats_update(const struct bmi3_fifo_sens_axes_planes *planes,
+ *                            uint16_t count,
+ *                            struct bmi3_axes_stats *stats);
+ * \endcode
+ * @details This API accumulates the x, y and z samples of separate arrays, as extracted
+ * by bmi330_extract_accel_planes or bmi330_extract_gyro_planes. Each axis is reduced in
+ * a separate loop over a contiguous array, which the compiler can vectorize.
+ *
+ * @note Available only if the driver is compiled with BMI3_RUNNING_STATS defined.
+ *
+ * @param[in]     planes  : Structure instance of bmi3_fifo_sens_axes_planes.
+ * @param[in]     count   : Number of samples in each axis array.
+ * @param[in,out] stats   : Structure instance of bmi3_axes_stats.
+ *
+ * @return Result of API execution status
+ *
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ *
+ */
+int8_t bmi330_stats_update(const struct bmi3_fifo_sens_axes_planes *planes,
+                           uint16_t count,
+                           struct bmi3_axes_stats *stats);
+
+/*!
+ * \ingroup bmi330Apistats
+ * \page bmi330_api_bmi330_fifo_stats bmi330_fifo_stats
+ * \code
+ * int8_t bmi330_fifo_stats(uint16_t sens_sel,
+ *                          struct bmi3_axes_stats *stats,
+ *                          const struct bmi3_fifo_frame *fifo,
+ *                          const struct bmi3_dev *dev);
+ * \endcode
+ * @details This API accumulates the accelerometer or gyro samples directly from the FIFO
+ * data read by bmi330_read_fifo_data, without extracting the frames. Dummy frames and
+ * frames whose data is not read completely are skipped.
+ *
+ * @note The samples are the raw sensor data, the axis correction is not applied.
+ *
+ * @note Available only if the driver is compiled with BMI3_RUNNING_STATS defined.
+ *
+ * @param[in]     sens_sel : Sensor to be accumulated:
+ *                           BMI3_FIFO_HEAD_LESS_ACC_FRM or BMI3_FIFO_HEAD_LESS_GYR_FRM.
+ * @param[in,out] stats    : Structure instance of bmi3_axes_stats.
+ * @param[in]     fifo     : Structure instance of bmi3_fifo_frame.
+ * @param[in]     dev      : Structure instance of bmi3_dev.
+ *
+ * @return Result of API execution status
+ *
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ *
+ */
+int8_t bmi330_fifo_stats(uint16_t sens_sel,
+                         struct bmi3_axes_stats *stats,
+                         const struct bmi3_fifo_frame *fifo,
+                         const struct bmi3_dev *dev);
+
+/*!
+ * \ingroup bmi330Apistats
+ * \page bmi330_api_bmi330_stats_merge bmi330_stats_merge
+ * \code
+ * int8_t bmi330_stats_merge(const struct bmi3_axes_stats *src, struct bmi3_axes_stats *dst);
+ * \endcode
+ * @details This API merges running statistics accumulators, e.g. of several bursts.
+ *
+ * @note Available only if the driver is compiled with BMI3_RUNNING_STATS defined.
+ *
+ * @param[in]     src  : Structure instance of bmi3_axes_stats to be merged.
+ * @param[in,out] dst  : Structure instance of bmi3_axes_stats.
+ *
+ * @return Result of API execution status
+ *
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ *
+ */
+int8_t bmi330_stats_merge(const struct bmi3_axes_stats *src, struct bmi3_axes_stats *dst);
+
+/*!
+ * \ingroup bmi330Apistats
+ * \page bmi330_api_bmi330_stats_window_push bmi330_stats_window_push
+ * \code
+ * int8_t bmi330_stats_window_push(const struct bmi3_axes_stats *burst, struct bmi3_stats_window *window);
+ * \endcode
+ * @details This API stores the accumulator of a burst in a rolling window. Once the window
+ * is full, the oldest burst is replaced.
+ *
+ * @note Available only if the driver is compiled with BMI3_RUNNING_STATS defined.
+ *
+ * @param[in]     burst   : Structure instance of bmi3_axes_stats of a burst.
+ * @param[in,out] window  : Structure instance of bmi3_stats_window.
+ *
+ * @return Result of API execution status
+ *
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ *
+ */
+int8_t bmi330_stats_window_push(const struct bmi3_axes_stats *burst, struct bmi3_stats_window *window);
+
+/*!
+ * \ingroup bmi330Apistats
+ * \page bmi330_api_bmi330_stats_window_get bmi330_stats_window_get
+ * \code
+ * int8_t bmi330_stats_window_get(const struct bmi3_stats_window *window, struct bmi3_axes_stats *stats);
+ * \endcode
+ * @details This API merges the accumulators of all bursts of a rolling window.
+ *
+ * @note Available only if the driver is compiled with BMI3_RUNNING_STATS defined.
+ *
+ * @param[in]  window  : Structure instance of bmi3_stats_window.
+ * @param[out] stats   : Structure instance of bmi3_axes_stats of the window.
+ *
+ * @return Result of API execution status
+ *
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ *
+ */
+int8_t bmi330_stats_window_get(const struct bmi3_stats_window *window, struct bmi3_axes_stats *stats);
+
+/*!
+ * \ingroup bmi330Apistats
+ * \page bmi330_api_bmi330_stats_get_result bmi330_stats_get_result
+ * \code
+ * int8_t bmi330_stats_get_result(const struct bmi3_axes_stats *stats, struct bmi3_axes_stats_result *result);
+ * \endcode
+ * @details This API computes mean, population variance, minimum, maximum and peak-to-peak
+ * value of x, y and z axis from running statistics accumulators. The results are
+ * computed in integer arithmetic, all zero if no sample is accumulated.
+ *
+ * @note Available only if the driver is compiled with BMI3_RUNNING_STATS defined.
+ *
+ * @param[in]  stats   : Structure instance of bmi3_axes_stats.
+ * @param[out] result  : Structure instance of bmi3_axes_stats_result.
+ *
+ * @return Result of API execution status
+ *
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ *
+ */
+int8_t bmi330_stats_get_result(const struct bmi3_axes_stats *stats, struct bmi3_axes_stats_result *result);
+#endif
+
+/**
+ * \ingroup bmi330
+ * \defgroup bmi330ApiDeltaCodec DeltaCodec
+ * @brief Delta-encoded compact FIFO sample format for storage and uplink
+ */
+
+/*!
+ * \ingroup bmi330Apideltacodec
+ * \page bmi330_api_bmi330_delta_init bmi330_delta_init
+ * \code
+ * int8_t bmi330_delta_init(uint8_t odr, uint16_t sensor_time, struct bmi3_delta_codec *codec);
+ * \endcode
+ * @details This API initializes the delta encoder or decoder of FIFO samples. The
+ * first sample is encoded against zero and the sensor time of the samples is
+ * implied by the output data rate, so it is not stored. Encoder and decoder are
+ * initialized with the same values.
+ *
+ * @param[in]  odr         : Output data rate of the samples, BMI3_ACC_ODR_*.
+ * @param[in]  sensor_time : Sensor time of the first sample.
+ * @param[out] codec       : Structure instance of bmi3_delta_codec.
+ *
+ * @return Result of API execution status
+ *
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ *
+ */
+int8_t bmi330_delta_init(uint8_t odr, uint16_t sensor_time, struct bmi3_delta_codec *codec);
+
+/*!
+ * \ingroup bmi330Apideltacodec
+ * \page bmi330_api_bmi330_delta_encode bmi330_delta_encode
+ * \code
+ * int8_t bmi330_delta_encode(const struct bmi3_fifo_sens_axes_data *data,
+ *                            uint16_t *count,
+ *                            uint8_t *buf,
+ *                            uint16_t *len,
+ *                            struct bmi3_delta_codec *codec);
+ * \endcode
+ * @details This API encodes FIFO samples into blocks of up to BMI3_DELTA_BLOCK_SAMPLES
+ * samples. A block starts with the number of samples and the bit width of each
+ * axis, followed by the zigzag-encoded deltas to the previous sample, bit-packed
+ * least significant bit first. A block takes at most BMI3_DELTA_BLOCK_MAX_LEN
+ * bytes. Only complete blocks are written; the samples which do not fit are left
+ * for the next call.
+ *
+ * @note The samples must be consecutive samples of one sensor at the output
+ * data rate of bmi330_delta_init; their sensor time is not encoded.
+ *
+ * @param[in]     data  : Samples, e.g. from bmi330_extract_accel.
+ * @param[in,out] count : Number of samples, number of samples encoded.
+ * @param[out]    buf   : Buffer of the encoded blocks.
+ * @param[in,out] len   : Length of the buffer, number of bytes written.
+ * @param[in,out] codec : Structure instance of bmi3_delta_codec.
+ *
+ * @return Result of API execution status
+ *
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ *
+ */
+int8_t bmi330_delta_encode(const struct bmi3_fifo_sens_axes_data *data,
+                           uint16_t *count,
+                           uint8_t *buf,
+                           uint16_t *len,
+                           struct bmi3_delta_codec *codec);
+
+/*!
+ * \ingroup bmi330Apideltacodec
+ * \page bmi330_api_bmi330_delta_decode bmi330_delta_decode
+ * \code
+ * int8_t bmi330_delta_decode(const uint8_t *buf,
+ *                            uint16_t *len,
+ *                            struct bmi3_fifo_sens_axes_data *data,
+ *                            uint16_t *count,
+ *                            struct bmi3_delta_codec *codec);
+ * \endcode
+ * @details This API decodes blocks of the delta-encoded sample format back into FIFO
+ * samples. The sensor time of each sample is the sensor time of the previous
+ * sample advanced by the sample period. Only complete blocks are decoded; an
+ * incomplete block at the end of the buffer is left for the next call.
+ *
+ * @param[in]     buf   : Buffer of the encoded blocks.
+ * @param[in,out] len   : Length of the buffer, number of bytes decoded.
+ * @param[out]    data  : Decoded samples.
+ * @param[in,out] count : Number of samples the buffer holds, number of samples decoded.
+ * @param[in,out] codec : Structure instance of bmi3_delta_codec.
+ *
+ * @return Result of API execution status
+ *
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ * @retval BMI3_E_INVALID_INPUT -> Corrupt block header
+ *
+ */
+int8_t bmi330_delta_decode(const uint8_t *buf,
+                           uint16_t *len,
+                           struct bmi3_fifo_sens_axes_data *data,
+                           uint16_t *count,
+                           struct bmi3_delta_codec *codec);
+
+#ifdef BMI3_PACKED_BUF
+
+/**
+ * \ingroup bmi330
+ * \defgroup bmi330ApiPacked Packed
+ * @brief Packed sample buffers of 6 bytes per sample for large in-memory histories
+ */
+
+/*!
+ * \ingroup bmi330ApiPacked
+ * \page bmi330_api_bmi330_packed_init bmi330_packed_init
+ * \code
+ * int8_t bmi330_packed_init(uint8_t odr, struct bmi3_packed_buf *buf);
+ * \endcode
+ * @details This API empties a packed sample buffer and sets its sample period from the
+ * output data rate. The buffer memory is given by the caller: axes holds capacity
+ * samples, the optional side-bands sat and temp are NULL or hold BMI3_PACKED_SAT_LEN(capacity)
+ * bytes and capacity temperatures.
+ *
+ * @note Available only if the driver is compiled with BMI3_PACKED_BUF defined.
+ *
+ * @param[in]     odr : Output data rate of the samples, BMI3_ACC_ODR_*.
+ * @param[in,out] buf : Structure instance of bmi3_packed_buf, with axes, sat, temp
+ *                      and capacity set.
+ *
+ * @return Result of API execution status
+ *
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ * @retval BMI3_E_INVALID_INPUT -> Invalid output data rate
+ *
+ */
+int8_t bmi330_packed_init(uint8_t odr, struct bmi3_packed_buf *buf);
+
+/*!
+ * \ingroup bmi330ApiPacked
+ * \page bmi330_api_bmi330_packed_append bmi330_packed_append
+ * \code
+ * int8_t bmi330_packed_append(const struct bmi3_sens_axes_data *data, uint16_t *count, struct bmi3_packed_buf *buf);
+ * \endcode
+ * @details This API appends samples to a packed sample buffer. The axes are stored in 6
+ * bytes per sample, the saturation flags and the temperature go to their side-bands
+ * if kept. The sensor time of the first sample of the empty buffer is stored, the
+ * sensor time of the other samples is not. Only the samples which fit are appended.
+ *
+ * @note The samples must be consecutive samples of one sensor at the output
+ * data rate of bmi330_packed_init.
+ *
+ * @note Available only if the driver is compiled with BMI3_PACKED_BUF defined.
+ *
+ * @param[in]     data  : Samples, e.g. from bmi3_get_sensor_data.
+ * @param[in,out] count : Number of samples, number of samples appended.
+ * @param[in,out] buf   : Structure instance of bmi3_packed_buf.
+ *
+ * @return Result of API execution status
+ *
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ *
+ */
+int8_t bmi330_packed_append(const struct bmi3_sens_axes_data *data, uint16_t *count, struct bmi3_packed_buf *buf);
+
+/*!
+ * \ingroup bmi330ApiPacked
+ * \page bmi330_api_bmi330_packed_append_fifo bmi330_packed_append_fifo
+ * \code
+ * int8_t bmi330_packed_append_fifo(const struct bmi3_fifo_sens_axes_data *data,
+ *                                  uint16_t *count,
+ *                                  struct bmi3_packed_buf *buf);
+ * \endcode
+ * @details This API appends FIFO samples to a packed sample buffer as "bmi330_packed_append".
+ * The saturation flags of FIFO samples are clear; the temperature side-band is not
+ * written.
+ *
+ * @note The sensor time of the first sample of the empty buffer is the 16-bit
+ * FIFO sensor time.
+ *
+ * @note Available only if the driver is compiled with BMI3_PACKED_BUF defined.
+ *
+ * @param[in]     data  : Samples, e.g. from bmi3_extract_accel.
+ * @param[in,out] count : Number of samples, number of samples appended.
+ * @param[in,out] buf   : Structure instance of bmi3_packed_buf.
+ *
+ * @return Result of API execution status
+ *
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ *
+ */
+int8_t bmi330_packed_append_fifo(const struct bmi3_fifo_sens_axes_data *data,
+                                 uint16_t *count,
+                                 struct bmi3_packed_buf *buf);
+
+/*!
+ * \ingroup bmi330ApiPacked
+ * \page bmi330_api_bmi330_packed_unpack bmi330_packed_unpack
+ * \code
+ * int8_t bmi330_packed_unpack(const struct bmi3_packed_buf *buf,
+ *                             uint16_t first,
+ *                             struct bmi3_sens_axes_data *data,
+ *                             uint16_t *count);
+ * \endcode
+ * @details This API unpacks samples of a packed sample buffer. The sensor time of a sample
+ * is the sensor time of the first sample advanced by the sample period for each
+ * sample in between. Saturation flags and temperature are 0 if their side-band is
+ * not kept.
+ *
+ * @note Available only if the driver is compiled with BMI3_PACKED_BUF defined.
+ *
+ * @param[in]     buf   : Structure instance of bmi3_packed_buf.
+ * @param[in]     first : Index of the first sample to unpack.
+ * @param[out]    data  : Unpacked samples.
+ * @param[in,out] count : Number of samples the array holds, number of samples unpacked.
+ *
+ * @return Result of API execution status
+ *
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ *
+ */
+int8_t bmi330_packed_unpack(const struct bmi3_packed_buf *buf,
+                            uint16_t first,
+                            struct bmi3_sens_axes_data *data,
+                            uint16_t *count);
+
+/*!
+ * \ingroup bmi330ApiPacked
+ * \page bmi330_api_bmi330_packed_unpack_fifo bmi330_packed_unpack_fifo
+ * \code
+ * int8_t bmi330_packed_unpack_fifo(const struct bmi3_packed_buf *buf,
+ *                                  uint16_t first,
+ *                                  struct bmi3_fifo_sens_axes_data *data,
+ *                                  uint16_t *count);
+ * \endcode
+ * @details This API unpacks samples of a packed sample buffer into FIFO samples as
+ * "bmi330_packed_unpack", with the 16-bit sensor time.
+ *
+ * @note Available only if the driver is compiled with BMI3_PACKED_BUF defined.
+ *
+ * @param[in]     buf   : Structure instance of bmi3_packed_buf.
+ * @param[in]     first : Index of the first sample to unpack.
+ * @param[out]    data  : Unpacked samples.
+ * @param[in,out] count : Number of samples the array holds, number of samples unpacked.
+ *
+ * @return Result of API execution status
+ *
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ *
+ */
+int8_t bmi330_packed_unpack_fifo(const struct bmi3_packed_buf *buf,
+                                 uint16_t first,
+                                 struct bmi3_fifo_sens_axes_data *data,
+                                 uint16_t *count);
+#endif
+
+#ifdef BMI3_FLIGHT_REC
+
+/**
+ * \ingroup bmi330
+ * \defgroup bmi330ApiFlightRec FlightRec
+ * @brief Pre-trigger flight recorder of packed FIFO samples
+ */
+
+/*!
+ * \ingroup bmi330ApiFlightRec
+ * \page bmi330_api_bmi330_flight_rec_init bmi330_flight_rec_init
+ * \code
+ * int8_t bmi330_flight_rec_init(uint8_t odr, uint16_t post, uint16_t trigger_mask, struct bmi3_flight_rec *rec);
+ * \endcode
+ * @details This API empties and arms a flight recorder. While armed, the recorder keeps the
+ * latest capacity - post samples, overwriting the oldest ones. On a trigger
+ * interrupt it records the post-event window and then freezes, keeping both windows
+ * until it is armed again. The ring memory is given by the caller, 6 bytes per
+ * sample and sensor.
+ *
+ * @note Available only if the driver is compiled with BMI3_FLIGHT_REC defined.
+ *
+ * @param[in]     odr          : Output data rate of the samples, BMI3_ACC_ODR_*.
+ * @param[in]     post         : Number of samples of the post-event window, less than capacity.
+ * @param[in]     trigger_mask : Interrupt status bits triggering the recorder, e.g.
+ *                               BMI3_INT_STATUS_TAP | BMI3_INT_STATUS_ANY_MOTION.
+ * @param[in,out] rec          : Structure instance of bmi3_flight_rec, with accel, gyro and
+ *                               capacity set.
+ *
+ * @return Result of API execution status
+ *
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ * @retval BMI3_E_INVALID_INPUT -> Invalid output data rate or post-event window
+ *
+ */
+int8_t bmi330_flight_rec_init(uint8_t odr, uint16_t post, uint16_t trigger_mask, struct bmi3_flight_rec *rec);
+
+/*!
+ * \ingroup bmi330ApiFlightRec
+ * \page bmi330_api_bmi330_flight_rec_feed bmi330_flight_rec_feed
+ * \code
+ * int8_t bmi330_flight_rec_feed(const struct bmi3_fifo_sens_axes_data *accel_data,
+ *                               const struct bmi3_fifo_sens_axes_data *gyro_data,
+ *                               uint16_t n_frames,
+ *                               struct bmi3_flight_rec *rec);
+ * \endcode
+ * @details This API packs samples into the ring of a flight recorder. The sensor time of
+ * the first sample ever recorded is taken from its 16-bit FIFO sensor time; from
+ * then on the sensor time is implied by the output data rate.
+ *
+ * @note Accel and gyro samples are joined by index, as extracted from FIFO
+ * frames holding both sensors.
+ *
+ * @note Available only if the driver is compiled with BMI3_FLIGHT_REC defined.
+ *
+ * @param[in]     accel_data : Accelerometer samples.
+ * @param[in]     gyro_data  : Gyro samples, NULL if gyro is not kept.
+ * @param[in]     n_frames   : Number of samples.
+ * @param[in,out] rec        : Structure instance of bmi3_flight_rec.
+ *
+ * @return Result of API execution status
+ *
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ * @retval BMI3_W_FLIGHT_REC_FROZEN -> Recorder is frozen, samples were dropped
+ *
+ */
+int8_t bmi330_flight_rec_feed(const struct bmi3_fifo_sens_axes_data *accel_data,
+                              const struct bmi3_fifo_sens_axes_data *gyro_data,
+                              uint16_t n_frames,
+                              struct bmi3_flight_rec *rec);
+
+/*!
+ * \ingroup bmi330ApiFlightRec
+ * \page bmi330_api_bmi330_flight_rec_trigger bmi330_flight_rec_trigger
+ * \code
+ * int8_t bmi330_flight_rec_trigger(uint16_t int_status, struct bmi3_flight_rec *rec);
+ * \endcode
+ * @details This API triggers an armed flight recorder if the interrupt status has a bit of
+ * the trigger mask set. The samples already recorded form the pre-event window;
+ * the recorder freezes after the next post samples.
+ *
+ * @note Available only if the driver is compiled with BMI3_FLIGHT_REC defined.
+ *
+ * @param[in]     int_status : Interrupt status, e.g. from bmi3_get_int1_status.
+ * @param[in,out] rec        : Structure instance of bmi3_flight_rec.
+ *
+ * @return Result of API execution status
+ *
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ *
+ */
+int8_t bmi330_flight_rec_trigger(uint16_t int_status, struct bmi3_flight_rec *rec);
+
+/*!
+ * \ingroup bmi330ApiFlightRec
+ * \page bmi330_api_bmi330_flight_rec_service bmi330_flight_rec_service
+ * \code
+ * int8_t bmi330_flight_rec_service(uint16_t int_status,
+ *                                  struct bmi3_fifo_sens_axes_data *accel_data,
+ *                                  struct bmi3_fifo_sens_axes_data *gyro_data,
+ *                                  struct bmi3_fifo_frame *fifo,
+ *                                  struct bmi3_fifo_stream *stream,
+ *                                  struct bmi3_flight_rec *rec,
+ *                                  struct bmi3_dev *dev);
+ * \endcode
+ * @details This API reads a chunk of a continuous FIFO stream, extracts its frames as
+ * "bmi330_fifo_stream_extract", packs them into the flight recorder and then triggers
+ * it on the interrupt status. The frames read before the interrupt status is
+ * handled belong to the pre-event window.
+ *
+ * @note Available only if the driver is compiled with BMI3_FLIGHT_REC defined.
+ *
+ * @param[in]     int_status : Interrupt status, e.g. from bmi3_get_int1_status.
+ * @param[out]    accel_data : Accelerometer frames of the stream.
+ * @param[out]    gyro_data  : Gyro frames of the stream, NULL if gyro is not kept.
+ * @param[out]    fifo       : Structure instance of bmi3_fifo_frame.
+ * @param[in,out] stream     : Structure instance of bmi3_fifo_stream.
+ * @param[in,out] rec        : Structure instance of bmi3_flight_rec.
+ * @param[in]     dev        : Structure instance of bmi3_dev.
+ *
+ * @return Result of API execution status
+ *
+ * @retval 0 -> Success
+ * @retval > 0 -> Warning
+ * @retval < 0 -> Fail
+ *
+ */
+int8_t bmi330_flight_rec_service(uint16_t int_status,
+                                 struct bmi3_fifo_sens_axes_data *accel_data,
+                                 struct bmi3_fifo_sens_axes_data *gyro_data,
+                                 struct bmi3_fifo_frame *fifo,
+                                 struct bmi3_fifo_stream *stream,
+                                 struct bmi3_flight_rec *rec,
+                                 struct bmi3_dev *dev);
+
+/*!
+ * \ingroup bmi330ApiFlightRec
+ * \page bmi330_api_bmi330_flight_rec_export bmi330_flight_rec_export
+ * \code
+ * int8_t bmi330_flight_rec_export(const struct bmi3_flight_rec *rec,
+ *                                 uint16_t first,
+ *                                 struct bmi3_sens_axes_data *accel_data,
+ *                                 struct bmi3_sens_axes_data *gyro_data,
+ *                                 uint16_t *count);
+ * \endcode
+ * @details This API exports samples of the ring of a flight recorder, oldest first, with
+ * their unwrapped sensor time. Samples with an index below pre_count precede the
+ * event at event_time, the others follow it.
+ *
+ * @note Available only if the driver is compiled with BMI3_FLIGHT_REC defined.
+ *
+ * @param[in]     rec        : Structure instance of bmi3_flight_rec.
+ * @param[in]     first      : Index of the first sample to export, 0 being the oldest one.
+ * @param[out]    accel_data : Accelerometer samples.
+ * @param[out]    gyro_data  : Gyro samples, can be NULL.
+ * @param[in,out] count      : Number of samples the arrays hold, number of samples exported.
+ *
+ * @return Result of API execution status
+ *
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ *
+ */
+int8_t bmi330_flight_rec_export(const struct bmi3_flight_rec *rec,
+                                uint16_t first,
+                                struct bmi3_sens_axes_data *accel_data,
+                                struct bmi3_sens_axes_data *gyro_data,
+                                uint16_t *count);
+
+/*!
+ * \ingroup bmi330ApiFlightRec
+ * \page bmi330_api_bmi330_flight_rec_rearm bmi330_flight_rec_rearm
+ * \code
+ * int8_t bmi330_flight_rec_rearm(struct bmi3_flight_rec *rec);
+ * \endcode
+ * @details This API arms a triggered or frozen flight recorder again. The recorded samples
+ * are kept; the oldest ones are overwritten as new samples are fed.
+ *
+ * @note Available only if the driver is compiled with BMI3_FLIGHT_REC defined.
+ *
+ * @param[in,out] rec : Structure instance of bmi3_flight_rec.
+ *
+ * @return Result of API execution status
+ *
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ *
+ */
+int8_t bmi330_flight_rec_rearm(struct bmi3_flight_rec *rec);
+#endif
+
+#ifdef BMI3_DECIMATOR
+
+/**
+ * \ingroup bmi330
+ * \defgroup bmi330ApiDecimator Decimator
+ * @brief Decimate FIFO samples to lower rate streams
+ */
+
+/*!
+ * \ingroup bmi330ApiDecimator
+ * \page bmi330_api_bmi330_decimator_init bmi330_decimator_init
+ * \code
+ * int8_t bmi330_decimator_init(uint8_t in_odr, uint8_t out_odr, uint8_t order, struct bmi3_decimator *dec);
+ * \endcode
+ * @details This API initializes a CIC decimator which reduces the rate of FIFO samples
+ * from "in_odr" to "out_odr", with a ratio of a power of two. A higher order
+ * gives a stronger attenuation of the frequencies folded into the output band.
+ * Ratio and order are limited by BMI3_DECIM_MAX_GROWTH: the product of the
+ * order and log2 of the ratio has to be 16 or less, e.g. order 2 for 6400Hz to
+ * 100Hz or order 4 for 1600Hz to 100Hz. Larger ratios are obtained by chaining
+ * decimators.
+ *
+ * @note Available only if the driver is compiled with BMI3_DECIMATOR defined.
+ *
+ * @param[in]  in_odr  : ODR of the input samples, e.g. BMI3_ACC_ODR_1600HZ.
+ * @param[in]  out_odr : ODR of the output samples, below "in_odr".
+ * @param[in]  order   : Number of integrator and comb stages, 1 to BMI3_DECIM_MAX_ORDER.
+ * @param[out] dec     : Structure instance of bmi3_decimator.
+ *
+ * @return Result of API execution status
+ *
+ * @retval 0 -> Success
+ * @retval BMI3_E_INVALID_INPUT -> Invalid ODR or order
+ * @retval < 0 -> Fail
+ *
+ */
+int8_t bmi330_decimator_init(uint8_t in_odr, uint8_t out_odr, uint8_t order, struct bmi3_decimator *dec);
+
+/*!
+ * \ingroup bmi330ApiDecimator
+ * \page bmi330_api_bmi330_decimate bmi330_decimate
+ * \code
+ * int8_t bmi330_decimate(const struct bmi3_fifo_sens_axes_data *in,
+ *                        uint16_t in_count,
+ *                        struct bmi3_fifo_sens_axes_data *out,
+ *                        uint16_t *out_count,
+ *                        struct bmi3_decimator *dec);
+ * \endcode
+ * @details This API decimates FIFO samples by the ratio of the decimator. The state is
+ * kept in "dec" between calls, so that the samples of consecutive FIFO reads
+ * form one continuous stream. Each output sample takes the sensor time of the
+ * last input sample it is made of. Several lower rate streams are produced by
+ * passing the same input to several decimators, or by chaining them.
+ *
+ * @note The filter delays the output by (order * (ratio - 1)) / 2 input samples.
+ *
+ * @note Available only if the driver is compiled with BMI3_DECIMATOR defined.
+ *
+ * @param[in]     in        : Accel or gyro samples, e.g. extracted by bmi330_extract_accel.
+ * @param[in]     in_count  : Number of input samples.
+ * @param[out]    out       : Decimated samples, may be the same array as "in".
+ * @param[out]    out_count : Number of decimated samples.
+ * @param[in,out] dec       : Structure instance of bmi3_decimator.
+ *
+ * @return Result of API execution status
+ *
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ *
+ */
+int8_t bmi330_decimate(const struct bmi3_fifo_sens_axes_data *in,
+                       uint16_t in_count,
+                       struct bmi3_fifo_sens_axes_data *out,
+                       uint16_t *out_count,
+                       struct bmi3_decimator *dec);
+#endif
+
+#ifdef BMI3_SPECTRUM
+
+/**
+ * \ingroup bmi330
+ * \defgroup bmi330ApiSpectrum Spectrum
+ * @brief Spectral summary of FIFO samples
+ */
+
+/*!
+ * \ingroup bmi330ApiSpectrum
+ * \page bmi330_api_bmi330_spectrum_init bmi330_spectrum_init
+ * \code
+ * int8_t bmi330_spectrum_init(const uint16_t *bins, uint8_t n_bins, uint16_t block_len, struct bmi3_spectrum *spec);
+ * \endcode
+ * @details This API initializes the spectral summary of FIFO samples: a bank of
+ * Goertzel filters, one per frequency bin, which gets the energy of each bin
+ * over blocks of "block_len" samples. A block length of the FIFO water-mark
+ * in frames gives one summary per water-mark interrupt.
+ *
+ * "kernel" of "spec" may be set afterwards to a platform specific (e.g. SIMD
+ * or CMSIS-DSP) implementation of the filters.
+ *
+ * @note Available only if the driver is compiled with BMI3_SPECTRUM defined.
+ *
+ * @param[in]  bins      : Frequency bins, bin k is at k * ODR / block_len, 1 to block_len / 2.
+ * @param[in]  n_bins    : Number of bins, up to BMI3_SPECTRUM_MAX_BINS.
+ * @param[in]  block_len : Number of samples of a block, 2 to BMI3_SPECTRUM_MAX_LEN.
+ * @param[out] spec      : Structure instance of bmi3_spectrum.
+ *
+ * @return Result of API execution status
+ *
+ * @retval 0 -> Success
+ * @retval BMI3_E_INVALID_INPUT -> Invalid bin or block length
+ * @retval < 0 -> Fail
+ *
+ */
+int8_t bmi330_spectrum_init(const uint16_t *bins, uint8_t n_bins, uint16_t block_len, struct bmi3_spectrum *spec);
+
+/*!
+ * \ingroup bmi330ApiSpectrum
+ * \page bmi330_api_bmi330_spectrum_update bmi330_spectrum_update
+ * \code
+ * int8_t bmi330_spectrum_update(const struct bmi3_fifo_sens_axes_planes *planes,
+ *                               uint16_t count,
+ *                               struct bmi3_spectrum *spec,
+ *                               struct bmi3_spectrum_summary *summary);
+ * \endcode
+ * @details This API updates the spectral summary by FIFO samples. Blocks may span
+ * several FIFO reads. For each completed block, the squared amplitude of
+ * each bin and axis and the bin of the highest energy of each axis are stored
+ * in "summary". "blocks" of "summary" gives the number of blocks completed,
+ * 0 if the summary was not updated.
+ *
+ * @note Available only if the driver is compiled with BMI3_SPECTRUM defined.
+ *
+ * @param[in]     planes  : Samples as extracted by bmi330_extract_accel_planes or
+ *                          bmi330_extract_gyro_planes.
+ * @param[in]     count   : Number of samples.
+ * @param[in,out] spec    : Structure instance of bmi3_spectrum.
+ * @param[out]    summary : Structure instance of bmi3_spectrum_summary.
+ *
+ * @return Result of API execution status
+ *
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ *
+ */
+int8_t bmi330_spectrum_update(const struct bmi3_fifo_sens_axes_planes *planes,
+                              uint16_t count,
+                              struct bmi3_spectrum *spec,
+                              struct bmi3_spectrum_summary *summary);
+#endif
+
+#ifdef BMI3_BUS_STATS
+
+/**
+ * \ingroup bmi330
+ * \defgroup bmi330ApiBusStats BusStats
+ * @brief Bus statistics
+ */
+
+/*!
+ * \ingroup bmi330ApiBusStats
+ * \page bmi330_api_bmi330_get_bus_stats bmi330_get_bus_stats
+ * \code
+ * int8_t bmi330_get_bus_stats(struct bmi3_bus_stats *stats, const struct bmi3_dev *dev);
+ * \endcode
+ * @details This API gets a snapshot of the statistics of the bus transactions: number of
+ * reads, writes, bytes and time per register address, a histogram of the time of a
+ * transaction and number of failed transactions. Time is measured with
+ * "timestamp_us" of bmi3_dev, if set.
+ *
+ * @note Available only if the driver is compiled with BMI3_BUS_STATS defined.
+ *
+ * @param[out] stats : Structure instance of bmi3_bus_stats.
+ * @param[in]  dev   : Structure instance of bmi3_dev.
+ *
+ * @return Result of API execution status
+ *
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ *
+ */
+int8_t bmi330_get_bus_stats(struct bmi3_bus_stats *stats, const struct bmi3_dev *dev);
+
+/*!
+ * \ingroup bmi330ApiBusStats
+ * \page bmi330_api_bmi330_reset_bus_stats bmi330_reset_bus_stats
+ * \code
+ * int8_t bmi330_reset_bus_stats(struct bmi3_dev *dev);
+ * \endcode
+ * @details This API resets the statistics of the bus transactions.
+ *
+ * @note Available only if the driver is compiled with BMI3_BUS_STATS defined.
+ *
+ * @param[in,out] dev : Structure instance of bmi3_dev.
+ *
+ * @return Result of API execution status
+ *
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ *
+ */
+int8_t bmi330_reset_bus_stats(struct bmi3_dev *dev);
+
+/*!
+ * \ingroup bmi330ApiBusStats
+ * \page bmi330_api_bmi330_calibrate_bus_model bmi330_calibrate_bus_model
+ * \code
+ * int8_t bmi330_calibrate_bus_model(const struct bmi3_bus_stats *stats, struct bmi3_bus_model *model);
+ * \endcode
+ * @details This API calibrates a bus model with the bus statistics recorded on the
+ * target: "scale_q16" is set to the ratio of the measured time of the
+ * transactions to the time modeled for the same transactions. The bus time given
+ * by "bmi330_estimate_power" then includes the overhead of the bus driver of the
+ * target.
+ *
+ * @note Available only if the driver is compiled with BMI3_BUS_STATS defined.
+ *
+ * @param[in]     stats : Bus statistics of "bmi330_get_bus_stats", with the time measured.
+ * @param[in,out] model : Structure instance of bmi3_bus_model, of which "scale_q16"
+ *                        is set.
+ *
+ * @return Result of API execution status
+ *
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail, BMI3_E_INVALID_INPUT if no time is recorded
+ *
+ */
+int8_t bmi330_calibrate_bus_model(const struct bmi3_bus_stats *stats, struct bmi3_bus_model *model);
+#endif
+
+/**
+ * \ingroup bmi330
+ * \defgroup bmi330ApiFast Fast
+ * @brief Hot-path APIs without the forwarding call
+ */
+
+/*!
+ * \ingroup bmi330ApiFast
+ * @details The ..._fast APIs map to the bmi3 APIs of the same name, which work the
+ * same for all BMI3 sensors: see bmi3_get_sensor_data_fast, bmi3_read_fifo_data_fast,
+ * bmi3_extract_accel_fast and bmi3_extract_gyro_fast.
+ */
+#define bmi330_get_sensor_data_fast(sensor_data, n_sens, dev)   bmi3_get_sensor_data_fast(sensor_data, n_sens, dev)
+#define bmi330_read_fifo_data_fast(fifo, dev)                   bmi3_read_fifo_data_fast(fifo, dev)
+#define bmi330_extract_accel_fast(accel_data, fifo, dev)        bmi3_extract_accel_fast(accel_data, fifo, dev)
+#define bmi330_extract_gyro_fast(gyro_data, fifo, dev)          bmi3_extract_gyro_fast(gyro_data, fifo, dev)
+
+/*!
+ * \ingroup bmi330ApiFast
+ * @details With BMI3_INLINE_FORWARDERS defined, the hot-path APIs below call the bmi3
+ * APIs they forward to directly, which saves a call per access. The bmi330
+ * functions are built all the same, e.g. to take their address.
+ */
+#if defined(BMI3_INLINE_FORWARDERS) && !defined(BMI330_SOURCE)
+#define bmi330_get_regs(reg_addr, data, len, dev)               bmi3_get_regs(reg_addr, data, len, dev)
+#define bmi330_set_regs(reg_addr, data, len, dev)               bmi3_set_regs(reg_addr, data, len, dev)
+#define bmi330_get_sensor_data(sensor_data, n_sens, dev)        bmi3_get_sensor_data(sensor_data, n_sens, dev)
+#define bmi330_get_int1_status(int_status, dev)                 bmi3_get_int1_status(int_status, dev)
+#define bmi330_get_int2_status(int_status, dev)                 bmi3_get_int2_status(int_status, dev)
+#define bmi330_get_fifo_length(fifo_avail_len, dev)             bmi3_get_fifo_length(fifo_avail_len, dev)
+#define bmi330_read_fifo_data(fifo, dev)                        bmi3_read_fifo_data(fifo, dev)
+#define bmi330_extract_accel(accel_data, fifo, dev)             bmi3_extract_accel(accel_data, fifo, dev)
+#define bmi330_extract_gyro(gyro_data, fifo, dev)               bmi3_extract_gyro(gyro_data, fifo, dev)
+#define bmi330_extract_temperature(temp_data, fifo, dev)        bmi3_extract_temperature(temp_data, fifo, dev)
+#endif
 
 #ifdef __cplusplus
 }
@@ -120,7 +120,7 @@ static float lsb_to_mps2(int16_t val, float g_range, uint8_t bit_width);
 int main(void)
 {
     /* Sensor initialization configuration. */
-    struct bmi3_dev dev;
+    struct bmi3_dev dev = { 0 };
 
     uint8_t try = 0, j;
     int8_t rslt;
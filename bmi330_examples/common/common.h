@@ -13,6 +13,7 @@ extern "C" {
 #endif /*__cplusplus */
 
 #include "bmi3.h"
+#include "coines.h"
 
 /*! Enum to string converter*/
 #ifndef enum_to_string
@@ -20,6 +21,97 @@ extern "C" {
 #endif
 
 
+/*! Largest number of bytes of a read or write, supported length depends on target machine */
+#define BMI3_COINES_READ_WRITE_LEN  UINT8_C(8)
+
+/******************************************************************************/
+/*!                       Structure definitions                               */
+
+struct bmi3_coines_intf;
+
+/*!
+ * @brief Bulk read function pointer of a COINES interface, used for reads of
+ * at least "bulk_len" bytes, e.g. FIFO data, in place of the register read
+ *
+ * @param[in]     reg_addr : Register address, with the read bit for SPI.
+ * @param[out]    reg_data : Data read, along with the dummy bytes.
+ * @param[in]     len      : Number of bytes to be read.
+ * @param[in,out] bus      : Structure instance of bmi3_coines_intf.
+ *
+ * @return Status of execution.
+ */
+typedef BMI3_INTF_RET_TYPE (*bmi3_coines_bulk_read_fptr_t)(uint8_t reg_addr,
+                                                           uint8_t *reg_data,
+                                                           uint32_t len,
+                                                           struct bmi3_coines_intf *bus);
+
+/*!
+ * @brief Bulk write function pointer of a COINES interface, used for writes of
+ * at least "bulk_len" bytes, e.g. config array uploads, in place of the
+ * register write
+ *
+ * @param[in]     reg_addr : Register address.
+ * @param[in]     reg_data : Data to be written.
+ * @param[in]     len      : Number of bytes to be written.
+ * @param[in,out] bus      : Structure instance of bmi3_coines_intf.
+ *
+ * @return Status of execution.
+ */
+typedef BMI3_INTF_RET_TYPE (*bmi3_coines_bulk_write_fptr_t)(uint8_t reg_addr,
+                                                            const uint8_t *reg_data,
+                                                            uint32_t len,
+                                                            struct bmi3_coines_intf *bus);
+
+/*!
+ * @brief Structure to define the COINES bus of a sensor, passed as interface
+ * pointer to the driver. Each sensor has its own instance, so that several
+ * sensors are driven on the same or on parallel buses.
+ */
+struct bmi3_coines_intf
+{
+    /*! Interface of the sensor: BMI3_SPI_INTF or BMI3_I2C_INTF */
+    enum bmi3_intf intf;
+
+    /*! I2C bus of the sensor */
+    enum coines_i2c_bus i2c_bus;
+
+    /*! SPI bus of the sensor */
+    enum coines_spi_bus spi_bus;
+
+    /*! I2C address or SPI chip-select pin of the sensor */
+    uint8_t dev_addr;
+
+    /*! I2C bus speed */
+    enum coines_i2c_mode i2c_mode;
+
+    /*! SPI clock */
+    enum coines_spi_speed spi_speed;
+
+    /*! SPI mode */
+    enum coines_spi_mode spi_mode;
+
+    /*! Largest number of bytes of a read or write of the driver */
+    uint16_t read_write_len;
+
+    /*! Least number of bytes of a transfer served by the bulk functions */
+    uint32_t bulk_len;
+
+    /*! Bulk read function, NULL to read with the register read of COINES */
+    bmi3_coines_bulk_read_fptr_t bulk_read;
+
+    /*! Bulk write function, NULL to write with the register write of COINES */
+    bmi3_coines_bulk_write_fptr_t bulk_write;
+
+    /*! Context of the bulk functions */
+    void *bulk_ctx;
+
+#ifdef BMI3_DEV_SCRATCH
+
+    /*! Scratch buffer of the register reads of the sensor */
+    uint8_t scratch[BMI3_MAX_LEN];
+#endif
+};
+
 /******************************************************************************/
 /*!               User interface functions                                    */
 
@@ -35,6 +127,45 @@ extern "C" {
  */
 int8_t bmi3_interface_init(struct bmi3_dev *dev, int8_t intf);
 
+/*!
+ *  @brief This function opens the communication with the application board
+ *  and switches the supply of the shuttle board off, before the buses of the
+ *  sensors are configured with bmi3_coines_intf_init.
+ *  @return Status of execution
+ *  @retval 0 -> Success
+ *  @retval < 0 -> Failure Info
+ */
+int8_t bmi3_coines_open(void);
+
+/*!
+ *  @brief This function switches the supply of the shuttle board on, once
+ *  the buses of the sensors are configured.
+ *  @return void.
+ */
+void bmi3_coines_power_on(void);
+
+/*!
+ *  @brief This function sets the default bus of the interface: bus 0, primary
+ *  I2C address or chip-select of the shuttle board, standard I2C mode, 10 MHz
+ *  SPI mode 0 and no bulk functions.
+ *  @param[out] bus  : Structure instance of bmi3_coines_intf
+ *  @param[in]  intf : Interface selection parameter
+ *  @return void.
+ */
+void bmi3_coines_intf_default(struct bmi3_coines_intf *bus, enum bmi3_intf intf);
+
+/*!
+ *  @brief This function configures the bus of a sensor and hooks it into the
+ *  device structure, with "bus" as interface pointer. The bus has to outlive
+ *  the device.
+ *  @param[out]    dev : Structure instance of bmi3_dev
+ *  @param[in,out] bus : Structure instance of bmi3_coines_intf
+ *  @return Status of execution
+ *  @retval 0 -> Success
+ *  @retval < 0 -> Failure Info
+ */
+int8_t bmi3_coines_intf_init(struct bmi3_dev *dev, struct bmi3_coines_intf *bus);
+
 /*!
  *  @brief This API is used to print the execution status.
  *
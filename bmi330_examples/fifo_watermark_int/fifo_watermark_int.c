@@ -95,7 +95,7 @@ static void lsb_to_dps(int16_t gyro_lsb, float dps_range, uint8_t bit_width,
 int main(void)
 {
     /* Sensor initialization configuration. */
-    struct bmi3_dev dev;
+    struct bmi3_dev dev = { 0 };
 
     /* Status of API are returned to this variable. */
     int8_t rslt;
@@ -65,7 +65,7 @@ static float lsb_to_dps(int16_t val, float dps, uint8_t bit_width);
 /* This function starts the execution of program. */
 int main(void)
 {
-    struct bmi3_dev dev;
+    struct bmi3_dev dev = { 0 };
     int8_t rslt;
 
     /* Variable to set the data sample rate of i3c sync
@@ -97,7 +97,7 @@ static void lsb_to_dps(int16_t gyro_lsb, float dps_range, uint8_t bit_width,
 /* This function starts the execution of program. */
 int main(void)
 {
-    struct bmi3_dev dev;
+    struct bmi3_dev dev = { 0 };
 
     int8_t rslt;
 
@@ -0,0 +1,609 @@
+/**\
+ * Copyright (c) 2024 Bosch Sensortec GmbH. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ **/
+
+/*
+ * End-to-end benchmark on the application board. For each bus mode, I2C
+ * standard and fast mode and SPI at 10 MHz, it measures the time of init,
+ * context switch, accel FOC and self-test, the latency from the accel
+ * data-ready interrupt on INT2 until the sample is read, and for each FIFO
+ * configuration the highest ODR whose FIFO data is read without loss, along
+ * with the bus time and the CPU time of parsing per frame.
+ *
+ * The report is printed as one JSON object. The board has to lie flat and
+ * still for the FOC and self-test.
+ */
+
+/******************************************************************************/
+/*!                 Header Files                                              */
+#include <stdio.h>
+#include "coines.h"
+#include "bmi330.h"
+#include "common.h"
+
+/******************************************************************************/
+/*!         Macros definition                                                */
+
+/*! Shuttle board pin of INT2 */
+#define BENCH_INT_PIN                    COINES_SHUTTLE_PIN_21
+
+/*! Number of data-ready interrupts of the latency measurement */
+#define BENCH_LATENCY_SAMPLES            UINT16_C(200)
+
+/*! Time in microseconds to wait for an interrupt before giving up */
+#define BENCH_INT_TIMEOUT_US             UINT32_C(100000)
+
+/*! Time in microseconds of each FIFO run */
+#define BENCH_FIFO_RUN_US                UINT32_C(1000000)
+
+/*! Lowest ODR of the FIFO runs */
+#define BENCH_FIFO_MIN_ODR               BMI3_ACC_ODR_25HZ
+
+/*! Least share of the frames due in a FIFO run, in percent, for the ODR to be sustained */
+#define BENCH_FIFO_MIN_PERCENT           UINT32_C(98)
+
+/*! FIFO water-mark level in words, half of the FIFO */
+#define BENCH_FIFO_WM                    (BMI3_FIFO_SIZE_WORDS / 2)
+
+/*! Size of the FIFO buffer: whole FIFO along with the dummy byte */
+#define BENCH_FIFO_BUF_LEN               ((BMI3_FIFO_SIZE_WORDS * 2) + BMI3_MAX_DUMMY_BYTE)
+
+/*! Largest number of frames of a FIFO read, shortest frame is 2 bytes */
+#define BENCH_MAX_FRAMES                 (BMI3_FIFO_SIZE_WORDS)
+
+/******************************************************************************/
+/*!         Structure definition                                              */
+
+/*! Structure to define a bus mode of the benchmark */
+struct bench_bus
+{
+    /*! Name of the bus mode in the report */
+    const char *name;
+
+    /*! Interface of the sensor */
+    enum bmi3_intf intf;
+
+    /*! I2C bus speed, not used for SPI */
+    enum coines_i2c_mode i2c_mode;
+};
+
+/*! Structure to define a FIFO configuration of the benchmark */
+struct bench_fifo
+{
+    /*! Name of the configuration in the report */
+    const char *name;
+
+    /*! FIFO_CONF sensor enable value */
+    uint16_t fifo_sens;
+
+    /*! Number of bytes of a frame */
+    uint8_t frame_len;
+};
+
+/*! Structure to store the result of a FIFO run */
+struct bench_fifo_run
+{
+    /*! Number of frames read */
+    uint32_t frames;
+
+    /*! Bus time of the FIFO reads in microseconds */
+    uint64_t read_us;
+
+    /*! CPU time of parsing in microseconds */
+    uint64_t parse_us;
+
+    /*! Non-zero if the FIFO was full */
+    uint8_t full;
+};
+
+/******************************************************************************/
+/*!         Static variable definition                                        */
+
+/*! Device and bus of the sensor */
+static struct bmi3_dev dev;
+static struct bmi3_coines_intf bus;
+
+/*! Time of the last interrupt in microseconds, and its flag */
+static volatile uint64_t int_time_us;
+static volatile uint8_t int_flag;
+
+/*! FIFO buffer and parsed frames */
+static uint8_t fifo_buf[BENCH_FIFO_BUF_LEN];
+static struct bmi3_fifo_sens_axes_data accel_data[BENCH_MAX_FRAMES];
+static struct bmi3_fifo_sens_axes_data gyro_data[BENCH_MAX_FRAMES];
+static struct bmi3_fifo_temperature_data temp_data[BENCH_MAX_FRAMES];
+
+/*! Bus modes, SPI last since the sensor keeps SPI until the next power-up */
+static const struct bench_bus bench_buses[] = {
+    { "i2c_standard", BMI3_I2C_INTF, COINES_I2C_STANDARD_MODE },
+    { "i2c_fast", BMI3_I2C_INTF, COINES_I2C_FAST_MODE },
+    { "spi_10mhz", BMI3_SPI_INTF, COINES_I2C_STANDARD_MODE }
+};
+
+/*! FIFO configurations */
+static const struct bench_fifo bench_fifos[] = {
+    { "acc", BMI3_FIFO_ACC_EN, 6 },
+    { "acc+gyr", BMI3_FIFO_ACC_EN | BMI3_FIFO_GYR_EN, 12 },
+    { "all", BMI3_FIFO_ALL_EN, 16 }
+};
+
+/******************************************************************************/
+/*!           Static Function Declaration                                     */
+
+/*!
+ *  @brief This internal API is the callback of the INT2 pin.
+ *
+ *  @param[in] param1 : Not used.
+ *  @param[in] param2 : Not used.
+ */
+static void int_callback(uint32_t param1, uint32_t param2);
+
+/*!
+ *  @brief This internal API powers the shuttle board up on a bus mode and
+ *  runs all measurements.
+ *
+ *  @param[in] bench_bus : Bus mode.
+ *
+ *  @return Status of execution
+ */
+static int8_t run_bus(const struct bench_bus *bench_bus);
+
+/*!
+ *  @brief This internal API measures the time of init, context switch, accel
+ *  FOC and self-test.
+ *
+ *  @return Status of execution
+ */
+static int8_t run_api(void);
+
+/*!
+ *  @brief This internal API measures the latency from the accel data-ready
+ *  interrupt until the sample is read.
+ *
+ *  @return Status of execution
+ */
+static int8_t run_latency(void);
+
+/*!
+ *  @brief This internal API searches the highest ODR of each FIFO
+ *  configuration whose FIFO data is read without loss.
+ *
+ *  @return Status of execution
+ */
+static int8_t run_fifo(void);
+
+/*!
+ *  @brief This internal API sets accel and gyro to high performance mode at
+ *  an ODR, or suspends gyro if not in the FIFO.
+ *
+ *  @param[in] odr       : ODR, BMI3_ACC_ODR_*.
+ *  @param[in] fifo_sens : FIFO_CONF sensor enable value.
+ *
+ *  @return Status of execution
+ */
+static int8_t set_sensors(uint8_t odr, uint16_t fifo_sens);
+
+/*!
+ *  @brief This internal API reads the FIFO for BENCH_FIFO_RUN_US.
+ *
+ *  @param[in]  fifo_sens : FIFO_CONF sensor enable value.
+ *  @param[out] run       : Result of the run.
+ *
+ *  @return Status of execution
+ */
+static int8_t run_fifo_odr(uint16_t fifo_sens, struct bench_fifo_run *run);
+
+/*!
+ *  @brief This internal API prints the time of an API call.
+ *
+ *  @param[in] name  : Name of the API call in the report.
+ *  @param[in] rslt  : Status of the API call.
+ *  @param[in] start : Time in microseconds before the call.
+ */
+static void print_api(const char *name, int8_t rslt, uint64_t start);
+
+/******************************************************************************/
+/*!            Functions                                        */
+
+/* This function starts the execution of program. */
+int main(void)
+{
+    int8_t rslt;
+    uint8_t index;
+
+    rslt = bmi3_coines_open();
+
+    printf("{\"sensor\":\"bmi330\",\"runs\":[");
+
+    for (index = 0; (index < (sizeof(bench_buses) / sizeof(bench_buses[0]))) && (rslt == BMI330_OK); index++)
+    {
+        printf("%s", (index == 0) ? "" : ",");
+        rslt = run_bus(&bench_buses[index]);
+    }
+
+    printf("],\"rslt\":%d}\n", rslt);
+
+    bmi3_coines_deinit();
+
+    return rslt;
+}
+
+/*!
+ * @brief This internal API is the callback of the INT2 pin.
+ */
+static void int_callback(uint32_t param1, uint32_t param2)
+{
+    (void)param1;
+    (void)param2;
+
+    int_time_us = coines_get_micro_sec();
+    int_flag = 1;
+}
+
+/*!
+ * @brief This internal API powers the shuttle board up on a bus mode and
+ * runs all measurements.
+ */
+static int8_t run_bus(const struct bench_bus *bench_bus)
+{
+    int8_t rslt;
+
+    /* Power cycle, the interface of the sensor is selected on power-up */
+    (void)coines_set_shuttleboard_vdd_vddio_config(0, 0);
+    coines_delay_msec(100);
+
+    bmi3_coines_intf_default(&bus, bench_bus->intf);
+    bus.i2c_mode = bench_bus->i2c_mode;
+
+    rslt = bmi3_coines_intf_init(&dev, &bus);
+    bmi3_coines_power_on();
+
+    printf("{\"bus\":\"%s\"", bench_bus->name);
+
+    if (rslt == BMI330_OK)
+    {
+        rslt = run_api();
+    }
+
+    if (rslt == BMI330_OK)
+    {
+        rslt = run_latency();
+    }
+
+    if (rslt == BMI330_OK)
+    {
+        rslt = run_fifo();
+    }
+
+    printf(",\"rslt\":%d}", rslt);
+
+    return rslt;
+}
+
+/*!
+ * @brief This internal API measures the time of init, context switch, accel
+ * FOC and self-test.
+ */
+static int8_t run_api(void)
+{
+    int8_t rslt;
+    int8_t api_rslt;
+    uint64_t start;
+    struct bmi3_accel_foc_g_value g_value = { 0 };
+    struct bmi3_st_result st_result = { 0 };
+
+    start = coines_get_micro_sec();
+    rslt = bmi330_init(&dev);
+    print_api("init_us", rslt, start);
+
+    if (rslt == BMI330_OK)
+    {
+        start = coines_get_micro_sec();
+        rslt = bmi330_context_switch_selection(&dev);
+        print_api("context_switch_us", rslt, start);
+    }
+
+    if (rslt == BMI330_OK)
+    {
+        rslt = set_sensors(BMI3_ACC_ODR_50HZ, BMI3_FIFO_ACC_EN);
+    }
+
+    /* FOC and self-test depend on the position of the board, their status is reported only */
+    if (rslt == BMI330_OK)
+    {
+        g_value.z = 1;
+        start = coines_get_micro_sec();
+        api_rslt = bmi330_perform_accel_foc(&g_value, &dev);
+        print_api("accel_foc_us", api_rslt, start);
+
+        start = coines_get_micro_sec();
+        api_rslt = bmi330_perform_self_test(BMI3_ST_BOTH_ACC_GYR, &st_result, &dev);
+        print_api("self_test_us", api_rslt, start);
+
+        /* Self-test ends with a soft-reset */
+        rslt = bmi330_init(&dev);
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This internal API measures the latency from the accel data-ready
+ * interrupt until the sample is read.
+ */
+static int8_t run_latency(void)
+{
+    int8_t rslt;
+    struct bmi3_int_pin_config int_cfg = { 0 };
+    struct bmi3_map_int map_int = { 0 };
+    struct bmi3_sensor_data sensor_data = { 0 };
+    uint64_t start;
+    uint64_t latency;
+    uint64_t sum = 0;
+    uint64_t min = UINT64_MAX;
+    uint64_t max = 0;
+    uint16_t count = 0;
+
+    rslt = set_sensors(BMI3_ACC_ODR_100HZ, BMI3_FIFO_ACC_EN);
+
+    if (rslt == BMI330_OK)
+    {
+        int_cfg.pin_type = BMI3_INT2;
+        int_cfg.pin_cfg[1].output_en = BMI3_INT_OUTPUT_ENABLE;
+        int_cfg.pin_cfg[1].lvl = BMI3_INT_ACTIVE_HIGH;
+        rslt = bmi330_set_int_pin_config(&int_cfg, &dev);
+    }
+
+    if (rslt == BMI330_OK)
+    {
+        map_int.acc_drdy_int = BMI3_INT2;
+        rslt = bmi330_map_interrupt(map_int, &dev);
+    }
+
+    if (rslt == BMI330_OK)
+    {
+        int_flag = 0;
+        coines_attach_interrupt(BENCH_INT_PIN, int_callback, COINES_PIN_INTERRUPT_RISING_EDGE);
+
+        sensor_data.type = BMI3_ACCEL;
+
+        while ((rslt == BMI330_OK) && (count < BENCH_LATENCY_SAMPLES))
+        {
+            start = coines_get_micro_sec();
+
+            while ((int_flag == 0) && ((coines_get_micro_sec() - start) < BENCH_INT_TIMEOUT_US))
+            {
+            }
+
+            if (int_flag == 0)
+            {
+                /* INT2 is not wired to the pin, no latency is reported */
+                break;
+            }
+
+            int_flag = 0;
+
+            rslt = bmi330_get_sensor_data(&sensor_data, 1, &dev);
+            latency = coines_get_micro_sec() - int_time_us;
+
+            sum += latency;
+            min = (latency < min) ? latency : min;
+            max = (latency > max) ? latency : max;
+            count++;
+        }
+
+        coines_detach_interrupt(BENCH_INT_PIN);
+    }
+
+    printf(",\"latency_us\":{\"samples\":%u", count);
+
+    if (count != 0)
+    {
+        printf(",\"min\":%lu,\"avg\":%lu,\"max\":%lu",
+               (unsigned long)min,
+               (unsigned long)(sum / count),
+               (unsigned long)max);
+    }
+
+    printf("}");
+
+    if (rslt == BMI330_OK)
+    {
+        map_int.acc_drdy_int = BMI3_INT_NONE;
+        rslt = bmi330_map_interrupt(map_int, &dev);
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This internal API searches the highest ODR of each FIFO
+ * configuration whose FIFO data is read without loss.
+ */
+static int8_t run_fifo(void)
+{
+    int8_t rslt = BMI330_OK;
+    struct bench_fifo_run run = { 0 };
+    uint32_t due;
+    uint32_t odr_mhz;
+    uint8_t odr;
+    uint8_t index;
+
+    printf(",\"fifo\":[");
+
+    for (index = 0; (index < (sizeof(bench_fifos) / sizeof(bench_fifos[0]))) && (rslt == BMI330_OK); index++)
+    {
+        printf("%s{\"sens\":\"%s\",\"frame_bytes\":%u",
+               (index == 0) ? "" : ",",
+               bench_fifos[index].name,
+               bench_fifos[index].frame_len);
+
+        /* From the highest ODR down to the first one without loss */
+        for (odr = BMI3_ACC_ODR_6400HZ; (odr >= BENCH_FIFO_MIN_ODR) && (rslt == BMI330_OK); odr--)
+        {
+            rslt = set_sensors(odr, bench_fifos[index].fifo_sens);
+
+            if (rslt == BMI330_OK)
+            {
+                rslt = run_fifo_odr(bench_fifos[index].fifo_sens, &run);
+            }
+
+            odr_mhz = BMI3_ODR_6400HZ_MHZ >> (BMI3_ACC_ODR_6400HZ - odr);
+            due = (uint32_t)(((uint64_t)odr_mhz * BENCH_FIFO_RUN_US) / UINT64_C(1000000000));
+
+            if ((rslt == BMI330_OK) && (run.full == 0) && ((run.frames * 100U) >= (due * BENCH_FIFO_MIN_PERCENT)))
+            {
+                break;
+            }
+        }
+
+        if ((rslt == BMI330_OK) && (odr >= BENCH_FIFO_MIN_ODR) && (run.frames != 0))
+        {
+            printf(",\"max_odr_mhz\":%lu,\"read_ns_per_frame\":%lu,\"parse_ns_per_frame\":%lu",
+                   (unsigned long)odr_mhz,
+                   (unsigned long)((run.read_us * 1000U) / run.frames),
+                   (unsigned long)((run.parse_us * 1000U) / run.frames));
+        }
+        else
+        {
+            printf(",\"max_odr_mhz\":0");
+        }
+
+        printf("}");
+    }
+
+    printf("]");
+
+    if (rslt == BMI330_OK)
+    {
+        rslt = bmi330_set_fifo_config(BMI3_FIFO_ALL_EN, BMI3_DISABLE, &dev);
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This internal API sets accel and gyro to high performance mode at
+ * an ODR, or suspends gyro if not in the FIFO.
+ */
+static int8_t set_sensors(uint8_t odr, uint16_t fifo_sens)
+{
+    int8_t rslt;
+    struct bmi3_sens_config config[2] = { { 0 } };
+
+    config[0].type = BMI3_ACCEL;
+    config[1].type = BMI3_GYRO;
+
+    rslt = bmi330_get_sensor_config(config, 2, &dev);
+
+    if (rslt == BMI330_OK)
+    {
+        config[0].cfg.acc.odr = odr;
+        config[0].cfg.acc.range = BMI3_ACC_RANGE_8G;
+        config[0].cfg.acc.bwp = BMI3_ACC_BW_ODR_HALF;
+        config[0].cfg.acc.avg_num = BMI3_ACC_AVG1;
+        config[0].cfg.acc.acc_mode = BMI3_ACC_MODE_HIGH_PERF;
+
+        config[1].cfg.gyr.odr = odr;
+        config[1].cfg.gyr.range = BMI3_GYR_RANGE_2000DPS;
+        config[1].cfg.gyr.bwp = BMI3_GYR_BW_ODR_HALF;
+        config[1].cfg.gyr.avg_num = BMI3_GYR_AVG1;
+        config[1].cfg.gyr.gyr_mode = (fifo_sens & BMI3_FIFO_GYR_EN) ? BMI3_GYR_MODE_HIGH_PERF : BMI3_GYR_MODE_DISABLE;
+
+        rslt = bmi330_set_sensor_config(config, 2, &dev);
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This internal API reads the FIFO for BENCH_FIFO_RUN_US.
+ */
+static int8_t run_fifo_odr(uint16_t fifo_sens, struct bench_fifo_run *run)
+{
+    int8_t rslt;
+    struct bmi3_map_int map_int = { 0 };
+    struct bmi3_fifo_frame fifo = { 0 };
+    struct bmi3_fifo_census census = { 0 };
+    uint16_t int1_status = 0;
+    uint64_t start;
+    uint64_t now;
+
+    run->frames = 0;
+    run->read_us = 0;
+    run->parse_us = 0;
+    run->full = 0;
+
+    fifo.data = fifo_buf;
+
+    /* Water-mark and full status are set only if mapped */
+    map_int.fifo_watermark_int = BMI3_INT1;
+    map_int.fifo_full_int = BMI3_INT1;
+    rslt = bmi330_map_interrupt(map_int, &dev);
+
+    if (rslt == BMI330_OK)
+    {
+        rslt = bmi330_set_fifo_config(BMI3_FIFO_ALL_EN, BMI3_DISABLE, &dev);
+    }
+
+    if (rslt == BMI330_OK)
+    {
+        rslt = bmi330_set_fifo_wm(BENCH_FIFO_WM, &dev);
+    }
+
+    if (rslt == BMI330_OK)
+    {
+        /* FIFO starts empty when the sensors are enabled in it */
+        rslt = bmi330_set_fifo_config(fifo_sens, BMI3_ENABLE, &dev);
+    }
+
+    start = coines_get_micro_sec();
+    now = start;
+
+    while ((rslt == BMI330_OK) && ((now - start) < BENCH_FIFO_RUN_US))
+    {
+        fifo.length = BENCH_FIFO_BUF_LEN;
+        rslt = bmi330_fifo_service(&int1_status, NULL, &fifo, &dev);
+        rslt = (rslt == BMI3_W_FIFO_EMPTY) ? BMI330_OK : rslt;
+        run->read_us += coines_get_micro_sec() - now;
+
+        if (int1_status & BMI3_INT_STATUS_FFULL)
+        {
+            run->full = 1;
+        }
+
+        if ((rslt == BMI330_OK) && (fifo.available_fifo_len != 0))
+        {
+            rslt = bmi330_fifo_census(&census, BMI330_DISABLE, &fifo, &dev);
+            run->frames += census.frames;
+
+            now = coines_get_micro_sec();
+            rslt = (rslt >= BMI330_OK) ? bmi330_extract_all(accel_data, gyro_data, temp_data, &fifo, &dev) : rslt;
+            run->parse_us += coines_get_micro_sec() - now;
+
+            /* Warnings of partial frames are not failures of the benchmark */
+            rslt = (rslt > BMI330_OK) ? BMI330_OK : rslt;
+        }
+
+        now = coines_get_micro_sec();
+    }
+
+    if (rslt == BMI330_OK)
+    {
+        map_int.fifo_watermark_int = BMI3_INT_NONE;
+        map_int.fifo_full_int = BMI3_INT_NONE;
+        rslt = bmi330_map_interrupt(map_int, &dev);
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This internal API prints the time of an API call.
+ */
+static void print_api(const char *name, int8_t rslt, uint64_t start)
+{
+    printf(",\"%s\":{\"us\":%lu,\"rslt\":%d}", name, (unsigned long)(coines_get_micro_sec() - start), rslt);
+}
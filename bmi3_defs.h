@@ -135,6 +135,84 @@
 #define BMI3_INTF_RET_SUCCESS                        INT8_C(0)
 #endif
 
+/*!
+ * BMI3_CONFIG_FILE is an optional configuration header, included if given by the build system, e.g.
+ * -DBMI3_CONFIG_FILE=\"bmi3_config.h\". It can hold the BMI3_ENABLE_FEATURE_* settings below.
+ */
+#ifdef BMI3_CONFIG_FILE
+#include BMI3_CONFIG_FILE
+#endif
+
+/*!
+ * BMI3_ENABLE_FEATURE_* select the feature engine configurations handled by bmi3_set_sensor_config,
+ * bmi3_get_sensor_config and bmi3_get_feature_image. The code of a feature set to 0 is not built and its
+ * configuration is rejected with BMI3_E_INVALID_SENSOR. All features are enabled by default.
+ */
+#ifndef BMI3_ENABLE_FEATURE_ANY_MOTION
+#define BMI3_ENABLE_FEATURE_ANY_MOTION               1
+#endif
+
+#ifndef BMI3_ENABLE_FEATURE_NO_MOTION
+#define BMI3_ENABLE_FEATURE_NO_MOTION                1
+#endif
+
+#ifndef BMI3_ENABLE_FEATURE_SIG_MOTION
+#define BMI3_ENABLE_FEATURE_SIG_MOTION               1
+#endif
+
+#ifndef BMI3_ENABLE_FEATURE_FLAT
+#define BMI3_ENABLE_FEATURE_FLAT                     1
+#endif
+
+#ifndef BMI3_ENABLE_FEATURE_TILT
+#define BMI3_ENABLE_FEATURE_TILT                     1
+#endif
+
+#ifndef BMI3_ENABLE_FEATURE_ORIENTATION
+#define BMI3_ENABLE_FEATURE_ORIENTATION              1
+#endif
+
+#ifndef BMI3_ENABLE_FEATURE_STEP_COUNTER
+#define BMI3_ENABLE_FEATURE_STEP_COUNTER             1
+#endif
+
+#ifndef BMI3_ENABLE_FEATURE_TAP
+#define BMI3_ENABLE_FEATURE_TAP                      1
+#endif
+
+/*!
+ * BMI3_CACHE_LINE_SIZE is the size of a cache line in bytes. The producer and consumer indices of
+ * bmi3_sample_queue are kept on separate cache lines of this size.
+ */
+#ifndef BMI3_CACHE_LINE_SIZE
+#define BMI3_CACHE_LINE_SIZE                         64
+#endif
+
+/*!
+ * BMI3_LOAD_ACQUIRE and BMI3_STORE_RELEASE access the indices of bmi3_sample_queue with acquire and release
+ * ordering. The GCC and Clang builtins are used by default; plain volatile accesses otherwise, which only
+ * order the indices on single-core targets without a data cache. Other compilers can provide their
+ * intrinsics in BMI3_CONFIG_FILE.
+ */
+#ifndef BMI3_LOAD_ACQUIRE
+#if defined(__GNUC__)
+#define BMI3_LOAD_ACQUIRE(ptr)                       __atomic_load_n((ptr), __ATOMIC_ACQUIRE)
+#define BMI3_STORE_RELEASE(ptr, val)                 __atomic_store_n((ptr), (val), __ATOMIC_RELEASE)
+#else
+#define BMI3_LOAD_ACQUIRE(ptr)                       (*(ptr))
+#define BMI3_STORE_RELEASE(ptr, val)                 (*(ptr) = (val))
+#endif
+#endif
+
+/*! Alignment of bmi3_sample_queue to a cache line, empty if not supported by the compiler */
+#ifndef BMI3_CACHE_ALIGNED
+#if defined(__GNUC__)
+#define BMI3_CACHE_ALIGNED                           __attribute__((aligned(BMI3_CACHE_LINE_SIZE)))
+#else
+#define BMI3_CACHE_ALIGNED
+#endif
+#endif
+
 /*! To define success code */
 #define BMI3_OK                                      INT8_C(0)
 
@@ -153,6 +231,9 @@
 #define BMI3_E_INVALID_ST_SELECTION                  INT8_C(-12)
 #define BMI3_E_OUT_OF_RANGE                          INT8_C(-13)
 #define BMI3_E_FEATURE_ENGINE_STATUS                 INT8_C(-14)
+#define BMI3_E_BUSY                                  INT8_C(-15)
+#define BMI3_E_CONFIG_VERIFY                         INT8_C(-16)
+#define BMI3_E_CALIB_BLOB                            INT8_C(-17)
 
 /*! BMI3 Commands */
 #define BMI3_CMD_SELF_TEST_TRIGGER                   UINT16_C(0x0100)
@@ -172,12 +253,55 @@
 #define BMI3_W_FIFO_ACCEL_DUMMY_FRAME                UINT8_C(5)
 #define BMI3_W_FIFO_TEMP_DUMMY_FRAME                 UINT8_C(6)
 #define BMI3_W_FIFO_INVALID_FRAME                    UINT8_C(7)
+#define BMI3_W_ST_ONGOING                            UINT8_C(8)
+#define BMI3_W_SC_ONGOING                            UINT8_C(9)
+#define BMI3_W_QUEUE_FULL                            UINT8_C(10)
+#define BMI3_W_OP_PENDING                            UINT8_C(11)
+#define BMI3_W_SAMPLE_REJECTED                       UINT8_C(12)
+#define BMI3_W_FIFO_GAP                              UINT8_C(13)
+#define BMI3_W_FLIGHT_REC_FROZEN                     UINT8_C(14)
 
 /*! Masks for FIFO dummy data frames */
 #define BMI3_FIFO_GYRO_DUMMY_FRAME                   UINT16_C(0x7f02)
 #define BMI3_FIFO_ACCEL_DUMMY_FRAME                  UINT16_C(0x7f01)
 #define BMI3_FIFO_TEMP_DUMMY_FRAME                   UINT16_C(0x8000)
 
+/*! Size of the FIFO in words */
+#define BMI3_FIFO_SIZE_WORDS                         UINT16_C(1024)
+
+/*! Output data rate at 6400Hz ODR in mHz */
+#define BMI3_ODR_6400HZ_MHZ                          UINT32_C(6400000)
+
+/*! Typical supply currents of the default current table of bmi3_estimate_power, in nA */
+#define BMI3_CURRENT_BASE_NA                         UINT32_C(3500)
+#define BMI3_CURRENT_ACC_HP_NA                       UINT32_C(180000)
+#define BMI3_CURRENT_ACC_NORMAL_NA                   UINT32_C(150000)
+#define BMI3_CURRENT_ACC_LP_NA                       UINT32_C(5000)
+#define BMI3_CURRENT_GYR_HP_NA                       UINT32_C(610000)
+#define BMI3_CURRENT_GYR_NORMAL_NA                   UINT32_C(520000)
+#define BMI3_CURRENT_GYR_LP_NA                       UINT32_C(300000)
+#define BMI3_CURRENT_GYR_DRIVE_NA                    UINT32_C(250000)
+
+/*! Typical charge per sample averaged in low-power mode of the default current table, in pC */
+#define BMI3_CHARGE_ACC_LP_SAMPLE_PC                 UINT32_C(180000)
+#define BMI3_CHARGE_GYR_LP_SAMPLE_PC                 UINT32_C(500000)
+
+/*! Scale factor 1.0 of the modeled bus time of bmi3_bus_model, Q16 */
+#define BMI3_BUS_MODEL_SCALE_ONE                     UINT32_C(65536)
+
+/*! Sums of bmi3_estimate_power: wake-ups, transactions, bytes and bus time */
+#define BMI3_POWER_SUM_WAKEUPS                       UINT8_C(0)
+#define BMI3_POWER_SUM_XFERS                         UINT8_C(1)
+#define BMI3_POWER_SUM_BYTES                         UINT8_C(2)
+#define BMI3_POWER_SUM_BUS                           UINT8_C(3)
+#define BMI3_POWER_SUMS                              UINT8_C(4)
+
+/*! Bytes of the data registers of the three axes of accel or gyro */
+#define BMI3_POWER_AXES_LEN                          UINT16_C(6)
+
+/*! Word read from FIFO data register once the FIFO is empty */
+#define BMI3_FIFO_EMPTY_WORD                         UINT16_C(0x8000)
+
 /*! Bit wise to define information */
 #define BMI3_I_MIN_VALUE                             UINT8_C(1)
 #define BMI3_I_MAX_VALUE                             UINT8_C(2)
@@ -187,12 +311,279 @@
 #define BMI3_ST_GYRO_ONLY                            UINT8_C(2)
 #define BMI3_ST_BOTH_ACC_GYR                         UINT8_C(3)
 
+/*! Self-test and self-calibration states */
+#define BMI3_ST_STATE_IDLE                           UINT8_C(0)
+#define BMI3_ST_STATE_RUNNING                        UINT8_C(1)
+#define BMI3_ST_STATE_COMPLETE                       UINT8_C(2)
+#define BMI3_ST_STATE_TIMEOUT                        UINT8_C(3)
+
+/*! Number of polls of the self-test status, every BMI3_ST_DELAY, before the self-test times out */
+#define BMI3_ST_POLL_LIMIT                           UINT8_C(10)
+
+/*! Number of polls of the self-calibration status, every BMI3_SC_DELAY, before the self-calibration times out */
+#define BMI3_SC_POLL_LIMIT                           UINT8_C(10)
+
 /*! Soft-reset delay */
 #define BMI3_SOFT_RESET_DELAY                        UINT16_C(1500)
 
+/*! Default interval and timeout in microseconds to poll the feature engine status after soft-reset */
+#define BMI3_FEATURE_ENGINE_POLL_DELAY               UINT32_C(100000)
+#define BMI3_FEATURE_ENGINE_TIMEOUT                  UINT32_C(1000000)
+
+/*! Operations of bmi3_op */
+#define BMI3_OP_NONE                                 UINT8_C(0)
+#define BMI3_OP_SOFT_RESET                           UINT8_C(1)
+#define BMI3_OP_SELF_TEST                            UINT8_C(2)
+#define BMI3_OP_GYRO_SC                              UINT8_C(3)
+#define BMI3_OP_UPLOAD_CONFIG                        UINT8_C(4)
+#define BMI3_OP_ACCEL_FOC                            UINT8_C(5)
+
+/*! Interval in microseconds of the data ready polls of the accel FOC, 50Hz ODR */
+#define BMI3_OP_FOC_DELAY                            UINT32_C(20000)
+
+/*! Number of data ready polls of the accel FOC before a sample times out */
+#define BMI3_OP_FOC_TRIES                            UINT8_C(5)
+
+/*! Maximum number of procedures of the plan of a calibration line */
+#define BMI3_CALIB_PLAN_MAX                          UINT8_C(4)
+
+/*! Stages of a unit of a bring-up */
+#define BMI3_BRING_UP_PROBE                          UINT8_C(0)
+#define BMI3_BRING_UP_RESET                          UINT8_C(1)
+#define BMI3_BRING_UP_SETUP                          UINT8_C(2)
+#define BMI3_BRING_UP_DONE                           UINT8_C(3)
+
+/*! Maximum number of feature engine words of a feature configuration, those of the step counter */
+#define BMI3_FEATURE_CODEC_MAX_WORDS                 UINT8_C(12)
+
+/*! Field of a feature configuration structure in the feature engine words */
+#define BMI3_FEATURE_FIELD(config, field, word, mask, pos) \
+    { (uint8_t)offsetof(struct config, field), (uint8_t)sizeof(((struct config *)0)->field), word, pos, mask }
+
+/*! Codec of a feature configuration from its array of fields */
+#define BMI3_FEATURE_CODEC(type, base_addr, n_words, lp_min_odr, fields) \
+    { type, base_addr, n_words, lp_min_odr, (uint8_t)(sizeof(fields) / sizeof((fields)[0])), fields }
+
+/*! Faults of a health snapshot */
+#define BMI3_HEALTH_FATAL                            UINT16_C(0x0001)
+#define BMI3_HEALTH_FEAT_ENG                         UINT16_C(0x0002)
+#define BMI3_HEALTH_CONF                             UINT16_C(0x0004)
+#define BMI3_HEALTH_I3C                              UINT16_C(0x0008)
+#define BMI3_HEALTH_POR                              UINT16_C(0x0010)
+#define BMI3_HEALTH_FEAT_ERR                         UINT16_C(0x0020)
+
+/*! Number of consumers of the scheduler */
+#define BMI3_SCHED_MAX_CONSUMERS                     UINT8_C(8)
+
+/*! Scheduler modes: samples read on the data-ready interrupt, or batched in FIFO */
+#define BMI3_SCHED_DRDY                              UINT8_C(0)
+#define BMI3_SCHED_FIFO                              UINT8_C(1)
+
+/*! Magnitude in LSB from which a sample is counted as saturated by the auto-range governor */
+#define BMI3_AUTO_RANGE_SAT_LSB                      UINT16_C(0x7FFF)
+
+/*! Number of feature engine words, from base address 0, which can be written at once by set sensor config */
+#define BMI3_FEATURE_BATCH_MAX_WORDS                 UINT8_C(0x24)
+
+/*! Maximum number of unchanged words rewritten by set feature image to join two runs of changed words,
+ *  as one transfer of a few more bytes costs less than a base address and data transfer more
+ */
+#define BMI3_FEATURE_IMAGE_MAX_GAP                   UINT8_C(4)
+
+/*! Start and number of registers covered by the shadow register cache */
+#define BMI3_CACHE_REG_START                         BMI3_REG_ACC_CONF
+#define BMI3_CACHE_REG_COUNT                         UINT8_C(32)
+
+/*! Configuration registers held by the cache, as bits relative to BMI3_CACHE_REG_START: ACC_CONF, GYR_CONF,
+ *  ALT_ACC_CONF, ALT_GYR_CONF, ALT_CONF, FIFO_WATERMARK, FIFO_CONF, IO_INT_CTRL, INT_CONF, INT_MAP1 and INT_MAP2
+ */
+#define BMI3_CACHE_REG_MASK                          UINT32_C(0x0F600703)
+
+/*! First feature engine word held by the cache, configurations from axis remap to alternate auto config */
+#define BMI3_CACHE_FEATURE_START                     BMI3_BASE_ADDR_AXIS_REMAP
+
+/*! Idle time in microseconds required after a write access before the next access. The datasheet
+ *  gives the same time for all power modes
+ */
+#ifndef BMI3_IDLE_TIME_US
+#define BMI3_IDLE_TIME_US                            UINT32_C(2)
+#endif
+
+/*! Value of "idle_time_us" of bmi3_dev for no idle time, if the bus itself keeps the gap */
+#define BMI3_IDLE_TIME_NONE                          UINT32_C(0xFFFFFFFF)
+
+/*! Number of bytes read back at once while verifying an uploaded config array */
+#define BMI3_UPLOAD_VERIFY_LEN                       UINT8_C(32)
+
+
+/*! Macro to define read data(0x03 to 0x0B) length, up to the sensor time */
+#define BMI3_READ_REG_DATA_TIME_LEN                  UINT8_C(18)
+
+/*! Byte offsets of gyro and temperature data in the read data(0x03 to 0x0F) */
+#define BMI3_READ_REG_DATA_GYR_POS                   UINT8_C(6)
+#define BMI3_READ_REG_DATA_TEMP_POS                  UINT8_C(12)
+/*! Calibration blob layout: version, chip-id, accel and gyro dp offset and gain registers, accel and gyro user
+ *  offset and gain words of the feature engine along with their reset word, axis remap word and CRC-16
+ */
+#define BMI3_CALIB_BLOB_VERSION                      UINT8_C(1)
+#define BMI3_CALIB_BLOB_DP_POS                       UINT8_C(2)
+#define BMI3_CALIB_BLOB_DP_LEN                       UINT8_C(24)
+#define BMI3_CALIB_BLOB_USR_POS                      UINT8_C(26)
+#define BMI3_CALIB_BLOB_USR_LEN                      UINT8_C(26)
+#define BMI3_CALIB_BLOB_REMAP_POS                    UINT8_C(52)
+#define BMI3_CALIB_BLOB_CRC_POS                      UINT8_C(54)
+#define BMI3_CALIB_BLOB_LEN                          UINT8_C(56)
+
+/*! Initial value and polynomial of the CRC-16 of the calibration blob (CRC-16/CCITT-FALSE) */
+#define BMI3_CALIB_CRC_INIT                          UINT16_C(0xFFFF)
+#define BMI3_CALIB_CRC_POLY                          UINT16_C(0x1021)
+
+/*! Configuration image: feature engine words from axis remap to alternate auto config, registers from ACC_CONF
+ *  to ALT_CONF and from FIFO_WATERMARK to INT_MAP2
+ */
+#define BMI3_CONFIG_IMAGE_FEATURE_MASK               UINT64_C(0x0000000FFFFFFFF8)
+#define BMI3_CONFIG_IMAGE_SENS_LEN                   UINT8_C(22)
+#define BMI3_CONFIG_IMAGE_ALT_POS                    UINT8_C(16)
+#define BMI3_CONFIG_IMAGE_ALT_LEN                    UINT8_C(6)
+#define BMI3_CONFIG_IMAGE_INT_LEN                    UINT8_C(14)
+#define BMI3_CONFIG_IMAGE_FIFO_CTRL_POS              UINT8_C(4)
+
+/*! Number of ODR settings of the low-power ODR and averaging validity table */
+#define BMI3_ODR_AVG_VALID_COUNT                     UINT8_C(16)
+
+/*! Macro to define read data(0x03 to 0x0C) length, up to the saturation flags */
+#define BMI3_READ_REG_DATA_SAT_LEN                   UINT8_C(20)
+
 /*! Macro to define read data(0x03 to 0x0F) length */
 #define BMI3_READ_REG_DATA_LEN                       UINT8_C(26)
 
+/*! Macro to define read data(0x03 to 0x13) length, along with step counter */
+#define BMI3_READ_REG_DATA_STEP_LEN                  UINT8_C(34)
+
+/*! Asynchronous transfer states */
+#define BMI3_ASYNC_IDLE                              UINT8_C(0)
+#define BMI3_ASYNC_FIFO_CONF                         UINT8_C(1)
+#define BMI3_ASYNC_FIFO_DATA                         UINT8_C(2)
+#define BMI3_ASYNC_SENSOR_DATA                       UINT8_C(3)
+#define BMI3_ASYNC_INT_STATUS                        UINT8_C(4)
+#define BMI3_ASYNC_FIFO_SERVICE                      UINT8_C(5)
+
+/*! Length of interrupt status registers INT1 and INT2 read asynchronously */
+#define BMI3_ASYNC_INT_STATUS_LEN                    UINT8_C(4)
+
+/*! Length of registers from INT_STATUS_INT1 to FIFO_FILL_LEVEL read by FIFO service */
+#define BMI3_FIFO_SERVICE_LEN                        UINT8_C(18)
+
+/*! Byte offset of FIFO fill level in the data read by FIFO service */
+#define BMI3_FIFO_SERVICE_FILL_LEVEL_POS             UINT8_C(16)
+
+/*! Number of fraction bits of the fixed-point unit conversion output */
+#define BMI3_UNIT_Q_FRAC_BITS                        UINT8_C(16)
+
+/*! Temperature conversion: degree celsius = LSB / 512 + 23 */
+#define BMI3_TEMP_LSB_PER_DEGC                       INT32_C(512)
+#define BMI3_TEMP_OFFSET_DEGC                        INT32_C(23)
+
+/*! Number of fraction bits of the gain of the axes correction, gain of 1.0 */
+#define BMI3_AXES_CORR_GAIN_FRAC_BITS                UINT8_C(14)
+#define BMI3_AXES_CORR_GAIN_UNITY                    UINT16_C(0x4000)
+
+/*! Maximum number of temperature points of a thermal compensation table */
+#define BMI3_THERMAL_MAX_POINTS                      UINT8_C(16)
+
+/*! Range of the corrected 16-bit data */
+#define BMI3_AXES_CORR_DATA_MAX                      INT32_C(32767)
+#define BMI3_AXES_CORR_DATA_MIN                      INT32_C(-32768)
+
+/*! Number of register addresses counted by the bus statistics */
+#define BMI3_BUS_STATS_REGS                          UINT8_C(128)
+
+/*! Number of bins of the bus transaction time histogram, bin n counts times below 2^n microseconds */
+#define BMI3_BUS_STATS_HIST_BINS                     UINT8_C(16)
+
+/*! Number of feature interrupts tracked by the event latency, INT_STATUS bits 0 (no-motion) to 8 (tap) */
+#define BMI3_EVENT_LATENCY_FEATURES                  UINT8_C(9)
+
+/*! Number of bins of the event latency histogram, bin n counts latencies below 2^n microseconds */
+#define BMI3_EVENT_LATENCY_HIST_BINS                 UINT8_C(24)
+
+/*! Maximum number of devices in a device group */
+#define BMI3_GROUP_MAX_DEV                           UINT8_C(8)
+
+/*! Index returned once all devices of a group are serviced */
+#define BMI3_GROUP_DONE                              UINT8_C(0xFF)
+
+/*! Maximum number of buffers of a ping-pong FIFO acquisition */
+#define BMI3_PINGPONG_MAX_BUF                        UINT8_C(4)
+
+/*! Index returned if no buffer of a ping-pong FIFO acquisition is ready */
+#define BMI3_PINGPONG_NONE                           UINT8_C(0xFF)
+
+/*! Maximum number of samples of a block of the delta-encoded sample format */
+#define BMI3_DELTA_BLOCK_SAMPLES                     UINT8_C(16)
+
+/*! Maximum bit width of a zigzag-encoded delta of two 16-bit samples */
+#define BMI3_DELTA_MAX_WIDTH                         UINT8_C(17)
+
+/*! Length of the header of a block: number of samples and bit width of each axis */
+#define BMI3_DELTA_HEADER_LEN                        UINT8_C(3)
+
+/*! Maximum length of a block of the delta-encoded sample format */
+#define BMI3_DELTA_BLOCK_MAX_LEN \
+    (BMI3_DELTA_HEADER_LEN + (((BMI3_DELTA_BLOCK_SAMPLES * 3 * BMI3_DELTA_MAX_WIDTH) + 7) / 8))
+
+/*! Saturation side-band bits of a packed sample */
+#define BMI3_PACKED_SAT_X                            UINT8_C(0x01)
+#define BMI3_PACKED_SAT_Y                            UINT8_C(0x02)
+#define BMI3_PACKED_SAT_Z                            UINT8_C(0x04)
+
+/*! Length of the saturation side-band of a packed buffer, 4 bits per sample */
+#define BMI3_PACKED_SAT_LEN(n)                       (((n) + 1) / 2)
+
+/*! States of the flight recorder */
+#define BMI3_FLIGHT_REC_ARMED                        UINT8_C(0)
+#define BMI3_FLIGHT_REC_TRIGGERED                    UINT8_C(1)
+#define BMI3_FLIGHT_REC_FROZEN                       UINT8_C(2)
+
+/*! Polls of the completion of a staged axis remap, and their period in microseconds */
+#define BMI3_REMAP_APPLY_POLLS                       UINT8_C(100)
+#define BMI3_REMAP_APPLY_POLL_US                     UINT32_C(1000)
+
+/*! Maximum number of integrator and comb stages of the CIC decimator */
+#define BMI3_DECIM_MAX_ORDER                         UINT8_C(4)
+
+/*! Maximum bit growth of the CIC decimator, order times log2 of the ratio, as 16-bit samples are filtered in
+ *  32-bit two's complement arithmetic
+ */
+#define BMI3_DECIM_MAX_GROWTH                        UINT8_C(16)
+
+/*! Maximum number of frequency bins and samples of a block of the spectral summary */
+#define BMI3_SPECTRUM_MAX_BINS                       UINT8_C(16)
+#define BMI3_SPECTRUM_MAX_LEN                        UINT16_C(256)
+
+/*! Fraction bits of the Goertzel filter coefficients */
+#define BMI3_GOERTZEL_FRAC_BITS                      UINT8_C(14)
+
+/*! Fraction bits of the quaternion and of the unit vectors of the orientation fusion */
+#define BMI3_FUSION_Q_FRAC_BITS                      UINT8_C(30)
+
+/*! Degree to radian with BMI3_FUSION_Q_FRAC_BITS fraction bits */
+#define BMI3_FUSION_DEG_TO_RAD                       INT64_C(18740330)
+
+/*! Maximum deviation of the accel magnitude from 1g for the accel to correct the orientation fusion, in g with
+ *  BMI3_UNIT_Q_FRAC_BITS fraction bits
+ */
+#define BMI3_FUSION_ACC_GATE                         INT32_C(16384)
+
+/*! Maximum time step of the orientation fusion in sensor time ticks, longer gaps are limited to it */
+#define BMI3_FUSION_MAX_DT                           UINT32_C(2560)
+
+/*! Number of times the devices of an i3c sync group are read again to get the same sync time */
+#define BMI3_I3C_SYNC_READ_RETRY                     UINT8_C(2)
+
+/*! Number of bytes of the i3c sync accel, gyro, temperature and time data */
+#define BMI3_NUM_BYTES_I3C_SYNC_ALL                  UINT8_C(16)
+
 /***************************************************************************** */
 /*!         Sensor Macro Definitions                 */
 /***************************************************************************** */
@@ -1162,6 +1553,26 @@ in INT_STATUS_INT1/2. */
 #define BMI3_IBI_STATUS_FWM                          UINT16_C(0x4000)
 #define BMI3_IBI_STATUS_FFULL                        UINT16_C(0x8000)
 
+/*! Interrupt status registers read by the interrupt dispatcher */
+#define BMI3_INT_SRC_INT1                            UINT8_C(0x01)
+#define BMI3_INT_SRC_INT2                            UINT8_C(0x02)
+#define BMI3_INT_SRC_IBI                             UINT8_C(0x04)
+#define BMI3_INT_SRC_ALL                             UINT8_C(0x07)
+
+/*! Number of interrupt status bits */
+#define BMI3_INT_STATUS_BIT_COUNT                    UINT8_C(16)
+
+/*! Interrupt status bits whose payload is read from the data registers */
+#define BMI3_INT_STATUS_DRDY_ALL \
+    (BMI3_INT_STATUS_ACC_DRDY | BMI3_INT_STATUS_GYR_DRDY | BMI3_INT_STATUS_TEMP_DRDY)
+
+/*! Interrupt status bits of the data sources, the others being feature events */
+#define BMI3_INT_STATUS_DATA_ALL \
+    (BMI3_INT_STATUS_DRDY_ALL | BMI3_INT_STATUS_FWM | BMI3_INT_STATUS_FFULL)
+
+/*! Number of bits of the pin of an interrupt source in INT_MAP1 and INT_MAP2 */
+#define BMI3_INT_MAP_BITS                            UINT8_C(2)
+
 /******************************************************************************/
 /*!  Mask definitions for feature interrupts configuration  */
 /******************************************************************************/
@@ -1456,6 +1867,76 @@ in INT_STATUS_INT1/2. */
 #define BMI3_GYR_BW_ODR_HALF                         UINT8_C(0)
 #define BMI3_GYR_BW_ODR_QUARTER                      UINT8_C(1)
 
+/******************************************************************************/
+/*!        Register Image Macro Definitions               */
+/******************************************************************************/
+/*! Evaluates to zero, fails to compile if the constant condition is false */
+#define BMI3_CHECK_CONST(cond)                       (0 * sizeof(char[(cond) ? 1 : -1]))
+
+/*! Averaging numbers valid in low-power mode per ODR, as bit mask of BMI3_ACC_AVG* and BMI3_GYR_AVG* */
+#define BMI3_ODR_AVG_VALID_MASK(odr) \
+    (((odr) == 0) ? 0x00 : ((odr) <= 7) ? 0x7F : ((odr) == 8) ? 0x3F : ((odr) == 9) ? 0x1F : \
+     ((odr) == 10) ? 0x0F : 0x00)
+
+/*! Non-zero if the accelerometer configuration is accepted by bmi3_set_sensor_config without auto-correction */
+#define BMI3_ACC_CONF_VALID(odr, range, bw, avg, mode) \
+    (((odr) >= BMI3_ACC_ODR_0_78HZ) && ((odr) <= BMI3_ACC_ODR_6400HZ) && ((range) <= BMI3_ACC_RANGE_16G) && \
+     ((bw) <= BMI3_ACC_BW_ODR_QUARTER) && ((avg) <= BMI3_ACC_AVG64) && \
+     (((mode) == BMI3_ACC_MODE_DISABLE) || \
+      (((mode) == BMI3_ACC_MODE_LOW_PWR) && ((BMI3_ODR_AVG_VALID_MASK(odr) >> (avg)) & 1)) || \
+      ((((mode) == BMI3_ACC_MODE_NORMAL) || ((mode) == BMI3_ACC_MODE_HIGH_PERF)) && ((odr) > BMI3_ACC_ODR_6_25HZ))))
+
+/*! Non-zero if the gyro configuration is accepted by bmi3_set_sensor_config without auto-correction */
+#define BMI3_GYR_CONF_VALID(odr, range, bw, avg, mode) \
+    (((odr) >= BMI3_GYR_ODR_0_78HZ) && ((odr) <= BMI3_GYR_ODR_6400HZ) && ((range) <= BMI3_GYR_RANGE_2000DPS) && \
+     ((bw) <= BMI3_GYR_BW_ODR_QUARTER) && ((avg) <= BMI3_GYR_AVG64) && \
+     (((mode) == BMI3_GYR_MODE_DISABLE) || ((mode) == BMI3_GYR_MODE_SUSPEND) || \
+      (((mode) == BMI3_GYR_MODE_LOW_PWR) && ((BMI3_ODR_AVG_VALID_MASK(odr) >> (avg)) & 1)) || \
+      ((mode) == BMI3_GYR_MODE_NORMAL) || ((mode) == BMI3_GYR_MODE_HIGH_PERF)))
+
+/*! ACC_CONF register value of an accelerometer configuration given by BMI3_ACC_ODR_*, BMI3_ACC_RANGE_*,
+ *  BMI3_ACC_BW_ODR_*, BMI3_ACC_AVG* and BMI3_ACC_MODE_*. Constant arguments only, an invalid combination fails
+ *  to compile
+ */
+#define BMI3_ACC_CONF_IMAGE(odr, range, bw, avg, mode) \
+    ((uint16_t)(((odr) | ((range) << BMI3_ACC_RANGE_POS) | ((bw) << BMI3_ACC_BW_POS) | \
+                 ((avg) << BMI3_ACC_AVG_NUM_POS) | ((mode) << BMI3_ACC_MODE_POS)) + \
+                BMI3_CHECK_CONST(BMI3_ACC_CONF_VALID(odr, range, bw, avg, mode))))
+
+/*! GYR_CONF register value of a gyro configuration given by BMI3_GYR_ODR_*, BMI3_GYR_RANGE_*,
+ *  BMI3_GYR_BW_ODR_*, BMI3_GYR_AVG* and BMI3_GYR_MODE_*. Constant arguments only, an invalid combination fails
+ *  to compile
+ */
+#define BMI3_GYR_CONF_IMAGE(odr, range, bw, avg, mode) \
+    ((uint16_t)(((odr) | ((range) << BMI3_GYR_RANGE_POS) | ((bw) << BMI3_GYR_BW_POS) | \
+                 ((avg) << BMI3_GYR_AVG_NUM_POS) | ((mode) << BMI3_GYR_MODE_POS)) + \
+                BMI3_CHECK_CONST(BMI3_GYR_CONF_VALID(odr, range, bw, avg, mode))))
+
+/*! FIFO_CONF register value of the sensors stored in FIFO, BMI3_FIFO_*_EN, and of stop on full,
+ *  BMI3_ENABLE or BMI3_DISABLE
+ */
+#define BMI3_FIFO_CONF_IMAGE(sens, stop_on_full) \
+    ((uint16_t)(((sens) | (stop_on_full)) + \
+                BMI3_CHECK_CONST((((sens) & ~BMI3_FIFO_ALL_EN) == 0) && ((stop_on_full) <= BMI3_ENABLE))))
+
+/*! INT_MAP1 register value of the interrupt pins, enum bmi3_hw_int_pin, of the features */
+#define BMI3_INT_MAP1_IMAGE(no_motion, any_motion, flat, orientation, step_detector, step_counter, sig_motion, tilt) \
+    ((uint16_t)(((no_motion) | ((any_motion) << BMI3_ANY_MOTION_OUT_POS) | ((flat) << BMI3_FLAT_OUT_POS) | \
+                 ((orientation) << BMI3_ORIENTATION_OUT_POS) | ((step_detector) << BMI3_STEP_DETECTOR_OUT_POS) | \
+                 ((step_counter) << BMI3_STEP_COUNTER_OUT_POS) | ((sig_motion) << BMI3_SIG_MOTION_OUT_POS) | \
+                 ((tilt) << BMI3_TILT_OUT_POS)) + \
+                BMI3_CHECK_CONST(((no_motion) | (any_motion) | (flat) | (orientation) | (step_detector) | \
+                                  (step_counter) | (sig_motion) | (tilt)) < BMI3_INT_PIN_MAX)))
+
+/*! INT_MAP2 register value of the interrupt pins, enum bmi3_hw_int_pin, of the features and data interrupts */
+#define BMI3_INT_MAP2_IMAGE(tap, i3c, err_status, temp_drdy, gyr_drdy, acc_drdy, fifo_wm, fifo_full) \
+    ((uint16_t)(((tap) | ((i3c) << BMI3_I3C_OUT_POS) | ((err_status) << BMI3_ERR_STATUS_POS) | \
+                 ((temp_drdy) << BMI3_TEMP_DRDY_INT_POS) | ((gyr_drdy) << BMI3_GYR_DRDY_INT_POS) | \
+                 ((acc_drdy) << BMI3_ACC_DRDY_INT_POS) | ((fifo_wm) << BMI3_FIFO_WATERMARK_INT_POS) | \
+                 ((fifo_full) << BMI3_FIFO_FULL_INT_POS)) + \
+                BMI3_CHECK_CONST(((tap) | (i3c) | (err_status) | (temp_drdy) | (gyr_drdy) | (acc_drdy) | \
+                                  (fifo_wm) | (fifo_full)) < BMI3_INT_PIN_MAX)))
+
 /******************************************************************************/
 /*!        Alternate Accelerometer Macro Definitions               */
 /******************************************************************************/
@@ -1627,6 +2108,38 @@ in INT_STATUS_INT1/2. */
 #define BMI3_LENGTH_FIFO_DATA                        UINT8_C(2)
 #define BMI3_LENGTH_FIFO_MSB_BYTE                    UINT8_C(1)
 
+/*! Length of a FIFO frame in bytes for a FIFO frame content configuration */
+#define BMI3_CTX_FRAME_LEN(fifo_config) \
+    ((((fifo_config) & BMI3_FIFO_ACC_EN) ? BMI3_LENGTH_FIFO_ACC : 0) + \
+     (((fifo_config) & BMI3_FIFO_GYR_EN) ? BMI3_LENGTH_FIFO_GYR : 0) + \
+     (((fifo_config) & BMI3_FIFO_TEMP_EN) ? BMI3_LENGTH_TEMPERATURE : 0) + \
+     (((fifo_config) & BMI3_FIFO_TIME_EN) ? BMI3_LENGTH_SENSOR_TIME : 0))
+
+/*! Maximum number of FIFO frames in the given number of FIFO words */
+#define BMI3_CTX_FRAMES(fifo_words, fifo_config) \
+    (((fifo_words) * 2) / BMI3_CTX_FRAME_LEN(fifo_config))
+
+/*! Length of the register read scratch buffer of the context, only used with BMI3_DEV_SCRATCH */
+#ifdef BMI3_DEV_SCRATCH
+#define BMI3_CTX_SCRATCH_LEN                         BMI3_MAX_LEN
+#else
+#define BMI3_CTX_SCRATCH_LEN                         0
+#endif
+
+/*! Size of the arena of a context in bytes: output arrays of the sensors enabled in
+ *  FIFO, raw FIFO buffer along with the dummy bytes and scratch buffer. One byte is
+ *  reserved to align the output arrays
+ */
+#define BMI3_CTX_ARENA_SIZE(fifo_words, fifo_config) \
+    (1 + \
+     ((((fifo_config) & BMI3_FIFO_ACC_EN) ? BMI3_CTX_FRAMES(fifo_words, fifo_config) : 0) * \
+      sizeof(struct bmi3_fifo_sens_axes_data)) + \
+     ((((fifo_config) & BMI3_FIFO_GYR_EN) ? BMI3_CTX_FRAMES(fifo_words, fifo_config) : 0) * \
+      sizeof(struct bmi3_fifo_sens_axes_data)) + \
+     ((((fifo_config) & BMI3_FIFO_TEMP_EN) ? BMI3_CTX_FRAMES(fifo_words, fifo_config) : 0) * \
+      sizeof(struct bmi3_fifo_temperature_data)) + \
+     ((fifo_words) * 2) + BMI3_MAX_DUMMY_BYTE + BMI3_CTX_SCRATCH_LEN)
+
 /*! BMI3 Mask definitions of FIFO configuration registers */
 #define BMI3_FIFO_CONFIG_MASK                        UINT16_C(0x0F01)
 
@@ -1637,6 +2150,23 @@ in INT_STATUS_INT1/2. */
 #define BMI3_FIFO_HEAD_LESS_TEMP_FRM                 UINT16_C(0x0800)
 #define BMI3_FIFO_HEAD_LESS_ALL_FRM                  UINT16_C(0x0F00)
 
+/*! BMI3 headerless FIFO frame layout definitions */
+#define BMI3_FIFO_MAX_LAYOUTS                        UINT8_C(16)
+#define BMI3_FIFO_LAYOUT_POS                         UINT8_C(8)
+#define BMI3_FIFO_NO_DATA                            UINT8_C(0xFF)
+
+/*! Pair index of a sample of the multi-rate extraction without a gyro sample in the same frame */
+#define BMI3_FIFO_NO_PAIR                            UINT16_C(0xFFFF)
+
+/*! Number of frames pushed at once to the sample queues if temperature is stored in FIFO, temperature is dropped */
+#define BMI3_SAMPLE_QUEUE_TEMP_CHUNK                 UINT8_C(16)
+
+/*! Maximum number of frames kept for the latest frames peek */
+#define BMI3_LATEST_MAX_FRAMES                       UINT8_C(8)
+
+/*! Number of bytes of a data register read of accel, gyro, temperature and the low word of the sensor time */
+#define BMI3_LATEST_REG_LEN                          UINT8_C(16)
+
 /******************************************************************************/
 /*! @name       CFG RES Macro Definitions                                     */
 /******************************************************************************/
@@ -1711,6 +2241,15 @@ in INT_STATUS_INT1/2. */
 
 #define BMI3_FOC_SAMPLE_LIMIT         UINT8_C(128)
 
+/*! Largest number of samples of FIFO-based accel FOC, accel-only frames filling the FIFO */
+#define BMI3_FOC_FIFO_MAX_SAMPLES     (BMI3_FIFO_SIZE_WORDS / (BMI3_LENGTH_FIFO_ACC / 2))
+
+/*! Number of frames read from FIFO at once by FIFO-based accel FOC */
+#define BMI3_FOC_FIFO_CHUNK_FRAMES    UINT8_C(32)
+
+/*! Number of FIFO fill level checks of FIFO-based accel FOC before it times out */
+#define BMI3_FOC_FIFO_TRY_CNT         UINT8_C(5)
+
 #define BMI3_ACC_2G_MAX_NOISE_LIMIT   (BMI3_ACC_FOC_2G_REF + BMI3_ACC_FOC_2G_OFFSET)
 #define BMI3_ACC_2G_MIN_NOISE_LIMIT   (BMI3_ACC_FOC_2G_REF - BMI3_ACC_FOC_2G_OFFSET)
 #define BMI3_ACC_4G_MAX_NOISE_LIMIT   (BMI3_ACC_FOC_4G_REF + BMI3_ACC_FOC_4G_OFFSET)
@@ -1737,9 +2276,53 @@ in INT_STATUS_INT1/2. */
 /*! Sensortime resolution in seconds */
 #define BMI3_SENSORTIME_RESOLUTION    0.0000390625f
 
+/*! Sensortime resolution in microseconds as a fraction: 39.0625 = 625 / 16 */
+#define BMI3_SENSORTIME_US_NUM        UINT32_C(625)
+#define BMI3_SENSORTIME_US_DEN        UINT32_C(16)
+
+/*! Sample period at 6400Hz ODR in sensor time ticks */
+#define BMI3_FIFO_TIME_6400HZ_TICKS   UINT32_C(4)
+
+/*! Number of sensor time ticks per second */
+#define BMI3_SENSORTIME_TICKS_PER_S   UINT32_C(25600)
+
+/*! Number of bins of the jitter histogram of the FIFO frame intervals */
+#define BMI3_FIFO_JITTER_BINS         UINT8_C(8)
+
+/*! Number of fraction bits of the average FIFO frame interval */
+#define BMI3_FIFO_JITTER_FRAC         UINT8_C(12)
+
+/*! Weight of a FIFO frame interval in the running average, 1 / 2^shift */
+#define BMI3_FIFO_JITTER_AVG_SHIFT    UINT8_C(4)
+#define BMI3_FIFO_JITTER_AVG_ROUND    UINT32_C(8)
+
+/*! Step duration of an increment of the step counter in microseconds above which a bout ends */
+#define BMI3_STEP_CADENCE_PAUSE_US    UINT32_C(2000000)
+
+/*! Weight of an increment of the step counter in the running averages, 1 / 2^shift */
+#define BMI3_STEP_CADENCE_AVG_SHIFT   UINT8_C(2)
+
+/*! Number of (sensor time, host time) samples of the clock synchronization window */
+#define BMI3_CLOCK_SYNC_SAMPLES       UINT8_C(8)
+
+/*! Number of fraction bits of the rate of the clock synchronization */
+#define BMI3_CLOCK_SYNC_RATE_FRAC     UINT8_C(16)
+
+/*! Nominal rate of the clock synchronization: 39062.5 ns per tick */
+#define BMI3_CLOCK_SYNC_NOMINAL_RATE  INT64_C(2560000000)
+
+/*! Minimum span of the window in sensor time ticks to estimate the drift, 1 s */
+#define BMI3_CLOCK_SYNC_MIN_SPAN      UINT64_C(25600)
+
+/*! Maximum span of the window in host nanoseconds to estimate the drift */
+#define BMI3_CLOCK_SYNC_MAX_SPAN_NS   (UINT64_C(1) << 46)
+
 /*! Maximum available register length */
 #define BMI3_MAX_LEN                  UINT8_C(128)
 
+/*! Maximum number of dummy bytes preceding the data of a register read */
+#define BMI3_MAX_DUMMY_BYTE           UINT8_C(2)
+
 #define BMI3_ACC_2G                   UINT8_C(2)
 #define BMI3_ACC_4G                   UINT8_C(4)
 #define BMI3_ACC_8G                   UINT8_C(8)
@@ -1766,6 +2349,9 @@ in INT_STATUS_INT1/2. */
 #define BMI3_SC_ST_VALUE_7            UINT16_C(0xFFCD)
 #define BMI3_SC_ST_VALUE_8            UINT16_C(0xEF6C)
 
+/*! Number of bytes of the gyro self-calibration/self-test coefficients */
+#define BMI3_SC_ST_COEFF_LEN          UINT8_C(18)
+
 #define BMI3_SC_SENSITIVITY_EN        UINT8_C(1)
 #define BMI3_SC_OFFSET_EN             UINT8_C(2)
 
@@ -1820,6 +2406,162 @@ typedef BMI3_INTF_RET_TYPE (*bmi3_write_fptr_t)(uint8_t reg_addr, const uint8_t
  */
 typedef void (*bmi3_delay_us_fptr_t)(uint32_t period, void *intf_ptr);
 
+/*!
+ * @brief Lock function pointer which should be mapped to a recursive lock,
+ * e.g. a recursive mutex, of the device
+ *
+ * @param[in,out] intf_ptr : Void pointer that can enable the linking of descriptors
+ *                           for interface related callbacks
+ */
+typedef void (*bmi3_lock_fptr_t)(void *intf_ptr);
+
+/*!
+ * @brief Batch begin function pointer. Until the matching batch end, the platform
+ * may queue writes and delays instead of submitting them, e.g. as one SPI message
+ * list or I2C combined transfer. Queued operations have to be submitted in order
+ * before a read is done
+ *
+ * @param[in,out] intf_ptr : Void pointer that can enable the linking of descriptors
+ *                           for interface related callbacks
+ */
+typedef void (*bmi3_batch_begin_fptr_t)(void *intf_ptr);
+
+/*!
+ * @brief Batch end function pointer, which should submit the queued operations
+ *
+ * @param[in,out] intf_ptr : Void pointer that can enable the linking of descriptors
+ *                           for interface related callbacks
+ *
+ * @retval 0 for Success
+ * @retval Non-zero for Failure
+ */
+typedef BMI3_INTF_RET_TYPE (*bmi3_batch_end_fptr_t)(void *intf_ptr);
+
+
+struct bmi3_dev;
+
+#ifdef BMI3_BUS_STATS
+
+/*!
+ * @brief Timestamp function pointer which should be mapped to a free running
+ * microsecond counter of the user, used by the bus statistics
+ *
+ * @param[in,out] intf_ptr : Void pointer that can enable the linking of descriptors
+ *                           for interface related callbacks
+ *
+ * @return Timestamp in microseconds
+ */
+typedef uint32_t (*bmi3_timestamp_us_fptr_t)(void *intf_ptr);
+#endif
+
+/*!
+ * @brief Host time function pointer which should be mapped to the clock the
+ * sensor time is synchronized to, e.g. a monotonic or PTP clock
+ *
+ * @param[in,out] intf_ptr : Void pointer that can enable the linking of descriptors
+ *                           for interface related callbacks
+ *
+ * @return Host time in nanoseconds
+ */
+typedef uint64_t (*bmi3_host_time_ns_fptr_t)(void *intf_ptr);
+
+/*!
+ * @brief Asynchronous transfer completion function pointer which is
+ * called by the driver once an asynchronous request is complete
+ *
+ * @param[in]     rslt : Result of the asynchronous request
+ * @param[in,out] dev  : Structure instance of bmi3_dev
+ */
+typedef void (*bmi3_async_done_fptr_t)(int8_t rslt, struct bmi3_dev *dev);
+
+/*!
+ * @brief Variant setup function pointer which is called by bmi3_probe_and_init
+ * once the chip-id matched the variant, to configure what the variant needs
+ * after a soft-reset (e.g. context or RAM patch)
+ *
+ * @param[in,out] dev : Structure instance of bmi3_dev
+ *
+ * @retval 0 -> Success
+ * @retval < 0 -> Failure Info
+ */
+typedef int8_t (*bmi3_variant_setup_fptr_t)(struct bmi3_dev *dev);
+struct bmi3_fifo_sens_axes_planes;
+
+/*!
+ * @brief FIFO unpack function pointer which can be mapped to a platform
+ * specific (e.g. SIMD/CMSIS-DSP vectorized) implementation of the user, e.g.
+ * of "bmi3_fifo_simd.h".
+ * It deinterleaves the accelerometer or gyro data of complete headerless
+ * frames into separate arrays and drops the dummy frames.
+ *
+ * @param[in]  frames           : Pointer to the first byte of the first frame
+ * @param[in]  frame_count      : Number of complete frames
+ * @param[in]  frame_len        : Length of a frame in bytes
+ * @param[in]  axes_offset      : Byte offset of x, y and z data in the frame
+ * @param[in]  sens_time_offset : Byte offset of sensor time in the frame,
+ *                                BMI3_FIFO_NO_DATA if sensor time is not available
+ *                                (sensor time is then stored as 0)
+ * @param[in]  dummy_frame      : Value of x-axis data denoting a dummy frame
+ * @param[out] planes           : Arrays where the data is stored; sensor_time
+ *                                array may be NULL
+ *
+ * @return Number of frames stored in the arrays
+ */
+typedef uint16_t (*bmi3_fifo_unpack_axes_fptr_t)(const uint8_t *frames, uint16_t frame_count, uint8_t frame_len,
+                                                 uint8_t axes_offset, uint8_t sens_time_offset, uint16_t dummy_frame,
+                                                 const struct bmi3_fifo_sens_axes_planes *planes);
+struct bmi3_fifo_sens_axes_data;
+
+/*!
+ * @brief FIFO unpack function pointer for the structure output of
+ * "bmi3_extract_accel", "bmi3_extract_gyro" and "bmi3_extract_all", which can be
+ * mapped to a platform specific implementation, e.g. of "bmi3_fifo_simd.h".
+ * It copies the accelerometer or gyro data of complete headerless frames into
+ * the structure array and drops the dummy frames.
+ *
+ * @param[in]  frames           : Pointer to the first byte of the first frame
+ * @param[in]  frame_count      : Number of complete frames
+ * @param[in]  frame_len        : Length of a frame in bytes
+ * @param[in]  axes_offset      : Byte offset of x, y and z data in the frame
+ * @param[in]  sens_time_offset : Byte offset of sensor time in the frame,
+ *                                BMI3_FIFO_NO_DATA if sensor time is not available
+ *                                (sensor time is then stored as 0)
+ * @param[in]  dummy_frame      : Value of x-axis data denoting a dummy frame
+ * @param[out] data             : Array where the data is stored
+ *
+ * @return Number of frames stored in the array
+ */
+typedef uint16_t (*bmi3_fifo_unpack_frames_fptr_t)(const uint8_t *frames, uint16_t frame_count, uint8_t frame_len,
+                                                   uint8_t axes_offset, uint8_t sens_time_offset, uint16_t dummy_frame,
+                                                   struct bmi3_fifo_sens_axes_data *data);
+
+/*!
+ * @brief Goertzel kernel function pointer which can be mapped to a platform
+ * specific (e.g. SIMD/CMSIS-DSP vectorized) implementation of the user. It
+ * runs the samples of an axis through a bank of Goertzel filters:
+ * s = x + ((coeff * s1) >> 14) - s2, then s2 = s1 and s1 = s.
+ *
+ * @param[in]     data   : Samples of the axis
+ * @param[in]     count  : Number of samples
+ * @param[in]     coeff  : 2 * cos(2 * pi * bin / block length) of each filter, with 14 fraction bits
+ * @param[in]     n_bins : Number of filters
+ * @param[in,out] s1     : Last state of each filter
+ * @param[in,out] s2     : State before the last of each filter
+ */
+typedef void (*bmi3_goertzel_fptr_t)(const int16_t *data, uint16_t count, const int32_t *coeff, uint8_t n_bins,
+                                     int32_t *s1, int32_t *s2);
+struct bmi3_int_event_data;
+
+/*!
+ * @brief Interrupt event function pointer which is called by the interrupt
+ * dispatcher for each registered interrupt status bit that fired
+ *
+ * @param[in] int_status : Interrupt status bit that fired, one of BMI3_INT_STATUS_*
+ * @param[in] data       : Interrupt status and payload read by the dispatcher
+ * @param[in] ctx        : User context of the dispatcher
+ */
+typedef void (*bmi3_int_event_fptr_t)(uint16_t int_status, const struct bmi3_int_event_data *data, void *ctx);
+
 /********************************************************* */
 /*!                  Enumerators                          */
 /********************************************************* */
@@ -1870,6 +2612,19 @@ struct bmi3_axes_remap
     uint8_t invert_z;
 };
 
+/*!
+ * @brief Structure to define an axis remap staged for a fast apply, with the
+ * feature engine word computed in advance
+ */
+struct bmi3_remap_stage
+{
+    /*! Axis remap, e.g. for a software remap by "bmi3_set_axes_correction" */
+    struct bmi3_axes_remap remap;
+
+    /*! Axis remap word of the feature engine */
+    uint8_t word[2];
+};
+
 /*!
  * @brief Store Accel data in terms of RAW, g_val, ms2
  */
@@ -1900,6 +2655,30 @@ struct bmi3_gyro_processed_data
     float gyro_rps;
 };
 
+/*!
+ * @brief Structure to define the layout of a headerless FIFO frame
+ */
+struct bmi3_fifo_frame_layout
+{
+    /*! Sensor enable status of FIFO for which the layout is valid */
+    uint16_t fifo_sens;
+
+    /*! Length of the frame in bytes */
+    uint8_t frame_len;
+
+    /*! Byte offset of accelerometer data in the frame */
+    uint8_t acc_offset;
+
+    /*! Byte offset of gyro data in the frame */
+    uint8_t gyr_offset;
+
+    /*! Byte offset of temperature data in the frame */
+    uint8_t temp_offset;
+
+    /*! Byte offset of sensor time in the frame */
+    uint8_t sens_time_offset;
+};
+
 /*!
  * @brief Structure to define FIFO frame configuration
  */
@@ -1933,27 +2712,655 @@ struct bmi3_fifo_frame
 
     /*! To store available fifo temperature frames */
     uint16_t avail_fifo_temp_frames;
+
+    /*! Layout of the frame, selected by "bmi3_read_fifo_data" */
+    const struct bmi3_fifo_frame_layout *layout;
 };
 
 /*!
- * @brief Primary device structure
+ * @brief Structure to define the number of frames of FIFO data, counted
+ * without parsing the data
  */
-struct bmi3_dev
+struct bmi3_fifo_census
 {
-    /*! Chip id of BMI3 */
-    uint8_t chip_id;
+    /*! Number of complete frames */
+    uint16_t frames;
 
-    /*!
-     * The interface pointer is used to enable the user
-     * to link their interface descriptors for reference during the
-     * implementation of the read and write interfaces to the
-     * hardware.
-     */
-    void *intf_ptr;
+    /*! Number of accelerometer frames, without the dummy frames if they are counted */
+    uint16_t accel_frames;
 
-    /*!
-     * To store information during boundary check conditions
-     * If minimum value is stored, update info with BMI3_I_MIN_VALUE
+    /*! Number of gyro frames, without the dummy frames if they are counted */
+    uint16_t gyro_frames;
+
+    /*! Number of temperature frames, without the dummy frames if they are counted */
+    uint16_t temp_frames;
+
+    /*! Number of accelerometer dummy frames, 0 if not counted */
+    uint16_t accel_dummy_frames;
+
+    /*! Number of gyro dummy frames, 0 if not counted */
+    uint16_t gyro_dummy_frames;
+
+    /*! Number of temperature dummy frames, 0 if not counted */
+    uint16_t temp_dummy_frames;
+
+    /*! Number of bytes of the incomplete frame at the end */
+    uint8_t partial_len;
+};
+
+/*!
+ * @brief Structure to define a continuous FIFO stream, which keeps the bytes of
+ * an incomplete frame for the next read
+ */
+struct bmi3_fifo_stream
+{
+    /*! Buffer of the stream, FIFO data starts at BMI3_MAX_DUMMY_BYTE */
+    uint8_t *buf;
+
+    /*! Size of the buffer in bytes */
+    uint16_t size;
+
+    /*! Number of bytes to be read from FIFO at once */
+    uint16_t chunk;
+
+    /*! Number of bytes of FIFO data in the buffer */
+    uint16_t fill;
+
+    /*! Sensor enable status of FIFO read on init of the stream */
+    uint16_t fifo_sens;
+};
+
+/*!
+ * @brief Structure to define a lock-free single-producer, single-consumer queue
+ * of FIFO samples, e.g. between the FIFO water-mark interrupt and a task.
+ * Indices run freely and are masked by the power-of-two number of slots
+ */
+struct bmi3_sample_queue
+{
+    /*! Index of the next slot published to the consumer. Written by the producer only */
+    volatile uint32_t head;
+
+    /*! Index of the next slot written by the producer, published by bmi3_sample_queue_commit */
+    uint32_t pending;
+
+    /*! Copy of the consumer index held by the producer */
+    uint32_t tail_cache;
+
+    /*! Padding to the cache line of the consumer */
+    uint8_t producer_pad[BMI3_CACHE_LINE_SIZE - (3 * sizeof(uint32_t))];
+
+    /*! Index of the next slot released by the consumer. Written by the consumer only */
+    volatile uint32_t tail;
+
+    /*! Copy of the producer index held by the consumer */
+    uint32_t head_cache;
+
+    /*! Padding to the read-only cache line */
+    uint8_t consumer_pad[BMI3_CACHE_LINE_SIZE - (2 * sizeof(uint32_t))];
+
+    /*! Slots of the queue */
+    struct bmi3_fifo_sens_axes_data *slots;
+
+    /*! Number of slots minus one */
+    uint32_t mask;
+} BMI3_CACHE_ALIGNED;
+
+/*!
+ * @brief Structure to define a context which owns all buffers of the FIFO path
+ * of a device, carved out of an arena provided by the user
+ */
+struct bmi3_ctx
+{
+    /*! Device of the context */
+    struct bmi3_dev *dev;
+
+    /*! FIFO frame referring to the raw FIFO buffer of the arena */
+    struct bmi3_fifo_frame fifo;
+
+    /*! Extracted accelerometer frames, NULL if accel is not enabled in FIFO */
+    struct bmi3_fifo_sens_axes_data *accel_data;
+
+    /*! Extracted gyro frames, NULL if gyro is not enabled in FIFO */
+    struct bmi3_fifo_sens_axes_data *gyro_data;
+
+    /*! Extracted temperature frames, NULL if temperature is not enabled in FIFO */
+    struct bmi3_fifo_temperature_data *temp_data;
+
+    /*! FIFO frame content configuration the arena is sized for */
+    uint16_t fifo_config;
+
+    /*! Size of the raw FIFO buffer in bytes, without the dummy bytes */
+    uint16_t fifo_len;
+};
+
+/*!
+ * @brief Structure to define the calibration state of the device, to be stored by
+ * the host as an opaque blob of BMI3_CALIB_BLOB_LEN bytes
+ */
+struct bmi3_calib_blob
+{
+    /*! Calibration state along with version, chip-id and CRC-16 */
+    uint8_t data[BMI3_CALIB_BLOB_LEN];
+};
+
+/*!
+ * @brief Structure to define a field of a feature configuration in the feature
+ * engine words, to be set with BMI3_FEATURE_FIELD
+ */
+struct bmi3_feature_field
+{
+    /*! Byte offset of the member in the configuration structure */
+    uint8_t offset;
+
+    /*! Size of the member in bytes, 1 or 2 */
+    uint8_t size;
+
+    /*! Index of the word from the base address of the feature */
+    uint8_t word;
+
+    /*! Bit position of the field in the word */
+    uint8_t pos;
+
+    /*! Bit mask of the field in the word */
+    uint16_t mask;
+};
+
+/*!
+ * @brief Structure to define the codec of a feature configuration, to be set
+ * with BMI3_FEATURE_CODEC
+ */
+struct bmi3_feature_codec
+{
+    /*! Type of the feature */
+    uint8_t type;
+
+    /*! Base address of the feature in words */
+    uint8_t base_addr;
+
+    /*! Number of words of the feature */
+    uint8_t n_words;
+
+    /*! Minimum accel ODR of the feature in low-power mode, 0 if not checked */
+    uint8_t lp_min_odr;
+
+    /*! Number of fields */
+    uint8_t n_fields;
+
+    /*! Fields of the feature */
+    const struct bmi3_feature_field *fields;
+};
+
+/*!
+ * @brief Structure to collect feature engine configurations to be written at once
+ */
+struct bmi3_feature_batch
+{
+    /*! Feature engine data indexed by base address in words */
+    uint8_t data[BMI3_FEATURE_BATCH_MAX_WORDS * 2];
+
+    /*! Bit set for each word to be written */
+    uint64_t dirty;
+};
+
+/*!
+ * @brief Structure to define the complete configuration of the device, captured
+ * once and applied to restore the device after power-up
+ */
+struct bmi3_config_image
+{
+    /*! Feature engine configuration words, marked dirty from axis remap to alternate auto config */
+    struct bmi3_feature_batch feature;
+
+    /*! Feature enable register (FEATURE_IO0) */
+    uint8_t feature_io[2];
+
+    /*! Registers from ACC_CONF to ALT_CONF, the reserved registers in between are not written back */
+    uint8_t sens_conf[BMI3_CONFIG_IMAGE_SENS_LEN];
+
+    /*! Registers from FIFO_WATERMARK to INT_MAP2, with FIFO_CTRL kept zero */
+    uint8_t int_conf[BMI3_CONFIG_IMAGE_INT_LEN];
+};
+
+/*!
+ * @brief Structure to define the register values of a fixed configuration,
+ * built at compile time by the BMI3_*_IMAGE macros
+ */
+struct bmi3_reg_image
+{
+    /*! ACC_CONF, BMI3_ACC_CONF_IMAGE */
+    uint16_t acc_conf;
+
+    /*! GYR_CONF, BMI3_GYR_CONF_IMAGE */
+    uint16_t gyr_conf;
+
+    /*! FIFO_WATERMARK in words */
+    uint16_t fifo_watermark;
+
+    /*! FIFO_CONF, BMI3_FIFO_CONF_IMAGE */
+    uint16_t fifo_conf;
+
+    /*! IO_INT_CTRL, combined from BMI3_INT1_* and BMI3_INT2_* masks */
+    uint16_t io_int_ctrl;
+
+    /*! INT_CONF, BMI3_INT_LATCH_MASK or 0 */
+    uint16_t int_conf;
+
+    /*! INT_MAP1, BMI3_INT_MAP1_IMAGE */
+    uint16_t int_map1;
+
+    /*! INT_MAP2, BMI3_INT_MAP2_IMAGE */
+    uint16_t int_map2;
+};
+
+/*!
+ * @brief Structure to define the write-through shadow cache of configuration
+ * registers and feature engine words
+ */
+struct bmi3_reg_cache
+{
+    /*! Enable the cache: BMI3_ENABLE or BMI3_DISABLE */
+    uint8_t enable;
+
+    /*! Shadow of the registers from BMI3_CACHE_REG_START */
+    uint8_t regs[BMI3_CACHE_REG_COUNT * 2];
+
+    /*! Bit set for each valid register */
+    uint32_t reg_valid;
+
+    /*! Shadow of the feature engine words indexed by base address */
+    uint8_t feature[BMI3_FEATURE_BATCH_MAX_WORDS * 2];
+
+    /*! Bit set for each valid feature engine word */
+    uint64_t feature_valid;
+
+    /*! Feature engine transmission address as seen by the driver */
+    uint16_t feature_addr;
+
+    /*! BMI3_ENABLE if the transmission address of the sensor matches "feature_addr" */
+    uint8_t feature_addr_sync;
+
+    /*! Configuration page selected, feature engine words are cached only for the user page (0) */
+    uint8_t feature_page;
+};
+
+/*!
+ * @brief Structure to define the retry policy of failed bus transfers
+ */
+struct bmi3_retry_cfg
+{
+    /*! Number of retries of a failed transfer, 0 to report the first failure */
+    uint8_t max_retries;
+
+    /*! Delay in microseconds before the first retry, doubled on each further retry */
+    uint32_t backoff_us;
+
+    /*! Upper limit in microseconds of the delay before a retry */
+    uint32_t max_backoff_us;
+};
+
+/*!
+ * @brief Structure to define the statistics of the retry policy
+ */
+struct bmi3_retry_stats
+{
+    /*! Number of transfers retried */
+    uint32_t retries;
+
+    /*! Number of failed transfers which succeeded on a retry */
+    uint32_t recovered;
+
+    /*! Number of failed transfers reported with BMI3_E_COM_FAIL */
+    uint32_t failed;
+
+    /*! Number of failed FIFO data reads, not retried; frames read completely by the failed transfer are lost */
+    uint32_t fifo_lost;
+
+    /*! Number of failed clear-on-read status reads, not retried; the status cleared by the failed transfer is lost */
+    uint32_t status_lost;
+};
+
+#ifdef BMI3_BUS_STATS
+
+/*!
+ * @brief Structure to define the statistics of the bus transactions
+ */
+struct bmi3_bus_stats
+{
+    /*! Number of read transactions per register address */
+    uint32_t reads[BMI3_BUS_STATS_REGS];
+
+    /*! Number of write transactions per register address */
+    uint32_t writes[BMI3_BUS_STATS_REGS];
+
+    /*! Number of bytes transferred per register address, along with dummy bytes */
+    uint32_t bytes[BMI3_BUS_STATS_REGS];
+
+    /*! Time in microseconds spent in transactions per register address */
+    uint32_t time_us[BMI3_BUS_STATS_REGS];
+
+    /*! Histogram of the time of the transactions */
+    uint32_t hist[BMI3_BUS_STATS_HIST_BINS];
+
+    /*! Number of transactions which failed with BMI3_E_COM_FAIL */
+    uint32_t com_fail;
+};
+#endif
+
+#ifdef BMI3_EVENT_LATENCY
+
+/*!
+ * @brief Structure to define the latency statistics of a feature interrupt
+ */
+struct bmi3_event_latency_stats
+{
+    /*! Number of events recorded */
+    uint32_t count;
+
+    /*! Smallest latency in microseconds */
+    uint32_t min_us;
+
+    /*! Largest latency in microseconds */
+    uint32_t max_us;
+
+    /*! Sum of the latencies in microseconds */
+    uint64_t sum_us;
+
+    /*! Histogram of the latencies */
+    uint32_t hist[BMI3_EVENT_LATENCY_HIST_BINS];
+};
+
+/*!
+ * @brief Structure to define the event latency instrumentation of the feature interrupts
+ */
+struct bmi3_event_latency
+{
+    /*! Sensor time of the last synchronization */
+    uint32_t sync_sensor_time;
+
+    /*! Host timestamp in microseconds of the last synchronization */
+    uint32_t sync_host_us;
+
+    /*! BMI3_ENABLE once synchronized */
+    uint8_t synced;
+
+    /*! Statistics indexed by the bit position of the interrupt status */
+    struct bmi3_event_latency_stats feature[BMI3_EVENT_LATENCY_FEATURES];
+};
+#endif
+
+/*!
+ * @brief Structure to define the correction applied to the accelerometer or
+ * gyro data while parsing the FIFO data: out = gain * (matrix * in - offset)
+ */
+struct bmi3_axes_correction
+{
+    /*! Rotation matrix of rows x, y and z, usually a sign/permutation matrix of -1, 0 and 1 */
+    int8_t matrix[3][3];
+
+    /*! Offset of x, y and z axis in LSB, subtracted after rotation */
+    int16_t offset[3];
+
+    /*! Gain of x, y and z axis, with BMI3_AXES_CORR_GAIN_FRAC_BITS fraction bits */
+    uint16_t gain[3];
+};
+
+/*!
+ * @brief Structure to define a point of a thermal compensation table, the
+ * offset and gain of the axes correction calibrated at a temperature
+ */
+struct bmi3_thermal_point
+{
+    /*! Temperature in LSB of the temperature data, degree celsius = LSB / 512 + 23 */
+    int16_t temp;
+
+    /*! Offset of x, y and z axis in LSB, as in bmi3_axes_correction */
+    int16_t offset[3];
+
+    /*! Gain of x, y and z axis, with BMI3_AXES_CORR_GAIN_FRAC_BITS fraction bits */
+    uint16_t gain[3];
+};
+
+/*!
+ * @brief Structure to define the state of the thermal compensation of an axes
+ * correction
+ */
+struct bmi3_thermal_comp
+{
+    /*! Points of the table in ascending order of temperature */
+    const struct bmi3_thermal_point *points;
+
+    /*! Number of points */
+    uint8_t n_points;
+
+    /*! Change of the temperature in LSB from which offset and gain are interpolated again */
+    uint16_t min_delta;
+
+    /*! Temperature of the last interpolation */
+    int16_t temp;
+
+    /*! BMI3_ENABLE once offset and gain are interpolated */
+    uint8_t valid;
+
+    /*! Correction of which offset and gain are updated */
+    struct bmi3_axes_correction *corr;
+};
+
+/*!
+ * @brief Structure to define the unit conversion scale factors of the set
+ * accelerometer and gyroscope ranges
+ */
+struct bmi3_unit_scale
+{
+    /*! Accel scale in g per LSB, with BMI3_UNIT_Q_FRAC_BITS fraction bits. 0 if not known */
+    int32_t acc_q;
+
+    /*! Gyro scale in degree per second per LSB, with BMI3_UNIT_Q_FRAC_BITS fraction bits. 0 if not known */
+    int32_t gyr_q;
+
+    /*! Accel scale in g per LSB */
+    float acc_f;
+
+    /*! Gyro scale in degree per second per LSB */
+    float gyr_f;
+};
+
+/*!
+ * @brief Structure to define a group of devices of which FIFO data is read
+ * in a scheduled order
+ */
+struct bmi3_dev_group
+{
+    /*! Devices of the group. Chip-select or I2C address of each device is held by its "intf_ptr" */
+    struct bmi3_dev *dev[BMI3_GROUP_MAX_DEV];
+
+    /*! FIFO frames of the devices, of which the data is stored in the arena of the group */
+    struct bmi3_fifo_frame fifo[BMI3_GROUP_MAX_DEV];
+
+    /*! Interrupt status of INT1 of the devices */
+    uint16_t int1_status[BMI3_GROUP_MAX_DEV];
+
+    /*! Interrupt status of INT2 of the devices */
+    uint16_t int2_status[BMI3_GROUP_MAX_DEV];
+
+    /*! Result of the FIFO read of the devices */
+    int8_t rslt[BMI3_GROUP_MAX_DEV];
+
+    /*! Length of the arena assigned to each device */
+    uint16_t slot_len;
+
+    /*! Number of devices in the group */
+    uint8_t n_dev;
+
+    /*! Index of the next device of which the FIFO read is to be started */
+    uint8_t next_read;
+
+    /*! Index of the next device to be returned for parsing */
+    uint8_t next_parse;
+};
+
+/*!
+ * @brief Structure to define a ping-pong FIFO acquisition. Buffers are filled
+ * and handed to the user in turn, so that the FIFO read into one buffer runs
+ * while the data of another buffer is parsed
+ */
+struct bmi3_fifo_pingpong
+{
+    /*! Device of which the FIFO is read */
+    struct bmi3_dev *dev;
+
+    /*! FIFO frames of the buffers, of which the data is stored in the arena */
+    struct bmi3_fifo_frame fifo[BMI3_PINGPONG_MAX_BUF];
+
+    /*! Interrupt status of INT1 read along with each buffer */
+    uint16_t int1_status[BMI3_PINGPONG_MAX_BUF];
+
+    /*! Interrupt status of INT2 read along with each buffer */
+    uint16_t int2_status[BMI3_PINGPONG_MAX_BUF];
+
+    /*! Result of the FIFO read of each buffer, BMI3_E_BUSY while in progress */
+    volatile int8_t rslt[BMI3_PINGPONG_MAX_BUF];
+
+    /*! Number of FIFO reads started, written by "bmi3_pingpong_start" only */
+    volatile uint8_t head;
+
+    /*! Number of buffers handed to the user, written by "bmi3_pingpong_acquire" only */
+    uint8_t parse;
+
+    /*! Number of buffers given back by the user, written by "bmi3_pingpong_release" only */
+    volatile uint8_t tail;
+
+    /*! Number of buffers */
+    uint8_t n_buf;
+
+    /*! Length of the arena assigned to each buffer */
+    uint16_t slot_len;
+
+    /*! Number of FIFO reads skipped as all buffers were owned by the user */
+    uint16_t overruns;
+};
+
+/*!
+ * @brief Structure to define the host budget used to tune the FIFO water-mark level
+ */
+struct bmi3_fifo_wm_budget
+{
+    /*! Maximum age in microseconds of the oldest sample when the water-mark interrupt occurs */
+    uint32_t latency_us;
+
+    /*! Worst case time in microseconds from the water-mark interrupt until the FIFO read starts */
+    uint32_t service_us;
+
+    /*! Bus speed in bits per second */
+    uint32_t bus_hz;
+};
+
+/*!
+ * @brief Structure to define the boot configuration used by soft-reset
+ */
+struct bmi3_boot_cfg
+{
+    /*! Interval in microseconds between two polls of the feature engine status */
+    uint32_t poll_interval_us;
+
+    /*! Overall time in microseconds to wait for the feature engine */
+    uint32_t timeout_us;
+
+    /*! Enable feature engine after soft-reset: BMI3_ENABLE or BMI3_DISABLE */
+    uint8_t feature_engine_en;
+
+    /*! Skip the soft-reset if the sensor kept its state, i.e. no power-on reset is
+     *  detected and the feature engine is active: BMI3_ENABLE or BMI3_DISABLE
+     */
+    uint8_t warm_start;
+};
+
+/*!
+ * @brief Structure to define the configuration of the config array upload
+ */
+struct bmi3_upload_cfg
+{
+    /*! Largest number of bytes the bus driver writes in one transaction, 0 to use read_write_len */
+    uint16_t max_burst_len;
+
+    /*! Read back and compare the uploaded data: BMI3_ENABLE or BMI3_DISABLE */
+    uint8_t verify;
+};
+
+/*!
+ * @brief Structure to define the state of an asynchronous transfer
+ */
+struct bmi3_async_xfer
+{
+    /*! State of the transfer */
+    uint8_t state;
+
+    /*! Function called once the request is complete */
+    bmi3_async_done_fptr_t done;
+
+    /*! Result of the last completed request */
+    int8_t rslt;
+
+    /*! Number of bytes of FIFO data to be read, along with dummy bytes */
+    uint16_t fifo_len;
+
+    /*! Buffer to store configuration, status and sensor data along with dummy bytes */
+    uint8_t buf[BMI3_READ_REG_DATA_LEN + BMI3_MAX_DUMMY_BYTE];
+
+    /*! FIFO frame of pending FIFO read */
+    struct bmi3_fifo_frame *fifo;
+
+    /*! Sensor data of pending sensor data read */
+    struct bmi3_sensor_data *sensor_data;
+
+    /*! Number of sensors of pending sensor data read */
+    uint8_t n_sens;
+
+    /*! Interrupt status of INT1 of pending interrupt status read */
+    uint16_t *int1_status;
+
+    /*! Interrupt status of INT2 of pending interrupt status read */
+    uint16_t *int2_status;
+};
+
+/*!
+ * @brief Structure to define a sensor variant supported by bmi3_probe_and_init
+ */
+struct bmi3_variant
+{
+    /*! Chip id of the variant */
+    uint8_t chip_id;
+
+    /*! Resolution for FOC */
+    uint8_t resolution;
+
+    /*! Set if the gyro self-calibration/self-test coefficients have to be checked before self-test,
+     *  used only if built with BMI330
+     */
+    uint8_t gyro_sc_st_coeff;
+
+    /*! Setup called after a soft-reset, NULL if none */
+    bmi3_variant_setup_fptr_t setup;
+};
+
+/*!
+ * @brief Primary device structure
+ */
+struct bmi3_dev
+{
+    /*! Chip id of BMI3 */
+    uint8_t chip_id;
+
+    /*!
+     * The interface pointer is used to enable the user
+     * to link their interface descriptors for reference during the
+     * implementation of the read and write interfaces to the
+     * hardware.
+     */
+    void *intf_ptr;
+
+    /*!
+     * To store information during boundary check conditions
+     * If minimum value is stored, update info with BMI3_I_MIN_VALUE
      * If maximum value is stored, update info with BMI3_I_MAX_VALUE
      */
     uint8_t info;
@@ -1964,63 +3371,561 @@ struct bmi3_dev
     /*! To store interface pointer error */
     BMI3_INTF_RET_TYPE intf_rslt;
 
-    /*! For switching from I2C to SPI */
-    uint8_t dummy_byte;
+    /*! For switching from I2C to SPI */
+    uint8_t dummy_byte;
+
+    /*! Resolution for FOC */
+    uint8_t resolution;
+
+    /*! User set read/write length */
+    uint16_t read_write_len;
+
+    /*! Read function pointer */
+    bmi3_read_fptr_t read;
+
+    /*! Write function pointer */
+    bmi3_write_fptr_t write;
+
+    /*! Delay function pointer */
+    bmi3_delay_us_fptr_t delay_us;
+
+    /*! Accel bit width */
+    uint16_t accel_bit_width;
+
+    /*! Optional FIFO unpack function pointer, NULL to use the portable implementation */
+    bmi3_fifo_unpack_axes_fptr_t fifo_unpack_axes;
+
+    /*! Optional FIFO unpack function pointer of the structure output, NULL to use the portable implementation */
+    bmi3_fifo_unpack_frames_fptr_t fifo_unpack_frames;
+
+    /*! Optional non-blocking read function pointer. It starts the transfer and returns,
+     *  "bmi3_async_complete" has to be called once the transfer is done. NULL if not used
+     */
+    bmi3_read_fptr_t read_async;
+
+    /*! State of the asynchronous transfer */
+    struct bmi3_async_xfer async;
+
+    /*! Optional read function pointer for FIFO data in I3C HDR-DDR mode, used only with
+     *  BMI3_I3C_INTF. It returns the data in the same format as "read". NULL to read FIFO data with "read"
+     */
+    bmi3_read_fptr_t read_hdr;
+
+    /*! Idle time in microseconds inserted before the access following a write access.
+     *  0 for BMI3_IDLE_TIME_US, BMI3_IDLE_TIME_NONE for no idle time
+     */
+    uint32_t idle_time_us;
+
+    /*! Set when the last access was a write and the idle time is yet to be inserted */
+    uint8_t idle_pending;
+
+    /*! Idle time in microseconds to be inserted, set on each write access */
+    uint32_t idle_due_us;
+
+    /*! Boot configuration used by soft-reset, NULL to use the default configuration */
+    const struct bmi3_boot_cfg *boot_cfg;
+
+    /*! Configuration of the config array upload, NULL to write bursts of read_write_len without verification */
+    const struct bmi3_upload_cfg *upload_cfg;
+
+    /*! Set by bmi3_init if the soft-reset is skipped, the sensor kept its configuration */
+    uint8_t warm_started;
+
+    /*! Variant found by bmi3_probe_and_init, NULL if initialized by bmi3_init only */
+    const struct bmi3_variant *variant;
+
+    /*! Shadow register cache */
+    struct bmi3_reg_cache cache;
+
+    /*! Feature engine image last written by bmi3_set_feature_image, to write only the
+     *  words which differ with the next image. Reset by any other write to the feature
+     *  engine, by commands and by bmi3_invalidate_reg_cache. NULL if not known
+     */
+    const struct bmi3_feature_batch *feature_image;
+
+    /*! Host budget to tune the FIFO water-mark level on change of accel, gyro or FIFO
+     *  configuration. NULL to keep the water-mark level set by the user
+     */
+    const struct bmi3_fifo_wm_budget *fifo_wm_budget;
+
+    /*! Retry policy of failed bus transfers. NULL to report every failure with BMI3_E_COM_FAIL */
+    const struct bmi3_retry_cfg *retry_cfg;
+
+    /*! Statistics of the retry policy */
+    struct bmi3_retry_stats retry_stats;
+
+    /*! Lock function pointer, called before a sequence of accesses which has to be
+     *  atomic, e.g. feature engine, FOC and self-test sequences. Single register reads,
+     *  e.g. by bmi3_get_sensor_data, are not locked unless the cache is enabled.
+     *  NULL if not used
+     */
+    bmi3_lock_fptr_t lock;
+
+    /*! Unlock function pointer, called at the end of the sequence. NULL if not used */
+    bmi3_lock_fptr_t unlock;
+
+    /*! Batch begin function pointer, called before a sequence of dependent writes, e.g.
+     *  soft-reset, feature enable and interrupt configuration. NULL if not used
+     */
+    bmi3_batch_begin_fptr_t batch_begin;
+
+    /*! Batch end function pointer, called at the end of the sequence. NULL if not used */
+    bmi3_batch_end_fptr_t batch_end;
+
+    /*! Nesting depth of the batches, only the outermost batch is passed to the platform */
+    uint8_t batch_depth;
+
+    /*! Unit conversion scale factors, updated whenever accel or gyro range is set */
+    struct bmi3_unit_scale unit_scale;
+
+    /*! Correction applied to accel data extracted from FIFO. NULL if not used */
+    const struct bmi3_axes_correction *acc_corr;
+
+    /*! Correction applied to gyro data extracted from FIFO. NULL if not used */
+    const struct bmi3_axes_correction *gyr_corr;
+
+    /*! Scratch buffer of BMI3_MAX_LEN bytes for register reads, in place of a stack buffer. Only used if the
+     *  driver is compiled with BMI3_DEV_SCRATCH defined
+     */
+    uint8_t *scratch;
+
+    /* The bus statistics are the last members, so that the offsets of all other members do not depend on
+     * BMI3_BUS_STATS. The size of the structure still does: the driver and all the code which allocates or
+     * accesses bmi3_dev have to be compiled with the same BMI3_BUS_STATS setting
+     */
+#ifdef BMI3_BUS_STATS
+
+    /*! Timestamp function pointer to measure the time of the transactions. NULL if not used */
+    bmi3_timestamp_us_fptr_t timestamp_us;
+
+    /*! Statistics of the bus transactions */
+    struct bmi3_bus_stats bus_stats;
+#endif
+};
+
+/*!
+ * @brief Structure to define Interrupt pin configuration
+ */
+struct bmi3_int_pin_cfg
+{
+    /*! Configure level of interrupt pin */
+    uint8_t lvl;
+
+    /*! Configure behavior of interrupt pin */
+    uint8_t od;
+
+    /*! Output enable for interrupt pin */
+    uint8_t output_en;
+};
+
+/*!
+ * @brief Structure to define interrupt pin type, mode and configurations
+ */
+struct bmi3_int_pin_config
+{
+    /*! Interrupt pin type: INT1 or INT2 or BOTH */
+    uint8_t pin_type;
+
+    /*! Latched or non-latched mode */
+    uint8_t int_latch;
+
+    /*! Structure to define Interrupt pin configuration */
+    struct bmi3_int_pin_cfg pin_cfg[BMI3_INT_PIN_MAX_NUM];
+};
+
+/*!
+ * @brief Structure to define accelerometer and gyroscope sensor axes and
+ * sensor time for virtual frames and temperature data.
+ */
+struct bmi3_sens_axes_data
+{
+    /*! Data in x-axis */
+    int16_t x;
+
+    /*! Data in y-axis */
+    int16_t y;
+
+    /*! Data in z-axis */
+    int16_t z;
+
+    /*! Sensor time for frames */
+    uint32_t sens_time;
+
+    /*! Saturation flag status for X axis */
+    uint8_t sat_x : 1;
+
+    /*! Saturation flag status for Y axis */
+    uint8_t sat_y : 1;
+
+    /*! Saturation flag status for Z axis */
+    uint8_t sat_z : 1;
+
+    /*! Temperature data */
+    uint16_t temp_data;
+};
+
+/*!
+ * @brief Structure to define accelerometer and gyroscope sensor axes and
+ * sensor time for virtual frames
+ */
+struct bmi3_i3c_sync_data
+{
+    /*! Data in x-axis */
+    uint16_t sync_x;
+
+    /*! Data in y-axis */
+    uint16_t sync_y;
+
+    /*! Data in z-axis */
+    uint16_t sync_z;
+
+    /*! Temperature data */
+    uint16_t sync_temp;
+
+    /*! Sensor time for frames */
+    uint16_t sync_time;
+};
+
+/*!
+ * @brief Structure to define the i3c time-controlled synchronization configuration
+ */
+struct bmi3_i3c_sync_cfg
+{
+    /*! Data sample rate, written to I3C_TC_SYNC_TPH */
+    uint16_t tph;
+
+    /*! Delay time, written to I3C_TC_SYNC_TU */
+    uint8_t tu;
+
+    /*! Output data rate, written to I3C_TC_SYNC_ODR */
+    uint8_t odr;
+};
+
+/*!
+ * @brief Structure to define a group of devices on one i3c bus of which the
+ * i3c sync data is aligned
+ */
+struct bmi3_i3c_sync_group
+{
+    /*! Devices of the group */
+    struct bmi3_dev *dev[BMI3_GROUP_MAX_DEV];
+
+    /*! Number of devices in the group */
+    uint8_t n_dev;
+};
+
+/*!
+ * @brief Structure to define the i3c sync data of a device
+ */
+struct bmi3_i3c_sync_sample
+{
+    /*! Accelerometer data and sync time */
+    struct bmi3_i3c_sync_data acc;
+
+    /*! Gyroscope data and sync time */
+    struct bmi3_i3c_sync_data gyr;
+
+    /*! Temperature data and sync time */
+    struct bmi3_i3c_sync_data temp;
+};
+
+/*!
+ * @brief Structure to define the aligned i3c sync data of a group of devices
+ */
+struct bmi3_i3c_sync_frame
+{
+    /*! I3c sync data of the devices, in the order of the group */
+    struct bmi3_i3c_sync_sample sample[BMI3_GROUP_MAX_DEV];
+
+    /*! Newest sync time of the devices */
+    uint16_t sync_time;
+
+    /*! Number of devices */
+    uint8_t n_dev;
+
+    /*! BMI3_ENABLE if all devices have the same sync time */
+    uint8_t aligned;
+};
+
+/*!
+ * @brief Structure to define FIFO accel, gyro x, y and z axis and
+ * sensor time
+ */
+struct bmi3_fifo_sens_axes_data
+{
+    /*! Data in x-axis */
+    int16_t x;
+
+    /*! Data in y-axis */
+    int16_t y;
+
+    /*! Data in z-axis */
+    int16_t z;
+
+    /*! Sensor time data */
+    uint16_t sensor_time;
+};
+
+/*!
+ * @brief Structure to define a joined accelerometer and gyro sample of a FIFO
+ * frame
+ */
+struct bmi3_fifo_6dof_data
+{
+    /*! Accelerometer data in x-axis */
+    int16_t acc_x;
+
+    /*! Accelerometer data in y-axis */
+    int16_t acc_y;
+
+    /*! Accelerometer data in z-axis */
+    int16_t acc_z;
+
+    /*! Gyro data in x-axis */
+    int16_t gyr_x;
+
+    /*! Gyro data in y-axis */
+    int16_t gyr_y;
+
+    /*! Gyro data in z-axis */
+    int16_t gyr_z;
+
+    /*! Sensor time shared by both samples, 0 if sensor time is not enabled in FIFO */
+    uint16_t sensor_time;
+};
+
+/*!
+ * @brief Structure to define the latest frames of a FIFO stream, shared by the
+ * consumer draining the FIFO and low-latency consumers of the latest frames
+ */
+struct bmi3_latest
+{
+    /*! Latest joined frames of the stream, a ring of BMI3_LATEST_MAX_FRAMES */
+    struct bmi3_fifo_6dof_data frame[BMI3_LATEST_MAX_FRAMES];
+
+    /*! Host time function, called with the interface pointer of the device */
+    bmi3_host_time_ns_fptr_t host_time_ns;
+
+    /*! Host time of the last push in nanoseconds */
+    uint64_t push_ns;
+
+    /*! Sample period in nanoseconds */
+    uint32_t period_ns;
+
+    /*! Number of peeks served from the data registers */
+    uint32_t reg_reads;
+
+    /*! Index of the newest frame of the ring */
+    uint8_t head;
+
+    /*! Number of frames of the ring */
+    uint8_t count;
+};
+
+/*!
+ * @brief Structure to define the state of the FIFO timestamp reconstruction
+ */
+struct bmi3_fifo_time
+{
+    /*! Unwrapped 32-bit sensor time read by the last anchor */
+    uint64_t anchor;
+
+    /*! Unwrapped sensor time of the last sample */
+    uint64_t last;
+
+    /*! Sample period in sensor time ticks */
+    uint32_t period;
+
+    /*! BMI3_ENABLE if "last" holds the time of a sample */
+    uint8_t last_valid;
+};
+
+/*!
+ * @brief Structure to define the accounting of the FIFO frames lost by
+ * overflows, detected from the sensor time of the frames
+ */
+struct bmi3_fifo_loss
+{
+    /*! Frame period in sensor time ticks */
+    uint32_t period;
+
+    /*! Number of frames received */
+    uint32_t frames;
+
+    /*! Number of frames lost */
+    uint32_t lost_frames;
+
+    /*! Number of discontinuities of the sensor time */
+    uint32_t gaps;
+
+    /*! Number of FIFO full interrupts */
+    uint32_t overflows;
+
+    /*! Number of FIFO flushes done on FIFO full */
+    uint32_t resyncs;
+
+    /*! 16-bit sensor time of the last frame */
+    uint16_t last_time;
+
+    /*! BMI3_ENABLE if "last_time" holds the time of a frame */
+    uint8_t last_valid;
+
+    /*! BMI3_ENABLE to flush the FIFO on FIFO full */
+    uint8_t flush_on_full;
+};
+
+/*!
+ * @brief Structure to define the analysis of the intervals of the FIFO frames
+ * of one sensor, from the sensor time of the frames
+ */
+struct bmi3_fifo_jitter
+{
+    /*! Sensor time ticks covered by the counted intervals, gaps included */
+    uint64_t span;
+
+    /*! Intervals by their deviation from the frame period in ticks: 0, 1, 2-3,
+     * 4-7, ... and the last bin for the larger deviations */
+    uint32_t hist[BMI3_FIFO_JITTER_BINS];
+
+    /*! Frame period in sensor time ticks */
+    uint32_t period;
+
+    /*! Running average of the intervals without gaps, in ticks with
+     * BMI3_FIFO_JITTER_FRAC fraction bits */
+    uint32_t interval_avg;
+
+    /*! Number of intervals counted in "span" */
+    uint32_t intervals;
+
+    /*! Number of frames received */
+    uint32_t frames;
+
+    /*! Number of intervals of more than one frame period, rounded to the period */
+    uint32_t gaps;
+
+    /*! Number of frames missing in the gaps */
+    uint32_t lost_frames;
+
+    /*! Number of intervals of less than half a frame period */
+    uint32_t short_intervals;
+
+    /*! Largest deviation from the frame period of an interval without gap, in ticks */
+    uint16_t max_dev;
+
+    /*! 16-bit sensor time of the last frame */
+    uint16_t last_time;
 
-    /*! Resolution for FOC */
-    uint8_t resolution;
+    /*! BMI3_ENABLE if "last_time" holds the time of a frame */
+    uint8_t last_valid;
+};
 
-    /*! User set read/write length */
-    uint16_t read_write_len;
+/*!
+ * @brief Structure to define the figures derived from the analysis of the
+ * FIFO frame intervals
+ */
+struct bmi3_fifo_jitter_report
+{
+    /*! Effective ODR in mHz, from the running average of the intervals without gaps */
+    uint32_t odr_mhz;
 
-    /*! Read function pointer */
-    bmi3_read_fptr_t read;
+    /*! Rate of the frames delivered in mHz, from all intervals, gaps included */
+    uint32_t delivered_mhz;
 
-    /*! Write function pointer */
-    bmi3_write_fptr_t write;
+    /*! Deviation of the effective ODR from the configured one in ppm */
+    int32_t odr_error_ppm;
 
-    /*! Delay function pointer */
-    bmi3_delay_us_fptr_t delay_us;
+    /*! Deviation in ticks not exceeded by 99 percent of the intervals without gap,
+     * bounded by the histogram bins */
+    uint16_t jitter_p99;
+};
 
-    /*! Accel bit width */
-    uint16_t accel_bit_width;
+/*!
+ * @brief Structure to define a (sensor time, host time) sample of the clock synchronization
+ */
+struct bmi3_clock_sync_sample
+{
+    /*! Unwrapped sensor time in ticks of BMI3_SENSORTIME_RESOLUTION */
+    uint64_t ticks;
+
+    /*! Host time in nanoseconds */
+    uint64_t host_ns;
 };
 
 /*!
- * @brief Structure to define Interrupt pin configuration
+ * @brief Structure to define the synchronization of the sensor time to a host
+ * clock: host_ns = ref_host_ns + (ticks - ref_ticks) * rate
  */
-struct bmi3_int_pin_cfg
+struct bmi3_clock_sync
 {
-    /*! Configure level of interrupt pin */
-    uint8_t lvl;
+    /*! Window of the accepted samples */
+    struct bmi3_clock_sync_sample sample[BMI3_CLOCK_SYNC_SAMPLES];
 
-    /*! Configure behavior of interrupt pin */
-    uint8_t od;
+    /*! Unwrapped sensor time of the reference point */
+    uint64_t ref_ticks;
 
-    /*! Output enable for interrupt pin */
-    uint8_t output_en;
+    /*! Host time in nanoseconds of the reference point */
+    uint64_t ref_host_ns;
+
+    /*! Nanoseconds per tick with BMI3_CLOCK_SYNC_RATE_FRAC fraction bits */
+    int64_t rate;
+
+    /*! Largest uncertainty in nanoseconds of an accepted sample, 0 for no limit */
+    uint32_t max_uncertainty_ns;
+
+    /*! 32-bit sensor time of the last accepted sample */
+    uint32_t last_raw;
+
+    /*! Number of samples accepted */
+    uint32_t accepted;
+
+    /*! Number of samples rejected for their uncertainty */
+    uint32_t rejected;
+
+    /*! Number of restarts of the window on a sensor or host clock discontinuity */
+    uint32_t restarts;
+
+    /*! Index of the next sample of the window */
+    uint8_t head;
+
+    /*! Number of samples in the window */
+    uint8_t count;
 };
 
 /*!
- * @brief Structure to define interrupt pin type, mode and configurations
+ * @brief Structure to define the output of the multi-rate extraction of the
+ * FIFO data, with accel and gyro running at different ODRs
  */
-struct bmi3_int_pin_config
+struct bmi3_fifo_multi_rate
 {
-    /*! Interrupt pin type: INT1 or INT2 or BOTH */
-    uint8_t pin_type;
+    /*! Accelerometer samples at their native rate, NULL if accel is not enabled in FIFO */
+    struct bmi3_fifo_sens_axes_data *accel_data;
 
-    /*! Latched or non-latched mode */
-    uint8_t int_latch;
+    /*! Unwrapped sensor time of each accelerometer sample, NULL if not required */
+    uint64_t *accel_time;
 
-    /*! Structure to define Interrupt pin configuration */
-    struct bmi3_int_pin_cfg pin_cfg[BMI3_INT_PIN_MAX_NUM];
+    /*! Gyro samples at their native rate, NULL if gyro is not enabled in FIFO */
+    struct bmi3_fifo_sens_axes_data *gyro_data;
+
+    /*! Unwrapped sensor time of each gyro sample, NULL if not required */
+    uint64_t *gyro_time;
+
+    /*! Index of the gyro sample taken along with each accelerometer sample, BMI3_FIFO_NO_PAIR if the gyro
+     *  frame is a dummy frame. NULL if not required
+     */
+    uint16_t *accel_pair;
+
+    /*! Number of accelerometer samples extracted */
+    uint16_t accel_frames;
+
+    /*! Number of gyro samples extracted */
+    uint16_t gyro_frames;
 };
 
 /*!
- * @brief Structure to define accelerometer and gyroscope sensor axes and
- * sensor time for virtual frames and temperature data.
+ * @brief Structure to define a packed sample of 6 bytes, the sensor time is
+ * implied by the output data rate
  */
-struct bmi3_sens_axes_data
+struct bmi3_packed_axes
 {
     /*! Data in x-axis */
     int16_t x;
@@ -2030,62 +3935,347 @@ struct bmi3_sens_axes_data
 
     /*! Data in z-axis */
     int16_t z;
+};
 
-    /*! Sensor time for frames */
-    uint32_t sens_time;
+/*!
+ * @brief Structure to define a buffer of consecutive packed samples of one
+ * sensor, with saturation flags and temperature in optional side-bands
+ */
+struct bmi3_packed_buf
+{
+    /*! Packed samples, capacity entries */
+    struct bmi3_packed_axes *axes;
 
-    /*! Saturation flag status for X axis */
-    uint8_t sat_x : 1;
+    /*! Saturation side-band of BMI3_PACKED_SAT_LEN(capacity) bytes, NULL if not kept */
+    uint8_t *sat;
 
-    /*! Saturation flag status for Y axis */
-    uint8_t sat_y : 1;
+    /*! Temperature side-band of capacity entries, NULL if not kept */
+    uint16_t *temp;
 
-    /*! Saturation flag status for Z axis */
-    uint8_t sat_z : 1;
+    /*! Sensor time of the first sample */
+    uint32_t sens_time;
 
-    /*! Temperature data */
-    uint16_t temp_data;
+    /*! Sample period in ticks of BMI3_SENSORTIME_RESOLUTION */
+    uint32_t period;
+
+    /*! Maximum number of samples */
+    uint16_t capacity;
+
+    /*! Number of samples */
+    uint16_t count;
 };
 
 /*!
- * @brief Structure to define accelerometer and gyroscope sensor axes and
- * sensor time for virtual frames
+ * @brief Structure to define a flight recorder, a ring of packed FIFO samples
+ * which is frozen after the post-event window of a trigger interrupt
  */
-struct bmi3_i3c_sync_data
+struct bmi3_flight_rec
 {
-    /*! Data in x-axis */
-    uint16_t sync_x;
+    /*! Packed accel samples of the ring, capacity entries */
+    struct bmi3_packed_axes *accel;
 
-    /*! Data in y-axis */
-    uint16_t sync_y;
+    /*! Packed gyro samples of the ring, capacity entries, NULL if not kept */
+    struct bmi3_packed_axes *gyro;
 
-    /*! Data in z-axis */
-    uint16_t sync_z;
+    /*! Unwrapped sensor time of the oldest sample */
+    uint32_t sens_time;
 
-    /*! Temperature data */
-    uint16_t sync_temp;
+    /*! Sample period in ticks of BMI3_SENSORTIME_RESOLUTION */
+    uint32_t period;
 
-    /*! Sensor time for frames */
-    uint16_t sync_time;
+    /*! Unwrapped sensor time of the first sample after the event */
+    uint32_t event_time;
+
+    /*! Maximum number of samples of the ring */
+    uint16_t capacity;
+
+    /*! Number of samples of the post-event window */
+    uint16_t post;
+
+    /*! Index of the oldest sample of the ring */
+    uint16_t head;
+
+    /*! Number of samples of the ring */
+    uint16_t count;
+
+    /*! Number of samples of the ring before the event */
+    uint16_t pre_count;
+
+    /*! Number of samples of the post-event window still to be recorded */
+    uint16_t post_left;
+
+    /*! Interrupt status bits triggering the recorder, BMI3_INT_STATUS_* */
+    uint16_t trigger_mask;
+
+    /*! Interrupt status bits of the event */
+    uint16_t event_status;
+
+    /*! Non-zero once the first sample is recorded */
+    uint8_t started;
+
+    /*! BMI3_FLIGHT_REC_ARMED, BMI3_FLIGHT_REC_TRIGGERED or BMI3_FLIGHT_REC_FROZEN */
+    uint8_t state;
 };
 
 /*!
- * @brief Structure to define FIFO accel, gyro x, y and z axis and
- * sensor time
+ * @brief Structure to define the state of the delta encoder or decoder of
+ * FIFO samples
  */
-struct bmi3_fifo_sens_axes_data
+struct bmi3_delta_codec
 {
-    /*! Data in x-axis */
+    /*! Data in x-axis of the last sample */
     int16_t x;
 
-    /*! Data in y-axis */
+    /*! Data in y-axis of the last sample */
     int16_t y;
 
-    /*! Data in z-axis */
+    /*! Data in z-axis of the last sample */
     int16_t z;
 
-    /*! Sensor time data */
+    /*! Sensor time of the next sample */
     uint16_t sensor_time;
+
+    /*! Sample period in sensor time ticks */
+    uint16_t period;
+};
+
+/*!
+ * @brief Structure to define the state of a CIC decimator of FIFO samples,
+ * kept across FIFO reads
+ */
+struct bmi3_decimator
+{
+    /*! Integrator state of each stage and axis, wrapping around */
+    uint32_t integ[BMI3_DECIM_MAX_ORDER][3];
+
+    /*! Comb delay state of each stage and axis */
+    uint32_t comb[BMI3_DECIM_MAX_ORDER][3];
+
+    /*! Decimation ratio, a power of two */
+    uint8_t ratio;
+
+    /*! Number of integrator and comb stages */
+    uint8_t order;
+
+    /*! Shift to normalize the gain of ratio to the power of order */
+    uint8_t shift;
+
+    /*! Number of input samples of the current output sample */
+    uint8_t phase;
+};
+
+/*!
+ * @brief Structure to define the configuration of the shock detection on the
+ * accelerometer frames of the FIFO data
+ */
+struct bmi3_shock_config
+{
+    /*! Threshold of any axis in g with BMI3_UNIT_Q_FRAC_BITS fraction bits */
+    int32_t threshold;
+
+    /*! Number of frames of the context window before the first frame above the threshold */
+    uint16_t pre_frames;
+
+    /*! Number of frames of the context window after the last frame above the threshold */
+    uint16_t post_frames;
+};
+
+/*!
+ * @brief Structure to define a shock detected in the FIFO data
+ */
+struct bmi3_shock_event
+{
+    /*! Accelerometer sample of the highest absolute axis value of the shock */
+    struct bmi3_fifo_sens_axes_data peak;
+
+    /*! FIFO frame index of the peak */
+    uint16_t peak_frame;
+
+    /*! First FIFO frame of the context window */
+    uint16_t first_frame;
+
+    /*! End of the context window, the frame after the last one. Limited to the frames of the FIFO data */
+    uint16_t end_frame;
+};
+
+/*!
+ * @brief Structure to define the state of the spectral summary of FIFO samples,
+ * a bank of Goertzel filters run over blocks of samples
+ */
+struct bmi3_spectrum
+{
+    /*! Filter coefficient of each bin with BMI3_GOERTZEL_FRAC_BITS fraction bits */
+    int32_t coeff[BMI3_SPECTRUM_MAX_BINS];
+
+    /*! Last state of each axis and bin */
+    int32_t s1[3][BMI3_SPECTRUM_MAX_BINS];
+
+    /*! State before the last of each axis and bin */
+    int32_t s2[3][BMI3_SPECTRUM_MAX_BINS];
+
+    /*! Optional platform specific Goertzel kernel, NULL to use the one of the driver */
+    bmi3_goertzel_fptr_t kernel;
+
+    /*! Number of samples of a block */
+    uint16_t block_len;
+
+    /*! Number of samples of the current block */
+    uint16_t pos;
+
+    /*! Number of bins */
+    uint8_t n_bins;
+};
+
+/*!
+ * @brief Structure to define the spectral summary of a block of FIFO samples
+ */
+struct bmi3_spectrum_summary
+{
+    /*! Squared amplitude of each axis and bin in LSB squared */
+    uint32_t energy[3][BMI3_SPECTRUM_MAX_BINS];
+
+    /*! Index of the bin of the highest energy of each axis */
+    uint8_t peak[3];
+
+    /*! Number of blocks completed by the last update, the summary is the one of the last block */
+    uint8_t blocks;
+};
+
+/*!
+ * @brief Structure to define the state of the fixed-point orientation fusion
+ * of accel and gyro samples (Mahony filter)
+ */
+struct bmi3_fusion
+{
+    /*! Orientation quaternion w, x, y and z with BMI3_FUSION_Q_FRAC_BITS fraction bits */
+    int32_t q[4];
+
+    /*! Integral feedback of each axis in radian per second with BMI3_UNIT_Q_FRAC_BITS fraction bits */
+    int32_t integ[3];
+
+    /*! Proportional gain with BMI3_UNIT_Q_FRAC_BITS fraction bits */
+    int32_t kp;
+
+    /*! Integral gain in 1 per second with BMI3_UNIT_Q_FRAC_BITS fraction bits */
+    int32_t ki;
+
+    /*! Unwrapped sensor time of the last sample */
+    uint64_t last;
+
+    /*! BMI3_ENABLE if "last" holds the time of a sample */
+    uint8_t last_valid;
+};
+
+/*!
+ * @brief Structure to define FIFO accel, gyro x, y and z axis and
+ * sensor time as separate arrays
+ */
+struct bmi3_fifo_sens_axes_planes
+{
+    /*! Pointer to array of data in x-axis */
+    int16_t *x;
+
+    /*! Pointer to array of data in y-axis */
+    int16_t *y;
+
+    /*! Pointer to array of data in z-axis */
+    int16_t *z;
+
+    /*! Pointer to array of sensor time data, can be NULL if not required */
+    uint32_t *sensor_time;
+};
+
+/*!
+ * @brief Structure to define the running statistics accumulator of an axis
+ */
+struct bmi3_axis_stats
+{
+    /*! Sum of the samples */
+    int64_t sum;
+
+    /*! Sum of the squares of the samples */
+    uint64_t sum_sq;
+
+    /*! Smallest sample */
+    int16_t min;
+
+    /*! Largest sample */
+    int16_t max;
+};
+
+/*!
+ * @brief Structure to define the running statistics accumulators of x, y and z axis
+ */
+struct bmi3_axes_stats
+{
+    /*! Number of samples accumulated */
+    uint32_t count;
+
+    /*! Accumulator of x-axis */
+    struct bmi3_axis_stats x;
+
+    /*! Accumulator of y-axis */
+    struct bmi3_axis_stats y;
+
+    /*! Accumulator of z-axis */
+    struct bmi3_axis_stats z;
+};
+
+/*!
+ * @brief Structure to define the statistics of an axis
+ */
+struct bmi3_axis_stats_result
+{
+    /*! Mean of the samples in LSB, rounded */
+    int16_t mean;
+
+    /*! Population variance of the samples in LSB squared */
+    uint32_t variance;
+
+    /*! Smallest sample */
+    int16_t min;
+
+    /*! Largest sample */
+    int16_t max;
+
+    /*! Peak-to-peak value of the samples */
+    uint16_t peak_to_peak;
+};
+
+/*!
+ * @brief Structure to define the statistics of x, y and z axis
+ */
+struct bmi3_axes_stats_result
+{
+    /*! Number of samples */
+    uint32_t count;
+
+    /*! Statistics of x-axis */
+    struct bmi3_axis_stats_result x;
+
+    /*! Statistics of y-axis */
+    struct bmi3_axis_stats_result y;
+
+    /*! Statistics of z-axis */
+    struct bmi3_axis_stats_result z;
+};
+
+/*!
+ * @brief Structure to define a rolling window of the statistics of the last bursts
+ */
+struct bmi3_stats_window
+{
+    /*! Array of accumulators, one per burst, provided by the user */
+    struct bmi3_axes_stats *bursts;
+
+    /*! Number of bursts in the window, size of the array */
+    uint8_t size;
+
+    /*! Index of the accumulator of the next burst */
+    uint8_t next;
+
+    /*! Number of bursts stored, up to "size" */
+    uint8_t count;
 };
 
 /*!
@@ -2245,6 +4435,29 @@ struct bmi3_gyro_config
     uint8_t avg_num;
 };
 
+/*!
+ * @brief Structure to define the state of a non-blocking self-test
+ */
+struct bmi3_st_ctx
+{
+    /*! State of the self-test: BMI3_ST_STATE_IDLE, BMI3_ST_STATE_RUNNING,
+     *  BMI3_ST_STATE_COMPLETE or BMI3_ST_STATE_TIMEOUT
+     */
+    uint8_t state;
+
+    /*! Self-test selection: BMI3_ST_ACCEL_ONLY, BMI3_ST_GYRO_ONLY or BMI3_ST_BOTH_ACC_GYR */
+    uint8_t st_selection;
+
+    /*! Number of polls of the self-test status */
+    uint8_t polls;
+
+    /*! Feature engine status read on completion of the self-test */
+    uint8_t feature_io1;
+
+    /*! Accel configuration restored at the end of the self-test */
+    struct bmi3_accel_config acc_cfg;
+};
+
 /*!
  * @brief Structure to define any-motion configuration
  */
@@ -2608,17 +4821,95 @@ struct bmi3_err_reg
     /*! Watchdog timer of the feature engine triggered. */
     uint8_t feat_eng_wd;
 
-    /*! Indicates accel configuration error */
-    uint8_t acc_conf_err;
+    /*! Indicates accel configuration error */
+    uint8_t acc_conf_err;
+
+    /*! Indicates gyro configuration error */
+    uint8_t gyr_conf_err;
+
+    /*! Indicates SDR parity error */
+    uint8_t i3c_error0;
+
+    /*! Indicates I3C error */
+    uint8_t i3c_error3;
+};
+
+/*!
+ * @brief Structure to define the interrupt status and payload read by the
+ * interrupt dispatcher. The payload of an interrupt status bit is valid only
+ * if the bit fired and a callback is registered for it.
+ */
+struct bmi3_int_event_data
+{
+    /*! Interrupt status of INT1, 0 if not read */
+    uint16_t int1_status;
+
+    /*! Interrupt status of INT2, 0 if not read */
+    uint16_t int2_status;
+
+    /*! Interrupt status of IBI, 0 if not read */
+    uint16_t ibi_status;
+
+    /*! Accelerometer data, payload of BMI3_INT_STATUS_ACC_DRDY */
+    struct bmi3_sens_axes_data acc;
+
+    /*! Gyroscope data, payload of BMI3_INT_STATUS_GYR_DRDY */
+    struct bmi3_sens_axes_data gyr;
+
+    /*! Temperature data, payload of BMI3_INT_STATUS_TEMP_DRDY */
+    struct bmi3_sens_axes_data temp;
+
+    /*! Step count, payload of BMI3_INT_STATUS_STEP_COUNTER */
+    uint32_t step_count;
+
+    /*! Orientation output, payload of BMI3_INT_STATUS_ORIENTATION */
+    struct bmi3_orientation_output orient;
+
+    /*! Tap detection status, BMI3_TAP_DET_STATUS_* bits, payload of BMI3_INT_STATUS_TAP */
+    uint16_t tap_status;
+
+    /*! Error status, payload of BMI3_INT_STATUS_ERR */
+    struct bmi3_err_reg err;
+};
+
+/*!
+ * @brief Structure to define the interrupt dispatcher
+ */
+struct bmi3_int_dispatcher
+{
+    /*! Callbacks indexed by the bit position of the interrupt status, NULL if not registered */
+    bmi3_int_event_fptr_t callback[BMI3_INT_STATUS_BIT_COUNT];
+
+    /*! User context passed to the callbacks */
+    void *ctx;
+
+    /*! Interrupt status registers to be read, BMI3_INT_SRC_* bits */
+    uint8_t sources;
+
+    /*! Interrupt status and payload of the last dispatch */
+    struct bmi3_int_event_data data;
+};
+
+/*!
+ * @brief Structure to define the split of the interrupt sources on a data pin,
+ * served by a FIFO-only fast path, and an event pin, served by a deferred path
+ */
+struct bmi3_int_route
+{
+    /*! Data sources on the data pin, BMI3_INT_STATUS_FWM, FFULL and *_DRDY bits */
+    uint16_t data_status;
+
+    /*! Feature events on the event pin, BMI3_INT_STATUS_* bits other than data sources */
+    uint16_t event_status;
 
-    /*! Indicates gyro configuration error */
-    uint8_t gyr_conf_err;
+    /*! Pin of the data sources, BMI3_INT1 or BMI3_INT2 */
+    uint8_t data_pin;
 
-    /*! Indicates SDR parity error */
-    uint8_t i3c_error0;
+    /*! Pin of the feature events, BMI3_INT1, BMI3_INT2 or BMI3_I3C_INT */
+    uint8_t event_pin;
 
-    /*! Indicates I3C error */
-    uint8_t i3c_error3;
+    /*! BMI3_INT_LATCH_EN or BMI3_INT_NON_LATCH, shared by both pins */
+    uint8_t int_latch;
 };
 
 /*!
@@ -2737,6 +5028,112 @@ struct bmi3_map_int
     uint8_t fifo_full_int;
 };
 
+/*!
+ * @brief Structure to define the supply currents of the sensor used by
+ * bmi3_estimate_power. The values are to be taken from the datasheet of the
+ * sensor for the supply voltage and temperature in use
+ */
+struct bmi3_current_table
+{
+    /*! Current with accel and gyro disabled, in nA */
+    uint32_t base_na;
+
+    /*! Accel current in high-performance mode, in nA */
+    uint32_t acc_hp_na;
+
+    /*! Accel current in normal mode, in nA */
+    uint32_t acc_normal_na;
+
+    /*! Accel current in low-power mode between the samples, in nA */
+    uint32_t acc_lp_na;
+
+    /*! Accel charge per sample averaged in low-power mode, in pC */
+    uint32_t acc_lp_sample_pc;
+
+    /*! Gyro current in high-performance mode, in nA */
+    uint32_t gyr_hp_na;
+
+    /*! Gyro current in normal mode, in nA */
+    uint32_t gyr_normal_na;
+
+    /*! Gyro current in low-power mode between the samples, in nA */
+    uint32_t gyr_lp_na;
+
+    /*! Gyro charge per sample averaged in low-power mode, in pC */
+    uint32_t gyr_lp_sample_pc;
+
+    /*! Gyro current in suspend mode, with the drive kept on, in nA */
+    uint32_t gyr_drive_na;
+};
+
+/*!
+ * @brief Structure to define the model of the time of a bus transaction:
+ * fixed cost plus the bits of addresses, dummy bytes and data at the bus speed
+ */
+struct bmi3_bus_model
+{
+    /*! Interface of the sensor */
+    enum bmi3_intf intf;
+
+    /*! Bus speed in bits per second */
+    uint32_t bus_hz;
+
+    /*! Fixed cost of a transaction in nanoseconds, e.g. chip select and driver overhead */
+    uint32_t transaction_ns;
+
+    /*! Factor applied on the modeled time, BMI3_BUS_MODEL_SCALE_ONE for 1.0. Set by
+     *  bmi3_calibrate_bus_model from the bus statistics of the target
+     */
+    uint32_t scale_q16;
+};
+
+/*!
+ * @brief Structure to define a configuration of which the power is estimated
+ */
+struct bmi3_power_cfg
+{
+    /*! Configurations of the sensors, of which BMI3_ACCEL and BMI3_GYRO are used */
+    const struct bmi3_sens_config *sens_cfg;
+
+    /*! Number of configurations */
+    uint8_t n_sens;
+
+    /*! Frames stored in FIFO, BMI3_FIFO_ACC_EN, BMI3_FIFO_GYR_EN, BMI3_FIFO_TEMP_EN
+     *  and BMI3_FIFO_TIME_EN. 0 if FIFO is not used
+     */
+    uint16_t fifo_sens;
+
+    /*! FIFO water-mark level in words */
+    uint16_t fifo_wm;
+
+    /*! Interrupt mapping, of which the data ready and FIFO interrupts wake the host */
+    const struct bmi3_map_int *map_int;
+
+    /*! Expected rate of the feature interrupts mapped to a pin, in mHz */
+    uint32_t event_mhz;
+};
+
+/*!
+ * @brief Structure to store the power estimate of a configuration
+ */
+struct bmi3_power_estimate
+{
+    /*! Supply current of the sensor, in nA */
+    uint32_t sensor_na;
+
+    /*! Host wake-ups, in mHz */
+    uint32_t wakeups_mhz;
+
+    /*! Bus transactions, in mHz */
+    uint32_t xfers_mhz;
+
+    /*! Bytes transferred per second, along with dummy bytes */
+    uint32_t bytes_per_s;
+
+    /*! Time the bus is active, in microseconds per second */
+    uint32_t bus_us_per_s;
+};
+
 /*!
  * @brief Structure to store config version
  */
@@ -2767,6 +5164,26 @@ struct bmi3_self_calib_rslt
     uint8_t sc_error_status;
 };
 
+/*!
+ * @brief Structure to define the state of a non-blocking gyro self-calibration
+ */
+struct bmi3_sc_ctx
+{
+    /*! State of the self-calibration: BMI3_ST_STATE_IDLE, BMI3_ST_STATE_RUNNING,
+     *  BMI3_ST_STATE_COMPLETE or BMI3_ST_STATE_TIMEOUT
+     */
+    uint8_t state;
+
+    /*! Number of polls of the self-calibration status */
+    uint8_t polls;
+
+    /*! Feature engine status read on completion of the self-calibration */
+    uint8_t feature_io1;
+
+    /*! Accel configuration restored at the end of the self-calibration */
+    struct bmi3_sens_config acc_cfg;
+};
+
 /*!
  * @brief Structure to store alternate status
  */
@@ -2779,6 +5196,198 @@ struct bmi3_alt_status
     uint8_t alt_gyro_status;
 };
 
+/*!
+ * @brief Structure to define a health snapshot of the device, taken every
+ * "period" calls of bmi3_health_poll
+ */
+struct bmi3_health
+{
+    /*! Error register of the last snapshot */
+    struct bmi3_err_reg err_reg;
+
+    /*! Alternate configuration status of the last snapshot */
+    struct bmi3_alt_status alt_status;
+
+    /*! Sensor status register of the last snapshot */
+    uint16_t status;
+
+    /*! Feature engine error and status register of the last snapshot */
+    uint16_t feature_status;
+
+    /*! Faults of the last snapshot, BMI3_HEALTH_* */
+    uint16_t faults;
+
+    /*! Number of calls of bmi3_health_poll per snapshot */
+    uint16_t period;
+
+    /*! Number of calls of bmi3_health_poll left until the next snapshot */
+    uint16_t countdown;
+
+    /*! Number of snapshots taken */
+    uint32_t snapshots;
+
+    /*! Number of snapshots with a fault */
+    uint32_t faulty;
+};
+
+/*!
+ * @brief Structure to define the targets of the ODR and power governor
+ */
+struct bmi3_governor_target
+{
+    /*! ODR of accel and gyro while in motion, BMI3_ACC_ODR_* */
+    uint8_t active_odr;
+
+    /*! Accel and gyro mode while in motion, BMI3_ACC_MODE_NORMAL or BMI3_ACC_MODE_HIGH_PERF */
+    uint8_t active_mode;
+
+    /*! ODR of accel at rest in low-power mode, BMI3_ACC_ODR_0_78HZ to BMI3_ACC_ODR_400HZ */
+    uint8_t idle_odr;
+
+    /*! Number of samples averaged at rest, BMI3_ACC_AVG*, the noise target of low-power mode */
+    uint8_t idle_avg_num;
+
+    /*! BMI3_ENABLE if gyro is needed while in motion, it is suspended at rest */
+    uint8_t gyro_en;
+
+    /*! Latency budget of the FIFO water-mark level, NULL to keep the water-mark level */
+    const struct bmi3_fifo_wm_budget *budget;
+};
+
+/*!
+ * @brief Structure to define the state of the ODR and power governor
+ */
+struct bmi3_governor
+{
+    /*! ODR while in motion */
+    uint8_t active_odr;
+
+    /*! ODR at rest */
+    uint8_t idle_odr;
+
+    /*! BMI3_ENABLE while the alternate (rest) configuration is active */
+    uint8_t alt_active;
+
+    /*! Effective ODR of the samples */
+    uint8_t odr;
+
+    /*! FIFO water-mark level set, 0 if not set by the governor */
+    uint16_t fifo_wm;
+};
+
+/*!
+ * @brief Structure to define the targets of the auto-range governor of accel or
+ * gyro
+ */
+struct bmi3_auto_range_target
+{
+    /*! Sensor type, BMI3_ACCEL or BMI3_GYRO */
+    uint8_t type;
+
+    /*! Finest range to be set, BMI3_ACC_RANGE_* or BMI3_GYR_RANGE_* */
+    uint8_t min_range;
+
+    /*! Coarsest range to be set */
+    uint8_t max_range;
+
+    /*! Peak magnitude in LSB from which the next coarser range is set, a saturated sample always counts */
+    uint16_t up_thres;
+
+    /*! Peak magnitude in LSB below which the next finer range is set, less than half of up_thres */
+    uint16_t down_thres;
+
+    /*! Number of consecutive samples below down_thres before the next finer range is set */
+    uint16_t hold_samples;
+};
+
+/*!
+ * @brief Structure to define the state of the auto-range governor
+ */
+struct bmi3_auto_range
+{
+    /*! Targets of the governor */
+    struct bmi3_auto_range_target target;
+
+    /*! Range set in the sensor */
+    uint8_t range;
+
+    /*! Range to be set by bmi3_auto_range_apply, equal to range if no switch is due */
+    uint8_t next_range;
+
+    /*! Consecutive samples below down_thres */
+    uint16_t quiet;
+
+    /*! Peak magnitude in LSB since the last switch */
+    uint16_t peak;
+
+    /*! Number of range switches */
+    uint16_t n_switch;
+
+    /*! Number of saturated samples */
+    uint32_t n_sat;
+
+    /*! Scale of the range set, as in bmi3_unit_scale */
+    int32_t scale_q;
+
+    /*! Scale of the frames which were in the FIFO at the last switch */
+    int32_t prev_scale_q;
+
+    /*! Number of FIFO frames still to be read with prev_scale_q */
+    uint16_t prev_frames;
+};
+
+/*!
+ * @brief Structure to define the requirements of a consumer of the scheduler
+ */
+struct bmi3_sched_consumer
+{
+    /*! Maximum age in microseconds of a sample when it is delivered, 0 if the consumer is not registered */
+    uint32_t latency_us;
+
+    /*! Minimum output data rate, BMI3_ACC_ODR_* */
+    uint8_t odr;
+};
+
+/*!
+ * @brief Structure to define the state of the scheduler, which delivers the
+ * samples either on the data-ready interrupt or in FIFO batches
+ */
+struct bmi3_sched
+{
+    /*! Requirements of the consumers */
+    struct bmi3_sched_consumer consumer[BMI3_SCHED_MAX_CONSUMERS];
+
+    /*! Worst case time in microseconds from an interrupt until the read starts */
+    uint32_t service_us;
+
+    /*! Bus speed in bits per second */
+    uint32_t bus_hz;
+
+    /*! Sensors delivered, BMI3_FIFO_ACC_EN and/or BMI3_FIFO_GYR_EN */
+    uint16_t fifo_sens;
+
+    /*! Interrupt pin of the data-ready or FIFO water-mark interrupt, enum bmi3_hw_int_pin */
+    uint8_t int_pin;
+
+    /*! Mode set, BMI3_SCHED_DRDY or BMI3_SCHED_FIFO */
+    uint8_t mode;
+
+    /*! Output data rate set */
+    uint8_t odr;
+
+    /*! BMI3_ENABLE once the mode is set in the sensor */
+    uint8_t applied;
+
+    /*! FIFO water-mark level set in FIFO mode */
+    uint16_t fifo_wm;
+
+    /*! Tightest latency in microseconds of the consumers */
+    uint32_t latency_us;
+
+    /*! Interrupts per second, in milli-Hz */
+    uint32_t wakeup_mhz;
+};
+
 /*!
  * @brief Structure to store accel dp gain offset values
  */
@@ -2827,6 +5436,77 @@ struct bmi3_gyr_dp_gain_offset
     uint8_t gyr_dp_dgain_z;
 };
 
+/*!
+ * @brief Structure to define the state of the online gyro bias tracker, which
+ * accumulates gyro samples during no-motion intervals
+ */
+struct bmi3_gyro_bias
+{
+    /*! Data path offset and gain image of the sensor */
+    struct bmi3_gyr_dp_gain_offset dp;
+
+    /*! Sums of the samples of x, y and z axis since the last estimate */
+    int32_t sum[3];
+
+    /*! Number of samples accumulated since the last estimate */
+    uint32_t n;
+
+    /*! Number of samples of an estimate */
+    uint16_t min_samples;
+
+    /*! Number of estimates written back to the sensor */
+    uint16_t updates;
+
+    /*! Gyro range of the samples, BMI3_GYR_RANGE_* */
+    uint8_t range;
+
+    /*! Right shift of the correction of an estimate up to 7, 0 applies the full correction */
+    uint8_t gain_shift;
+
+    /*! Non-zero between a no-motion and an any-motion interrupt */
+    uint8_t still;
+};
+
+/*!
+ * @brief Structure to define the step cadence derived from the increments of
+ * the step counter, timestamped with the sensor time
+ */
+struct bmi3_step_cadence
+{
+    /*! Steps counted since the initialization */
+    uint32_t steps;
+
+    /*! Step count of the sensor at the last increment */
+    uint32_t last_count;
+
+    /*! 32-bit sensor time of the last increment in ticks of BMI3_SENSORTIME_RESOLUTION */
+    uint32_t last_time;
+
+    /*! Step frequency in mHz from the average step duration, 0 outside of a bout */
+    uint32_t cadence_mhz;
+
+    /*! Running average of the step duration of the bout in microseconds */
+    uint32_t interval_avg_us;
+
+    /*! Running average of the deviation of the step duration from its average in microseconds */
+    uint32_t interval_dev_us;
+
+    /*! Shortest step duration of an increment in microseconds */
+    uint32_t interval_min_us;
+
+    /*! Longest step duration of an increment within a bout in microseconds */
+    uint32_t interval_max_us;
+
+    /*! Number of increments within a bout */
+    uint32_t updates;
+
+    /*! Number of bouts, sequences of increments without pause */
+    uint16_t bouts;
+
+    /*! BMI3_ENABLE while the increments follow each other without pause */
+    uint8_t in_bout;
+};
+
 /*!
  * @brief Structure to store accel user gain offset values
  */
@@ -2893,6 +5573,20 @@ struct bmi3_accel_foc_g_value
     uint8_t sign;
 };
 
+/*!
+ * @brief Structure to define the configuration of FIFO-based accel FOC
+ */
+struct bmi3_accel_foc_fifo_cfg
+{
+    /*! Accel output data rate during FOC: BMI3_ACC_ODR_0_78HZ to BMI3_ACC_ODR_6400HZ,
+     *  0 to keep the configured output data rate
+     */
+    uint8_t odr;
+
+    /*! Number of samples averaged: 1 to BMI3_FOC_FIFO_MAX_SAMPLES */
+    uint16_t sample_count;
+};
+
 /*!
  * @brief Structure to store temporary accelerometer values
  */
@@ -2908,6 +5602,192 @@ struct bmi3_foc_temp_value
     int32_t z;
 };
 
+/*!
+ * @brief Structure to define the state of a resumable operation, run step by
+ * step by "bmi3_op_step" instead of waiting for the sensor
+ */
+struct bmi3_op
+{
+    /*! Operation: BMI3_OP_SOFT_RESET, BMI3_OP_SELF_TEST, BMI3_OP_GYRO_SC,
+     *  BMI3_OP_UPLOAD_CONFIG or BMI3_OP_ACCEL_FOC, BMI3_OP_NONE once complete
+     */
+    uint8_t kind;
+
+    /*! Step of the operation run by the next call of "bmi3_op_step" */
+    uint8_t step;
+
+    /*! Time in microseconds to wait before the next call of "bmi3_op_step" */
+    uint32_t wait_us;
+
+    /*! Time in microseconds waited for the feature engine after soft-reset */
+    uint32_t elapsed;
+
+    /*! Number of samples read by the accel FOC, or bytes written of the config array */
+    uint16_t count;
+
+    /*! Number of remaining data ready polls of the sample read by the accel FOC */
+    uint8_t tries;
+
+    /*! Self-test or self-calibration selection */
+    uint8_t selection;
+
+    /*! Apply the self-calibration correction: BMI3_ENABLE or BMI3_DISABLE */
+    uint8_t apply_corr;
+
+    /*! Config array to be uploaded */
+    const uint8_t *config_array;
+
+    /*! Size of the config array */
+    uint16_t config_size;
+
+    /*! Accel axis of the accel FOC */
+    const struct bmi3_accel_foc_g_value *accel_g_value;
+
+    /*! Result of the self-test */
+    struct bmi3_st_result *st_result;
+
+    /*! Result of the self-calibration */
+    struct bmi3_self_calib_rslt *sc_rslt;
+
+    /*! State of the self-test */
+    struct bmi3_st_ctx st_ctx;
+
+    /*! State of the self-calibration */
+    struct bmi3_sc_ctx sc_ctx;
+
+    /*! Sum of the accel samples read by the accel FOC */
+    struct bmi3_foc_temp_value foc_sum;
+
+    /*! Accel configuration restored at the end of the accel FOC */
+    struct bmi3_sens_config acc_cfg;
+};
+
+/*!
+ * @brief Structure to define a unit of a calibration line along with its results
+ */
+struct bmi3_calib_unit
+{
+    /*! Device of the unit */
+    struct bmi3_dev *dev;
+
+    /*! Resumable operation of the running procedure */
+    struct bmi3_op op;
+
+    /*! Result of the self-test, valid once BMI3_OP_SELF_TEST of the plan is complete */
+    struct bmi3_st_result st_result;
+
+    /*! Result of the gyro self-calibration, valid once BMI3_OP_GYRO_SC of the plan is complete */
+    struct bmi3_self_calib_rslt sc_rslt;
+
+    /*! Calibration state read at the end of the plan, valid if "rslt" is BMI3_OK */
+    struct bmi3_calib_blob blob;
+
+    /*! Time in microseconds left to wait before the next step of the unit */
+    uint32_t wait_us;
+
+    /*! Index of the next procedure of the plan */
+    uint8_t next;
+
+    /*! BMI3_ENABLE once the plan is complete or aborted */
+    uint8_t done;
+
+    /*! Result of the unit: BMI3_OK or the error of the failed procedure */
+    int8_t rslt;
+
+    /*! Failed procedure, BMI3_OP_NONE if no procedure failed */
+    uint8_t failed_op;
+};
+
+/*!
+ * @brief Structure to define a calibration line, which runs the same plan of
+ * procedures concurrently on the devices of a group
+ */
+struct bmi3_calib_line
+{
+    /*! Units of the line, one per device of the group */
+    struct bmi3_calib_unit unit[BMI3_GROUP_MAX_DEV];
+
+    /*! Procedures run in order on each unit: BMI3_OP_SOFT_RESET, BMI3_OP_SELF_TEST,
+     *  BMI3_OP_GYRO_SC or BMI3_OP_ACCEL_FOC
+     */
+    uint8_t plan[BMI3_CALIB_PLAN_MAX];
+
+    /*! Number of procedures of the plan */
+    uint8_t n_plan;
+
+    /*! Number of units of the line */
+    uint8_t n_unit;
+
+    /*! Number of units of which the plan is not complete */
+    uint8_t pending;
+
+    /*! Self-test selection, BMI3_ST_BOTH_ACC_GYR by default */
+    uint8_t st_selection;
+
+    /*! Self-calibration selection, sensitivity and offset by default */
+    uint8_t sc_selection;
+
+    /*! Apply the self-calibration correction, BMI3_ENABLE by default */
+    uint8_t apply_corr;
+
+    /*! Accel axis and sign of the gravity of the accel FOC, the same for all units of the fixture */
+    const struct bmi3_accel_foc_g_value *accel_g_value;
+};
+
+/*!
+ * @brief Structure to define a unit of a bring-up, one per possible I2C address
+ * or chip-select of a sensor
+ */
+struct bmi3_bring_up_unit
+{
+    /*! Device of the unit */
+    struct bmi3_dev *dev;
+
+    /*! Resumable soft-reset of the unit */
+    struct bmi3_op op;
+
+    /*! Time in microseconds left to wait before the next step of the unit */
+    uint32_t wait_us;
+
+    /*! Stage of the unit: BMI3_BRING_UP_PROBE, BMI3_BRING_UP_RESET, BMI3_BRING_UP_SETUP
+     *  or BMI3_BRING_UP_DONE
+     */
+    uint8_t stage;
+
+    /*! Result of the unit: BMI3_OK once set up, BMI3_E_DEV_NOT_FOUND if no variant
+     *  matches the chip-id read, else the error of the failed stage
+     */
+    int8_t rslt;
+};
+
+/*!
+ * @brief Structure to define a bring-up, which probes, soft-resets and sets up
+ * several devices concurrently
+ */
+struct bmi3_bring_up
+{
+    /*! Units of the bring-up, one per device */
+    struct bmi3_bring_up_unit unit[BMI3_GROUP_MAX_DEV];
+
+    /*! Variants of the sensors which may be mounted */
+    const struct bmi3_variant *const *variants;
+
+    /*! Number of variants */
+    uint8_t n_variants;
+
+    /*! Register image written to each device once set up, NULL to keep the configuration */
+    const struct bmi3_reg_image *image;
+
+    /*! Number of units of the bring-up */
+    uint8_t n_unit;
+
+    /*! Number of units of which the bring-up is not complete */
+    uint8_t pending;
+
+    /*! Number of units set up successfully */
+    uint8_t n_ready;
+};
+
 /*!
  * @brief Structure to store accelerometer data deviation from ideal value
  */
@@ -0,0 +1,659 @@
+/**
+ * Copyright (c) 2024 Bosch Sensortec GmbH. All rights reserved.
+*
+* BSD-3-Clause
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright
+*    notice, this list of conditions and the following disclaimer.
+*
+* 2. Redistributions in binary form must reproduce the above copyright
+*    notice, this list of conditions and the following disclaimer in the
+*    documentation and/or other materials provided with the distribution.
+*
+* 3. Neither the name of the copyright holder nor the names of its
+*    contributors may be used to endorse or promote products derived from
+*    this software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+* COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+* (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+* HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+* STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+* IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+*
+* @file       bmi3_fifo_simd.c
+* @date       2024-10-17
+* @version    v2.4.0
+*
+*/
+
+/******************************************************************************/
+
+/*!  @name          Header Files                                  */
+/******************************************************************************/
+#include "bmi3_fifo_simd.h"
+
+#ifndef BMI3_FIFO_SIMD_DISABLE
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+#include <emmintrin.h>
+#define BMI3_FIFO_SIMD_SSE2
+#elif (defined(__ARM_NEON) || defined(__ARM_NEON__)) && !defined(__ARM_BIG_ENDIAN)
+#include <arm_neon.h>
+#define BMI3_FIFO_SIMD_NEON
+#endif
+#endif
+
+/***************************************************************************/
+
+/*!              Macro definitions
+ ****************************************************************************/
+
+/*! Number of frames unpacked at once by the vector code */
+#define BMI3_FIFO_SIMD_BLOCK  UINT8_C(8)
+
+/*! Number of bytes loaded from the x-axis data of each frame by the vector code */
+#define BMI3_FIFO_SIMD_LOAD   UINT8_C(8)
+
+/***************************************************************************/
+
+/*!         Local Function Prototypes
+ ****************************************************************************/
+
+/*!
+ * @brief This internal API is the portable loop to unpack a range of frames
+ * into separate arrays.
+ *
+ * @param[in]     frames           : Pointer to the first byte of the first frame.
+ * @param[in]     first            : Index of the first frame of the range.
+ * @param[in]     frame_count      : Number of frames of the range.
+ * @param[in]     frame_len        : Length of a frame in bytes.
+ * @param[in]     axes_offset      : Byte offset of x, y and z data in the frame.
+ * @param[in]     sens_time_offset : Byte offset of sensor time in the frame.
+ * @param[in]     dummy_frame      : Value of x-axis data denoting a dummy frame.
+ * @param[in]     planes           : Arrays where the data is stored.
+ * @param[in,out] out_index        : Index of the next entry of the arrays.
+ */
+static void unpack_planes_portable(const uint8_t *frames,
+                                   uint16_t first,
+                                   uint16_t frame_count,
+                                   uint8_t frame_len,
+                                   uint8_t axes_offset,
+                                   uint8_t sens_time_offset,
+                                   uint16_t dummy_frame,
+                                   const struct bmi3_fifo_sens_axes_planes *planes,
+                                   uint16_t *out_index);
+
+/*!
+ * @brief This internal API is the portable loop to unpack a range of frames
+ * into the structure array.
+ *
+ * @param[in]     frames           : Pointer to the first byte of the first frame.
+ * @param[in]     first            : Index of the first frame of the range.
+ * @param[in]     frame_count      : Number of frames of the range.
+ * @param[in]     frame_len        : Length of a frame in bytes.
+ * @param[in]     axes_offset      : Byte offset of x, y and z data in the frame.
+ * @param[in]     sens_time_offset : Byte offset of sensor time in the frame.
+ * @param[in]     dummy_frame      : Value of x-axis data denoting a dummy frame.
+ * @param[out]    data             : Array where the data is stored.
+ * @param[in,out] out_index        : Index of the next entry of the array.
+ */
+static void unpack_frames_portable(const uint8_t *frames,
+                                   uint16_t first,
+                                   uint16_t frame_count,
+                                   uint8_t frame_len,
+                                   uint8_t axes_offset,
+                                   uint8_t sens_time_offset,
+                                   uint16_t dummy_frame,
+                                   struct bmi3_fifo_sens_axes_data *data,
+                                   uint16_t *out_index);
+
+/*!
+ * @brief This internal API returns the sensor time of a frame, 0 if not available.
+ *
+ * @param[in] frame            : Pointer to the first byte of the frame.
+ * @param[in] sens_time_offset : Byte offset of sensor time in the frame.
+ *
+ * @return Sensor time
+ */
+static uint16_t get_sensor_time(const uint8_t *frame, uint8_t sens_time_offset);
+
+#if defined(BMI3_FIFO_SIMD_SSE2) || defined(BMI3_FIFO_SIMD_NEON)
+
+/*!
+ * @brief This internal API returns the number of frames from the start whose
+ * x, y and z data can be loaded with BMI3_FIFO_SIMD_LOAD bytes without reading
+ * past the last frame.
+ *
+ * @param[in] frame_count : Number of complete frames.
+ * @param[in] frame_len   : Length of a frame in bytes.
+ * @param[in] axes_offset : Byte offset of x, y and z data in the frame.
+ *
+ * @return Number of frames
+ */
+static uint16_t get_vector_frames(uint16_t frame_count, uint8_t frame_len, uint8_t axes_offset);
+
+/*!
+ * @brief This internal API deinterleaves the x, y and z data of BMI3_FIFO_SIMD_BLOCK
+ * frames into BMI3_FIFO_SIMD_BLOCK entries of the arrays.
+ *
+ * @param[in]  data        : Pointer to the x-axis data of the first frame.
+ * @param[in]  frame_len   : Length of a frame in bytes.
+ * @param[in]  dummy_frame : Value of x-axis data denoting a dummy frame.
+ * @param[out] x           : Array of x-axis data.
+ * @param[out] y           : Array of y-axis data.
+ * @param[out] z           : Array of z-axis data.
+ *
+ * @return 0 if none of the frames is a dummy frame
+ */
+static uint32_t unpack_planes_block(const uint8_t *data,
+                                    uint8_t frame_len,
+                                    uint16_t dummy_frame,
+                                    int16_t *x,
+                                    int16_t *y,
+                                    int16_t *z);
+
+/*!
+ * @brief This internal API copies the x, y and z data of BMI3_FIFO_SIMD_BLOCK
+ * frames into BMI3_FIFO_SIMD_BLOCK entries of the structure array, with the
+ * sensor time set to 0.
+ *
+ * @param[in]  data        : Pointer to the x-axis data of the first frame.
+ * @param[in]  frame_len   : Length of a frame in bytes.
+ * @param[in]  dummy_frame : Value of x-axis data denoting a dummy frame.
+ * @param[out] out         : Structure array.
+ *
+ * @return 0 if none of the frames is a dummy frame
+ */
+static uint32_t unpack_frames_block(const uint8_t *data,
+                                    uint8_t frame_len,
+                                    uint16_t dummy_frame,
+                                    struct bmi3_fifo_sens_axes_data *out);
+
+#endif
+
+/***************************************************************************/
+
+/*!     User Interface Definitions
+ ****************************************************************************/
+
+/*!
+ * @brief This API deinterleaves the accelerometer or gyro data of complete
+ * headerless frames into separate arrays.
+ */
+uint16_t bmi3_fifo_simd_unpack_axes(const uint8_t *frames,
+                                    uint16_t frame_count,
+                                    uint8_t frame_len,
+                                    uint8_t axes_offset,
+                                    uint8_t sens_time_offset,
+                                    uint16_t dummy_frame,
+                                    const struct bmi3_fifo_sens_axes_planes *planes)
+{
+    /* Variable to index output arrays */
+    uint16_t out_index = 0;
+
+    /* Variable to loop through the frames */
+    uint16_t loop = 0;
+
+#if defined(BMI3_FIFO_SIMD_SSE2) || defined(BMI3_FIFO_SIMD_NEON)
+
+    /* Variable to store the number of frames of the vector code */
+    uint16_t vector_frames = get_vector_frames(frame_count, frame_len, axes_offset);
+
+    /* Variable to loop through the frames of a block */
+    uint16_t index;
+
+    /* Pointer to the frame */
+    const uint8_t *frame;
+
+    for (; (uint16_t)(loop + BMI3_FIFO_SIMD_BLOCK) <= vector_frames; loop += BMI3_FIFO_SIMD_BLOCK)
+    {
+        frame = &frames[(uint32_t)loop * frame_len];
+
+        if (unpack_planes_block(&frame[axes_offset], frame_len, dummy_frame, &planes->x[out_index],
+                                &planes->y[out_index], &planes->z[out_index]) == 0)
+        {
+            for (index = 0; (planes->sensor_time != NULL) && (index < BMI3_FIFO_SIMD_BLOCK); index++)
+            {
+                planes->sensor_time[out_index + index] =
+                    get_sensor_time(&frame[(uint32_t)index * frame_len], sens_time_offset);
+            }
+
+            out_index += BMI3_FIFO_SIMD_BLOCK;
+        }
+        else
+        {
+            /* Compact the block, the entries stored by the vector code are overwritten */
+            unpack_planes_portable(frames,
+                                   loop,
+                                   BMI3_FIFO_SIMD_BLOCK,
+                                   frame_len,
+                                   axes_offset,
+                                   sens_time_offset,
+                                   dummy_frame,
+                                   planes,
+                                   &out_index);
+        }
+    }
+#endif
+
+    unpack_planes_portable(frames,
+                           loop,
+                           (uint16_t)(frame_count - loop),
+                           frame_len,
+                           axes_offset,
+                           sens_time_offset,
+                           dummy_frame,
+                           planes,
+                           &out_index);
+
+    return out_index;
+}
+
+/*!
+ * @brief This API copies the accelerometer or gyro data of complete headerless
+ * frames into the structure array.
+ */
+uint16_t bmi3_fifo_simd_unpack_frames(const uint8_t *frames,
+                                      uint16_t frame_count,
+                                      uint8_t frame_len,
+                                      uint8_t axes_offset,
+                                      uint8_t sens_time_offset,
+                                      uint16_t dummy_frame,
+                                      struct bmi3_fifo_sens_axes_data *data)
+{
+    /* Variable to index output array */
+    uint16_t out_index = 0;
+
+    /* Variable to loop through the frames */
+    uint16_t loop = 0;
+
+#if defined(BMI3_FIFO_SIMD_SSE2) || defined(BMI3_FIFO_SIMD_NEON)
+
+    /* Variable to store the number of frames of the vector code */
+    uint16_t vector_frames = get_vector_frames(frame_count, frame_len, axes_offset);
+
+    /* Variable to loop through the frames of a block */
+    uint16_t index;
+
+    /* Pointer to the frame */
+    const uint8_t *frame;
+
+    /* The vector code stores a frame as four 16-bit words */
+    if (sizeof(struct bmi3_fifo_sens_axes_data) != BMI3_FIFO_SIMD_LOAD)
+    {
+        vector_frames = 0;
+    }
+
+    for (; (uint16_t)(loop + BMI3_FIFO_SIMD_BLOCK) <= vector_frames; loop += BMI3_FIFO_SIMD_BLOCK)
+    {
+        frame = &frames[(uint32_t)loop * frame_len];
+
+        if (unpack_frames_block(&frame[axes_offset], frame_len, dummy_frame, &data[out_index]) == 0)
+        {
+            for (index = 0; (sens_time_offset != BMI3_FIFO_NO_DATA) && (index < BMI3_FIFO_SIMD_BLOCK); index++)
+            {
+                data[out_index + index].sensor_time = get_sensor_time(&frame[(uint32_t)index * frame_len],
+                                                                      sens_time_offset);
+            }
+
+            out_index += BMI3_FIFO_SIMD_BLOCK;
+        }
+        else
+        {
+            /* Compact the block, the entries stored by the vector code are overwritten */
+            unpack_frames_portable(frames,
+                                   loop,
+                                   BMI3_FIFO_SIMD_BLOCK,
+                                   frame_len,
+                                   axes_offset,
+                                   sens_time_offset,
+                                   dummy_frame,
+                                   data,
+                                   &out_index);
+        }
+    }
+#endif
+
+    unpack_frames_portable(frames,
+                           loop,
+                           (uint16_t)(frame_count - loop),
+                           frame_len,
+                           axes_offset,
+                           sens_time_offset,
+                           dummy_frame,
+                           data,
+                           &out_index);
+
+    return out_index;
+}
+
+/*!
+ * @brief This API sets the FIFO unpack functions of the device to the functions
+ * of this backend.
+ */
+void bmi3_fifo_simd_attach(struct bmi3_dev *dev)
+{
+    if (dev != NULL)
+    {
+        dev->fifo_unpack_axes = bmi3_fifo_simd_unpack_axes;
+        dev->fifo_unpack_frames = bmi3_fifo_simd_unpack_frames;
+    }
+}
+
+/*!
+ * @brief This API returns the name of the instruction set the backend is built for.
+ */
+const char *bmi3_fifo_simd_backend(void)
+{
+#if defined(BMI3_FIFO_SIMD_SSE2)
+    return "sse2";
+#elif defined(BMI3_FIFO_SIMD_NEON)
+    return "neon";
+#else
+    return "portable";
+#endif
+}
+
+/***************************************************************************/
+
+/*!         Local Function Definitions
+ ****************************************************************************/
+
+/*!
+ * @brief This internal API is the portable loop to unpack a range of frames
+ * into separate arrays.
+ */
+static void unpack_planes_portable(const uint8_t *frames,
+                                   uint16_t first,
+                                   uint16_t frame_count,
+                                   uint8_t frame_len,
+                                   uint8_t axes_offset,
+                                   uint8_t sens_time_offset,
+                                   uint16_t dummy_frame,
+                                   const struct bmi3_fifo_sens_axes_planes *planes,
+                                   uint16_t *out_index)
+{
+    /* Pointer to the frame */
+    const uint8_t *frame = &frames[(uint32_t)first * frame_len];
+
+    /* Variable to store the x-axis data */
+    uint16_t data_x;
+
+    /* Variable to loop through the frames */
+    uint16_t loop;
+
+    for (loop = 0; loop < frame_count; loop++)
+    {
+        data_x = (uint16_t)(((uint16_t)frame[axes_offset + 1] << 8) | frame[axes_offset]);
+
+        /* Dummy frames are dropped */
+        if (data_x != dummy_frame)
+        {
+            planes->x[*out_index] = (int16_t)data_x;
+            planes->y[*out_index] = (int16_t)(((uint16_t)frame[axes_offset + 3] << 8) | frame[axes_offset + 2]);
+            planes->z[*out_index] = (int16_t)(((uint16_t)frame[axes_offset + 5] << 8) | frame[axes_offset + 4]);
+
+            if (planes->sensor_time != NULL)
+            {
+                planes->sensor_time[*out_index] = get_sensor_time(frame, sens_time_offset);
+            }
+
+            (*out_index)++;
+        }
+
+        frame += frame_len;
+    }
+}
+
+/*!
+ * @brief This internal API is the portable loop to unpack a range of frames
+ * into the structure array.
+ */
+static void unpack_frames_portable(const uint8_t *frames,
+                                   uint16_t first,
+                                   uint16_t frame_count,
+                                   uint8_t frame_len,
+                                   uint8_t axes_offset,
+                                   uint8_t sens_time_offset,
+                                   uint16_t dummy_frame,
+                                   struct bmi3_fifo_sens_axes_data *data,
+                                   uint16_t *out_index)
+{
+    /* Pointer to the frame */
+    const uint8_t *frame = &frames[(uint32_t)first * frame_len];
+
+    /* Variable to store the x-axis data */
+    uint16_t data_x;
+
+    /* Variable to loop through the frames */
+    uint16_t loop;
+
+    for (loop = 0; loop < frame_count; loop++)
+    {
+        data_x = (uint16_t)(((uint16_t)frame[axes_offset + 1] << 8) | frame[axes_offset]);
+
+        /* Dummy frames are dropped */
+        if (data_x != dummy_frame)
+        {
+            data[*out_index].x = (int16_t)data_x;
+            data[*out_index].y = (int16_t)(((uint16_t)frame[axes_offset + 3] << 8) | frame[axes_offset + 2]);
+            data[*out_index].z = (int16_t)(((uint16_t)frame[axes_offset + 5] << 8) | frame[axes_offset + 4]);
+            data[*out_index].sensor_time = get_sensor_time(frame, sens_time_offset);
+
+            (*out_index)++;
+        }
+
+        frame += frame_len;
+    }
+}
+
+/*!
+ * @brief This internal API returns the sensor time of a frame, 0 if not available.
+ */
+static uint16_t get_sensor_time(const uint8_t *frame, uint8_t sens_time_offset)
+{
+    /* Variable to store the sensor time */
+    uint16_t sensor_time = 0;
+
+    if (sens_time_offset != BMI3_FIFO_NO_DATA)
+    {
+        sensor_time = (uint16_t)(((uint16_t)frame[sens_time_offset + 1] << 8) | frame[sens_time_offset]);
+    }
+
+    return sensor_time;
+}
+
+#if defined(BMI3_FIFO_SIMD_SSE2) || defined(BMI3_FIFO_SIMD_NEON)
+
+/*!
+ * @brief This internal API returns the number of frames from the start whose
+ * x, y and z data can be loaded with BMI3_FIFO_SIMD_LOAD bytes.
+ */
+static uint16_t get_vector_frames(uint16_t frame_count, uint8_t frame_len, uint8_t axes_offset)
+{
+    /* Variable to store the number of bytes of the frames */
+    uint32_t frames_len = (uint32_t)frame_count * frame_len;
+
+    /* Variable to store the number of frames */
+    uint16_t vector_frames = 0;
+
+    if ((frame_len != 0) && (frames_len >= (uint32_t)(axes_offset + BMI3_FIFO_SIMD_LOAD)))
+    {
+        vector_frames = (uint16_t)(((frames_len - axes_offset - BMI3_FIFO_SIMD_LOAD) / frame_len) + 1);
+
+        if (vector_frames > frame_count)
+        {
+            vector_frames = frame_count;
+        }
+    }
+
+    return vector_frames;
+}
+
+#endif
+
+#ifdef BMI3_FIFO_SIMD_SSE2
+
+/*!
+ * @brief This internal API deinterleaves the x, y and z data of BMI3_FIFO_SIMD_BLOCK
+ * frames with SSE2.
+ */
+static uint32_t unpack_planes_block(const uint8_t *data,
+                                    uint8_t frame_len,
+                                    uint16_t dummy_frame,
+                                    int16_t *x,
+                                    int16_t *y,
+                                    int16_t *z)
+{
+    /* x, y, z and the following word of each frame */
+    __m128i f0 = _mm_loadl_epi64((const __m128i *)(const void *)&data[0]);
+    __m128i f1 = _mm_loadl_epi64((const __m128i *)(const void *)&data[frame_len]);
+    __m128i f2 = _mm_loadl_epi64((const __m128i *)(const void *)&data[2 * frame_len]);
+    __m128i f3 = _mm_loadl_epi64((const __m128i *)(const void *)&data[3 * frame_len]);
+    __m128i f4 = _mm_loadl_epi64((const __m128i *)(const void *)&data[4 * frame_len]);
+    __m128i f5 = _mm_loadl_epi64((const __m128i *)(const void *)&data[5 * frame_len]);
+    __m128i f6 = _mm_loadl_epi64((const __m128i *)(const void *)&data[6 * frame_len]);
+    __m128i f7 = _mm_loadl_epi64((const __m128i *)(const void *)&data[7 * frame_len]);
+
+    /* x0 x1 y0 y1 z0 z1 - -, ... */
+    __m128i t01 = _mm_unpacklo_epi16(f0, f1);
+    __m128i t23 = _mm_unpacklo_epi16(f2, f3);
+    __m128i t45 = _mm_unpacklo_epi16(f4, f5);
+    __m128i t67 = _mm_unpacklo_epi16(f6, f7);
+
+    /* x0 x1 x2 x3 y0 y1 y2 y3 and z0 z1 z2 z3 - - - -, ... */
+    __m128i xy03 = _mm_unpacklo_epi32(t01, t23);
+    __m128i z03 = _mm_unpackhi_epi32(t01, t23);
+    __m128i xy47 = _mm_unpacklo_epi32(t45, t67);
+    __m128i z47 = _mm_unpackhi_epi32(t45, t67);
+
+    __m128i vx = _mm_unpacklo_epi64(xy03, xy47);
+    __m128i vy = _mm_unpackhi_epi64(xy03, xy47);
+    __m128i vz = _mm_unpacklo_epi64(z03, z47);
+
+    _mm_storeu_si128((__m128i *)(void *)x, vx);
+    _mm_storeu_si128((__m128i *)(void *)y, vy);
+    _mm_storeu_si128((__m128i *)(void *)z, vz);
+
+    return (uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi16(vx, _mm_set1_epi16((short)dummy_frame)));
+}
+
+/*!
+ * @brief This internal API copies the x, y and z data of BMI3_FIFO_SIMD_BLOCK
+ * frames into the structure array with SSE2.
+ */
+static uint32_t unpack_frames_block(const uint8_t *data,
+                                    uint8_t frame_len,
+                                    uint16_t dummy_frame,
+                                    struct bmi3_fifo_sens_axes_data *out)
+{
+    /* Mask clearing the word following z, which is the sensor time of the output */
+    const __m128i keep = _mm_set_epi16(0, -1, -1, -1, 0, -1, -1, -1);
+    const __m128i dummy = _mm_set1_epi16((short)dummy_frame);
+    __m128i match = _mm_setzero_si128();
+    __m128i pair;
+    uint8_t index;
+
+    for (index = 0; index < BMI3_FIFO_SIMD_BLOCK; index += 2)
+    {
+        pair = _mm_unpacklo_epi64(_mm_loadl_epi64((const __m128i *)(const void *)&data[index * frame_len]),
+                                  _mm_loadl_epi64((const __m128i *)(const void *)&data[(index + 1) * frame_len]));
+        pair = _mm_and_si128(pair, keep);
+        match = _mm_or_si128(match, _mm_cmpeq_epi16(pair, dummy));
+        _mm_storeu_si128((__m128i *)(void *)&out[index], pair);
+    }
+
+    /* Only the x-axis words denote a dummy frame */
+    return (uint32_t)_mm_movemask_epi8(match) & 0x0303u;
+}
+
+#endif
+
+#ifdef BMI3_FIFO_SIMD_NEON
+
+/*!
+ * @brief This internal API deinterleaves the x, y and z data of BMI3_FIFO_SIMD_BLOCK
+ * frames with NEON.
+ */
+static uint32_t unpack_planes_block(const uint8_t *data,
+                                    uint8_t frame_len,
+                                    uint16_t dummy_frame,
+                                    int16_t *x,
+                                    int16_t *y,
+                                    int16_t *z)
+{
+    uint16x4_t f[BMI3_FIFO_SIMD_BLOCK];
+    uint16x4_t vx[2];
+    uint16x4_t vy[2];
+    uint16x4_t vz[2];
+    uint16x4x2_t lo;
+    uint16x4x2_t hi;
+    uint32x2x2_t xz;
+    uint32x2x2_t yw;
+    uint16x8_t match;
+    uint8_t index;
+
+    /* x, y, z and the following word of each frame */
+    for (index = 0; index < BMI3_FIFO_SIMD_BLOCK; index++)
+    {
+        f[index] = vreinterpret_u16_u8(vld1_u8(&data[index * frame_len]));
+    }
+
+    /* Transpose four frames at a time: x0 x1 z0 z1 and y0 y1 - -, then x0 x1 x2 x3, ... */
+    for (index = 0; index < 2; index++)
+    {
+        lo = vtrn_u16(f[4 * index], f[(4 * index) + 1]);
+        hi = vtrn_u16(f[(4 * index) + 2], f[(4 * index) + 3]);
+        xz = vtrn_u32(vreinterpret_u32_u16(lo.val[0]), vreinterpret_u32_u16(hi.val[0]));
+        yw = vtrn_u32(vreinterpret_u32_u16(lo.val[1]), vreinterpret_u32_u16(hi.val[1]));
+        vx[index] = vreinterpret_u16_u32(xz.val[0]);
+        vz[index] = vreinterpret_u16_u32(xz.val[1]);
+        vy[index] = vreinterpret_u16_u32(yw.val[0]);
+    }
+
+    vst1q_s16(x, vreinterpretq_s16_u16(vcombine_u16(vx[0], vx[1])));
+    vst1q_s16(y, vreinterpretq_s16_u16(vcombine_u16(vy[0], vy[1])));
+    vst1q_s16(z, vreinterpretq_s16_u16(vcombine_u16(vz[0], vz[1])));
+
+    match = vceqq_u16(vcombine_u16(vx[0], vx[1]), vdupq_n_u16(dummy_frame));
+
+    return (uint32_t)((vgetq_lane_u64(vreinterpretq_u64_u16(match), 0) |
+                       vgetq_lane_u64(vreinterpretq_u64_u16(match), 1)) != 0);
+}
+
+/*!
+ * @brief This internal API copies the x, y and z data of BMI3_FIFO_SIMD_BLOCK
+ * frames into the structure array with NEON.
+ */
+static uint32_t unpack_frames_block(const uint8_t *data,
+                                    uint8_t frame_len,
+                                    uint16_t dummy_frame,
+                                    struct bmi3_fifo_sens_axes_data *out)
+{
+    /* Mask clearing the word following z, which is the sensor time of the output */
+    static const uint16_t keep_words[4] = { 0xFFFF, 0xFFFF, 0xFFFF, 0 };
+    const uint16x4_t keep = vld1_u16(keep_words);
+    uint16x4_t frame;
+    uint32_t match = 0;
+    uint8_t index;
+
+    for (index = 0; index < BMI3_FIFO_SIMD_BLOCK; index++)
+    {
+        frame = vand_u16(vreinterpret_u16_u8(vld1_u8(&data[index * frame_len])), keep);
+        match |= (uint32_t)(vget_lane_u16(frame, 0) == dummy_frame);
+        vst1_u16((uint16_t *)(void *)&out[index], frame);
+    }
+
+    return match;
+}
+
+#endif
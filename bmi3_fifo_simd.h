@@ -0,0 +1,167 @@
+/**
+ * Copyright (c) 2024 Bosch Sensortec GmbH. All rights reserved.
+*
+* BSD-3-Clause
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright
+*    notice, this list of conditions and the following disclaimer.
+*
+* 2. Redistributions in binary form must reproduce the above copyright
+*    notice, this list of conditions and the following disclaimer in the
+*    documentation and/or other materials provided with the distribution.
+*
+* 3. Neither the name of the copyright holder nor the names of its
+*    contributors may be used to endorse or promote products derived from
+*    this software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+* COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+* (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+* HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+* STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+* IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+*
+* @file       bmi3_fifo_simd.h
+* @date       2024-10-17
+* @version    v2.4.0
+*
+*/
+
+/**
+ * \ingroup bmi3
+ * \defgroup bmi3FifoSimd FIFO SIMD backend
+ * @brief Optional vectorized FIFO unpack functions of "fifo_unpack_axes" and
+ * "fifo_unpack_frames" of bmi3_dev
+ *
+ * The frames are deinterleaved eight at a time with SSE2 on x86 and NEON on
+ * little-endian Arm, and a block holding a dummy frame is compacted by the
+ * portable loop. The remaining frames, and all frames on other targets (e.g.
+ * Cortex-M with Helium), are unpacked by the portable loop, so the result does
+ * not depend on the backend. Define BMI3_FIFO_SIMD_DISABLE to build the
+ * portable loop only.
+ *
+ * The source file is not needed by the driver; add bmi3_fifo_simd.c to the
+ * build and call bmi3_fifo_simd_attach() after the initialization.
+ */
+
+#ifndef _BMI3_FIFO_SIMD_H
+#define _BMI3_FIFO_SIMD_H
+
+/*! CPP guard */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/***************************************************************************/
+
+/*!             Header files
+ ****************************************************************************/
+#include "bmi3.h"
+
+/***************************************************************************/
+
+/*!     BMI3 FIFO SIMD User Interface function prototypes
+ ****************************************************************************/
+
+/**
+ * \ingroup bmi3FifoSimd
+ * \page bmi3_api_bmi3_fifo_simd_unpack_axes bmi3_fifo_simd_unpack_axes
+ * \code
+ * uint16_t bmi3_fifo_simd_unpack_axes(const uint8_t *frames, uint16_t frame_count, uint8_t frame_len,
+ *                                     uint8_t axes_offset, uint8_t sens_time_offset, uint16_t dummy_frame,
+ *                                     const struct bmi3_fifo_sens_axes_planes *planes);
+ * \endcode
+ * @details This API deinterleaves the accelerometer or gyro data of complete
+ * headerless frames into the arrays of "planes" and drops the dummy frames.
+ * It is an implementation of bmi3_fifo_unpack_axes_fptr_t.
+ *
+ * @param[in]  frames           : Pointer to the first byte of the first frame.
+ * @param[in]  frame_count      : Number of complete frames.
+ * @param[in]  frame_len        : Length of a frame in bytes.
+ * @param[in]  axes_offset      : Byte offset of x, y and z data in the frame.
+ * @param[in]  sens_time_offset : Byte offset of sensor time in the frame,
+ *                                BMI3_FIFO_NO_DATA if not available.
+ * @param[in]  dummy_frame      : Value of x-axis data denoting a dummy frame.
+ * @param[out] planes           : Arrays of at least "frame_count" entries.
+ *
+ * @return Number of frames stored in the arrays
+ */
+uint16_t bmi3_fifo_simd_unpack_axes(const uint8_t *frames,
+                                    uint16_t frame_count,
+                                    uint8_t frame_len,
+                                    uint8_t axes_offset,
+                                    uint8_t sens_time_offset,
+                                    uint16_t dummy_frame,
+                                    const struct bmi3_fifo_sens_axes_planes *planes);
+
+/**
+ * \ingroup bmi3FifoSimd
+ * \page bmi3_api_bmi3_fifo_simd_unpack_frames bmi3_fifo_simd_unpack_frames
+ * \code
+ * uint16_t bmi3_fifo_simd_unpack_frames(const uint8_t *frames, uint16_t frame_count, uint8_t frame_len,
+ *                                       uint8_t axes_offset, uint8_t sens_time_offset, uint16_t dummy_frame,
+ *                                       struct bmi3_fifo_sens_axes_data *data);
+ * \endcode
+ * @details This API copies the accelerometer or gyro data of complete
+ * headerless frames into the structure array "data" and drops the dummy
+ * frames. It is an implementation of bmi3_fifo_unpack_frames_fptr_t.
+ *
+ * @param[in]  frames           : Pointer to the first byte of the first frame.
+ * @param[in]  frame_count      : Number of complete frames.
+ * @param[in]  frame_len        : Length of a frame in bytes.
+ * @param[in]  axes_offset      : Byte offset of x, y and z data in the frame.
+ * @param[in]  sens_time_offset : Byte offset of sensor time in the frame,
+ *                                BMI3_FIFO_NO_DATA if not available.
+ * @param[in]  dummy_frame      : Value of x-axis data denoting a dummy frame.
+ * @param[out] data             : Array of at least "frame_count" entries.
+ *
+ * @return Number of frames stored in the array
+ */
+uint16_t bmi3_fifo_simd_unpack_frames(const uint8_t *frames,
+                                      uint16_t frame_count,
+                                      uint8_t frame_len,
+                                      uint8_t axes_offset,
+                                      uint8_t sens_time_offset,
+                                      uint16_t dummy_frame,
+                                      struct bmi3_fifo_sens_axes_data *data);
+
+/**
+ * \ingroup bmi3FifoSimd
+ * \page bmi3_api_bmi3_fifo_simd_attach bmi3_fifo_simd_attach
+ * \code
+ * void bmi3_fifo_simd_attach(struct bmi3_dev *dev);
+ * \endcode
+ * @details This API sets "fifo_unpack_axes" and "fifo_unpack_frames" of the
+ * device to the functions of this backend.
+ *
+ * @param[in,out] dev : Structure instance of bmi3_dev.
+ */
+void bmi3_fifo_simd_attach(struct bmi3_dev *dev);
+
+/**
+ * \ingroup bmi3FifoSimd
+ * \page bmi3_api_bmi3_fifo_simd_backend bmi3_fifo_simd_backend
+ * \code
+ * const char *bmi3_fifo_simd_backend(void);
+ * \endcode
+ * @details This API returns the name of the instruction set the backend is
+ * built for: "sse2", "neon" or "portable".
+ *
+ * @return Name of the instruction set
+ */
+const char *bmi3_fifo_simd_backend(void);
+
+#ifdef __cplusplus
+}
+#endif /* End of CPP guard */
+
+#endif /* _BMI3_FIFO_SIMD_H */